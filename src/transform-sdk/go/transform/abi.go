@@ -25,7 +25,9 @@ import (
 
 // An imported function to ensure that the broker supports this ABI version.
 //
-//go:wasmimport redpanda_transform check_abi_version_1
+// Version 2 of the ABI adds readRecords and writeRecords.
+//
+//go:wasmimport redpanda_transform check_abi_version_2
 func checkAbiVersion()
 
 // readRecordHeader reads all the data from the batch header into memory.
@@ -93,3 +95,29 @@ func readNextRecord(
 //
 //go:wasmimport redpanda_transform write_record
 func writeRecord(data unsafe.Pointer, length int32) int32
+
+// readRecords reads as many of the remaining records of the current batch as
+// fit into `buf`, encoded as they are within a record batch:
+//
+// length: varint
+// attributes: int8
+// timestampDelta: varlong
+// offsetDelta: varint
+// followed by the payload, as documented in `readRecord`.
+//
+// Returns the amount that was written into `buf` on success, 0 once all the
+// records of the batch are read, otherwise returns a negative number to
+// indicate an error (such as a buffer too small for the next record).
+//
+//go:wasmimport redpanda_transform read_records
+func readRecords(buf unsafe.Pointer, len int32) int32
+
+// writeRecords writes many new records by copying the data pointed to.
+//
+// Each record is the serialized "payload" of a record, as documented in
+// `writeRecord`, prefixed by its length as a varint.
+//
+// Returns a negative number to indicate an error.
+//
+//go:wasmimport redpanda_transform write_records
+func writeRecords(buf unsafe.Pointer, len int32) int32
@@ -15,8 +15,8 @@
 package transform
 
 import (
+	"encoding/binary"
 	"strconv"
-	"time"
 	"unsafe"
 
 	"github.com/redpanda-data/redpanda/src/transform-sdk/go/transform/internal/rwbuf"
@@ -35,11 +35,20 @@ type batchHeader struct {
 	baseSequence         int
 }
 
+const (
+	// The most bytes taken by the length, attributes, timestamp delta and
+	// offset delta of a record within a batch.
+	maxRecordMetadataSize = binary.MaxVarintLen32 + 1 + binary.MaxVarintLen64 + binary.MaxVarintLen32
+	// Large enough to read the records of most batches at once.
+	minInputBufSize = 64 * 1024
+)
+
 // Cache a bunch of objects to not GC
 var (
 	currentHeader batchHeader  = batchHeader{}
-	inbuf         *rwbuf.RWBuf = rwbuf.New(128)
+	inbuf         *rwbuf.RWBuf = rwbuf.New(minInputBufSize)
 	outbuf        *rwbuf.RWBuf = rwbuf.New(128)
+	recordbuf     *rwbuf.RWBuf = rwbuf.New(128)
 	e             writeEvent
 )
 
@@ -55,6 +64,9 @@ func process(userTransformFunction OnRecordWrittenCallback) {
 }
 
 // process and transform a single batch
+//
+// The records are read from the broker as many at a time as fit in inbuf, and
+// the records they are transformed into are written back in a single call.
 func processBatch(userTransformFunction OnRecordWrittenCallback) {
 	bufSize := int(readBatchHeader(
 		unsafe.Pointer(&currentHeader.baseOffset),
@@ -72,43 +84,43 @@ func processBatch(userTransformFunction OnRecordWrittenCallback) {
 		panic("failed to read batch header errno: " + strconv.Itoa(bufSize))
 	}
 
-	for i := 0; i < int(currentHeader.recordCount); i++ {
+	// The buffer must fit the largest record of the batch
+	inbuf.EnsureSize(bufSize + maxRecordMetadataSize)
+	for read := 0; read < int(currentHeader.recordCount); {
 		inbuf.Reset()
-		inbuf.EnsureSize(bufSize)
-		var timestamp int64
-		amt := int(readNextRecord(
-			unsafe.Pointer(&e.record.Attrs.attr),
-			unsafe.Pointer(&timestamp),
-			unsafe.Pointer(&e.record.Offset),
+		amt := int(readRecords(
 			unsafe.Pointer(inbuf.WriterBufPtr()),
-			int32(bufSize)),
+			int32(inbuf.WriterLen())),
 		)
-		// Assign the timestamp value to the record
-		e.record.Timestamp = time.UnixMilli(timestamp)
-		inbuf.AdvanceWriter(amt)
-		if amt < 0 {
-			panic("reading record failed with errno: " + strconv.Itoa(amt) + " buffer size: " + strconv.Itoa(bufSize))
-		}
-		err := e.record.deserializePayload(inbuf)
-		if err != nil {
-			panic("deserializing record failed: " + err.Error())
+		if amt <= 0 {
+			panic("reading records failed with errno: " + strconv.Itoa(amt) + " buffer size: " + strconv.Itoa(inbuf.WriterLen()))
 		}
-		rs, err := userTransformFunction(&e)
-		if err != nil {
-			panic("transforming record failed: " + err.Error())
+		inbuf.AdvanceWriter(amt)
+		outbuf.Reset()
+		for inbuf.ReaderLen() > 0 {
+			err := e.record.deserialize(inbuf, &currentHeader)
+			if err != nil {
+				panic("deserializing record failed: " + err.Error())
+			}
+			read++
+			rs, err := userTransformFunction(&e)
+			if err != nil {
+				panic("transforming record failed: " + err.Error())
+			}
+			for _, r := range rs {
+				recordbuf.Reset()
+				r.serializePayload(recordbuf)
+				outbuf.WriteBytesWithSize(recordbuf.ReadAll())
+			}
 		}
-		if rs == nil {
+		if outbuf.ReaderLen() == 0 {
 			continue
 		}
-		for _, r := range rs {
-			outbuf.Reset()
-			r.serializePayload(outbuf)
-			b := outbuf.ReadAll()
-			// Write the record back out to the broker
-			amt := int(writeRecord(unsafe.Pointer(&b[0]), int32(len(b))))
-			if amt != len(b) {
-				panic("writing record failed with errno: " + strconv.Itoa(amt))
-			}
+		b := outbuf.ReadAll()
+		// Write the records back out to the broker
+		amt = int(writeRecords(unsafe.Pointer(&b[0]), int32(len(b))))
+		if amt != len(b) {
+			panic("writing records failed with errno: " + strconv.Itoa(amt))
 		}
 	}
 }
@@ -16,6 +16,8 @@ package transform
 
 import (
 	"encoding/binary"
+	"errors"
+	"time"
 
 	"github.com/redpanda-data/redpanda/src/transform-sdk/go/transform/internal/rwbuf"
 )
@@ -64,6 +66,46 @@ func (r *Record) deserializePayload(b *rwbuf.RWBuf) error {
 	return nil
 }
 
+// The attribute of a batch whose records are timestamped by the broker
+const logAppendTimeAttr = 0x08
+
+// Deserialize a record encoded as it is within a batch, with the
+// metadata relative to the batch header.
+func (r *Record) deserialize(b *rwbuf.RWBuf, h *batchHeader) error {
+	length, err := binary.ReadVarint(b)
+	if err != nil {
+		return err
+	}
+	start := b.ReaderLen()
+	attr, err := b.ReadByte()
+	if err != nil {
+		return err
+	}
+	timestampDelta, err := binary.ReadVarint(b)
+	if err != nil {
+		return err
+	}
+	offsetDelta, err := binary.ReadVarint(b)
+	if err != nil {
+		return err
+	}
+	err = r.deserializePayload(b)
+	if err != nil {
+		return err
+	}
+	if start-b.ReaderLen() != int(length) {
+		return errors.New("record length mismatch")
+	}
+	r.Attrs.attr = attr
+	if h.attributes&logAppendTimeAttr == 0 {
+		r.Timestamp = time.UnixMilli(h.baseTimestamp + timestampDelta)
+	} else {
+		r.Timestamp = time.UnixMilli(h.maxTimestamp)
+	}
+	r.Offset = h.baseOffset + offsetDelta
+	return nil
+}
+
 // Serialize this output record's payload (key, value, headers) into the buffer
 func (r Record) serializePayload(b *rwbuf.RWBuf) {
 	b.WriteBytesWithSize(r.Key)
@@ -86,3 +86,40 @@ func TestRoundTrip(t *testing.T) {
 		t.Fatalf("%#v != %#v", r, output)
 	}
 }
+
+// Serialize the record as it is within a batch, the way the broker copies it
+// out with readRecords.
+func serializeBatchRecord(r Record, b *rwbuf.RWBuf) {
+	payload := rwbuf.New(0)
+	payload.WriteByte(r.Attrs.attr)
+	payload.WriteVarint(r.Timestamp.UnixMilli() - baseTimestamp)
+	payload.WriteVarint(r.Offset - baseOffset)
+	r.serializePayload(payload)
+	b.WriteBytesWithSize(payload.ReadAll())
+}
+
+func TestDeserializeBatchRecords(t *testing.T) {
+	h := batchHeader{
+		baseOffset:    baseOffset,
+		baseTimestamp: baseTimestamp,
+	}
+	records := []Record{makeRandomRecord(), makeRandomRecord()}
+	records[1].Offset++
+	b := rwbuf.New(0)
+	for _, r := range records {
+		serializeBatchRecord(r, b)
+	}
+	for _, r := range records {
+		output := Record{}
+		err := output.deserialize(b, &h)
+		if err != nil {
+			t.Fatal(err)
+		}
+		if !reflect.DeepEqual(r, output) {
+			t.Fatalf("%#v != %#v", r, output)
+		}
+	}
+	if b.ReaderLen() != 0 {
+		t.Fatalf("%d bytes left", b.ReaderLen())
+	}
+}
@@ -56,3 +56,11 @@ func readNextRecord(
 func writeRecord(buf unsafe.Pointer, len int32) int32 {
 	panic("stub")
 }
+
+func readRecords(buf unsafe.Pointer, len int32) int32 {
+	panic("stub")
+}
+
+func writeRecords(buf unsafe.Pointer, len int32) int32 {
+	panic("stub")
+}
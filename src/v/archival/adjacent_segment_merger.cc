@@ -107,6 +107,12 @@ std::optional<adjacent_segment_run> adjacent_segment_merger::scan_manifest(
             // We're looking for the remote segment
             break;
         }
+        if (_is_local && it->base_offset < local_start_offset) {
+            // The segment is only available in the cloud. Merging it would
+            // require downloading it back so the local lookup skips it and
+            // builds the run only from segments that are still on disk.
+            continue;
+        }
         if (run.maybe_add_segment(*it, max_segment_size)) {
             // We have found a run with the size close to max_segment_size
             // and can proceed early.
@@ -212,6 +218,16 @@ adjacent_segment_merger::run(run_quota_t quota) {
             co_return result;
         }
         vassert(archiver_units.has_value(), "Must take archiver units");
+        if (upl->candidate.sources.empty()) {
+            // The run is not available locally. The segments are streamed
+            // from disk directly into the upload and reuploading from the
+            // cloud is not supported, so there is nothing to do.
+            vlog(
+              _ctxlog.debug,
+              "Upload candidate {} has no local sources, skipping",
+              upl->candidate.exposed_name);
+            co_return result;
+        }
         auto next = model::next_offset(upl->candidate.final_offset);
         vlog(
           _ctxlog.debug,
@@ -15,8 +15,10 @@
 #include "archival/logger.h"
 #include "archival/retention_calculator.h"
 #include "archival/scrubber.h"
+#include "archival/segment_compressor.h"
 #include "archival/segment_reupload.h"
 #include "archival/types.h"
+#include "bytes/iostream.h"
 #include "cloud_storage/async_manifest_view.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote.h"
@@ -63,6 +65,7 @@
 #include <chrono>
 #include <exception>
 #include <iterator>
+#include <limits>
 #include <numeric>
 #include <stdexcept>
 #include <utility>
@@ -222,6 +225,9 @@ ntp_archiver::ntp_archiver(
   , _max_segments_pending_deletion(
       config::shard_local_cfg()
         .cloud_storage_max_segments_pending_deletion_per_partition.bind())
+  , _concurrency(
+      config::shard_local_cfg()
+        .cloud_storage_max_concurrent_segment_uploads_per_partition.bind())
   , _housekeeping_interval(
       config::shard_local_cfg().cloud_storage_housekeeping_interval_ms.bind())
   , _housekeeping_jitter(_housekeeping_interval(), housekeeping_jit)
@@ -1133,10 +1139,68 @@ split_segment_stream(
       std::move(std::get<0>(res)), std::move(std::get<1>(res)));
 }
 
+static std::pair<ss::input_stream<char>, ss::input_stream<char>>
+split_segment_body(iobuf& body) {
+    return std::make_pair(
+      make_iobuf_input_stream(body.share(0, body.size_bytes())),
+      make_iobuf_input_stream(body.share(0, body.size_bytes())));
+}
+
+std::optional<model::compression> ntp_archiver::upload_compression() {
+    if (!config::shard_local_cfg().cloud_storage_compress_segment_uploads()) {
+        return std::nullopt;
+    }
+    auto topic_cfg = _parent.get_topic_config();
+    if (!topic_cfg.has_value()) {
+        return std::nullopt;
+    }
+    auto codec = topic_cfg->get().properties.compression;
+    if (
+      !codec.has_value() || *codec == model::compression::none
+      || *codec == model::compression::producer) {
+        return std::nullopt;
+    }
+    return codec;
+}
+
+ss::future<std::optional<iobuf>>
+ntp_archiver::maybe_compress_segment(upload_candidate& candidate) {
+    auto codec = upload_compression();
+    if (!codec.has_value()) {
+        co_return std::nullopt;
+    }
+    auto stream = storage::concat_segment_reader_view{
+      candidate.sources,
+      candidate.file_offset,
+      candidate.final_file_offset,
+      _conf->upload_io_priority}
+                    .take_stream();
+    auto res = co_await compress_segment(std::move(stream), *codec);
+    if (res.has_error()) {
+        // The segment is still uploaded, just without compression
+        vlog(
+          _rtclog.warn,
+          "Failed to compress segment {}, error: {}",
+          candidate.exposed_name,
+          res.error());
+        co_return std::nullopt;
+    }
+    vlog(
+      _rtclog.debug,
+      "Compressed segment {} using {}, size {} -> {}",
+      candidate.exposed_name,
+      *codec,
+      candidate.content_length,
+      res.value().size_bytes());
+    candidate.content_length = res.value().size_bytes();
+    co_return std::move(res.value());
+}
+
 ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
   const remote_segment_path& path,
   upload_candidate candidate,
   ss::input_stream<char> stream,
+  std::optional<iobuf> segment_body,
   std::optional<std::reference_wrapper<retry_chain_node>> source_rtc) {
     auto rtc = source_rtc.value_or(std::ref(_rtcnode));
     retry_chain_node fib(
@@ -1182,7 +1246,7 @@ ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
     };
 
     std::optional<ss::input_stream<char>> stream_state = std::move(stream);
-    auto reset_func = [this, candidate, &stream_state] {
+    auto reset_func = [this, candidate, &stream_state, &segment_body] {
         using provider_t = std::unique_ptr<storage::stream_provider>;
         // On first attempt to upload, the stream-ref passed in is used.
         if (stream_state.has_value()) {
@@ -1191,6 +1255,12 @@ ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
                 std::move(stream_state.value())));
             stream_state = std::nullopt;
             return f;
+        } else if (segment_body.has_value()) {
+            // The compressed segment is kept in memory until the upload
+            // completes
+            return ss::make_ready_future<provider_t>(
+              std::make_unique<stream_wrapper>(make_iobuf_input_stream(
+                segment_body->share(0, segment_body->size_bytes()))));
         } else {
             // On subsequent uploads, the segment is read again from disk
             return ss::make_ready_future<provider_t>(
@@ -1237,18 +1307,25 @@ ss::future<ntp_archiver_upload_result> ntp_archiver::upload_segment(
   model::term_id archiver_term,
   upload_candidate candidate,
   std::vector<ss::rwlock::holder> segment_read_locks,
+  std::optional<iobuf> segment_body,
   std::optional<std::reference_wrapper<retry_chain_node>> source_rtc) {
     vassert(
       candidate.remote_sources.empty(),
       "This method can only work with local segments");
 
-    auto [stream_upload, stream_index] = split_segment_stream(
-      candidate, _conf->upload_io_priority);
+    auto [stream_upload, stream_index]
+      = segment_body.has_value()
+          ? split_segment_body(*segment_body)
+          : split_segment_stream(candidate, _conf->upload_io_priority);
 
     auto path = segment_path_for_candidate(archiver_term, candidate);
 
     auto upload_fut = do_upload_segment(
-      path, candidate, std::move(stream_upload), source_rtc);
+      path,
+      candidate,
+      std::move(stream_upload),
+      std::move(segment_body),
+      source_rtc);
 
     auto index_path = make_index_path(path);
     auto make_idx_fut = make_segment_index(
@@ -1468,8 +1545,9 @@ ntp_archiver::do_schedule_single_upload(
     // uploaded.
     std::vector<ss::future<ntp_archiver_upload_result>> all_uploads;
 
-    all_uploads.emplace_back(
-      upload_segment(archiver_term, upload, std::move(locks)));
+    auto segment_body = co_await maybe_compress_segment(upload);
+    all_uploads.emplace_back(upload_segment(
+      archiver_term, upload, std::move(locks), std::move(segment_body)));
 
     ss::log_level level{};
     std::exception_ptr ep;
@@ -1659,7 +1737,7 @@ ntp_archiver::schedule_uploads(model::offset last_stable_offset) {
 ss::future<std::vector<ntp_archiver::scheduled_upload>>
 ntp_archiver::schedule_uploads(std::vector<upload_context> loop_contexts) {
     std::vector<scheduled_upload> scheduled_uploads;
-    auto uploads_remaining = _concurrency;
+    auto uploads_remaining = _concurrency();
     for (auto& ctx : loop_contexts) {
         if (uploads_remaining <= 0) {
             vlog(
@@ -1742,11 +1820,11 @@ ntp_archiver::schedule_uploads(std::vector<upload_context> loop_contexts) {
     co_return scheduled_uploads;
 }
 
-ss::future<ntp_archiver::upload_group_result> ntp_archiver::wait_uploads(
-  std::vector<scheduled_upload> scheduled,
-  segment_upload_kind segment_kind,
-  bool inline_manifest) {
-    ntp_archiver::upload_group_result total{};
+ss::future<ntp_archiver::completed_uploads> ntp_archiver::wait_uploads(
+  std::vector<scheduled_upload> scheduled, segment_upload_kind segment_kind) {
+    completed_uploads completed{};
+    auto& total = completed.result;
+    auto& mdiff = completed.mdiff;
     std::vector<ss::future<ntp_archiver_upload_result>> flist;
     std::vector<size_t> ixupload;
     for (size_t ix = 0; ix < scheduled.size(); ix++) {
@@ -1760,51 +1838,12 @@ ss::future<ntp_archiver::upload_group_result> ntp_archiver::wait_uploads(
           _rtclog.debug,
           "no uploads started for segment upload kind: {}, returning",
           segment_kind);
-        co_return total;
-    }
-
-    // Remember if we started with a clean STM: this will be used to decide
-    // whether to maybe do an extra flush of manifest after upload, to get back
-    // into a clean state.
-    auto stm_was_clean = _parent.archival_meta_stm()->get_dirty(
-                           _projected_manifest_clean_at)
-                         == cluster::archival_metadata_stm::state_dirty::clean;
-
-    // We may upload manifest in parallel with segments when using time-based
-    // (interval) manifest uploads.  If we aren't using an interval, then the
-    // manifest will always be immediately updated after segment uploads, so
-    // there is no point doing it in parallel as well.
-    bool upload_manifest_in_parallel
-      = inline_manifest && _manifest_upload_interval().has_value();
-
-    if (upload_manifest_in_parallel) {
-        // Munge the output of maybe_upload_manifest into an upload result,
-        // so that we can conveniently await it along with our segment
-        // uploads.  The actual result is reflected in
-        // _projected_manifest_clean_at if something was uploaded.
-        flist.push_back(
-          maybe_upload_manifest(concurrent_with_segs_ctx_label).then([](bool) {
-              return ntp_archiver_upload_result{
-                cloud_storage::upload_result::success};
-          }));
+        co_return completed;
     }
 
     auto segment_results = co_await ss::when_all_succeed(
       begin(flist), end(flist));
 
-    if (upload_manifest_in_parallel) {
-        // Drop the upload_result from manifest upload, we do not want to
-        // count it in the subsequent success/failure counts.
-        segment_results.pop_back();
-    }
-
-    if (!can_update_archival_metadata()) {
-        // We exit early even if we have successfully uploaded some segments to
-        // avoid interfering with an archiver that could have started on another
-        // node.
-        co_return upload_group_result{};
-    }
-
     absl::flat_hash_map<cloud_storage::upload_result, size_t> upload_results;
     for (auto result : segment_results) {
         ++upload_results[result.result()];
@@ -1816,7 +1855,6 @@ ss::future<ntp_archiver::upload_group_result> ntp_archiver::wait_uploads(
     total.num_failed = segment_results.size()
                        - (total.num_succeeded + total.num_cancelled);
 
-    std::vector<cloud_storage::segment_meta> mdiff;
     const bool checks_disabled
       = config::shard_local_cfg()
           .cloud_storage_disable_upload_consistency_checks.value();
@@ -1887,7 +1925,94 @@ ss::future<ntp_archiver::upload_group_result> ntp_archiver::wait_uploads(
         mdiff.push_back(*upload.meta);
     }
 
-    if (total.num_succeeded != 0) {
+    co_return completed;
+}
+
+ss::future<ntp_archiver::batch_result> ntp_archiver::wait_all_scheduled_uploads(
+  std::vector<ntp_archiver::scheduled_upload> scheduled) {
+    // Split the set of scheduled uploads into compacted and non compacted
+    // uploads, and then wait for them separately. They can also be waited on
+    // together, but in the wait function we stop on the first failed upload.
+    // If we wait on them together, a failed upload during compacted schedule
+    // will stop any subsequent non-compacted uploads from being processed, and
+    // as a result the upload offset will not be advanced for non-compacted
+    // uploads.
+    // Because the set of uploads advance two different offsets, this is
+    // not ideal. A failed compacted segment upload should only stop the
+    // compacted offset advance, so we split and wait on them separately.
+    std::vector<ntp_archiver::scheduled_upload> non_compacted_uploads;
+    std::vector<ntp_archiver::scheduled_upload> compacted_uploads;
+    non_compacted_uploads.reserve(scheduled.size());
+    compacted_uploads.reserve(scheduled.size());
+
+    std::partition_copy(
+      std::make_move_iterator(scheduled.begin()),
+      std::make_move_iterator(scheduled.end()),
+      std::back_inserter(non_compacted_uploads),
+      std::back_inserter(compacted_uploads),
+      [](const scheduled_upload& s) {
+          return s.upload_kind == segment_upload_kind::non_compacted;
+      });
+
+    bool has_uploads = std::any_of(
+                         non_compacted_uploads.begin(),
+                         non_compacted_uploads.end(),
+                         [](const auto& u) { return u.result.has_value(); })
+                       || std::any_of(
+                         compacted_uploads.begin(),
+                         compacted_uploads.end(),
+                         [](const auto& u) { return u.result.has_value(); });
+
+    // Remember if we started with a clean STM: this will be used to decide
+    // whether to maybe do an extra flush of manifest after upload, to get back
+    // into a clean state.
+    auto stm_was_clean = _parent.archival_meta_stm()->get_dirty(
+                           _projected_manifest_clean_at)
+                         == cluster::archival_metadata_stm::state_dirty::clean;
+
+    // We may upload manifest in parallel with segments when using time-based
+    // (interval) manifest uploads.  If we aren't using an interval, then the
+    // manifest will always be immediately updated after segment uploads, so
+    // there is no point doing it in parallel as well.  The actual result is
+    // reflected in _projected_manifest_clean_at if something was uploaded.
+    bool upload_manifest_in_parallel
+      = has_uploads && _manifest_upload_interval().has_value();
+
+    auto [non_compacted, compacted, _]
+      = co_await ss::when_all_succeed(
+        wait_uploads(
+          std::move(non_compacted_uploads), segment_upload_kind::non_compacted),
+        wait_uploads(
+          std::move(compacted_uploads), segment_upload_kind::compacted),
+        upload_manifest_in_parallel
+          ? maybe_upload_manifest(concurrent_with_segs_ctx_label)
+          : ss::make_ready_future<bool>(false));
+
+    if (!can_update_archival_metadata()) {
+        // We exit early even if we have successfully uploaded some segments to
+        // avoid interfering with an archiver that could have started on another
+        // node.
+        co_return batch_result{
+          .non_compacted_upload_result = {}, .compacted_upload_result = {}};
+    }
+
+    auto non_compacted_result = non_compacted.result;
+    auto compacted_result = compacted.result;
+
+    // Metadata of both upload kinds is added with a single command batch, so
+    // the round costs one replication round trip. The non-compacted segments
+    // go first, the compacted reuploads replace segments below them.
+    auto mdiff = std::move(non_compacted.mdiff);
+    std::move(
+      compacted.mdiff.begin(),
+      compacted.mdiff.end(),
+      std::back_inserter(mdiff));
+    const bool checks_disabled
+      = config::shard_local_cfg()
+          .cloud_storage_disable_upload_consistency_checks.value();
+    auto num_succeeded = non_compacted_result.num_succeeded
+                         + compacted_result.num_succeeded;
+    if (num_succeeded != 0) {
         vassert(
           _parent.archival_meta_stm(),
           "Archival metadata STM is not created for {} archiver",
@@ -1938,12 +2063,10 @@ ss::future<ntp_archiver::upload_group_result> ntp_archiver::wait_uploads(
         vlog(
           _rtclog.debug,
           "successfully uploaded {} segments (failed {} uploads)",
-          total.num_succeeded,
-          total.num_failed);
+          num_succeeded,
+          non_compacted_result.num_failed + compacted_result.num_failed);
 
-        if (
-          inline_manifest
-          && (stm_was_clean || !_manifest_upload_interval().has_value())) {
+        if (stm_was_clean || !_manifest_upload_interval().has_value()) {
             // This is the path for uploading manifests for infrequent*
             // segment uploads: we transitioned from clean to dirty, and the
             // manifest upload interval has expired.
@@ -1955,65 +2078,13 @@ ss::future<ntp_archiver::upload_group_result> ntp_archiver::wait_uploads(
         }
     }
 
-    co_return total;
-}
-
-ss::future<ntp_archiver::batch_result> ntp_archiver::wait_all_scheduled_uploads(
-  std::vector<ntp_archiver::scheduled_upload> scheduled) {
-    // Split the set of scheduled uploads into compacted and non compacted
-    // uploads, and then wait for them separately. They can also be waited on
-    // together, but in the wait function we stop on the first failed upload.
-    // If we wait on them together, a failed upload during compacted schedule
-    // will stop any subsequent non-compacted uploads from being processed, and
-    // as a result the upload offset will not be advanced for non-compacted
-    // uploads.
-    // Because the set of uploads advance two different offsets, this is
-    // not ideal. A failed compacted segment upload should only stop the
-    // compacted offset advance, so we split and wait on them separately.
-    std::vector<ntp_archiver::scheduled_upload> non_compacted_uploads;
-    std::vector<ntp_archiver::scheduled_upload> compacted_uploads;
-    non_compacted_uploads.reserve(scheduled.size());
-    compacted_uploads.reserve(scheduled.size());
-
-    std::partition_copy(
-      std::make_move_iterator(scheduled.begin()),
-      std::make_move_iterator(scheduled.end()),
-      std::back_inserter(non_compacted_uploads),
-      std::back_inserter(compacted_uploads),
-      [](const scheduled_upload& s) {
-          return s.upload_kind == segment_upload_kind::non_compacted;
-      });
-
-    // Inline manifest upload in regular non-compacted uploads
-    // if any were scheduled.
-    bool inline_manifest_in_non_compacted_uploads = false;
-    for (const auto& i : non_compacted_uploads) {
-        if (i.result) {
-            inline_manifest_in_non_compacted_uploads = true;
-            break;
-        }
-    }
-
-    auto [non_compacted_result, compacted_result]
-      = co_await ss::when_all_succeed(
-        wait_uploads(
-          std::move(non_compacted_uploads),
-          segment_upload_kind::non_compacted,
-          inline_manifest_in_non_compacted_uploads),
-        wait_uploads(
-          std::move(compacted_uploads),
-          segment_upload_kind::compacted,
-          !inline_manifest_in_non_compacted_uploads));
-
-    auto total_successful_uploads = non_compacted_result.num_succeeded
-                                    + compacted_result.num_succeeded;
-    if (total_successful_uploads > 0) {
+    if (num_succeeded > 0) {
         _last_segment_upload_time = ss::lowres_clock::now();
     }
     vlog(
       _rtclog.trace,
       "Segment uploads complete: {} successful uploads",
-      total_successful_uploads);
+      num_succeeded);
 
     co_return batch_result{
       .non_compacted_upload_result = non_compacted_result,
@@ -2793,11 +2864,16 @@ ntp_archiver::find_reupload_candidate(manifest_scanner_t scanner) {
     if (run->meta.base_offset >= _parent.raft_start_offset()) {
         auto log_generic = _parent.log();
         auto& log = *log_generic;
+        // Uploaded segments are smaller than their local counterparts if
+        // they were compressed, so only the offsets of the run can be used to
+        // find the local segments.
+        const bool compressed = upload_compression().has_value();
         segment_collector collector(
           run->meta.base_offset,
           manifest(),
           log,
-          run->meta.size_bytes,
+          compressed ? std::numeric_limits<size_t>::max()
+                     : run->meta.size_bytes,
           run->meta.committed_offset);
         collector.collect_segments(
           segment_collector_mode::collect_non_compacted);
@@ -2814,11 +2890,12 @@ ntp_archiver::find_reupload_candidate(manifest_scanner_t scanner) {
                 false,
                 "unexpected default re-upload candidate creation result");
           },
-          [this, &run, units = std::move(units)](
+          [this, &run, compressed, units = std::move(units)](
             upload_candidate_with_locks& upload_candidate) mutable -> ret_t {
               if (
-                upload_candidate.candidate.content_length
-                  != run->meta.size_bytes
+                (!compressed
+                 && upload_candidate.candidate.content_length
+                      != run->meta.size_bytes)
                 || upload_candidate.candidate.starting_offset
                      != run->meta.base_offset
                 || upload_candidate.candidate.final_offset
@@ -2920,8 +2997,13 @@ ss::future<bool> ntp_archiver::do_upload_local(
 
     // Upload segments and tx-manifest in parallel
     std::vector<ss::future<ntp_archiver_upload_result>> futures;
-    futures.emplace_back(
-      upload_segment(archiver_term, upload, std::move(locks), source_rtc));
+    auto segment_body = co_await maybe_compress_segment(upload);
+    futures.emplace_back(upload_segment(
+      archiver_term,
+      upload,
+      std::move(locks),
+      std::move(segment_body),
+      source_rtc));
 
     size_t tx_size = 0;
     std::exception_ptr tx_ep;
@@ -180,8 +180,9 @@ public:
 
     /// \brief Upload next set of segments to S3 (if any)
     /// The semaphore is used to track number of parallel uploads. The method
-    /// will pick not more than '_concurrency' candidates and start
-    /// uploading them.
+    /// will pick not more than
+    /// 'cloud_storage_max_concurrent_segment_uploads_per_partition' candidates
+    /// and start uploading them.
     ///
     /// \param lso_override last stable offset override
     /// \return future that returns number of uploaded/failed segments
@@ -438,14 +439,21 @@ private:
     ss::future<ntp_archiver::batch_result> wait_all_scheduled_uploads(
       std::vector<ntp_archiver::scheduled_upload> scheduled);
 
+    /// Uploads of one kind that completed and the metadata of the
+    /// successfully uploaded prefix that can be added to the manifest.
+    struct completed_uploads {
+        upload_group_result result;
+        std::vector<cloud_storage::segment_meta> mdiff;
+    };
+
     /// Waits for scheduled segment uploads. The uploaded segments could be
     /// compacted or non-compacted, the actions taken are similar in both
     /// cases with the major difference being the probe updates done after
-    /// the upload.
-    ss::future<ntp_archiver::upload_group_result> wait_uploads(
+    /// the upload. The metadata is not replicated, the caller adds segments
+    /// of all upload kinds to the STM in one batch.
+    ss::future<completed_uploads> wait_uploads(
       std::vector<scheduled_upload> scheduled,
-      segment_upload_kind segment_kind,
-      bool inline_manifest);
+      segment_upload_kind segment_kind);
 
     /// Upload individual segment to S3.
     ///
@@ -453,8 +461,9 @@ private:
     /// \param candidate is an upload candidate
     /// \param segment_read_locks protects the underlying segment(s) from being
     ///        deleted while the upload is in flight.
-    /// \param stream is a stream to the segment used for the initial upload. If
-    /// the upload is retried, the segment will be read again.
+    /// \param segment_body is the compressed content of the segment produced
+    ///        by 'maybe_compress_segment', if it's set to nullopt the segment
+    ///        is read from disk
     /// \param source_rtc
     /// is a retry_chain_node of the caller, if it's set
     ///        to nullopt own retry chain of the ntp_archiver is used
@@ -463,19 +472,35 @@ private:
       model::term_id archiver_term,
       upload_candidate candidate,
       std::vector<ss::rwlock::holder> segment_read_locks,
+      std::optional<iobuf> segment_body,
       std::optional<std::reference_wrapper<retry_chain_node>> source_rtc
       = std::nullopt);
 
     /// Isolates segment upload and accepts a stream reference, so that if the
     /// upload fails the exception can be handled in the caller and the stream
-    /// can be closed.
+    /// can be closed. If the upload is retried, the segment is read again
+    /// from disk or from the 'segment_body' if it's set.
     ss::future<cloud_storage::upload_result> do_upload_segment(
       const remote_segment_path& path,
       upload_candidate candidate,
       ss::input_stream<char> stream,
+      std::optional<iobuf> segment_body,
       std::optional<std::reference_wrapper<retry_chain_node>> source_rtc
       = std::nullopt);
 
+    /// Codec used to compress segments of the partition before the upload
+    /// or nullopt if the segments are uploaded as is.
+    std::optional<model::compression> upload_compression();
+
+    /// Compresses the content of the upload candidate if the compression of
+    /// uploads is enabled. The 'content_length' of the candidate is updated
+    /// to match the size of the compressed segment.
+    ///
+    /// \return compressed segment or nullopt if the segment should be
+    ///         uploaded as is
+    ss::future<std::optional<iobuf>>
+    maybe_compress_segment(upload_candidate& candidate);
+
     /// Get aborted transactions for upload
     ///
     /// \return list of aborted transactions
@@ -605,7 +630,7 @@ private:
     config::binding<std::chrono::milliseconds> _sync_manifest_timeout;
     config::binding<size_t> _max_segments_pending_deletion;
     simple_time_jitter<ss::lowres_clock> _backoff_jitter{100ms};
-    size_t _concurrency{4};
+    config::binding<size_t> _concurrency;
 
     // When we last wrote the partition manifest to object storage: this
     // is used to limit the frequency with which we do uploads.
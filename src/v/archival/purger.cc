@@ -202,9 +202,27 @@ purger::collect_manifest_paths(
       "Generated manifest path should end in .bin");
 
     base_path.remove_suffix(serde_extension.length());
+    // Only the keys are needed, consume them as they are listed instead of
+    // collecting the full listing first.
+    collected_manifests collected{};
     auto list_result = co_await _api.list_objects(
       bucket,
       collection_rtc,
+      [&collected](
+        ss::sstring key,
+        std::chrono::system_clock::time_point,
+        size_t,
+        ss::sstring) {
+          std::string_view path{key};
+          if (path.ends_with(".bin")) {
+              collected.current_serde = std::move(key);
+          } else if (path.ends_with(".json")) {
+              collected.current_json = std::move(key);
+          } else {
+              collected.spillover.push_back(std::move(key));
+          }
+          return ss::stop_iteration::no;
+      },
       cloud_storage_clients::object_key{std::filesystem::path{base_path}});
 
     if (list_result.has_error()) {
@@ -216,23 +234,6 @@ purger::collect_manifest_paths(
         co_return std::nullopt;
     }
 
-    collected_manifests collected{};
-    collected.spillover.reserve(list_result.value().contents.size());
-    for (auto& item : list_result.value().contents) {
-        std::string_view path{item.key};
-        if (path.ends_with(".bin")) {
-            collected.current_serde = std::move(item.key);
-            continue;
-        }
-
-        if (path.ends_with(".json")) {
-            collected.current_json = std::move(item.key);
-            continue;
-        }
-
-        collected.spillover.push_back(std::move(item.key));
-    }
-
     co_return collected;
 }
 
@@ -102,21 +102,23 @@ std::optional<retention_calculator> retention_calculator::factory(
         }
     }
 
+    // The segments below the start offset may linger until garbage
+    // collected, they are not subject to retention anymore.
+    auto first_seg = manifest.first_addressable_segment();
     if (ntp_config.retention_duration()) {
         model::timestamp oldest_allowed_timestamp{
           model::timestamp::now().value()
           - ntp_config.retention_duration()->count()};
 
         if (
-          manifest.size() > 0
-          && manifest.begin()->max_timestamp < oldest_allowed_timestamp) {
+          first_seg != manifest.end()
+          && first_seg->max_timestamp < oldest_allowed_timestamp) {
             strats.push_back(
               std::make_unique<time_based_strategy>(oldest_allowed_timestamp));
         }
     }
     auto start_kafka_override = manifest.get_start_kafka_offset_override();
     if (start_kafka_override > kafka::offset(0)) {
-        auto first_seg = manifest.first_addressable_segment();
         if (
           first_seg != manifest.end()
           && start_kafka_override > first_seg->last_kafka_offset()) {
@@ -143,7 +145,8 @@ retention_calculator::retention_calculator(
   , _strategies(std::move(strategies)) {}
 
 std::optional<model::offset> retention_calculator::next_start_offset() {
-    auto it = _manifest.first_addressable_segment();
+    const auto first = _manifest.first_addressable_segment();
+    auto it = first;
     for (; it != _manifest.end(); ++it) {
         const auto& entry = *it;
         const auto all_done = std::all_of(
@@ -161,6 +164,12 @@ std::optional<model::offset> retention_calculator::next_start_offset() {
         return model::next_offset(_manifest.get_last_offset());
     }
 
+    // The first segment satisfies all the policies: the start offset would
+    // not move, there's nothing to truncate.
+    if (it == first) {
+        return std::nullopt;
+    }
+
     return it->base_offset;
 }
 
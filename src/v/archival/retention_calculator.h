@@ -37,6 +37,8 @@ public:
     static std::optional<retention_calculator> factory(
       const cloud_storage::partition_manifest&, const storage::ntp_config&);
 
+    /// The start offset satisfying the retention policies, or std::nullopt
+    /// when the current start offset already does
     std::optional<model::offset> next_start_offset();
 
     std::optional<ss::sstring> strategy_name() const;
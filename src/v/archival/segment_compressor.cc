@@ -0,0 +1,102 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "archival/segment_compressor.h"
+
+#include "storage/parser.h"
+#include "storage/parser_utils.h"
+#include "storage/segment_appender_utils.h"
+#include "storage/segment_reader.h"
+#include "vassert.h"
+
+#include <seastar/core/coroutine.hh>
+
+namespace archival {
+
+namespace {
+
+class compressing_batch_consumer final : public storage::batch_consumer {
+public:
+    compressing_batch_consumer(model::compression codec, iobuf& out)
+      : _codec(codec)
+      , _out(out) {}
+
+    consume_result
+    accept_batch_start(const model::record_batch_header&) const override {
+        return consume_result::accept_batch;
+    }
+
+    void consume_batch_start(
+      model::record_batch_header hdr, size_t, size_t) override {
+        _header = hdr;
+    }
+
+    void skip_batch_start(model::record_batch_header, size_t, size_t) override {
+        vassert(false, "no batches should be skipped by this consumer");
+    }
+
+    void consume_records(iobuf&& records) override {
+        _records = std::move(records);
+    }
+
+    ss::future<stop_parser> consume_batch_end() override {
+        auto records = std::move(_records);
+        if (is_compressible_batch(_header)) {
+            auto compressed = co_await storage::internal::compress_batch(
+              _codec,
+              model::record_batch(
+                _header,
+                records.share(0, records.size_bytes()),
+                model::record_batch::tag_ctor_ng{}));
+            if (compressed.header().size_bytes < _header.size_bytes) {
+                _out.append(storage::disk_header_to_iobuf(compressed.header()));
+                _out.append(std::move(compressed).release_data());
+                co_return stop_parser::no;
+            }
+        }
+        _out.append(storage::disk_header_to_iobuf(_header));
+        _out.append(std::move(records));
+        co_return stop_parser::no;
+    }
+
+    void print(std::ostream& o) const override {
+        o << "compressing_batch_consumer";
+    }
+
+private:
+    model::compression _codec;
+    iobuf& _out;
+    model::record_batch_header _header;
+    iobuf _records;
+};
+
+} // namespace
+
+bool is_compressible_batch(const model::record_batch_header& hdr) {
+    return hdr.type == model::record_batch_type::raft_data
+           && hdr.attrs.compression() == model::compression::none
+           && !hdr.attrs.is_control() && hdr.record_count > 0;
+}
+
+ss::future<result<iobuf>>
+compress_segment(ss::input_stream<char> stream, model::compression codec) {
+    iobuf out;
+    storage::continuous_batch_parser parser(
+      std::make_unique<compressing_batch_consumer>(codec, out),
+      storage::segment_reader_handle(std::move(stream)));
+    auto res = co_await parser.consume().finally(
+      [&parser] { return parser.close(); });
+    if (res.has_error()) {
+        co_return res.error();
+    }
+    co_return out;
+}
+
+} // namespace archival
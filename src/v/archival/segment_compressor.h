@@ -0,0 +1,42 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "model/compression.h"
+#include "model/record.h"
+#include "outcome.h"
+
+#include <seastar/core/iostream.hh>
+
+namespace archival {
+
+/// Returns true if the batch can be compressed before it's uploaded.
+///
+/// Only uncompressed data batches are compressed. Control batches and all
+/// batches that redpanda interprets itself are uploaded as is.
+bool is_compressible_batch(const model::record_batch_header& hdr);
+
+/// Re-compresses the batches of a log segment before it's uploaded.
+///
+/// The stream is parsed batch by batch and every batch that passes
+/// 'is_compressible_batch' is compressed using 'codec'. A compressed batch is
+/// used only if it's smaller than the original. Offsets, timestamps and the
+/// number of records are preserved so the offset translation of the segment
+/// doesn't change, only the file positions of the batches do. The segment
+/// index has to be built from the result.
+///
+/// The result is materialized in memory because the size of the uploaded
+/// object has to be known before the upload starts.
+ss::future<result<iobuf>>
+compress_segment(ss::input_stream<char> stream, model::compression codec);
+
+} // namespace archival
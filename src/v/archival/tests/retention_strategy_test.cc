@@ -294,3 +294,25 @@ SEASTAR_THREAD_TEST_CASE(test_retention_after_truncation) {
     vlog(test_log.info, "Truncating to {}", second_truncated_offset);
     BOOST_REQUIRE(m.advance_start_offset(second_truncated_offset));
 }
+
+// Time based retention only considers the segments above the start offset:
+// the ones truncated but not garbage collected yet are not subject to it.
+SEASTAR_THREAD_TEST_CASE(test_time_retention_after_truncation) {
+    temporary_dir tmp_dir("retention_strategy_test");
+    auto data_path = tmp_dir.get_path();
+    cloud_storage::partition_manifest m;
+    populate_manifest(m, {{0, 9, 1024, delta_10_min}, {10, 19, 1024}});
+
+    ntp_config config{{"test_ns", "test_topic", 0}, {data_path}};
+    config.set_overrides(
+      {.retention_bytes = tristate<size_t>{},
+       .retention_time = tristate<std::chrono::milliseconds>{5min}});
+
+    auto retention_calculator = retention_calculator::factory(m, config);
+    BOOST_REQUIRE(retention_calculator.has_value());
+    BOOST_REQUIRE(
+      retention_calculator->next_start_offset() == model::offset{10});
+
+    BOOST_REQUIRE(m.advance_start_offset(model::offset{10}));
+    BOOST_REQUIRE(!retention_calculator::factory(m, config).has_value());
+}
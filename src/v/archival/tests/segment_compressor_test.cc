@@ -0,0 +1,139 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "archival/segment_compressor.h"
+#include "bytes/iobuf_parser.h"
+#include "bytes/iostream.h"
+#include "storage/parser.h"
+#include "storage/parser_utils.h"
+#include "storage/record_batch_builder.h"
+#include "storage/segment_appender_utils.h"
+#include "storage/segment_reader.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+using namespace archival;
+
+namespace {
+
+model::record_batch make_batch(
+  model::record_batch_type type, model::offset base, int num_records) {
+    storage::record_batch_builder builder(type, base);
+    for (int i = 0; i < num_records; i++) {
+        iobuf value;
+        value.append(ss::sstring(R"({"name": "value", "count": 10})"));
+        builder.add_raw_kv(std::nullopt, std::move(value));
+    }
+    return std::move(builder).build();
+}
+
+iobuf to_segment(const std::vector<model::record_batch>& batches) {
+    iobuf segment;
+    for (const auto& b : batches) {
+        segment.append(storage::disk_header_to_iobuf(b.header()));
+        segment.append(b.data().copy());
+    }
+    return segment;
+}
+
+/// Collects all batches of the segment
+class collecting_consumer final : public storage::batch_consumer {
+public:
+    explicit collecting_consumer(std::vector<model::record_batch>& out)
+      : _out(out) {}
+
+    consume_result
+    accept_batch_start(const model::record_batch_header&) const override {
+        return consume_result::accept_batch;
+    }
+    void consume_batch_start(
+      model::record_batch_header hdr, size_t, size_t) override {
+        _header = hdr;
+    }
+    void skip_batch_start(model::record_batch_header, size_t, size_t) override {
+    }
+    void consume_records(iobuf&& records) override {
+        _records = std::move(records);
+    }
+    ss::future<stop_parser> consume_batch_end() override {
+        _out.emplace_back(
+          _header, std::move(_records), model::record_batch::tag_ctor_ng{});
+        co_return stop_parser::no;
+    }
+    void print(std::ostream& o) const override { o << "collecting_consumer"; }
+
+private:
+    std::vector<model::record_batch>& _out;
+    model::record_batch_header _header;
+    iobuf _records;
+};
+
+std::vector<model::record_batch> parse_segment(iobuf segment) {
+    std::vector<model::record_batch> batches;
+    storage::continuous_batch_parser parser(
+      std::make_unique<collecting_consumer>(batches),
+      storage::segment_reader_handle(
+        make_iobuf_input_stream(std::move(segment))));
+    auto res = parser.consume().get();
+    parser.close().get();
+    BOOST_REQUIRE(res.has_value());
+    return batches;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_compress_segment) {
+    std::vector<model::record_batch> source;
+    source.push_back(
+      make_batch(model::record_batch_type::raft_data, model::offset(0), 100));
+    source.push_back(make_batch(
+      model::record_batch_type::raft_configuration, model::offset(100), 1));
+    source.push_back(
+      make_batch(model::record_batch_type::raft_data, model::offset(101), 1));
+    source.push_back(
+      make_batch(model::record_batch_type::raft_data, model::offset(102), 100));
+
+    auto segment = to_segment(source);
+    auto res = compress_segment(
+                 make_iobuf_input_stream(segment.copy()),
+                 model::compression::zstd)
+                 .get();
+    BOOST_REQUIRE(res.has_value());
+    BOOST_REQUIRE_LT(res.value().size_bytes(), segment.size_bytes());
+
+    auto compressed = parse_segment(std::move(res.value()));
+    BOOST_REQUIRE_EQUAL(compressed.size(), source.size());
+    for (size_t i = 0; i < source.size(); i++) {
+        const auto& expected = source[i].header();
+        const auto& actual = compressed[i].header();
+        BOOST_REQUIRE_EQUAL(actual.base_offset, expected.base_offset);
+        BOOST_REQUIRE_EQUAL(actual.last_offset(), expected.last_offset());
+        BOOST_REQUIRE_EQUAL(actual.record_count, expected.record_count);
+        BOOST_REQUIRE_EQUAL(actual.max_timestamp, expected.max_timestamp);
+        BOOST_REQUIRE(actual.type == expected.type);
+    }
+
+    // Large data batches are compressed, the configuration batch and the
+    // data batch that doesn't benefit from compression are kept as is
+    BOOST_REQUIRE(compressed[0].compressed());
+    BOOST_REQUIRE(!compressed[1].compressed());
+    BOOST_REQUIRE(!compressed[2].compressed());
+    BOOST_REQUIRE(compressed[3].compressed());
+    BOOST_REQUIRE(compressed[1].data() == source[1].data());
+
+    for (auto i : {0, 3}) {
+        auto decompressed = storage::internal::decompress_batch(
+                              std::move(compressed[i]))
+                              .get();
+        BOOST_REQUIRE(decompressed.data() == source[i].data());
+        BOOST_REQUIRE_EQUAL(
+          decompressed.header().crc, source[i].header().crc);
+    }
+}
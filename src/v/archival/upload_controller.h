@@ -34,6 +34,8 @@ public:
     ss::future<> start() { return _ctrl.start(); }
     ss::future<> stop() { return _ctrl.stop(); }
 
+    bool behind() const { return _ctrl.behind(); }
+
 private:
     storage::backlog_controller _ctrl;
 };
@@ -96,6 +96,7 @@ inline bytes iobuf_to_bytes(const iobuf& in) {
 
 inline iobuf bytes_to_iobuf(const bytes& in) {
     iobuf out;
+    out.reserve_memory(in.size(), details::io_allocation_policy::exact);
     // NOLINTNEXTLINE
     out.append(reinterpret_cast<const char*>(in.data()), in.size());
     return out;
@@ -20,6 +20,39 @@
 #include <cstdint>
 
 namespace details {
+
+/// How the size of a new fragment of an iobuf is chosen
+enum class io_allocation_policy : uint8_t {
+    // grow by 1.5 from the last fragment, for buffers of unknown size
+    geometric,
+    // fit the size being reserved, for writes of a known size
+    exact,
+    // always allocate max_chunk_size, for large buffers built by many writes
+    large,
+};
+
+/**
+ * Number of fragments allocated for iobufs on this shard by size class, up
+ * to 512 bytes, up to 1KiB and so on up to max_chunk_size.
+ */
+class io_allocation_stats {
+public:
+    static constexpr size_t classes = 9;
+
+    static void record(size_t size) {
+        size_t i = size <= 512 ? 0 : ss::log2ceil(size) - 9;
+        ++_counts[std::min(i, classes - 1)];
+    }
+
+    /// upper bound in bytes of the size class i
+    static constexpr size_t upper_bound(size_t i) { return size_t{512} << i; }
+
+    static const std::array<uint64_t, classes>& counts() { return _counts; }
+
+private:
+    static inline thread_local std::array<uint64_t, classes> _counts{};
+};
+
 class io_allocation_size {
 public:
     static constexpr size_t max_chunk_size = 128 * 1024;
@@ -54,6 +87,23 @@ public:
        131072});
     static size_t next_allocation_size(size_t data_size);
 
+    // Pick the size of a new fragment reserving data_size bytes with the given
+    // policy, after a fragment of last_size bytes.
+    static size_t next_allocation_size(
+      io_allocation_policy policy, size_t data_size, size_t last_size) {
+        switch (policy) {
+        case io_allocation_policy::geometric:
+            return next_allocation_size(std::max(data_size, last_size));
+        case io_allocation_policy::exact:
+            // above the small pool allocations are rounded to pages, an exact
+            // size wastes less than the geometric one
+            return std::min(std::max<size_t>(data_size, 1), max_chunk_size);
+        case io_allocation_policy::large:
+            return max_chunk_size;
+        }
+        __builtin_unreachable();
+    }
+
     // Pick next allocation size for when the total remaining data size is
     // known, e.g. in an iobuf copy operation.
     // - If the size falls into the range of seastar's small allocator, allow a
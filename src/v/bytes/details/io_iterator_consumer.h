@@ -162,6 +162,8 @@ public:
     size_t bytes_consumed() const { return _bytes_consumed; }
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     size_t segment_bytes_left() const { return _frag_index_end - _frag_index; }
+    /// the segment_bytes_left() bytes of the current fragment start here
+    const char* segment_data() const { return _frag_index; }
     bool is_finished() const { return _frag == _frag_end; }
 
     /// starts a new iterator byte-for-byte starting at *this* index
@@ -141,6 +141,7 @@ iobuf iobuf_copy(iobuf::iterator_consumer& in, size_t len) {
     while (bytes_left) {
         ss::temporary_buffer<char> buf(
           details::io_allocation_size::ss_next_allocation_size(bytes_left));
+        details::io_allocation_stats::record(buf.size());
 
         size_t offset = 0;
         in.consume(buf.size(), [&buf, &offset](const char* src, size_t size) {
@@ -139,6 +139,10 @@ public:
      *
      * Copying an iobuf is optimized for cases where the size of the resulting
      * iobuf will not be increased (e.g. via iobuf::append).
+     *
+     * Since the fragments of the copy are sized to fit its content, copying is
+     * also the way to compact an iobuf that is held for a long time: a share of
+     * a few bytes keeps the whole underlying buffer alive.
      */
     iobuf copy() const;
 
@@ -150,7 +154,10 @@ public:
 
     /// only ensures that a segment of at least reservation is available
     /// as an empty details::io_fragment
-    void reserve_memory(size_t reservation);
+    void reserve_memory(
+      size_t reservation,
+      details::io_allocation_policy policy
+      = details::io_allocation_policy::geometric);
 
     /*
      * Append len bytes starting at src into this iobuf. This always makes
@@ -223,6 +230,9 @@ public:
     void trim_back(size_t n);
     void clear();
     size_t size_bytes() const;
+    /// memory allocated to the fragments, which is at least size_bytes().
+    /// A shared fragment only counts its share of the underlying buffer.
+    size_t capacity_bytes() const;
     bool empty() const;
     /// compares that the _content_ is the same;
     /// ignores allocation strategy, and number of details::io_fragments
@@ -248,7 +258,9 @@ private:
     void prepend(std::unique_ptr<fragment>);
 
     size_t available_bytes() const;
-    void create_new_fragment(size_t);
+    void create_new_fragment(
+      size_t,
+      details::io_allocation_policy = details::io_allocation_policy::geometric);
     size_t last_allocation_size() const;
 
     container _frags;
@@ -278,6 +290,14 @@ inline bool iobuf::operator!=(std::string_view o) const {
 inline bool iobuf::empty() const { return _size == 0; }
 inline size_t iobuf::size_bytes() const { return _size; }
 
+inline size_t iobuf::capacity_bytes() const {
+    size_t ret = 0;
+    for (const auto& f : _frags) {
+        ret += f.capacity();
+    }
+    return ret;
+}
+
 inline size_t iobuf::available_bytes() const {
     oncore_debug_verify(_verify_shard);
     if (_frags.empty()) {
@@ -303,21 +323,25 @@ inline void iobuf::prepend(std::unique_ptr<fragment> f) {
     _frags.push_front(*f.release());
 }
 
-inline void iobuf::create_new_fragment(size_t sz) {
+inline void iobuf::create_new_fragment(
+  size_t sz, details::io_allocation_policy policy) {
     oncore_debug_verify(_verify_shard);
-    auto chunk_max = std::max(sz, last_allocation_size());
-    auto asz = details::io_allocation_size::next_allocation_size(chunk_max);
+    auto asz = details::io_allocation_size::next_allocation_size(
+      policy, sz, last_allocation_size());
+    details::io_allocation_stats::record(asz);
     append(std::make_unique<fragment>(asz));
 }
 /// only ensures that a segment of at least reservation is avaible
-/// as an empty details::io_fragment
-inline void iobuf::reserve_memory(size_t reservation) {
+/// as an empty details::io_fragment, up to max_chunk_size. The policy picks
+/// the size of the fragment allocated when there isn't enough space.
+inline void iobuf::reserve_memory(
+  size_t reservation, details::io_allocation_policy policy) {
     oncore_debug_verify(_verify_shard);
     if (auto b = available_bytes(); b < reservation) {
         if (b > 0) {
             _frags.back().trim();
         }
-        create_new_fragment(reservation); // make space if not enough
+        create_new_fragment(reservation, policy); // make space if not enough
     }
 }
 
@@ -46,12 +46,29 @@ public:
     size_t bytes_consumed() const { return _in.bytes_consumed(); }
 
     std::pair<int64_t, uint8_t> read_varlong() {
+        // varints are decoded in place when the fragment holds a whole word
+        if (_in.segment_bytes_left() >= sizeof(uint64_t)) {
+            auto [val, length_size] = vint::deserialize_word(
+              _in.segment_data());
+            if (likely(length_size > 0)) {
+                _in.skip(length_size);
+                return {val, length_size};
+            }
+        }
         auto [val, length_size] = vint::deserialize(_in);
         _in.skip(length_size);
         return {val, length_size};
     }
 
     std::pair<uint32_t, uint8_t> read_unsigned_varint() {
+        if (_in.segment_bytes_left() >= sizeof(uint64_t)) {
+            auto [val, length_size] = unsigned_vint::deserialize_word(
+              _in.segment_data());
+            if (likely(length_size > 0)) {
+                _in.skip(length_size);
+                return {val, length_size};
+            }
+        }
         auto [val, length_size] = unsigned_vint::deserialize(_in);
         _in.skip(length_size);
         return {val, length_size};
@@ -410,6 +410,46 @@ SEASTAR_THREAD_TEST_CASE(alloctor_forward_progress) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(allocation_policies) {
+    using details::io_allocation_policy;
+    constexpr auto max_chunk = details::io_allocation_size::max_chunk_size;
+    const auto data = random_generators::gen_alphanum_string(20000);
+
+    iobuf geometric;
+    geometric.reserve_memory(data.size());
+    geometric.append(data.data(), data.size());
+    BOOST_REQUIRE_EQUAL(std::distance(geometric.begin(), geometric.end()), 1);
+    BOOST_REQUIRE_EQUAL(geometric.begin()->capacity(), 29525);
+
+    iobuf exact;
+    exact.reserve_memory(data.size(), io_allocation_policy::exact);
+    exact.append(data.data(), data.size());
+    BOOST_REQUIRE_EQUAL(std::distance(exact.begin(), exact.end()), 1);
+    BOOST_REQUIRE_EQUAL(exact.begin()->capacity(), data.size());
+    BOOST_REQUIRE_EQUAL(exact, geometric);
+
+    iobuf large;
+    large.reserve_memory(100, io_allocation_policy::large);
+    BOOST_REQUIRE_EQUAL(large.begin()->capacity(), max_chunk);
+    exact.reserve_memory(10 * max_chunk, io_allocation_policy::exact);
+    BOOST_REQUIRE_EQUAL(std::prev(exact.end())->capacity(), max_chunk);
+}
+
+SEASTAR_THREAD_TEST_CASE(allocation_stats) {
+    using stats = details::io_allocation_stats;
+    const auto before = stats::counts();
+    iobuf buf;
+    buf.reserve_memory(100, details::io_allocation_policy::exact);
+    buf.reserve_memory(1000, details::io_allocation_policy::exact);
+    buf.reserve_memory(2000, details::io_allocation_policy::large);
+    const auto& after = stats::counts();
+    BOOST_REQUIRE_EQUAL(after[0], before[0] + 1);
+    BOOST_REQUIRE_EQUAL(after[1], before[1] + 1);
+    BOOST_REQUIRE_EQUAL(
+      after[stats::classes - 1], before[stats::classes - 1] + 1);
+    BOOST_REQUIRE_EQUAL(stats::upper_bound(stats::classes - 1), 128 * 1024);
+}
+
 SEASTAR_THREAD_TEST_CASE(test_next_chunk_allocation_append_temp_buf) {
     const auto b = random_generators::gen_alphanum_string(1024);
 
@@ -775,3 +815,17 @@ SEASTAR_THREAD_TEST_CASE(iobuf_hexdump) {
   00000000 | 41 65 6e 65 61 6e 20 73  65 64 20 6c 65 6f 20 70  | Aenean sed leo p
   00000010 | 6f 72 74 74 69 74 6f 72  2e                       | orttitor.)");
 }
+
+SEASTAR_THREAD_TEST_CASE(iobuf_capacity_bytes) {
+    iobuf buf;
+    BOOST_REQUIRE_EQUAL(buf.capacity_bytes(), 0);
+    for (int i = 0; i < 10; ++i) {
+        buf.append(random_generators::make_iobuf(100));
+        buf.reserve_memory(100);
+    }
+    BOOST_REQUIRE_GT(buf.capacity_bytes(), buf.size_bytes());
+
+    auto compacted = buf.copy();
+    BOOST_REQUIRE_EQUAL(compacted, buf);
+    BOOST_REQUIRE_EQUAL(compacted.capacity_bytes(), buf.size_bytes());
+}
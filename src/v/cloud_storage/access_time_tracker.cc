@@ -11,6 +11,7 @@
 #include "cloud_storage/access_time_tracker.h"
 
 #include "bytes/iostream.h"
+#include "hashing/crc32c.h"
 #include "serde/serde.h"
 #include "units.h"
 
@@ -20,6 +21,7 @@
 #include <absl/container/btree_map.h>
 #include <absl/container/btree_set.h>
 
+#include <algorithm>
 #include <exception>
 #include <variant>
 
@@ -57,12 +59,30 @@ struct table_header
     auto serde_fields() { return std::tie(table_size); }
 };
 
+// A journal batch starts with a fixed size header, followed by
+// record_count (hash, timestamp) pairs and zero padding up to batch_size.  A
+// removed key is recorded with a zero timestamp.
+struct journal_batch_header {
+    static constexpr uint32_t magic_value = 0x41544a31; // "ATJ1"
+    static constexpr size_t size = 16;
+
+    uint32_t magic{magic_value};
+    // crc32c of the records
+    uint32_t crc{0};
+    uint32_t record_count{0};
+    uint32_t batch_size{0};
+};
+
+static constexpr uint32_t removed_timestamp = 0;
+
 ss::future<> access_time_tracker::write(ss::output_stream<char>& out) {
     // This lock protects us from the _table being mutated while we
     // are iterating over it and yielding during the loop.
     auto lock_guard = co_await ss::get_units(_table_lock, 1);
 
     _dirty = false;
+    // The snapshot contains all updates applied so far
+    _journal.clear();
 
     const table_header h{.table_size = _table.size()};
     iobuf header_buf;
@@ -112,6 +132,7 @@ void access_time_tracker::on_released_table_lock() {
         } else {
             _table.erase(hash);
         }
+        _journal[hash] = ts;
     }
     _pending_upserts.clear();
 }
@@ -120,6 +141,8 @@ ss::future<> access_time_tracker::read(ss::input_stream<char>& in) {
     auto lock_guard = co_await ss::get_units(_table_lock, 1);
 
     _table.clear();
+    _journal.clear();
+    _frequency.clear();
     _dirty = false;
 
     // Accumulate a serialized table_header in this buffer
@@ -162,6 +185,106 @@ ss::future<> access_time_tracker::read(ss::input_stream<char>& in) {
     _pending_upserts.clear();
 }
 
+ss::future<iobuf> access_time_tracker::take_journal_batch(size_t alignment) {
+    // Updates made while the batch is encoded go to the next batch
+    auto journal = std::exchange(
+      _journal, make_map<std::optional<timestamp_t>>());
+    _dirty = false;
+
+    // How many items to serialize between yields
+    constexpr size_t chunk_count = 2048;
+
+    iobuf records;
+    size_t i = 0;
+    for (const auto& [hash, ts] : journal) {
+        serde::write(records, hash);
+        serde::write(records, ts.value_or(removed_timestamp));
+        if (++i % chunk_count == 0) {
+            co_await ss::maybe_yield();
+        }
+    }
+
+    crc::crc32c crc;
+    crc_extend_iobuf(crc, records);
+    const size_t size = journal_batch_header::size + records.size_bytes();
+    const size_t padded_size = (size + alignment - 1) / alignment * alignment;
+    const journal_batch_header h{
+      .crc = crc.value(),
+      .record_count = static_cast<uint32_t>(journal.size()),
+      .batch_size = static_cast<uint32_t>(padded_size),
+    };
+
+    iobuf batch;
+    serde::write(batch, h.magic);
+    serde::write(batch, h.crc);
+    serde::write(batch, h.record_count);
+    serde::write(batch, h.batch_size);
+    batch.append(std::move(records));
+    if (padded_size > size) {
+        ss::temporary_buffer<char> padding(padded_size - size);
+        std::fill_n(padding.get_write(), padding.size(), 0);
+        batch.append(std::move(padding));
+    }
+    co_return batch;
+}
+
+ss::future<> access_time_tracker::read_journal(ss::input_stream<char>& in) {
+    auto lock_guard = co_await ss::get_units(_table_lock, 1);
+
+    while (true) {
+        auto header_buf = co_await in.read_exactly(journal_batch_header::size);
+        if (header_buf.size() < journal_batch_header::size) {
+            break;
+        }
+        iobuf header_iobuf;
+        header_iobuf.append(std::move(header_buf));
+        auto header_parser = iobuf_parser(std::move(header_iobuf));
+        journal_batch_header h;
+        h.magic = serde::read_nested<uint32_t>(header_parser, 0);
+        h.crc = serde::read_nested<uint32_t>(header_parser, 0);
+        h.record_count = serde::read_nested<uint32_t>(header_parser, 0);
+        h.batch_size = serde::read_nested<uint32_t>(header_parser, 0);
+
+        const size_t records_size = h.record_count * table_item_size;
+        if (
+          h.magic != journal_batch_header::magic_value
+          || h.batch_size < journal_batch_header::size + records_size) {
+            break;
+        }
+        auto body = co_await in.read_exactly(
+          h.batch_size - journal_batch_header::size);
+        if (body.size() < h.batch_size - journal_batch_header::size) {
+            break;
+        }
+        iobuf records;
+        records.append(body.share(0, records_size));
+        crc::crc32c crc;
+        crc_extend_iobuf(crc, records);
+        if (crc.value() != h.crc) {
+            break;
+        }
+
+        auto parser = iobuf_parser(std::move(records));
+        for (size_t i = 0; i < h.record_count; ++i) {
+            uint32_t hash = serde::read_nested<uint32_t>(parser, 0);
+            timestamp_t t = serde::read_nested<timestamp_t>(parser, 0);
+            if (t == removed_timestamp) {
+                _table.erase(hash);
+            } else {
+                // The journal may be older than the snapshot if a crash
+                // happened before it was removed: never go back in time.
+                auto& current = _table[hash];
+                current = std::max(current, t);
+            }
+        }
+        co_await ss::maybe_yield();
+    }
+
+    lock_guard.return_all();
+    // Any writes while we were reading are dropped
+    _pending_upserts.clear();
+}
+
 void access_time_tracker::add_timestamp(
   std::string_view key, std::chrono::system_clock::time_point ts) {
     if (!should_track(key)) {
@@ -178,11 +301,17 @@ void access_time_tracker::add_timestamp(
     if (units.has_value()) {
         // Got lock, update main table
         _table[hash] = seconds;
+        _journal[hash] = seconds;
         _dirty = true;
     } else {
         // Locked during serialization, defer write
         _pending_upserts[hash] = seconds;
     }
+
+    // Frequencies are not part of the serialized table, they don't need
+    // the lock
+    auto& frequency = _frequency[hash];
+    frequency = std::min<uint8_t>(frequency + 1, max_frequency);
 }
 
 void access_time_tracker::remove_timestamp(std::string_view key) noexcept {
@@ -193,11 +322,13 @@ void access_time_tracker::remove_timestamp(std::string_view key) noexcept {
         if (units.has_value()) {
             // Unlocked, update main table
             _table.erase(hash);
+            _journal[hash] = std::nullopt;
             _dirty = true;
         } else {
             // Locked during serialization, defer write
             _pending_upserts[hash] = std::nullopt;
         }
+        _frequency.erase(hash);
     } catch (...) {
         vassert(
           false,
@@ -216,10 +347,20 @@ access_time_tracker::trim(const fragmented_vector<file_list_item>& existent) {
 
     auto lock_guard = co_await ss::get_units(_table_lock, 1);
 
-    table_t tmp;
+    auto tmp = make_map<timestamp_t>();
     for (auto it : _table) {
         if (existent_hashes.contains(it.first)) {
             tmp.insert(it);
+            // Age the frequencies, so that objects which are no longer
+            // read eventually lose their protection from eviction.
+            if (auto f = _frequency.find(it.first); f != _frequency.end()) {
+                if (--f->second == 0) {
+                    _frequency.erase(f);
+                }
+            }
+        } else {
+            _journal[it.first] = std::nullopt;
+            _frequency.erase(it.first);
         }
         co_await ss::maybe_yield();
     }
@@ -245,6 +386,12 @@ access_time_tracker::estimate_timestamp(std::string_view key) const {
     return ts;
 }
 
+uint8_t access_time_tracker::estimate_frequency(std::string_view key) const {
+    uint32_t hash = xxhash_32(key.data(), key.size());
+    auto it = _frequency.find(hash);
+    return it == _frequency.end() ? 0 : it->second;
+}
+
 bool access_time_tracker::is_dirty() const { return _dirty; }
 
 } // namespace cloud_storage
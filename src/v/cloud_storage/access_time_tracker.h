@@ -13,10 +13,12 @@
 #include "bytes/iobuf.h"
 #include "hashing/xx.h"
 #include "recursive_directory_walker.h"
+#include "resource_mgmt/memory_accounting.h"
 #include "seastar/core/iostream.hh"
 #include "seastarx.h"
 #include "serde/envelope.h"
 #include "utils/mutex.h"
+#include "utils/tracking_allocator.h"
 
 #include <seastar/core/future.hh>
 
@@ -39,7 +41,11 @@ namespace cloud_storage {
 /// 'cloud_storage/cache_service' is ready for that.
 class access_time_tracker {
     using timestamp_t = uint32_t;
-    using table_t = absl::btree_map<uint32_t, timestamp_t>;
+    // The maps are accounted as cloud_cache_index memory
+    template<typename V>
+    using map_t = util::mem_tracked::map_t<absl::btree_map, uint32_t, V>;
+    using table_t = map_t<timestamp_t>;
+    using updates_t = map_t<std::optional<timestamp_t>>;
 
     // Serialized size of each pair in table_t
     static constexpr size_t table_item_size = 8;
@@ -57,9 +63,31 @@ public:
     std::optional<std::chrono::system_clock::time_point>
     estimate_timestamp(std::string_view key) const;
 
+    /// Return how many times the key was accessed recently, saturated at
+    /// max_frequency.  Each trim() decrements the frequencies, they are
+    /// kept in memory only.
+    uint8_t estimate_frequency(std::string_view key) const;
+
+    static constexpr uint8_t max_frequency = 3;
+
+    /// Write a snapshot of the whole table.  Updates that are not in the
+    /// journal yet are part of the snapshot, so the journal is reset.
     ss::future<> write(ss::output_stream<char>&);
     ss::future<> read(ss::input_stream<char>&);
 
+    /// Encode the updates made since the last call (or since the last
+    /// snapshot) as a journal batch, padded to a multiple of \p alignment.
+    /// The batch is meant to be appended to the journal file.
+    ss::future<iobuf> take_journal_batch(size_t alignment);
+
+    /// Apply the journal batches in the stream on top of the table read
+    /// from the last snapshot.  Reading stops at the first batch that is
+    /// incomplete or corrupted, e.g. one that was torn by a crash.
+    ss::future<> read_journal(ss::input_stream<char>&);
+
+    /// Number of updates that are not in the journal yet
+    size_t journal_size() const { return _journal.size(); }
+
     /// Returns true if tracker has new data which wasn't serialized
     /// to disk.
     bool is_dirty() const;
@@ -79,7 +107,17 @@ private:
     /// Drain _pending_upserts for any writes made while table lock was held
     void on_released_table_lock();
 
-    absl::btree_map<uint32_t, timestamp_t> _table;
+    template<typename V>
+    map_t<V> make_map() const {
+        return util::mem_tracked::map<absl::btree_map, uint32_t, V>(
+          _mem_tracker);
+    }
+
+    ss::shared_ptr<util::mem_tracker> _mem_tracker
+      = resources::memory_accounting::local().create_tracker(
+        resources::memory_subsystem::cloud_cache_index, "access_time_tracker");
+
+    table_t _table{make_map<timestamp_t>()};
 
     // Lock taken during async loops over the table (ser/de and trim())
     // modifications may proceed without the lock if it is not taken.
@@ -89,7 +127,14 @@ private:
     // Calls into add_timestamp/remove_timestamp populate this
     // if the _serialization_lock is unavailable.  The serialization code is
     // responsible for draining it upon releasing the lock.
-    absl::btree_map<uint32_t, std::optional<timestamp_t>> _pending_upserts;
+    updates_t _pending_upserts{make_map<std::optional<timestamp_t>>()};
+
+    // Updates applied to _table since the last snapshot or journal batch,
+    // nullopt for a removed key.
+    updates_t _journal{make_map<std::optional<timestamp_t>>()};
+
+    // Access counts since the keys were added, aged on every trim
+    map_t<uint8_t> _frequency{make_map<uint8_t>()};
 
     bool _dirty{false};
 };
@@ -14,6 +14,10 @@
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote.h"
 
+#include <seastar/core/loop.hh>
+
+#include <boost/range/irange.hpp>
+
 namespace cloud_storage {
 
 anomalies_detector::anomalies_detector(
@@ -55,6 +59,13 @@ ss::future<anomalies_detector::result> anomalies_detector::run(
 
     std::deque<ss::sstring> spill_manifest_paths;
     const auto& spillovers = manifest.get_spillover_map();
+    // Spillover manifests above the scrub starting offset were scrubbed by
+    // previous runs. Only the oldest of them is downloaded (without checking
+    // its existence) because its first segment is needed to check the
+    // boundary with the next manifest. The rest are skipped, so the cost of
+    // a run doesn't depend on the number of manifests scrubbed already.
+    std::optional<ss::sstring> scrubbed_neighbour;
+    size_t num_scrubbed = 0;
     for (auto iter = spillovers.begin(); iter != spillovers.end(); ++iter) {
         spillover_manifest_path_components comp{
           .base = iter->base_offset,
@@ -67,6 +78,15 @@ ss::future<anomalies_detector::result> anomalies_detector::run(
 
         auto spill_path = generate_spillover_manifest_path(
           _ntp, _initial_rev, comp);
+        if (
+          scrub_from
+          && (comp.base > *scrub_from || comp.last == *scrub_from)) {
+            if (!scrubbed_neighbour) {
+                scrubbed_neighbour = spill_path();
+            }
+            ++num_scrubbed;
+            continue;
+        }
         auto exists_result = co_await _remote.segment_exists(
           _bucket, remote_segment_path{spill_path()}, rtc_node);
         ++_result.ops;
@@ -86,10 +106,23 @@ ss::future<anomalies_detector::result> anomalies_detector::run(
     // Binary manifest encoding and spillover manifests were both added
     // in the same release. Hence, it's an anomaly to have a JSON
     // encoded manifest and spillover manifests.
-    if (format == manifest_format::json && spill_manifest_paths.size() > 0) {
+    if (
+      format == manifest_format::json
+      && spill_manifest_paths.size() + num_scrubbed > 0) {
         _result.detected.missing_partition_manifest = true;
     }
 
+    std::optional<segment_meta> first_seg_previous_manifest;
+    if (scrubbed_neighbour) {
+        if (const auto spill = co_await download_spill_manifest(
+              *scrubbed_neighbour, rtc_node);
+            spill && !spill->empty()) {
+            first_seg_previous_manifest = *spill->begin();
+        }
+    } else if (!manifest.empty()) {
+        first_seg_previous_manifest = *manifest.begin();
+    }
+
     const auto stop_at_stm = co_await check_manifest(
       manifest, scrub_from, rtc_node);
     if (stop_at_stm == stop_detector::yes) {
@@ -97,11 +130,6 @@ ss::future<anomalies_detector::result> anomalies_detector::run(
         co_return _result;
     }
 
-    std::optional<segment_meta> first_seg_previous_manifest;
-    if (!manifest.empty()) {
-        first_seg_previous_manifest = *manifest.begin();
-    }
-
     for (size_t i = 0; i < spill_manifest_paths.size(); ++i) {
         if (should_stop()) {
             _result.status = scrub_status::partial;
@@ -205,37 +233,56 @@ anomalies_detector::check_manifest(
         }
     }
 
-    for (; seg_iter != manifest.end(); ++seg_iter) {
+    while (seg_iter != manifest.end()) {
         if (should_stop()) {
             _result.status = scrub_status::partial;
             co_return stop_detector::yes;
         }
 
-        const auto seg_meta = *seg_iter;
-
-        const auto segment_path = manifest.generate_segment_path(seg_meta);
-        const auto exists_result = co_await _remote.segment_exists(
-          _bucket, segment_path, rtc_node);
-        _result.ops += 1;
+        // The existence of a batch of segments is checked concurrently. The
+        // batch is never larger than the remaining quota, so the same
+        // segments are checked as if they were checked one by one.
+        std::vector<segment_meta> batch;
+        const auto batch_size = existence_check_batch_size();
+        for (; seg_iter != manifest.end() && batch.size() < batch_size;
+             ++seg_iter) {
+            batch.push_back(*seg_iter);
+        }
 
-        if (exists_result == download_result::notfound) {
-            _result.detected.missing_segments.emplace(seg_meta);
-        } else if (exists_result != download_result::success) {
-            vlog(
-              _logger.debug,
-              "Failed to check existence of segment at {}",
-              segment_path());
+        std::vector<download_result> exists_results(batch.size());
+        co_await ss::parallel_for_each(
+          boost::irange<size_t>(0, batch.size()),
+          [this, &manifest, &batch, &exists_results, &rtc_node](size_t i) {
+              return _remote
+                .segment_exists(
+                  _bucket, manifest.generate_segment_path(batch[i]), rtc_node)
+                .then([&exists_results, i](download_result r) {
+                    exists_results[i] = r;
+                });
+          });
+        _result.ops += static_cast<int32_t>(batch.size());
+
+        for (size_t i = 0; i < batch.size(); ++i) {
+            const auto& seg_meta = batch[i];
+            if (exists_results[i] == download_result::notfound) {
+                _result.detected.missing_segments.emplace(seg_meta);
+            } else if (exists_results[i] != download_result::success) {
+                vlog(
+                  _logger.debug,
+                  "Failed to check existence of segment at {}",
+                  manifest.generate_segment_path(seg_meta)());
 
-            _result.status = scrub_status::partial;
-        }
+                _result.status = scrub_status::partial;
+            }
 
-        scrub_segment_meta(
-          seg_meta,
-          previous_seg_meta,
-          _result.detected.segment_metadata_anomalies);
-        previous_seg_meta = seg_meta;
+            scrub_segment_meta(
+              seg_meta,
+              previous_seg_meta,
+              _result.detected.segment_metadata_anomalies);
+            previous_seg_meta = seg_meta;
 
-        _result.last_scrubbed_offset = seg_meta.committed_offset;
+            _result.last_scrubbed_offset = seg_meta.committed_offset;
+        }
     }
 
     vlog(
@@ -246,6 +293,17 @@ anomalies_detector::check_manifest(
     co_return stop_detector::no;
 }
 
+size_t anomalies_detector::existence_check_batch_size() const {
+    const auto ops = archival::run_quota_t{_result.ops};
+    if (ops > _received_quota) {
+        // Only reachable if nothing was scrubbed yet
+        return 1;
+    }
+    return std::min(
+      max_concurrent_existence_checks,
+      static_cast<size_t>((_received_quota - ops)()) + 1);
+}
+
 bool anomalies_detector::should_stop() const {
     if (_as.abort_requested()) {
         return true;
@@ -71,6 +71,12 @@ private:
 
     bool should_stop() const;
 
+    /// Number of segments which existence can be checked concurrently
+    /// without exceeding the quota of the run.
+    size_t existence_check_batch_size() const;
+
+    static constexpr size_t max_concurrent_existence_checks = 8;
+
     cloud_storage_clients::bucket_name _bucket;
     model::ntp _ntp;
     model::initial_revision_id _initial_rev;
@@ -44,6 +44,7 @@
 #include <functional>
 #include <iterator>
 #include <system_error>
+#include <tuple>
 #include <variant>
 
 namespace {
@@ -311,6 +312,34 @@ ss::future<ss::stop_iteration> async_manifest_view_cursor::next_iter() {
                                       : ss::stop_iteration::no;
 }
 
+void async_manifest_view_cursor::maybe_prefetch_next(model::offset o) {
+    if (!std::holds_alternative<ss::shared_ptr<materialized_manifest>>(
+          _current)) {
+        return;
+    }
+    const auto& m = std::get<ss::shared_ptr<materialized_manifest>>(_current)
+                      ->manifest;
+    auto so = m.get_start_offset().value_or(model::offset{});
+    auto lo = m.get_last_offset();
+    auto next = model::next_offset(lo);
+    if (next > _end || _prefetched == next || o < so) {
+        return;
+    }
+    auto tail = (lo() - so()) * prefetch_threshold_percent / 100;
+    if (o() < lo() - tail) {
+        return;
+    }
+    vlog(
+      _view._ctxlog.debug,
+      "Offset {} is in the tail of the manifest [{}-{}], prefetching the "
+      "next manifest",
+      o,
+      so,
+      lo);
+    _prefetched = next;
+    _view.prefetch_manifest(next);
+}
+
 ssx::task_local_ptr<const partition_manifest>
 async_manifest_view_cursor::manifest() const {
     using ret_t = ssx::task_local_ptr<const partition_manifest>;
@@ -1312,8 +1341,10 @@ async_manifest_view::get_materialized_manifest(
         auto res = _manifest_cache.get(
           std::make_tuple(get_ntp(), meta->base_offset), _ctxlog);
         if (res) {
+            _ts_probe.on_spillover_manifest_cache_hit();
             co_return res;
         }
+        _ts_probe.on_spillover_manifest_cache_miss();
         // Send materialization request to background loop
         materialization_request_t request{
           .search_vec = *meta,
@@ -1341,6 +1372,43 @@ async_manifest_view::get_materialized_manifest(
     }
 }
 
+void async_manifest_view::prefetch_manifest(model::offset o) {
+    if (_gate.is_closed() || in_stm(o)) {
+        return;
+    }
+    auto meta = search_spillover_manifests(o);
+    if (
+      !meta.has_value()
+      || _manifest_cache.contains(
+        std::make_tuple(get_ntp(), meta->base_offset))) {
+        return;
+    }
+    if (
+      _manifest_cache.size_bytes() + meta->metadata_size_hint
+      > _manifest_cache.get_capacity()) {
+        vlog(
+          _ctxlog.debug,
+          "Not enough free space in the cache to prefetch manifest {}",
+          meta);
+        return;
+    }
+    auto queued = std::any_of(
+      _requests.begin(), _requests.end(), [&](const auto& req) {
+          return req.search_vec.base_offset == meta->base_offset;
+      });
+    if (queued) {
+        return;
+    }
+    vlog(_ctxlog.debug, "Prefetching spillover manifest {}", meta);
+    materialization_request_t request{.search_vec = *meta};
+    // Nobody waits for the prefetch, the result is picked up from the cache
+    // by the reader that needs the manifest.
+    std::ignore = request.promise.get_future();
+    _requests.emplace_back(std::move(request));
+    _cvar.signal();
+    _ts_probe.on_spillover_manifest_prefetch();
+}
+
 ss::future<result<spillover_manifest, error_outcome>>
 async_manifest_view::hydrate_manifest(
   remote_manifest_path path) const noexcept {
@@ -150,6 +150,13 @@ private:
     ss::future<result<manifest_section_t, error_outcome>>
     get_materialized_manifest(async_view_search_query_t q) noexcept;
 
+    /// Schedule materialization of the spillover manifest that contains
+    /// the offset without waiting for it
+    ///
+    /// The manifest is only prefetched into the free space of the cache,
+    /// the prefetch never evicts manifests which are in use.
+    void prefetch_manifest(model::offset o);
+
     /// Load manifest from the cloud
     ///
     /// On success put serialized copy into the cache. The method should only be
@@ -321,6 +328,14 @@ public:
     /// and the user could see a gap in segments.
     bool manifest_needs_sync() const;
 
+    /// Start materializing the next spillover manifest in the background
+    /// if the offset is in the last 'prefetch_threshold_percent' of the
+    /// current spillover manifest. Long scans don't have to wait for the
+    /// download when they cross the manifest boundary.
+    void maybe_prefetch_next(model::offset o);
+
+    static constexpr int64_t prefetch_threshold_percent = 20;
+
 private:
     using stm_manifest_t = std::reference_wrapper<const partition_manifest>;
     void on_timeout();
@@ -337,6 +352,8 @@ private:
     const model::offset _begin;
     const model::offset _end;
     std::optional<model::offset> _stm_start_offset{std::nullopt};
+    /// Base offset of the last prefetched manifest
+    std::optional<model::offset> _prefetched{std::nullopt};
 };
 
 /// Invoke functor with every segment_meta accessible by the cursor
@@ -47,6 +47,52 @@ static constexpr auto access_timer_period = 60s;
 static constexpr const char* access_time_tracker_file_name = "accesstime";
 static constexpr const char* access_time_tracker_file_name_tmp
   = "accesstime.tmp";
+static constexpr const char* access_time_journal_file_name
+  = "accesstime.journal";
+// The journal is not compacted into a snapshot before reaching this size
+static constexpr uint64_t access_time_journal_min_compaction_size = 1_MiB;
+
+/// Order in which trims evict cache objects.
+///
+/// Like the small queue of the s3-fifo cache in io/cache.h, objects that were
+/// read at most once are evicted before the objects that were read again.
+/// Objects accessed since the last trim interval are evicted last whatever
+/// their frequency: they most likely serve the read that downloaded them.
+/// Index and tx objects are small and needed to read anything from their
+/// segment, so they go after the data objects of the same class.  Otherwise
+/// the least recently accessed objects go first and, among objects accessed
+/// at the same time, the largest one, which frees the most space for a single
+/// download to repeat.
+struct eviction_order {
+    std::chrono::system_clock::time_point recent;
+
+    int rank(const file_list_item& i) const {
+        if (i.access_time >= recent) {
+            return 2;
+        }
+        return i.frequency > 1 ? 1 : 0;
+    }
+
+    static bool is_metadata(const file_list_item& i) {
+        return std::string_view(i.path).ends_with(".tx")
+               || std::string_view(i.path).ends_with(".index");
+    }
+
+    bool operator()(const file_list_item& a, const file_list_item& b) const {
+        auto key = [this](const file_list_item& i) {
+            return std::make_tuple(
+              rank(i), is_metadata(i), i.access_time, ~i.size);
+        };
+        return key(a) < key(b);
+    }
+};
+
+static eviction_order make_eviction_order() {
+    const auto interval
+      = config::shard_local_cfg().cloud_storage_cache_check_interval_ms();
+    return eviction_order{
+      .recent = std::chrono::system_clock::now() - interval};
+}
 
 std::ostream& operator<<(std::ostream& o, cache_element_status s) {
     switch (s) {
@@ -80,13 +126,24 @@ cache::cache(
   , _max_bytes(_max_bytes_cfg())
   , _max_objects(std::move(max_objects))
   , _cnt(0)
-  , _total_cleaned(0) {
+  , _total_cleaned(0)
+  , _quota_size(
+      config::shard_local_cfg().cloud_storage_cache_shard_quota_bytes.bind()) {
     if (ss::this_shard_id() == ss::shard_id{0}) {
         update_max_bytes(); // initialize _max_bytes
         _disk_reservation.watch([this]() { update_max_bytes(); });
         _max_bytes_cfg.watch([this]() { update_max_bytes(); });
         _max_percent.watch([this]() { update_max_bytes(); });
     }
+    _quota_size.watch([this]() {
+        ssx::spawn_with_gate(_gate, [this] { return release_quota(); });
+    });
+    _quota_timer.set_callback([this] {
+        if (!_quota_used) {
+            ssx::spawn_with_gate(_gate, [this] { return release_quota(); });
+        }
+        _quota_used = false;
+    });
 }
 
 void cache::update_max_bytes() {
@@ -379,11 +436,11 @@ ss::future<> cache::trim(
         co_return;
     }
 
-    // Sort by atime for the subsequent LRU trimming loop
+    // Sort in eviction order for the subsequent trimming loop
     std::sort(
       candidates_for_deletion.begin(),
       candidates_for_deletion.end(),
-      [](auto& a, auto& b) { return a.access_time < b.access_time; });
+      make_eviction_order());
 
     // Calculate how much to delete
     auto size_to_delete
@@ -414,8 +471,12 @@ ss::future<> cache::trim(
     // Subsequent calculations require knowledge of how much data cannot
     // possibly be deleted (because all trims skip it) in order to decide
     // whether the trim worked properly.
-    static constexpr size_t undeletable_objects = 1;
+    size_t undeletable_objects = 1;
     auto undeletable_bytes = (co_await access_time_tracker_size()).value_or(0);
+    if (auto journal_size = co_await access_time_journal_size(); journal_size) {
+        ++undeletable_objects;
+        undeletable_bytes += *journal_size;
+    }
 
     // We aim to keep current_cache_size continuously up to date, but
     // in case of housekeeping issues, correct it if it apepars to have
@@ -657,7 +718,8 @@ ss::future<cache::trim_result> cache::trim_fast(
 bool cache::is_trim_exempt(const ss::sstring& path) const {
     if (
       path == (_cache_dir / access_time_tracker_file_name).string()
-      || path == (_cache_dir / access_time_tracker_file_name_tmp).string()) {
+      || path == (_cache_dir / access_time_tracker_file_name_tmp).string()
+      || path == (_cache_dir / access_time_journal_file_name).string()) {
         return true;
     }
 
@@ -685,10 +747,7 @@ cache::trim_exhaustive(uint64_t size_to_delete, size_t objects_to_delete) {
       size_to_delete,
       objects_to_delete);
 
-    // Sort by atime
-    std::sort(candidates.begin(), candidates.end(), [](auto& a, auto& b) {
-        return a.access_time < b.access_time;
-    });
+    std::sort(candidates.begin(), candidates.end(), make_eviction_order());
 
     size_t candidate_i = 0;
     while (
@@ -753,8 +812,8 @@ cache::trim_exhaustive(uint64_t size_to_delete, size_t objects_to_delete) {
     co_return result;
 }
 
-ss::future<std::optional<uint64_t>> cache::access_time_tracker_size() const {
-    auto path = _cache_dir / access_time_tracker_file_name;
+static ss::future<std::optional<uint64_t>>
+file_size_if_exists(std::filesystem::path path) {
     try {
         co_return static_cast<uint64_t>(co_await ss::file_size(path.string()));
     } catch (std::filesystem::filesystem_error& e) {
@@ -766,6 +825,14 @@ ss::future<std::optional<uint64_t>> cache::access_time_tracker_size() const {
     }
 }
 
+ss::future<std::optional<uint64_t>> cache::access_time_tracker_size() const {
+    return file_size_if_exists(_cache_dir / access_time_tracker_file_name);
+}
+
+ss::future<std::optional<uint64_t>> cache::access_time_journal_size() const {
+    return file_size_if_exists(_cache_dir / access_time_journal_file_name);
+}
+
 ss::future<> cache::load_access_time_tracker() {
     ss::gate::holder guard{_gate};
     vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
@@ -808,6 +875,36 @@ ss::future<> cache::load_access_time_tracker() {
         vlog(
           cst_log.info, "Access time tracker is not available at '{}'", source);
     }
+
+    auto journal = _cache_dir / access_time_journal_file_name;
+    auto journal_size = co_await access_time_journal_size();
+    if (!journal_size.has_value()) {
+        co_return;
+    }
+    vlog(
+      cst_log.info,
+      "Replaying {} bytes of access time journal from '{}'",
+      *journal_size,
+      journal);
+    try {
+        co_await ss::util::with_file_input_stream(
+          journal,
+          [this](ss::input_stream<char>& in) {
+              return _access_time_tracker.read_journal(in);
+          },
+          open_opts,
+          input_opts);
+    } catch (...) {
+        vlog(
+          cst_log.warn,
+          "Failed to replay access time journal '{}'. Error: {}",
+          journal,
+          std::current_exception());
+    }
+    // The tail of the journal may have been torn by a crash: start from a
+    // fresh snapshot rather than appending after it.
+    _access_time_journal_size = *journal_size;
+    _access_time_snapshot_needed = true;
 }
 
 /**
@@ -837,12 +934,69 @@ ss::future<> cache::save_access_time_tracker() {
 
     auto final_path = _cache_dir / access_time_tracker_file_name;
     co_await ss::rename_file(tmp_path.string(), final_path.string());
+
+    // The snapshot contains everything in the journal.  If we crash before
+    // the journal is removed, replaying it on top of the snapshot is safe.
+    if (_access_time_journal_size > 0 || _access_time_snapshot_needed) {
+        auto journal_path = _cache_dir / access_time_journal_file_name;
+        if (co_await ss::file_exists(journal_path.string())) {
+            co_await ss::remove_file(journal_path.string());
+        }
+    }
+    _access_time_journal_size = 0;
+    _access_time_snapshot_needed = false;
+}
+
+ss::future<> cache::append_access_time_journal() {
+    ss::gate::holder guard{_gate};
+    vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
+    auto path = _cache_dir / access_time_journal_file_name;
+
+    auto f = co_await ss::open_file_dma(
+      path.string(), ss::open_flags::create | ss::open_flags::wo);
+    std::exception_ptr ex;
+    try {
+        const auto alignment = f.disk_write_dma_alignment();
+        auto batch = co_await _access_time_tracker.take_journal_batch(
+          alignment);
+        auto buf = ss::temporary_buffer<char>::aligned(
+          alignment, batch.size_bytes());
+        iobuf::iterator_consumer(batch.cbegin(), batch.cend())
+          .consume_to(batch.size_bytes(), buf.get_write());
+        // A failed write may leave a partial batch behind that later batches
+        // can't be appended to
+        _access_time_snapshot_needed = true;
+        co_await f.dma_write(_access_time_journal_size, buf.get(), buf.size());
+        co_await f.flush();
+        _access_time_journal_size += buf.size();
+        _access_time_snapshot_needed = false;
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await f.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
 }
 
 ss::future<> cache::maybe_save_access_time_tracker() {
     vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
-    if (_access_time_tracker.is_dirty() && !_gate.is_closed()) {
+    if (
+      !(_access_time_tracker.is_dirty() || _access_time_snapshot_needed)
+      || _gate.is_closed()) {
+        co_return;
+    }
+    auto units = co_await _access_time_save_lock.get_units();
+    // Each entry of the snapshot is a (hash, timestamp) pair
+    const auto snapshot_size = _access_time_tracker.size()
+                               * 2 * sizeof(uint32_t);
+    if (
+      _access_time_snapshot_needed
+      || _access_time_journal_size > std::max(
+           snapshot_size, access_time_journal_min_compaction_size)) {
         co_await save_access_time_tracker();
+    } else {
+        co_await append_access_time_journal();
     }
 }
 
@@ -871,27 +1025,30 @@ ss::future<> cache::start() {
         });
         _tracker_timer.arm_periodic(access_timer_period);
     }
+    _quota_timer.arm_periodic(quota_idle_period);
 }
 
 ss::future<> cache::stop() {
     vlog(cst_log.debug, "Stopping archival cache service");
     _tracker_timer.cancel();
+    _quota_timer.cancel();
     _as.request_abort();
     _block_puts_cond.broken();
     _cleanup_sm.broken();
     if (ss::this_shard_id() == 0) {
-        co_await save_access_time_tracker().handle_exception([](auto eptr) {
-            // NOTE: see issue/11270 if the exception is "filesystem error:
-            // rename failed", some other process is deleting files in the
-            // middle of save_access_time_tracker. if in the future this error
-            // is logged, use the backtrace or a vassert to inspect who might be
-            // deleting accesstime.tmp
-            vlog(
-              cst_log.error,
-              "failed to save access time tracker during {}: {}",
-              __PRETTY_FUNCTION__,
-              eptr);
-        });
+        co_await maybe_save_access_time_tracker().handle_exception(
+          [](auto eptr) {
+              // NOTE: see issue/11270 if the exception is "filesystem error:
+              // rename failed", some other process is deleting files in the
+              // middle of save_access_time_tracker. if in the future this
+              // error is logged, use the backtrace or a vassert to inspect who
+              // might be deleting accesstime.tmp
+              vlog(
+                cst_log.error,
+                "failed to save access time tracker during {}: {}",
+                __PRETTY_FUNCTION__,
+                eptr);
+          });
     }
     co_await _walker.stop();
     co_await _gate.close();
@@ -1117,6 +1274,18 @@ cache::reserve_space(uint64_t bytes, size_t objects) {
         co_await _block_puts_cond.wait();
     }
 
+    if (try_reserve_from_quota(bytes, objects)) {
+        vlog(
+          cst_log.trace,
+          "reserve_space: reserved {}/{} bytes/objects from shard quota "
+          "(left {}/{})",
+          bytes,
+          objects,
+          _quota_bytes,
+          _quota_objects);
+        co_return space_reservation_guard(*this, bytes, objects);
+    }
+
     co_await container().invoke_on(0, [bytes, objects](cache& c) {
         return c.do_reserve_space(bytes, objects);
     });
@@ -1130,6 +1299,108 @@ cache::reserve_space(uint64_t bytes, size_t objects) {
     co_return space_reservation_guard(*this, bytes, objects);
 }
 
+bool cache::try_reserve_from_quota(uint64_t bytes, size_t objects) {
+    if (_quota_size() == 0) {
+        return false;
+    }
+    bool reserved = false;
+    if (_quota_bytes >= bytes && _quota_objects >= objects) {
+        _quota_bytes -= bytes;
+        _quota_objects -= objects;
+        _quota_used = true;
+        reserved = true;
+    }
+    maybe_refill_quota();
+    return reserved;
+}
+
+void cache::maybe_refill_quota() {
+    if (
+      _quota_refilling || _gate.is_closed() || _block_puts
+      || _quota_bytes >= _quota_size() / 2) {
+        return;
+    }
+    _quota_refilling = true;
+    ssx::spawn_with_gate(_gate, [this] {
+        return refill_quota()
+          .handle_exception([](const std::exception_ptr& e) {
+              vlog(cst_log.debug, "Failed to lease cache space: {}", e);
+          })
+          .finally([this] { _quota_refilling = false; });
+    });
+}
+
+ss::future<> cache::refill_quota() {
+    const auto want_bytes = _quota_size()
+                            - std::min(_quota_size(), _quota_bytes);
+    const auto want_objects = quota_objects
+                              - std::min(quota_objects, _quota_objects);
+    auto [bytes, objects] = co_await container().invoke_on(
+      0, [want_bytes, want_objects](cache& c) {
+          return c.do_lease_space(want_bytes, want_objects);
+      });
+    _quota_bytes += bytes;
+    _quota_objects += objects;
+    vlog(
+      cst_log.trace,
+      "Leased {}/{} bytes/objects of cache space (quota {}/{})",
+      bytes,
+      objects,
+      _quota_bytes,
+      _quota_objects);
+}
+
+ss::future<> cache::release_quota() {
+    if (_quota_bytes == 0 && _quota_objects == 0) {
+        co_return;
+    }
+    const auto bytes = std::exchange(_quota_bytes, 0);
+    const auto objects = std::exchange(_quota_objects, 0);
+    vlog(
+      cst_log.trace,
+      "Releasing {}/{} bytes/objects of leased cache space",
+      bytes,
+      objects);
+    try {
+        co_await container().invoke_on(0, [bytes, objects](cache& c) {
+            c.do_reserve_space_release(bytes, objects, 0, 0);
+        });
+    } catch (...) {
+        vlog(
+          cst_log.debug,
+          "Failed to release leased cache space: {}",
+          std::current_exception());
+    }
+}
+
+std::pair<uint64_t, size_t>
+cache::do_lease_space(uint64_t bytes, size_t objects) {
+    vassert(ss::this_shard_id() == ss::shard_id{0}, "Only call on shard 0");
+    // Leases never trim the cache and never compete with reservations that
+    // are waiting for a trim.
+    if (_block_puts || _reservations_pending > 0) {
+        return {0, 0};
+    }
+    const auto used_bytes = _current_cache_size + _reserved_cache_size;
+    const auto used_objects = _current_cache_objects + _reserved_cache_objects;
+    bytes = std::min(bytes, _max_bytes - std::min(_max_bytes, used_bytes));
+    objects = std::min(
+      objects,
+      size_t(_max_objects()) - std::min(size_t(_max_objects()), used_objects));
+    if (bytes == 0 || objects == 0) {
+        return {0, 0};
+    }
+    _reserved_cache_size += bytes;
+    _reserved_cache_objects += objects;
+    return {bytes, objects};
+}
+
+ss::future<> cache::recall_quotas() {
+    vassert(ss::this_shard_id() == ss::shard_id{0}, "Only call on shard 0");
+    co_await container().invoke_on_all(
+      [](cache& c) { return c.release_quota(); });
+}
+
 void cache::reserve_space_release(
   uint64_t bytes,
   size_t objects,
@@ -1252,6 +1523,12 @@ ss::future<> cache::do_reserve_space(uint64_t bytes, size_t objects) {
       _reservations_pending_objects);
 
     try {
+        if (_quota_size() > 0) {
+            // The space leased by the shards may be enough to accommodate the
+            // reservation.  No new leases are granted while the reservation
+            // is pending.
+            co_await recall_quotas();
+        }
         auto units = co_await ss::get_units(_cleanup_sm, 1);
         while (!may_reserve_space(bytes, objects)) {
             bool may_exceed = may_exceed_limits(bytes, objects)
@@ -1357,6 +1634,9 @@ void cache::set_block_puts(bool block_puts) {
     if (_block_puts && !block_puts) {
         _block_puts_cond.signal();
     }
+    if (!_block_puts && block_puts) {
+        ssx::spawn_with_gate(_gate, [this] { return release_quota(); });
+    }
     _block_puts = block_puts;
 }
 
@@ -19,6 +19,7 @@
 #include "seastarx.h"
 #include "ssx/semaphore.h"
 #include "units.h"
+#include "utils/mutex.h"
 
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
@@ -193,11 +194,17 @@ private:
     /// Load access time tracker from file
     ss::future<> load_access_time_tracker();
 
-    /// Save access time tracker to file
+    /// Save a snapshot of the access time tracker to file, and remove the
+    /// journal that it supersedes
     ss::future<> save_access_time_tracker();
     ss::future<> _save_access_time_tracker(ss::file);
 
-    /// Save access time tracker state to the file if needed
+    /// Append the access time updates since the last save to the journal
+    ss::future<> append_access_time_journal();
+
+    /// Save access time tracker state to the file if needed: the updates
+    /// are appended to the journal, until the journal grows larger than a
+    /// snapshot of the tracker.
     ss::future<> maybe_save_access_time_tracker();
 
     /// Triggers directory walker, creates a list of files to delete and deletes
@@ -237,6 +244,7 @@ private:
     bool is_trim_exempt(const ss::sstring&) const;
 
     ss::future<std::optional<uint64_t>> access_time_tracker_size() const;
+    ss::future<std::optional<uint64_t>> access_time_journal_size() const;
 
     /// Triggers directory walker, creates a list of files to delete and deletes
     /// only tmp files that are left from previous Red Panda run
@@ -268,6 +276,27 @@ private:
     /// (only runs on shard 0)
     void do_reserve_space_release(uint64_t, size_t, uint64_t, size_t);
 
+    /// Take a reservation out of the space leased by this shard if it has
+    /// enough left.  Starts a refill of the lease when it runs low.
+    bool try_reserve_from_quota(uint64_t, size_t);
+
+    /// Lease more space from shard 0 in the background, if needed.
+    void maybe_refill_quota();
+    ss::future<> refill_quota();
+
+    /// Give the space leased by this shard back to shard 0.
+    ss::future<> release_quota();
+
+    /// Grant as much of a lease as fits in the cache without trimming.
+    /// Returns the bytes/objects granted.
+    /// (only runs on shard 0)
+    std::pair<uint64_t, size_t> do_lease_space(uint64_t, size_t);
+
+    /// Take back the leases of all shards before trimming to make space for
+    /// a reservation.
+    /// (only runs on shard 0)
+    ss::future<> recall_quotas();
+
     /// Update _block_puts and kick _block_puts_cond if necessary.  This is
     /// called on all shards by shard 0 when handling a disk space status
     /// update.
@@ -314,11 +343,31 @@ private:
     /// (shard 0 only)
     uint64_t _free_space{0};
 
+    /// Space leased from shard 0 by this shard.  It is accounted as reserved
+    /// on shard 0, so reservations that fit in it are taken without calling
+    /// shard 0.
+    config::binding<uint64_t> _quota_size;
+    uint64_t _quota_bytes{0};
+    size_t _quota_objects{0};
+    bool _quota_refilling{false};
+    /// Set when a reservation is taken from the lease, an unused lease is
+    /// given back on the next tick of _quota_timer.
+    bool _quota_used{false};
+    ss::timer<ss::lowres_clock> _quota_timer;
+    static constexpr size_t quota_objects = 32;
+    static constexpr ss::lowres_clock::duration quota_idle_period = 5s;
+
     ssx::semaphore _cleanup_sm{1, "cloud/cache"};
     std::set<std::filesystem::path> _files_in_progress;
     cache_probe probe;
     access_time_tracker _access_time_tracker;
     ss::timer<ss::lowres_clock> _tracker_timer;
+    /// Serializes the saves of the access time tracker
+    mutex _access_time_save_lock{"cloud/cache/access_time"};
+    /// Size of the access time journal file, where the next batch goes
+    uint64_t _access_time_journal_size{0};
+    /// Set when the journal can't be appended to, e.g. after a failed write
+    bool _access_time_snapshot_needed{false};
 
     /// Remember when we last finished clean_up_cache, in order to
     /// avoid wastefully running it again soon after.
@@ -28,6 +28,9 @@ struct stream_stats {
     model::offset min_offset = model::offset::max();
     model::offset max_offset = model::offset::min();
     uint64_t size_bytes{};
+    /// Offset ranges of the non-data batches in the order of appearance.
+    /// They have to be added to the offset translator state as gaps.
+    std::vector<std::pair<model::offset, model::offset>> gaps;
 };
 
 /// This instance of this class is supposed to be used to
@@ -36,12 +39,10 @@ struct stream_stats {
 /// It consumes information stored in the manifest.
 class offset_translator final {
 public:
-    offset_translator(
+    explicit offset_translator(
       model::offset_delta initial_delta,
-      ss::lw_shared_ptr<storage::offset_translator_state> ot_state,
       storage::opt_abort_source_t as = std::nullopt)
       : _initial_delta(initial_delta)
-      , _ot_state(ot_state)
       , _as(as) {}
 
     /// Copy source stream into the destination stream
@@ -50,6 +51,9 @@ public:
     /// record batch offsets/checksums.
     /// The caller is responsible for patching the segement file name and
     /// passing correct base_offset of the original segment.
+    /// The offsets of the non-data batches are returned as gaps instead of
+    /// being added to the offset translator state so segments can be copied
+    /// concurrently. The caller has to add them in offset order.
     ss::future<stream_stats> copy_stream(
       ss::input_stream<char> src,
       ss::output_stream<char> dst,
@@ -57,7 +61,6 @@ public:
 
 private:
     model::offset_delta _initial_delta;
-    ss::lw_shared_ptr<storage::offset_translator_state> _ot_state;
     storage::opt_abort_source_t _as;
 };
 
@@ -36,6 +36,8 @@
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/iostream.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/core/when_all.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/util/later.hh>
 
 #include <fmt/ostream.h>
@@ -1979,6 +1981,29 @@ struct partition_manifest_handler
     }
 };
 
+[[noreturn]] static void throw_json_parse_error(
+  const rapidjson::Reader& reader,
+  iobuf buf,
+  const remote_manifest_path& path) {
+    rapidjson::ParseErrorCode e = reader.GetParseErrorCode();
+    size_t o = reader.GetErrorOffset();
+
+    // Hexdump 1kb region around the bad manifest
+    buf.trim_front(o - std::min(size_t{512}, o));
+    vlog(
+      cst_log.warn,
+      "Failed to parse manifest at 0x{:08x}: {}",
+      o,
+      buf.hexdump(1024));
+
+    throw std::runtime_error(fmt_with_ctx(
+      fmt::format,
+      "Failed to parse partition manifest {}: {} at offset {}",
+      path,
+      rapidjson::GetParseError_En(e),
+      o));
+}
+
 void partition_manifest::update_with_json(iobuf buf) {
     iobuf_istreambuf ibuf(buf);
     std::istream stream(&ibuf);
@@ -1989,24 +2014,34 @@ void partition_manifest::update_with_json(iobuf buf) {
     if (reader.Parse(wrapper, handler)) {
         partition_manifest::do_update(std::move(handler));
     } else {
-        rapidjson::ParseErrorCode e = reader.GetParseErrorCode();
-        size_t o = reader.GetErrorOffset();
+        throw_json_parse_error(
+          reader, std::move(buf), get_legacy_manifest_format_and_path().second);
+    }
+}
 
-        // Hexdump 1kb region around the bad manifest
-        buf.trim_front(o - std::min(size_t{512}, o));
-        vlog(
-          cst_log.warn,
-          "Failed to parse manifest at 0x{:08x}: {}",
-          o,
-          buf.hexdump(1024));
+ss::future<> partition_manifest::update_with_json_async(iobuf buf) {
+    iobuf_istreambuf ibuf(buf);
+    std::istream stream(&ibuf);
+    json::IStreamWrapper wrapper(stream);
+    rapidjson::Reader reader;
+    partition_manifest_handler handler(_mem_tracker);
 
-        throw std::runtime_error(fmt_with_ctx(
-          fmt::format,
-          "Failed to parse partition manifest {}: {} at offset {}",
-          get_legacy_manifest_format_and_path().second,
-          rapidjson::GetParseError_En(e),
-          o));
+    // The handler adds the segments to the column store as they are parsed,
+    // the document is parsed one token at a time to be able to yield.
+    reader.IterativeParseInit();
+    while (!reader.IterativeParseComplete()) {
+        if (!reader.IterativeParseNext<rapidjson::kParseDefaultFlags>(
+              wrapper, handler)) {
+            break;
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+
+    if (reader.HasParseError()) {
+        throw_json_parse_error(
+          reader, std::move(buf), get_legacy_manifest_format_and_path().second);
     }
+    partition_manifest::do_update(std::move(handler));
 }
 
 ss::future<> partition_manifest::update(
@@ -2026,10 +2061,10 @@ ss::future<> partition_manifest::update(
 
     switch (serialization_format) {
     case manifest_format::json:
-        update_with_json(std::move(result));
+        co_await update_with_json_async(std::move(result));
         break;
     case manifest_format::serde:
-        from_iobuf(std::move(result));
+        co_await from_iobuf_async(std::move(result));
         break;
     }
 }
@@ -2149,7 +2184,7 @@ struct partition_manifest::serialization_cursor {
 };
 
 ss::future<serialized_data_stream> partition_manifest::serialize() const {
-    auto serialized = to_iobuf();
+    auto serialized = co_await to_iobuf_async();
     size_t size_bytes = serialized.size_bytes();
     co_return serialized_data_stream{
       .stream = make_iobuf_input_stream(std::move(serialized)),
@@ -2550,19 +2585,10 @@ partition_manifest::segment_containing(model::offset o) const {
  *
  * We do not keep a direct index of timestamp to segment, because
  * it is relatively rarely used, and would have a high memory cost.
- * In the absence of a random-access container of timestamps,
- * we may use offset as an indirect way of sampling the segments
- * for a bisection search, and use the total partition min+max
- * timestamps to establish a good initial guess: for a partition
- * with evenly spaced messages over time, this will result in very
- * fast lookup.
- * The procedure is:
- * 1. Make an initial guess by interpolating the timestamp between
- *    the partitions min+max timestamp and mapping that to an offset
- * 2. Convert offset guess into segment guess.  This is not a strictly
- *    correct offset lookup, we just want something close.
- * 3. Do linear search backward or forward from the location
- *    we probed, to find the right segment.
+ * The timestamp columns keep the largest value of every frame in
+ * their skip index, so the frames which can't contain the target are
+ * skipped without decoding them. The remaining segments are scanned
+ * linearly.
  */
 std::optional<partition_manifest::segment_meta>
 partition_manifest::timequery(model::timestamp t) const {
@@ -2597,8 +2623,17 @@ partition_manifest::timequery(model::timestamp t) const {
       base_t,
       max_t);
 
-    auto base_timestamp = _segments.get_base_timestamp_column().begin();
-    auto max_timestamp = _segments.get_max_timestamp_column().begin();
+    // Skip the frames that can't contain the target without decoding them
+    const auto& base_timestamp_column = _segments.get_base_timestamp_column();
+    const auto& max_timestamp_column = _segments.get_max_timestamp_column();
+    auto start_ix = std::min(
+      max_timestamp_column.find_frame_by_max(
+        [t](int64_t v) { return v >= t.value(); }),
+      base_timestamp_column.find_frame_by_max(
+        [t](int64_t v) { return v > t.value(); }));
+
+    auto base_timestamp = base_timestamp_column.at_index(start_ix);
+    auto max_timestamp = max_timestamp_column.at_index(start_ix);
     size_t target_ix = 0;
     while (!base_timestamp.is_end()) {
         if (*max_timestamp >= t.value() || *base_timestamp > t.value()) {
@@ -2660,18 +2695,20 @@ static_assert(
 
 // construct partition_manifest_serde while keeping
 // std::is_aggregate<partition_manifest_serde> true
-static auto
-partition_manifest_serde_from_partition_manifest(partition_manifest const& m)
+static auto partition_manifest_serde_from_partition_manifest(
+  partition_manifest const& m,
+  std::invocable<segment_meta_cstore const&> auto serialize_cstore)
   -> partition_manifest_serde {
     partition_manifest_serde tmp{};
     // copy every field that is not segment_meta_cstore in
-    // partition_manifest_serde, and uses to_iobuf for segment_meta_cstore
+    // partition_manifest_serde, and uses serialize_cstore for
+    // segment_meta_cstore
 
-    []<typename DT, typename ST, size_t... Is>(
+    [&serialize_cstore]<typename DT, typename ST, size_t... Is>(
       DT dest_tuple, ST src_tuple, std::index_sequence<Is...>) {
         (([&]<typename Src>(auto& dest, Src const& src) {
              if constexpr (std::is_same_v<Src, segment_meta_cstore>) {
-                 dest = src.to_iobuf();
+                 dest = serialize_cstore(src);
              } else {
                  dest = src;
              }
@@ -2686,12 +2723,14 @@ partition_manifest_serde_from_partition_manifest(partition_manifest const& m)
 
 // almost the reverse of partition_manifest_serde_to_partition_manifest
 static void partition_manifest_serde_to_partition_manifest(
-  partition_manifest_serde src, partition_manifest& dest) {
-    []<typename DT, typename ST, size_t... Is>(
+  partition_manifest_serde src,
+  partition_manifest& dest,
+  std::invocable<segment_meta_cstore&, iobuf> auto deserialize_cstore) {
+    [&deserialize_cstore]<typename DT, typename ST, size_t... Is>(
       DT dest_tuple, ST src_tuple, std::index_sequence<Is...>) {
         (([&]<typename Dest>(Dest& dest, auto& src) {
              if constexpr (std::is_same_v<Dest, segment_meta_cstore>) {
-                 dest.from_iobuf(std::move(src));
+                 deserialize_cstore(dest, std::move(src));
              } else {
                  dest = std::move(src);
              }
@@ -2704,13 +2743,50 @@ static void partition_manifest_serde_to_partition_manifest(
 }
 
 iobuf partition_manifest::to_iobuf() const {
-    return serde::to_iobuf(
-      partition_manifest_serde_from_partition_manifest(*this));
+    return serde::to_iobuf(partition_manifest_serde_from_partition_manifest(
+      *this, [](segment_meta_cstore const& cs) { return cs.to_iobuf(); }));
 }
 
 void partition_manifest::from_iobuf(iobuf in) {
     partition_manifest_serde_to_partition_manifest(
-      serde::from_iobuf<partition_manifest_serde>(std::move(in)), *this);
+      serde::from_iobuf<partition_manifest_serde>(std::move(in)),
+      *this,
+      [](segment_meta_cstore& cs, iobuf buf) {
+          cs.from_iobuf(std::move(buf));
+      });
+
+    // `_start_offset` can be modified in the above so invalidate
+    // the dependent cached value.
+    _cached_start_kafka_offset_local = std::nullopt;
+}
+
+ss::future<iobuf> partition_manifest::to_iobuf_async() const {
+    // All fields, and the content of both column stores, are captured before
+    // the first yield point. The column stores are encoded afterwards.
+    auto tmp = partition_manifest_serde_from_partition_manifest(
+      *this, [](segment_meta_cstore const&) { return iobuf{}; });
+    auto [segments, spillover] = co_await ss::when_all_succeed(
+      _segments.to_iobuf_async(), _spillover_manifests.to_iobuf_async());
+    tmp._segments_serialized = std::move(segments);
+    tmp._spillover_manifests_serialized = std::move(spillover);
+    co_return serde::to_iobuf(std::move(tmp));
+}
+
+ss::future<> partition_manifest::from_iobuf_async(iobuf in) {
+    // The other fields are small, the column stores are decoded separately
+    // with yield points and the manifest is updated at once at the end.
+    auto tmp = serde::from_iobuf<partition_manifest_serde>(std::move(in));
+    segment_meta_cstore segments;
+    co_await segments.from_iobuf_async(
+      std::exchange(tmp._segments_serialized, {}));
+    segment_meta_cstore spillover;
+    co_await spillover.from_iobuf_async(
+      std::exchange(tmp._spillover_manifests_serialized, {}));
+
+    partition_manifest_serde_to_partition_manifest(
+      std::move(tmp), *this, [&](segment_meta_cstore& cs, iobuf) {
+          cs = &cs == &_segments ? std::move(segments) : std::move(spillover);
+      });
 
     // `_start_offset` can be modified in the above so invalidate
     // the dependent cached value.
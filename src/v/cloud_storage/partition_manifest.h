@@ -567,6 +567,15 @@ public:
 
     iobuf to_iobuf() const;
 
+    /// Same as from_iobuf, yields while decoding the segments. The manifest
+    /// is only updated once the whole buffer is decoded.
+    ss::future<> from_iobuf_async(iobuf in);
+
+    /// Same as to_iobuf, yields while encoding the segments. The manifest is
+    /// captured before the first yield point, so the result is consistent
+    /// even if the manifest is updated while it's being serialized.
+    ss::future<iobuf> to_iobuf_async() const;
+
     void process_anomalies(
       model::timestamp scrub_timestamp,
       std::optional<model::offset> last_scrubbed_offset,
@@ -589,6 +598,9 @@ private:
     /// from manifest.json file
     void do_update(partition_manifest_handler&& handler);
 
+    /// Same as update_with_json, yields while parsing the document
+    ss::future<> update_with_json_async(iobuf buf);
+
     /// Copy segments from _segments to _replaced
     /// Returns the total size in bytes of the replaced segments, or nullopt if
     /// the manifest contains already a segment that has the same remote path as
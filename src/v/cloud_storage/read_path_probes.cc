@@ -118,6 +118,27 @@ ts_read_path_probe::ts_read_path_probe() {
                               "from the cache"))
               .aggregate(aggregate_labels),
 
+            sm::make_counter(
+              "spillover_manifest_cache_hits",
+              [this] { return _spillover_manifest_hits; },
+              sm::description("Number of spillover manifest lookups served "
+                              "from memory"))
+              .aggregate(aggregate_labels),
+
+            sm::make_counter(
+              "spillover_manifest_cache_misses",
+              [this] { return _spillover_manifest_misses; },
+              sm::description("Number of spillover manifest lookups that had "
+                              "to wait for materialization"))
+              .aggregate(aggregate_labels),
+
+            sm::make_counter(
+              "spillover_manifest_prefetched",
+              [this] { return _spillover_manifest_prefetched; },
+              sm::description("Number of spillover manifests scheduled for "
+                              "materialization ahead of the reader"))
+              .aggregate(aggregate_labels),
+
             sm::make_gauge(
               "segment_readers",
               [this] { return _cur_segment_readers; },
@@ -148,6 +169,45 @@ ts_read_path_probe::ts_read_path_probe() {
               },
               sm::description("Chunk hydration latency histogram"))
               .aggregate(aggregate_labels),
+            sm::make_histogram(
+              "manifest_lookup_latency",
+              [this] {
+                  return _manifest_lookup_latency.public_histogram_logform();
+              },
+              sm::description("Latency of finding the manifest that contains "
+                              "the start of a read"))
+              .aggregate(aggregate_labels),
+            sm::make_histogram(
+              "cache_lookup_latency",
+              [this] {
+                  return _cache_lookup_latency.public_histogram_logform();
+              },
+              sm::description("Latency of checking the cache for a chunk"))
+              .aggregate(aggregate_labels),
+            sm::make_histogram(
+              "chunk_wait_latency",
+              [this] {
+                  return _chunk_wait_latency.public_histogram_logform();
+              },
+              sm::description("Time readers spend waiting for a chunk to "
+                              "become available"))
+              .aggregate(aggregate_labels),
+            sm::make_histogram(
+              "index_lookup_latency",
+              [this] {
+                  return _index_lookup_latency.public_histogram_logform();
+              },
+              sm::description("Latency of positioning a reader in a segment, "
+                              "including index hydration"))
+              .aggregate(aggregate_labels),
+            sm::make_histogram(
+              "batch_decode_latency",
+              [this] {
+                  return _batch_decode_latency.public_histogram_logform();
+              },
+              sm::description("Latency of a single batch parser pass, "
+                              "including waits for chunks"))
+              .aggregate(aggregate_labels),
             sm::make_counter(
               "hydrations_in_progress",
               [this] { return _hydrations_in_progress; },
@@ -62,6 +62,10 @@ public:
         _spillover_manifest_materialized++;
     }
 
+    void on_spillover_manifest_cache_hit() { _spillover_manifest_hits++; }
+    void on_spillover_manifest_cache_miss() { _spillover_manifest_misses++; }
+    void on_spillover_manifest_prefetch() { _spillover_manifest_prefetched++; }
+
     auto spillover_manifest_latency() {
         return _spillover_mat_latency.auto_measure();
     }
@@ -72,6 +76,28 @@ public:
         return _chunk_hydration_latency.auto_measure();
     }
 
+    /// Per-stage latencies of a tiered read. The stages are measured
+    /// independently, so a slow read can be attributed either to object
+    /// storage (hydration and chunk waits) or to the broker (lookups and
+    /// batch decoding).
+    auto manifest_lookup_latency() {
+        return _manifest_lookup_latency.auto_measure();
+    }
+
+    auto cache_lookup_latency() {
+        return _cache_lookup_latency.auto_measure();
+    }
+
+    auto chunk_wait_latency() { return _chunk_wait_latency.auto_measure(); }
+
+    auto index_lookup_latency() {
+        return _index_lookup_latency.auto_measure();
+    }
+
+    auto batch_decode_latency() {
+        return _batch_decode_latency.auto_measure();
+    }
+
     void download_throttled(size_t value) { _downloads_throttled_sum += value; }
 
     auto get_downloads_throttled_sum() const noexcept {
@@ -91,11 +117,19 @@ private:
     int64_t _spillover_manifest_instances = 0;
     int64_t _spillover_manifest_materialized = 0;
     int64_t _spillover_manifest_hydrated = 0;
+    int64_t _spillover_manifest_hits = 0;
+    int64_t _spillover_manifest_misses = 0;
+    int64_t _spillover_manifest_prefetched = 0;
     /// Spillover manifest materialization latency
     hist_t _spillover_mat_latency;
 
     size_t _chunks_hydrated = 0;
     hist_t _chunk_hydration_latency;
+    hist_t _manifest_lookup_latency;
+    hist_t _cache_lookup_latency;
+    hist_t _chunk_wait_latency;
+    hist_t _index_lookup_latency;
+    hist_t _batch_decode_latency;
     size_t _downloads_throttled_sum = 0;
     size_t _hydrations_in_progress = 0;
 
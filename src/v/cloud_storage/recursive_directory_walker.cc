@@ -58,7 +58,8 @@ struct walk_accumulator {
                 files.push_back(
                   {last_access_timepoint,
                    (std::filesystem::path(target) / entry.name.data()).native(),
-                   static_cast<uint64_t>(file_stats.size)});
+                   static_cast<uint64_t>(file_stats.size),
+                   tracker.estimate_frequency(entry_path)});
             } else if (filter) {
                 ++filtered_out_files;
             }
@@ -26,6 +26,8 @@ struct file_list_item {
     std::chrono::system_clock::time_point access_time;
     ss::sstring path;
     uint64_t size;
+    // Recent accesses, see access_time_tracker::estimate_frequency
+    uint8_t frequency{0};
 };
 
 struct walk_result {
@@ -18,8 +18,11 @@
 #include "cloud_storage_clients/client_pool.h"
 #include "cloud_storage_clients/types.h"
 #include "cloud_storage_clients/util.h"
+#include "config/configuration.h"
 #include "model/metadata.h"
+#include "ssx/future-util.h"
 #include "ssx/semaphore.h"
+#include "ssx/sformat.h"
 #include "utils/retry_chain_node.h"
 
 #include <seastar/core/abort_source.hh>
@@ -632,6 +635,23 @@ ss::future<upload_result> remote::upload_segment(
   const reset_input_stream& reset_str,
   retry_chain_node& parent,
   lazy_abort_source& lazy_abort_source) {
+    const auto& cfg = config::shard_local_cfg();
+    const uint64_t part_size = cfg.cloud_storage_upload_part_size();
+    const size_t max_parts = cfg.cloud_storage_max_upload_parts_in_flight();
+    using cloud_storage_clients::client;
+    if (
+      max_parts > 1 && content_length > part_size
+      && content_length <= part_size * client::max_multipart_upload_parts) {
+        return upload_segment_multipart(
+          bucket,
+          segment_path,
+          content_length,
+          reset_str,
+          parent,
+          lazy_abort_source,
+          part_size,
+          max_parts);
+    }
     return upload_stream(
       bucket,
       segment_path,
@@ -646,6 +666,245 @@ ss::future<upload_result> remote::upload_segment(
       [this] { _probe.upload_backoff(); });
 }
 
+template<typename T, typename Func>
+ss::future<upload_result> remote::multipart_request(
+  retry_chain_node& fib,
+  lazy_abort_source& lazy_abort_source,
+  std::string_view request_label,
+  T& out,
+  Func request) {
+    retry_chain_logger ctxlog(cst_log, fib);
+    auto permit = fib.retry();
+    while (!_gate.is_closed() && permit.is_allowed) {
+        auto lease = co_await _pool.local().acquire(fib.root_abort_source());
+        if (lazy_abort_source.abort_requested()) {
+            vlog(
+              ctxlog.warn,
+              "{}: cancelled {}",
+              lazy_abort_source.abort_reason(),
+              request_label);
+            co_return upload_result::cancelled;
+        }
+
+        auto res = co_await request(*lease.client);
+        if (res) {
+            out = std::move(res.value());
+            co_return upload_result::success;
+        }
+
+        lease.client->shutdown();
+        switch (res.error()) {
+        case cloud_storage_clients::error_outcome::retry:
+            vlog(
+              ctxlog.debug,
+              "{}, {} backoff required",
+              request_label,
+              std::chrono::duration_cast<std::chrono::milliseconds>(
+                permit.delay));
+            _probe.upload_backoff();
+            if (!lazy_abort_source.abort_requested()) {
+                co_await ss::sleep_abortable(
+                  permit.delay, fib.root_abort_source());
+            }
+            permit = fib.retry();
+            break;
+        case cloud_storage_clients::error_outcome::key_not_found:
+            // not expected during upload
+            [[fallthrough]];
+        case cloud_storage_clients::error_outcome::fail:
+            vlog(ctxlog.warn, "{} failed", request_label);
+            co_return upload_result::failed;
+        }
+    }
+    vlog(ctxlog.warn, "{}, backoff quota exceded", request_label);
+    co_return upload_result::timedout;
+}
+
+ss::future<upload_result> remote::upload_segment_part(
+  const cloud_storage_clients::bucket_name& bucket,
+  const cloud_storage_clients::object_key& key,
+  const ss::sstring& upload_id,
+  size_t part_number,
+  iobuf part,
+  ss::sstring& part_id,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source) {
+    // every part has its own backoff
+    retry_chain_node fib(&parent);
+    co_return co_await multipart_request(
+      fib,
+      lazy_abort_source,
+      ssx::sformat("Uploading part {} of {}", part_number, key),
+      part_id,
+      [&](cloud_storage_clients::client& client) {
+          const auto size = part.size_bytes();
+          return client.upload_part(
+            bucket,
+            key,
+            upload_id,
+            part_number,
+            size,
+            make_iobuf_input_stream(part.share(0, size)),
+            fib.get_timeout());
+      });
+}
+
+ss::future<upload_result> remote::upload_segment_multipart(
+  const cloud_storage_clients::bucket_name& bucket,
+  const remote_segment_path& segment_path,
+  uint64_t content_length,
+  const reset_input_stream& reset_str,
+  retry_chain_node& parent,
+  lazy_abort_source& lazy_abort_source,
+  uint64_t part_size,
+  size_t max_parts_in_flight) {
+    auto guard = _gate.hold();
+    retry_chain_node fib(&parent);
+    retry_chain_logger ctxlog(cst_log, fib);
+    const auto key = cloud_storage_clients::object_key(segment_path());
+    const size_t parts_count = (content_length + part_size - 1) / part_size;
+    vlog(
+      ctxlog.debug,
+      "Uploading segment to path {}, length {}, in {} parts",
+      segment_path,
+      content_length,
+      parts_count);
+    notify_external_subscribers(
+      api_activity_notification{
+        .type = api_activity_type::segment_upload, .is_retry = false},
+      parent);
+
+    ss::sstring upload_id;
+    auto result = co_await multipart_request(
+      fib,
+      lazy_abort_source,
+      ssx::sformat("Initiating upload of {}", key),
+      upload_id,
+      [&](cloud_storage_clients::client& client) {
+          return client.initiate_multipart_upload(
+            bucket, key, fib.get_timeout());
+      });
+    if (result != upload_result::success) {
+        _probe.failed_upload();
+        co_return result;
+    }
+
+    // The segment is read once, the parts read ahead are buffered until
+    // they are uploaded. A failed part is retried from its buffer.
+    std::vector<ss::sstring> part_ids(parts_count);
+    ssx::semaphore parts_in_flight(max_parts_in_flight, "cst_upload_parts");
+    ss::gate parts_gate;
+    std::exception_ptr read_error;
+    auto reader_handle = co_await reset_str();
+    auto stream = reader_handle->take_stream();
+    try {
+        for (size_t i = 0; i < parts_count; ++i) {
+            auto units = co_await ss::get_units(parts_in_flight, 1);
+            if (result != upload_result::success) {
+                break;
+            }
+            const auto size = std::min(
+              part_size, content_length - i * part_size);
+            auto part = co_await read_iobuf_exactly(stream, size);
+            if (part.size_bytes() != size) {
+                vlog(
+                  ctxlog.warn,
+                  "Unexpected end of segment {} at {} bytes",
+                  segment_path,
+                  i * part_size + part.size_bytes());
+                result = upload_result::failed;
+                break;
+            }
+            ssx::spawn_with_gate(
+              parts_gate,
+              [this,
+               &bucket,
+               &key,
+               &upload_id,
+               &part_ids,
+               &fib,
+               &lazy_abort_source,
+               &result,
+               i,
+               part = std::move(part),
+               units = std::move(units)]() mutable {
+                  return upload_segment_part(
+                           bucket,
+                           key,
+                           upload_id,
+                           i + 1,
+                           std::move(part),
+                           part_ids[i],
+                           fib,
+                           lazy_abort_source)
+                    .then([&result, units = std::move(units)](
+                            upload_result r) {
+                        if (
+                          r != upload_result::success
+                          && result == upload_result::success) {
+                            result = r;
+                        }
+                    });
+              });
+        }
+    } catch (...) {
+        read_error = std::current_exception();
+        result = upload_result::failed;
+    }
+    co_await parts_gate.close();
+    co_await stream.close();
+    co_await reader_handle->close();
+
+    if (result == upload_result::success) {
+        cloud_storage_clients::client::no_response done;
+        result = co_await multipart_request(
+          fib,
+          lazy_abort_source,
+          ssx::sformat("Completing upload of {}", key),
+          done,
+          [&](cloud_storage_clients::client& client) {
+              return client.complete_multipart_upload(
+                bucket, key, upload_id, part_ids, fib.get_timeout());
+          });
+    }
+
+    if (result == upload_result::success) {
+        _probe.successful_upload();
+        _probe.register_upload_size(content_length);
+        co_return result;
+    }
+
+    // Best effort, the parts of an upload that is never completed or aborted
+    // are left in the bucket until a lifecycle rule removes them.
+    retry_chain_node abort_fib(
+      _as,
+      config::shard_local_cfg().cloud_storage_segment_upload_timeout_ms(),
+      fib.get_backoff());
+    lazy_abort_source never_abort{[] { return std::nullopt; }};
+    cloud_storage_clients::client::no_response aborted;
+    co_await multipart_request(
+      abort_fib,
+      never_abort,
+      ssx::sformat("Aborting upload of {}", key),
+      aborted,
+      [&](cloud_storage_clients::client& client) {
+          return client.abort_multipart_upload(
+            bucket, key, upload_id, abort_fib.get_timeout());
+      });
+
+    _probe.failed_upload();
+    vlog(
+      ctxlog.warn,
+      "Uploading segment {} to {}, {}, segment not uploaded",
+      segment_path,
+      bucket,
+      result);
+    if (read_error) {
+        std::rethrow_exception(read_error);
+    }
+    co_return result;
+}
+
 ss::future<download_result> remote::download_stream(
   const cloud_storage_clients::bucket_name& bucket,
   const remote_segment_path& path,
@@ -1271,6 +1530,38 @@ ss::future<remote::list_result> remote::list_objects(
   retry_chain_node& parent,
   std::optional<cloud_storage_clients::object_key> prefix,
   std::optional<char> delimiter,
+  std::optional<cloud_storage_clients::client::item_filter> item_filter) {
+    return do_list_objects(
+      bucket,
+      parent,
+      std::nullopt,
+      std::move(prefix),
+      delimiter,
+      std::move(item_filter));
+}
+
+ss::future<remote::list_result> remote::list_objects(
+  const cloud_storage_clients::bucket_name& bucket,
+  retry_chain_node& parent,
+  list_objects_consumer consumer,
+  std::optional<cloud_storage_clients::object_key> prefix,
+  std::optional<char> delimiter,
+  std::optional<cloud_storage_clients::client::item_filter> item_filter) {
+    return do_list_objects(
+      bucket,
+      parent,
+      std::move(consumer),
+      std::move(prefix),
+      delimiter,
+      std::move(item_filter));
+}
+
+ss::future<remote::list_result> remote::do_list_objects(
+  const cloud_storage_clients::bucket_name& bucket,
+  retry_chain_node& parent,
+  std::optional<list_objects_consumer> consumer,
+  std::optional<cloud_storage_clients::object_key> prefix,
+  std::optional<char> delimiter,
   std::optional<cloud_storage_clients::client::item_filter> item_filter) {
     ss::gate::holder gh{_gate};
     retry_chain_node fib(&parent);
@@ -1286,6 +1577,34 @@ ss::future<remote::list_result> remote::list_objects(
     // Gathers the items from a series of successful ListObjectsV2 calls
     cloud_storage_clients::client::list_bucket_result list_bucket_result;
 
+    // When the items are consumed the parser hands them over to the consumer
+    // through the filter and doesn't collect anything. The last consumed key
+    // is tracked so a page requested again after an error doesn't deliver
+    // the same items twice.
+    bool consumer_stopped = false;
+    std::optional<ss::sstring> last_consumed_key;
+    if (consumer.has_value()) {
+        item_filter = [&, filter = std::move(item_filter)](
+                        const cloud_storage_clients::client::list_bucket_item&
+                          item) {
+            if (
+              consumer_stopped
+              || (last_consumed_key.has_value()
+                  && item.key <= *last_consumed_key)
+              || (filter.has_value() && !(*filter)(item))) {
+                return false;
+            }
+            last_consumed_key = item.key;
+            consumer_stopped = (*consumer)(
+                                 item.key,
+                                 item.last_modified,
+                                 item.size_bytes,
+                                 item.etag)
+                               == ss::stop_iteration::yes;
+            return false;
+        };
+    }
+
     // Keep iterating until the ListObjectsV2 calls has more items to return
     while (!_gate.is_closed() && permit.is_allowed && !result) {
         auto res = co_await lease.client->list_objects(
@@ -1324,7 +1643,7 @@ ss::future<remote::list_result> remote::list_objects(
             list_bucket_result.prefix = list_result.prefix;
 
             // Continue to list the remaining items
-            if (items_remaining) {
+            if (items_remaining && !consumer_stopped) {
                 continue;
             }
 
@@ -394,6 +394,25 @@ public:
       std::optional<cloud_storage_clients::client::item_filter> item_filter
       = std::nullopt);
 
+    /// \brief Lists objects in a bucket without collecting them
+    ///
+    /// Every item passing \p item_filter is handed to \p consumer as soon
+    /// as it is parsed from the response, so the listing of large buckets
+    /// doesn't have to be buffered. Listing stops when the consumer returns
+    /// stop_iteration::yes. Items are delivered in key order and at most
+    /// once, even if a page has to be requested again after an error.
+    ///
+    /// \return list result with the prefixes of the listing, the contents
+    ///         is always empty
+    ss::future<list_result> list_objects(
+      const cloud_storage_clients::bucket_name& name,
+      retry_chain_node& parent,
+      list_objects_consumer consumer,
+      std::optional<cloud_storage_clients::object_key> prefix = std::nullopt,
+      std::optional<char> delimiter = std::nullopt,
+      std::optional<cloud_storage_clients::client::item_filter> item_filter
+      = std::nullopt);
+
     /// \brief Upload small objects to bucket. Suitable for uploading simple
     /// strings, does not check for leadership before upload like the segment
     /// upload function.
@@ -479,6 +498,16 @@ public:
     ss::abort_source& as() { return _as; }
 
 private:
+    /// Shared implementation of the list_objects overloads. Items are
+    /// collected into the result unless the consumer is set.
+    ss::future<list_result> do_list_objects(
+      const cloud_storage_clients::bucket_name& name,
+      retry_chain_node& parent,
+      std::optional<list_objects_consumer> consumer,
+      std::optional<cloud_storage_clients::object_key> prefix,
+      std::optional<char> delimiter,
+      std::optional<cloud_storage_clients::client::item_filter> item_filter);
+
     template<
       typename FailedUploadMetricFn,
       typename SuccessfulUploadMetricFn,
@@ -496,6 +525,38 @@ private:
       SuccessfulUploadMetricFn successful_upload_metric,
       UploadBackoffMetricFn upload_backoff_metric);
 
+    /// Upload the segment in parts, up to max_parts_in_flight parts are read
+    /// ahead and uploaded concurrently
+    ss::future<upload_result> upload_segment_multipart(
+      const cloud_storage_clients::bucket_name& bucket,
+      const remote_segment_path& segment_path,
+      uint64_t content_length,
+      const reset_input_stream& reset_str,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source,
+      uint64_t part_size,
+      size_t max_parts_in_flight);
+
+    ss::future<upload_result> upload_segment_part(
+      const cloud_storage_clients::bucket_name& bucket,
+      const cloud_storage_clients::object_key& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      iobuf part,
+      ss::sstring& part_id,
+      retry_chain_node& parent,
+      lazy_abort_source& lazy_abort_source);
+
+    /// Retry a request of a multipart upload, the result of a successful
+    /// request is stored in \p out
+    template<typename T, typename Func>
+    ss::future<upload_result> multipart_request(
+      retry_chain_node& fib,
+      lazy_abort_source& lazy_abort_source,
+      std::string_view request_label,
+      T& out,
+      Func request);
+
     template<
       typename DownloadLatencyMeasurementFn,
       typename FailedDownloadMetricFn,
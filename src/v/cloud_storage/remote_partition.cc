@@ -516,7 +516,9 @@ private:
             query = model::offset_cast(config.start_offset);
         }
         // Find manifest that contains requested offset or timestamp
+        auto measurement = _partition->_ts_probe.manifest_lookup_latency();
         auto cur = co_await _partition->_manifest_view->get_cursor(query);
+        measurement.reset();
         if (cur.has_failure()) {
             if (cur.error() == error_outcome::shutting_down) {
                 co_return;
@@ -754,6 +756,12 @@ private:
                     _next_segment_base_offset);
                 _next_segment_base_offset = new_next_offset;
                 _reader = std::move(new_reader);
+                if (_reader) {
+                    // Hide the download of the next spillover manifest
+                    // behind the reads from the tail of the current one.
+                    _view_cursor->maybe_prefetch_next(
+                      _reader->max_rp_offset());
+                }
             }
             if (maybe_manifest.has_value() && _reader != nullptr) {
                 vassert(
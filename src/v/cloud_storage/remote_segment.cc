@@ -45,6 +45,7 @@
 #include <seastar/core/timed_out_error.hh>
 #include <seastar/core/when_all.hh>
 #include <seastar/coroutine/all.hh>
+#include <seastar/coroutine/as_future.hh>
 #include <seastar/util/defer.hh>
 #include <seastar/util/log.hh>
 
@@ -70,6 +71,80 @@ private:
     size_t _upto;
 };
 
+/**
+ * Serves an object downloaded with concurrent ranged GETs. Up to
+ * max_in_flight parts are downloaded ahead of the reader, the data of the
+ * parts are returned in order.
+ */
+class ranged_parts_stream final : public ss::data_source_impl {
+public:
+    using fetch_part_fn = ss::noncopyable_function<ss::future<iobuf>(
+      cloud_storage_clients::http_byte_range)>;
+
+    ranged_parts_stream(
+      uint64_t size,
+      uint64_t part_size,
+      size_t max_in_flight,
+      fetch_part_fn fetch_part)
+      : _size(size)
+      , _part_size(part_size)
+      , _max_in_flight(max_in_flight)
+      , _fetch_part(std::move(fetch_part)) {}
+
+    ranged_parts_stream(const ranged_parts_stream&) = delete;
+    ranged_parts_stream& operator=(const ranged_parts_stream&) = delete;
+    ranged_parts_stream(ranged_parts_stream&&) = delete;
+    ranged_parts_stream& operator=(ranged_parts_stream&&) = delete;
+
+    ~ranged_parts_stream() override {
+        // the reader gave up, the parts are still awaited by the gate of the
+        // fetch function
+        for (auto& f : _in_flight) {
+            ssx::background = std::move(f).then_wrapped(
+              [](ss::future<iobuf> f) { f.ignore_ready_future(); });
+        }
+    }
+
+    ss::future<ss::temporary_buffer<char>> get() override {
+        while (true) {
+            if (_current) {
+                auto buf = co_await _current->read();
+                if (!buf.empty()) {
+                    co_return buf;
+                }
+                co_await _current->close();
+                _current.reset();
+            }
+            fetch_ahead();
+            if (_in_flight.empty()) {
+                co_return ss::temporary_buffer<char>{};
+            }
+            auto next = std::move(_in_flight.front());
+            _in_flight.pop_front();
+            // keep the window full while waiting for the part
+            fetch_ahead();
+            _current = make_iobuf_input_stream(co_await std::move(next));
+        }
+    }
+
+private:
+    void fetch_ahead() {
+        while (_in_flight.size() < _max_in_flight && _next < _size) {
+            auto last = std::min(_next + _part_size, _size) - 1;
+            _in_flight.push_back(_fetch_part({_next, last}));
+            _next = last + 1;
+        }
+    }
+
+    uint64_t _size;
+    uint64_t _part_size;
+    size_t _max_in_flight;
+    fetch_part_fn _fetch_part;
+    uint64_t _next{0};
+    ss::circular_buffer<ss::future<iobuf>> _in_flight;
+    std::optional<ss::input_stream<char>> _current;
+};
+
 } // namespace
 
 namespace cloud_storage {
@@ -285,6 +360,7 @@ remote_segment::offset_data_stream(
     vlog(_ctxlog.debug, "remote segment file input stream at offset {}", start);
     ss::gate::holder g(_gate);
 
+    auto index_measurement = _ts_probe.index_lookup_latency();
     co_await hydrate(as);
 
     std::optional<offset_index::find_result> indexed_pos;
@@ -298,10 +374,11 @@ remote_segment::offset_data_stream(
         // scan is comparatively small.
 
         prefetch_override = 0;
-        indexed_pos = maybe_get_offsets(*first_timestamp);
+        indexed_pos = co_await maybe_get_offsets(*first_timestamp);
     } else {
-        indexed_pos = maybe_get_offsets(start);
+        indexed_pos = co_await maybe_get_offsets(start);
     }
+    index_measurement.reset();
 
     // If the index lookup failed, scan the entire segement starting from the
     // first chunk.
@@ -348,14 +425,64 @@ remote_segment::offset_data_stream(
     };
 }
 
-std::optional<offset_index::find_result>
+ss::future<std::optional<iobuf>>
+remote_segment::read_index_frame(framed_offset_index::frame_ref frame) {
+    auto item = co_await _cache.get(_index_path);
+    if (!item) {
+        vlog(
+          _ctxlog.debug,
+          "Index {} is not in the cache, can't read frame at {}",
+          _index_path,
+          frame.file_pos);
+        co_return std::nullopt;
+    }
+    ss::file_input_stream_options options{};
+    options.buffer_size = frame.size_bytes;
+    options.io_priority_class
+      = priority_manager::local().shadow_indexing_priority();
+    auto in = ss::make_file_input_stream(
+      item->body, frame.file_pos, frame.size_bytes, options);
+    std::exception_ptr ex;
+    std::optional<iobuf> result;
+    try {
+        auto buf = co_await in.read_exactly(frame.size_bytes);
+        if (buf.size() == frame.size_bytes) {
+            result.emplace();
+            result->append(std::move(buf));
+        } else {
+            vlog(
+              _ctxlog.warn,
+              "Short read of index {} frame at {}: {} of {} bytes",
+              _index_path,
+              frame.file_pos,
+              buf.size(),
+              frame.size_bytes);
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await in.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+    co_return result;
+}
+
+ss::future<std::optional<offset_index::find_result>>
 remote_segment::maybe_get_offsets(kafka::offset kafka_offset) {
-    if (!_index) {
-        return {};
+    std::optional<offset_index::find_result> pos;
+    if (_index) {
+        pos = _index->find_kaf_offset(kafka_offset);
+    } else if (_framed_index) {
+        if (auto ref = _framed_index->find_kaf_offset_frame(kafka_offset)) {
+            if (auto frame = co_await read_index_frame(*ref)) {
+                pos = framed_offset_index::find_kaf_offset(
+                  *frame, kafka_offset);
+            }
+        }
     }
-    auto pos = _index->find_kaf_offset(kafka_offset);
     if (!pos) {
-        return {};
+        co_return pos;
     }
     vlog(
       _ctxlog.debug,
@@ -366,7 +493,7 @@ remote_segment::maybe_get_offsets(kafka::offset kafka_offset) {
       pos->rp_offset,
       pos->kaf_offset,
       pos->file_pos);
-    return pos;
+    co_return pos;
 }
 
 size_t remote_segment::estimate_memory_use() const {
@@ -376,17 +503,26 @@ size_t remote_segment::estimate_memory_use() const {
     if (_index) {
         res += _index->estimate_memory_use();
     }
+    if (_framed_index) {
+        res += _framed_index->estimate_memory_use();
+    }
     return res;
 }
 
-std::optional<offset_index::find_result>
+ss::future<std::optional<offset_index::find_result>>
 remote_segment::maybe_get_offsets(model::timestamp ts) {
-    if (!_index) {
-        return {};
+    std::optional<offset_index::find_result> pos;
+    if (_index) {
+        pos = _index->find_timestamp(ts);
+    } else if (_framed_index) {
+        if (auto ref = _framed_index->find_timestamp_frame(ts)) {
+            if (auto frame = co_await read_index_frame(*ref)) {
+                pos = framed_offset_index::find_timestamp(*frame, ts);
+            }
+        }
     }
-    auto pos = _index->find_timestamp(ts);
     if (!pos) {
-        return {};
+        co_return pos;
     }
     vlog(
       _ctxlog.debug,
@@ -397,7 +533,7 @@ remote_segment::maybe_get_offsets(model::timestamp ts) {
       pos->rp_offset,
       pos->kaf_offset,
       pos->file_pos);
-    return pos;
+    co_return pos;
 }
 
 /**
@@ -504,6 +640,14 @@ ss::future<> remote_segment::do_hydrate_segment() {
       _size + storage::segment_index::estimate_size(_size), 1);
 
     track_hydration t{_ts_probe};
+    const auto& cfg = config::shard_local_cfg();
+    const uint64_t part_size = cfg.cloud_storage_hydration_part_size();
+    const size_t max_parts = cfg.cloud_storage_max_hydration_parts_in_flight();
+    if (max_parts > 1 && _size > part_size) {
+        co_return co_await do_hydrate_segment_in_parts(
+          reservation, local_rtc, part_size, max_parts);
+    }
+
     auto res = co_await _api.download_segment(
       _bucket,
       _path,
@@ -527,6 +671,78 @@ ss::future<> remote_segment::do_hydrate_segment() {
     }
 }
 
+ss::future<> remote_segment::do_hydrate_segment_in_parts(
+  space_reservation_guard& reservation,
+  retry_chain_node& rtc,
+  uint64_t part_size,
+  size_t max_parts_in_flight) {
+    vlog(
+      _ctxlog.debug,
+      "Hydrating segment {} of {} bytes in parts of {} bytes, {} in flight",
+      _path,
+      _size,
+      part_size,
+      max_parts_in_flight);
+    // the parts reference the retry chain node of the caller, they must be
+    // done before returning even if the reader stopped early
+    ss::gate parts_gate;
+    auto stream = ss::input_stream<char>{
+      ss::data_source{std::make_unique<ranged_parts_stream>(
+        _size,
+        part_size,
+        max_parts_in_flight,
+        [this, &parts_gate, &rtc](cloud_storage_clients::http_byte_range r) {
+            return ss::with_gate(parts_gate, [this, &rtc, r] {
+                return download_segment_part(r, rtc);
+            });
+        })}};
+    auto fut = co_await ss::coroutine::as_future(
+      put_segment_in_cache_and_create_index(
+        _size, reservation, std::move(stream)));
+    co_await parts_gate.close();
+    if (fut.failed()) {
+        std::rethrow_exception(fut.get_exception());
+    }
+    fut.ignore_ready_future();
+}
+
+ss::future<iobuf> remote_segment::download_segment_part(
+  cloud_storage_clients::http_byte_range range, retry_chain_node& rtc) {
+    iobuf part;
+    auto res = co_await _api.download_segment(
+      _bucket,
+      _path,
+      [&part](
+        uint64_t size_bytes,
+        ss::input_stream<char> s) -> ss::future<uint64_t> {
+          auto buf = co_await ss::coroutine::as_future(
+            read_iobuf_exactly(s, size_bytes));
+          co_await s.close();
+          part = buf.get();
+          if (part.size_bytes() != size_bytes) {
+              throw std::runtime_error(fmt_with_ctx(
+                fmt::format,
+                "short read of a segment part, {} out of {} bytes",
+                part.size_bytes(),
+                size_bytes));
+          }
+          co_return size_bytes;
+      },
+      rtc,
+      range);
+    if (res != download_result::success) {
+        vlog(
+          _ctxlog.debug,
+          "Failed to download part {}-{} of segment {}: {}",
+          range.first,
+          range.second,
+          _path,
+          res);
+        throw download_exception(res, _path);
+    }
+    co_return part;
+}
+
 ss::future<> remote_segment::do_hydrate_index() {
     retry_chain_node local_rtc(
       cache_hydration_timeout, cache_hydration_backoff, &_rtc);
@@ -545,11 +761,13 @@ ss::future<> remote_segment::do_hydrate_index() {
         throw download_exception(result, _index_path);
     }
 
-    _index = std::move(ix);
+    // Only the directory of the framed index is kept in memory, lookups
+    // read a single frame from the cache.
     _coarse_index.emplace(
-      _index->build_coarse_index(_chunk_size, _index_path.native()));
+      ix.build_coarse_index(_chunk_size, _index_path.native()));
+    auto [framed, buf] = framed_offset_index::encode(ix);
+    _framed_index = std::move(framed);
     co_await _chunks_api->start();
-    auto buf = _index->to_iobuf();
 
     auto reservation = co_await _cache.reserve_space(buf.size_bytes(), 1);
     auto str = make_iobuf_input_stream(std::move(buf));
@@ -697,7 +915,7 @@ ss::future<bool> remote_segment::do_materialize_txrange() {
 }
 
 ss::future<bool> remote_segment::maybe_materialize_index() {
-    if (_index) {
+    if (_index || _framed_index) {
         vlog(_ctxlog.debug, "index already materialized");
         co_return true;
     }
@@ -726,15 +944,37 @@ ss::future<bool> remote_segment::maybe_materialize_index() {
               = priority_manager::local().shadow_indexing_priority();
             auto inp_stream = ss::make_file_input_stream(
               cache_item->body, options);
-            iobuf state;
-            auto out_stream = make_iobuf_ref_output_stream(state);
-            co_await ss::copy(inp_stream, out_stream).finally([&inp_stream] {
-                return inp_stream.close();
-            });
-            ix.from_iobuf(std::move(state));
-            _index = std::move(ix);
-            _coarse_index.emplace(
-              _index->build_coarse_index(_chunk_size, _index_path.native()));
+            std::exception_ptr ex;
+            try {
+                auto tmp = co_await inp_stream.read_exactly(
+                  framed_offset_index::header_size);
+                iobuf head;
+                head.append(std::move(tmp));
+                if (framed_offset_index::is_framed(head)) {
+                    auto [framed, coarse] = co_await framed_offset_index::read(
+                      std::move(head),
+                      inp_stream,
+                      _chunk_size,
+                      _index_path.native());
+                    _framed_index = std::move(framed);
+                    _coarse_index.emplace(std::move(coarse));
+                } else {
+                    // Index cached by an older version
+                    iobuf state = std::move(head);
+                    auto out_stream = make_iobuf_ref_output_stream(state);
+                    co_await ss::copy(inp_stream, out_stream);
+                    ix.from_iobuf(std::move(state));
+                    _index = std::move(ix);
+                    _coarse_index.emplace(_index->build_coarse_index(
+                      _chunk_size, _index_path.native()));
+                }
+            } catch (...) {
+                ex = std::current_exception();
+            }
+            co_await inp_stream.close();
+            if (ex) {
+                std::rethrow_exception(ex);
+            }
             co_await _chunks_api->start();
         } catch (...) {
             // In case of any failure during index materialization just continue
@@ -770,7 +1010,7 @@ bool remote_segment::is_state_materialized() const {
     if (is_legacy_mode_engaged()) {
         return bool(_data_file);
     } else {
-        return _index.has_value();
+        return _index.has_value() || _framed_index.has_value();
     }
 }
 
@@ -984,8 +1224,10 @@ ss::future<> remote_segment::hydrate_chunk(segment_chunk_range range) {
     // makes an HTTP GET call and E is also prefetched. So a total of two calls
     // are made for the five chunks (ignoring any cache evictions during the
     // process).
-    if (const auto status = co_await _cache.is_cached(path_to_start);
-        status == cache_element_status::available) {
+    auto cache_measurement = _ts_probe.cache_lookup_latency();
+    const auto status = co_await _cache.is_cached(path_to_start);
+    cache_measurement.reset();
+    if (status == cache_element_status::available) {
         vlog(
           _ctxlog.debug,
           "skipping chunk hydration for chunk path {}, it is already in "
@@ -1380,7 +1622,9 @@ remote_segment_batch_reader::read_some(
 
         _cur_ot_state = ot_state;
         auto deferred = ss::defer([this] { _cur_ot_state = std::nullopt; });
+        auto measurement = _ts_probe.batch_decode_latency();
         auto new_bytes_consumed = co_await _parser->consume();
+        measurement.reset();
         if (!new_bytes_consumed) {
             co_return new_bytes_consumed.error();
         }
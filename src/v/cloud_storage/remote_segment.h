@@ -100,6 +100,9 @@ public:
     /// Get segment size
     size_t get_segment_size() const;
 
+    /// Probe shared by the tiered readers of this shard
+    ts_read_path_probe& get_ts_probe() { return _ts_probe; }
+
     ss::future<> stop();
 
     /// create an input stream _sharing_ the underlying file handle
@@ -194,14 +197,20 @@ public:
 private:
     /// get a file offset for the corresponding kafka offset
     /// if the index is available
-    std::optional<offset_index::find_result>
+    ss::future<std::optional<offset_index::find_result>>
     maybe_get_offsets(kafka::offset kafka_offset);
 
     /// get a file offset for the corresponding to the timestamp
     /// if the index is available
-    std::optional<offset_index::find_result>
+    ss::future<std::optional<offset_index::find_result>>
       maybe_get_offsets(model::timestamp);
 
+    /// Read a frame of the framed index from the cache.  Returns nullopt if
+    /// the index was evicted, the caller then scans the segment from its
+    /// start.
+    ss::future<std::optional<iobuf>>
+    read_index_frame(framed_offset_index::frame_ref);
+
     /// Sets the results of the waiters of this segment as the given error.
     void set_waiter_errors(const std::exception_ptr& err);
 
@@ -216,6 +225,17 @@ private:
     /// to the cache dir and updates the segment index.
     ss::future<> do_hydrate_segment();
 
+    /// Hydrate the segment with concurrent ranged GETs, the parts are
+    /// buffered and written to the cache in order.
+    ss::future<> do_hydrate_segment_in_parts(
+      space_reservation_guard&,
+      retry_chain_node&,
+      uint64_t part_size,
+      size_t max_parts_in_flight);
+
+    ss::future<iobuf> download_segment_part(
+      cloud_storage_clients::http_byte_range, retry_chain_node&);
+
     /// Helper for do_hydrate_segment
     ss::future<uint64_t> put_segment_in_cache_and_create_index(
       uint64_t, space_reservation_guard&, ss::input_stream<char>);
@@ -291,7 +311,11 @@ private:
     ss::expiring_fifo<ss::promise<ss::file>, expiry_handler> _wait_list;
 
     ss::file _data_file;
+    /// The index of a segment that was hydrated in full, legacy mode only
     std::optional<offset_index> _index;
+    /// The directory of the index of a chunked segment.  The frames are read
+    /// from the index file in the cache when they are needed.
+    std::optional<framed_offset_index> _framed_index;
 
     using tx_range_vec = fragmented_vector<model::tx_range>;
     std::optional<tx_range_vec> _tx_range;
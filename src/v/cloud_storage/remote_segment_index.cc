@@ -16,6 +16,9 @@
 #include "serde/envelope.h"
 #include "serde/serde.h"
 
+#include <seastar/core/byteorder.hh>
+#include <seastar/core/coroutine.hh>
+
 namespace cloud_storage {
 
 offset_index::offset_index(
@@ -230,6 +233,43 @@ offset_index::find_timestamp(model::timestamp upper_bound) {
       });
 }
 
+namespace {
+/// Picks the entries of the coarse index, one every step_size bytes of file
+/// position, from the entries of the offset index fed in order.
+class coarse_index_builder {
+public:
+    coarse_index_builder(uint64_t step_size, std::string_view index_path)
+      : _step_size(step_size)
+      , _index_path(index_path) {}
+
+    void add(kafka::offset kaf_offset, int64_t file_pos) {
+        _span_end = file_pos;
+        auto delta = _span_end - _span_start + 1;
+        if (_span_end > _span_start && delta >= _step_size) {
+            vlog(
+              cst_log.trace,
+              "{}: adding entry to coarse index, current file pos: {}, "
+              "step size: {}, span size: {}",
+              _index_path,
+              _span_end,
+              _step_size,
+              delta);
+            _index[kaf_offset] = _span_end;
+            _span_start = _span_end + 1;
+        }
+    }
+
+    offset_index::coarse_index_t release() && { return std::move(_index); }
+
+private:
+    uint64_t _step_size;
+    std::string_view _index_path;
+    size_t _span_start{0};
+    size_t _span_end{0};
+    offset_index::coarse_index_t _index;
+};
+} // namespace
+
 offset_index::coarse_index_t offset_index::build_coarse_index(
   uint64_t step_size, std::string_view index_path) const {
     vlog(
@@ -257,42 +297,82 @@ offset_index::coarse_index_t offset_index::build_coarse_index(
       _kaf_index.copy());
     std::array<int64_t, buffer_depth> kafka_row{};
 
-    coarse_index_t index;
-    auto populate_index = [step_size, &index, index_path](
+    coarse_index_builder builder(step_size, index_path);
+    auto populate_index = [&builder](
                             const auto& file_offsets,
-                            const auto& kafka_offsets,
-                            auto& span_start,
-                            auto& span_end) {
+                            const auto& kafka_offsets) {
         for (auto it = file_offsets.cbegin(), kit = kafka_offsets.cbegin();
              it != file_offsets.cend() && kit != kafka_offsets.cend();
              ++it, ++kit) {
-            span_end = *it;
-            auto delta = span_end - span_start + 1;
-            if (span_end > span_start && delta >= step_size) {
-                vlog(
-                  cst_log.trace,
-                  "{}: adding entry to coarse index, current file pos: {}, "
-                  "step size: {}, span size: {}",
-                  index_path,
-                  span_end,
-                  step_size,
-                  delta);
-                index[kafka::offset{*kit}] = span_end;
-                span_start = span_end + 1;
-            }
+            builder.add(kafka::offset{*kit}, *it);
         }
     };
 
-    size_t start{0};
-    size_t end{0};
     while (file_dec.read(file_row) && kaf_dec.read(kafka_row)) {
-        populate_index(file_row, kafka_row, start, end);
+        populate_index(file_row, kafka_row);
         file_row = {};
         kafka_row = {};
     }
 
-    populate_index(_file_offsets, _kaf_offsets, start, end);
-    return index;
+    populate_index(_file_offsets, _kaf_offsets);
+    return std::move(builder).release();
+}
+
+fragmented_vector<offset_index::entry> offset_index::entries() const {
+    decoder_t rp_dec(
+      _rp_index.get_initial_value(),
+      _rp_index.get_row_count(),
+      _rp_index.copy());
+    decoder_t kaf_dec(
+      _kaf_index.get_initial_value(),
+      _kaf_index.get_row_count(),
+      _kaf_index.copy());
+    foffset_decoder_t file_dec(
+      _file_index.get_initial_value(),
+      _file_index.get_row_count(),
+      _file_index.copy(),
+      delta_delta_t(_min_file_pos_step));
+    // Version 1 indices have no timestamps
+    std::optional<decoder_t> time_dec;
+    if (has_timestamps()) {
+        time_dec.emplace(
+          _time_index.get_initial_value(),
+          _time_index.get_row_count(),
+          _time_index.copy());
+    }
+
+    fragmented_vector<entry> result;
+    std::array<int64_t, buffer_depth> rp_row{};
+    std::array<int64_t, buffer_depth> kaf_row{};
+    std::array<int64_t, buffer_depth> file_row{};
+    std::array<int64_t, buffer_depth> time_row{};
+    while (rp_dec.read(rp_row) && kaf_dec.read(kaf_row)
+           && file_dec.read(file_row)
+           && (!time_dec || time_dec->read(time_row))) {
+        for (size_t i = 0; i < buffer_depth; ++i) {
+            result.push_back(entry{
+              .rp_offset = model::offset(rp_row.at(i)),
+              .kaf_offset = kafka::offset(kaf_row.at(i)),
+              .file_pos = file_row.at(i),
+              .timestamp = time_dec ? model::timestamp(time_row.at(i))
+                                    : model::timestamp::missing(),
+            });
+        }
+        rp_row = {};
+        kaf_row = {};
+        file_row = {};
+        time_row = {};
+    }
+    for (size_t i = 0; i < (_pos & index_mask); ++i) {
+        result.push_back(entry{
+          .rp_offset = model::offset(_rp_offsets.at(i)),
+          .kaf_offset = kafka::offset(_kaf_offsets.at(i)),
+          .file_pos = _file_offsets.at(i),
+          .timestamp = has_timestamps() ? model::timestamp(_time_offsets.at(i))
+                                        : model::timestamp::missing(),
+        });
+    }
+    return result;
 }
 
 struct offset_index_header
@@ -407,6 +487,212 @@ offset_index::_find_under(deltafor_decoder<int64_t> decoder, int64_t offset) {
     return candidate;
 }
 
+namespace {
+constexpr uint32_t framed_index_has_timestamps = 1;
+
+void write_row(iobuf& out, const offset_index::entry& e) {
+    serde::write(out, e.rp_offset());
+    serde::write(out, e.kaf_offset());
+    serde::write(out, e.file_pos);
+    serde::write(out, e.timestamp.value());
+}
+
+offset_index::entry read_row(iobuf_const_parser& in) {
+    auto read_int64 = [&in] {
+        return ss::le_to_cpu(in.consume_type<int64_t>());
+    };
+    offset_index::entry e{};
+    e.rp_offset = model::offset(read_int64());
+    e.kaf_offset = kafka::offset(read_int64());
+    e.file_pos = read_int64();
+    e.timestamp = model::timestamp(read_int64());
+    return e;
+}
+
+std::vector<offset_index::entry> read_rows(const iobuf& buf) {
+    iobuf_const_parser in(buf);
+    std::vector<offset_index::entry> rows;
+    rows.reserve(buf.size_bytes() / framed_offset_index::row_size);
+    while (in.bytes_left() >= framed_offset_index::row_size) {
+        rows.push_back(read_row(in));
+    }
+    return rows;
+}
+
+/// Last row whose key is strictly lower than the upper bound, assuming
+/// the keys are sorted.
+template<typename Rows, typename Key>
+auto find_under(const Rows& rows, Key&& key) {
+    auto it = std::partition_point(rows.begin(), rows.end(), key);
+    return it == rows.begin() ? rows.end() : std::prev(it);
+}
+
+std::optional<offset_index::find_result>
+to_find_result(const std::vector<offset_index::entry>& rows, auto it) {
+    if (it == rows.end()) {
+        return std::nullopt;
+    }
+    return offset_index::find_result{
+      .rp_offset = it->rp_offset,
+      .kaf_offset = it->kaf_offset,
+      .file_pos = it->file_pos,
+    };
+}
+} // namespace
+
+std::pair<framed_offset_index, iobuf>
+framed_offset_index::encode(const offset_index& ix, uint32_t frame_rows) {
+    vassert(frame_rows > 0, "Framed offset index needs non empty frames");
+    auto entries = ix.entries();
+
+    framed_offset_index framed;
+    framed._row_count = entries.size();
+    framed._frame_rows = frame_rows;
+    framed._has_timestamps = ix.has_timestamps();
+    for (size_t i = 0; i < entries.size(); i += frame_rows) {
+        framed._directory.push_back(entries[i]);
+    }
+
+    iobuf out;
+    serde::write(out, magic);
+    serde::write(
+      out, framed._has_timestamps ? framed_index_has_timestamps : uint32_t{0});
+    serde::write(out, framed._row_count);
+    serde::write(out, frame_rows);
+    serde::write(out, uint32_t{0}); // reserved
+    serde::write(out, ix.min_file_pos_step());
+    for (const auto& e : framed._directory) {
+        write_row(out, e);
+    }
+    for (const auto& e : entries) {
+        write_row(out, e);
+    }
+    return {std::move(framed), std::move(out)};
+}
+
+bool framed_offset_index::is_framed(const iobuf& head) {
+    if (head.size_bytes() < header_size) {
+        return false;
+    }
+    iobuf_const_parser in(head);
+    return ss::le_to_cpu(in.consume_type<uint32_t>()) == magic;
+}
+
+ss::future<std::pair<framed_offset_index, offset_index::coarse_index_t>>
+framed_offset_index::read(
+  iobuf head,
+  ss::input_stream<char>& in,
+  uint64_t step_size,
+  std::string_view index_path) {
+    if (!is_framed(head)) {
+        throw std::runtime_error(
+          fmt::format("{}: not a framed offset index", index_path));
+    }
+    iobuf_const_parser hp(head);
+    hp.skip(sizeof(magic));
+    framed_offset_index framed;
+    const auto flags = ss::le_to_cpu(hp.consume_type<uint32_t>());
+    framed._has_timestamps = (flags & framed_index_has_timestamps) != 0;
+    framed._row_count = ss::le_to_cpu(hp.consume_type<uint64_t>());
+    framed._frame_rows = ss::le_to_cpu(hp.consume_type<uint32_t>());
+    hp.skip(sizeof(uint32_t)); // reserved
+    const auto min_file_pos_step = ss::le_to_cpu(hp.consume_type<int64_t>());
+    if (framed._frame_rows == 0) {
+        throw std::runtime_error(
+          fmt::format("{}: framed offset index has empty frames", index_path));
+    }
+    vassert(
+      step_size > static_cast<uint64_t>(min_file_pos_step),
+      "{}: step size {} cannot be less than or equal to index step size {}",
+      index_path,
+      step_size,
+      min_file_pos_step);
+
+    auto read_exactly = [&in, index_path](size_t n) -> ss::future<iobuf> {
+        auto tmp = co_await in.read_exactly(n);
+        if (tmp.size() != n) {
+            throw std::runtime_error(fmt::format(
+              "{}: framed offset index is truncated, expected {} bytes, got "
+              "{}",
+              index_path,
+              n,
+              tmp.size()));
+        }
+        iobuf buf;
+        buf.append(std::move(tmp));
+        co_return buf;
+    };
+
+    const auto frame_count = (framed._row_count + framed._frame_rows - 1)
+                             / framed._frame_rows;
+    auto directory = co_await read_exactly(frame_count * row_size);
+    framed._directory = read_rows(directory);
+
+    coarse_index_builder builder(step_size, index_path);
+    for (uint64_t i = 0; i < framed._row_count; i += framed._frame_rows) {
+        auto rows = std::min<uint64_t>(
+          framed._frame_rows, framed._row_count - i);
+        auto frame = co_await read_exactly(rows * row_size);
+        for (const auto& e : read_rows(frame)) {
+            builder.add(e.kaf_offset, e.file_pos);
+        }
+    }
+    co_return std::make_pair(std::move(framed), std::move(builder).release());
+}
+
+framed_offset_index::frame_ref
+framed_offset_index::get_frame(size_t frame) const {
+    const auto first_row = frame * _frame_rows;
+    const auto rows = std::min<uint64_t>(_frame_rows, _row_count - first_row);
+    return frame_ref{
+      .file_pos = header_size + (_directory.size() + first_row) * row_size,
+      .size_bytes = rows * row_size,
+    };
+}
+
+std::optional<framed_offset_index::frame_ref>
+framed_offset_index::find_kaf_offset_frame(kafka::offset upper_bound) const {
+    auto it = find_under(_directory, [upper_bound](const auto& e) {
+        return e.kaf_offset < upper_bound;
+    });
+    if (it == _directory.end()) {
+        return std::nullopt;
+    }
+    return get_frame(std::distance(_directory.begin(), it));
+}
+
+std::optional<framed_offset_index::frame_ref>
+framed_offset_index::find_timestamp_frame(model::timestamp upper_bound) const {
+    if (!_has_timestamps) {
+        return std::nullopt;
+    }
+    auto it = find_under(_directory, [upper_bound](const auto& e) {
+        return e.timestamp < upper_bound;
+    });
+    if (it == _directory.end()) {
+        return std::nullopt;
+    }
+    return get_frame(std::distance(_directory.begin(), it));
+}
+
+std::optional<offset_index::find_result> framed_offset_index::find_kaf_offset(
+  const iobuf& frame, kafka::offset upper_bound) {
+    auto rows = read_rows(frame);
+    auto it = find_under(rows, [upper_bound](const auto& e) {
+        return e.kaf_offset < upper_bound;
+    });
+    return to_find_result(rows, it);
+}
+
+std::optional<offset_index::find_result> framed_offset_index::find_timestamp(
+  const iobuf& frame, model::timestamp upper_bound) {
+    auto rows = read_rows(frame);
+    auto it = find_under(rows, [upper_bound](const auto& e) {
+        return e.timestamp < upper_bound;
+    });
+    return to_find_result(rows, it);
+}
+
 remote_segment_index_builder::remote_segment_index_builder(
   const model::ntp& ntp,
   offset_index& ix,
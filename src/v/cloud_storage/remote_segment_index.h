@@ -18,7 +18,9 @@
 #include "storage/parser.h"
 #include "units.h"
 #include "utils/delta_for.h"
+#include "utils/fragmented_vector.h"
 
+#include <seastar/core/iostream.hh>
 #include <seastar/util/log.hh>
 
 #include <absl/container/btree_map.h>
@@ -104,6 +106,23 @@ public:
     coarse_index_t
     build_coarse_index(uint64_t step_size, std::string_view index_path) const;
 
+    struct entry {
+        model::offset rp_offset;
+        kafka::offset kaf_offset;
+        int64_t file_pos;
+        model::timestamp timestamp;
+    };
+
+    /// Decode all entries of the index, in order
+    fragmented_vector<entry> entries() const;
+
+    /// False for indices that were built before timestamps were indexed
+    bool has_timestamps() const {
+        return _initial_time != model::timestamp::missing();
+    }
+
+    int64_t min_file_pos_step() const { return _min_file_pos_step; }
+
     /// Serialize offset_index
     iobuf to_iobuf();
 
@@ -179,6 +198,86 @@ private:
     friend class offset_index_accessor;
 };
 
+/// Layout of an offset_index that can be searched without decoding it.
+///
+/// The entries are stored as fixed size rows, grouped in frames of
+/// frame_rows rows.  The frames are preceded by a fixed size header and by a
+/// directory that contains the first row of every frame.  A lookup binary
+/// searches the directory, then reads and binary searches the only frame
+/// that may contain the result.  An instance of the class holds the header
+/// and the directory, the frames stay in the file.
+///
+/// All integers are encoded in little endian:
+///   header:    magic, flags, row count, frame rows, min file pos step
+///   directory: first row of every frame
+///   frames:    rows of rp offset, kafka offset, file pos and timestamp
+class framed_offset_index {
+public:
+    static constexpr uint32_t magic = 0x4649524f; // "ORIF"
+    static constexpr size_t header_size = 32;
+    static constexpr size_t row_size = 4 * sizeof(int64_t);
+    static constexpr uint32_t default_frame_rows = 256;
+
+    /// Location of a frame in the encoded index
+    struct frame_ref {
+        uint64_t file_pos;
+        size_t size_bytes;
+    };
+
+    /// Encode the index.  Returns the directory of the encoded index along
+    /// with the encoded index.
+    static std::pair<framed_offset_index, iobuf>
+    encode(const offset_index&, uint32_t frame_rows = default_frame_rows);
+
+    /// Returns true if the buffer holding the first header_size bytes of an
+    /// encoded index is a framed index
+    static bool is_framed(const iobuf& head);
+
+    /// Read the framed index, \p head contains its first header_size bytes
+    /// and \p in the rest of it.  The frames are only streamed through to
+    /// build the coarse index with the given step size, see
+    /// offset_index::build_coarse_index.
+    static ss::future<
+      std::pair<framed_offset_index, offset_index::coarse_index_t>>
+    read(
+      iobuf head,
+      ss::input_stream<char>& in,
+      uint64_t step_size,
+      std::string_view index_path);
+
+    /// Frame that contains the entry which is strictly lower than the upper
+    /// bound, if any: the same entry offset_index::find_kaf_offset would
+    /// return.
+    std::optional<frame_ref>
+    find_kaf_offset_frame(kafka::offset upper_bound) const;
+
+    /// Same as find_kaf_offset_frame, for offset_index::find_timestamp
+    std::optional<frame_ref>
+    find_timestamp_frame(model::timestamp upper_bound) const;
+
+    /// Search the frame returned by find_kaf_offset_frame
+    static std::optional<offset_index::find_result>
+    find_kaf_offset(const iobuf& frame, kafka::offset upper_bound);
+
+    /// Search the frame returned by find_timestamp_frame
+    static std::optional<offset_index::find_result>
+    find_timestamp(const iobuf& frame, model::timestamp upper_bound);
+
+    size_t estimate_memory_use() const {
+        return _directory.size() * sizeof(offset_index::entry);
+    }
+
+private:
+    framed_offset_index() = default;
+
+    frame_ref get_frame(size_t frame) const;
+
+    uint64_t _row_count{0};
+    uint32_t _frame_rows{default_frame_rows};
+    bool _has_timestamps{false};
+    std::vector<offset_index::entry> _directory;
+};
+
 struct segment_record_stats {
     // Offset of the first record in the segment
     model::offset base_rp_offset;
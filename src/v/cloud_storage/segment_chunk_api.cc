@@ -199,6 +199,36 @@ ss::future<segment_chunk::handle_t> segment_chunks::hydrate_chunk(
     co_return handle;
 }
 
+void segment_chunks::read_ahead(
+  chunk_start_offset_t current, chunk_start_offset_t last, uint16_t n) {
+    vassert(_started, "chunk API is not started");
+    if (_gate.is_closed()) {
+        return;
+    }
+
+    auto it = _chunks.upper_bound(current);
+    for (uint16_t i = 0; i < n && it != _chunks.end() && it->first <= last;
+         ++i, ++it) {
+        if (it->second.current_state != chunk_state::not_available) {
+            continue;
+        }
+        vlog(_ctxlog.debug, "reading ahead chunk starting at {}", it->first);
+        ssx::spawn_with_gate(_gate, [this, chunk_start = it->first] {
+            // every chunk read ahead is a separate download, so the next one
+            // is not delayed by the prefetch of the following chunks
+            return hydrate_chunk(chunk_start, 0)
+              .discard_result()
+              .handle_exception([this, chunk_start](std::exception_ptr e) {
+                  vlog(
+                    _ctxlog.debug,
+                    "failed to read ahead chunk starting at {}: {}",
+                    chunk_start,
+                    e);
+              });
+        });
+    }
+}
+
 ss::future<> segment_chunks::trim_chunk_files() {
     vassert(_started, "chunk API is not started");
 
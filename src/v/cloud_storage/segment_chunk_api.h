@@ -64,6 +64,12 @@ public:
     void mark_acquired_and_update_stats(
       chunk_start_offset_t first, chunk_start_offset_t last);
 
+    // Starts the hydration of up to n chunks after current in the background,
+    // without going past last. Chunks which are hydrated or being downloaded
+    // are skipped.
+    void read_ahead(
+      chunk_start_offset_t current, chunk_start_offset_t last, uint16_t n);
+
     // Returns reference to metadata for chunk for given chunk id
     segment_chunk& get(chunk_start_offset_t);
 
@@ -12,6 +12,7 @@
 #include "cloud_storage/segment_chunk_data_source.h"
 
 #include "cloud_storage/remote_segment.h"
+#include "config/configuration.h"
 
 namespace cloud_storage {
 
@@ -73,6 +74,7 @@ ss::future<ss::temporary_buffer<char>> chunk_data_source_impl::get() {
 
 ss::future<>
 chunk_data_source_impl::load_chunk_handle(chunk_start_offset_t chunk_start) {
+    auto measurement = _segment.get_ts_probe().chunk_wait_latency();
     try {
         _current_data_file = co_await _chunks.hydrate_chunk(
           chunk_start, _prefetch_override);
@@ -113,6 +115,14 @@ ss::future<> chunk_data_source_impl::load_stream_for_chunk(
     _chunks.mark_acquired_and_update_stats(
       _current_chunk_start, _last_chunk_start);
 
+    // The reader moved on to the next chunk, it consumes the segment
+    // sequentially and will need the following chunks soon.
+    const auto read_ahead
+      = config::shard_local_cfg().cloud_storage_chunk_read_ahead();
+    if (_current_chunk_start != _first_chunk_start && read_ahead > 0) {
+        _chunks.read_ahead(_current_chunk_start, _last_chunk_start, read_ahead);
+    }
+
     if (_current_stream) {
         co_await _current_stream->close();
     }
@@ -15,9 +15,13 @@
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/timestamp.h"
+#include "serde/async.h"
 #include "serde/serde.h"
 #include "utils/delta_for.h"
 
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
 #include <bitset>
 #include <exception>
 #include <functional>
@@ -710,16 +714,7 @@ public:
         // manually as size,[(key,value)...]
         auto field_writer = [&out]<typename FieldType>(FieldType& f) {
             if constexpr (std::same_as<FieldType, hint_map_t>) {
-                if (unlikely(
-                      f.size()
-                      > std::numeric_limits<serde::serde_size_t>::max())) {
-                    throw serde::serde_exception(fmt_with_ctx(
-                      ssx::sformat,
-                      "serde: {} size {} exceeds serde_size_t",
-                      serde::type_str<column_store>(),
-                      f.size()));
-                }
-                serde::write(out, static_cast<serde::serde_size_t>(f.size()));
+                write_hints_size(out, f);
                 for (auto& [k, v] : f) {
                     serde::write(out, k);
                     serde::write(out, std::move(v));
@@ -736,19 +731,9 @@ public:
         // hint_map_t (absl::btree_map) is not serde-enabled, read it as
         // size,[(key,value)...]
         auto field_reader = [&]<typename FieldType>(FieldType& f) {
-            if (h._bytes_left_limit == in.bytes_left()) {
+            if (!has_field<FieldType>(in, h)) {
                 return false;
             }
-            if (unlikely(in.bytes_left() < h._bytes_left_limit)) {
-                throw serde::serde_exception(fmt_with_ctx(
-                  ssx::sformat,
-                  "field spill over in {}, field type {}: envelope_end={}, "
-                  "in.bytes_left()={}",
-                  serde::type_str<column_store>(),
-                  serde::type_str<FieldType>(),
-                  h._bytes_left_limit,
-                  in.bytes_left()));
-            }
             if constexpr (std::same_as<hint_map_t, FieldType>) {
                 const auto size = serde::read_nested<serde::serde_size_t>(
                   in, h._bytes_left_limit);
@@ -771,6 +756,47 @@ public:
           member_fields());
     }
 
+    // Same format as serde_write, the columns are small (a few frames of
+    // compressed data each) but there is a hint for every few segments, so
+    // the hints are written with yield points.
+    ss::future<> serde_async_write(iobuf& out) {
+        std::apply(
+          [&out](auto&... col) { (serde::write(out, std::move(col)), ...); },
+          columns());
+        write_hints_size(out, _hints);
+        for (auto& [k, v] : _hints) {
+            serde::write(out, k);
+            serde::write(out, std::move(v));
+            co_await ss::coroutine::maybe_yield();
+        }
+    }
+
+    ss::future<> serde_async_read(iobuf_parser& in, serde::header const h) {
+        auto column_reader = [&]<typename FieldType>(FieldType& f) {
+            if (!has_field<FieldType>(in, h)) {
+                return false;
+            }
+            f = serde::read_nested<FieldType>(in, h._bytes_left_limit);
+            return true;
+        };
+        const bool all_columns = std::apply(
+          [&](auto&... col) { return (column_reader(col) && ...); },
+          columns());
+        if (!all_columns || !has_field<hint_map_t>(in, h)) {
+            co_return;
+        }
+        const auto size = serde::read_nested<serde::serde_size_t>(
+          in, h._bytes_left_limit);
+        for (auto i = 0U; i < size; ++i) {
+            auto key = serde::read_nested<typename hint_map_t::key_type>(
+              in, h._bytes_left_limit);
+            auto value = serde::read_nested<typename hint_map_t::mapped_type>(
+              in, h._bytes_left_limit);
+            _hints.emplace(std::move(key), std::move(value));
+            co_await ss::coroutine::maybe_yield();
+        }
+    }
+
     auto unsafe_alias() const -> column_store {
         auto tmp = column_store{};
         details::tuple_map(
@@ -782,6 +808,38 @@ public:
     }
 
 private:
+    static void write_hints_size(iobuf& out, const hint_map_t& hints) {
+        if (unlikely(
+              hints.size() > std::numeric_limits<serde::serde_size_t>::max())) {
+            throw serde::serde_exception(fmt_with_ctx(
+              ssx::sformat,
+              "serde: {} size {} exceeds serde_size_t",
+              serde::type_str<column_store>(),
+              hints.size()));
+        }
+        serde::write(out, static_cast<serde::serde_size_t>(hints.size()));
+    }
+
+    // Returns false if the envelope ends before the field. The fields that
+    // were added by later versions keep their default value.
+    template<typename FieldType>
+    static bool has_field(iobuf_parser& in, serde::header const& h) {
+        if (h._bytes_left_limit == in.bytes_left()) {
+            return false;
+        }
+        if (unlikely(in.bytes_left() < h._bytes_left_limit)) {
+            throw serde::serde_exception(fmt_with_ctx(
+              ssx::sformat,
+              "field spill over in {}, field type {}: envelope_end={}, "
+              "in.bytes_left()={}",
+              serde::type_str<column_store>(),
+              serde::type_str<FieldType>(),
+              h._bytes_left_limit,
+              in.bytes_left()));
+        }
+        return true;
+    }
+
     gauge_col_t _is_compacted{};
     gauge_col_t _size_bytes{};
     counter_col_t _base_offset{};
@@ -1091,6 +1149,45 @@ public:
         *this = serde::from_iobuf<impl>(std::move(in));
     }
 
+    ss::future<> serde_async_write(iobuf& out) {
+        flush_write_buffer();
+        co_await serde::write_async(out, std::exchange(_col, {}));
+    }
+
+    ss::future<> serde_async_read(iobuf_parser& in, serde::header const h) {
+        if (h._bytes_left_limit == in.bytes_left()) {
+            co_return;
+        }
+        if (unlikely(in.bytes_left() < h._bytes_left_limit)) {
+            throw serde::serde_exception(fmt_with_ctx(
+              ssx::sformat,
+              "field spill over in {}, field type {}: envelope_end={}, "
+              "in.bytes_left()={}",
+              serde::type_str<segment_meta_cstore::impl>(),
+              serde::type_str<column_store>(),
+              h._bytes_left_limit,
+              in.bytes_left()));
+        }
+        _write_buffer.clear();
+        _col = co_await serde::read_async_nested<column_store>(
+          in, h._bytes_left_limit);
+    }
+
+    ss::future<iobuf> to_iobuf_async() const {
+        // the alias is taken before the first yield point
+        flush_write_buffer();
+        auto tmp = impl{};
+        tmp._col = _col.unsafe_alias();
+        iobuf out;
+        co_await serde::write_async(out, std::move(tmp));
+        co_return out;
+    }
+
+    ss::future<> from_iobuf_async(iobuf in) {
+        iobuf_parser parser(std::move(in));
+        *this = co_await serde::read_async<impl>(parser);
+    }
+
     void flush_write_buffer() const {
         if (_write_buffer.empty()) {
             return;
@@ -1189,6 +1286,14 @@ void segment_meta_cstore::from_iobuf(iobuf in) {
 
 iobuf segment_meta_cstore::to_iobuf() const { return _impl->to_iobuf(); }
 
+ss::future<> segment_meta_cstore::from_iobuf_async(iobuf in) {
+    return _impl->from_iobuf_async(std::move(in));
+}
+
+ss::future<iobuf> segment_meta_cstore::to_iobuf_async() const {
+    return _impl->to_iobuf_async();
+}
+
 segment_meta_cstore::append_tx::append_tx(
   segment_meta_cstore& cs, const segment_meta& meta)
   : _meta(meta)
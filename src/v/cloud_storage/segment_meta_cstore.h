@@ -17,11 +17,13 @@
 #include <boost/iterator/iterator_categories.hpp>
 #include <boost/iterator/iterator_facade.hpp>
 
+#include <algorithm>
 #include <functional>
 #include <iterator>
 #include <memory>
 #include <tuple>
 #include <variant>
+#include <vector>
 
 namespace cloud_storage {
 
@@ -555,6 +557,7 @@ class segment_meta_column_impl
             // this target the constructor that will share the underlying buffer
             _frames.emplace_back(share_frame, *frame_iterator);
         }
+        rebuild_skip_index();
     }
 
     // crtp helper
@@ -578,9 +581,11 @@ public:
 
     void append(value_t value) {
         if (_frames.empty() || _frames.back().size() == max_frame_size) {
+            _skip_index.reserve(_skip_index.size() + 1);
             _frames.push_back({});
         }
         _frames.back().append(value);
+        update_skip_index(value);
     }
 
     /// Return frame that contains value with index
@@ -631,6 +636,8 @@ public:
             } else {
                 self._frames.splice(
                   self._frames.end(), std::get<frame_list_t>(inner));
+                // doesn't allocate, the space is reserved by append_tx
+                self.update_skip_index(*self._frames.back().last_value());
             }
         }
     };
@@ -652,12 +659,15 @@ public:
     std::optional<column_tx_t> append_tx(value_t value) {
         std::optional<column_tx_t> tx;
         if (_frames.empty() || _frames.back().size() == max_frame_size) {
+            _skip_index.reserve(_skip_index.size() + 1);
             frame_t tmp{};
             tmp.append(value);
             tx.emplace(std::move(tmp), *this);
             return tx;
         }
         auto inner = _frames.back().append_tx(value);
+        // the value is added to the write buffer of the frame right away
+        update_skip_index(value);
         if (!inner.has_value()) {
             // transactional op is already committed
             return tx;
@@ -667,15 +677,11 @@ public:
     }
 
     const_iterator at_index(size_t index) const {
-        auto inner = index;
-        for (auto it = _frames.begin(); it != _frames.end(); ++it) {
-            if (it->size() <= inner) {
-                inner -= it->size();
-            } else {
-                return const_iterator(it, _frames.end(), inner, index);
-            }
+        auto e = find_skip_entry_by_index(index);
+        if (e == _skip_index.end()) {
+            return end();
         }
-        return end();
+        return const_iterator(e->frame, _frames.end(), index - e->index, index);
     }
 
     /// Get element by index, use 'hint' to speedup the operation.
@@ -683,26 +689,19 @@ public:
     /// The 'hint' has to correspond to any index lower or equal to
     /// 'index'. The 'hint' values has to be stored externally.
     const_iterator at_index(size_t index, const hint_t& hint) const {
-        auto inner = index;
-        for (auto it = _frames.begin(); it != _frames.end(); ++it) {
-            if (it->size() <= inner) {
-                inner -= it->size();
-            } else {
-                return const_iterator(it, _frames.end(), inner, hint, index);
-            }
+        auto e = find_skip_entry_by_index(index);
+        if (e == _skip_index.end()) {
+            return end();
         }
-        return end();
+        return const_iterator(
+          e->frame, _frames.end(), index - e->index, hint, index);
     }
 
     size_t size() const {
-        if (_frames.empty()) {
+        if (_skip_index.empty()) {
             return 0;
         }
-        size_t total = 0;
-        for (const auto& f : _frames) {
-            total += f.size();
-        }
-        return total;
+        return _skip_index.back().index + _skip_index.back().frame->size();
     }
 
     bool empty() const {
@@ -716,7 +715,8 @@ public:
         for (const auto& p : _frames) {
             total += p.mem_use();
         }
-        return sizeof(*this) + total;
+        return sizeof(*this) + total
+               + _skip_index.capacity() * sizeof(skip_entry);
     }
 
     const_iterator begin() const { return const_iterator(_frames); }
@@ -744,6 +744,26 @@ public:
 
     bool contains(value_t value) const { return find(value) != end(); }
 
+    /// Return index of the first element of the first frame whose largest
+    /// value satisfies the predicate, or size() if there is no such frame.
+    /// Only the skip index is scanned, a frame is decoded only the first time
+    /// its largest value is needed.
+    size_t find_frame_by_max(std::predicate<value_t> auto pred) const {
+        for (const auto& e : _skip_index) {
+            if (!e.max.has_value()) {
+                auto max = e.first;
+                for (auto it = e.frame->begin(); it != e.frame->end(); ++it) {
+                    max = std::max(max, *it);
+                }
+                e.max = max;
+            }
+            if (pred(*e.max)) {
+                return e.index;
+            }
+        }
+        return size();
+    }
+
     /// Prefix truncate column. Value at the position 'ix_exclusive' will
     /// become a new start of the column.
     void prefix_truncate_ix(uint32_t ix_exclusive) {
@@ -756,6 +776,7 @@ public:
                 break;
             }
         }
+        rebuild_skip_index();
     }
 
     void serde_write(iobuf& out) {
@@ -795,6 +816,7 @@ public:
             _frames.push_back(
               serde::read_nested<frame_t>(in, h._bytes_left_limit));
         }
+        rebuild_skip_index();
     }
 
     /// Returns a column that shares the underlying iobuf
@@ -805,6 +827,7 @@ public:
         for (auto& e : _frames) {
             tmp._frames.push_back(e.unsafe_alias());
         }
+        tmp.rebuild_skip_index();
         return tmp;
     }
 
@@ -820,7 +843,77 @@ protected:
           });
     }
 
+    using frame_iterator_t = typename std::list<frame_t>::const_iterator;
+
+    /// Entry of the skip index, one per non-empty frame
+    struct skip_entry {
+        frame_iterator_t frame;
+        /// Index of the first element of the frame in the column
+        size_t index;
+        /// First element of the frame
+        value_t first;
+        /// Largest element of the frame, computed when it's first needed
+        mutable std::optional<value_t> max;
+    };
+    using skip_index_t = std::vector<skip_entry>;
+
+    /// Find the entry of the frame that contains the element with the index
+    typename skip_index_t::const_iterator
+    find_skip_entry_by_index(size_t index) const {
+        auto it = std::partition_point(
+          _skip_index.begin(), _skip_index.end(), [index](const auto& e) {
+              return e.index <= index;
+          });
+        if (it == _skip_index.begin()) {
+            return _skip_index.end();
+        }
+        --it;
+        if (index - it->index >= it->frame->size()) {
+            return _skip_index.end();
+        }
+        return it;
+    }
+
+    /// Account for the value appended to the last frame. Doesn't allocate if
+    /// the space for a new entry was reserved before the frame was added.
+    void update_skip_index(value_t value) {
+        auto last = std::prev(_frames.cend());
+        if (_skip_index.empty() || _skip_index.back().frame != last) {
+            // the new frame is not indexed yet, size() is the number of
+            // elements before it
+            _skip_index.push_back(skip_entry{
+              .frame = last,
+              .index = size(),
+              .first = value,
+              .max = value,
+            });
+        } else if (auto& max = _skip_index.back().max; max.has_value()) {
+            max = std::max(*max, value);
+        }
+    }
+
+    void rebuild_skip_index() {
+        _skip_index.clear();
+        size_t index = 0;
+        for (auto it = _frames.cbegin(); it != _frames.cend(); ++it) {
+            if (it->size() == 0) {
+                continue;
+            }
+            _skip_index.push_back(skip_entry{
+              .frame = it,
+              .index = index,
+              .first = *it->begin(),
+              .max = std::nullopt,
+            });
+            index += it->size();
+        }
+    }
+
     std::list<frame_t> _frames;
+    /// Sparse index over the frames, kept uncompressed so that search
+    /// operations can skip to the right frame without decoding the frames
+    /// before it.
+    skip_index_t _skip_index;
 };
 
 /// Segment metadata column.
@@ -859,7 +952,8 @@ public:
 
 /// Segment metadata column for monotonic sequences.
 ///
-/// Optimized for quick append/at/find operations.
+/// Optimized for quick append/at/find operations. Search operations use the
+/// skip index to find the frame.
 /// Find/lower_bound/upper_bound operations are complited within
 /// single digit microsecond intervals even with millions of elements
 /// in the column. The actual decoding is only performed for a single frame.
@@ -882,19 +976,26 @@ public:
 
     const_iterator pred_search(
       value_t value, std::regular_invocable<value_t, value_t> auto pred) const {
-        auto it = this->_frames.begin();
-        size_t index = 0;
-        for (; it != this->_frames.end(); ++it) {
-            // The code is only used with equal/greater/greater_equal
-            // predicates to implement find/lower_bound/upper_bound. Because
-            // of that we can hardcode the '>=' operation here.
-            if (it->last_value().has_value() && *it->last_value() >= value) {
-                break;
+        const auto& skip_index = this->_skip_index;
+        // The code is only used with equal/greater/greater_equal
+        // predicates to implement find/lower_bound/upper_bound. Because
+        // of that we can hardcode the '>=' operation here. The frames before
+        // the last one that starts below the value only contain smaller
+        // values.
+        auto it = std::partition_point(
+          skip_index.begin(), skip_index.end(), [value](const auto& e) {
+              return e.first < value;
+          });
+        if (it != skip_index.begin()) {
+            --it;
+            if (*it->frame->last_value() < value) {
+                // the next frame starts at or above the value
+                ++it;
             }
-            index += it->size();
         }
-        if (it != this->_frames.end()) {
-            auto start = const_iterator(it, this->_frames.end(), 0, index);
+        if (it != skip_index.end()) {
+            auto start = const_iterator(
+              it->frame, this->_frames.end(), 0, it->index);
             for (; start != this->end(); ++start) {
                 if (pred(*start, value)) {
                     return start;
@@ -1029,6 +1130,15 @@ public:
 
     iobuf to_iobuf() const;
 
+    /// Same as from_iobuf, yields while decoding. The store is only updated
+    /// once the whole buffer is decoded.
+    ss::future<> from_iobuf_async(iobuf in);
+
+    /// Same as to_iobuf, yields while encoding. The content of the store is
+    /// captured before the first yield point, later updates are not part of
+    /// the result.
+    ss::future<iobuf> to_iobuf_async() const;
+
     void flush_write_buffer();
 
     // Access individual columns
@@ -357,6 +357,19 @@ public:
         remove_object(ssx::sformat("/{}", path().string()));
     }
 
+    size_t count_requests(
+      std::string_view method,
+      const cloud_storage::partition_manifest& manifest) const {
+        const auto path = manifest.get_manifest_path()().string();
+        return std::count_if(
+          get_requests().begin(),
+          get_requests().end(),
+          [&](const auto& req) {
+              return req.method == method
+                     && req.url.find(path) != ss::sstring::npos;
+          });
+    }
+
 private:
     void remove_json_stm_manifest(
       const cloud_storage::partition_manifest& manifest) {
@@ -574,6 +587,25 @@ FIXTURE_TEST(test_missing_spillover_manifest, bucket_view_fixture) {
       result.detected, flatten_partial_results(partial_results).detected);
 }
 
+FIXTURE_TEST(test_scrubbed_spillovers_are_skipped, bucket_view_fixture) {
+    init_view(
+      stm_manifest, {spillover_manifest_at_0, spillover_manifest_at_20});
+
+    // Resume the scrub at the end of the newest spillover manifest. It was
+    // scrubbed already, so its existence isn't checked again and it's only
+    // downloaded to check the boundary with the older manifest.
+    const auto& first_spill = get_spillover_manifests().at(0);
+    const auto& last_spill = get_spillover_manifests().at(1);
+    const auto result = run_detector(
+      archival::run_quota_t{100}, last_spill.get_last_offset());
+    BOOST_REQUIRE_EQUAL(result.status, cloud_storage::scrub_status::partial);
+    BOOST_REQUIRE(!result.detected.has_value());
+
+    BOOST_REQUIRE_EQUAL(count_requests("HEAD", last_spill), 0);
+    BOOST_REQUIRE_EQUAL(count_requests("HEAD", first_spill), 1);
+    BOOST_REQUIRE_EQUAL(count_requests("GET", first_spill), 1);
+}
+
 FIXTURE_TEST(test_missing_stm_manifest, bucket_view_fixture) {
     init_view(
       stm_manifest, {spillover_manifest_at_0, spillover_manifest_at_20});
@@ -19,6 +19,7 @@
 #include "model/metadata.h"
 #include "model/timeout_clock.h"
 #include "model/timestamp.h"
+#include "test_utils/async.h"
 #include "test_utils/fixture.h"
 #include "utils/retry_chain_node.h"
 
@@ -647,6 +648,47 @@ FIXTURE_TEST(
     BOOST_REQUIRE(removed == actual);
 }
 
+FIXTURE_TEST(
+  test_async_manifest_view_prefetch, async_manifest_view_fixture) {
+    generate_manifest_section(100);
+    generate_manifest_section(100);
+    generate_manifest_section(100);
+    listen();
+
+    auto& manifest_cache
+      = api.local().materialized().get_materialized_manifest_cache();
+    auto cursor = std::move(view.get_cursor(model::offset{0}).get().value());
+    BOOST_REQUIRE(
+      cursor->get_status()
+      == async_manifest_view_cursor_status::materialized_spillover);
+    auto [so, lo] = cursor
+                      ->with_manifest([](const partition_manifest& m) {
+                          return std::make_pair(
+                            m.get_start_offset().value(), m.get_last_offset());
+                      })
+                      .get();
+    auto next_key = std::make_tuple(manifest_ntp, model::next_offset(lo));
+    BOOST_REQUIRE(!manifest_cache.contains(next_key));
+
+    // The head of the manifest doesn't trigger the prefetch
+    cursor->maybe_prefetch_next(so);
+    ss::sleep(10ms).get();
+    BOOST_REQUIRE(!manifest_cache.contains(next_key));
+
+    // The tail does
+    cursor->maybe_prefetch_next(lo);
+    RPTEST_REQUIRE_EVENTUALLY(
+      5s, [&] { return manifest_cache.contains(next_key); });
+
+    BOOST_REQUIRE(cursor->next().get().value() == eof::no);
+    cursor
+      ->with_manifest([&](const partition_manifest& m) {
+          BOOST_REQUIRE_EQUAL(
+            m.get_start_offset().value(), model::next_offset(lo));
+      })
+      .get();
+}
+
 FIXTURE_TEST(test_async_manifest_view_evict, async_manifest_view_fixture) {
     for (int i = 0; i < 20; i++) {
         generate_manifest_section(100);
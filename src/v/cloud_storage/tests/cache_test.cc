@@ -13,7 +13,9 @@
 #include "cache_test_fixture.h"
 #include "cloud_storage/access_time_tracker.h"
 #include "cloud_storage/cache_service.h"
+#include "test_utils/async.h"
 #include "test_utils/fixture.h"
+#include "test_utils/scoped_config.h"
 #include "units.h"
 #include "utils/file_io.h"
 
@@ -429,6 +431,41 @@ SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_serializer_large) {
  * Validate that .part files and empty directories are deleted if found during
  * the startup walk of the cache.
  */
+SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_journal) {
+    access_time_tracker in;
+    in.add_timestamp("key0", make_ts(1653000000));
+    in.add_timestamp("key1", make_ts(1653000000));
+
+    // The snapshot contains every update so far
+    auto out = serde_roundtrip(in);
+    BOOST_REQUIRE_EQUAL(in.journal_size(), 0);
+
+    in.add_timestamp("key1", make_ts(1653000100));
+    in.add_timestamp("key2", make_ts(1653000200));
+    in.remove_timestamp("key0");
+    BOOST_REQUIRE_EQUAL(in.journal_size(), 3);
+    auto journal = in.take_journal_batch(4096).get();
+    BOOST_REQUIRE_EQUAL(journal.size_bytes(), 4096);
+    BOOST_REQUIRE_EQUAL(in.journal_size(), 0);
+
+    in.add_timestamp("key3", make_ts(1653000300));
+    journal.append(in.take_journal_batch(4096).get());
+
+    // A batch torn by a crash is ignored
+    in.add_timestamp("key4", make_ts(1653000400));
+    auto torn = in.take_journal_batch(4096).get();
+    journal.append(torn.share(0, 100));
+
+    auto in_stream = make_iobuf_input_stream(std::move(journal));
+    out.read_journal(in_stream).get();
+
+    BOOST_REQUIRE(!out.estimate_timestamp("key0").has_value());
+    BOOST_REQUIRE(out.estimate_timestamp("key1") == make_ts(1653000100));
+    BOOST_REQUIRE(out.estimate_timestamp("key2") == make_ts(1653000200));
+    BOOST_REQUIRE(out.estimate_timestamp("key3") == make_ts(1653000300));
+    BOOST_REQUIRE(!out.estimate_timestamp("key4").has_value());
+}
+
 FIXTURE_TEST(test_clean_up_on_start, cache_test_fixture) {
     // A temporary file, this should be deleted on startup
     put_into_cache(create_data_string('a', 1_KiB), KEY);
@@ -538,3 +575,57 @@ FIXTURE_TEST(test_log_segment_cleanup, cache_test_fixture) {
           return !std::filesystem::exists(path);
       }));
 }
+
+FIXTURE_TEST(test_reserve_space_from_shard_quota, cache_test_fixture) {
+    scoped_config cfg;
+    cfg.get("cloud_storage_cache_shard_quota_bytes")
+      .set_value(uint64_t{512_KiB});
+
+    {
+        // The first reservation goes to shard 0 and fills the lease in the
+        // background.
+        auto first = sharded_cache.local().reserve_space(1_KiB, 1).get();
+        RPTEST_REQUIRE_EVENTUALLY(
+          5s, [this] { return get_quota_bytes() == 512_KiB; });
+        BOOST_REQUIRE_EQUAL(get_reserved_bytes(), 1_KiB + 512_KiB);
+
+        // The lease is already accounted as reserved
+        auto second = sharded_cache.local().reserve_space(100_KiB, 1).get();
+        BOOST_REQUIRE_EQUAL(get_quota_bytes(), 412_KiB);
+        BOOST_REQUIRE_EQUAL(get_reserved_bytes(), 1_KiB + 512_KiB);
+    }
+    BOOST_REQUIRE_EQUAL(get_reserved_bytes(), 412_KiB);
+
+    // Does not fit next to the lease, which is recalled instead of trimming
+    auto big = sharded_cache.local().reserve_space(1_MiB + 200_KiB, 1).get();
+    BOOST_REQUIRE_EQUAL(get_quota_bytes(), 0);
+    BOOST_REQUIRE_EQUAL(get_reserved_bytes(), 1_MiB + 200_KiB);
+}
+
+FIXTURE_TEST(test_trim_evicts_objects_read_once_first, cache_test_fixture) {
+    scoped_config cfg;
+    cfg.get("cloud_storage_cache_check_interval")
+      .set_value(std::chrono::milliseconds{0});
+
+    put_into_cache(create_data_string('a', 500_KiB), KEY);
+    put_into_cache(create_data_string('b', 500_KiB), KEY2);
+
+    // KEY2 is read again...
+    for (int i = 0; i < 2; ++i) {
+        auto item = sharded_cache.local().get(KEY2).get();
+        BOOST_REQUIRE(item);
+        item->body.close().get();
+    }
+    // ...and KEY is read once, later
+    ss::sleep(1100ms).get();
+    auto item = sharded_cache.local().get(KEY).get();
+    BOOST_REQUIRE(item);
+    item->body.close().get();
+
+    // Only one of the objects fits.  Unlike LRU, the object read only once is
+    // evicted.
+    trim_cache(800_KiB);
+
+    BOOST_REQUIRE(!ss::file_exists((CACHE_DIR / KEY).native()).get());
+    BOOST_REQUIRE(ss::file_exists((CACHE_DIR / KEY2).native()).get());
+}
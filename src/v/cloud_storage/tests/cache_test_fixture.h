@@ -107,6 +107,12 @@ public:
         return sharded_cache.local().clean_up_at_start();
     }
 
+    uint64_t get_quota_bytes() { return sharded_cache.local()._quota_bytes; }
+
+    uint64_t get_reserved_bytes() {
+        return sharded_cache.local()._reserved_cache_size;
+    }
+
     void trim_cache(
       std::optional<uint64_t> size_limit_override = std::nullopt,
       std::optional<size_t> object_limit_override = std::nullopt) {
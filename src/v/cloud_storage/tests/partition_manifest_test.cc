@@ -879,6 +879,12 @@ SEASTAR_THREAD_TEST_CASE(test_manifest_serialization) {
 
     m.from_iobuf(m.to_iobuf());
     BOOST_REQUIRE(m == restored);
+
+    // the async variants produce and accept the same encoding
+    BOOST_REQUIRE(m.to_iobuf_async().get() == m.to_iobuf());
+    partition_manifest restored_async;
+    restored_async.from_iobuf_async(m.to_iobuf()).get();
+    BOOST_REQUIRE(m == restored_async);
 }
 
 SEASTAR_THREAD_TEST_CASE(test_manifest_replaced) {
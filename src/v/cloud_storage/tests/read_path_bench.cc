@@ -0,0 +1,54 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/tests/cloud_storage_fixture.h"
+#include "cloud_storage/tests/util.h"
+#include "vassert.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+// Tiered fetch throughput against the S3 imposter. Every iteration reads the
+// whole partition through a new remote_partition, so the first run of a test
+// measures cold reads (hydration from the imposter) and the following runs
+// measure reads served from the cache. The per-stage breakdown is available
+// in the cloud_storage:read_path metrics.
+struct read_path_bench : cloud_storage_fixture {
+    static constexpr int num_segments = 20;
+
+    void setup(int num_batches_per_segment) {
+        if (segments.empty()) {
+            segments = setup_s3_imposter(
+              *this, num_segments, num_batches_per_segment);
+        }
+    }
+
+    size_t run_scan(int num_batches_per_segment) {
+        setup(num_batches_per_segment);
+
+        perf_tests::start_measuring_time();
+        auto headers = scan_remote_partition(
+          *this, segments.front().base_offset, segments.back().max_offset);
+        perf_tests::stop_measuring_time();
+
+        const auto expected = static_cast<size_t>(
+          num_segments * num_batches_per_segment);
+        vassert(
+          headers.size() == expected,
+          "Unexpected number of batches read: {}",
+          headers.size());
+        return headers.size();
+    }
+
+    std::vector<in_memory_segment> segments;
+};
+
+PERF_TEST_F(read_path_bench, full_scan_10_batches) { return run_scan(10); }
+
+PERF_TEST_F(read_path_bench, full_scan_100_batches) { return run_scan(100); }
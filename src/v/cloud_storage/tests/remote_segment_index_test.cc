@@ -317,3 +317,86 @@ SEASTAR_THREAD_TEST_CASE(
         BOOST_REQUIRE_GT(it_b->second, it_a->second);
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(test_framed_offset_index) {
+    model::offset base_rp_offset{1234};
+    kafka::offset base_kaf_offset{1210};
+    offset_index ix(
+      base_rp_offset, base_kaf_offset, 0U, 1000, model::timestamp{123456});
+    std::vector<kafka::offset> kaf_offsets;
+    std::vector<model::timestamp> timestamps;
+    int64_t rp = base_rp_offset();
+    int64_t kaf = base_kaf_offset();
+    size_t fpos = 0;
+    model::timestamp timestamp{123456};
+    for (size_t i = 0; i < 1000; i++) {
+        ix.add(model::offset(rp), kafka::offset(kaf), fpos, timestamp);
+        kaf_offsets.push_back(kafka::offset(kaf));
+        timestamps.push_back(timestamp);
+        auto batch_size = random_generators::get_int(2, 100);
+        rp += batch_size;
+        kaf += batch_size;
+        fpos += random_generators::get_int(1000, 2000);
+        timestamp = model::timestamp(timestamp.value() + 2);
+    }
+
+    // Small frames so that the lookups cross many frame boundaries
+    auto [encoded_ix, buf] = framed_offset_index::encode(ix, 16);
+    BOOST_REQUIRE(framed_offset_index::is_framed(buf));
+    BOOST_REQUIRE(
+      !framed_offset_index::is_framed(ix.to_iobuf().share(0, 32)));
+
+    // The coarse index built while reading the encoded index is the same as
+    // the one built from the in-memory index
+    auto head = buf.share(0, framed_offset_index::header_size);
+    auto in = make_iobuf_input_stream(buf.share(
+      framed_offset_index::header_size,
+      buf.size_bytes() - framed_offset_index::header_size));
+    auto [framed, coarse] = framed_offset_index::read(
+                              std::move(head), in, 10_KiB, "test")
+                              .get();
+    in.close().get();
+    BOOST_REQUIRE(coarse == ix.build_coarse_index(10_KiB, "test"));
+    BOOST_REQUIRE_EQUAL(
+      framed.estimate_memory_use(), encoded_ix.estimate_memory_use());
+
+    auto check = [](
+                   const std::optional<offset_index::find_result>& actual,
+                   const std::optional<offset_index::find_result>& expected) {
+        BOOST_REQUIRE_EQUAL(actual.has_value(), expected.has_value());
+        if (expected) {
+            BOOST_REQUIRE_EQUAL(actual->rp_offset, expected->rp_offset);
+            BOOST_REQUIRE_EQUAL(actual->kaf_offset, expected->kaf_offset);
+            BOOST_REQUIRE_EQUAL(actual->file_pos, expected->file_pos);
+        }
+    };
+    auto find_kaf_offset = [&](kafka::offset o) {
+        std::optional<offset_index::find_result> res;
+        if (auto ref = framed.find_kaf_offset_frame(o)) {
+            res = framed_offset_index::find_kaf_offset(
+              buf.share(ref->file_pos, ref->size_bytes), o);
+        }
+        return res;
+    };
+    auto find_timestamp = [&](model::timestamp ts) {
+        std::optional<offset_index::find_result> res;
+        if (auto ref = framed.find_timestamp_frame(ts)) {
+            res = framed_offset_index::find_timestamp(
+              buf.share(ref->file_pos, ref->size_bytes), ts);
+        }
+        return res;
+    };
+
+    check(
+      find_kaf_offset(base_kaf_offset),
+      ix.find_kaf_offset(base_kaf_offset));
+    for (size_t i = 0; i < kaf_offsets.size(); i++) {
+        for (auto o : {kaf_offsets[i], kaf_offsets[i] + kafka::offset(1)}) {
+            check(find_kaf_offset(o), ix.find_kaf_offset(o));
+        }
+        for (auto ts :
+             {timestamps[i], model::timestamp(timestamps[i].value() + 1)}) {
+            check(find_timestamp(ts), ix.find_timestamp(ts));
+        }
+    }
+}
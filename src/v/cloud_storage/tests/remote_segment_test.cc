@@ -709,6 +709,72 @@ FIXTURE_TEST(test_remote_segment_chunk_read_fallback, cloud_storage_fixture) {
     BOOST_REQUIRE(downloaded == segment_bytes);
 }
 
+FIXTURE_TEST(test_remote_segment_hydration_in_parts, cloud_storage_fixture) {
+    /**
+     * Without an index the full segment is hydrated. The segment is larger
+     * than the part size, so it is downloaded with concurrent ranged GETs.
+     */
+    scoped_config cfg;
+    cfg.get("cloud_storage_hydration_part_size").set_value(uint64_t{4_KiB});
+    cfg.get("cloud_storage_max_hydration_parts_in_flight")
+      .set_value(uint16_t{3});
+
+    auto key = model::offset(1);
+    retry_chain_node fib(never_abort, 300s, 200ms);
+    iobuf segment_bytes = generate_segment(model::offset(1), 300);
+    BOOST_REQUIRE_GT(segment_bytes.size_bytes(), 4_KiB);
+
+    auto m = chunk_read_baseline(
+      *this, key, fib, segment_bytes.copy(), upload_index_t::no);
+
+    auto meta = *m.get(key);
+    partition_probe probe(manifest_ntp);
+    auto& ts_probe = api.local().materialized().get_read_path_probe();
+    remote_segment segment(
+      api.local(),
+      cache.local(),
+      bucket,
+      m.generate_segment_path(meta),
+      m.get_ntp(),
+      meta,
+      fib,
+      probe,
+      ts_probe);
+
+    ss::abort_source as;
+    auto stream = segment
+                    .offset_data_stream(
+                      m.get(key)->base_kafka_offset(),
+                      kafka::offset{100000000},
+                      std::nullopt,
+                      ss::default_priority_class(),
+                      as)
+                    .get()
+                    .stream;
+
+    iobuf downloaded;
+    auto rds = make_iobuf_ref_output_stream(downloaded);
+    ss::copy(stream, rds).get();
+    stream.close().get();
+    segment.stop().get();
+
+    BOOST_REQUIRE(segment.is_fallback_engaged());
+    BOOST_REQUIRE(downloaded == segment_bytes);
+
+    std::regex log_file_expr{".*-.*log(\\.\\d+)?$"};
+    size_t ranged_gets = 0;
+    for (const auto& req : get_requests()) {
+        if (
+          req.method == "GET"
+          && std::regex_match(req.url.begin(), req.url.end(), log_file_expr)) {
+            BOOST_REQUIRE(req.header("Range") != "");
+            ++ranged_gets;
+        }
+    }
+    BOOST_REQUIRE_EQUAL(
+      ranged_gets, (segment_bytes.size_bytes() + 4_KiB - 1) / 4_KiB);
+}
+
 FIXTURE_TEST(test_chunks_initialization, cloud_storage_fixture) {
     config::shard_local_cfg().cloud_storage_cache_chunk_size.set_value(
       static_cast<uint64_t>(128_KiB));
@@ -1158,6 +1224,64 @@ FIXTURE_TEST(test_chunk_prefetch, cloud_storage_fixture) {
     }
 }
 
+FIXTURE_TEST(test_chunk_read_ahead, cloud_storage_fixture) {
+    scoped_config cfg;
+    cfg.get("cloud_storage_cache_chunk_size")
+      .set_value(static_cast<uint64_t>(128_KiB));
+
+    const auto key = model::offset(1);
+    retry_chain_node fib(never_abort, 300s, 200ms);
+    const iobuf segment_bytes = generate_segment(model::offset(1), 300);
+
+    const auto m = chunk_read_baseline(*this, key, fib, segment_bytes.copy());
+    const auto meta = *m.get(key);
+    partition_probe probe(manifest_ntp);
+    auto& ts_probe = api.local().materialized().get_read_path_probe();
+    remote_segment segment(
+      api.local(),
+      cache.local(),
+      bucket,
+      m.generate_segment_path(meta),
+      m.get_ntp(),
+      meta,
+      fib,
+      probe,
+      ts_probe);
+
+    segment_chunks chunk_api{segment, segment.max_hydrated_chunks()};
+
+    auto close_segment = ss::defer([&segment, &chunk_api] {
+        chunk_api.stop().get();
+        segment.stop().get();
+    });
+
+    segment.hydrate().get();
+    chunk_api.start().get();
+
+    std::vector<chunk_start_offset_t> starts;
+    for (const auto& [start, _] : chunk_api) {
+        starts.push_back(start);
+    }
+    BOOST_REQUIRE_GT(starts.size(), 3);
+
+    chunk_api.hydrate_chunk(starts[0]).get();
+
+    // the two chunks after the first one are hydrated in the background
+    chunk_api.read_ahead(starts[0], starts.back(), 2);
+    RPTEST_REQUIRE_EVENTUALLY(10s, [&] {
+        return chunk_api.get(starts[1]).current_state == chunk_state::hydrated
+               && chunk_api.get(starts[2]).current_state
+                    == chunk_state::hydrated;
+    });
+    BOOST_REQUIRE(
+      chunk_api.get(starts[3]).current_state == chunk_state::not_available);
+
+    // read ahead doesn't go past the last chunk of the reader
+    chunk_api.read_ahead(starts[2], starts[2], 2);
+    BOOST_REQUIRE(
+      chunk_api.get(starts[3]).current_state == chunk_state::not_available);
+}
+
 FIXTURE_TEST(test_abort_hydration_timeout, cloud_storage_fixture) {
     scoped_config reset;
     reset.get("cloud_storage_hydration_timeout_ms").set_value(0ms);
@@ -694,6 +694,48 @@ FIXTURE_TEST(test_list_bucket_with_filter, remote_fixture) {
     BOOST_REQUIRE_EQUAL(items[0].key, "b");
 }
 
+FIXTURE_TEST(test_list_bucket_with_consumer, remote_fixture) {
+    set_expectations_and_listen({});
+    retry_chain_node fib(never_abort, 100ms, 20ms);
+    cloud_storage_clients::bucket_name bucket{"test"};
+    for (const auto* key : {"a", "b", "c", "d"}) {
+        auto upl_result = remote.local()
+                            .upload_object(
+                              bucket,
+                              cloud_storage_clients::object_key{key},
+                              iobuf{},
+                              fib)
+                            .get();
+        BOOST_REQUIRE_EQUAL(cloud_storage::upload_result::success, upl_result);
+    }
+
+    std::vector<ss::sstring> consumed;
+    auto consumer = [&consumed](
+                      ss::sstring key,
+                      std::chrono::system_clock::time_point,
+                      size_t,
+                      ss::sstring) {
+        consumed.push_back(std::move(key));
+        return consumed.size() == 2 ? ss::stop_iteration::yes
+                                    : ss::stop_iteration::no;
+    };
+    auto result = remote.local()
+                    .list_objects(
+                      bucket,
+                      fib,
+                      consumer,
+                      std::nullopt,
+                      std::nullopt,
+                      [](const auto& item) { return item.key != "a"; })
+                    .get();
+    BOOST_REQUIRE(result.has_value());
+    // Consumed items are not collected
+    BOOST_REQUIRE(result.value().contents.empty());
+    BOOST_REQUIRE_EQUAL(consumed.size(), 2);
+    BOOST_REQUIRE_EQUAL(consumed[0], "b");
+    BOOST_REQUIRE_EQUAL(consumed[1], "c");
+}
+
 FIXTURE_TEST(test_put_string, remote_fixture) {
     set_expectations_and_listen({});
     auto conf = get_configuration();
@@ -91,6 +91,43 @@ static const delta_delta_column delta_column_4M = []() {
     return column;
 }();
 
+template<class DeltaT>
+deltafor_encoder<int64_t, DeltaT>
+make_encoder(int64_t max_delta, DeltaT delta = {}) {
+    deltafor_encoder<int64_t, DeltaT> enc(0, delta);
+    int64_t value = 0;
+    for (int64_t i = 0; i < 4096; i += details::FOR_buffer_depth) {
+        std::array<int64_t, details::FOR_buffer_depth> row{};
+        for (auto& e : row) {
+            value += random_generators::get_int<int64_t>(1, max_delta);
+            e = value;
+        }
+        enc.add(row);
+    }
+    return enc;
+}
+
+// Offsets are encoded using few bits per value, sizes and timestamps need
+// whole bytes and residual bits
+static const auto xor_encoder_narrow_4K = make_encoder<delta_xor_alg>(100);
+static const auto xor_encoder_wide_4K = make_encoder<delta_xor_alg>(
+  100'000'000);
+static const auto delta_encoder_narrow_4K = make_encoder<delta_delta_alg>(100);
+static const auto delta_encoder_wide_4K = make_encoder<delta_delta_alg>(
+  100'000'000);
+
+template<class DeltaT>
+void decode_test(const deltafor_encoder<int64_t, DeltaT>& enc) {
+    deltafor_decoder<int64_t, DeltaT> dec(
+      enc.get_initial_value(), enc.get_row_count(), enc.share());
+    std::array<int64_t, details::FOR_buffer_depth> row{};
+    perf_tests::start_measuring_time();
+    while (dec.read(row)) {
+        perf_tests::do_not_optimize(row);
+    }
+    perf_tests::stop_measuring_time();
+}
+
 template<class StoreT>
 void append_test(StoreT& store, int test_scale) {
     std::vector<int64_t> head;
@@ -222,6 +259,22 @@ PERF_TEST(cstore_bench, delta_column_at_4K) { at_test(delta_column_4K); }
 
 PERF_TEST(cstore_bench, delta_column_at_4M) { at_test(delta_column_4M); }
 
+PERF_TEST(cstore_bench, xor_decode_narrow_4K) {
+    decode_test(xor_encoder_narrow_4K);
+}
+
+PERF_TEST(cstore_bench, xor_decode_wide_4K) {
+    decode_test(xor_encoder_wide_4K);
+}
+
+PERF_TEST(cstore_bench, delta_decode_narrow_4K) {
+    decode_test(delta_encoder_narrow_4K);
+}
+
+PERF_TEST(cstore_bench, delta_decode_wide_4K) {
+    decode_test(delta_encoder_wide_4K);
+}
+
 PERF_TEST(cstore_bench, xor_frame_at_with_index_4K) {
     std::map<int32_t, delta_xor_frame::hint_t> index;
     delta_xor_frame frame{};
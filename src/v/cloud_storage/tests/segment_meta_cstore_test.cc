@@ -505,6 +505,67 @@ BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_col_prefix_truncate_delta) {
     prefix_truncate_test_case(10, col);
 }
 
+BOOST_AUTO_TEST_CASE(test_segment_meta_cstore_col_skip_index) {
+    delta_xor_column xor_col{};
+    delta_delta_column delta_col{};
+    std::vector<int64_t> gauges;
+    std::vector<int64_t> counters;
+    int64_t counter = 0;
+    for (size_t i = 0; i < 5 * cstore_max_frame_size + 7; i++) {
+        gauges.push_back(random_generators::get_int<int64_t>(0, 1'000'000));
+        counter += random_generators::get_int(1, 100);
+        counters.push_back(counter);
+        xor_col.append(gauges.back());
+        delta_col.append(counters.back());
+    }
+
+    auto check = [&](size_t first_frame_size) {
+        BOOST_REQUIRE_EQUAL(xor_col.size(), gauges.size());
+        BOOST_REQUIRE_EQUAL(delta_col.size(), counters.size());
+        auto frame_start = [first_frame_size](size_t ix) -> size_t {
+            if (ix < first_frame_size) {
+                return 0;
+            }
+            ix -= first_frame_size;
+            return first_frame_size + ix - ix % cstore_max_frame_size;
+        };
+        for (int64_t threshold : {-1, 500'000, 999'000, 1'000'000}) {
+            auto it = std::find_if(
+              gauges.begin(), gauges.end(), [threshold](int64_t v) {
+                  return v > threshold;
+              });
+            auto expected = it == gauges.end()
+                              ? gauges.size()
+                              : frame_start(it - gauges.begin());
+            auto actual = xor_col.find_frame_by_max(
+              [threshold](int64_t v) { return v > threshold; });
+            BOOST_REQUIRE_EQUAL(actual, expected);
+        }
+        for (size_t ix = 0; ix < counters.size(); ix += 97) {
+            BOOST_REQUIRE_EQUAL(*xor_col.at_index(ix), gauges[ix]);
+            BOOST_REQUIRE_EQUAL(*delta_col.at_index(ix), counters[ix]);
+            BOOST_REQUIRE_EQUAL(delta_col.find(counters[ix]).index(), ix);
+            BOOST_REQUIRE_EQUAL(
+              delta_col.lower_bound(counters[ix]).index(), ix);
+            if (ix > 0) {
+                BOOST_REQUIRE_EQUAL(
+                  delta_col.upper_bound(counters[ix - 1]).index(), ix);
+            }
+        }
+        BOOST_REQUIRE(xor_col.at_index(gauges.size()) == xor_col.end());
+        BOOST_REQUIRE(
+          delta_col.lower_bound(counters.back() + 1) == delta_col.end());
+    };
+    check(cstore_max_frame_size);
+
+    // the skip index is rebuilt when the columns are truncated
+    xor_col.prefix_truncate_ix(100);
+    delta_col.prefix_truncate_ix(100);
+    gauges.erase(gauges.begin(), gauges.begin() + 100);
+    counters.erase(counters.begin(), counters.begin() + 100);
+    check(cstore_max_frame_size - 100);
+}
+
 template<class column_t>
 void at_with_hint_test_case(const int64_t num_elements, column_t& column) {
     struct hint_t {
@@ -20,6 +20,9 @@
 #include "config/configuration.h"
 #include "json/document.h"
 #include "json/istreamwrapper.h"
+#include "random/generators.h"
+#include "ssx/sformat.h"
+#include "utils/base64.h"
 #include "vlog.h"
 
 #include <utility>
@@ -45,6 +48,8 @@ constexpr std::array<boost::beast::http::status, 6> retryable_http_codes = {
 constexpr boost::beast::string_view content_type_value = "text/plain";
 constexpr boost::beast::string_view blob_type_value = "BlockBlob";
 constexpr boost::beast::string_view blob_type_name = "x-ms-blob-type";
+constexpr boost::beast::string_view blob_content_type_name
+  = "x-ms-blob-content-type";
 constexpr boost::beast::string_view delete_snapshot_name
   = "x-ms-delete-snapshots";
 constexpr boost::beast::string_view is_hns_enabled_name = "x-ms-is-hns-enabled";
@@ -229,6 +234,69 @@ result<http::client::request_header> abs_request_creator::make_put_blob_request(
     return header;
 }
 
+result<http::client::request_header>
+abs_request_creator::make_put_block_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& block_id,
+  size_t payload_size_bytes) {
+    // PUT /{container-id}/{blob-id}?comp=block&blockid={block-id} HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2023-01-23"           # added by 'add_auth'
+    // Authorization:{signature}           # added by 'add_auth'
+    // Content-Length:{payload-size}
+    const auto target = fmt::format(
+      "/{}/{}?comp=block&blockid={}", name(), key().string(), block_id);
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    return header;
+}
+
+result<http::client::request_header>
+abs_request_creator::make_put_block_list_request(
+  bucket_name const& name, object_key const& key, size_t payload_size_bytes) {
+    // PUT /{container-id}/{blob-id}?comp=blocklist HTTP/1.1
+    // Host: {storage-account-id}.blob.core.windows.net
+    // x-ms-date:{req-datetime in RFC9110} # added by 'add_auth'
+    // x-ms-version:"2023-01-23"           # added by 'add_auth'
+    // Authorization:{signature}           # added by 'add_auth'
+    // Content-Length:{payload-size}
+    // x-ms-blob-content-type: text/plain
+    const auto target = fmt::format(
+      "/{}/{}?comp=blocklist", name(), key().string());
+    const boost::beast::string_view host{_ap().data(), _ap().length()};
+
+    http::client::request_header header{};
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+    header.insert(blob_content_type_name, content_type_value);
+
+    auto error_code = _apply_credentials->add_auth(header);
+    if (error_code) {
+        return error_code;
+    }
+
+    return header;
+}
+
 result<http::client::request_header>
 abs_request_creator::make_get_blob_metadata_request(
   bucket_name const& name, object_key const& key) {
@@ -619,6 +687,143 @@ ss::future<> abs_client::do_put_object(
     }
 }
 
+ss::future<result<ss::sstring, error_outcome>>
+abs_client::initiate_multipart_upload(
+  bucket_name const&, object_key const&, ss::lowres_clock::duration) {
+    // Block ids are base64 encoded digits. Three digits are encoded as four
+    // alphanumeric characters, so the ids don't need to be url encoded.
+    co_return ssx::sformat(
+      "{:012}", random_generators::get_int<uint64_t>(999'999'999'999));
+}
+
+ss::future<result<ss::sstring, error_outcome>> abs_client::upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  size_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    // all the ids of the blocks of a blob have the same length
+    auto raw_id = ssx::sformat("{}{:06}", upload_id, part_number);
+    auto block_id = bytes_to_base64(
+      {reinterpret_cast<const uint8_t*>(raw_id.data()), raw_id.size()});
+    return send_request(
+      do_put_block(
+        name,
+        key,
+        std::move(block_id),
+        payload_size,
+        std::move(body),
+        timeout),
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<ss::sstring> abs_client::do_put_block(
+  bucket_name const& name,
+  object_key const& key,
+  ss::sstring block_id,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_put_block_request(
+      name, key, block_id, payload_size);
+    if (!header) {
+        co_await body.close();
+
+        vlog(
+          abs_log.warn, "Failed to create request header: {}", header.error());
+        throw std::system_error(header.error());
+    }
+
+    vlog(abs_log.trace, "send https request:\n{}", header.value());
+
+    auto response_stream = co_await _client
+                             .request(std::move(header.value()), body, timeout)
+                             .finally([&body] { return body.close(); });
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        const auto content_type = get_response_content_type(
+          response_stream->get_headers());
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(content_type, status, std::move(buf));
+    }
+    co_return block_id;
+}
+
+ss::future<result<abs_client::no_response, error_outcome>>
+abs_client::complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring&,
+  std::vector<ss::sstring> part_ids,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_put_block_list(name, key, std::move(part_ids), timeout).then([] {
+          return no_response{};
+      }),
+      key,
+      op_type_tag::upload);
+}
+
+ss::future<> abs_client::do_put_block_list(
+  bucket_name const& name,
+  object_key const& key,
+  std::vector<ss::sstring> block_ids,
+  ss::lowres_clock::duration timeout) {
+    ss::sstring block_list
+      = R"(<?xml version="1.0" encoding="utf-8"?><BlockList>)";
+    for (const auto& id : block_ids) {
+        block_list += ssx::sformat("<Latest>{}</Latest>", id);
+    }
+    block_list += "</BlockList>";
+
+    auto header = _requestor.make_put_block_list_request(
+      name, key, block_list.size());
+    if (!header) {
+        vlog(
+          abs_log.warn, "Failed to create request header: {}", header.error());
+        throw std::system_error(header.error());
+    }
+
+    vlog(abs_log.trace, "send https request:\n{}", header.value());
+
+    iobuf payload;
+    payload.append(block_list.data(), block_list.size());
+    auto body = make_iobuf_input_stream(std::move(payload));
+    auto response_stream = co_await _client
+                             .request(std::move(header.value()), body, timeout)
+                             .finally([&body] { return body.close(); });
+
+    co_await response_stream->prefetch_headers();
+    vassert(response_stream->is_header_done(), "Header is not received");
+
+    const auto status = response_stream->get_headers().result();
+    if (status != boost::beast::http::status::created) {
+        const auto content_type = get_response_content_type(
+          response_stream->get_headers());
+        auto buf = co_await util::drain_response_stream(
+          std::move(response_stream));
+        throw parse_rest_error_response(content_type, status, std::move(buf));
+    }
+}
+
+ss::future<result<abs_client::no_response, error_outcome>>
+abs_client::abort_multipart_upload(
+  bucket_name const&,
+  object_key const&,
+  const ss::sstring&,
+  ss::lowres_clock::duration) {
+    return ss::make_ready_future<result<no_response, error_outcome>>(
+      no_response{});
+}
+
 ss::future<result<abs_client::head_object_result, error_outcome>>
 abs_client::head_object(
   bucket_name const& name,
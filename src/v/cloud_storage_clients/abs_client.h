@@ -39,6 +39,30 @@ public:
       object_key const& key,
       size_t payload_size_bytes);
 
+    /// \brief Create 'Put Block' request header
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param block_id is the base64 encoded id of the block
+    /// \param payload_size_bytes is a size of the block in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_put_block_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& block_id,
+      size_t payload_size_bytes);
+
+    /// \brief Create 'Put Block List' request header
+    ///
+    /// \param name is container name
+    /// \param key is the blob identifier
+    /// \param payload_size_bytes is a size of the block list in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_put_block_list_request(
+      bucket_name const& name,
+      object_key const& key,
+      size_t payload_size_bytes);
+
     /// \brief Create a 'Get Blob' request header
     ///
     /// \param name is container name
@@ -168,6 +192,41 @@ public:
       ss::input_stream<char> body,
       ss::lowres_clock::duration timeout) override;
 
+    /// The blocks of a blob are committed all at once, the upload doesn't
+    /// need a request to start.
+    /// \return a random id that prefixes the ids of the blocks
+    ss::future<result<ss::sstring, error_outcome>> initiate_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block request
+    /// \return the base64 encoded id of the block
+    ss::future<result<ss::sstring, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Send Put Block List request with the ids of the blocks
+    ss::future<result<no_response, error_outcome>> complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      std::vector<ss::sstring> part_ids,
+      ss::lowres_clock::duration timeout) override;
+
+    /// Uncommitted blocks are garbage collected by the service, nothing is
+    /// sent.
+    ss::future<result<no_response, error_outcome>> abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout) override;
+
     /// Send List Blobs request
     /// \param name is a container name
     /// \param prefix is an optional blob prefix to match
@@ -256,6 +315,20 @@ private:
       ss::input_stream<char> body,
       ss::lowres_clock::duration timeout);
 
+    ss::future<ss::sstring> do_put_block(
+      bucket_name const& name,
+      object_key const& key,
+      ss::sstring block_id,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_put_block_list(
+      bucket_name const& name,
+      object_key const& key,
+      std::vector<ss::sstring> block_ids,
+      ss::lowres_clock::duration timeout);
+
     ss::future<head_object_result> do_head_object(
       bucket_name const& name,
       object_key const& key,
@@ -89,6 +89,62 @@ public:
       ss::lowres_clock::duration timeout)
       = 0;
 
+    /// Start a multipart upload. The parts of the object are uploaded with
+    /// upload_part and the object is created by complete_multipart_upload.
+    ///
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param timeout is a timeout of the operation
+    /// \return future that becomes ready with the id of the upload
+    virtual ss::future<result<ss::sstring, error_outcome>>
+    initiate_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Upload a part of a multipart upload. A part can be uploaded again
+    /// after a failure, the last upload wins.
+    ///
+    /// \param upload_id is the id returned by initiate_multipart_upload
+    /// \param part_number is the position of the part, starting at 1
+    /// \param payload_size is a size of the part in bytes
+    /// \param body is an input_stream that can be used to read the part
+    /// \return future that becomes ready with the id of the uploaded part
+    virtual ss::future<result<ss::sstring, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Create the object from the uploaded parts
+    ///
+    /// \param part_ids are the ids returned by upload_part in part order
+    virtual ss::future<result<no_response, error_outcome>>
+    complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      std::vector<ss::sstring> part_ids,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Drop the uploaded parts of an upload that won't complete
+    virtual ss::future<result<no_response, error_outcome>>
+    abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout)
+      = 0;
+
+    /// Largest number of parts of a multipart upload
+    constexpr static size_t max_multipart_upload_parts = 10000;
+
     struct list_bucket_item {
         ss::sstring key;
         std::chrono::system_clock::time_point last_modified;
@@ -26,6 +26,9 @@
 namespace {
 constexpr auto self_configure_attempts = 3;
 constexpr auto self_configure_backoff = 1s;
+// How long the shard waits for a local client before it tries to borrow
+// one from another shard again
+constexpr auto borrow_retry_interval = 100ms;
 } // namespace
 
 namespace cloud_storage_clients {
@@ -246,6 +249,10 @@ client_pool::acquire(ss::abort_source& as) {
 
     std::optional<unsigned int> source_sid;
     std::optional<http_client_ptr> client;
+    std::unique_ptr<client_probe::hist_t::measurement> wait_measurement;
+    if (_probe) {
+        wait_measurement = _probe->register_lease_wait();
+    }
 
     try {
         // If credentials have not yet been acquired, wait for them. It is
@@ -320,12 +327,24 @@ client_pool::acquire(ss::abort_source& as) {
                     client = make_client();
                 } else {
                     vlog(pool_log.debug, "can't borrow connection, waiting");
-                    co_await ssx::with_timeout_abortable(
-                      _cvar.wait(), model::no_timeout, as);
-                    vlog(
-                      pool_log.debug,
-                      "cvar triggered, pool size: {}",
-                      _pool.size());
+                    // Other shards may free their clients while this shard
+                    // waits. Try borrowing again if no local client is
+                    // released in time instead of waiting for the local pool
+                    // only.
+                    try {
+                        co_await ssx::with_timeout_abortable(
+                          _cvar.wait(borrow_retry_interval),
+                          model::no_timeout,
+                          as);
+                        vlog(
+                          pool_log.debug,
+                          "cvar triggered, pool size: {}",
+                          _pool.size());
+                    } catch (const ss::condition_variable_timed_out&) {
+                        vlog(
+                          pool_log.debug,
+                          "no client released, retrying borrow");
+                    }
                 }
             }
         }
@@ -335,6 +354,7 @@ client_pool::acquire(ss::abort_source& as) {
         throw ss::gate_closed_exception();
     }
     vassert(client.has_value(), "'acquire' invariant is broken");
+    wait_measurement.reset();
 
     update_usage_stats();
     vlog(
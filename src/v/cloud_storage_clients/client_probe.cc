@@ -98,6 +98,11 @@ client_probe::register_lease_duration() {
     return _lease_duration.auto_measure();
 }
 
+std::unique_ptr<client_probe::hist_t::measurement>
+client_probe::register_lease_wait() {
+    return _lease_wait.auto_measure();
+}
+
 void client_probe::register_utilization(unsigned clients_in_use) {
     _pool_utilization = clients_in_use;
 }
@@ -197,6 +202,23 @@ void client_probe::setup_internal_metrics(
           [this] { return _lease_duration.public_histogram_logform(); },
           sm::description("Lease duration histogram"),
           labels),
+        sm::make_histogram(
+          "lease_wait",
+          [this] { return _lease_wait.public_histogram_logform(); },
+          sm::description("Histogram of the time spent waiting for a client "
+                          "lease"),
+          labels),
+        sm::make_counter(
+          "connections_reused",
+          [this] { return get_reused_connections(); },
+          sm::description("Number of requests sent over an already open "
+                          "connection"),
+          labels),
+        sm::make_counter(
+          "connections_opened",
+          [this] { return get_new_connections(); },
+          sm::description("Number of connections opened to send requests"),
+          labels),
         sm::make_gauge(
           "client_pool_utilization",
           [this] { return _pool_utilization; },
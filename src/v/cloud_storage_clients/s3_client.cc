@@ -343,6 +343,149 @@ request_creator::make_delete_objects_request(
         std::make_unique<delete_objects_body>(std::move(body))}}};
 }
 
+result<http::client::request_header>
+request_creator::make_create_multipart_upload_request(
+  bucket_name const& name, object_key const& key) {
+    // POST /{object-id}?uploads HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploads", key().string());
+    header.method(boost::beast::http::verb::post);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_type, aws_header_values::text_plain);
+    header.insert(boost::beast::http::field::content_length, "0");
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header>
+request_creator::make_unsigned_upload_part_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  size_t part_number,
+  size_t payload_size_bytes) {
+    // PUT /{object-id}?partNumber={part-number}&uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // Content-Length: {payload-size}
+    // [{payload-size} bytes of the part]
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format(
+      "/{}?partNumber={}&uploadId={}", key().string(), part_number, upload_id);
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+request_creator::make_complete_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  std::span<const ss::sstring> etags) {
+    // POST /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // Content-Length: <...>
+    //
+    // <CompleteMultipartUpload>
+    //     <Part>
+    //         <PartNumber>1</PartNumber>
+    //         <ETag>etag</ETag>
+    //     </Part>
+    //     ...
+    // </CompleteMultipartUpload>
+    auto body = [&] {
+        auto complete_tree = boost::property_tree::ptree{};
+        for (size_t i = 0; i < etags.size(); ++i) {
+            auto part_tree = boost::property_tree::ptree{};
+            part_tree.put("PartNumber", i + 1);
+            part_tree.put("ETag", etags[i].c_str());
+            complete_tree.add_child("CompleteMultipartUpload.Part", part_tree);
+        }
+
+        auto out = std::ostringstream{};
+        boost::property_tree::write_xml(out, complete_tree);
+        if (!out.good()) {
+            throw std::runtime_error(fmt_with_ctx(
+              fmt::format,
+              "failed to create complete multipart upload request, state: {}",
+              out.rdstate()));
+        }
+        return out.str();
+    }();
+
+    auto header = http::client::request_header{};
+    header.method(boost::beast::http::verb::post);
+    header.target(fmt::format("/{}?uploadId={}", key().string(), upload_id));
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(
+      boost::beast::http::field::host, fmt::format("{}.{}", name(), _ap()));
+    header.insert(
+      boost::beast::http::field::content_length,
+      fmt::format("{}", body.size()));
+
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+
+    return {
+      std::move(header),
+      ss::input_stream<char>{ss::data_source{
+        std::make_unique<delete_objects_body>(std::move(body))}}};
+}
+
+result<http::client::request_header>
+request_creator::make_abort_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id) {
+    // DELETE /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    http::client::request_header header{};
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploadId={}", key().string(), upload_id);
+    header.method(boost::beast::http::verb::delete_);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(boost::beast::http::field::content_length, "0");
+    auto ec = _apply_credentials->add_auth(header);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
 // client //
 
 inline cloud_storage_clients::s3_error_code
@@ -713,6 +856,205 @@ ss::future<> s3_client::do_put_object(
       });
 }
 
+ss::future<result<ss::sstring, error_outcome>>
+s3_client::initiate_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_initiate_multipart_upload(name, key, timeout), name, key);
+}
+
+ss::future<ss::sstring> s3_client::do_initiate_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_create_multipart_upload_request(name, key);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header.value());
+    auto ref = co_await _client.request(std::move(header.value()), timeout);
+    auto buf = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (status != boost::beast::http::status::ok) {
+        vlog(
+          s3_log.warn,
+          "S3 CreateMultipartUpload request failed: {} {:l}",
+          status,
+          ref->get_headers());
+        try {
+            co_await parse_rest_error_response<>(status, std::move(buf));
+        } catch (const rest_error_response& err) {
+            _probe->register_failure(err.code(), op_type_tag::upload);
+            throw;
+        }
+    }
+    auto root = util::iobuf_to_ptree(std::move(buf), s3_log);
+    auto upload_id = root.get<ss::sstring>(
+      "InitiateMultipartUploadResult.UploadId", "");
+    if (upload_id.empty()) {
+        throw std::runtime_error(fmt_with_ctx(
+          fmt::format, "no upload id in the response for {}", key));
+    }
+    co_return upload_id;
+}
+
+ss::future<result<ss::sstring, error_outcome>> s3_client::upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  size_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_upload_part(
+        name,
+        key,
+        upload_id,
+        part_number,
+        payload_size,
+        std::move(body),
+        timeout),
+      name,
+      key);
+}
+
+ss::future<ss::sstring> s3_client::do_upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  size_t part_number,
+  size_t payload_size,
+  ss::input_stream<char> body,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_unsigned_upload_part_request(
+      name, key, upload_id, part_number, payload_size);
+    if (!header) {
+        co_await body.close();
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header.value());
+    auto ref = co_await _client
+                 .request(std::move(header.value()), body, timeout)
+                 .finally([&body] { return body.close(); });
+    auto buf = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (status != boost::beast::http::status::ok) {
+        vlog(
+          s3_log.warn,
+          "S3 UploadPart request failed: {} {:l}",
+          status,
+          ref->get_headers());
+        try {
+            co_await parse_rest_error_response<>(status, std::move(buf));
+        } catch (const rest_error_response& err) {
+            _probe->register_failure(err.code(), op_type_tag::upload);
+            throw;
+        }
+    }
+    auto etag = ref->get_headers().at(boost::beast::http::field::etag);
+    co_return ss::sstring(etag.data(), etag.size());
+}
+
+ss::future<result<s3_client::no_response, error_outcome>>
+s3_client::complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  std::vector<ss::sstring> part_ids,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_complete_multipart_upload(
+        name, key, upload_id, std::move(part_ids), timeout)
+        .then([] { return no_response{}; }),
+      name,
+      key);
+}
+
+ss::future<> s3_client::do_complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  std::vector<ss::sstring> etags,
+  ss::lowres_clock::duration timeout) {
+    auto request = _requestor.make_complete_multipart_upload_request(
+      name, key, upload_id, etags);
+    if (!request) {
+        throw std::system_error(request.error());
+    }
+    auto& [header, body] = request.value();
+    vlog(s3_log.trace, "send CompleteMultipartUpload request:\n{}", header);
+    auto ref = co_await _client.request(std::move(header), body, timeout)
+                 .finally([&body] { return body.close(); });
+    auto buf = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    // The request can fail after the response status is sent, in which case
+    // the error is in the body of a 200 response
+    bool is_error = status != boost::beast::http::status::ok;
+    if (!is_error) {
+        auto root = util::iobuf_to_ptree(buf.copy(), s3_log);
+        is_error = root.find("Error") != root.not_found();
+        if (is_error) {
+            status = boost::beast::http::status::internal_server_error;
+        }
+    }
+    if (is_error) {
+        vlog(
+          s3_log.warn,
+          "S3 CompleteMultipartUpload request failed: {} {:l}",
+          status,
+          ref->get_headers());
+        try {
+            co_await parse_rest_error_response<>(status, std::move(buf));
+        } catch (const rest_error_response& err) {
+            _probe->register_failure(err.code(), op_type_tag::upload);
+            throw;
+        }
+    }
+}
+
+ss::future<result<s3_client::no_response, error_outcome>>
+s3_client::abort_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  ss::lowres_clock::duration timeout) {
+    return send_request(
+      do_abort_multipart_upload(name, key, upload_id, timeout).then([] {
+          return no_response{};
+      }),
+      name,
+      key);
+}
+
+ss::future<> s3_client::do_abort_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  ss::lowres_clock::duration timeout) {
+    auto header = _requestor.make_abort_multipart_upload_request(
+      name, key, upload_id);
+    if (!header) {
+        throw std::system_error(header.error());
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header.value());
+    auto ref = co_await _client.request(std::move(header.value()), timeout);
+    auto buf = co_await util::drain_response_stream(ref);
+    auto status = ref->get_headers().result();
+    if (
+      status != boost::beast::http::status::no_content
+      && status != boost::beast::http::status::ok) {
+        vlog(
+          s3_log.warn,
+          "S3 AbortMultipartUpload request failed: {} {:l}",
+          status,
+          ref->get_headers());
+        co_await parse_rest_error_response<>(status, std::move(buf));
+    }
+}
+
 ss::future<result<s3_client::list_bucket_result, error_outcome>>
 s3_client::list_objects(
   const bucket_name& name,
@@ -88,6 +88,54 @@ public:
     make_delete_objects_request(
       bucket_name const& name, std::span<const object_key> keys);
 
+    /// \brief Create a 'CreateMultipartUpload' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_create_multipart_upload_request(
+      bucket_name const& name, object_key const& key);
+
+    /// \brief Create unsigned 'UploadPart' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is the id of the multipart upload
+    /// \param part_number is the position of the part, starting at 1
+    /// \param payload_size_bytes is a size of the part in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_unsigned_upload_part_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      size_t payload_size_bytes);
+
+    /// \brief Create a 'CompleteMultipartUpload' request header and body
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is the id of the multipart upload
+    /// \param etags are the etags of the uploaded parts in part order
+    /// \return the header and an the body as an input_stream
+    result<std::tuple<http::client::request_header, ss::input_stream<char>>>
+    make_complete_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      std::span<const ss::sstring> etags);
+
+    /// \brief Create a 'AbortMultipartUpload' request header
+    ///
+    /// \param name is a bucket that has the upload
+    /// \param key is an object name
+    /// \param upload_id is the id of the multipart upload
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_abort_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id);
+
     /// \brief Initialize http header for 'ListObjectsV2' request
     ///
     /// \param name of the bucket
@@ -171,6 +219,34 @@ public:
       ss::input_stream<char> body,
       ss::lowres_clock::duration timeout) override;
 
+    ss::future<result<ss::sstring, error_outcome>> initiate_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout) override;
+
+    /// UploadPart request, the id of the part is its etag
+    ss::future<result<ss::sstring, error_outcome>> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<no_response, error_outcome>> complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      std::vector<ss::sstring> part_ids,
+      ss::lowres_clock::duration timeout) override;
+
+    ss::future<result<no_response, error_outcome>> abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout) override;
+
     ss::future<result<list_bucket_result, error_outcome>> list_objects(
       const bucket_name& name,
       std::optional<object_key> prefix = std::nullopt,
@@ -211,6 +287,33 @@ private:
       ss::input_stream<char> body,
       ss::lowres_clock::duration timeout);
 
+    ss::future<ss::sstring> do_initiate_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<ss::sstring> do_upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      size_t part_number,
+      size_t payload_size,
+      ss::input_stream<char> body,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      std::vector<ss::sstring> etags,
+      ss::lowres_clock::duration timeout);
+
+    ss::future<> do_abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      ss::lowres_clock::duration timeout);
+
     ss::future<list_bucket_result> do_list_objects_v2(
       const bucket_name& name,
       std::optional<object_key> prefix = std::nullopt,
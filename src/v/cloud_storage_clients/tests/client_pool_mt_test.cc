@@ -120,24 +120,8 @@ SEASTAR_THREAD_TEST_CASE(test_client_pool_acquire_blocked_on_another_shard) {
     vlog(test_log.debug, "return lease to the current shard");
     leases.pop_front();
 
-    pool
-      .invoke_on_all([](cloud_storage_clients::client_pool& pool) {
-          while (pool.has_background_operations()) {
-              return ss::yield();
-          }
-          return ss::now();
-      })
-      .get();
-    ;
-
-    // Since we returned to the current shard the future that
-    // await for the 'acquire' method to be completed on another shard
-    // souldn't become available.
-    BOOST_REQUIRE(fut.available() == false);
-
-    vlog(test_log.debug, "return lease to another shard");
-    leases.pop_back();
-    // The future is supposed to become available.
+    // The waiter on another shard retries borrowing periodically and is
+    // supposed to get the client released on the current shard.
     try {
         ss::with_timeout(ss::lowres_clock::now() + 1s, std::move(fut)).get();
     } catch (const ss::timed_out_error&) {
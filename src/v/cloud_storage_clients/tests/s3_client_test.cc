@@ -108,6 +108,13 @@ static constexpr const char* list_objects_payload = R"xml(
   </CommonPrefixes>
 </ListBucketResult>)xml";
 
+static constexpr const char* multipart_initiate_payload = R"xml(
+<InitiateMultipartUploadResult>
+  <Bucket>test-bucket</Bucket>
+  <Key>test-multipart</Key>
+  <UploadId>upload-id</UploadId>
+</InitiateMultipartUploadResult>)xml";
+
 constexpr auto delete_objects_payload_result = R"xml(
 <DeleteResult xmlns="http://s3.amazonaws.com/doc/2006-03-01/">{}</DeleteResult>
 )xml";
@@ -272,6 +279,56 @@ void set_routes(ss::httpd::routes& r) {
           return "unexpected";
       },
       "txt");
+    auto multipart_post_response = new function_handler(
+      [](const_req req) -> std::string {
+          if (req.query_parameters.contains("uploads")) {
+              return multipart_initiate_payload;
+          }
+          BOOST_REQUIRE_EQUAL(req.get_query_param("uploadId"), "upload-id");
+          auto tree = [&] {
+              auto buffer_stream = std::istringstream{std::string{req.content}};
+              auto tree = boost::property_tree::ptree{};
+              boost::property_tree::read_xml(buffer_stream, tree);
+              return tree;
+          }();
+          std::vector<std::string> parts;
+          for (auto const& [tag, value] :
+               tree.get_child("CompleteMultipartUpload")) {
+              BOOST_REQUIRE_EQUAL(tag, "Part");
+              BOOST_REQUIRE_EQUAL(
+                value.get<size_t>("PartNumber"), parts.size() + 1);
+              parts.push_back(value.get<std::string>("ETag"));
+          }
+          BOOST_REQUIRE(
+            parts == std::vector<std::string>({"etag-1", "etag-2"}));
+          return "<CompleteMultipartUploadResult>"
+                 "</CompleteMultipartUploadResult>";
+      },
+      "txt");
+    auto multipart_put_response = new function_handler(
+      [](const_req req, reply& reply) {
+          BOOST_REQUIRE_EQUAL(req.get_query_param("uploadId"), "upload-id");
+          BOOST_REQUIRE(req.content == expected_payload);
+          reply.add_header(
+            "ETag",
+            fmt::format("etag-{}", req.get_query_param("partNumber")));
+          return "";
+      },
+      "txt");
+    auto multipart_delete_response = new function_handler(
+      [](const_req req, reply& reply) {
+          BOOST_REQUIRE_EQUAL(req.get_query_param("uploadId"), "upload-id");
+          reply.set_status(reply::status_type::no_content);
+          return "";
+      },
+      "txt");
+    r.add(
+      operation_type::POST, url("/test-multipart"), multipart_post_response);
+    r.add(operation_type::PUT, url("/test-multipart"), multipart_put_response);
+    r.add(
+      operation_type::DELETE,
+      url("/test-multipart"),
+      multipart_delete_response);
     r.add(operation_type::PUT, url("/test"), empty_put_response);
     r.add(operation_type::PUT, url("/test-error"), erroneous_put_response);
     r.add(operation_type::GET, url("/test"), get_response);
@@ -387,6 +444,50 @@ SEASTAR_TEST_CASE(test_put_object_failure) {
     });
 }
 
+SEASTAR_TEST_CASE(test_multipart_upload_success) {
+    return ss::async([] {
+        auto conf = transport_configuration();
+        auto [server, client] = started_client_and_server(conf);
+        const cloud_storage_clients::bucket_name bucket("test-bucket");
+        const cloud_storage_clients::object_key key("test-multipart");
+
+        auto upload_id
+          = client->initiate_multipart_upload(bucket, key, 100ms).get();
+        BOOST_REQUIRE(upload_id);
+        BOOST_REQUIRE_EQUAL(upload_id.value(), "upload-id");
+
+        std::vector<ss::sstring> etags;
+        for (size_t part = 1; part <= 2; ++part) {
+            iobuf payload;
+            payload.append(expected_payload, expected_payload_size);
+            auto etag = client
+                          ->upload_part(
+                            bucket,
+                            key,
+                            upload_id.value(),
+                            part,
+                            expected_payload_size,
+                            make_iobuf_input_stream(std::move(payload)),
+                            100ms)
+                          .get();
+            BOOST_REQUIRE(etag);
+            BOOST_REQUIRE_EQUAL(etag.value(), fmt::format("etag-{}", part));
+            etags.push_back(etag.value());
+        }
+
+        // the parts are verified by the server
+        BOOST_REQUIRE(client
+                        ->complete_multipart_upload(
+                          bucket, key, upload_id.value(), etags, 100ms)
+                        .get());
+        BOOST_REQUIRE(
+          client->abort_multipart_upload(bucket, key, upload_id.value(), 100ms)
+            .get());
+        client->shutdown();
+        server->stop().get();
+    });
+}
+
 SEASTAR_TEST_CASE(test_get_object_success) {
     return ss::async([] {
         auto conf = transport_configuration();
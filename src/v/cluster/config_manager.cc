@@ -23,6 +23,7 @@
 #include "config/node_config.h"
 #include "features/feature_table.h"
 #include "model/metadata.h"
+#include "prometheus/prometheus_sanitize.h"
 #include "resource_mgmt/io_priority.h"
 #include "rpc/connection_cache.h"
 #include "utils/file_io.h"
@@ -209,6 +210,8 @@ ss::future<> config_manager::start() {
         _frontend.local().set_next_version(_seen_version + config_version{1});
     }
 
+    setup_metrics();
+
     vlog(clusterlog.trace, "Starting reconcile_status...");
 
     // Detach fiber
@@ -229,6 +232,25 @@ ss::future<> config_manager::start() {
 
     return ss::now();
 }
+
+void config_manager::setup_metrics() {
+    if (
+      config::shard_local_cfg().disable_metrics()
+      || ss::this_shard_id() != config_frontend::version_shard) {
+        return;
+    }
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("cluster:config"),
+      {
+        sm::make_histogram(
+          "delta_apply_latency",
+          sm::description(
+            "Latency of applying a configuration delta to all shards"),
+          [this] { return _apply_latency.internal_histogram_logform(); }),
+      });
+}
+
 void config_manager::handle_cluster_members_update(
   model::node_id id, model::membership_state new_state) {
     vlog(
@@ -633,6 +655,8 @@ config_manager::apply_result
 apply_local(cluster_config_delta_cmd_data const& data, bool silent) {
     auto& cfg = config::shard_local_cfg();
     auto result = config_manager::apply_result{};
+    // The bindings are notified once the whole delta is set
+    config::notification_batch notifications;
     for (const auto& u : data.upsert) {
         if (!cfg.contains(u.key)) {
             // We never heard of this property.  Record it as unknown
@@ -732,6 +756,16 @@ apply_local(cluster_config_delta_cmd_data const& data, bool silent) {
         property.reset();
     }
 
+    for (auto name : notifications.flush()) {
+        if (!silent) {
+            vlog(
+              clusterlog.warn,
+              "Unexpected error notifying the update of property {}",
+              name);
+        }
+        result.invalid.emplace_back(name);
+    }
+
     return result;
 }
 
@@ -910,9 +944,11 @@ config_manager::apply_delta(cluster_config_delta_cmd&& cmd_in) {
     // Update shard-local copies of configuration.  Use our local shard's
     // apply to learn of any bad properties (all copies will have the same
     // errors, so only need to check the errors on one)
+    auto m = _apply_latency.auto_measure();
     auto apply_r = apply_local(data, false);
 
-    co_await ss::smp::invoke_on_all([&data] { apply_local(data, true); });
+    co_await ss::smp::invoke_on_others([&data] { apply_local(data, true); });
+    m.reset();
 
     // Merge results from this delta into our status.
     my_latest_status.version = delta_version;
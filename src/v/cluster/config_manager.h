@@ -14,9 +14,11 @@
 #include "cluster/commands.h"
 #include "cluster/fwd.h"
 #include "features/feature_table.h"
+#include "metrics/metrics.h"
 #include "model/metadata.h"
 #include "model/record.h"
 #include "rpc/fwd.h"
+#include "utils/log_hist.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/future.hh>
@@ -122,6 +124,7 @@ private:
     static std::filesystem::path cache_path();
     ss::future<> wait_for_bootstrap();
     void handle_cluster_members_update(model::node_id, model::membership_state);
+    void setup_metrics();
 
     config_status my_latest_status;
     status_map status;
@@ -141,6 +144,10 @@ private:
     ss::condition_variable _reconcile_wait;
     ss::sharded<ss::abort_source>& _as;
     ss::gate _gate;
+
+    // Latency of applying a delta to the configuration of all the shards
+    log_hist_internal _apply_latency;
+    metrics::internal_metric_groups _metrics;
 };
 
 } // namespace cluster
@@ -538,6 +538,18 @@ ss::future<> controller::start(
             _raft0);
           return _leader_balancer->start();
       })
+      .then([this] {
+          _core_balancer = std::make_unique<core_balancer>(
+            _raft0->self().id(),
+            _tp_state.local(),
+            _partition_manager,
+            _tp_frontend,
+            config::shard_local_cfg().core_balancing_enabled.bind(),
+            config::shard_local_cfg().core_balancing_interval.bind(),
+            config::shard_local_cfg()
+              .core_balancing_imbalance_threshold.bind());
+          _core_balancer->start();
+      })
       .then([this] {
           return _health_manager.start_single(
             _raft0->self().id(),
@@ -704,6 +716,9 @@ ss::future<> controller::stop() {
         auto stop_leader_balancer = _leader_balancer ? _leader_balancer->stop()
                                                      : ss::now();
         return stop_leader_balancer
+          .then([this] {
+              return _core_balancer ? _core_balancer->stop() : ss::now();
+          })
           .then([this] {
               return ss::smp::submit_to(controller_stm_shard, [&stm = _stm] {
                   if (stm.local_is_initialized()) {
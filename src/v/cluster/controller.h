@@ -17,6 +17,7 @@
 #include "cluster/controller_stm.h"
 #include "cluster/fwd.h"
 #include "cluster/node_status_table.h"
+#include "cluster/scheduling/core_balancer.h"
 #include "cluster/scheduling/leader_balancer.h"
 #include "cluster/types.h"
 #include "model/fundamental.h"
@@ -282,6 +283,7 @@ private:
     ss::sharded<feature_backend> _feature_backend;        // instance per core
     ss::sharded<features::feature_table>& _feature_table; // instance per core
     std::unique_ptr<leader_balancer> _leader_balancer;
+    std::unique_ptr<core_balancer> _core_balancer;
     ss::sharded<partition_balancer_backend> _partition_balancer;
     std::unique_ptr<cloud_metadata::uploader> _metadata_uploader;
     ss::sharded<cluster_recovery_table> _recovery_table; // instance per core
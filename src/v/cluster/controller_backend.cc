@@ -276,6 +276,9 @@ controller_backend::controller_backend(
   , _data_directory(config::node().data_directory().as_sstring())
   , _housekeeping_timer_interval(
       config::shard_local_cfg().controller_backend_housekeeping_interval_ms())
+  , _reconciliation_concurrency(
+      config::shard_local_cfg()
+        .controller_backend_reconciliation_concurrency.bind())
   , _initial_retention_local_target_bytes(
       std::move(initial_retention_local_target_bytes))
   , _initial_retention_local_target_ms(
@@ -849,7 +852,7 @@ ss::future<> controller_backend::reconcile_topics() {
         return ss::max_concurrent_for_each(
                  _states.begin(),
                  _states.end(),
-                 1024,
+                 _reconciliation_concurrency(),
                  [this](auto& rs) {
                      return reconcile_ntp(rs.first, rs.second);
                  })
@@ -1739,21 +1742,77 @@ ss::future<> controller_backend::add_to_shard_table(
       ntp,
       shard,
       revision);
-    return _shard_table.invoke_on_all(
-      [ntp = std::move(ntp), raft_group, shard, revision](
-        shard_table& s) mutable {
-          s.update(ntp, raft_group, shard, revision);
-      });
+    return update_shard_table(shard_table_update{
+      .ntp = std::move(ntp),
+      .group = raft_group,
+      .shard = shard,
+      .revision = revision,
+    });
 }
 
 ss::future<> controller_backend::remove_from_shard_table(
   model::ntp ntp, raft::group_id raft_group, model::revision_id revision) {
     // update shard_table: broadcast
+    return update_shard_table(shard_table_update{
+      .ntp = std::move(ntp),
+      .group = raft_group,
+      .shard = std::nullopt,
+      .revision = revision,
+    });
+}
 
-    return _shard_table.invoke_on_all(
-      [ntp = std::move(ntp), raft_group, revision](shard_table& s) mutable {
-          s.erase(ntp, raft_group, revision);
-      });
+ss::future<> controller_backend::update_shard_table(shard_table_update update) {
+    if (!_shard_table_batch) {
+        if (_gate.is_closed()) {
+            // shutting down, the update must still be applied
+            return _shard_table.invoke_on_all(
+              [update = std::move(update)](shard_table& s) {
+                  if (update.shard) {
+                      s.update(
+                        update.ntp,
+                        update.group,
+                        *update.shard,
+                        update.revision);
+                  } else {
+                      s.erase(update.ntp, update.group, update.revision);
+                  }
+              });
+        }
+        _shard_table_batch = ss::make_lw_shared<shard_table_batch>();
+        ssx::background = flush_shard_table_updates(_gate.hold());
+    }
+    auto batch = _shard_table_batch;
+    batch->updates.push_back(std::move(update));
+    return batch->flushed.get_shared_future();
+}
+
+ss::future<>
+controller_backend::flush_shard_table_updates(ss::gate::holder holder) {
+    // let the other reconciliation fibers that are ready to run add their
+    // updates to the batch before it is broadcast
+    co_await ss::yield();
+    auto batch = std::exchange(_shard_table_batch, nullptr);
+    vlog(
+      clusterlog.trace,
+      "broadcasting {} shard table updates",
+      batch->updates.size());
+    try {
+        co_await _shard_table.invoke_on_all(
+          [&updates = batch->updates](shard_table& s) {
+              // updates are applied in the order they were issued so that a
+              // removal and a re-addition of the same ntp are not reordered
+              for (const auto& u : updates) {
+                  if (u.shard) {
+                      s.update(u.ntp, u.group, *u.shard, u.revision);
+                  } else {
+                      s.erase(u.ntp, u.group, u.revision);
+                  }
+              }
+          });
+        batch->flushed.set_value();
+    } catch (...) {
+        batch->flushed.set_exception(std::current_exception());
+    }
 }
 
 ss::future<std::error_code> controller_backend::do_create_partition(
@@ -26,6 +26,7 @@
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/sharded.hh>
 
 #include <absl/container/btree_map.h>
@@ -338,6 +339,23 @@ private:
     ss::future<>
       remove_from_shard_table(model::ntp, raft::group_id, model::revision_id);
 
+    /// Shard table updates are broadcast to all shards. Updates issued by
+    /// concurrently reconciled partitions are collected into a batch that is
+    /// broadcast with a single round of cross-shard calls.
+    struct shard_table_update {
+        model::ntp ntp;
+        raft::group_id group;
+        // shard hosting the partition, std::nullopt if it is removed
+        std::optional<ss::shard_id> shard;
+        model::revision_id revision;
+    };
+    struct shard_table_batch {
+        std::vector<shard_table_update> updates;
+        ss::shared_promise<> flushed;
+    };
+    ss::future<> update_shard_table(shard_table_update);
+    ss::future<> flush_shard_table_updates(ss::gate::holder);
+
     ss::future<> shutdown_partition(
       ss::lw_shared_ptr<partition>, model::revision_id cmd_revision);
 
@@ -413,6 +431,7 @@ private:
     model::node_id _self;
     ss::sstring _data_directory;
     std::chrono::milliseconds _housekeeping_timer_interval;
+    config::binding<size_t> _reconciliation_concurrency;
     config::binding<std::optional<size_t>>
       _initial_retention_local_target_bytes;
     config::binding<std::optional<std::chrono::milliseconds>>
@@ -466,6 +485,8 @@ private:
     // node_hash_map for pointer stability
     absl::node_hash_map<model::ntp, partition_claim> _ntp_claims;
 
+    ss::lw_shared_ptr<shard_table_batch> _shard_table_batch;
+
     ss::timer<> _housekeeping_timer;
     ssx::semaphore _topics_sem{1, "c/controller-be"};
     ss::gate _gate;
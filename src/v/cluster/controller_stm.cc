@@ -18,6 +18,7 @@
 #include "vlog.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/lowres_clock.hh>
 
 namespace cluster {
 
@@ -158,6 +159,12 @@ ss::future<> controller_stm::apply_snapshot(
       co_await read_iobuf_exactly(reader.input(), size)};
     auto snapshot = co_await serde::read_async<controller_snapshot>(
       snap_buf_parser);
+    const auto start = ss::lowres_clock::now();
+    auto elapsed_ms = [&start] {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                 ss::lowres_clock::now() - start)
+          .count();
+    };
 
     try {
         co_await std::get<bootstrap_backend&>(_state).apply_snapshot(
@@ -169,6 +176,7 @@ ss::future<> controller_stm::apply_snapshot(
         // apply members early so that we have rpc clients to all cluster nodes.
         co_await std::get<members_manager&>(_state).apply_snapshot(
           offset, snapshot);
+        const auto ordered_ms = elapsed_ms();
 
         // apply everything else in no particular order.
         co_await ss::when_all(
@@ -180,6 +188,13 @@ ss::future<> controller_stm::apply_snapshot(
             offset, snapshot),
           std::get<security_manager&>(_state).apply_snapshot(offset, snapshot));
 
+        vlog(
+          clusterlog.info,
+          "applied snapshot at offset: {} in {} ms ({} ms for bootstrap, "
+          "features and members)",
+          offset,
+          elapsed_ms(),
+          ordered_ms);
     } catch (const seastar::abort_requested_exception&) {
     } catch (const seastar::gate_closed_exception&) {
     } catch (const seastar::broken_semaphore&) {
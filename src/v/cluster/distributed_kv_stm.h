@@ -15,6 +15,9 @@
 #include "distributed_kv_stm_types.h"
 #include "raft/persisted_stm.h"
 
+#include <absl/container/btree_set.h>
+#include <absl/container/flat_hash_map.h>
+
 #include <type_traits>
 
 namespace cluster {
@@ -29,6 +32,7 @@ using namespace distributed_kv_stm_types;
  * put(map<key, val>) - bulk/batched put
  * get(key)
  * remove(key)
+ * remove(set<key>) - bulk/batched remove
  * coordinator(key) - only on routing partition (discussed below)
  *
  * Input KV pairs are spread across the partitions of the topic for
@@ -58,8 +62,12 @@ using namespace distributed_kv_stm_types;
  * For a reference client implementation, look at transforms_offsets topic
  * that uses this KV store to track consumption offsets for transforms.
  *
+ * A bulk operation is replicated as a single batch, one record per key, in a
+ * single replication round.
+ *
  * Currently we require constant memory usage, which is enforced by ensuring the
- * types are trivially copyable.
+ * types are trivially copyable. The keys are held in flat hash maps, which
+ * store the trivially copyable entries inline.
  */
 
 template<class T>
@@ -119,7 +127,7 @@ public:
     ss::future<> apply_local_snapshot(
       raft::stm_snapshot_header header, iobuf&& bytes) override {
         auto holder = _gate.hold();
-        auto units = _snapshot_lock.hold_write_lock();
+        auto units = co_await _snapshot_lock.hold_write_lock();
 
         iobuf_parser parser(std::move(bytes));
         auto snap = co_await serde::read_async<snapshot>(parser);
@@ -136,14 +144,17 @@ public:
 
     ss::future<raft::stm_snapshot> take_local_snapshot() override {
         auto holder = _gate.hold();
-        auto units = _snapshot_lock.hold_write_lock();
+        auto units = co_await _snapshot_lock.hold_write_lock();
         auto last_applied = last_applied_offset();
         snapshot result;
         if (_is_routing_partition) {
-            result.num_partitions = result.num_partitions;
+            result.num_partitions = _num_partitions;
             result.coordinators = _coordinators;
         }
         result.kv_data = _kvs;
+        // the copy is consistent, updates don't have to wait for it to be
+        // serialized
+        units.return_all();
         iobuf result_buf;
         co_await serde::write_async(result_buf, std::move(result));
         co_return raft::stm_snapshot::create(
@@ -231,14 +242,21 @@ public:
     }
 
     ss::future<errc> remove(Key key) {
+        absl::btree_set<Key> keys;
+        keys.insert(key);
+        return remove(std::move(keys));
+    }
+
+    ss::future<errc> remove(absl::btree_set<Key> keys) {
         auto holder = _gate.hold();
         auto units = co_await _snapshot_lock.hold_read_lock();
-        auto it = _kvs.find(key);
-        if (it == _kvs.end()) {
+        absl::erase_if(
+          keys, [this](const Key& key) { return !_kvs.contains(key); });
+        if (keys.empty()) {
             co_return errc::success;
         }
         co_return co_await replicate_and_wait(
-          make_kv_data_batch_remove_key<Key, Value>(key));
+          make_kv_data_batch_remove_keys<Key, Value>(keys));
     }
 
     ss::future<result<size_t, cluster::errc>>
@@ -342,9 +360,11 @@ private:
         co_return errc::success;
     }
 
+    // serde writes any map as its entries, the snapshots taken when these
+    // were btree maps still read
     using coordinator_assignment_t
-      = absl::btree_map<Key, coordinator_assignment_data>;
-    using kv_data_t = absl::btree_map<Key, Value>;
+      = absl::flat_hash_map<Key, coordinator_assignment_data>;
+    using kv_data_t = absl::flat_hash_map<Key, Value>;
 
     struct snapshot
       : serde::envelope<snapshot, serde::version<0>, serde::compat_version<0>> {
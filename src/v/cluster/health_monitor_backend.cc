@@ -48,7 +48,9 @@
 #include <fmt/ranges.h>
 
 #include <algorithm>
+#include <functional>
 #include <iterator>
+#include <limits>
 
 namespace cluster {
 
@@ -74,6 +76,8 @@ health_monitor_backend::health_monitor_backend(
   , _feature_table(feature_table)
   , _partition_leaders_table(partition_leaders_table)
   , _topic_table(topic_table)
+  , _next_report_version(random_generators::get_int<int64_t>(
+      0, std::numeric_limits<int64_t>::max() / 2))
   , _local_monitor(local_monitor) {
     _leadership_notification_handle
       = _raft_manager.local().register_leadership_notification(
@@ -371,6 +375,11 @@ health_monitor_backend::dispatch_refresh_cluster_health_request(
     storage::disk_space_alert cluster_disk_health
       = storage::disk_space_alert::ok;
     _reports.clear();
+    // the reports come from the leader, incremental reports can't be applied
+    // to them
+    for (auto& [_, status] : _last_replies) {
+        status.report_version = std::nullopt;
+    }
     for (auto& n_report : reply.value().report->node_reports) {
         const auto id = n_report.id;
 
@@ -495,6 +504,28 @@ health_monitor_backend::maybe_refresh_cluster_health(
 
 ss::future<result<node_health_report>>
 health_monitor_backend::collect_remote_node_health(model::node_id id) {
+    std::optional<health_report_version> acked_version;
+    if (auto it = _last_replies.find(id); it != _last_replies.end()) {
+        acked_version = it->second.report_version;
+    }
+    auto reply = co_await dispatch_node_health_request(id, acked_version);
+    if (
+      reply && reply.value().delta_base
+      && !holds_report_version(id, *reply.value().delta_base)) {
+        // the cached report changed while the request was in flight
+        vlog(
+          clusterlog.debug,
+          "unable to apply incremental health report from {}, requesting "
+          "full report",
+          id);
+        reply = co_await dispatch_node_health_request(id, std::nullopt);
+    }
+    co_return process_node_reply(id, std::move(reply));
+}
+
+ss::future<result<get_node_health_reply>>
+health_monitor_backend::dispatch_node_health_request(
+  model::node_id id, std::optional<health_report_version> acked_version) {
     const auto timeout = model::timeout_clock::now() + max_metadata_age();
     return _connections.local()
       .with_node_client<controller_client_protocol>(
@@ -502,15 +533,21 @@ health_monitor_backend::collect_remote_node_health(model::node_id id) {
         ss::this_shard_id(),
         id,
         max_metadata_age(),
-        [timeout](controller_client_protocol client) mutable {
+        [timeout, acked_version](controller_client_protocol client) mutable {
             return client.collect_node_health_report(
-              get_node_health_request{.filter = node_report_filter{}},
+              get_node_health_request{
+                .filter = node_report_filter{},
+                .acked_version = acked_version},
               rpc::client_opts(timeout));
         })
-      .then(&rpc::get_ctx_data<get_node_health_reply>)
-      .then([this, id](result<get_node_health_reply> reply) {
-          return process_node_reply(id, std::move(reply));
-      });
+      .then(&rpc::get_ctx_data<get_node_health_reply>);
+}
+
+bool health_monitor_backend::holds_report_version(
+  model::node_id id, health_report_version version) const {
+    auto it = _last_replies.find(id);
+    return it != _last_replies.end() && it->second.report_version == version
+           && _reports.contains(id);
 }
 
 result<node_health_report>
@@ -528,7 +565,18 @@ result<node_health_report> health_monitor_backend::process_node_reply(
   model::node_id id, result<get_node_health_reply> reply) {
     auto [it, _] = _last_replies.try_emplace(id);
 
-    auto res = map_reply_result(reply);
+    std::optional<health_report_version> version;
+    std::optional<topic_status_delta> delta;
+    if (reply && reply.value().report) {
+        version = reply.value().version;
+        if (reply.value().delta_base) {
+            delta = topic_status_delta{
+              .updated = std::move(reply.value().report->topics),
+              .removed = std::move(reply.value().removed_partitions)};
+        }
+    }
+
+    auto res = map_reply_result(std::move(reply));
     if (!res) {
         vlog(
           clusterlog.trace,
@@ -546,8 +594,24 @@ result<node_health_report> health_monitor_backend::process_node_reply(
               id,
               res.error().message());
         }
-        return result<node_health_report>(reply.error());
+        it->second.report_version = std::nullopt;
+        return result<node_health_report>(res.error());
+    }
+
+    if (delta) {
+        // merge the changes into a copy of the cached report, the previous
+        // report is still passed to the node callbacks
+        auto& cached = _reports.find(id)->second;
+        ss::chunked_fifo<topic_status> topics;
+        topics.reserve(cached.topics.size());
+        std::copy(
+          cached.topics.cbegin(),
+          cached.topics.cend(),
+          std::back_inserter(topics));
+        apply_topic_status_delta(topics, std::move(*delta));
+        res.value().topics = std::move(topics);
     }
+    it->second.report_version = version;
 
     // TODO serialize storage_space_alert, instead of recomputing here.
     auto& s = res.value().local_state;
@@ -654,6 +718,8 @@ health_monitor_backend::collect_current_node_health(node_report_filter filter) {
     ret.local_state.logical_version
       = features::feature_table::get_latest_logical_version();
 
+    ret.local_state.produce_bytes_rate = co_await collect_produce_bytes_rate();
+
     ret.drain_status = co_await _drain_manager.local().status();
     ret.include_drain_status = true;
 
@@ -664,6 +730,46 @@ health_monitor_backend::collect_current_node_health(node_report_filter filter) {
 
     co_return ret;
 }
+
+ss::future<result<get_node_health_reply>>
+health_monitor_backend::collect_current_node_health_update(
+  std::optional<health_report_version> acked_version) {
+    auto res = co_await collect_current_node_health(node_report_filter{});
+    if (res.has_error()) {
+        co_return res.error();
+    }
+    auto report = std::move(res.value());
+
+    const auto now = ss::lowres_clock::now();
+    const auto version = _next_report_version;
+    _next_report_version = health_report_version(version() + 1);
+
+    get_node_health_reply reply{.error = errc::success, .version = version};
+    const bool send_delta
+      = acked_version.has_value() && _sent_report.has_value()
+        && _sent_report->version == *acked_version
+        && now - _sent_report->last_full_report
+             < config::shard_local_cfg().health_monitor_full_report_interval();
+    if (send_delta) {
+        auto delta = diff_topic_status(_sent_report->topics, report.topics);
+        _sent_report->topics = std::move(report.topics);
+        report.topics = std::move(delta.updated);
+        reply.delta_base = acked_version;
+        reply.removed_partitions = std::move(delta.removed);
+    } else {
+        ss::chunked_fifo<topic_status> topics;
+        topics.reserve(report.topics.size());
+        std::copy(
+          report.topics.cbegin(),
+          report.topics.cend(),
+          std::back_inserter(topics));
+        _sent_report = sent_report{
+          .topics = std::move(topics), .last_full_report = now};
+    }
+    _sent_report->version = version;
+    reply.report = std::move(report);
+    co_return reply;
+}
 namespace {
 
 struct ntp_leader {
@@ -767,6 +873,50 @@ health_monitor_backend::collect_topic_status(partitions_filter filters) {
     co_return topics;
 }
 
+ss::future<std::optional<uint64_t>>
+health_monitor_backend::collect_produce_bytes_rate() {
+    // reports may be collected in quick succession, sample less often so
+    // that the rate isn't computed over a very short window
+    static constexpr auto min_sample_interval = 1s;
+
+    const auto now = ss::lowres_clock::now();
+    if (
+      _last_produce_sample
+      && now - _last_produce_sample->taken_at < min_sample_interval) {
+        co_return _produce_bytes_rate;
+    }
+
+    const uint64_t bytes_produced = co_await _partition_manager.map_reduce0(
+      [](partition_manager& pm) {
+          uint64_t total = 0;
+          for (const auto& [_, p] : pm.partitions()) {
+              total += p->probe().bytes_produced();
+          }
+          return total;
+      },
+      uint64_t{0},
+      std::plus<>());
+
+    if (_last_produce_sample) {
+        const auto elapsed_ms
+          = std::chrono::duration_cast<std::chrono::milliseconds>(
+              now - _last_produce_sample->taken_at)
+              .count();
+        // counters of partitions that moved away are gone, don't report a
+        // rate if the total went down
+        if (
+          elapsed_ms > 0
+          && bytes_produced >= _last_produce_sample->bytes_produced) {
+            _produce_bytes_rate = (bytes_produced
+                                   - _last_produce_sample->bytes_produced)
+                                  * 1000 / elapsed_ms;
+        }
+    }
+    _last_produce_sample = produce_sample{
+      .bytes_produced = bytes_produced, .taken_at = now};
+    co_return _produce_bytes_rate;
+}
+
 std::chrono::milliseconds health_monitor_backend::max_metadata_age() {
     return config::shard_local_cfg().health_monitor_max_metadata_age();
 }
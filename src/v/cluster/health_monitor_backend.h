@@ -71,6 +71,14 @@ public:
     ss::future<result<node_health_report>>
       collect_current_node_health(node_report_filter);
 
+    /**
+     * Collects the full report of this node for the controller leader. When
+     * the leader holds the last report sent by this node, only the partitions
+     * that changed since that report are included in the reply.
+     */
+    ss::future<result<get_node_health_reply>>
+      collect_current_node_health_update(std::optional<health_report_version>);
+
     cluster::notification_id_type register_node_callback(health_node_cb_t cb);
     void unregister_node_callback(cluster::notification_id_type id);
 
@@ -108,6 +116,18 @@ private:
         ss::lowres_clock::time_point last_reply_timestamp
           = ss::lowres_clock::time_point::min();
         alive is_alive = alive::no;
+        // version of the node report held in the reports cache
+        std::optional<health_report_version> report_version;
+    };
+
+    /**
+     * Partition statuses of the last report this node sent to the controller
+     * leader, incremental reports are computed against them
+     */
+    struct sent_report {
+        health_report_version version;
+        ss::chunked_fifo<topic_status> topics;
+        ss::lowres_clock::time_point last_full_report;
     };
 
     using status_cache_t = absl::node_hash_map<model::node_id, node_state>;
@@ -121,6 +141,9 @@ private:
     ss::future<std::error_code> collect_cluster_health();
     ss::future<result<node_health_report>>
       collect_remote_node_health(model::node_id);
+    ss::future<result<get_node_health_reply>> dispatch_node_health_request(
+      model::node_id, std::optional<health_report_version>);
+    bool holds_report_version(model::node_id, health_report_version) const;
     ss::future<std::error_code> maybe_refresh_cluster_health(
       force_refresh, model::timeout_clock::time_point);
     ss::future<std::error_code> refresh_cluster_health_cache(force_refresh);
@@ -135,6 +158,8 @@ private:
     ss::future<ss::chunked_fifo<topic_status>>
       collect_topic_status(partitions_filter);
 
+    ss::future<std::optional<uint64_t>> collect_produce_bytes_rate();
+
     void refresh_nodes_status();
 
     result<node_health_report>
@@ -196,6 +221,20 @@ private:
     last_reply_cache_t _last_replies;
     std::optional<size_t> _bytes_in_cloud_storage;
 
+    // bytes produced to the local partitions when the produce rate was last
+    // sampled, the rate is computed over the time between two samples
+    struct produce_sample {
+        uint64_t bytes_produced;
+        ss::lowres_clock::time_point taken_at;
+    };
+    std::optional<produce_sample> _last_produce_sample;
+    std::optional<uint64_t> _produce_bytes_rate;
+
+    std::optional<sent_report> _sent_report;
+    // versions start at a random value so that a report acknowledged before
+    // this node restarted doesn't match any of the reports sent after
+    health_report_version _next_report_version;
+
     ss::gate _gate;
     mutex _refresh_mutex;
     ss::sharded<node::local_monitor>& _local_monitor;
@@ -64,6 +64,15 @@ health_monitor_frontend::collect_node_health(node_report_filter f) {
       });
 }
 
+ss::future<result<get_node_health_reply>>
+health_monitor_frontend::collect_node_health_update(
+  std::optional<health_report_version> acked_version) {
+    return dispatch_to_backend(
+      [acked_version](health_monitor_backend& be) mutable {
+          return be.collect_current_node_health_update(acked_version);
+      });
+}
+
 // Return status of single node
 ss::future<result<std::vector<node_state>>>
 health_monitor_frontend::get_nodes_status(
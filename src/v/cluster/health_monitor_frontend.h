@@ -59,6 +59,11 @@ public:
     ss::future<result<node_health_report>>
       collect_node_health(node_report_filter);
 
+    // Collects the report of the current node for the controller leader,
+    // possibly as a delta against the report of the acknowledged version
+    ss::future<result<get_node_health_reply>>
+      collect_node_health_update(std::optional<health_report_version>);
+
     // Return status of all nodes
     ss::future<result<std::vector<node_state>>>
       get_nodes_status(model::timeout_clock::time_point);
@@ -20,6 +20,8 @@
 
 #include <seastar/core/chunked_fifo.hh>
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 #include <fmt/ostream.h>
 
 #include <algorithm>
@@ -124,6 +126,122 @@ bool operator==(const node_health_report& a, const node_health_report& b) {
              b.topics.cend());
 }
 
+namespace {
+template<typename V>
+using topic_map_t = absl::flat_hash_map<
+  model::topic_namespace,
+  V,
+  model::topic_namespace_hash,
+  model::topic_namespace_eq>;
+} // namespace
+
+topic_status_delta diff_topic_status(
+  const ss::chunked_fifo<topic_status>& base,
+  const ss::chunked_fifo<topic_status>& current) {
+    using partitions_t
+      = absl::flat_hash_map<model::partition_id, const partition_status*>;
+    topic_map_t<partitions_t> base_index;
+    for (const auto& t : base) {
+        auto& partitions = base_index[t.tp_ns];
+        partitions.reserve(t.partitions.size());
+        for (const auto& p : t.partitions) {
+            partitions.emplace(p.id, &p);
+        }
+    }
+
+    topic_status_delta delta;
+    for (const auto& t : current) {
+        auto topic_it = base_index.find(t.tp_ns);
+        ss::chunked_fifo<partition_status> changed;
+        for (const auto& p : t.partitions) {
+            if (topic_it != base_index.end()) {
+                auto p_it = topic_it->second.find(p.id);
+                if (p_it != topic_it->second.end()) {
+                    const bool unchanged = *p_it->second == p;
+                    // what is left in the index after the loop was removed
+                    topic_it->second.erase(p_it);
+                    if (unchanged) {
+                        continue;
+                    }
+                }
+            }
+            changed.push_back(p);
+        }
+        if (!changed.empty()) {
+            delta.updated.emplace_back(t.tp_ns, std::move(changed));
+        }
+    }
+
+    for (const auto& [tp_ns, partitions] : base_index) {
+        for (const auto& [id, _] : partitions) {
+            delta.removed.emplace_back(tp_ns.ns, tp_ns.tp, id);
+        }
+    }
+    return delta;
+}
+
+void apply_topic_status_delta(
+  ss::chunked_fifo<topic_status>& topics, topic_status_delta delta) {
+    // chunked_fifo doesn't move its elements when growing, the pointers stay
+    // valid while statuses are appended
+    topic_map_t<topic_status*> index;
+    index.reserve(topics.size());
+    for (auto& t : topics) {
+        index.emplace(t.tp_ns, &t);
+    }
+
+    for (auto& t : delta.updated) {
+        auto it = index.find(t.tp_ns);
+        if (it == index.end()) {
+            topics.push_back(std::move(t));
+            continue;
+        }
+        auto& partitions = it->second->partitions;
+        absl::flat_hash_map<model::partition_id, partition_status*> by_id;
+        by_id.reserve(partitions.size());
+        for (auto& p : partitions) {
+            by_id.emplace(p.id, &p);
+        }
+        for (auto& p : t.partitions) {
+            if (auto p_it = by_id.find(p.id); p_it != by_id.end()) {
+                *p_it->second = p;
+            } else {
+                partitions.push_back(p);
+            }
+        }
+    }
+
+    if (delta.removed.empty()) {
+        return;
+    }
+
+    topic_map_t<absl::flat_hash_set<model::partition_id>> removed;
+    for (const auto& ntp : delta.removed) {
+        removed[model::topic_namespace(ntp.ns, ntp.tp.topic)].insert(
+          ntp.tp.partition);
+    }
+    ss::chunked_fifo<topic_status> result;
+    result.reserve(topics.size());
+    for (auto& t : topics) {
+        auto it = removed.find(t.tp_ns);
+        if (it == removed.end()) {
+            result.push_back(std::move(t));
+            continue;
+        }
+        ss::chunked_fifo<partition_status> kept;
+        for (auto& p : t.partitions) {
+            if (!it->second.contains(p.id)) {
+                kept.push_back(p);
+            }
+        }
+        if (!kept.empty()) {
+            t.partitions = std::move(kept);
+            result.push_back(std::move(t));
+        }
+    }
+    topics = std::move(result);
+}
+
 std::ostream& operator<<(std::ostream& o, const cluster_health_report& r) {
     fmt::print(
       o,
@@ -232,12 +350,24 @@ std::ostream& operator<<(std::ostream& o, const partitions_filter& filter) {
 
 std::ostream& operator<<(std::ostream& o, const get_node_health_request& r) {
     fmt::print(
-      o, "{{filter: {}, current_version: {}}}", r.filter, r.current_version);
+      o,
+      "{{filter: {}, current_version: {}, acked_version: {}}}",
+      r.filter,
+      r.current_version,
+      r.acked_version);
     return o;
 }
 
 std::ostream& operator<<(std::ostream& o, const get_node_health_reply& r) {
-    fmt::print(o, "{{error: {}, report: {}}}", r.error, r.report);
+    fmt::print(
+      o,
+      "{{error: {}, report: {}, version: {}, delta_base: {}, "
+      "removed_partitions: {}}}",
+      r.error,
+      r.report,
+      r.version,
+      r.delta_base,
+      r.removed_partitions);
     return o;
 }
 
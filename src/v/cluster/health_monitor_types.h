@@ -25,6 +25,7 @@
 #include <absl/container/node_hash_set.h>
 
 #include <chrono>
+#include <vector>
 
 namespace cluster {
 
@@ -101,6 +102,7 @@ struct partition_status
 struct topic_status
   : serde::envelope<topic_status, serde::version<0>, serde::compat_version<0>> {
     static constexpr int8_t current_version = 0;
+    static constexpr auto redpanda_serde_async = true;
 
     topic_status() = default;
     topic_status(model::topic_namespace, ss::chunked_fifo<partition_status>);
@@ -128,6 +130,9 @@ struct node_health_report
       serde::version<0>,
       serde::compat_version<0>> {
     static constexpr int8_t current_version = 2;
+    // reports of nodes with many partitions are several megabytes, they are
+    // serialized asynchronously not to stall the reactor
+    static constexpr auto redpanda_serde_async = true;
 
     node_health_report() = default;
 
@@ -188,11 +193,40 @@ struct node_health_report
     operator==(const node_health_report& a, const node_health_report& b);
 };
 
+/**
+ * Version of the health report last sent by a node. Nodes use it to send
+ * only the changes since the report the controller leader already holds.
+ */
+using health_report_version
+  = named_type<int64_t, struct health_report_version_tag>;
+
+/**
+ * Difference between the partition statuses of two health reports of a node
+ */
+struct topic_status_delta {
+    // partitions that are new or whose status changed, grouped by topic
+    ss::chunked_fifo<topic_status> updated;
+    // partitions that are not reported anymore
+    std::vector<model::ntp> removed;
+};
+
+topic_status_delta diff_topic_status(
+  const ss::chunked_fifo<topic_status>& base,
+  const ss::chunked_fifo<topic_status>& current);
+
+/**
+ * Applies the delta to the partition statuses it was computed against
+ */
+void apply_topic_status_delta(
+  ss::chunked_fifo<topic_status>& topics, topic_status_delta delta);
+
 struct cluster_health_report
   : serde::envelope<
       cluster_health_report,
       serde::version<1>,
       serde::compat_version<0>> {
+    static constexpr auto redpanda_serde_async = true;
+
     std::optional<model::node_id> raft0_leader;
     // we split node status from node health reports since node status is a
     // cluster wide property (currently based on raft0 follower state)
@@ -324,7 +358,7 @@ using force_refresh = ss::bool_class<struct hm_force_refresh_tag>;
 struct get_node_health_request
   : serde::envelope<
       get_node_health_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
     static constexpr int8_t initial_version = 0;
@@ -338,6 +372,9 @@ struct get_node_health_request
     node_report_filter filter;
     // this field is not serialized
     int8_t decoded_version = current_version;
+    // version of the last report of the node held by the requester, if set
+    // the node may reply with the changes since that report
+    std::optional<health_report_version> acked_version;
 
     friend bool
     operator==(const get_node_health_request&, const get_node_health_request&)
@@ -346,19 +383,27 @@ struct get_node_health_request
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_request&);
 
-    auto serde_fields() { return std::tie(filter); }
+    auto serde_fields() { return std::tie(filter, acked_version); }
 };
 
 struct get_node_health_reply
   : serde::envelope<
       get_node_health_reply,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
+    static constexpr auto redpanda_serde_async = true;
     static constexpr int8_t current_version = 0;
 
     errc error = cluster::errc::success;
     std::optional<node_health_report> report;
+    // version of the report, not set by nodes that always send full reports
+    std::optional<health_report_version> version;
+    // when set, the report only contains the partitions that changed since
+    // the report of this version and removed_partitions lists the partitions
+    // that the node doesn't report anymore
+    std::optional<health_report_version> delta_base;
+    std::vector<model::ntp> removed_partitions;
 
     friend bool
     operator==(const get_node_health_reply&, const get_node_health_reply&)
@@ -367,7 +412,10 @@ struct get_node_health_reply
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_reply&);
 
-    auto serde_fields() { return std::tie(error, report); }
+    auto serde_fields() {
+        return std::tie(
+          error, report, version, delta_base, removed_partitions);
+    }
 };
 
 struct get_cluster_health_request
@@ -421,6 +469,7 @@ struct get_cluster_health_reply
       serde::version<0>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
+    static constexpr auto redpanda_serde_async = true;
     static constexpr int8_t current_version = 0;
 
     errc error = cluster::errc::success;
@@ -25,6 +25,7 @@
 #include "model/namespace.h"
 #include "model/record_batch_reader.h"
 #include "rpc/connection_cache.h"
+#include "ssx/future-util.h"
 #include "vformat.h"
 
 #include <seastar/core/coroutine.hh>
@@ -138,7 +139,9 @@ ss::future<allocate_id_reply>
 allocate_id_handler::process(ss::shard_id shard, allocate_id_request req) {
     auto timeout = req.timeout;
     return _partition_manager.invoke_on(
-      shard, _ssg, [timeout](cluster::partition_manager& mgr) mutable {
+      shard,
+      _ssg,
+      [timeout, count = req.count](cluster::partition_manager& mgr) mutable {
           auto partition = mgr.get(model::id_allocator_ntp);
           if (!partition) {
               vlog(
@@ -157,8 +160,8 @@ allocate_id_handler::process(ss::shard_id shard, allocate_id_request req) {
               return ss::make_ready_future<allocate_id_reply>(
                 allocate_id_reply{0, errc::topic_not_exists});
           }
-          return stm->allocate_id(timeout).then(
-            [](id_allocator_stm::stm_allocation_result r) {
+          return stm->allocate_id_range(count, timeout)
+            .then([](id_allocator_stm::stm_allocation_result r) {
                 if (r.raft_status != raft::errc::success) {
                     vlog(
                       clusterlog.warn,
@@ -167,7 +170,7 @@ allocate_id_handler::process(ss::shard_id shard, allocate_id_request req) {
                     return allocate_id_reply{r.id, errc::replication_error};
                 }
 
-                return allocate_id_reply{r.id, errc::success};
+                return allocate_id_reply{r.id, errc::success, r.count};
             });
       });
 }
@@ -202,13 +205,117 @@ id_allocator_frontend::id_allocator_frontend(
       leaders,
       node_id) {}
 
+ss::future<> id_allocator_frontend::stop() {
+    co_await _gate.close();
+    co_await _allocator_router.shutdown();
+}
+
 ss::future<allocate_id_reply>
 id_allocator_frontend::allocate_id(model::timeout_clock::duration timeout) {
+    const int64_t range_size
+      = config::shard_local_cfg().id_allocator_node_cache_size();
+    if (range_size <= 1) {
+        co_return co_await do_allocate_id_range(1, timeout);
+    }
+
+    if (auto id = take_cached_id(); id) {
+        maybe_refill_cache_in_background(range_size, timeout);
+        co_return allocate_id_reply{*id, errc::success};
+    }
+
+    auto holder = _gate.hold();
+    auto units = co_await _refill_lock.get_units();
+    // the requests waiting on the lock are served by the range reserved by
+    // whichever of them took it first
+    if (auto id = take_cached_id(); id) {
+        maybe_refill_cache_in_background(range_size, timeout);
+        co_return allocate_id_reply{*id, errc::success};
+    }
+    auto reply = co_await refill_cache(range_size, timeout);
+    if (reply.ec != errc::success) {
+        co_return reply;
+    }
+    // the range isn't cached when the next id was reset while it was being
+    // reserved, its first id is still ours as it was allocated before the
+    // reset
+    co_return allocate_id_reply{take_cached_id().value_or(reply.id), reply.ec};
+}
+
+std::optional<int64_t> id_allocator_frontend::take_cached_id() {
+    while (!_cached_ranges.empty()) {
+        auto& range = _cached_ranges.front();
+        if (range.next < range.end) {
+            return range.next++;
+        }
+        _cached_ranges.pop_front();
+    }
+    return std::nullopt;
+}
+
+int64_t id_allocator_frontend::cached_ids() const {
+    int64_t n = 0;
+    for (const auto& range : _cached_ranges) {
+        n += range.end - range.next;
+    }
+    return n;
+}
+
+void id_allocator_frontend::maybe_refill_cache_in_background(
+  int64_t range_size, model::timeout_clock::duration timeout) {
+    const auto low_watermark = range_size / 5;
+    if (_background_refill || cached_ids() > low_watermark) {
+        return;
+    }
+    _background_refill = true;
+    ssx::spawn_with_gate(_gate, [this, range_size, timeout, low_watermark] {
+        return _refill_lock
+          .with([this, range_size, timeout, low_watermark] {
+              if (cached_ids() > low_watermark) {
+                  return ss::now();
+              }
+              return refill_cache(range_size, timeout)
+                .then([](allocate_id_reply reply) {
+                    if (reply.ec != errc::success) {
+                        vlog(
+                          clusterlog.debug,
+                          "background reservation of producer ids failed: {}",
+                          make_error_code(reply.ec).message());
+                    }
+                });
+          })
+          .handle_exception([](const std::exception_ptr& e) {
+              vlog(
+                clusterlog.debug,
+                "background reservation of producer ids failed: {}",
+                e);
+          })
+          .finally([this] { _background_refill = false; });
+    });
+}
+
+ss::future<allocate_id_reply> id_allocator_frontend::refill_cache(
+  int64_t range_size, model::timeout_clock::duration timeout) {
+    const auto generation = _cache_generation;
+    auto reply = co_await do_allocate_id_range(range_size, timeout);
+    if (reply.ec == errc::success && generation == _cache_generation) {
+        _cached_ranges.push_back(
+          id_range{.next = reply.id, .end = reply.id + reply.count});
+    }
+    co_return reply;
+}
+
+ss::future<allocate_id_reply> id_allocator_frontend::do_allocate_id_range(
+  int64_t count, model::timeout_clock::duration timeout) {
     if (!co_await ensure_id_allocator_topic_exists()) {
         co_return allocate_id_reply{0, errc::topic_not_exists};
     }
     co_return co_await _allocator_router.allocate_router::process_or_dispatch(
-      allocate_id_request{timeout}, model::id_allocator_ntp, timeout);
+      allocate_id_request{timeout, count}, model::id_allocator_ntp, timeout);
+}
+
+void id_allocator_frontend::clear_cache() {
+    _cached_ranges.clear();
+    ++_cache_generation;
 }
 
 ss::future<reset_id_allocator_reply> id_allocator_frontend::reset_next_id(
@@ -216,10 +323,17 @@ ss::future<reset_id_allocator_reply> id_allocator_frontend::reset_next_id(
     if (!co_await ensure_id_allocator_topic_exists()) {
         co_return reset_id_allocator_reply{errc::topic_not_exists};
     }
-    co_return co_await _id_reset_router.reset_id_router::process_or_dispatch(
-      reset_id_allocator_request{timeout, pid},
-      model::id_allocator_ntp,
-      timeout);
+    auto reply
+      = co_await _id_reset_router.reset_id_router::process_or_dispatch(
+        reset_id_allocator_request{timeout, pid},
+        model::id_allocator_ntp,
+        timeout);
+    if (reply.ec == errc::success) {
+        // the ids reserved before the reset are not to be handed out
+        co_await container().invoke_on_all(
+          [](id_allocator_frontend& f) { f.clear_cache(); });
+    }
+    co_return reply;
 }
 
 ss::future<bool> id_allocator_frontend::try_create_id_allocator_topic() {
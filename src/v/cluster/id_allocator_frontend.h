@@ -14,11 +14,15 @@
 #include "cluster/leader_router.h"
 #include "cluster/types.h"
 #include "rpc/fwd.h"
+#include "utils/mutex.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
 
+#include <deque>
+#include <optional>
 #include <vector>
 
 namespace cluster {
@@ -133,7 +137,13 @@ private:
 //
 // when the service recieves a call it triggers id_allocator_frontend
 // which in its own turn pass the request to the id_allocator_stm
-class id_allocator_frontend {
+//
+// as a round trip to the leader per producer adds up when many producers
+// are initialized at once, each shard reserves ranges of consecutive ids
+// (id_allocator_node_cache_size) and serves the ids of the ranges locally.
+// the next range is reserved in the background once the ids left run low.
+class id_allocator_frontend
+  : public ss::peering_sharded_service<id_allocator_frontend> {
 public:
     id_allocator_frontend(
       ss::smp_service_group,
@@ -151,7 +161,7 @@ public:
     ss::future<reset_id_allocator_reply>
     reset_next_id(model::producer_id, model::timeout_clock::duration timeout);
 
-    ss::future<> stop() { return _allocator_router.shutdown(); }
+    ss::future<> stop();
 
     allocate_id_router& allocator_router() { return _allocator_router; }
     reset_id_router& id_reset_router() { return _id_reset_router; }
@@ -165,6 +175,30 @@ private:
     allocate_id_router _allocator_router;
     reset_id_router _id_reset_router;
 
+    // ids reserved by this shard and not handed out yet, [next, end)
+    struct id_range {
+        int64_t next;
+        int64_t end;
+    };
+    std::deque<id_range> _cached_ranges;
+    // serializes the reservations of ranges
+    mutex _refill_lock{"cluster/id-allocator-refill"};
+    // incremented when the cached ranges are dropped, the ranges reserved
+    // across it are not to be cached
+    uint64_t _cache_generation{0};
+    bool _background_refill{false};
+    ss::gate _gate;
+
+    std::optional<int64_t> take_cached_id();
+    int64_t cached_ids() const;
+    void clear_cache();
+    void maybe_refill_cache_in_background(
+      int64_t range_size, model::timeout_clock::duration);
+    ss::future<allocate_id_reply>
+      refill_cache(int64_t range_size, model::timeout_clock::duration);
+    ss::future<allocate_id_reply>
+      do_allocate_id_range(int64_t count, model::timeout_clock::duration);
+
     // Sets the underlying stm's next id to the given id, returning an error if
     // there was a problem (e.g. not leader, timed out, etc).
     ss::future<allocate_id_reply>
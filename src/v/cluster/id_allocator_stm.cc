@@ -21,6 +21,8 @@
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
 
+#include <algorithm>
+
 namespace cluster {
 
 template<typename T>
@@ -119,15 +121,24 @@ ss::future<bool> id_allocator_stm::set_state(
 
 ss::future<id_allocator_stm::stm_allocation_result>
 id_allocator_stm::allocate_id(model::timeout_clock::duration timeout) {
+    return allocate_id_range(1, timeout);
+}
+
+ss::future<id_allocator_stm::stm_allocation_result>
+id_allocator_stm::allocate_id_range(
+  int64_t count, model::timeout_clock::duration timeout) {
     return _lock
-      .with(timeout, [this, timeout]() { return do_allocate_id(timeout); })
+      .with(
+        timeout,
+        [this, count, timeout]() { return do_allocate_id(count, timeout); })
       .handle_exception_type([](const ss::semaphore_timed_out&) {
           return stm_allocation_result{-1, raft::errc::timeout};
       });
 }
 
 ss::future<id_allocator_stm::stm_allocation_result>
-id_allocator_stm::do_allocate_id(model::timeout_clock::duration timeout) {
+id_allocator_stm::do_allocate_id(
+  int64_t count, model::timeout_clock::duration timeout) {
     if (!co_await sync(timeout)) {
         co_return stm_allocation_result{-1, raft::errc::timeout};
     }
@@ -141,11 +152,12 @@ id_allocator_stm::do_allocate_id(model::timeout_clock::duration timeout) {
     }
 
     auto id = _curr_id;
+    count = std::clamp<int64_t>(count, 1, _curr_batch);
 
-    _curr_id += 1;
-    _curr_batch -= 1;
+    _curr_id += count;
+    _curr_batch -= count;
 
-    co_return stm_allocation_result{id, raft::errc::success};
+    co_return stm_allocation_result{id, raft::errc::success, count};
 }
 
 ss::future<> id_allocator_stm::apply(const model::record_batch& b) {
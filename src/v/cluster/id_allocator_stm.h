@@ -37,6 +37,8 @@ public:
     struct stm_allocation_result {
         int64_t id;
         raft::errc raft_status{raft::errc::success};
+        // number of consecutive ids allocated starting at `id`
+        int64_t count{1};
     };
 
     explicit id_allocator_stm(ss::logger&, raft::consensus*);
@@ -47,6 +49,13 @@ public:
     ss::future<stm_allocation_result>
     allocate_id(model::timeout_clock::duration timeout);
 
+    // Allocates up to `count` consecutive ids. Fewer are allocated when the
+    // ids left in the current batch don't cover the request: ranges never
+    // span batches so that serving them never touches the log more than
+    // once.
+    ss::future<stm_allocation_result>
+    allocate_id_range(int64_t count, model::timeout_clock::duration timeout);
+
     std::string_view get_name() const final { return "id_allocator_stm"; }
     ss::future<iobuf> take_snapshot(model::offset) final { co_return iobuf{}; }
 
@@ -99,7 +108,7 @@ private:
     };
 
     ss::future<stm_allocation_result>
-      do_allocate_id(model::timeout_clock::duration);
+      do_allocate_id(int64_t, model::timeout_clock::duration);
     ss::future<bool> set_state(int64_t, model::timeout_clock::duration);
 
     ss::future<> apply(const model::record_batch&) final;
@@ -15,6 +15,9 @@
 #include "raft/consensus.h"
 #include "raft/types.h"
 #include "serde/serde.h"
+#include "storage/log.h"
+#include "storage/segment.h"
+#include "storage/segment_set.h"
 
 #include <seastar/core/future-util.hh>
 #include <seastar/core/sleep.hh>
@@ -84,8 +87,7 @@ ss::future<> log_eviction_stm::handle_log_eviction_events() {
             break;
         }
 
-        auto evict_until = std::max(
-          _delete_records_eviction_offset, _storage_eviction_offset);
+        auto evict_until = eviction_target();
         if (_raft->last_snapshot_index() >= evict_until) {
             previous_iter_truncated_everything = true;
             continue;
@@ -129,6 +131,38 @@ ss::future<> log_eviction_stm::handle_log_eviction_events() {
     }
 }
 
+model::offset log_eviction_stm::eviction_target() const {
+    if (_delete_records_eviction_offset <= _storage_eviction_offset) {
+        return _storage_eviction_offset;
+    }
+    /// The start offset requested by delete-records is already enforced by
+    /// the start offset override, only the segments it covers in full are
+    /// worth removing. Stopping at their end keeps requests that land within
+    /// a segment from each paying for a raft snapshot and a prefix truncation
+    /// of the log, the remainder is removed once a later request or the
+    /// storage layer moves past the segment.
+    return std::max(
+      last_covered_segment_offset(_delete_records_eviction_offset),
+      _storage_eviction_offset);
+}
+
+model::offset
+log_eviction_stm::last_covered_segment_offset(model::offset o) const {
+    const auto& segs = _raft->log()->segments();
+    auto it = segs.lower_bound(o);
+    if (it == segs.end()) {
+        return segs.empty() ? model::offset{}
+                            : segs.back()->offsets().dirty_offset;
+    }
+    if ((*it)->offsets().dirty_offset == o) {
+        return o;
+    }
+    if (it == segs.begin()) {
+        return model::offset{};
+    }
+    return (*std::prev(it))->offsets().dirty_offset;
+}
+
 ss::future<model::offset> log_eviction_stm::storage_eviction_event() {
     return _raft->monitor_log_eviction(_as);
 }
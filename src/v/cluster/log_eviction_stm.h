@@ -121,6 +121,8 @@ private:
     ss::future<> monitor_log_eviction();
     ss::future<> do_write_raft_snapshot(model::offset);
     ss::future<> handle_log_eviction_events();
+    model::offset eviction_target() const;
+    model::offset last_covered_segment_offset(model::offset) const;
     ss::future<> apply(const model::record_batch&) final;
     ss::future<> apply_raft_snapshot(const iobuf&) final;
 
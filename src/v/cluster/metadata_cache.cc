@@ -372,4 +372,25 @@ const topic_disabled_partitions_set* metadata_cache::get_topic_disabled_set(
     return _topics_state.local().get_topic_disabled_set(ns_tp);
 }
 
+notification_id_type metadata_cache::register_topic_delta_notification(
+  topic_table::delta_cb_t cb) {
+    return _topics_state.local().register_delta_notification(std::move(cb));
+}
+
+void metadata_cache::unregister_topic_delta_notification(
+  notification_id_type id) {
+    _topics_state.local().unregister_delta_notification(id);
+}
+
+notification_id_type metadata_cache::register_leaders_update_notification(
+  partition_leaders_table::leaders_update_cb_t cb) {
+    return _leaders.local().register_leaders_update_notification(
+      std::move(cb));
+}
+
+void metadata_cache::unregister_leaders_update_notification(
+  notification_id_type id) {
+    _leaders.local().unregister_leaders_update_notification(id);
+}
+
 } // namespace cluster
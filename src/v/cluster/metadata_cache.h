@@ -204,6 +204,15 @@ public:
     const topic_disabled_partitions_set*
       get_topic_disabled_set(model::topic_namespace_view) const;
 
+    /// Notifications of the changes of the local topics and leaders state,
+    /// for the users caching what they derive from it
+    notification_id_type
+      register_topic_delta_notification(topic_table::delta_cb_t);
+    void unregister_topic_delta_notification(notification_id_type);
+    notification_id_type register_leaders_update_notification(
+      partition_leaders_table::leaders_update_cb_t);
+    void unregister_leaders_update_notification(notification_id_type);
+
 private:
     ss::sharded<topic_table>& _topics_state;
     ss::sharded<members_table>& _members_table;
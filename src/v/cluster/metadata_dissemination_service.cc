@@ -173,30 +173,50 @@ void metadata_dissemination_service::handle_leadership_notification(
       });
 }
 
-ss::future<> metadata_dissemination_service::apply_leadership_notification(
+void metadata_dissemination_service::apply_leadership_notification(
   model::ntp ntp,
   model::revision_id revision,
   model::term_id term,
   std::optional<model::node_id> lid) {
-    // the gate also needs to be taken on the destination core.
-    return ss::with_gate(
-      _bg, [this, ntp = std::move(ntp), lid, revision, term]() mutable {
-          // update partition leaders
-          vlog(clusterlog.trace, "updating {} leadership locally", ntp);
-          auto f = _leaders.invoke_on_all(
-            [ntp, lid, revision, term](partition_leaders_table& leaders) {
-                leaders.update_partition_leader(ntp, revision, term, lid);
-            });
-          if (lid == _self.id()) {
-              // only disseminate from current leader
-              f = f.then(
-                [this, ntp = std::move(ntp), term, lid, revision]() mutable {
-                    return disseminate_leadership(
-                      std::move(ntp), revision, term, lid);
-                });
-          }
-          return f;
-      });
+    if (_bg.is_closed()) {
+        return;
+    }
+    if (lid == _self.id()) {
+        // only disseminate from current leader
+        disseminate_leadership(ntp, revision, term, lid);
+    }
+    _leadership_updates.emplace_back(std::move(ntp), term, lid, revision);
+    if (!_leadership_flush_pending) {
+        _leadership_flush_pending = true;
+        ssx::spawn_with_gate(
+          _bg, [this] { return flush_leadership_updates(); });
+    }
+}
+
+ss::future<> metadata_dissemination_service::flush_leadership_updates() {
+    // batches are applied one after another so that the updates of a
+    // partition can not be reordered on any shard
+    while (!_leadership_updates.empty()) {
+        // let the notifications that are already queued join the batch
+        co_await ss::yield();
+        auto updates = std::exchange(_leadership_updates, {});
+        vlog(clusterlog.trace, "updating {} leaders locally", updates.size());
+        try {
+            co_await _leaders.invoke_on_all(
+              [&updates](partition_leaders_table& leaders) {
+                  for (const auto& u : updates) {
+                      leaders.update_partition_leader(
+                        u.ntp, u.revision, u.term, u.leader_id);
+                  }
+              });
+        } catch (...) {
+            vlog(
+              clusterlog.warn,
+              "failed to update partition leaders - {}",
+              std::current_exception());
+        }
+    }
+    _leadership_flush_pending = false;
 }
 
 static inline ss::future<>
@@ -292,8 +312,52 @@ metadata_dissemination_service::dispatch_get_metadata_update(
       });
 }
 
+/// Keeps only the latest update of every partition. The updates are kept in
+/// the order in which their partitions were first updated.
+static void
+coalesce_leadership_updates(ss::chunked_fifo<ntp_leader_revision>& updates) {
+    if (updates.size() < 2) {
+        return;
+    }
+    absl::flat_hash_map<model::ntp, ntp_leader_revision> latest;
+    latest.reserve(updates.size());
+    for (const auto& u : updates) {
+        auto [it, inserted] = latest.try_emplace(u.ntp, u);
+        if (
+          !inserted
+          && std::tie(u.revision, u.term)
+               >= std::tie(it->second.revision, it->second.term)) {
+            it->second = u;
+        }
+    }
+    if (latest.size() == updates.size()) {
+        return;
+    }
+
+    ss::chunked_fifo<ntp_leader_revision> coalesced;
+    coalesced.reserve(latest.size());
+    for (const auto& u : updates) {
+        auto it = latest.find(u.ntp);
+        if (it != latest.end()) {
+            coalesced.push_back(std::move(it->second));
+            latest.erase(it);
+        }
+    }
+    updates = std::move(coalesced);
+}
+
 void metadata_dissemination_service::collect_pending_updates() {
+    // during an election storm a partition may change its leader many times
+    // in a single dissemination interval, only the latest change is sent
+    coalesce_leadership_updates(_requests);
     auto brokers = _members_table.local().node_ids();
+    // peers that still have undelivered updates from the previous rounds
+    absl::flat_hash_set<model::node_id> with_leftovers;
+    for (const auto& [id, meta] : _pending_updates) {
+        if (!meta.updates.empty()) {
+            with_leftovers.insert(id);
+        }
+    }
     for (auto& ntp_leader : _requests) {
         auto assignment = _topics.local().get_partition_assignment(
           ntp_leader.ntp);
@@ -321,6 +385,9 @@ void metadata_dissemination_service::collect_pending_updates() {
         }
     }
     _requests.clear();
+    for (auto id : with_leftovers) {
+        coalesce_leadership_updates(_pending_updates[id].updates);
+    }
 }
 
 void metadata_dissemination_service::cleanup_finished_updates() {
@@ -433,7 +500,8 @@ ss::future<> metadata_dissemination_service::dispatch_one_update(
               .update_leadership_v2(
                 update_leadership_request_v2(std::move(updates)),
                 rpc::client_opts(
-                  _dissemination_interval + rpc::clock_type::now()))
+                  rpc::timeout_spec::from_now(_dissemination_interval),
+                  rpc::compression_type::zstd))
               .then(&rpc::get_ctx_data<update_leadership_reply>);
         })
       .then([target_id, &meta](result<update_leadership_reply> r) {
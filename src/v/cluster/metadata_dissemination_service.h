@@ -121,11 +121,12 @@ private:
       model::revision_id,
       model::term_id,
       std::optional<model::node_id>);
-    ss::future<> apply_leadership_notification(
+    void apply_leadership_notification(
       model::ntp,
       model::revision_id,
       model::term_id,
       std::optional<model::node_id>);
+    ss::future<> flush_leadership_updates();
 
     void collect_pending_updates();
     void cleanup_finished_updates();
@@ -156,6 +157,10 @@ private:
     ss::chunked_fifo<ntp_leader_revision> _requests;
     std::vector<net::unresolved_address> _seed_servers;
     broker_updates_t _pending_updates;
+    // leadership notifications of this node waiting to be applied to the
+    // partition leaders tables of all shards in a single batch
+    ss::chunked_fifo<ntp_leader_revision> _leadership_updates;
+    bool _leadership_flush_pending{false};
     mutex _lock;
     ss::timer<> _dispatch_timer;
     ss::abort_source _as;
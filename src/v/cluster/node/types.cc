@@ -35,13 +35,14 @@ std::ostream& operator<<(std::ostream& o, const local_state& s) {
     fmt::print(
       o,
       "{{redpanda_version: {}, uptime: {}, data_disk: {}, cache_disk: {} log "
-      "data {}, recovery_mode_enabled: {}}}",
+      "data {}, recovery_mode_enabled: {}, produce_bytes_rate: {}}}",
       s.redpanda_version,
       s.uptime,
       s.data_disk,
       s.cache_disk,
       s.log_data_size,
-      s.recovery_mode_enabled);
+      s.recovery_mode_enabled,
+      s.produce_bytes_rate);
     return o;
 }
 
@@ -78,6 +79,11 @@ void local_state::serde_read(iobuf_parser& in, const serde::header& h) {
     if (h._version >= 3) {
         recovery_mode_enabled = serde::read_nested<bool>(in, 0);
     }
+
+    if (h._version >= 4) {
+        produce_bytes_rate = serde::read_nested<std::optional<uint64_t>>(
+          in, 0);
+    }
 }
 
 void local_state::serde_write(iobuf& out) const {
@@ -88,6 +94,7 @@ void local_state::serde_write(iobuf& out) const {
     serde::write(out, get_disk_alert());
     serde::write(out, log_data_size);
     serde::write(out, recovery_mode_enabled);
+    serde::write(out, produce_bytes_rate);
 }
 
 storage::disk_space_alert local_state::get_disk_alert() const {
@@ -36,7 +36,7 @@ using application_version = named_type<ss::sstring, struct version_number_tag>;
  * A snapshot of node-local state: i.e. things that don't depend on consensus.
  */
 struct local_state
-  : serde::envelope<local_state, serde::version<3>, serde::compat_version<0>> {
+  : serde::envelope<local_state, serde::version<4>, serde::compat_version<0>> {
     application_version redpanda_version;
     cluster_version logical_version{invalid_version};
     std::chrono::milliseconds uptime;
@@ -116,6 +116,11 @@ struct local_state
     // True if the node has been booted up in recovery mode.
     bool recovery_mode_enabled = false;
 
+    // Rate (in bytes per second) at which data is produced to the partitions
+    // led by the node. Used to spread load when placing replicas. Not set if
+    // the rate is not yet known.
+    std::optional<uint64_t> produce_bytes_rate;
+
     void serde_read(iobuf_parser&, const serde::header&);
     void serde_write(iobuf& out) const;
 
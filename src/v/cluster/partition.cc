@@ -25,6 +25,7 @@
 #include "prometheus/prometheus_sanitize.h"
 #include "raft/state_machine_manager.h"
 #include "raft/types.h"
+#include "resource_mgmt/memory_accounting.h"
 
 #include <seastar/coroutine/as_future.hh>
 #include <seastar/util/defer.hh>
@@ -63,7 +64,8 @@ partition::partition(
   std::optional<cloud_storage_clients::bucket_name> read_replica_bucket)
   : _raft(std::move(r))
   , _partition_mem_tracker(
-      ss::make_shared<util::mem_tracker>(_raft->ntp().path()))
+      resources::memory_accounting::local().create_tracker(
+        resources::memory_subsystem::cloud_manifests, _raft->ntp().path()))
   , _probe(std::make_unique<replicated_partition_probe>(*this))
   , _tx_gateway_frontend(tx_gateway_frontend)
   , _feature_table(feature_table)
@@ -81,9 +81,25 @@ public:
     absl::flat_hash_set<model::node_id> timed_out_unavailable_nodes;
     absl::flat_hash_set<model::node_id> decommissioning_nodes;
     absl::flat_hash_map<model::node_id, node_disk_space> node_disk_reports;
+    // only filled if all nodes reported their produce rate
+    absl::flat_hash_map<model::node_id, uint64_t> node_produce_rates;
 
+    using partition_filter = ss::noncopyable_function<bool(
+      const model::topic_namespace&, const partition_assignment&)>;
+
+    ss::future<> for_each_partition(
+      ss::noncopyable_function<ss::stop_iteration(partition&)>);
+    /// Same as above but only visits partitions accepted by the filter. The
+    /// filter is called before the partition object is created, so passes
+    /// that care about a few nodes don't pay for the rest of the cluster.
     ss::future<> for_each_partition(
+      partition_filter,
       ss::noncopyable_function<ss::stop_iteration(partition&)>);
+    /// Returns a filter accepting the partitions that have a replica on a
+    /// node matching the predicate (either in the topic table or in the
+    /// target replica set of an in-progress update).
+    template<typename Pred>
+    partition_filter replicas_on_nodes_filter(Pred);
     ss::future<> for_each_partition_random_order(
       ss::noncopyable_function<ss::stop_iteration(partition&)>);
     ss::future<> with_partition(
@@ -338,10 +354,22 @@ void partition_balancer_planner::init_per_node_state(
         }
     }
 
+    bool all_produce_rates_known = true;
     for (const auto& node_report : health_report.node_reports) {
         const auto [total, free] = get_node_bytes_info(node_report.local_state);
         ctx.node_disk_reports.emplace(
           node_report.id, node_disk_space(node_report.id, total, total - free));
+        const auto& produce_rate = node_report.local_state.produce_bytes_rate;
+        if (produce_rate) {
+            ctx.node_produce_rates.emplace(node_report.id, *produce_rate);
+        } else {
+            all_produce_rates_known = false;
+        }
+    }
+    if (!all_produce_rates_known) {
+        // nodes running older versions or that just started don't report the
+        // rate, comparing them with the others would be misleading
+        ctx.node_produce_rates.clear();
     }
 
     for (model::node_id id : ctx.all_nodes) {
@@ -966,6 +994,16 @@ auto partition_balancer_planner::request_context::do_with_partition(
 }
 
 ss::future<> partition_balancer_planner::request_context::for_each_partition(
+  ss::noncopyable_function<ss::stop_iteration(partition&)> visitor) {
+    return for_each_partition(
+      [](const model::topic_namespace&, const partition_assignment&) {
+          return true;
+      },
+      std::move(visitor));
+}
+
+ss::future<> partition_balancer_planner::request_context::for_each_partition(
+  partition_filter filter,
   ss::noncopyable_function<ss::stop_iteration(partition&)> visitor) {
     const auto& topics = _parent._state.topics();
     for (auto it = topics.topics_iterator_begin();
@@ -973,6 +1011,11 @@ ss::future<> partition_balancer_planner::request_context::for_each_partition(
          ++it) {
         const auto& assignments = it->second.get_assignments();
         for (const auto& assignment : assignments) {
+            if (!filter(it->first, assignment)) {
+                co_await maybe_yield();
+                it.check();
+                continue;
+            }
             auto ntp = model::ntp(it->first.ns, it->first.tp, assignment.id);
             auto stop = do_with_partition(ntp, assignment, visitor);
             if (stop == ss::stop_iteration::yes) {
@@ -984,6 +1027,41 @@ ss::future<> partition_balancer_planner::request_context::for_each_partition(
     }
 }
 
+template<typename Pred>
+partition_balancer_planner::request_context::partition_filter
+partition_balancer_planner::request_context::replicas_on_nodes_filter(
+  Pred pred) {
+    // In-progress updates are few (bounded by max_concurrent_actions), their
+    // target replicas are not reflected in the topic table if the update was
+    // cancelled.
+    absl::flat_hash_set<model::ntp> moving;
+    absl::flat_hash_set<model::topic_namespace> moving_topics;
+    for (const auto& [ntp, update] : state().topics().updates_in_progress()) {
+        for (const auto& bs : update.get_target_replicas()) {
+            if (pred(bs.node_id)) {
+                moving.insert(ntp);
+                moving_topics.emplace(ntp.ns, ntp.tp.topic);
+                break;
+            }
+        }
+    }
+
+    return [pred = std::move(pred),
+            moving = std::move(moving),
+            moving_topics = std::move(moving_topics)](
+             const model::topic_namespace& tp_ns,
+             const partition_assignment& assignment) {
+        for (const auto& bs : assignment.replicas) {
+            if (pred(bs.node_id)) {
+                return true;
+            }
+        }
+        return moving_topics.contains(tp_ns)
+               && moving.contains(
+                 model::ntp(tp_ns.ns, tp_ns.tp, assignment.id));
+    };
+}
+
 ss::future<>
 partition_balancer_planner::request_context::for_each_partition_random_order(
   ss::noncopyable_function<ss::stop_iteration(partition&)> visitor) {
@@ -1047,6 +1125,9 @@ partition_balancer_planner::reassignable_partition::get_allocation_constraints(
     constraints.add(
       least_disk_filled(max_disk_usage_ratio, _ctx.node_disk_reports));
 
+    // Add constraint on least produce load
+    constraints.add(least_produce_load(_ctx.node_produce_rates));
+
     // Add constraint on partition max_disk_usage_ratio overfill
     size_t upper_bound_for_partition_size
       = _sizes.non_reclaimable + _ctx.config().segment_fallocation_step;
@@ -1214,6 +1295,9 @@ partition_balancer_planner::force_reassignable_partition::
     constraints.add(
       least_disk_filled(max_disk_usage_ratio, _ctx.node_disk_reports));
 
+    // Add constraint on least produce load
+    constraints.add(least_produce_load(_ctx.node_produce_rates));
+
     if (_sizes) {
         // Add constraint on partition max_disk_usage_ratio overfill
         size_t upper_bound_for_partition_size
@@ -1333,7 +1417,9 @@ ss::future<> partition_balancer_planner::get_node_drain_actions(
         co_return;
     }
 
-    co_await ctx.for_each_partition([&](partition& part) {
+    auto filter = ctx.replicas_on_nodes_filter(
+      [&nodes](model::node_id id) { return nodes.contains(id); });
+    co_await ctx.for_each_partition(std::move(filter), [&](partition& part) {
         std::vector<model::node_id> to_move;
         for (const auto& bs : part.replicas()) {
             if (nodes.contains(bs.node_id)) {
@@ -1590,7 +1676,11 @@ partition_balancer_planner::get_full_node_actions(request_context& ctx) {
       model::node_id,
       absl::btree_multimap<size_t, model::ntp, std::greater<>>>
       full_node2priority2ntp;
-    co_await ctx.for_each_partition([&](partition& part) {
+    auto filter = ctx.replicas_on_nodes_filter(
+      [&find_full_node](model::node_id id) {
+          return find_full_node(id) != nullptr;
+      });
+    co_await ctx.for_each_partition(std::move(filter), [&](partition& part) {
         part.match_variant(
           [&](reassignable_partition& part) {
               std::vector<model::node_id> replicas_on_full_nodes;
@@ -200,6 +200,7 @@ void partition_leaders_table::update_partition_leader(
       it->second.current_leader,
       it->second.previous_leader,
       it->second.partition_revision);
+    notify_leaders_updated(key.tp_ns);
     // notify waiters if update is setting the leader
     if (!leader_id) {
         return;
@@ -281,12 +282,16 @@ void partition_leaders_table::remove_leader(
           it->second.partition_revision,
           revision);
         _leaders.erase(it);
+        notify_leaders_updated(model::topic_namespace_view(ntp));
     }
 }
 
 void partition_leaders_table::reset() {
     vlog(clusterlog.trace, "resetting leaders");
-    _leaders.clear();
+    auto leaders = std::exchange(_leaders, {});
+    for (const auto& [key, _] : leaders) {
+        notify_leaders_updated(key.tp_ns);
+    }
 }
 
 partition_leaders_table::leaders_info_t
@@ -330,4 +335,26 @@ void partition_leaders_table::unregister_leadership_change_notification(
     return _watchers.unregister_notify(ntp, id);
 }
 
+notification_id_type
+partition_leaders_table::register_leaders_update_notification(
+  leaders_update_cb_t cb) {
+    auto id = _update_notification_id++;
+    _update_notifications.emplace_back(id, std::move(cb));
+    return id;
+}
+
+void partition_leaders_table::unregister_leaders_update_notification(
+  notification_id_type id) {
+    std::erase_if(_update_notifications, [id](const auto& n) {
+        return n.first == id;
+    });
+}
+
+void partition_leaders_table::notify_leaders_updated(
+  model::topic_namespace_view tp_ns) {
+    for (auto& [_, cb] : _update_notifications) {
+        cb(tp_ns);
+    }
+}
+
 } // namespace cluster
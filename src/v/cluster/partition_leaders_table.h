@@ -125,7 +125,19 @@ public:
     void unregister_leadership_change_notification(
       const model::ntp&, notification_id_type);
 
+    using leaders_update_cb_t
+      = ss::noncopyable_function<void(model::topic_namespace_view)>;
+
+    // Register a callback for every update of the leadership state of the
+    // partitions of a topic, including the ones that keep the same leader
+    notification_id_type
+      register_leaders_update_notification(leaders_update_cb_t);
+
+    void unregister_leaders_update_notification(notification_id_type);
+
 private:
+    void notify_leaders_updated(model::topic_namespace_view);
+
     // optimized to reduce number of ntp copies
     struct leader_key {
         model::topic_namespace tp_ns;
@@ -220,6 +232,10 @@ private:
     ss::sharded<topic_table>& _topic_table;
 
     ntp_callbacks<leader_change_cb_t> _watchers;
+
+    notification_id_type _update_notification_id{0};
+    std::vector<std::pair<notification_id_type, leaders_update_cb_t>>
+      _update_notifications;
 };
 
 } // namespace cluster
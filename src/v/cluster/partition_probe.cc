@@ -132,6 +132,13 @@ void replicated_partition_probe::setup_internal_metrics(const model::ntp& ntp) {
           sm::description("Total number of bytes fetched (not all might be "
                           "returned to the client)"),
           labels),
+        sm::make_total_bytes(
+          "bytes_fetched_from_follower_total",
+          [this] { return _bytes_fetched_from_follower; },
+          sm::description("Total number of bytes fetched from this replica "
+                          "while it was a follower (not all might be returned "
+                          "to the client)"),
+          labels),
         sm::make_total_bytes(
           "cloud_storage_segments_metadata_bytes",
           [this] {
@@ -241,6 +248,15 @@ void replicated_partition_probe::setup_public_metrics(const model::ntp& ntp) {
            topic_label(ntp.tp.topic()),
            partition_label(ntp.tp.partition())})
           .aggregate({sm::shard_label, partition_label}),
+        sm::make_total_bytes(
+          "follower_fetch_bytes_total",
+          [this] { return _bytes_fetched_from_follower; },
+          sm::description("Total number of bytes fetched from followers per "
+                          "topic (not all might be returned to the client)"),
+          {ns_label(ntp.ns()),
+           topic_label(ntp.tp.topic()),
+           partition_label(ntp.tp.partition())})
+          .aggregate({sm::shard_label, partition_label}),
         sm::make_counter(
           "records_produced_total",
           [this] { return _records_produced; },
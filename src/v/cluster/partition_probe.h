@@ -29,7 +29,9 @@ public:
         virtual void add_records_fetched(uint64_t) = 0;
         virtual void add_bytes_produced(uint64_t) = 0;
         virtual void add_bytes_fetched(uint64_t) = 0;
+        virtual void add_bytes_fetched_from_follower(uint64_t) = 0;
         virtual void add_schema_id_validation_failed() = 0;
+        virtual uint64_t bytes_produced() const = 0;
         virtual void setup_metrics(const model::ntp&) = 0;
         virtual void clear_metrics() = 0;
         virtual ~impl() noexcept = default;
@@ -57,10 +59,19 @@ public:
         return _impl->add_bytes_fetched(bytes);
     }
 
+    /// Bytes fetched from this replica while it was a follower, on top of
+    /// add_bytes_fetched()
+    void add_bytes_fetched_from_follower(uint64_t bytes) {
+        return _impl->add_bytes_fetched_from_follower(bytes);
+    }
+
     void add_schema_id_validation_failed() {
         _impl->add_schema_id_validation_failed();
     }
 
+    /// Total number of bytes produced to the partition on this node
+    uint64_t bytes_produced() const { return _impl->bytes_produced(); }
+
     void clear_metrics() { _impl->clear_metrics(); }
 
 private:
@@ -75,10 +86,14 @@ public:
     void add_records_fetched(uint64_t cnt) final { _records_fetched += cnt; }
     void add_records_produced(uint64_t cnt) final { _records_produced += cnt; }
     void add_bytes_fetched(uint64_t cnt) final { _bytes_fetched += cnt; }
+    void add_bytes_fetched_from_follower(uint64_t cnt) final {
+        _bytes_fetched_from_follower += cnt;
+    }
     void add_bytes_produced(uint64_t cnt) final { _bytes_produced += cnt; }
     void add_schema_id_validation_failed() final {
         ++_schema_id_validation_records_failed;
     };
+    uint64_t bytes_produced() const final { return _bytes_produced; }
 
     void clear_metrics() final;
 
@@ -95,6 +110,7 @@ private:
     uint64_t _records_fetched{0};
     uint64_t _bytes_produced{0};
     uint64_t _bytes_fetched{0};
+    uint64_t _bytes_fetched_from_follower{0};
     uint64_t _schema_id_validation_records_failed{0};
     metrics::internal_metric_groups _metrics;
     metrics::public_metric_groups _public_metrics;
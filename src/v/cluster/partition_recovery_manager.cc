@@ -16,11 +16,13 @@
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/types.h"
 #include "cluster/topic_recovery_status_frontend.h"
+#include "config/configuration.h"
 #include "hashing/xx.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/record_batch_types.h"
 #include "model/timestamp.h"
+#include "prometheus/prometheus_sanitize.h"
 #include "storage/ntp_config.h"
 #include "storage/offset_translator_state.h"
 #include "storage/parser.h"
@@ -32,13 +34,16 @@
 #include <seastar/core/iostream.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/metrics.hh>
 #include <seastar/core/seastar.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/temporary_buffer.hh>
+#include <seastar/util/defer.hh>
 #include <seastar/util/log.hh>
 
 #include <absl/container/btree_map.h>
 #include <boost/algorithm/string/detail/sequence.hpp>
+#include <boost/range/irange.hpp>
 
 #include <chrono>
 #include <exception>
@@ -70,7 +75,47 @@ partition_recovery_manager::partition_recovery_manager(
   cloud_storage_clients::bucket_name bucket, ss::sharded<remote>& remote)
   : _bucket(std::move(bucket))
   , _remote(remote)
-  , _root(_as) {}
+  , _max_concurrent_downloads(
+      config::shard_local_cfg()
+        .cloud_storage_max_concurrent_recovery_downloads_per_shard())
+  , _download_units(_max_concurrent_downloads, "cst/recovery-downloads")
+  , _root(_as) {
+    setup_metrics();
+}
+
+void partition_recovery_manager::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("cloud_storage:partition_recovery"),
+      {
+        sm::make_gauge(
+          "active_partitions",
+          [this] { return _stats.active_partitions; },
+          sm::description("Number of partitions which are being recovered")),
+        sm::make_gauge(
+          "pending_segment_downloads",
+          [this] { return _stats.pending_segment_downloads; },
+          sm::description("Number of segment downloads which are in progress "
+                          "or waiting for the download budget")),
+        sm::make_counter(
+          "downloaded_segments",
+          [this] { return _stats.downloaded_segments; },
+          sm::description("Number of segments downloaded during recovery")),
+        sm::make_counter(
+          "downloaded_bytes",
+          [this] { return _stats.downloaded_bytes; },
+          sm::description("Number of bytes downloaded during recovery")),
+        sm::make_counter(
+          "failed_segment_downloads",
+          [this] { return _stats.failed_segment_downloads; },
+          sm::description(
+            "Number of segments which failed to download during recovery")),
+      });
+}
 
 partition_recovery_manager::~partition_recovery_manager() {
     vassert(_gate.is_closed(), "S3 downloader is not stopped properly");
@@ -79,6 +124,7 @@ partition_recovery_manager::~partition_recovery_manager() {
 ss::future<> partition_recovery_manager::stop() {
     vlog(cst_log.debug, "Stopping partition_recovery_manager");
     _as.request_abort();
+    _download_units.broken();
     return _gate.close();
 }
 
@@ -107,8 +153,13 @@ ss::future<log_recovery_result> partition_recovery_manager::download_log(
       _bucket,
       _gate,
       _root,
-      _as);
-    auto result = co_await downloader.maybe_download_log();
+      _as,
+      _download_units,
+      _max_concurrent_downloads,
+      _stats);
+    _stats.active_partitions++;
+    auto result = co_await downloader.maybe_download_log().finally(
+      [this] { _stats.active_partitions--; });
     retry_chain_node fib{_as, download_timeout, initial_backoff};
     if (co_await is_topic_recovery_active()) {
         vlog(
@@ -155,7 +206,10 @@ partition_downloader::partition_downloader(
   cloud_storage_clients::bucket_name bucket,
   ss::gate& gate_root,
   retry_chain_node& parent,
-  storage::opt_abort_source_t as)
+  storage::opt_abort_source_t as,
+  ssx::semaphore& download_units,
+  size_t max_concurrent_downloads,
+  partition_recovery_stats& stats)
   : _ntpc(ntpc)
   , _bucket(std::move(bucket))
   , _remote(remote)
@@ -167,7 +221,10 @@ partition_downloader::partition_downloader(
       cst_log,
       _rtcnode,
       ssx::sformat("[{}, rev: {}]", ntpc.ntp().path(), ntpc.get_revision()))
-  , _as(as) {}
+  , _as(as)
+  , _download_units(download_units)
+  , _max_concurrent_downloads(max_concurrent_downloads)
+  , _stats(stats) {}
 
 ss::future<log_recovery_result> partition_downloader::maybe_download_log() {
     vlog(_ctxlog.debug, "Check conditions for S3 recovery for {}", _ntpc);
@@ -449,7 +506,6 @@ partition_downloader::download_log_with_capped_size(
         }
     }
 
-    std::vector<offset_range> dloffsets;
     auto ot_state = ss::make_lw_shared<storage::offset_translator_state>(
       _ntpc.ntp(), get_prev_offset(start_offset), start_delta());
     download_part dlpart{
@@ -472,30 +528,60 @@ partition_downloader::download_log_with_capped_size(
       start_offset,
       start_delta);
 
-    for (auto s : staged_downloads) {
-        vlog(
-          dllog.debug,
-          "Starting download, base-offset: {}, term: {}, size: {}, fs "
-          "prefix: {}, "
-          "destination: {}",
-          s.base_offset,
-          s.segment_term,
-          s.size_bytes,
-          dlpart.part_prefix,
-          dlpart.dest_prefix);
-        auto offsets = co_await download_segment_file(s, dlpart);
-        if (offsets.has_value()) {
-            dloffsets.push_back(offset_range{
-              .min_offset = offsets->min_offset,
-              .max_offset = offsets->max_offset,
-            });
-        }
-    }
-
+    auto dloffsets = co_await download_segments(staged_downloads, dlpart);
     update_downloaded_offsets(std::move(dloffsets), dlpart);
     co_return dlpart;
 }
 
+ss::future<std::vector<partition_downloader::offset_range>>
+partition_downloader::download_segments(
+  const std::deque<segment_meta>& segments, download_part& part) {
+    std::vector<std::optional<stream_stats>> results(segments.size());
+    co_await ss::max_concurrent_for_each(
+      boost::irange<size_t>(0, segments.size()),
+      _max_concurrent_downloads,
+      [this, &segments, &part, &results](size_t ix) -> ss::future<> {
+          _stats.pending_segment_downloads++;
+          auto pending = ss::defer(
+            [this] { _stats.pending_segment_downloads--; });
+          auto units = co_await ss::get_units(_download_units, 1);
+          const auto& s = segments[ix];
+          vlog(
+            _ctxlog.debug,
+            "Starting download, base-offset: {}, term: {}, size: {}, fs "
+            "prefix: {}, destination: {}",
+            s.base_offset,
+            s.segment_term,
+            s.size_bytes,
+            part.part_prefix,
+            part.dest_prefix);
+          results[ix] = co_await download_segment_file(s, part);
+          if (results[ix].has_value()) {
+              _stats.downloaded_segments++;
+              _stats.downloaded_bytes += results[ix]->size_bytes;
+          } else {
+              _stats.failed_segment_downloads++;
+          }
+      });
+
+    // The gaps have to be added to the offset translator state in offset
+    // order, the segments are sorted by offset.
+    std::vector<offset_range> dloffsets;
+    for (auto& res : results) {
+        if (!res.has_value()) {
+            continue;
+        }
+        for (const auto& [base, last] : res->gaps) {
+            part.ot_state->add_gap(base, last);
+        }
+        dloffsets.push_back(offset_range{
+          .min_offset = res->min_offset,
+          .max_offset = res->max_offset,
+        });
+    }
+    co_return dloffsets;
+}
+
 ss::future<partition_downloader::download_part>
 partition_downloader::download_log_with_capped_time(
   offset_map_t offset_map,
@@ -553,7 +639,6 @@ partition_downloader::download_log_with_capped_time(
       "start_delta: {}",
       start_offset,
       start_delta);
-    std::vector<offset_range> dloffsets;
     auto ot_state = ss::make_lw_shared<storage::offset_translator_state>(
       _ntpc.ntp(), get_prev_offset(start_offset), start_delta());
     download_part dlpart = {
@@ -576,23 +661,7 @@ partition_downloader::download_log_with_capped_time(
       start_offset,
       start_delta);
 
-    for (auto s : staged_downloads) {
-        vlog(
-          dllog.debug,
-          "Starting download, base_offset: {}, term: {}, fs prefix: {}, "
-          "dest: {}",
-          s.base_offset,
-          s.segment_term,
-          dlpart.part_prefix,
-          dlpart.dest_prefix);
-        auto offsets = co_await download_segment_file(s, dlpart);
-        if (offsets.has_value()) {
-            dloffsets.push_back({
-              .min_offset = offsets->min_offset,
-              .max_offset = offsets->max_offset,
-            });
-        }
-    }
+    auto dloffsets = co_await download_segments(staged_downloads, dlpart);
     update_downloaded_offsets(std::move(dloffsets), dlpart);
     co_return dlpart;
 }
@@ -684,7 +753,7 @@ partition_downloader::download_segment_file(
       part.part_prefix.string(),
       localpath);
 
-    offset_translator otl{segm.delta_offset, part.ot_state, _as};
+    offset_translator otl{segm.delta_offset, _as};
 
     if (co_await ss::file_exists(localpath.string())) {
         vlog(
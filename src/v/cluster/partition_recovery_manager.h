@@ -14,15 +14,18 @@
 #include "cloud_storage/remote.h"
 #include "model/metadata.h"
 #include "model/record.h"
+#include "ssx/semaphore.h"
 #include "storage/ntp_config.h"
 #include "storage/offset_translator_state.h"
 #include "utils/retry_chain_node.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/metrics_registration.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
 
+#include <deque>
 #include <vector>
 
 namespace cluster {
@@ -47,6 +50,17 @@ struct log_recovery_result {
     ss::lw_shared_ptr<storage::offset_translator_state> ot_state;
 };
 
+/// Progress of the partition recovery on the shard
+struct partition_recovery_stats {
+    /// Partitions which are being recovered
+    size_t active_partitions{0};
+    /// Segment downloads which are in progress or waiting for the budget
+    size_t pending_segment_downloads{0};
+    size_t downloaded_segments{0};
+    size_t downloaded_bytes{0};
+    size_t failed_segment_downloads{0};
+};
+
 /// Data recovery provider is used to download topic segments from S3 (or
 /// compatible storage) during topic re-creation process
 class partition_recovery_manager {
@@ -88,8 +102,15 @@ public:
 private:
     ss::future<bool> is_topic_recovery_active() const;
 
+    void setup_metrics();
+
     cloud_storage_clients::bucket_name _bucket;
     ss::sharded<remote>& _remote;
+    // Segment download budget shared by all partitions of the shard
+    size_t _max_concurrent_downloads;
+    ssx::semaphore _download_units;
+    partition_recovery_stats _stats;
+    ss::metrics::metric_groups _metrics;
     // Late initialized objects
     std::optional<std::reference_wrapper<
       ss::sharded<cluster::topic_recovery_status_frontend>>>
@@ -105,8 +126,6 @@ private:
 /// Topic downloader is used to download topic segments from S3 (or compatible
 /// storage) during topic re-creation
 class partition_downloader {
-    static constexpr size_t max_concurrency = 1;
-
 public:
     partition_downloader(
       const storage::ntp_config& ntpc,
@@ -116,7 +135,10 @@ public:
       cloud_storage_clients::bucket_name bucket,
       ss::gate& gate_root,
       retry_chain_node& parent,
-      storage::opt_abort_source_t as);
+      storage::opt_abort_source_t as,
+      ssx::semaphore& download_units,
+      size_t max_concurrent_downloads,
+      partition_recovery_stats& stats);
 
     partition_downloader(const partition_downloader&) = delete;
     partition_downloader(partition_downloader&&) = delete;
@@ -177,6 +199,15 @@ private:
       std::vector<partition_downloader::offset_range> dloffsets,
       partition_downloader::download_part& dlpart);
 
+    /// Download segments concurrently using the download budget of the
+    /// shard. The offset translation gaps found in the segments are added
+    /// to the state of the 'part' in offset order once all downloads
+    /// complete.
+    ///
+    /// \return offset ranges of the successfully downloaded segments
+    ss::future<std::vector<offset_range>> download_segments(
+      const std::deque<segment_meta>& segments, download_part& part);
+
     /// Download segment file to the target location
     ///
     /// The downloaded file will have a custom suffix
@@ -224,6 +255,9 @@ private:
     retry_chain_node _rtcnode;
     retry_chain_logger _ctxlog;
     storage::opt_abort_source_t _as;
+    ssx::semaphore& _download_units;
+    size_t _max_concurrent_downloads;
+    partition_recovery_stats& _stats;
 };
 
 } // namespace cloud_storage
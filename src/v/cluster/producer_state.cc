@@ -70,38 +70,40 @@ bool requests::operator==(const requests& other) const {
           return *left == *right;
       });
 
-    auto match_finished = std::equal(
-      _finished_requests.begin(),
-      _finished_requests.end(),
-      other._finished_requests.begin(),
-      other._finished_requests.end(),
-      [](const request_ptr& left, const request_ptr& right) {
-          return *left == *right;
-      });
-
-    return match_inflight && match_finished;
+    return match_inflight && _finished_requests == other._finished_requests;
 }
 
-std::optional<request_ptr> requests::last_request() const {
+std::optional<seq_t> requests::last_sequence() const {
     if (!_inflight_requests.empty()) {
-        return _inflight_requests.back();
+        return _inflight_requests.back()->_last_sequence;
     } else if (!_finished_requests.empty()) {
-        return _finished_requests.back();
+        return _finished_requests.back().last_sequence;
     }
     return std::nullopt;
 }
 
 bool requests::is_valid_sequence(seq_t incoming) const {
-    auto last_req = last_request();
+    auto last_seq = last_sequence();
     return
       // this is the first request with seq=0
-      (!last_req && incoming == 0)
+      (!last_seq && incoming == 0)
       // incoming request forms a sequence with last_request
-      || (last_req && last_req.value()->_last_sequence + 1 == incoming)
+      || (last_seq && last_seq.value() + 1 == incoming)
       // sequence numbers got rolled over because they hit int32 max limit.
-      || (last_req && last_req.value()->_last_sequence == std::numeric_limits<seq_t>::max() && incoming == 0);
+      || (last_seq && last_seq.value() == std::numeric_limits<seq_t>::max() && incoming == 0);
 }
 
+namespace {
+// A retried request that has already finished is answered with its
+// original result
+request_ptr make_finished_request(const requests::finished_request& r) {
+    result_promise_t ready{};
+    ready.set_value(kafka_result{.last_offset = r.last_offset});
+    return ss::make_lw_shared<request>(
+      r.first_sequence, r.last_sequence, model::term_id{-1}, std::move(ready));
+}
+} // namespace
+
 result<request_ptr> requests::try_emplace(
   seq_t first, seq_t last, model::term_id current, bool reset_sequences) {
     if (reset_sequences) {
@@ -129,19 +131,16 @@ result<request_ptr> requests::try_emplace(
         }
 
         // check if an existing request matches
-        auto match_it = std::find_if(
-          _finished_requests.begin(),
-          _finished_requests.end(),
-          [first, last](const auto& request) {
-              return request->_first_sequence == first
-                     && request->_last_sequence == last;
-          });
-
-        if (match_it != _finished_requests.end()) {
-            return *match_it;
+        for (size_t i = 0; i < _finished_requests.size(); ++i) {
+            const auto& finished = _finished_requests[i];
+            if (
+              finished.first_sequence == first
+              && finished.last_sequence == last) {
+                return make_finished_request(finished);
+            }
         }
 
-        match_it = std::find_if(
+        auto match_it = std::find_if(
           _inflight_requests.begin(),
           _inflight_requests.end(),
           [first, last, current](const auto& request) {
@@ -190,14 +189,8 @@ bool requests::stm_apply(
         // applying changes from a different leader thus prompting a relink.
         relink_producer = true;
     }
-    result_promise_t ready{};
-    ready.set_value(kafka_result{.last_offset = offset});
-    _finished_requests.emplace_back(ss::make_lw_shared<request>(
-      bid.first_seq, bid.last_seq, model::term_id{-1}, std::move(ready)));
-
-    while (_finished_requests.size() > requests_cached_max) {
-        _finished_requests.pop_front();
-    }
+    _finished_requests.push_back(
+      {.first_sequence = first, .last_sequence = last, .last_offset = offset});
     return relink_producer;
 }
 
@@ -221,13 +214,10 @@ producer_state::producer_state(
   , _post_eviction_hook(std::move(hook)) {
     // Hydrate from snapshot.
     for (auto& req : snapshot._finished_requests) {
-        result_promise_t ready{};
-        ready.set_value(kafka_result{req._last_offset});
-        _requests._finished_requests.push_back(ss::make_lw_shared<request>(
-          req._first_sequence,
-          req._last_sequence,
-          model::term_id{-1},
-          std::move(ready)));
+        _requests._finished_requests.push_back(
+          {.first_sequence = req._first_sequence,
+           .last_sequence = req._last_sequence,
+           .last_offset = req._last_offset});
     }
     register_self();
 }
@@ -347,11 +337,7 @@ void producer_state::update(
 }
 
 std::optional<seq_t> producer_state::last_sequence_number() const {
-    auto maybe_ptr = _requests.last_request();
-    if (!maybe_ptr) {
-        return std::nullopt;
-    }
-    return maybe_ptr.value()->_last_sequence;
+    return _requests.last_sequence();
 }
 
 producer_state_snapshot
@@ -361,22 +347,15 @@ producer_state::snapshot(kafka::offset log_start_offset) const {
     snapshot._group = _group;
     snapshot._ms_since_last_update = ms_since_last_update();
     snapshot._finished_requests.reserve(_requests._finished_requests.size());
-    for (auto& req : _requests._finished_requests) {
-        vassert(
-          req->has_completed(),
-          "_finished_requests has unresolved promise: {}, range:[{}, {}]",
-          *this,
-          req->_first_sequence,
-          req->_last_sequence);
-        auto kafka_offset
-          = req->_result.get_shared_future().get().value().last_offset;
+    for (size_t i = 0; i < _requests._finished_requests.size(); ++i) {
+        const auto& req = _requests._finished_requests[i];
         // offsets older than log start are no longer interesting.
-        if (kafka_offset >= log_start_offset) {
+        if (req.last_offset >= log_start_offset) {
             snapshot._finished_requests.push_back(
               producer_state_snapshot::finished_request{
-                ._first_sequence = req->_first_sequence,
-                ._last_sequence = req->_last_sequence,
-                ._last_offset = kafka_offset});
+                ._first_sequence = req.first_sequence,
+                ._last_sequence = req.last_sequence,
+                ._last_offset = req.last_offset});
         }
     }
     return snapshot;
@@ -20,6 +20,7 @@
 #include <seastar/core/shared_future.hh>
 #include <seastar/util/defer.hh>
 
+#include <array>
 #include <bit>
 
 // Befriended to expose internal state in tests.
@@ -110,9 +111,63 @@ private:
 //
 // We retain a maximum of `requests_cached_max` finished requests.
 // Kafka clients only issue requests in batches of 5, the queue is fairly small
-// at all times.
+// at all times. Finished requests only need their sequence range and offset,
+// they are kept inline in a fixed size ring so that tracking millions of
+// idempotent producers does not cost an allocation per produced batch.
 class requests {
 public:
+    static constexpr int32_t requests_cached_max = 5;
+
+    struct finished_request {
+        seq_t first_sequence;
+        seq_t last_sequence;
+        kafka::offset last_offset;
+
+        bool operator==(const finished_request&) const = default;
+    };
+
+    // Ring of the last `requests_cached_max` finished requests, the oldest
+    // one is overwritten when a new one is pushed into a full ring.
+    class finished_requests {
+    public:
+        void push_back(const finished_request& r) {
+            _entries[(_begin + _size) % requests_cached_max] = r;
+            if (_size < requests_cached_max) {
+                ++_size;
+            } else {
+                _begin = (_begin + 1) % requests_cached_max;
+            }
+        }
+        void clear() {
+            _begin = 0;
+            _size = 0;
+        }
+        bool empty() const { return _size == 0; }
+        size_t size() const { return _size; }
+        // 0 is the oldest request
+        const finished_request& operator[](size_t i) const {
+            return _entries[(_begin + i) % requests_cached_max];
+        }
+        const finished_request& back() const { return (*this)[_size - 1]; }
+
+        bool operator==(const finished_requests& other) const {
+            if (_size != other._size) {
+                return false;
+            }
+            for (size_t i = 0; i < _size; ++i) {
+                if ((*this)[i] != other[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        std::array<finished_request, requests_cached_max> _entries;
+        uint8_t _begin{0};
+        uint8_t _size{0};
+    };
+
     result<request_ptr> try_emplace(
       seq_t first, seq_t last, model::term_id current, bool reset_sequences);
 
@@ -124,14 +179,13 @@ public:
     friend std::ostream& operator<<(std::ostream&, const requests&);
 
 private:
-    static constexpr int32_t requests_cached_max = 5;
     // chunk size of the request containers to avoid wastage.
     static constexpr size_t chunk_size = std::bit_ceil(
       static_cast<unsigned long>(requests_cached_max));
     bool is_valid_sequence(seq_t incoming) const;
-    std::optional<request_ptr> last_request() const;
+    std::optional<seq_t> last_sequence() const;
     ss::chunked_fifo<request_ptr, chunk_size> _inflight_requests;
-    ss::chunked_fifo<request_ptr, chunk_size> _finished_requests;
+    finished_requests _finished_requests;
     friend producer_state;
 };
 
@@ -196,6 +250,8 @@ public:
           });
     }
 
+    model::producer_identity id() const { return _id; }
+
     ss::future<> shutdown_input();
     ss::future<> evict();
     bool is_evicted() const { return _evicted; }
@@ -47,16 +47,31 @@ void producer_state_manager::setup_metrics() {
     _metrics.add_group(
       prometheus_sanitize::metrics_name("cluster:producer_state_manager"),
       {sm::make_gauge(
-        "producer_manager_total_active_producers",
-        [this] { return _num_producers; },
-        sm::description(
-          "Total number of active idempotent and transactional producers."))});
+         "producer_manager_total_active_producers",
+         [this] { return _num_producers; },
+         sm::description(
+           "Total number of active idempotent and transactional producers.")),
+       sm::make_counter(
+         "producer_manager_evicted_producers",
+         [this] { return _evicted_producers; },
+         sm::description("Total number of evicted idempotent and "
+                         "transactional producers.")),
+       sm::make_gauge(
+         "producer_manager_memory_bytes",
+         [this] { return _num_producers * sizeof(producer_state); },
+         sm::description("Memory used by the state of the active idempotent "
+                         "and transactional producers, in bytes."))});
 }
 
 void producer_state_manager::register_producer(producer_state& state) {
     link(state);
     ++_num_producers;
     vlog(clusterlog.debug, "Registered producer: {}", state);
+    if (_num_producers > _max_ids() && _reaper.armed()) {
+        // do not wait for the next period, the excess producers are all
+        // evicted in one tick, so eviction costs O(1) per producer
+        _reaper.rearm(ss::steady_clock_type::now());
+    }
 }
 
 void producer_state_manager::deregister_producer(producer_state& state) {
@@ -109,6 +124,7 @@ void producer_state_manager::do_evict_excess_producers() {
         // producers are in the list. This makes the whole logic lock free.
         ssx::spawn_with_gate(_gate, [&state] { return state.evict(); });
         --_num_producers;
+        ++_evicted_producers;
     }
 }
 
@@ -33,6 +33,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/coroutine/as_future.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 
 #include <filesystem>
 #include <optional>
@@ -257,9 +258,9 @@ rm_stm::rm_stm(
   , _tx_locks(
       mt::
         map<absl::flat_hash_map, model::producer_id, ss::lw_shared_ptr<mutex>>(
-          _tx_root_tracker.create_child("tx-locks")))
-  , _log_state(_tx_root_tracker)
-  , _mem_state(_tx_root_tracker)
+          _tx_root_tracker->create_child("tx-locks")))
+  , _log_state(*_tx_root_tracker)
+  , _mem_state(*_tx_root_tracker)
   , _sync_timeout(config::shard_local_cfg().rm_sync_timeout_ms.value())
   , _tx_timeout_delay(config::shard_local_cfg().tx_timeout_delay_ms.value())
   , _abort_interval_ms(config::shard_local_cfg()
@@ -279,7 +280,7 @@ rm_stm::rm_stm(
   , _producer_state_manager(producer_state_manager)
   , _producers(
       mt::map<absl::btree_map, model::producer_identity, cluster::producer_ptr>(
-        _tx_root_tracker.create_child("producers"))) {
+        _tx_root_tracker->create_child("producers"))) {
     vassert(
       _feature_table.local().is_active(features::feature::transaction_ga),
       "unexpected state for transactions support. skipped a few "
@@ -351,6 +352,9 @@ void rm_stm::cleanup_producer_state(model::producer_identity pid) {
         _mem_state.forget(pid);
         _log_state.forget(pid);
     }
+    if (_last_applied_producer && _last_applied_producer->id() == pid) {
+        _last_applied_producer = nullptr;
+    }
     _producers.erase(pid);
 };
 
@@ -360,6 +364,7 @@ ss::future<> rm_stm::reset_producers() {
           auto& producer = it.second;
           return producer->shutdown_input().discard_result();
       });
+    _last_applied_producer = nullptr;
     _producers.clear();
 }
 
@@ -1496,7 +1501,7 @@ ss::future<bool> rm_stm::sync(model::timeout_clock::duration timeout) {
     auto ready = co_await persisted_stm::sync(timeout);
     if (ready) {
         if (_mem_state.term != _insync_term) {
-            _mem_state = mem_state{_tx_root_tracker};
+            _mem_state = mem_state{*_tx_root_tracker};
             _mem_state.term = _insync_term;
         }
     }
@@ -1811,7 +1816,18 @@ void rm_stm::apply_fence(model::record_batch&& b) {
     }
 }
 
+producer_ptr rm_stm::producer_for_apply(model::producer_identity pid) {
+    // transactional clients usually produce many batches in a row, the
+    // consecutive batches of a producer skip the lookup
+    if (!_last_applied_producer || _last_applied_producer->id() != pid) {
+        _last_applied_producer = maybe_create_producer(pid);
+    }
+    return _last_applied_producer;
+}
+
 ss::future<> rm_stm::apply(const model::record_batch& b) {
+    // waits for the state being captured for a snapshot
+    auto units = co_await _apply_lock.get_units();
     const auto& hdr = b.header();
 
     if (hdr.type == model::record_batch_type::tx_fence) {
@@ -1848,7 +1864,7 @@ void rm_stm::apply_control(
     // either epoch is the same as fencing or it's lesser in the latter
     // case we don't fence off aborts and commits because transactional
     // manager already decided a tx's outcome and acked it to the client
-    auto producer = maybe_create_producer(pid);
+    auto producer = producer_for_apply(pid);
 
     if (likely(
           crt == model::control_record_type::tx_abort
@@ -1914,7 +1930,7 @@ void rm_stm::apply_data(
         _highest_producer_id = std::max(_highest_producer_id, bid.pid.get_id());
         const auto last_offset = header.last_offset();
         const auto last_kafka_offset = from_log_offset(header.last_offset());
-        auto producer = maybe_create_producer(bid.pid);
+        auto producer = producer_for_apply(bid.pid);
         producer->update(bid, last_kafka_offset);
 
         if (bid.is_transactional) {
@@ -2118,6 +2134,64 @@ void rm_stm::fill_snapshot_wo_seqs(T& snapshot) {
     }
 }
 
+template<class T>
+ss::future<T> rm_stm::capture_tx_snapshot(kafka::offset start_kafka_offset) {
+    // apply waits until the whole state is captured, so the capture can yield
+    // and still be consistent with the snapshot offset
+    auto units = co_await _apply_lock.get_units();
+    T tx_ss;
+    fill_snapshot_wo_seqs(tx_ss);
+    tx_ss.offset = last_applied_offset();
+
+    for (const auto& entry : _log_state.current_txes) {
+        tx_ss.tx_data.push_back(tx_data_snapshot{
+          .pid = entry.first,
+          .tx_seq = entry.second.tx_seq,
+          .tm = entry.second.tm_partition});
+    }
+
+    for (const auto& entry : _log_state.expiration) {
+        tx_ss.expiration.push_back(expiration_snapshot{
+          .pid = entry.first, .timeout = entry.second.timeout});
+    }
+    if constexpr (std::is_same_v<T, tx_snapshot>) {
+        tx_ss.highest_producer_id = _highest_producer_id;
+    }
+
+    // producers may be evicted while the capture yields, iterate over a copy
+    fragmented_vector<producer_ptr> producers;
+    for (const auto& [_, state] : _producers) {
+        producers.push_back(state);
+    }
+    for (const auto& state : producers) {
+        /**
+         * Only store those producer id sequences which offset is
+         * greater than log start offset. This way a snapshot will
+         * not retain producers ids for which all the batches were
+         * removed with log cleanup policy.
+         *
+         * Note that we are not removing producer ids from the in
+         * memory state but rather relay on the expiration policy
+         * to do it, however when recovering state from the
+         * snapshot removed producers will be gone.
+         */
+        auto snapshot = state->snapshot(start_kafka_offset);
+        if constexpr (std::is_same_v<T, tx_snapshot_v4>) {
+            auto seq_entry = deprecated_seq_entry::from_producer_state_snapshot(
+              snapshot);
+            if (seq_entry.seq != -1) {
+                tx_ss.seqs.push_back(std::move(seq_entry));
+            }
+        } else {
+            if (!snapshot._finished_requests.empty()) {
+                tx_ss.producers.push_back(std::move(snapshot));
+            }
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+    co_return tx_ss;
+}
+
 ss::future<> rm_stm::offload_aborted_txns() {
     // This method iterates through _log_state.aborted collection
     // and the loop's body contains sync points (co_await) so w/o
@@ -2228,80 +2302,34 @@ ss::future<raft::stm_snapshot> rm_stm::do_take_local_snapshot(uint8_t version) {
     return f.then([this, start_kafka_offset, version]() mutable {
         return ss::do_with(
           iobuf{},
-          [this, start_kafka_offset, version](iobuf& tx_ss_buf) mutable {
+          model::offset{},
+          [this, start_kafka_offset, version](
+            iobuf& tx_ss_buf, model::offset& offset) mutable {
               auto fut_serialize = ss::now();
               if (version == tx_snapshot_v4::version) {
-                  tx_snapshot_v4 tx_ss;
-                  fill_snapshot_wo_seqs(tx_ss);
-                  for (const auto& [_, state] : _producers) {
-                      /**
-                       * Only store those producer id sequences which offset is
-                       * greater than log start offset. This way a snapshot will
-                       * not retain producers ids for which all the batches were
-                       * removed with log cleanup policy.
-                       *
-                       * Note that we are not removing producer ids from the in
-                       * memory state but rather relay on the expiration policy
-                       * to do it, however when recovering state from the
-                       * snapshot removed producers will be gone.
-                       */
-                      auto snapshot = state->snapshot(start_kafka_offset);
-                      auto seq_entry
-                        = deprecated_seq_entry::from_producer_state_snapshot(
-                          snapshot);
-                      if (seq_entry.seq != -1) {
-                          tx_ss.seqs.push_back(std::move(seq_entry));
-                      }
-                  }
-                  tx_ss.offset = last_applied_offset();
-
-                  for (const auto& entry : _log_state.current_txes) {
-                      tx_ss.tx_data.push_back(tx_data_snapshot{
-                        .pid = entry.first,
-                        .tx_seq = entry.second.tx_seq,
-                        .tm = entry.second.tm_partition});
-                  }
-
-                  for (const auto& entry : _log_state.expiration) {
-                      tx_ss.expiration.push_back(expiration_snapshot{
-                        .pid = entry.first, .timeout = entry.second.timeout});
-                  }
-
-                  fut_serialize = reflection::async_adl<tx_snapshot_v4>{}.to(
-                    tx_ss_buf, std::move(tx_ss));
+                  fut_serialize
+                    = capture_tx_snapshot<tx_snapshot_v4>(start_kafka_offset)
+                        .then([&tx_ss_buf, &offset](tx_snapshot_v4 tx_ss) {
+                            offset = tx_ss.offset;
+                            return reflection::async_adl<tx_snapshot_v4>{}.to(
+                              tx_ss_buf, std::move(tx_ss));
+                        });
               } else if (version == tx_snapshot::version) {
-                  tx_snapshot tx_ss;
-                  fill_snapshot_wo_seqs(tx_ss);
-                  for (const auto& [_, state] : _producers) {
-                      auto snapshot = state->snapshot(start_kafka_offset);
-                      if (!snapshot._finished_requests.empty()) {
-                          tx_ss.producers.push_back(std::move(snapshot));
-                      }
-                  }
-                  tx_ss.offset = last_applied_offset();
-
-                  for (const auto& entry : _log_state.current_txes) {
-                      tx_ss.tx_data.push_back(tx_data_snapshot{
-                        .pid = entry.first,
-                        .tx_seq = entry.second.tx_seq,
-                        .tm = entry.second.tm_partition});
-                  }
-
-                  for (const auto& entry : _log_state.expiration) {
-                      tx_ss.expiration.push_back(expiration_snapshot{
-                        .pid = entry.first, .timeout = entry.second.timeout});
-                  }
-                  tx_ss.highest_producer_id = _highest_producer_id;
-
-                  fut_serialize = reflection::async_adl<tx_snapshot>{}.to(
-                    tx_ss_buf, std::move(tx_ss));
-
+                  fut_serialize
+                    = capture_tx_snapshot<tx_snapshot>(start_kafka_offset)
+                        .then([&tx_ss_buf, &offset](tx_snapshot tx_ss) {
+                            offset = tx_ss.offset;
+                            return reflection::async_adl<tx_snapshot>{}.to(
+                              tx_ss_buf, std::move(tx_ss));
+                        });
               } else {
                   vassert(false, "unsupported tx_snapshot version {}", version);
               }
-              return fut_serialize.then([version, &tx_ss_buf, this]() {
+              // the offset the state was captured at, apply may have moved
+              // on while the snapshot was serialized
+              return fut_serialize.then([version, &tx_ss_buf, &offset]() {
                   return raft::stm_snapshot::create(
-                    version, last_applied_offset(), std::move(tx_ss_buf));
+                    version, offset, std::move(tx_ss_buf));
               });
           });
     });
@@ -2407,7 +2435,7 @@ ss::future<> rm_stm::apply_raft_snapshot(const iobuf&) {
       "Resetting all state, reason: log eviction, offset: {}",
       _raft->start_offset());
     _log_state.reset();
-    _mem_state = mem_state{_tx_root_tracker};
+    _mem_state = mem_state{*_tx_root_tracker};
     co_await reset_producers();
     set_next(_raft->start_offset());
     co_return;
@@ -2485,7 +2513,7 @@ void rm_stm::setup_metrics() {
           labels),
         sm::make_gauge(
           "tx_mem_tracker_consumption_bytes",
-          [this] { return _tx_root_tracker.consumption(); },
+          [this] { return _tx_root_tracker->consumption(); },
           sm::description("Total memory bytes in use by tx subsystem."),
           labels),
       },
@@ -2499,9 +2527,9 @@ ss::future<> rm_stm::maybe_log_tx_stats() {
     }
     _ctx_log.debug(
       "tx root mem_tracker aggregate consumption: {}",
-      human::bytes(static_cast<double>(_tx_root_tracker.consumption())));
+      human::bytes(static_cast<double>(_tx_root_tracker->consumption())));
     _ctx_log.debug(
-      "tx mem tracker breakdown: {}", _tx_root_tracker.pretty_print_json());
+      "tx mem tracker breakdown: {}", _tx_root_tracker->pretty_print_json());
     auto units = co_await _state_lock.hold_read_lock();
     _ctx_log.debug(
       "tx memory snapshot stats: {{mem_state: {}, log_state: "
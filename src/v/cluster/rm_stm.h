@@ -26,6 +26,7 @@
 #include "raft/persisted_stm.h"
 #include "raft/state_machine.h"
 #include "raft/types.h"
+#include "resource_mgmt/memory_accounting.h"
 #include "storage/offset_translator_state.h"
 #include "storage/snapshot.h"
 #include "utils/available_promise.h"
@@ -275,6 +276,7 @@ private:
     ss::future<fragmented_vector<rm_stm::tx_range>>
       do_aborted_transactions(model::offset, model::offset);
     producer_ptr maybe_create_producer(model::producer_identity);
+    producer_ptr producer_for_apply(model::producer_identity);
     void cleanup_producer_state(model::producer_identity);
     ss::future<> reset_producers();
     model::record_batch make_fence_batch(
@@ -297,6 +299,8 @@ private:
     apply_local_snapshot(raft::stm_snapshot_header, iobuf&&) override;
     ss::future<raft::stm_snapshot> take_local_snapshot() override;
     ss::future<raft::stm_snapshot> do_take_local_snapshot(uint8_t version);
+    template<class T>
+    ss::future<T> capture_tx_snapshot(kafka::offset start_kafka_offset);
     ss::future<std::optional<abort_snapshot>> load_abort_snapshot(abort_index);
     ss::future<> save_abort_snapshot(abort_snapshot);
 
@@ -397,7 +401,9 @@ private:
      */
     ss::future<model::offset> bootstrap_committed_offset();
 
-    util::mem_tracker _tx_root_tracker{"tx-mem-root"};
+    ss::shared_ptr<util::mem_tracker> _tx_root_tracker
+      = resources::memory_accounting::local().create_tracker(
+        resources::memory_subsystem::stm, "tx-mem-root");
     // The state of this state machine maybe change via two paths
     //
     //   - by reading the already replicated commands from raft and
@@ -619,6 +625,10 @@ private:
     // stm is still replaying the log.
     std::optional<model::offset> _bootstrap_committed_offset;
     ss::basic_rwlock<> _state_lock;
+    // held by apply and while the state is captured for a snapshot
+    mutex _apply_lock;
+    // producer of the last applied batch
+    producer_ptr _last_applied_producer;
     bool _is_abort_idx_reduction_requested{false};
     mt::unordered_map_t<
       absl::flat_hash_map,
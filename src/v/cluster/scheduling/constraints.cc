@@ -324,6 +324,40 @@ soft_constraint least_disk_filled(
       std::make_unique<impl>(max_disk_usage_ratio, node_disk_reports));
 }
 
+soft_constraint least_produce_load(
+  const absl::flat_hash_map<model::node_id, uint64_t>& node_produce_rates) {
+    class impl : public soft_constraint::impl {
+    public:
+        explicit impl(
+          const absl::flat_hash_map<model::node_id, uint64_t>&
+            node_produce_rates)
+          : _node_produce_rates(node_produce_rates) {}
+
+        soft_constraint_evaluator
+        make_evaluator(const replicas_t&) const final {
+            uint64_t max_rate = 0;
+            for (const auto& [_, rate] : _node_produce_rates) {
+                max_rate = std::max(max_rate, rate);
+            }
+            return [this, max_rate](const allocation_node& node) -> uint64_t {
+                auto it = _node_produce_rates.find(node.id());
+                if (it == _node_produce_rates.end() || max_rate == 0) {
+                    return soft_constraint::max_score;
+                }
+                const double load = double(it->second) / max_rate;
+                return uint64_t(soft_constraint::max_score * (1.0 - load / 2));
+            };
+        }
+
+        ss::sstring name() const final { return "least produce load"; }
+
+        const absl::flat_hash_map<model::node_id, uint64_t>&
+          _node_produce_rates;
+    };
+
+    return soft_constraint(std::make_unique<impl>(node_produce_rates));
+}
+
 soft_constraint distinct_rack_preferred(const members_table& members) {
     return distinct_labels_preferred(
       rack_label.data(),
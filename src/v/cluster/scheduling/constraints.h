@@ -71,6 +71,15 @@ soft_constraint least_disk_filled(
   const absl::flat_hash_map<model::node_id, node_disk_space>&
     node_disk_reports);
 
+/*
+ * constraint scores nodes on the rate at which data is produced to the
+ * partitions they lead, preferring the least loaded nodes. The most loaded
+ * node scores half of an idle one. Nodes missing from `node_produce_rates`
+ * get the max score, callers should only pass rates known for all nodes.
+ */
+soft_constraint least_produce_load(
+  const absl::flat_hash_map<model::node_id, uint64_t>& node_produce_rates);
+
 template<
   typename Mapper,
   typename LabelType =
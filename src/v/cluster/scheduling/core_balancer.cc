@@ -0,0 +1,224 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "cluster/scheduling/core_balancer.h"
+
+#include "cluster/logger.h"
+#include "cluster/partition_manager.h"
+#include "cluster/topic_table.h"
+#include "cluster/topics_frontend.h"
+#include "ssx/future-util.h"
+
+#include <seastar/core/reactor.hh>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cluster {
+
+core_balancer::core_balancer(
+  model::node_id self,
+  topic_table& topics,
+  ss::sharded<partition_manager>& partition_manager,
+  ss::sharded<topics_frontend>& topics_frontend,
+  config::binding<bool> enabled,
+  config::binding<std::chrono::milliseconds> interval,
+  config::binding<double> imbalance_threshold)
+  : _self(self)
+  , _topics(topics)
+  , _partition_manager(partition_manager)
+  , _topics_frontend(topics_frontend)
+  , _enabled(std::move(enabled))
+  , _interval(std::move(interval))
+  , _imbalance_threshold(std::move(imbalance_threshold)) {}
+
+void core_balancer::start() {
+    _timer.set_callback([this] { tick(); });
+    _timer.arm(_interval());
+}
+
+ss::future<> core_balancer::stop() {
+    _timer.cancel();
+    return _gate.close();
+}
+
+void core_balancer::tick() {
+    ssx::spawn_with_gate(_gate, [this] {
+        return do_tick()
+          .handle_exception([](const std::exception_ptr& e) {
+              vlog(clusterlog.info, "core balancer tick failed: {}", e);
+          })
+          .finally([this] {
+              if (!_gate.is_closed()) {
+                  _timer.arm(_interval());
+              }
+          });
+    });
+}
+
+ss::future<> core_balancer::do_tick() {
+    if (!_enabled() || ss::smp::count < 2) {
+        _last_busy.clear();
+        _last_busiest.reset();
+        _last_produced.clear();
+        co_return;
+    }
+
+    auto busy = co_await _partition_manager.map(
+      [](partition_manager&) { return ss::engine().total_busy_time(); });
+    auto now = clock_type::now();
+    auto last_busy = std::exchange(_last_busy, busy);
+    auto last_sample_at = std::exchange(_last_sample_at, now);
+    if (last_busy.size() != busy.size() || now <= last_sample_at) {
+        co_return;
+    }
+
+    const auto elapsed = std::chrono::duration<double>(now - last_sample_at);
+    std::vector<double> utilization;
+    utilization.reserve(busy.size());
+    for (size_t i = 0; i < busy.size(); ++i) {
+        utilization.push_back(
+          std::chrono::duration<double>(busy[i] - last_busy[i]) / elapsed);
+    }
+
+    const auto busiest = static_cast<ss::shard_id>(std::distance(
+      utilization.begin(),
+      std::max_element(utilization.begin(), utilization.end())));
+
+    auto counters = co_await _partition_manager.invoke_on(
+      busiest, [](partition_manager& pm) {
+          produced_t ret;
+          ret.reserve(pm.partitions().size());
+          for (const auto& [ntp, p] : pm.partitions()) {
+              if (ntp == model::controller_ntp) {
+                  continue;
+              }
+              ret.emplace(ntp, p->probe().bytes_produced());
+          }
+          return ret;
+      });
+
+    auto last_busiest = std::exchange(_last_busiest, busiest);
+    auto last_produced = std::exchange(_last_produced, std::move(counters));
+    if (last_busiest != busiest) {
+        // counters of the busiest core are sampled for the first time, the
+        // rates are known at the next tick
+        co_return;
+    }
+
+    produced_t produced;
+    produced.reserve(_last_produced.size());
+    for (const auto& [ntp, bytes] : _last_produced) {
+        auto it = last_produced.find(ntp);
+        if (it != last_produced.end() && bytes >= it->second) {
+            produced.emplace(ntp, bytes - it->second);
+        }
+    }
+
+    auto move = plan_move(utilization, produced, _imbalance_threshold());
+    if (move) {
+        co_await do_move(std::move(*move));
+    }
+}
+
+ss::future<> core_balancer::do_move(shard_move move) {
+    auto assignment = _topics.get_partition_assignment(move.ntp);
+    if (!assignment || _topics.is_update_in_progress(move.ntp)) {
+        co_return;
+    }
+
+    auto replicas = assignment->replicas;
+    auto it = std::find_if(
+      replicas.begin(), replicas.end(), [this](const model::broker_shard& bs) {
+          return bs.node_id == _self;
+      });
+    if (it == replicas.end() || it->shard != move.from) {
+        co_return;
+    }
+    it->shard = move.to;
+
+    vlog(
+      clusterlog.info,
+      "moving {} from core {} to core {}",
+      move.ntp,
+      move.from,
+      move.to);
+    auto ec = co_await _topics_frontend.local()
+                .dispatch_move_partition_replicas(
+                  move.ntp, std::move(replicas), move_timeout);
+    if (ec) {
+        vlog(
+          clusterlog.info,
+          "unable to move {} to core {} - {}",
+          move.ntp,
+          move.to,
+          ec.message());
+    }
+
+    // the utilization of both cores changes with the move, start over with
+    // fresh samples
+    _last_busiest.reset();
+    _last_produced.clear();
+}
+
+std::optional<core_balancer::shard_move> core_balancer::plan_move(
+  const std::vector<double>& utilization,
+  const absl::flat_hash_map<model::ntp, uint64_t>& produced,
+  double threshold) {
+    if (utilization.size() < 2) {
+        return std::nullopt;
+    }
+    auto [min_it, max_it] = std::minmax_element(
+      utilization.begin(), utilization.end());
+    const double gap = *max_it - *min_it;
+    if (gap < threshold) {
+        return std::nullopt;
+    }
+
+    uint64_t total = 0;
+    for (const auto& [_, bytes] : produced) {
+        total += bytes;
+    }
+    if (total == 0) {
+        return std::nullopt;
+    }
+
+    // the utilization of the busiest core is attributed to its partitions in
+    // proportion to the bytes produced to them, the best candidate moves
+    // half of the gap. Partitions whose share is the whole gap or more would
+    // only swap the roles of the two cores.
+    const model::ntp* best = nullptr;
+    double best_distance = 0;
+    for (const auto& [ntp, bytes] : produced) {
+        const double share = *max_it * static_cast<double>(bytes)
+                             / static_cast<double>(total);
+        if (bytes == 0 || share >= gap) {
+            continue;
+        }
+        const double distance = std::abs(share - gap / 2);
+        if (best == nullptr || distance < best_distance) {
+            best = &ntp;
+            best_distance = distance;
+        }
+    }
+    if (best == nullptr) {
+        return std::nullopt;
+    }
+
+    return shard_move{
+      .ntp = *best,
+      .from = static_cast<ss::shard_id>(
+        std::distance(utilization.begin(), max_it)),
+      .to = static_cast<ss::shard_id>(
+        std::distance(utilization.begin(), min_it)),
+    };
+}
+
+} // namespace cluster
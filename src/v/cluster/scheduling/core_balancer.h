@@ -0,0 +1,108 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "absl/container/flat_hash_map.h"
+#include "cluster/fwd.h"
+#include "config/property.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+#include "seastarx.h"
+
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/core/timer.hh>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace cluster {
+
+/**
+ * Balances the replicas hosted by this node between its cores. Every interval
+ * the busy time of each core is sampled, when the busiest core is more than
+ * the threshold busier than the least busy one a replica is moved between
+ * them. The replica is chosen by the bytes produced to it during the last
+ * interval, so that moving it closes about half of the utilization gap.
+ *
+ * A move keeps the replica set of the partition and only changes the shard
+ * of this node, the controller backend then moves the replica without
+ * copying its data. Moves are requested from the controller leader and a
+ * single move is in flight at a time.
+ */
+class core_balancer {
+    using clock_type = ss::lowres_clock;
+
+    static constexpr std::chrono::milliseconds move_timeout
+      = std::chrono::seconds(10);
+
+public:
+    struct shard_move {
+        model::ntp ntp;
+        ss::shard_id from;
+        ss::shard_id to;
+    };
+
+    core_balancer(
+      model::node_id self,
+      topic_table&,
+      ss::sharded<partition_manager>&,
+      ss::sharded<topics_frontend>&,
+      config::binding<bool> enabled,
+      config::binding<std::chrono::milliseconds> interval,
+      config::binding<double> imbalance_threshold);
+
+    void start();
+    ss::future<> stop();
+
+    /**
+     * Picks the replica to move from the busiest to the least busy core.
+     *
+     * \param utilization fraction of the interval each core was busy
+     * \param produced bytes produced during the interval to each partition
+     *   hosted by the busiest core
+     * \param threshold utilization gap below which nothing is moved
+     */
+    static std::optional<shard_move> plan_move(
+      const std::vector<double>& utilization,
+      const absl::flat_hash_map<model::ntp, uint64_t>& produced,
+      double threshold);
+
+private:
+    using produced_t = absl::flat_hash_map<model::ntp, uint64_t>;
+
+    void tick();
+    ss::future<> do_tick();
+    ss::future<> do_move(shard_move);
+
+    model::node_id _self;
+    topic_table& _topics;
+    ss::sharded<partition_manager>& _partition_manager;
+    ss::sharded<topics_frontend>& _topics_frontend;
+    config::binding<bool> _enabled;
+    config::binding<std::chrono::milliseconds> _interval;
+    config::binding<double> _imbalance_threshold;
+
+    // busy time of every core at the last sample
+    std::vector<std::chrono::nanoseconds> _last_busy;
+    clock_type::time_point _last_sample_at;
+    // produced bytes counters of the partitions of the core that was the
+    // busiest at the last sample
+    std::optional<ss::shard_id> _last_busiest;
+    produced_t _last_produced;
+
+    ss::gate _gate;
+    ss::timer<clock_type> _timer;
+};
+
+} // namespace cluster
@@ -13,6 +13,8 @@
 #include "model/metadata.h"
 #include "vassert.h"
 
+#include <algorithm>
+
 namespace cluster::leader_balancer_types {
 
 even_topic_distributon_constraint::even_topic_distributon_constraint(
@@ -384,4 +386,143 @@ std::vector<shard_load> even_shard_load_constraint::stats() const {
     return ret;
 }
 
+weighted_shard_load_constraint::weighted_shard_load_constraint(
+  shard_index shards,
+  const group_weights_t& weights,
+  const muted_index& mi,
+  double hysteresis)
+  : _si(std::move(shards))
+  , _mi(mi)
+  , _hysteresis(hysteresis) {
+    double total_weight = 0;
+    size_t num_weighted = 0;
+    for (const auto& [bs, groups] : si().shards()) {
+        for (const auto& [group, _] : groups) {
+            if (auto it = weights.find(group); it != weights.end()) {
+                total_weight += it->second;
+                ++num_weighted;
+            }
+        }
+    }
+    // normalize weights so that the errors are in the same units as the
+    // errors of the unweighted constraints
+    if (total_weight > 0) {
+        const double mean_weight = total_weight / num_weighted;
+        _weights.reserve(weights.size());
+        for (const auto& [group, w] : weights) {
+            _weights.emplace(group, w / mean_weight);
+        }
+    }
+
+    size_t num_cores = 0;
+    double total_load = 0;
+    for (const auto& [bs, groups] : si().shards()) {
+        double shard_load = 0;
+        for (const auto& [group, _] : groups) {
+            shard_load += weight(group);
+        }
+        _load.emplace(bs, shard_load);
+        // as in even_shard_load_constraint, leadership won't be moved to or
+        // from muted nodes so their capacity and load are not accounted for
+        if (!mi.muted_nodes().contains(bs.node_id)) {
+            ++num_cores;
+            total_load += shard_load;
+        }
+    }
+    if (num_cores > 0) {
+        _target_load = total_load / num_cores;
+    }
+    calculate_error();
+}
+
+double weighted_shard_load_constraint::weight(raft::group_id group) const {
+    if (auto it = _weights.find(group); it != _weights.end()) {
+        return it->second;
+    }
+    return 1.0;
+}
+
+double
+weighted_shard_load_constraint::load(const model::broker_shard& bs) const {
+    if (auto it = _load.find(bs); it != _load.end()) {
+        return it->second;
+    }
+    return 0;
+}
+
+void weighted_shard_load_constraint::calculate_error() {
+    _error = 0;
+    for (const auto& [bs, shard_load] : _load) {
+        if (!mi().muted_nodes().contains(bs.node_id)) {
+            _error += pow(shard_load - _target_load, 2);
+        }
+    }
+}
+
+void weighted_shard_load_constraint::update_index(const reassignment& r) {
+    const double w = weight(r.group);
+    auto& from_load = _load[r.from];
+    auto& to_load = _load[r.to];
+    _error -= pow(from_load - _target_load, 2) + pow(to_load - _target_load, 2);
+    from_load -= w;
+    to_load += w;
+    _error += pow(from_load - _target_load, 2) + pow(to_load - _target_load, 2);
+    _si.update_index(r);
+}
+
+double
+weighted_shard_load_constraint::improvement(const reassignment& r) const {
+    const double w = weight(r.group);
+    const double gap = load(r.from) - load(r.to);
+    // moving w from `from` to `to` changes the sum of squared deviations by
+    // 2w(w - gap), i.e. it only helps if the gap is larger than the weight
+    const double improvement = 2 * w * (gap - w);
+    if (gap - w <= _hysteresis * _target_load) {
+        return std::min(improvement, 0.0);
+    }
+    return improvement;
+}
+
+std::optional<reassignment>
+weighted_shard_load_constraint::recommended_reassignment() {
+    std::vector<std::pair<model::broker_shard, double>> by_load;
+    by_load.reserve(_load.size());
+    for (const auto& [bs, shard_load] : _load) {
+        if (!mi().muted_nodes().contains(bs.node_id)) {
+            by_load.emplace_back(bs, shard_load);
+        }
+    }
+    std::sort(by_load.begin(), by_load.end(), [](const auto& a, const auto& b) {
+        return a.second > b.second;
+    });
+
+    for (const auto& [from, _] : by_load) {
+        auto it = si().shards().find(from);
+        if (it == si().shards().end()) {
+            continue;
+        }
+        std::optional<reassignment> best;
+        double best_improvement = 0;
+        for (const auto& [group, replicas] : it->second) {
+            if (mi().muted_groups().contains(group)) {
+                continue;
+            }
+            for (const auto& to : replicas) {
+                if (to == from || mi().muted_nodes().contains(to.node_id)) {
+                    continue;
+                }
+                reassignment r{group, from, to};
+                if (auto imp = improvement(r); imp > best_improvement) {
+                    best_improvement = imp;
+                    best = r;
+                }
+            }
+        }
+        if (best) {
+            return best;
+        }
+    }
+    return std::nullopt;
+}
+
 } // namespace cluster::leader_balancer_types
@@ -328,4 +328,76 @@ private:
     std::pair<load_t, load_map_t> build_load_indexes() const;
 };
 
+/*
+ * Same as even_shard_load_constraint but the load of a shard is the sum of
+ * the weights of the groups it leads, so that a few groups carrying most of
+ * the traffic get spread across shards. Weights are normalized so that the
+ * average group weighs 1, groups without a weight get the average weight.
+ *
+ * To avoid moving leaders back and forth as weights fluctuate, a move is only
+ * considered an improvement if the load gap between the shards exceeds the
+ * weight of the group by more than a `hysteresis` fraction of the target load.
+ */
+class weighted_shard_load_constraint final
+  : public soft_constraint
+  , public index {
+public:
+    weighted_shard_load_constraint(
+      shard_index si,
+      const group_weights_t& weights,
+      const muted_index& mi,
+      double hysteresis);
+
+    weighted_shard_load_constraint(weighted_shard_load_constraint&&) noexcept
+      = default;
+    weighted_shard_load_constraint&
+    operator=(weighted_shard_load_constraint&&) noexcept
+      = default;
+
+    weighted_shard_load_constraint(const weighted_shard_load_constraint&)
+      = delete;
+    weighted_shard_load_constraint&
+    operator=(const weighted_shard_load_constraint&)
+      = delete;
+
+    ~weighted_shard_load_constraint() override = default;
+
+    double error() const { return _error; }
+    void update_index(const reassignment& r) override;
+
+    /*
+     * Find the move of a group from the most loaded shard to one of its
+     * replicas that improves error the most.
+     */
+    std::optional<reassignment> recommended_reassignment() override;
+
+    double load(const model::broker_shard& bs) const;
+    double target_load() const { return _target_load; }
+
+private:
+    shard_index _si;
+    std::reference_wrapper<const muted_index> _mi;
+    group_weights_t _weights;
+    absl::flat_hash_map<model::broker_shard, double> _load;
+    double _hysteresis;
+    double _target_load{0};
+    double _error{0};
+
+    const shard_index& si() const { return _si; }
+    const muted_index& mi() const { return _mi.get(); }
+
+    double weight(raft::group_id) const;
+    void calculate_error();
+
+    /*
+     * Error improvement of moving the group, zero or negative if the move
+     * doesn't improve balance by more than the hysteresis.
+     */
+    double improvement(const reassignment&) const;
+
+    double evaluate_internal(const reassignment& r) override {
+        return improvement(r);
+    }
+};
+
 } // namespace cluster::leader_balancer_types
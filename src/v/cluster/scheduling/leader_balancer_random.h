@@ -106,14 +106,32 @@ private:
 
 class random_hill_climbing_strategy final : public leader_balancer_strategy {
 public:
+    /*
+     * If group weights are given, shard load is balanced by the sum of the
+     * weights of the groups led by each shard instead of by leader counts.
+     */
     random_hill_climbing_strategy(
-      index_type index, group_id_to_topic_revision_t g_to_ntp, muted_index mi)
+      index_type index,
+      group_id_to_topic_revision_t g_to_ntp,
+      muted_index mi,
+      std::optional<group_weights_t> weights = std::nullopt)
       : _mi(std::make_unique<muted_index>(std::move(mi)))
       , _reassignments(index)
       , _etdc(std::move(g_to_ntp), shard_index(index), *_mi)
-      , _eslc(shard_index(std::move(index)), *_mi) {}
+      // the index is only needed again by the weighted constraint
+      , _eslc(shard_index(weights ? index : std::move(index)), *_mi) {
+        if (weights) {
+            _wslc.emplace(
+              shard_index(std::move(index)),
+              *weights,
+              *_mi,
+              weighted_load_hysteresis);
+        }
+    }
 
-    double error() const override { return _eslc.error() + _etdc.error(); }
+    double error() const override {
+        return shard_load_error() + _etdc.error();
+    }
 
     /*
      * Find a group reassignment that reduces total error.
@@ -136,7 +154,8 @@ public:
             }
 
             auto eval = _etdc.evaluate(reassignment)
-                        + _eslc.evaluate(reassignment);
+                        + (_wslc ? _wslc->evaluate(reassignment)
+                                 : _eslc.evaluate(reassignment));
 
             if (eval <= error_jitter) {
                 continue;
@@ -151,6 +170,9 @@ public:
     void apply_movement(const reassignment& reassignment) override {
         _etdc.update_index(reassignment);
         _eslc.update_index(reassignment);
+        if (_wslc) {
+            _wslc->update_index(reassignment);
+        }
         _mi->update_index(reassignment);
         _reassignments.update_index(reassignment);
     }
@@ -162,12 +184,22 @@ public:
 
 private:
     static constexpr double error_jitter = 0.000001;
+    // a weighted move is only made if the load gap between the two shards
+    // exceeds the group's weight by more than 10% of the target load, so that
+    // fluctuating weights don't bounce leaders around
+    static constexpr double weighted_load_hysteresis = 0.1;
+
+    double shard_load_error() const {
+        return _wslc ? _wslc->error() : _eslc.error();
+    }
 
     std::unique_ptr<muted_index> _mi;
     random_reassignments _reassignments;
 
     even_topic_distributon_constraint _etdc;
+    // leader counts per shard are still tracked for stats()
     even_shard_load_constraint _eslc;
+    std::optional<weighted_shard_load_constraint> _wslc;
 };
 
 } // namespace cluster::leader_balancer_types
@@ -43,6 +43,12 @@ using index_type = absl::node_hash_map<
 using group_id_to_topic_revision_t
   = absl::btree_map<raft::group_id, model::revision_id>;
 
+/*
+ * Relative weight of being the leader of a group, e.g. derived from the
+ * recent produce and fetch throughput of the partition.
+ */
+using group_weights_t = absl::flat_hash_map<raft::group_id, double>;
+
 /*
  * Leaders per shard.
  */
@@ -300,6 +300,16 @@ partition_allocator::allocate(allocation_request request) {
       std::move(assignments).finish(), *_state, request.domain));
 }
 
+ss::future<std::vector<result<allocation_units::pointer>>>
+partition_allocator::allocate(std::vector<allocation_request> requests) {
+    std::vector<result<allocation_units::pointer>> ret;
+    ret.reserve(requests.size());
+    for (auto& request : requests) {
+        ret.push_back(co_await allocate(std::move(request)));
+    }
+    co_return ret;
+}
+
 result<allocated_partition> partition_allocator::reallocate_partition(
   model::topic_namespace nt,
   partition_constraints p_constraints,
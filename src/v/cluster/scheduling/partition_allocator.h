@@ -48,6 +48,14 @@ public:
      */
     ss::future<result<allocation_units::pointer>> allocate(allocation_request);
 
+    /**
+     * Allocate several requests in a single call, e.g. all the topics of a
+     * create topics request. Requests are allocated in order and each of them
+     * succeeds or fails independently of the others.
+     */
+    ss::future<std::vector<result<allocation_units::pointer>>>
+      allocate(std::vector<allocation_request>);
+
     /// Reallocate an already existing partition. Existing replicas from
     /// replicas_to_reallocate will be reallocated, and a number of additional
     /// replicas to reach the requested replication factor will be allocated
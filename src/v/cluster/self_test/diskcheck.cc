@@ -20,6 +20,7 @@
 
 #include <seastar/core/seastar.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/core/when_all.hh>
 
 namespace cluster::self_test {
 
@@ -141,33 +142,67 @@ diskcheck::initialize_benchmark(ss::sstring fname) {
 ss::future<std::vector<self_test_result>>
 diskcheck::run_configured_benchmarks(ss::file& file) {
     std::vector<self_test_result> r;
-    auto write_metrics = co_await do_run_benchmark<read_or_write::write>(file);
-    auto result = write_metrics.to_st_result();
-    result.name = _opts.name;
-    result.info = "write run";
-    result.test_type = "disk";
-    if (_cancelled) {
-        result.warning = "Run was manually cancelled";
-    }
-    r.push_back(std::move(result));
+    auto write_metrics = co_await do_run_benchmark<read_or_write::write>(
+      file, _opts.parallelism);
+    r.push_back(to_st_result(write_metrics, "write run"));
     if (!_opts.skip_read) {
         auto read_metrics = co_await do_run_benchmark<read_or_write::read>(
-          file);
-        auto result = read_metrics.to_st_result();
-        result.name = _opts.name;
-        result.info = "read run";
-        result.test_type = "disk";
-        if (_cancelled) {
-            result.warning = "Run was manually cancelled";
+          file, _opts.parallelism);
+        r.push_back(to_st_result(read_metrics, "read run"));
+        /// In the terms of the seastar io-properties, to compare against the
+        /// ones the node was configured with
+        vlog(
+          clusterlog.info,
+          "Disk self test '{}' measured with {} byte requests, read_iops: {} "
+          "read_bandwidth: {} write_iops: {} write_bandwidth: {}",
+          _opts.name,
+          _opts.request_size,
+          read_metrics.iops(),
+          read_metrics.throughput_bytes_sec(),
+          write_metrics.iops(),
+          write_metrics.throughput_bytes_sec());
+    }
+    if (_opts.fsync) {
+        /// The latency of a lone fsync, then of fsyncs queued behind each
+        /// other as the appends of many partitions are
+        auto fsync_metrics
+          = co_await do_run_benchmark<read_or_write::write_fsync>(file, 1);
+        r.push_back(to_st_result(fsync_metrics, "fsync run, parallelism 1"));
+        if (_opts.parallelism > 1) {
+            auto fsync_metrics
+              = co_await do_run_benchmark<read_or_write::write_fsync>(
+                file, _opts.parallelism);
+            r.push_back(to_st_result(
+              fsync_metrics,
+              ssx::sformat("fsync run, parallelism {}", _opts.parallelism)));
         }
-        r.push_back(std::move(result));
+    }
+    if (_opts.read_while_write) {
+        auto [read_metrics, write_metrics]
+          = co_await do_run_read_while_write_benchmark(file);
+        r.push_back(to_st_result(read_metrics, "read while write run, reads"));
+        r.push_back(
+          to_st_result(write_metrics, "read while write run, writes"));
     }
     co_return r;
 }
 
+self_test_result
+diskcheck::to_st_result(const metrics& m, ss::sstring info) const {
+    auto result = m.to_st_result();
+    result.name = _opts.name;
+    result.info = std::move(info);
+    result.test_type = "disk";
+    if (_cancelled) {
+        result.warning = "Run was manually cancelled";
+    }
+    return result;
+}
+
 template<diskcheck::read_or_write mode>
-ss::future<metrics> diskcheck::do_run_benchmark(ss::file& file) {
-    auto irange = boost::irange<uint16_t>(0, _opts.parallelism);
+ss::future<metrics>
+diskcheck::do_run_benchmark(ss::file& file, uint16_t parallelism) {
+    auto irange = boost::irange<uint16_t>(0, parallelism);
     auto start = ss::lowres_clock::now();
     static const auto five_seconds_us = 500000;
     metrics m{five_seconds_us};
@@ -189,6 +224,44 @@ ss::future<metrics> diskcheck::do_run_benchmark(ss::file& file) {
     co_return m;
 }
 
+ss::future<std::pair<metrics, metrics>>
+diskcheck::do_run_read_while_write_benchmark(ss::file& file) {
+    const uint16_t writers = std::max<uint16_t>(_opts.parallelism / 2, 1);
+    const uint16_t readers = std::max<uint16_t>(
+      _opts.parallelism - writers, 1);
+    auto start = ss::lowres_clock::now();
+    static const auto five_seconds_us = 500000;
+    metrics read_m{five_seconds_us};
+    metrics write_m{five_seconds_us};
+    ss::timer<ss::lowres_clock> timer;
+    timer.set_callback([this] { _intent.cancel(); });
+    timer.rearm(start + _opts.duration);
+    try {
+        co_await ss::when_all_succeed(
+          ss::parallel_for_each(
+            boost::irange<uint16_t>(0, readers),
+            [this, &start, &file, &read_m](auto) {
+                return run_benchmark_fiber<read_or_write::read>(
+                  start, file, read_m);
+            }),
+          ss::parallel_for_each(
+            boost::irange<uint16_t>(0, writers),
+            [this, &start, &file, &write_m](auto) {
+                return run_benchmark_fiber<read_or_write::write>(
+                  start, file, write_m);
+            }))
+          .discard_result();
+    } catch (const ss::cancelled_error&) {
+        vlog(clusterlog.debug, "Benchmark completed (duration reached)");
+    }
+    timer.cancel();
+    const auto total_time = ss::lowres_clock::now() - start;
+    read_m.set_total_time(total_time);
+    write_m.set_total_time(total_time);
+    _last_pos = 0;
+    co_return std::make_pair(std::move(read_m), std::move(write_m));
+}
+
 template<diskcheck::read_or_write mode>
 ss::future<> diskcheck::run_benchmark_fiber(
   ss::lowres_clock::time_point start, ss::file& file, metrics& m) {
@@ -211,6 +284,11 @@ ss::future<> diskcheck::run_benchmark_fiber(
         co_await m.measure([this, &iov, &file] {
             if constexpr (mode == read_or_write::write) {
                 return file.dma_write(get_pos(), iov, &_intent);
+            } else if constexpr (mode == read_or_write::write_fsync) {
+                return file.dma_write(get_pos(), iov, &_intent)
+                  .then([&file](size_t bytes) {
+                      return file.flush().then([bytes] { return bytes; });
+                  });
             } else {
                 return file.dma_read(get_pos(), iov, &_intent);
             }
@@ -81,8 +81,9 @@ public:
     /// Run the actual disk benchmark
     ///
     /// Runs sequential write then read benchmarks (unless otherwise either
-    /// marked as skip in configuration options). Note that each sub-benchmark
-    /// will run for at least the total run time desired.
+    /// marked as skip in configuration options), then the fsync and read while
+    /// write benchmarks if enabled. Note that each sub-benchmark will run for
+    /// at least the total run time desired.
     ss::future<std::vector<self_test_result>> run(diskcheck_opts);
 
     /// Signal to stop all work as soon as possible
@@ -92,7 +93,9 @@ public:
     void cancel();
 
 private:
-    enum class read_or_write { read, write };
+    /// write_fsync follows each write with an fdatasync, as a segment
+    /// append acknowledged with acks=all does
+    enum class read_or_write { read, write, write_fsync };
 
     ss::future<std::vector<self_test_result>> initialize_benchmark(ss::sstring);
     ss::future<std::vector<self_test_result>>
@@ -101,7 +104,14 @@ private:
     ss::future<> verify_remaining_space(size_t dataset_size);
 
     template<read_or_write mode>
-    ss::future<metrics> do_run_benchmark(ss::file&);
+    ss::future<metrics> do_run_benchmark(ss::file&, uint16_t parallelism);
+
+    /// Runs reads and writes concurrently, returns the read then write
+    /// metrics
+    ss::future<std::pair<metrics, metrics>>
+    do_run_read_while_write_benchmark(ss::file&);
+
+    self_test_result to_st_result(const metrics&, ss::sstring info) const;
 
     template<read_or_write mode>
     ss::future<> run_benchmark_fiber(
@@ -0,0 +1,272 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "cluster/self_test/storagecheck.h"
+
+#include "cluster/logger.h"
+#include "likely.h"
+#include "random/generators.h"
+#include "resource_mgmt/io_priority.h"
+#include "ssx/sformat.h"
+#include "storage/batch_cache.h"
+#include "storage/chunk_cache.h"
+#include "storage/record_batch_builder.h"
+#include "storage/segment_appender.h"
+#include "storage/segment_utils.h"
+#include "storage/storage_resources.h"
+#include "utils/uuid.h"
+#include "vlog.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
+namespace cluster::self_test {
+
+namespace {
+/// Number of batches read back from the batch cache, in turn
+constexpr size_t cached_batches = 64;
+/// Upper bound of the latency histograms, in microseconds
+constexpr int64_t max_latency_us = 5'000'000;
+} // namespace
+
+void storagecheck::validate_options(const storagecheck_opts& opts) {
+    using namespace std::chrono_literals;
+    const auto duration = std::chrono::duration_cast<std::chrono::seconds>(
+      opts.duration);
+    if (duration < 1s || duration > (5 * 60s)) {
+        throw storagecheck_option_out_of_range(
+          "Duration out of range, min is 1s max is 5 minutes");
+    }
+    if (opts.records_per_batch < 1 || opts.records_per_batch > 10000) {
+        throw storagecheck_option_out_of_range(
+          "Records per batch out of range, min is 1, max 10000");
+    }
+    if (opts.record_size < 1 || opts.record_size > (1ULL << 20)) {
+        throw storagecheck_option_out_of_range(
+          "Record size out of range, min is 1 byte, max 1MiB");
+    }
+    if (opts.flush_every < 1) {
+        throw storagecheck_option_out_of_range(
+          "Flush every out of range, min is 1 batch");
+    }
+    const auto batch_size = opts.records_per_batch * opts.record_size;
+    if (batch_size > (16ULL << 20)) {
+        throw storagecheck_option_out_of_range(
+          "Batch size (records_per_batch * record_size) out of range, max is "
+          "16MiB");
+    }
+    if (opts.segment_size < 2 * batch_size || opts.segment_size < (1 << 20)) {
+        throw storagecheck_option_out_of_range(
+          "Segment size out of range, min is 1MiB and twice the batch size");
+    }
+}
+
+ss::future<> storagecheck::start() { return ss::now(); }
+
+ss::future<> storagecheck::stop() {
+    auto f = _gate.close();
+    _as.request_abort();
+    return f;
+}
+
+void storagecheck::cancel() { _cancelled = true; }
+
+void storagecheck::check_aborted() const {
+    if (unlikely(_as.abort_requested())) {
+        throw storagecheck_aborted_exception();
+    }
+}
+
+ss::future<std::vector<self_test_result>>
+storagecheck::run(storagecheck_opts opts) {
+    if (_gate.is_closed()) {
+        vlog(clusterlog.debug, "storagecheck - gate already closed");
+        co_return std::vector<self_test_result>();
+    }
+    auto g = _gate.hold();
+    co_await ss::futurize_invoke(validate_options, opts);
+    vlog(
+      clusterlog.info,
+      "Starting redpanda self-test storage benchmark, with options: {}",
+      opts);
+    _cancelled = false;
+    _opts = opts;
+    std::filesystem::create_directories(_opts.dir);
+    const auto fname = ssx::sformat(
+      "{}/rp-self-test-storage-{}-{}",
+      _opts.dir.string(),
+      uuid_t::create(),
+      ss::this_shard_id());
+    co_return co_await run_benchmarks(fname).finally([fname] {
+        vlog(
+          clusterlog.debug,
+          "redpanda self-test storage benchmark completed gracefully");
+        return ss::remove_file(fname).handle_exception_type(
+          [fname](const std::filesystem::filesystem_error& fs_ex) {
+              vlog(
+                clusterlog.error,
+                "Couldn't delete {}, reason {}",
+                fname,
+                fs_ex);
+          });
+    });
+}
+
+ss::future<std::vector<self_test_result>>
+storagecheck::run_benchmarks(ss::sstring fname) {
+    std::vector<self_test_result> r;
+    try {
+        auto file = co_await storage::internal::make_writer_handle(
+          std::filesystem::path(fname), std::nullopt, true);
+        const auto batch = make_batch(model::offset(0));
+        auto append_metrics = co_await ss::with_scheduling_group(
+          _opts.sg, [this, file = std::move(file), &batch]() mutable {
+              return run_append_benchmark(std::move(file), batch);
+          });
+        r.push_back(to_result(append_metrics, "append run"));
+        if (!_opts.skip_read) {
+            auto read_metrics = co_await ss::with_scheduling_group(
+              _opts.sg, [this] { return run_read_benchmark(); });
+            r.push_back(to_result(read_metrics, "batch cache read run"));
+        }
+    } catch (const storagecheck_aborted_exception&) {
+        vlog(clusterlog.debug, "storagecheck stopped due to call to stop()");
+    }
+    co_return r;
+}
+
+/// Appends the same batch over and over, as a partition would append the
+/// batches produced to it, flushing every 'flush_every' batches. A measurement
+/// spans the appends and the flush that makes them durable.
+ss::future<metrics> storagecheck::run_append_benchmark(
+  ss::file file, const model::record_batch& batch) {
+    storage::storage_resources resources;
+    storage::segment_appender appender(
+      std::move(file),
+      storage::segment_appender::options(
+        raft_priority(),
+        storage::segment_appender::write_behind_memory
+          / storage::internal::chunks().chunk_size(),
+        _opts.segment_size,
+        resources));
+
+    metrics m{max_latency_us};
+    const auto start = ss::lowres_clock::now();
+    const auto stop = start + _opts.duration;
+    std::exception_ptr ex;
+    try {
+        while (stop > ss::lowres_clock::now() && !_cancelled) {
+            check_aborted();
+            if (
+              appender.file_byte_offset()
+                + _opts.flush_every * batch.size_bytes()
+              > _opts.segment_size) {
+                /// Start over rather than growing the file past the segment
+                /// size, as a partition would roll onto a new segment
+                co_await appender.truncate(0);
+            }
+            co_await m.measure(
+              [this, &appender, &batch]() -> ss::future<size_t> {
+                  size_t bytes = 0;
+                  for (size_t i = 0; i < _opts.flush_every; ++i) {
+                      co_await appender.append(batch);
+                      bytes += batch.size_bytes();
+                  }
+                  co_await appender.flush();
+                  co_return bytes;
+              });
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    m.set_total_time(ss::lowres_clock::now() - start);
+    co_await appender.close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+    co_return m;
+}
+
+/// Reads batches back from a batch cache, as the fetches of recently produced
+/// data are served. A measurement spans the lookup of a batch and the copy of
+/// it that is handed to the reader.
+ss::future<metrics> storagecheck::run_read_benchmark() {
+    const auto batch_size = make_batch(model::offset(0)).size_bytes();
+    storage::batch_cache cache(storage::batch_cache::reclaim_options{
+      .growth_window = std::chrono::seconds(3),
+      .stable_window = std::chrono::seconds(10),
+      .min_size = 128 << 10,
+      .max_size = std::max<size_t>(2 * cached_batches * batch_size, 1 << 20),
+      .background_reclaimer_sg = _opts.sg});
+    std::exception_ptr ex;
+    metrics m{max_latency_us};
+    {
+        storage::batch_cache_index index(cache);
+        for (size_t i = 0; i < cached_batches; ++i) {
+            index.put(make_batch(model::offset(i * _opts.records_per_batch)));
+        }
+
+        const auto start = ss::lowres_clock::now();
+        const auto stop = start + _opts.duration;
+        size_t next = 0;
+        try {
+            while (stop > ss::lowres_clock::now() && !_cancelled) {
+                check_aborted();
+                const auto offset = model::offset(
+                  (next++ % cached_batches) * _opts.records_per_batch);
+                co_await m.measure([&index, offset] {
+                    auto batch = index.get(offset);
+                    if (!batch) {
+                        /// Reclaimed under memory pressure
+                        throw omit_metrics_measurement_exception();
+                    }
+                    return ss::make_ready_future<size_t>(batch->size_bytes());
+                });
+                co_await ss::coroutine::maybe_yield();
+            }
+        } catch (...) {
+            ex = std::current_exception();
+        }
+        m.set_total_time(ss::lowres_clock::now() - start);
+    }
+    co_await cache.stop();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+    co_return m;
+}
+
+model::record_batch storagecheck::make_batch(model::offset base) const {
+    storage::record_batch_builder builder(
+      model::record_batch_type::raft_data, base);
+    for (size_t i = 0; i < _opts.records_per_batch; ++i) {
+        iobuf value;
+        auto data = random_generators::gen_alphanum_string(_opts.record_size);
+        value.append(data.data(), data.size());
+        builder.add_raw_kv(std::nullopt, std::move(value));
+    }
+    return std::move(builder).build();
+}
+
+self_test_result
+storagecheck::to_result(const metrics& m, ss::sstring info) const {
+    auto result = m.to_st_result();
+    result.name = _opts.name;
+    result.info = std::move(info);
+    result.test_type = "storage";
+    if (_cancelled) {
+        result.warning = "Run was manually cancelled";
+    }
+    return result;
+}
+
+} // namespace cluster::self_test
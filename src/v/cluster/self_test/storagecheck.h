@@ -0,0 +1,85 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "cluster/self_test/metrics.h"
+#include "cluster/self_test_rpc_types.h"
+#include "model/record.h"
+#include "seastarx.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+
+namespace cluster::self_test {
+
+class storagecheck_exception : public std::runtime_error {
+public:
+    explicit storagecheck_exception(const std::string& msg)
+      : std::runtime_error(msg) {}
+};
+class storagecheck_option_out_of_range final : public storagecheck_exception {
+public:
+    explicit storagecheck_option_out_of_range(const std::string& msg)
+      : storagecheck_exception(msg) {}
+};
+class storagecheck_aborted_exception final : public storagecheck_exception {
+public:
+    storagecheck_aborted_exception()
+      : storagecheck_exception("User aborted benchmark") {}
+};
+
+/// Storage benchmark exercising the data paths of redpanda rather than the
+/// raw disk
+///
+/// Where diskcheck reports what the disk is capable of, this benchmark reports
+/// what the storage layer makes of it: synthetic record batches are appended
+/// to a segment with the storage::segment_appender, flushed as a partition
+/// would for acks=all, then read back from a storage::batch_cache. Comparing
+/// the two across nodes and over time helps telling a hardware regression
+/// apart from a configuration or software one.
+class storagecheck final {
+public:
+    /// Made public for unit testing, only used internally
+    ///
+    static void validate_options(const storagecheck_opts& opts);
+
+    ss::future<> start();
+
+    /// On resolution of the future returned all async work will have completed
+    ss::future<> stop();
+
+    /// Run the append, then unless skipped the batch cache read, benchmarks
+    /// each for the total run time desired
+    ss::future<std::vector<self_test_result>> run(storagecheck_opts);
+
+    /// Signal to stop all work as soon as possible
+    void cancel();
+
+private:
+    ss::future<std::vector<self_test_result>> run_benchmarks(ss::sstring);
+    ss::future<metrics>
+    run_append_benchmark(ss::file, const model::record_batch&);
+    ss::future<metrics> run_read_benchmark();
+
+    model::record_batch make_batch(model::offset base) const;
+    self_test_result to_result(const metrics&, ss::sstring info) const;
+    void check_aborted() const;
+
+private:
+    bool _cancelled{false};
+    ss::abort_source _as;
+    ss::gate _gate;
+    storagecheck_opts _opts;
+};
+
+} // namespace cluster::self_test
@@ -11,6 +11,7 @@
 
 #include "cluster/self_test/diskcheck.h"
 #include "cluster/self_test/netcheck.h"
+#include "cluster/self_test/storagecheck.h"
 #include "json/document.h"
 
 #include <boost/math/special_functions/binomial.hpp>
@@ -93,6 +94,39 @@ BOOST_AUTO_TEST_CASE(test_netcheck_validation) {
       .parallelism = 25}));
 }
 
+BOOST_AUTO_TEST_CASE(test_storagecheck_validation) {
+    namespace cft = cluster::self_test;
+
+    BOOST_CHECK_THROW(
+      cft::storagecheck::validate_options(
+        cluster::storagecheck_opts{.duration = 100ms}),
+      cft::storagecheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::storagecheck::validate_options(
+        cluster::storagecheck_opts{.records_per_batch = 0}),
+      cft::storagecheck_option_out_of_range);
+    BOOST_CHECK_THROW(
+      cft::storagecheck::validate_options(
+        cluster::storagecheck_opts{.flush_every = 0}),
+      cft::storagecheck_option_out_of_range);
+    /// The segment must hold at least two batches
+    BOOST_CHECK_THROW(
+      cft::storagecheck::validate_options(cluster::storagecheck_opts{
+        .records_per_batch = 1000,
+        .record_size = 10000,
+        .segment_size = 10000000}),
+      cft::storagecheck_option_out_of_range);
+
+    BOOST_CHECK_NO_THROW(
+      cft::storagecheck::validate_options(cluster::storagecheck_opts{}));
+    BOOST_CHECK_NO_THROW(
+      cft::storagecheck::validate_options(cluster::storagecheck_opts{
+        .records_per_batch = 1,
+        .record_size = 512,
+        .flush_every = 8,
+        .duration = 1000ms}));
+}
+
 static const std::string sample_self_test_config = R"(
 {
     "tests": [
@@ -101,6 +135,7 @@ static const std::string sample_self_test_config = R"(
             "dsync" : false,
             "skip_write" : true,
             "skip_read" : false,
+            "fsync" : true,
             "data_size" : 500000,
             "request_size" : 330000,
             "duration_ms" : 10000,
@@ -146,6 +181,8 @@ BOOST_AUTO_TEST_CASE(test_self_test_json_serde) {
     BOOST_CHECK_EQUAL(dsk_opts.dsync, false);
     BOOST_CHECK_EQUAL(dsk_opts.skip_write, true);
     BOOST_CHECK_EQUAL(dsk_opts.skip_read, false);
+    BOOST_CHECK_EQUAL(dsk_opts.fsync, true);
+    BOOST_CHECK_EQUAL(dsk_opts.read_while_write, false);
     BOOST_CHECK_EQUAL(dsk_opts.data_size, 500000);
     BOOST_CHECK_EQUAL(dsk_opts.request_size, 330000);
     BOOST_CHECK_EQUAL(dsk_opts.duration, 10000ms);
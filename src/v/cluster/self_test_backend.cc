@@ -37,18 +37,22 @@ self_test_backend::self_test_backend(
 ss::future<> self_test_backend::start() {
     co_await _disk_test.start();
     co_await _network_test.start();
+    co_await _storage_test.start();
 }
 
 ss::future<> self_test_backend::stop() {
     auto f = _gate.close();
     co_await _disk_test.stop();
     co_await _network_test.stop();
+    co_await _storage_test.stop();
     co_await _lock.get_units(); /// Ensure outstanding work is completed
     co_await std::move(f);
 }
 
 ss::future<std::vector<self_test_result>> self_test_backend::do_start_test(
-  std::vector<diskcheck_opts> dtos, std::vector<netcheck_opts> ntos) {
+  std::vector<diskcheck_opts> dtos,
+  std::vector<netcheck_opts> ntos,
+  std::vector<storagecheck_opts> stos) {
     auto gate_holder = _gate.hold();
     std::vector<self_test_result> results;
     for (auto& dto : dtos) {
@@ -108,6 +112,29 @@ ss::future<std::vector<self_test_result>> self_test_backend::do_start_test(
               .name = nto.name, .test_type = "network", .error = ex.what()});
         }
     }
+    for (auto& sto : stos) {
+        try {
+            sto.sg = _st_sg;
+            if (!_cancelling) {
+                auto str = co_await _storage_test.run(sto);
+                std::copy(str.begin(), str.end(), std::back_inserter(results));
+            } else {
+                results.push_back(self_test_result{
+                  .name = sto.name,
+                  .test_type = "storage",
+                  .warning = "Storage self test prevented from starting due "
+                             "to cancel signal"});
+            }
+        } catch (const std::exception& ex) {
+            vlog(
+              clusterlog.error,
+              "Storage self test finished with error: {} - options: {}",
+              ex.what(),
+              sto);
+            results.push_back(self_test_result{
+              .name = sto.name, .test_type = "storage", .error = ex.what()});
+        }
+    }
     co_return results;
 }
 
@@ -120,7 +147,7 @@ get_status_response self_test_backend::start_test(start_test_request req) {
           clusterlog.debug, "Request to start self-tests with id: {}", req.id);
         ssx::background
           = ssx::spawn_with_gate_then(_gate, [this, req = std::move(req)]() {
-                return do_start_test(req.dtos, req.ntos)
+                return do_start_test(req.dtos, req.ntos, req.stos)
                   .then([this, id = req.id](auto results) {
                       for (auto& r : results) {
                           r.test_id = id;
@@ -148,6 +175,7 @@ ss::future<get_status_response> self_test_backend::stop_test() {
     _cancelling = true;
     _disk_test.cancel();
     _network_test.cancel();
+    _storage_test.cancel();
     try {
         /// When lock is released, the 'then' block above will set the _prev_run
         /// var with the finalized test results from the cancelled run.
@@ -14,6 +14,7 @@
 #include "rpc/connection_cache.h"
 #include "self_test/diskcheck.h"
 #include "self_test/netcheck.h"
+#include "self_test/storagecheck.h"
 #include "self_test_rpc_types.h"
 #include "utils/mutex.h"
 #include "utils/uuid.h"
@@ -74,7 +75,9 @@ public:
 
 private:
     ss::future<std::vector<self_test_result>> do_start_test(
-      std::vector<diskcheck_opts> dtos, std::vector<netcheck_opts> ntos);
+      std::vector<diskcheck_opts> dtos,
+      std::vector<netcheck_opts> ntos,
+      std::vector<storagecheck_opts> stos);
 
     struct previous_netcheck_entity {
         static const inline model::node_id unassigned{-1};
@@ -95,5 +98,6 @@ private:
     mutex _lock;
     self_test::diskcheck _disk_test;
     self_test::netcheck _network_test;
+    self_test::storagecheck _storage_test;
 };
 } // namespace cluster
@@ -132,7 +132,7 @@ ss::future<uuid_t> self_test_frontend::start_test(
     if (ids.empty()) {
         throw self_test_exception("No node ids provided");
     }
-    if (req.dtos.empty() && req.ntos.empty()) {
+    if (req.dtos.empty() && req.ntos.empty() && req.stos.empty()) {
         throw self_test_exception("No tests specified to run");
     }
     /// Validate input
@@ -184,7 +184,10 @@ ss::future<uuid_t> self_test_frontend::start_test(
               }
           }
           return handle->start_test(start_test_request{
-            .id = test_id, .dtos = req.dtos, .ntos = new_ntos});
+            .id = test_id,
+            .dtos = req.dtos,
+            .ntos = new_ntos,
+            .stos = req.stos});
       });
     co_return test_id;
 }
@@ -33,7 +33,7 @@ std::ostream& operator<<(std::ostream& o, self_test_status sts);
 
 struct diskcheck_opts
   : serde::
-      envelope<diskcheck_opts, serde::version<0>, serde::compat_version<0>> {
+      envelope<diskcheck_opts, serde::version<1>, serde::compat_version<0>> {
     /// Descriptive name given to test run
     ss::sstring name{"512K sequential r/w disk test"};
     /// Where files this benchmark will read/write to exist
@@ -44,6 +44,13 @@ struct diskcheck_opts
     bool skip_write{false};
     /// Set to true to disable the read portion of the benchmark
     bool skip_read{false};
+    /// Set to true to run writes each followed by an fdatasync, at a
+    /// parallelism of 1 then of 'parallelism'. Added in version 1
+    bool fsync{false};
+    /// Set to true to run reads and writes concurrently, half of the fibers
+    /// each, to observe the interference of writes on reads. Added in version
+    /// 1
+    bool read_while_write{false};
     /// Total size of all benchmark files to exist on disk
     uint64_t data_size{10ULL << 30}; // 1GiB
     /// Size of individual read and/or write requests
@@ -75,6 +82,12 @@ struct diskcheck_opts
         if (obj.HasMember("skip_read")) {
             opts.skip_read = obj["skip_read"].GetBool();
         }
+        if (obj.HasMember("fsync")) {
+            opts.fsync = obj["fsync"].GetBool();
+        }
+        if (obj.HasMember("read_while_write")) {
+            opts.read_while_write = obj["read_while_write"].GetBool();
+        }
         if (obj.HasMember("data_size")) {
             opts.data_size = obj["data_size"].GetUint64();
         }
@@ -100,19 +113,24 @@ struct diskcheck_opts
           data_size,
           request_size,
           duration,
-          parallelism);
+          parallelism,
+          fsync,
+          read_while_write);
     }
 
     friend std::ostream&
     operator<<(std::ostream& o, const diskcheck_opts& opts) {
         fmt::print(
           o,
-          "{{name: {} dsync: {} skip_write: {} skip_read: {} data_size: {} "
-          "request_size: {} duration: {} parallelism: {}}}",
+          "{{name: {} dsync: {} skip_write: {} skip_read: {} fsync: {} "
+          "read_while_write: {} data_size: {} request_size: {} duration: {} "
+          "parallelism: {}}}",
           opts.name,
           opts.dsync,
           opts.skip_write,
           opts.skip_read,
+          opts.fsync,
+          opts.read_while_write,
           opts.data_size,
           opts.request_size,
           opts.duration,
@@ -182,6 +200,84 @@ struct netcheck_opts
     }
 };
 
+struct storagecheck_opts
+  : serde::
+      envelope<storagecheck_opts, serde::version<0>, serde::compat_version<0>> {
+    /// Descriptive name given to test run
+    ss::sstring name{"16K batch storage append/read test"};
+    /// Where the segment this benchmark appends to exists
+    std::filesystem::path dir{config::node().disk_benchmark_path()};
+    /// Number of records in each of the appended batches
+    size_t records_per_batch{16};
+    /// Size of the value of each record
+    size_t record_size{1 << 10}; // 1KiB
+    /// Number of batches appended between two flushes, 1 for acks=all
+    size_t flush_every{1};
+    /// Size at which the segment is truncated and appended to again
+    uint64_t segment_size{128ULL << 20}; // 128MiB
+    /// Set to true to disable the batch cache read portion of the benchmark
+    bool skip_read{false};
+    /// Total duration of each portion of the benchmark
+    ss::lowres_clock::duration duration{std::chrono::milliseconds(5000)};
+    /// Scheduling group that the benchmark will operate under
+    ss::scheduling_group sg;
+
+    static storagecheck_opts from_json(const json::Value& obj) {
+        /// The application using these parameters will perform any validation
+        storagecheck_opts opts;
+        if (obj.HasMember("name")) {
+            opts.name = obj["name"].GetString();
+        }
+        if (obj.HasMember("records_per_batch")) {
+            opts.records_per_batch = obj["records_per_batch"].GetUint64();
+        }
+        if (obj.HasMember("record_size")) {
+            opts.record_size = obj["record_size"].GetUint64();
+        }
+        if (obj.HasMember("flush_every")) {
+            opts.flush_every = obj["flush_every"].GetUint64();
+        }
+        if (obj.HasMember("segment_size")) {
+            opts.segment_size = obj["segment_size"].GetUint64();
+        }
+        if (obj.HasMember("skip_read")) {
+            opts.skip_read = obj["skip_read"].GetBool();
+        }
+        if (obj.HasMember("duration_ms")) {
+            opts.duration = std::chrono::milliseconds(
+              obj["duration_ms"].GetInt());
+        }
+        return opts;
+    }
+
+    auto serde_fields() {
+        return std::tie(
+          name,
+          records_per_batch,
+          record_size,
+          flush_every,
+          segment_size,
+          skip_read,
+          duration);
+    }
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const storagecheck_opts& opts) {
+        fmt::print(
+          o,
+          "{{name: {} records_per_batch: {} record_size: {} flush_every: {} "
+          "segment_size: {} skip_read: {} duration: {}}}",
+          opts.name,
+          opts.records_per_batch,
+          opts.record_size,
+          opts.flush_every,
+          opts.segment_size,
+          opts.skip_read,
+          opts.duration);
+        return o;
+    }
+};
+
 struct self_test_result
   : serde::
       envelope<self_test_result, serde::version<0>, serde::compat_version<0>> {
@@ -237,13 +333,15 @@ struct empty_request
 struct start_test_request
   : serde::envelope<
       start_test_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
 
     uuid_t id;
     std::vector<diskcheck_opts> dtos;
     std::vector<netcheck_opts> ntos;
+    /// Added in version 1
+    std::vector<storagecheck_opts> stos;
 
     friend std::ostream&
     operator<<(std::ostream& o, const start_test_request& r) {
@@ -254,6 +352,9 @@ struct start_test_request
         for (auto& v : r.ntos) {
             fmt::print(ss, "netcheck_opts: {}", v);
         }
+        for (auto& v : r.stos) {
+            fmt::print(ss, "storagecheck_opts: {}", v);
+        }
         fmt::print(o, "{{id: {} {}}}", r.id, ss.str());
         return o;
     }
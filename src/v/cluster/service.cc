@@ -524,6 +524,19 @@ void clear_partition_sizes(node_health_report& report) {
 
 ss::future<get_node_health_reply>
 service::do_collect_node_health_report(get_node_health_request req) {
+    // the controller leader requests unfiltered reports, these are versioned
+    // so that they can be sent incrementally
+    if (
+      req.filter == node_report_filter{}
+      && req.decoded_version == get_node_health_request::current_version) {
+        auto update = co_await _hm_frontend.local().collect_node_health_update(
+          req.acked_version);
+        if (update.has_error()) {
+            co_return get_node_health_reply{
+              .error = map_health_monitor_error_code(update.error())};
+        }
+        co_return std::move(update.value());
+    }
     auto res = co_await _hm_frontend.local().collect_node_health(
       std::move(req.filter));
     if (res.has_error()) {
@@ -855,4 +868,27 @@ service::delete_topics(delete_topics_request&& req, rpc::streaming_context&) {
     co_return delete_topics_reply{.results = std::move(result)};
 }
 
+ss::future<move_partition_replicas_reply> service::move_partition_replicas(
+  move_partition_replicas_request&& req, rpc::streaming_context&) {
+    auto ntp = std::move(req.ntp);
+    auto replicas = std::move(req.replicas);
+    auto timeout = req.timeout;
+    co_await ss::coroutine::switch_to(get_scheduling_group());
+    auto ec = co_await _topics_frontend.local().move_partition_replicas(
+      std::move(ntp),
+      std::move(replicas),
+      reconfiguration_policy::full_local_retention,
+      model::timeout_clock::now() + timeout);
+
+    move_partition_replicas_reply reply{.result = errc::success};
+    if (ec) {
+        if (ec.category() == cluster::error_category()) {
+            reply.result = errc(ec.value());
+        } else {
+            reply.result = errc::not_leader;
+        }
+    }
+    co_return reply;
+}
+
 } // namespace cluster
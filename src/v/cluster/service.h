@@ -136,6 +136,9 @@ public:
     ss::future<delete_topics_reply>
     delete_topics(delete_topics_request&&, rpc::streaming_context&) final;
 
+    ss::future<move_partition_replicas_reply> move_partition_replicas(
+      move_partition_replicas_request&&, rpc::streaming_context&) final;
+
 private:
     static constexpr auto default_move_interruption_timeout = 10s;
     std::
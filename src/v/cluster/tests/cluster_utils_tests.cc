@@ -21,6 +21,8 @@
 #include <seastar/net/socket_defs.hh>
 #include <seastar/testing/thread_test_case.hh>
 
+#include <algorithm>
+
 SEASTAR_THREAD_TEST_CASE(test_has_local_replicas) {
     model::node_id id{2};
 
@@ -172,3 +174,43 @@ SEASTAR_THREAD_TEST_CASE(test_check_result_configuration) {
 
     BOOST_REQUIRE(error);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_assignments_set) {
+    cluster::assignments_set set;
+    auto make = [](int id) {
+        return cluster::partition_assignment(
+          raft::group_id(id),
+          model::partition_id(id),
+          {model::broker_shard{model::node_id(id), 0}});
+    };
+
+    // appends, out of order inserts and duplicates
+    for (int id : {0, 1, 2, 5, 4, 3, 7, 6}) {
+        auto [it, inserted] = set.insert(make(id));
+        BOOST_REQUIRE(inserted);
+        BOOST_REQUIRE_EQUAL(it->id, model::partition_id(id));
+    }
+    auto [dup_it, dup_inserted] = set.emplace(
+      raft::group_id(10), model::partition_id(3), cluster::replicas_t{});
+    BOOST_REQUIRE(!dup_inserted);
+    BOOST_REQUIRE_EQUAL(dup_it->group, raft::group_id(3));
+
+    BOOST_REQUIRE_EQUAL(set.size(), 8);
+    BOOST_REQUIRE(std::is_sorted(
+      set.begin(), set.end(), cluster::partition_assignment_cmp{}));
+    BOOST_REQUIRE(set.contains(model::partition_id(7)));
+    BOOST_REQUIRE(!set.contains(model::partition_id(8)));
+
+    // erase returns the following element
+    auto it = set.erase(set.find(model::partition_id(4)));
+    BOOST_REQUIRE_EQUAL(it->id, model::partition_id(5));
+    it = set.erase(set.find(model::partition_id(7)));
+    BOOST_REQUIRE(it == set.end());
+    BOOST_REQUIRE_EQUAL(set.size(), 6);
+    BOOST_REQUIRE(set.find(model::partition_id(4)) == set.end());
+
+    auto copy = set;
+    BOOST_REQUIRE(copy == set);
+    copy.find(model::partition_id(0))->replicas.clear();
+    BOOST_REQUIRE(!(copy == set));
+}
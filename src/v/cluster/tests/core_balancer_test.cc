@@ -0,0 +1,70 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#define BOOST_TEST_MODULE core_balancer
+
+#include "cluster/scheduling/core_balancer.h"
+#include "model/fundamental.h"
+#include "model/namespace.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <boost/test/unit_test.hpp>
+
+namespace {
+
+model::ntp make_ntp(int partition) {
+    return model::ntp(
+      model::kafka_namespace,
+      model::topic("t"),
+      model::partition_id(partition));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(no_move_below_threshold) {
+    absl::flat_hash_map<model::ntp, uint64_t> produced{
+      {make_ntp(0), 100}, {make_ntp(1), 100}};
+
+    auto move = cluster::core_balancer::plan_move(
+      {0.5, 0.4, 0.45}, produced, 0.2);
+    BOOST_REQUIRE(!move.has_value());
+}
+
+BOOST_AUTO_TEST_CASE(no_move_without_produce_traffic) {
+    absl::flat_hash_map<model::ntp, uint64_t> produced{
+      {make_ntp(0), 0}, {make_ntp(1), 0}};
+
+    auto move = cluster::core_balancer::plan_move({0.9, 0.1}, produced, 0.2);
+    BOOST_REQUIRE(!move.has_value());
+}
+
+BOOST_AUTO_TEST_CASE(move_closes_half_of_the_gap) {
+    // busiest core is 0.8 busy, its partitions account for 0.4, 0.3 and 0.1
+    // of it. The gap to the least busy core is 0.6, moving the partition with
+    // 0.3 leaves both cores at 0.5
+    absl::flat_hash_map<model::ntp, uint64_t> produced{
+      {make_ntp(0), 400}, {make_ntp(1), 300}, {make_ntp(2), 100}};
+
+    auto move = cluster::core_balancer::plan_move(
+      {0.4, 0.2, 0.8}, produced, 0.2);
+    BOOST_REQUIRE(move.has_value());
+    BOOST_REQUIRE_EQUAL(move->ntp, make_ntp(1));
+    BOOST_REQUIRE_EQUAL(move->from, 2);
+    BOOST_REQUIRE_EQUAL(move->to, 1);
+}
+
+BOOST_AUTO_TEST_CASE(no_move_of_partition_larger_than_the_gap) {
+    // the single partition accounts for the whole load, moving it would only
+    // make the other core the busiest one
+    absl::flat_hash_map<model::ntp, uint64_t> produced{{make_ntp(0), 1000}};
+
+    auto move = cluster::core_balancer::plan_move({0.9, 0.1}, produced, 0.2);
+    BOOST_REQUIRE(!move.has_value());
+}
@@ -175,3 +175,43 @@ FIXTURE_TEST(test_stm_snapshots, stm_test_fixture) {
         BOOST_REQUIRE_EQUAL(result.value().value(), test_value{9});
     }
 }
+
+FIXTURE_TEST(test_batched_remove, stm_test_fixture) {
+    create_stm_and_start_raft(1);
+    auto& stm = *_stm;
+    stm.start().get0();
+    wait_for_confirmed_leader();
+
+    absl::btree_map<test_key, test_value> kvs;
+    for (int i = 0; i < 30; i++) {
+        kvs[i] = test_value{i};
+    }
+    stm.put(std::move(kvs)).get();
+
+    // removed in a single batch of one record per existing key, the keys
+    // that don't exist are skipped.
+    auto offset = stm.last_applied_offset();
+    absl::btree_set<test_key> keys;
+    for (int i = 0; i < 40; i += 2) {
+        keys.insert(i);
+    }
+    BOOST_REQUIRE(stm.remove(std::move(keys)).get0() == cluster::errc::success);
+    BOOST_REQUIRE_EQUAL(stm.last_applied_offset(), offset + model::offset{15});
+
+    for (int i = 0; i < 30; i++) {
+        auto result = stm.get(i).get0();
+        BOOST_REQUIRE(result);
+        if (i % 2 == 0) {
+            BOOST_REQUIRE(!result.value());
+        } else {
+            BOOST_REQUIRE_EQUAL(result.value().value(), test_value{i});
+        }
+    }
+
+    // nothing to replicate when none of the keys exist.
+    offset = stm.last_applied_offset();
+    absl::btree_set<test_key> missing{100, 101};
+    BOOST_REQUIRE(
+      stm.remove(std::move(missing)).get0() == cluster::errc::success);
+    BOOST_REQUIRE_EQUAL(stm.last_applied_offset(), offset);
+}
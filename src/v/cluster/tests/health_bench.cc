@@ -100,6 +100,46 @@ struct health_bench : health_report_accessor {
         auto res = aggr_fn(reports);
         perf_tests::stop_measuring_time();
     }
+
+    /**
+     * Computes and merges the delta between two reports of a node that differ
+     * in about one partition out of a hundred.
+     */
+    void bench_delta() {
+        constexpr int topic_count = 100;
+        constexpr int parts_per_topic = 1000;
+
+        ss::chunked_fifo<topic_status> base;
+        for (int topic = 0; topic < topic_count; topic++) {
+            ss::chunked_fifo<partition_status> partitions;
+            for (int pid = 0; pid < parts_per_topic; pid++) {
+                partitions.emplace_back(partition_status{
+                  .id{pid}, .leader_id = model::node_id(0), .size_bytes = 0});
+            }
+            base.emplace_back(
+              model::topic_namespace{
+                model::kafka_namespace,
+                model::topic(fmt::format("topic_{}", topic))},
+              std::move(partitions));
+        }
+
+        ss::chunked_fifo<topic_status> current;
+        std::copy(base.cbegin(), base.cend(), std::back_inserter(current));
+        for (auto& t : current) {
+            for (auto& p : t.partitions) {
+                if (random_generators::get_int(99) == 0) {
+                    p.size_bytes++;
+                }
+            }
+        }
+
+        perf_tests::start_measuring_time();
+        auto delta = diff_topic_status(base, current);
+        apply_topic_status_delta(base, std::move(delta));
+        perf_tests::stop_measuring_time();
+
+        vassert(base.size() == current.size(), "Unexpected report size");
+    }
 };
 
 PERF_TEST_F(health_bench, original) {
@@ -112,4 +152,6 @@ PERF_TEST_F(health_bench, original_unlimited) {
 
 PERF_TEST_F(health_bench, current) { bench(aggregate); }
 
+PERF_TEST_F(health_bench, report_delta) { bench_delta(); }
+
 } // namespace cluster
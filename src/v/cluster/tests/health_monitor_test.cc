@@ -587,3 +587,40 @@ FIXTURE_TEST(test_report_truncation, health_report_unit) {
     test_unhealthy(max_count + 1, LEADERLESS);
     test_unhealthy(max_count + 1, URP);
 }
+
+FIXTURE_TEST(test_report_delta, health_report_unit) {
+    auto base = make_nhr(
+      0,
+      {make_ts("topic_a", {HEALTHY, HEALTHY, HEALTHY}),
+       make_ts("topic_b", {HEALTHY, HEALTHY}),
+       make_ts("topic_c", {HEALTHY})});
+
+    {
+        // identical reports, empty delta
+        auto delta = cluster::diff_topic_status(base.topics, base.topics);
+        BOOST_REQUIRE(delta.updated.empty());
+        BOOST_REQUIRE(delta.removed.empty());
+    }
+
+    // topic_a: partition 1 lost its leader, partition 2 was removed
+    // topic_b: partition 2 was added
+    // topic_c: removed
+    // topic_d: added
+    auto current = make_nhr(
+      0,
+      {make_ts("topic_a", {HEALTHY, LEADERLESS}),
+       make_ts("topic_b", {HEALTHY, HEALTHY, URP}),
+       make_ts("topic_d", {HEALTHY, HEALTHY})});
+
+    auto delta = cluster::diff_topic_status(base.topics, current.topics);
+    BOOST_REQUIRE_EQUAL(delta.updated.size(), 3);
+    size_t updated_partitions = 0;
+    for (const auto& t : delta.updated) {
+        updated_partitions += t.partitions.size();
+    }
+    BOOST_REQUIRE_EQUAL(updated_partitions, 4);
+    BOOST_REQUIRE_EQUAL(delta.removed.size(), 2);
+
+    cluster::apply_topic_status_delta(base.topics, std::move(delta));
+    BOOST_REQUIRE_EQUAL(base, current);
+}
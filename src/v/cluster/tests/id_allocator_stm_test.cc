@@ -39,9 +39,9 @@ using namespace std::chrono_literals;
 ss::logger idstmlog{"idstm-test"};
 
 struct id_allocator_stm_fixture : simple_raft_fixture {
-    void create_stm_and_start_raft() {
+    void create_stm_and_start_raft(int16_t batch_size = 1) {
         // set configuration parameters
-        test_local_cfg.get("id_allocator_batch_size").set_value(int16_t(1));
+        test_local_cfg.get("id_allocator_batch_size").set_value(batch_size);
         test_local_cfg.get("id_allocator_log_capacity").set_value(int16_t(2));
         create_raft();
         raft::state_machine_manager_builder stm_m_builder;
@@ -131,3 +131,33 @@ FIXTURE_TEST(stm_reset_batch_test, id_allocator_stm_fixture) {
     last_id = allocate_n(last_id, 1);
     BOOST_REQUIRE_EQUAL(last_id, 102);
 }
+
+FIXTURE_TEST(stm_allocate_range_test, id_allocator_stm_fixture) {
+    create_stm_and_start_raft(10);
+    wait_for_confirmed_leader();
+
+    auto first = _stm->allocate_id_range(4, 1s).get0();
+    BOOST_REQUIRE_EQUAL(raft::errc::success, first.raft_status);
+    BOOST_REQUIRE_EQUAL(first.count, 4);
+
+    auto second = _stm->allocate_id_range(4, 1s).get0();
+    BOOST_REQUIRE_EQUAL(raft::errc::success, second.raft_status);
+    BOOST_REQUIRE_EQUAL(second.id, first.id + 4);
+    BOOST_REQUIRE_EQUAL(second.count, 4);
+
+    // only 2 ids are left in the batch, a range doesn't span batches
+    auto third = _stm->allocate_id_range(4, 1s).get0();
+    BOOST_REQUIRE_EQUAL(raft::errc::success, third.raft_status);
+    BOOST_REQUIRE_EQUAL(third.id, first.id + 8);
+    BOOST_REQUIRE_EQUAL(third.count, 2);
+
+    auto fourth = _stm->allocate_id_range(4, 1s).get0();
+    BOOST_REQUIRE_EQUAL(raft::errc::success, fourth.raft_status);
+    BOOST_REQUIRE_EQUAL(fourth.id, first.id + 10);
+    BOOST_REQUIRE_EQUAL(fourth.count, 4);
+
+    auto single = _stm->allocate_id(1s).get0();
+    BOOST_REQUIRE_EQUAL(raft::errc::success, single.raft_status);
+    BOOST_REQUIRE_EQUAL(single.id, first.id + 14);
+    BOOST_REQUIRE_EQUAL(single.count, 1);
+}
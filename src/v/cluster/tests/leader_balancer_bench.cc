@@ -171,6 +171,47 @@ void balancer_bench(bool measure_all) {
     perf_tests::stop_measuring_time();
 }
 
+/*
+ * Measures the time the random hill climbing strategy takes to spread load
+ * when all groups led by the shards of one node carry 10x the weight of the
+ * others.
+ */
+void weighted_random_hill_climbing_bench() {
+    constexpr size_t max_movements = 1000;
+
+    auto index = leader_balancer_test_utils::make_cluster_index(
+      node_count, shards_per_node, groups_per_shard, replicas);
+    auto gid_topic = make_gid_to_topic_index(index);
+
+    cluster::leader_balancer_types::group_weights_t weights;
+    for (const auto& [bs, leaders] : index) {
+        for (const auto& [group, _] : leaders) {
+            weights[group] = bs.node_id == model::node_id(0) ? 10.0 : 1.0;
+        }
+    }
+
+    perf_tests::start_measuring_time();
+    cluster::leader_balancer_types::random_hill_climbing_strategy rhc(
+      std::move(index),
+      std::move(gid_topic),
+      cluster::leader_balancer_types::muted_index{{}, {}},
+      std::move(weights));
+
+    absl::flat_hash_set<raft::group_id> moved;
+    for (size_t i = 0; i < max_movements; ++i) {
+        auto movement = rhc.find_movement(moved);
+        if (!movement) {
+            break;
+        }
+        rhc.apply_movement(*movement);
+        moved.insert(movement->group);
+    }
+    perf_tests::stop_measuring_time();
+
+    vassert(!moved.empty(), "expected leadership movements");
+    perf_tests::do_not_optimize(rhc);
+}
+
 } // namespace
 
 PERF_TEST(lb, even_shard_load_movement) { balancer_bench(false); }
@@ -191,3 +232,7 @@ PERF_TEST(lb, random_eval_all) {
 PERF_TEST(lb, random_generator) {
     random_bench<cluster::leader_balancer_types::random_reassignments>();
 }
+
+PERF_TEST(lb, weighted_random_hill_climbing) {
+    weighted_random_hill_climbing_bench();
+}
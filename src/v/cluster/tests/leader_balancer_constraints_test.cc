@@ -537,3 +537,83 @@ BOOST_AUTO_TEST_CASE(topic_skew_error) {
     BOOST_REQUIRE(post_topic_error <= pre_topic_error);
     BOOST_REQUIRE(post_shard_error <= pre_shard_error);
 }
+
+BOOST_AUTO_TEST_CASE(weighted_shard_load_hot_group) {
+    // Node 0 leads a single hot group, node 1 leads three cold ones. Counts
+    // are unbalanced but moving anything would make the weighted load worse.
+    auto [shard_index, muted_index] = from_spec(
+      {
+        {{1}, {2, 3, 4}},
+        {{2, 3, 4}, {1}},
+      },
+      {});
+    lbt::group_weights_t weights{
+      {raft::group_id(1), 10.0},
+      {raft::group_id(2), 1.0},
+      {raft::group_id(3), 1.0},
+      {raft::group_id(4), 1.0},
+    };
+
+    auto even_shard_con = lbt::even_shard_load_constraint(
+      shard_index, muted_index);
+    auto weighted_con = lbt::weighted_shard_load_constraint(
+      shard_index, weights, muted_index, 0.1);
+
+    BOOST_REQUIRE(even_shard_con.recommended_reassignment().has_value());
+    BOOST_REQUIRE(!weighted_con.recommended_reassignment());
+}
+
+BOOST_AUTO_TEST_CASE(weighted_shard_load_movement) {
+    // Node 0 leads two hot groups, one of them should move to node 1.
+    auto [shard_index, muted_index] = from_spec(
+      {
+        {{1, 2}, {3}},
+        {{3}, {1, 2}},
+      },
+      {});
+    lbt::group_weights_t weights{
+      {raft::group_id(1), 5.0},
+      {raft::group_id(2), 5.0},
+      {raft::group_id(3), 1.0},
+    };
+
+    auto weighted_con = lbt::weighted_shard_load_constraint(
+      shard_index, weights, muted_index, 0.1);
+    BOOST_REQUIRE_GT(weighted_con.error(), 0);
+
+    auto movement = weighted_con.recommended_reassignment();
+    BOOST_REQUIRE(movement.has_value());
+    BOOST_REQUIRE_EQUAL(movement->from.node_id, model::node_id(0));
+    BOOST_REQUIRE_EQUAL(movement->to.node_id, model::node_id(1));
+
+    const auto error = weighted_con.error();
+    weighted_con.update_index(*movement);
+    BOOST_REQUIRE_LT(weighted_con.error(), error);
+
+    // node 0 now leads 5/11 of the load, moving more would not help
+    BOOST_REQUIRE(!weighted_con.recommended_reassignment());
+}
+
+BOOST_AUTO_TEST_CASE(weighted_shard_load_hysteresis) {
+    // Moving one of the groups from node 0 would slightly improve balance,
+    // but not by more than the hysteresis.
+    auto [shard_index, muted_index] = from_spec(
+      {
+        {{1, 2}, {3}},
+        {{3}, {1, 2}},
+      },
+      {});
+    lbt::group_weights_t weights{
+      {raft::group_id(1), 1.0},
+      {raft::group_id(2), 1.0},
+      {raft::group_id(3), 0.9},
+    };
+
+    auto no_hysteresis = lbt::weighted_shard_load_constraint(
+      shard_index, weights, muted_index, 0);
+    BOOST_REQUIRE(no_hysteresis.recommended_reassignment().has_value());
+
+    auto with_hysteresis = lbt::weighted_shard_load_constraint(
+      shard_index, weights, muted_index, 0.5);
+    BOOST_REQUIRE(!with_hysteresis.recommended_reassignment());
+}
@@ -158,6 +158,33 @@ FIXTURE_TEST(unsatisfyable_diversity_assignment, partition_allocator_fixture) {
     BOOST_REQUIRE_EQUAL(allocator.state().last_group_id()(), 0);
 }
 
+FIXTURE_TEST(bulk_allocation, partition_allocator_fixture) {
+    register_node(0, 8);
+    register_node(1, 4);
+    register_node(2, 6);
+
+    std::vector<cluster::allocation_request> requests;
+    requests.push_back(make_allocation_request(
+      model::topic_namespace{model::kafka_namespace, model::topic{"a"}}, 3, 3));
+    // can not be satisfied with 3 nodes, must not affect the other requests
+    requests.push_back(make_allocation_request(
+      model::topic_namespace{model::kafka_namespace, model::topic{"b"}}, 1, 5));
+    requests.push_back(make_allocation_request(
+      model::topic_namespace{model::kafka_namespace, model::topic{"c"}}, 2, 1));
+
+    auto results = allocator.allocate(std::move(requests)).get();
+    BOOST_REQUIRE_EQUAL(results.size(), 3);
+    BOOST_REQUIRE(results[0].has_value());
+    BOOST_REQUIRE_EQUAL(results[0].value()->get_assignments().size(), 3);
+    BOOST_REQUIRE(results[1].has_error());
+    BOOST_REQUIRE_EQUAL(
+      cluster::errc(results[1].error().value()),
+      cluster::errc::topic_invalid_replication_factor);
+    BOOST_REQUIRE(results[2].has_value());
+    BOOST_REQUIRE_EQUAL(results[2].value()->get_assignments().size(), 2);
+    BOOST_REQUIRE_EQUAL(allocator.state().last_group_id()(), 5);
+}
+
 FIXTURE_TEST(diverse_replica_sets, partition_allocator_fixture) {
     // This tests that all possible replica sets are chosen, rather than some
     // fixed subset (e.g., if the allocator uses a repeating sequential pattern
@@ -81,3 +81,39 @@ PERF_TEST_C(partition_balancer_planner_fixture, counts_rebalancing) {
       "unexpected reassignments size: {}",
       reassignments.size());
 }
+
+PERF_TEST_C(partition_balancer_planner_fixture, unavailable_node_500k) {
+    static bool initialized = false;
+    if (!initialized) {
+        ss::thread_attributes thread_attr;
+        co_await ss::async(thread_attr, [this] {
+            // 500k partitions with 3 replicas need 54 nodes at 28k replicas
+            // per node
+            allocator_register_nodes(60);
+            create_topic("topic-1", 500000, 3);
+        });
+
+        initialized = true;
+    }
+
+    uint64_t local_partition_size = 10_KiB;
+    auto hr = create_health_report({}, {}, local_partition_size);
+
+    std::set<size_t> unavailable_nodes = {0};
+    co_await populate_node_status_table(unavailable_nodes);
+
+    const size_t max_concurrent_actions = 50;
+    auto planner = make_planner(
+      model::partition_autobalancing_mode::continuous, max_concurrent_actions);
+
+    abort_source as;
+    perf_tests::start_measuring_time();
+    auto plan_data = co_await planner.plan_actions(hr, as);
+    perf_tests::stop_measuring_time();
+
+    const auto& reassignments = plan_data.reassignments;
+    vassert(
+      reassignments.size() == max_concurrent_actions,
+      "unexpected reassignments size: {}",
+      reassignments.size());
+}
@@ -115,6 +115,51 @@ FIXTURE_TEST(test_node_down, partition_balancer_planner_fixture) {
     check_expected_assignments(new_replicas, expected_nodes);
 }
 
+/*
+ * 5 nodes; 1 topic; 1 node down; nodes 3 and 4 differ only in produce load
+ * Actual
+ *   node_0: partitions: 1; down: True; produce rate: 0;
+ *   node_1: partitions: 1; down: False; produce rate: 0;
+ *   node_2: partitions: 1; down: False; produce rate: 0;
+ *   node_3: partitions: 0; down: False; produce rate: 100 MiB/s;
+ *   node_4: partitions: 0; down: False; produce rate: 0;
+ * Expected
+ *   node_0: partitions: 0;
+ *   node_1: partitions: 1;
+ *   node_2: partitions: 1;
+ *   node_3: partitions: 0;
+ *   node_4: partitions: 1;
+ */
+FIXTURE_TEST(
+  test_node_down_least_produce_load, partition_balancer_planner_fixture) {
+    vlog(logger.debug, "test_node_down_least_produce_load");
+    allocator_register_nodes(3);
+    create_topic("topic-1", 1, 3);
+    allocator_register_nodes(2);
+
+    auto hr = create_health_report();
+    for (auto& node_report : hr.node_reports) {
+        node_report.local_state.produce_bytes_rate
+          = node_report.id == model::node_id(3) ? 100_MiB : 0;
+    }
+
+    std::set<size_t> unavailable_nodes = {0};
+    populate_node_status_table(unavailable_nodes).get();
+
+    auto planner = make_planner();
+    auto plan_data = planner.plan_actions(hr, as).get();
+
+    check_violations(plan_data, unavailable_nodes, {});
+
+    BOOST_REQUIRE_EQUAL(plan_data.reassignments.size(), 1);
+
+    std::unordered_set<model::node_id> expected_nodes(
+      {model::node_id(1), model::node_id(2), model::node_id(4)});
+
+    auto new_replicas = plan_data.reassignments.front().allocated.replicas();
+    check_expected_assignments(new_replicas, expected_nodes);
+}
+
 /*
  * 4 nodes; 1 topic; 2 nodes down
  * Actual
@@ -197,3 +197,43 @@ FIXTURE_TEST(test_eviction_expired_pids, test_fixture) {
       10s, [&] { return evicted_so_far == total_producers; });
     clean(producers);
 }
+
+FIXTURE_TEST(test_finished_requests_window, test_fixture) {
+    auto producer = new_producer();
+    const model::term_id term{1};
+    const auto make_bid = [](int i) {
+        return model::batch_identity{.first_seq = 2 * i, .last_seq = 2 * i + 1};
+    };
+    const int num_requests = 7;
+    for (int i = 0; i < num_requests; i++) {
+        auto request = producer->try_emplace_request(make_bid(i), term);
+        BOOST_REQUIRE(!request.has_error());
+        BOOST_REQUIRE(
+          request.value()->state() == cluster::request_state::initialized);
+        producer->update(make_bid(i), kafka::offset(i));
+    }
+    BOOST_REQUIRE_EQUAL(
+      producer->last_sequence_number(), 2 * num_requests - 1);
+
+    // retries of the last finished requests get their original results
+    for (int i = num_requests - 5; i < num_requests; i++) {
+        auto request = producer->try_emplace_request(make_bid(i), term);
+        BOOST_REQUIRE(!request.has_error());
+        BOOST_REQUIRE(
+          request.value()->state() == cluster::request_state::completed);
+        auto result = request.value()->result().get0();
+        BOOST_REQUIRE(!result.has_error());
+        BOOST_REQUIRE_EQUAL(result.value().last_offset, kafka::offset(i));
+    }
+    // older requests are no longer tracked
+    auto request = producer->try_emplace_request(make_bid(0), term);
+    BOOST_REQUIRE(request.has_error());
+    BOOST_REQUIRE(request.error() == cluster::errc::sequence_out_of_order);
+
+    BOOST_REQUIRE_EQUAL(
+      producer->snapshot(kafka::offset(0))._finished_requests.size(), 5);
+    BOOST_REQUIRE_EQUAL(
+      producer->snapshot(kafka::offset(4))._finished_requests.size(), 3);
+
+    producer->shutdown_input().get();
+}
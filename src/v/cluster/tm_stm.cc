@@ -13,11 +13,13 @@
 #include "model/record.h"
 #include "raft/errc.h"
 #include "raft/types.h"
+#include "ssx/future-util.h"
 #include "storage/record_batch_builder.h"
 #include "units.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
+#include <seastar/coroutine/as_future.hh>
 #include <seastar/util/bool_class.hh>
 
 #include <cstdint>
@@ -215,6 +217,57 @@ tm_stm::quorum_write_empty_batch(model::timeout_clock::time_point timeout) {
       });
 }
 
+ss::future<result<raft::replicate_result>>
+tm_stm::replicate_tx_update(model::term_id term, model::record_batch batch) {
+    _pending_tx_updates.push_back(
+      pending_tx_update{.term = term, .batch = std::move(batch)});
+    auto f = _pending_tx_updates.back().promise.get_future();
+    if (!_flushing_tx_updates) {
+        _flushing_tx_updates = true;
+        // the callers hold the gate until their updates are replicated
+        ssx::background = flush_tx_updates();
+    }
+    return f;
+}
+
+ss::future<> tm_stm::flush_tx_updates() {
+    while (!_pending_tx_updates.empty()) {
+        // updates of different terms are not replicated together
+        const auto term = _pending_tx_updates.front().term;
+        model::record_batch_reader::data_t batches;
+        std::vector<ss::promise<result<raft::replicate_result>>> promises;
+        while (!_pending_tx_updates.empty()
+               && _pending_tx_updates.front().term == term
+               && batches.size() < max_tx_updates_per_write) {
+            auto& update = _pending_tx_updates.front();
+            batches.push_back(std::move(update.batch));
+            promises.push_back(std::move(update.promise));
+            _pending_tx_updates.pop_front();
+        }
+        vlog(
+          _ctx_log.trace,
+          "replicating {} transaction updates in term: {}",
+          batches.size(),
+          term);
+        auto r = co_await ss::coroutine::as_future(_raft->replicate(
+          term,
+          model::make_memory_record_batch_reader(std::move(batches)),
+          raft::replicate_options{raft::consistency_level::quorum_ack}));
+        if (r.failed()) {
+            auto e = r.get_exception();
+            for (auto& p : promises) {
+                p.set_exception(e);
+            }
+        } else {
+            const auto result = r.get();
+            for (auto& p : promises) {
+                p.set_value(result);
+            }
+        }
+    }
+    _flushing_tx_updates = false;
+}
+
 ss::future<> tm_stm::checkpoint_ongoing_txs() {
     if (!use_new_tx_version()) {
         co_return;
@@ -302,7 +355,7 @@ tm_stm::do_update_tx(tm_transaction tx, model::term_id term) {
       term);
     auto batch = serialize_tx(tx);
 
-    auto r = co_await replicate_quorum_ack(term, std::move(batch));
+    auto r = co_await replicate_tx_update(term, std::move(batch));
     if (!r) {
         vlog(
           _ctx_log.info,
@@ -594,7 +647,7 @@ ss::future<tm_stm::op_status> tm_stm::do_register_new_producer(
 
     _pid_tx_id[pid] = tx_id;
 
-    auto r = co_await replicate_quorum_ack(expected_term, std::move(batch));
+    auto r = co_await replicate_tx_update(expected_term, std::move(batch));
 
     if (!r) {
         if (_raft->is_leader() && _raft->term() == expected_term) {
@@ -32,6 +32,8 @@
 #include "utils/fragmented_vector.h"
 #include "utils/mutex.h"
 
+#include <seastar/core/chunked_fifo.hh>
+
 #include <absl/container/btree_set.h>
 #include <absl/container/flat_hash_map.h>
 
@@ -406,6 +408,23 @@ private:
           raft::replicate_options{raft::consistency_level::quorum_ack});
     }
 
+    /// Group commit of the transaction updates: while a write is in flight
+    /// the updates of other transactions are queued, and then replicated
+    /// together in a single request. The result covers all the batches of the
+    /// request, so the last offset is the offset of the last update in it.
+    ss::future<result<raft::replicate_result>>
+    replicate_tx_update(model::term_id term, model::record_batch batch);
+    ss::future<> flush_tx_updates();
+
+    struct pending_tx_update {
+        model::term_id term;
+        model::record_batch batch;
+        ss::promise<result<raft::replicate_result>> promise;
+    };
+    static constexpr size_t max_tx_updates_per_write = 128;
+    ss::chunked_fifo<pending_tx_update> _pending_tx_updates;
+    bool _flushing_tx_updates{false};
+
     bool is_transaction_ga() {
         return _feature_table.local().is_active(
           features::feature::transaction_ga);
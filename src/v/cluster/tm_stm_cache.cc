@@ -55,6 +55,7 @@ tm_stm_cache::find(model::term_id term, kafka::transactional_id tx_id) {
           term);
         // tm_stm_cache_entry isn't found it means a node memory was wiped
         // and we can't guess it's last state
+        ++_misses;
         return std::nullopt;
     }
 
@@ -66,6 +67,7 @@ tm_stm_cache::find(model::term_id term, kafka::transactional_id tx_id) {
     auto& entry = entry_it->second;
     auto tx_it = entry.txes.find(tx_id);
     if (tx_it != entry.txes.end()) {
+        ++_hits;
         return tx_it->second;
     }
 
@@ -76,6 +78,7 @@ tm_stm_cache::find(model::term_id term, kafka::transactional_id tx_id) {
           "[tx_id={}] looking for tx with etag: {}, can't find tx_id in log",
           tx_id,
           term);
+        ++_misses;
         return std::nullopt;
     }
 
@@ -89,6 +92,7 @@ tm_stm_cache::find(model::term_id term, kafka::transactional_id tx_id) {
           log_it->second.tx.etag,
           log_it->second.tx.pid,
           log_it->second.tx.tx_seq);
+        ++_misses;
         return std::nullopt;
     }
     vlog(
@@ -97,6 +101,7 @@ tm_stm_cache::find(model::term_id term, kafka::transactional_id tx_id) {
       tx_id,
       term,
       log_it->second.tx);
+    ++_hits;
     return log_it->second.tx;
 }
 
@@ -166,6 +171,12 @@ void tm_stm_cache::erase_log(kafka::transactional_id tx_id) {
       tx.etag,
       tx.pid,
       tx.tx_seq);
+    // the tx is gone, so is its state in the previous terms
+    for (auto& [term, entry] : _state) {
+        if (term < tx.etag) {
+            entry.txes.erase(tx_id);
+        }
+    }
     _log_txes.erase(tx_it);
 }
 
@@ -185,10 +196,13 @@ void tm_stm_cache::set_mem(
       tx_id,
       term,
       tx);
-    auto [entry_it, _] = _state.try_emplace(
+    auto [entry_it, inserted] = _state.try_emplace(
       term, tm_stm_cache_entry{.term = term});
 
     entry_it->second.txes[tx_id] = tx;
+    if (inserted) {
+        prune_terms();
+    }
 
     if (!_mem_term) {
         if (!_sealed_term || _sealed_term.value() < term) {
@@ -199,6 +213,30 @@ void tm_stm_cache::set_mem(
     }
 }
 
+void tm_stm_cache::prune_terms() {
+    while (_state.size() > max_retained_terms) {
+        // the state of the current and the sealed terms is always kept
+        auto oldest = _state.end();
+        for (auto it = _state.begin(); it != _state.end(); ++it) {
+            if (it->first == _mem_term || it->first == _sealed_term) {
+                continue;
+            }
+            if (oldest == _state.end() || it->first < oldest->first) {
+                oldest = it;
+            }
+        }
+        if (oldest == _state.end()) {
+            return;
+        }
+        vlog(
+          txlog.debug,
+          "dropping in memory state of {} txes of term {}",
+          oldest->second.txes.size(),
+          oldest->first);
+        _state.erase(oldest);
+    }
+}
+
 void tm_stm_cache::clear_mem() {
     if (_mem_term) {
         _sealed_term = _mem_term.value();
@@ -293,4 +331,12 @@ std::optional<tm_transaction> tm_stm_cache::oldest_tx() const {
 
 size_t tm_stm_cache::tx_cache_size() const { return lru_txes.size(); }
 
+size_t tm_stm_cache::mem_tx_count() const {
+    size_t count = 0;
+    for (const auto& [_, entry] : _state) {
+        count += entry.txes.size();
+    }
+    return count;
+}
+
 } // namespace cluster
@@ -243,7 +243,21 @@ public:
 
     size_t tx_cache_size() const;
 
+    // number of txes with in memory changes across all the retained terms
+    size_t mem_tx_count() const;
+    size_t term_count() const { return _state.size(); }
+    // lookups of the state of a term with find(), e.g. by a new leader
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+
+    // The in memory state is kept only for the latest terms this node led.
+    // A new leader fetches the state of the previous term, the state of the
+    // older terms is dropped as if the node restarted.
+    static constexpr size_t max_retained_terms = 3;
+
 private:
+    void prune_terms();
+
     struct tx_wrapper {
         tx_wrapper() = default;
 
@@ -274,6 +288,8 @@ private:
     // clearing the state we set _sealed_term to make sure we won't acci-
     // dentally update records in the past after the re-election
     std::optional<model::term_id> _sealed_term;
+    uint64_t _hits{0};
+    uint64_t _misses{0};
 };
 
 // Updates in v1.
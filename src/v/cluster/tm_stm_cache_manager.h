@@ -12,9 +12,13 @@
 #pragma once
 
 #include "cluster/tm_stm_cache.h"
+#include "config/configuration.h"
 #include "kafka/server/coordinator_ntp_mapper.h"
+#include "metrics/metrics.h"
 #include "model/fundamental.h"
+#include "prometheus/prometheus_sanitize.h"
 
+#include <seastar/core/metrics.hh>
 #include <seastar/core/shared_ptr.hh>
 
 #include <absl/container/flat_hash_map.h>
@@ -28,7 +32,7 @@ namespace cluster {
  */
 class tm_stm_cache_manager {
 public:
-    tm_stm_cache_manager() = default;
+    tm_stm_cache_manager() { setup_metrics(); }
 
     ss::lw_shared_ptr<cluster::tm_stm_cache>
     get(model::partition_id partition) {
@@ -41,10 +45,67 @@ public:
     }
 
 private:
+    template<typename Func>
+    uint64_t sum(Func&& f) const {
+        uint64_t total = 0;
+        for (const auto& [_, cache] : tm_stm_caches) {
+            total += f(*cache);
+        }
+        return total;
+    }
+
+    void setup_metrics() {
+        if (config::shard_local_cfg().disable_metrics()) {
+            return;
+        }
+        namespace sm = ss::metrics;
+        _metrics.add_group(
+          prometheus_sanitize::metrics_name("tx:coordinator_cache"),
+          {sm::make_gauge(
+             "transactions",
+             [this] {
+                 return sum([](const tm_stm_cache& c) {
+                     return c.tx_cache_size();
+                 });
+             },
+             sm::description("Number of transactions in the log state")),
+           sm::make_gauge(
+             "in_memory_transactions",
+             [this] {
+                 return sum(
+                   [](const tm_stm_cache& c) { return c.mem_tx_count(); });
+             },
+             sm::description(
+               "Number of transactions with in memory changes, across the "
+               "retained terms")),
+           sm::make_gauge(
+             "terms",
+             [this] {
+                 return sum(
+                   [](const tm_stm_cache& c) { return c.term_count(); });
+             },
+             sm::description("Number of terms with retained in memory state")),
+           sm::make_counter(
+             "hits",
+             [this] {
+                 return sum([](const tm_stm_cache& c) { return c.hits(); });
+             },
+             sm::description(
+               "Number of transactions of a term found by fetches")),
+           sm::make_counter(
+             "misses",
+             [this] {
+                 return sum([](const tm_stm_cache& c) { return c.misses(); });
+             },
+             sm::description(
+               "Number of transactions of a term not found by fetches"))});
+    }
+
     using cache_t = absl::flat_hash_map<
       model::partition_id,
       ss::lw_shared_ptr<cluster::tm_stm_cache>>;
     cache_t tm_stm_caches;
+    metrics::internal_metric_groups _metrics;
 };
 
 } // namespace cluster
@@ -22,6 +22,7 @@
 #include "storage/ntp_config.h"
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 
 #include <algorithm>
@@ -1062,7 +1063,6 @@ public:
         if (auto as_it = md_item.get_assignments().find(p_id);
             as_it != md_item.get_assignments().end()) {
             prev_assignment = std::move(*as_it);
-            md_item.get_assignments().erase(as_it);
 
             auto p_it = md_item.partitions.find(p_id);
             vassert(
@@ -1088,10 +1088,14 @@ public:
         // update into account, but replicas in _topics do. So if there is
         // info in the snapshot about an in-progress update, we'll have to
         // update replicas later in this function.
-        partition_assignment& cur_assignment
-          = *md_item.get_assignments()
-               .emplace(partition.group, p_id, partition.replicas)
-               .first;
+        auto [as_it, inserted] = md_item.get_assignments().emplace(
+          partition.group, p_id, partition.replicas);
+        if (!inserted) {
+            // replace the previous assignment in place, it was moved out above
+            *as_it = partition_assignment(
+              partition.group, p_id, partition.replicas);
+        }
+        partition_assignment& cur_assignment = *as_it;
 
         md_item.partitions[p_id] = partition_meta{
           .replicas_revisions = partition.replicas_revisions,
@@ -1201,6 +1205,7 @@ ss::future<> topic_table::apply_snapshot(
     if (snap_revision <= _last_applied_revision_id) {
         co_return;
     }
+    const auto start = ss::lowres_clock::now();
 
     // 1. reconcile the _topics and _updates_in_progress state and generate
     // corresponding deltas.
@@ -1276,10 +1281,11 @@ ss::future<> topic_table::apply_snapshot(
                 // for completeness), generate del delta.
                 for (auto as_it = md_item.get_assignments().begin();
                      as_it != md_item.get_assignments().end();) {
-                    auto as_it_copy = as_it++;
-                    if (!topic_snapshot.partitions.contains(as_it_copy->id)) {
-                        applier.delete_ntp(ns_tp, *as_it_copy);
-                        md_item.get_assignments().erase(as_it_copy);
+                    if (!topic_snapshot.partitions.contains(as_it->id)) {
+                        applier.delete_ntp(ns_tp, *as_it);
+                        as_it = md_item.get_assignments().erase(as_it);
+                    } else {
+                        ++as_it;
                     }
                     co_await ss::coroutine::maybe_yield();
                 }
@@ -1323,6 +1329,9 @@ ss::future<> topic_table::apply_snapshot(
     notify_waiters();
 
     _last_applied_revision_id = snap_revision;
+    _probe.handle_snapshot_applied(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+        ss::lowres_clock::now() - start));
 }
 
 void topic_table::add_partition_to_force_reconfigure(
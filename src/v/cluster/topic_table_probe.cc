@@ -57,6 +57,16 @@ void topic_table_probe::setup_internal_metrics() {
           [this] { return _cancelling_movements; },
           sm::description("Amount of cancelling partition movements for node"))
           .aggregate({sm::shard_label}),
+        sm::make_counter(
+          "controller_snapshots_applied",
+          [this] { return _snapshots_applied; },
+          sm::description(
+            "Number of controller snapshots applied to the topic table")),
+        sm::make_gauge(
+          "last_controller_snapshot_apply_ms",
+          [this] { return _last_snapshot_apply_duration.count(); },
+          sm::description("Time it took to apply the last controller snapshot "
+                          "to the topic table")),
       });
 }
 
@@ -15,6 +15,8 @@
 
 #include <absl/container/flat_hash_set.h>
 
+#include <chrono>
+
 namespace cluster {
 
 class topic_table_probe {
@@ -42,6 +44,11 @@ public:
       const std::vector<model::broker_shard>& previous_replicas,
       const std::vector<model::broker_shard>& result_replicas);
 
+    void handle_snapshot_applied(std::chrono::milliseconds duration) {
+        ++_snapshots_applied;
+        _last_snapshot_apply_duration = duration;
+    }
+
 private:
     void setup_metrics();
     void setup_public_metrics();
@@ -56,6 +63,8 @@ private:
     int32_t _moving_to_partitions = 0;
     int32_t _moving_from_partitions = 0;
     int32_t _cancelling_movements = 0;
+    uint64_t _snapshots_applied = 0;
+    std::chrono::milliseconds _last_snapshot_apply_duration{0};
 };
 
 } // namespace cluster
@@ -21,6 +21,7 @@
 #include "raft/types.h"
 #include "ssx/future-util.h"
 
+#include <seastar/core/when_all.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 
 #include <absl/container/node_hash_map.h>
@@ -610,14 +611,16 @@ ss::future<> topic_updates_dispatcher::apply_snapshot(
         return topics.apply_snapshot(offset, snap);
     });
 
-    co_await _partition_leaders_table.invoke_on_all(
-      [](partition_leaders_table& leaders) {
-          return leaders.update_with_estimates();
-      });
-
-    co_await _partition_allocator.local().apply_snapshot(snap);
-
-    co_await _partition_balancer_state.local().apply_snapshot(snap);
+    // The remaining state only depends on the topic table (leader estimates)
+    // or on the snapshot itself (allocator and balancer state), so it can be
+    // rebuilt concurrently.
+    co_await ss::when_all_succeed(
+      _partition_leaders_table.invoke_on_all(
+        [](partition_leaders_table& leaders) {
+            return leaders.update_with_estimates();
+        }),
+      _partition_allocator.local().apply_snapshot(snap),
+      _partition_balancer_state.local().apply_snapshot(snap));
 }
 
 } // namespace cluster
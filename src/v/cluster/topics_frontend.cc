@@ -136,18 +136,7 @@ ss::future<std::vector<topic_result>> topics_frontend::create_topics(
               return ss::make_ready_future<std::vector<topic_result>>(
                 make_error_topic_results(topics, errc::not_leader_controller));
           }
-          std::vector<ss::future<topic_result>> futures;
-          futures.reserve(topics.size());
-
-          std::transform(
-            std::begin(topics),
-            std::end(topics),
-            std::back_inserter(futures),
-            [this, timeout](custom_assignable_topic_configuration& t_cfg) {
-                return do_create_topic(std::move(t_cfg), timeout);
-            });
-
-          return ss::when_all_succeed(futures.begin(), futures.end());
+          return do_create_topics(std::move(topics), timeout);
       })
       .then([this, timeout](std::vector<topic_result> results) {
           if (needs_linearizable_barrier(results)) {
@@ -386,24 +375,83 @@ errc topics_frontend::validate_topic_configuration(
     return errc::success;
 }
 
-ss::future<topic_result> topics_frontend::do_create_topic(
-  custom_assignable_topic_configuration assignable_config,
+ss::future<std::vector<topic_result>> topics_frontend::do_create_topics(
+  std::vector<custom_assignable_topic_configuration> topics,
   model::timeout_clock::time_point timeout) {
+    // validation may download topic manifests, run it for all topics at once
+    std::vector<ss::future<errc>> prepare_futures;
+    prepare_futures.reserve(topics.size());
+    for (auto& t_cfg : topics) {
+        prepare_futures.push_back(prepare_create_topic(t_cfg));
+    }
+    auto prepared = co_await ss::when_all_succeed(
+      prepare_futures.begin(), prepare_futures.end());
+
+    std::vector<std::optional<topic_result>> results(topics.size());
+    std::vector<size_t> to_allocate;
+    std::vector<allocation_request> requests;
+    for (size_t i = 0; i < topics.size(); ++i) {
+        if (prepared[i] != errc::success) {
+            results[i] = topic_result(topics[i].cfg.tp_ns, prepared[i]);
+            continue;
+        }
+        to_allocate.push_back(i);
+        requests.push_back(make_allocation_request(topics[i]));
+    }
+
+    // a single round trip to the allocator shard for all the topics
+    auto units = co_await _allocator.invoke_on(
+      partition_allocator::shard,
+      [requests = std::move(requests)](partition_allocator& al) mutable {
+          return al.allocate(std::move(requests));
+      });
+
+    // the create commands are replicated concurrently, the controller raft
+    // group batches them together in its log
+    std::vector<ss::future<topic_result>> replicate_futures;
+    std::vector<size_t> replicated;
+    replicate_futures.reserve(to_allocate.size());
+    replicated.reserve(to_allocate.size());
+    for (size_t j = 0; j < to_allocate.size(); ++j) {
+        auto i = to_allocate[j];
+        if (!units[j]) {
+            results[i] = make_error_result(
+              topics[i].cfg.tp_ns, units[j].error());
+            continue;
+        }
+        replicated.push_back(i);
+        replicate_futures.push_back(replicate_create_topic(
+          std::move(topics[i].cfg), std::move(units[j].value()), timeout));
+    }
+    auto replicate_results = co_await ss::when_all_succeed(
+      replicate_futures.begin(), replicate_futures.end());
+    for (size_t k = 0; k < replicated.size(); ++k) {
+        results[replicated[k]] = std::move(replicate_results[k]);
+    }
+
+    std::vector<topic_result> ret;
+    ret.reserve(results.size());
+    for (auto& r : results) {
+        ret.push_back(std::move(*r));
+    }
+    co_return ret;
+}
+
+ss::future<errc> topics_frontend::prepare_create_topic(
+  custom_assignable_topic_configuration& assignable_config) {
     if (_topics.local().contains(assignable_config.cfg.tp_ns)) {
-        co_return topic_result(
-          assignable_config.cfg.tp_ns, errc::topic_already_exists);
+        co_return errc::topic_already_exists;
     }
 
     auto validation_err = validate_topic_configuration(assignable_config);
 
     if (validation_err != errc::success) {
-        co_return topic_result(assignable_config.cfg.tp_ns, validation_err);
+        co_return validation_err;
     }
 
     if (assignable_config.is_read_replica()) {
         if (!assignable_config.cfg.properties.read_replica_bucket) {
-            co_return make_error_result(
-              assignable_config.cfg.tp_ns, errc::topic_invalid_config);
+            co_return errc::topic_invalid_config;
         }
         auto rr_manager = remote_topic_configuration_source(
           _cloud_storage_api.local());
@@ -415,8 +463,7 @@ ss::future<topic_result> topics_frontend::do_create_topic(
           _as.local());
 
         if (download_res != errc::success) {
-            co_return make_error_result(
-              assignable_config.cfg.tp_ns, errc::topic_operation_error);
+            co_return errc::topic_operation_error;
         }
 
         if (!assignable_config.cfg.properties.remote_topic_properties) {
@@ -442,8 +489,7 @@ ss::future<topic_result> topics_frontend::do_create_topic(
               "Can't run topic recovery for the topic {}, {} is not set",
               assignable_config.cfg.tp_ns,
               bucket_config.name());
-            co_return make_error_result(
-              assignable_config.cfg.tp_ns, errc::topic_operation_error);
+            co_return errc::topic_operation_error;
         }
         auto cfg_source = remote_topic_configuration_source(
           _cloud_storage_api.local());
@@ -465,8 +511,7 @@ ss::future<topic_result> topics_frontend::do_create_topic(
                   clusterlog.error,
                   "Can't run topic recovery for the topic {}",
                   assignable_config.cfg.tp_ns);
-                co_return make_error_result(
-                  assignable_config.cfg.tp_ns, errc::topic_invalid_config);
+                co_return errc::topic_invalid_config;
             }
             vassert(
               static_cast<bool>(
@@ -483,16 +528,7 @@ ss::future<topic_result> topics_frontend::do_create_topic(
           assignable_config.cfg);
     }
 
-    auto units = co_await _allocator.invoke_on(
-      partition_allocator::shard, [assignable_config](partition_allocator& al) {
-          return al.allocate(make_allocation_request(assignable_config));
-      });
-
-    if (!units) {
-        co_return make_error_result(assignable_config.cfg.tp_ns, units.error());
-    }
-    co_return co_await replicate_create_topic(
-      std::move(assignable_config.cfg), std::move(units.value()), timeout);
+    co_return errc::success;
 }
 
 ss::future<topic_result> topics_frontend::replicate_create_topic(
@@ -849,6 +885,51 @@ bool topics_frontend::validate_topic_name(const model::topic_namespace& topic) {
     return true;
 }
 
+ss::future<std::error_code> topics_frontend::dispatch_move_partition_replicas(
+  model::ntp ntp,
+  std::vector<model::broker_shard> replicas,
+  std::chrono::milliseconds timeout) {
+    auto controller_leader = _leaders.local().get_leader(model::controller_ntp);
+    if (!controller_leader) {
+        co_return errc::no_leader_controller;
+    }
+    if (controller_leader == _self) {
+        co_return co_await move_partition_replicas(
+          std::move(ntp),
+          std::move(replicas),
+          reconfiguration_policy::full_local_retention,
+          timeout + model::timeout_clock::now());
+    }
+
+    vlog(
+      clusterlog.debug,
+      "dispatching move of {} to {} to {}",
+      ntp,
+      replicas,
+      controller_leader);
+    auto reply
+      = co_await _connections.local()
+          .with_node_client<cluster::controller_client_protocol>(
+            _self,
+            ss::this_shard_id(),
+            *controller_leader,
+            timeout,
+            [ntp, replicas, timeout](controller_client_protocol cp) mutable {
+                return cp.move_partition_replicas(
+                  move_partition_replicas_request{
+                    .ntp = std::move(ntp),
+                    .replicas = std::move(replicas),
+                    .timeout = timeout},
+                  rpc::client_opts(model::timeout_clock::now() + timeout));
+            })
+          .then(&rpc::get_ctx_data<move_partition_replicas_reply>);
+
+    if (reply.has_error()) {
+        co_return reply.error();
+    }
+    co_return reply.value().result;
+}
+
 ss::future<std::error_code> topics_frontend::move_partition_replicas(
   model::ntp ntp,
   std::vector<model::broker_shard> new_replica_set,
@@ -91,6 +91,13 @@ public:
       model::timeout_clock::time_point,
       std::optional<model::term_id> = std::nullopt);
 
+    /**
+     * Same as move_partition_replicas but may be called on any node, the
+     * request is forwarded to the controller leader when needed.
+     */
+    ss::future<std::error_code> dispatch_move_partition_replicas(
+      model::ntp, std::vector<model::broker_shard>, std::chrono::milliseconds);
+
     ss::future<std::error_code> force_update_partition_replicas(
       model::ntp,
       std::vector<model::broker_shard>,
@@ -192,8 +199,12 @@ public:
 private:
     using ntp_leader = std::pair<model::ntp, model::node_id>;
 
-    ss::future<topic_result> do_create_topic(
-      custom_assignable_topic_configuration, model::timeout_clock::time_point);
+    ss::future<std::vector<topic_result>> do_create_topics(
+      std::vector<custom_assignable_topic_configuration>,
+      model::timeout_clock::time_point);
+
+    ss::future<errc>
+    prepare_create_topic(custom_assignable_topic_configuration&);
 
     ss::future<topic_result> replicate_create_topic(
       topic_configuration,
@@ -25,6 +25,7 @@
 
 #include <fmt/ostream.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -708,6 +709,43 @@ operator<<(std::ostream& o, const incremental_topic_custom_updates& i) {
     return o;
 }
 
+assignments_set::iterator assignments_set::find(model::partition_id id) {
+    auto it = std::lower_bound(
+      begin(), end(), id, partition_assignment_cmp{});
+    return it != end() && it->id == id ? it : end();
+}
+
+assignments_set::const_iterator
+assignments_set::find(model::partition_id id) const {
+    auto it = std::lower_bound(
+      begin(), end(), id, partition_assignment_cmp{});
+    return it != end() && it->id == id ? it : end();
+}
+
+std::pair<assignments_set::iterator, bool>
+assignments_set::insert(partition_assignment p_as) {
+    if (empty() || _assignments[size() - 1].id < p_as.id) {
+        _assignments.push_back(std::move(p_as));
+        return {end() - 1, true};
+    }
+    auto it = std::lower_bound(
+      begin(), end(), p_as.id, partition_assignment_cmp{});
+    if (it->id == p_as.id) {
+        return {it, false};
+    }
+    const auto idx = it - begin();
+    _assignments.push_back(std::move(p_as));
+    std::rotate(begin() + idx, end() - 1, end());
+    return {begin() + idx, true};
+}
+
+assignments_set::iterator assignments_set::erase(iterator it) {
+    const auto idx = it - begin();
+    std::move(it + 1, end(), it);
+    _assignments.pop_back();
+    return begin() + idx;
+}
+
 namespace {
 cluster::assignments_set to_assignments_map(
   ss::chunked_fifo<cluster::partition_assignment> assignment_vector) {
@@ -33,6 +33,7 @@
 #include "serde/serde.h"
 #include "storage/ntp_config.h"
 #include "tristate.h"
+#include "utils/fragmented_vector.h"
 #include "utils/to_string.h"
 #include "v8_engine/data_policy.h"
 
@@ -68,33 +69,43 @@ using replicas_t = std::vector<model::broker_shard>;
 struct allocate_id_request
   : serde::envelope<
       allocate_id_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     model::timeout_clock::duration timeout;
+    // number of consecutive ids requested, the reply may carry fewer
+    int64_t count{1};
 
     allocate_id_request() noexcept = default;
 
     explicit allocate_id_request(model::timeout_clock::duration timeout)
       : timeout(timeout) {}
 
+    allocate_id_request(model::timeout_clock::duration timeout, int64_t count)
+      : timeout(timeout)
+      , count(count) {}
+
     friend bool
     operator==(const allocate_id_request&, const allocate_id_request&)
       = default;
 
     friend std::ostream&
     operator<<(std::ostream& o, const allocate_id_request& req) {
-        fmt::print(o, "timeout: {}", req.timeout.count());
+        fmt::print(
+          o, "timeout: {}, count: {}", req.timeout.count(), req.count);
         return o;
     }
 
-    auto serde_fields() { return std::tie(timeout); }
+    auto serde_fields() { return std::tie(timeout, count); }
 };
 
 struct allocate_id_reply
   : serde::
-      envelope<allocate_id_reply, serde::version<0>, serde::compat_version<0>> {
+      envelope<allocate_id_reply, serde::version<1>, serde::compat_version<0>> {
     int64_t id;
     errc ec;
+    // number of consecutive ids allocated starting at `id`, 1 when replied
+    // by a node that predates range allocation
+    int64_t count{1};
 
     allocate_id_reply() noexcept = default;
 
@@ -102,16 +113,22 @@ struct allocate_id_reply
       : id(id)
       , ec(ec) {}
 
+    allocate_id_reply(int64_t id, errc ec, int64_t count)
+      : id(id)
+      , ec(ec)
+      , count(count) {}
+
     friend bool operator==(const allocate_id_reply&, const allocate_id_reply&)
       = default;
 
     friend std::ostream&
     operator<<(std::ostream& o, const allocate_id_reply& rep) {
-        fmt::print(o, "id: {}, ec: {}", rep.id, rep.ec);
+        fmt::print(
+          o, "id: {}, ec: {}, count: {}", rep.id, rep.ec, rep.count);
         return o;
     }
 
-    auto serde_fields() { return std::tie(id, ec); }
+    auto serde_fields() { return std::tie(id, ec, count); }
 };
 
 struct reset_id_allocator_request
@@ -3616,8 +3633,70 @@ struct partition_assignment_cmp {
     }
 };
 
-using assignments_set
-  = absl::btree_set<partition_assignment, partition_assignment_cmp>;
+/**
+ * Partition assignments of a topic, sorted by partition id.
+ *
+ * The assignments are kept in a fragmented vector rather than in a node based
+ * tree, scanning the partitions of a topic reads consecutive memory and the
+ * only per partition allocation left is the replica set. Partitions are added
+ * with increasing ids, which makes an insertion an append. Insertions and
+ * removals in the middle of the set are linear in the number of partitions of
+ * the topic.
+ */
+class assignments_set {
+    using container_t = fragmented_vector<partition_assignment>;
+
+public:
+    using value_type = partition_assignment;
+    using iterator = container_t::iterator;
+    using const_iterator = container_t::const_iterator;
+
+    assignments_set() noexcept = default;
+    assignments_set(const assignments_set& other)
+      : _assignments(other._assignments.copy()) {}
+    assignments_set& operator=(const assignments_set& other) {
+        if (this != &other) {
+            _assignments = other._assignments.copy();
+        }
+        return *this;
+    }
+    assignments_set(assignments_set&&) noexcept = default;
+    assignments_set& operator=(assignments_set&&) noexcept = default;
+    ~assignments_set() noexcept = default;
+
+    iterator begin() { return _assignments.begin(); }
+    iterator end() { return _assignments.end(); }
+    const_iterator begin() const { return _assignments.begin(); }
+    const_iterator end() const { return _assignments.end(); }
+    const_iterator cbegin() const { return _assignments.cbegin(); }
+    const_iterator cend() const { return _assignments.cend(); }
+
+    size_t size() const { return _assignments.size(); }
+    bool empty() const { return _assignments.empty(); }
+
+    iterator find(model::partition_id);
+    const_iterator find(model::partition_id) const;
+    bool contains(model::partition_id id) const { return find(id) != end(); }
+
+    /// Inserts the assignment unless the set already contains the partition,
+    /// in which case the existing assignment is returned
+    std::pair<iterator, bool> insert(partition_assignment);
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert(partition_assignment(std::forward<Args>(args)...));
+    }
+
+    /// Removes the assignment, returns the iterator following it
+    iterator erase(iterator);
+
+    friend bool operator==(const assignments_set& a, const assignments_set& b) {
+        return a._assignments == b._assignments;
+    }
+
+private:
+    container_t _assignments;
+};
 
 struct topic_metadata_fields
   : serde::envelope<
@@ -4506,6 +4585,40 @@ struct delete_topics_reply
     auto serde_fields() { return std::tie(results); }
 };
 
+struct move_partition_replicas_request
+  : serde::envelope<
+      move_partition_replicas_request,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+    model::ntp ntp;
+    replicas_t replicas;
+    std::chrono::milliseconds timeout;
+
+    friend bool operator==(
+      const move_partition_replicas_request&,
+      const move_partition_replicas_request&)
+      = default;
+
+    auto serde_fields() { return std::tie(ntp, replicas, timeout); }
+};
+
+struct move_partition_replicas_reply
+  : serde::envelope<
+      move_partition_replicas_reply,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+    errc result;
+
+    friend bool operator==(
+      const move_partition_replicas_reply&,
+      const move_partition_replicas_reply&)
+      = default;
+
+    auto serde_fields() { return std::tie(result); }
+};
+
 } // namespace cluster
 namespace std {
 template<>
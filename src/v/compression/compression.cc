@@ -14,6 +14,7 @@
 #include "compression/internal/lz4_frame_compressor.h"
 #include "compression/internal/snappy_java_compressor.h"
 #include "compression/internal/zstd_compressor.h"
+#include "compression/stream_decompressor.h"
 #include "units.h"
 #include "vassert.h"
 #include "vlog.h"
@@ -50,6 +51,22 @@ iobuf compressor::compress(const iobuf& io, type t) {
         vassert(false, "Cannot compress type {}", t);
     }
 }
+iobuf compressor::compress(const iobuf& io, type t, int level) {
+    switch (t) {
+    case type::none:
+        throw std::runtime_error("compressor: nothing to compress for 'none'");
+    case type::gzip:
+        return internal::gzip_compressor::compress_with_level(io, level);
+    case type::snappy:
+        return internal::snappy_java_compressor::compress(io);
+    case type::lz4:
+        return internal::lz4_frame_compressor::compress_with_level(io, level);
+    case type::zstd:
+        return internal::zstd_compressor::compress_with_level(io, level);
+    default:
+        vassert(false, "Cannot compress type {}", t);
+    }
+}
 iobuf compressor::uncompress(const iobuf& io, type t) {
     if (io.empty()) {
         throw std::runtime_error(
@@ -98,4 +115,31 @@ ss::future<iobuf> stream_compressor::uncompress(iobuf io, type t) {
     }
 }
 
+std::unique_ptr<stream_decompressor>
+make_stream_decompressor(iobuf io, type t, size_t chunk_size) {
+    if (io.empty()) {
+        throw std::runtime_error(
+          fmt::format("Asked to decompress:{} an empty buffer:{}", (int)t, io));
+    }
+    switch (t) {
+    case type::none:
+        throw std::runtime_error(
+          "compressor: nothing to uncompress for 'none'");
+    case type::gzip:
+        return internal::gzip_compressor::make_stream_decompressor(
+          std::move(io), chunk_size);
+    case type::snappy:
+        return internal::snappy_java_compressor::make_stream_decompressor(
+          std::move(io), chunk_size);
+    case type::lz4:
+        return internal::lz4_frame_compressor::make_stream_decompressor(
+          std::move(io), chunk_size);
+    case type::zstd:
+        return internal::zstd_compressor::make_stream_decompressor(
+          std::move(io), chunk_size);
+    default:
+        vassert(false, "Cannot uncompress type {}", t);
+    }
+}
+
 } // namespace compression
@@ -20,6 +20,9 @@ using type = model::compression;
 // a virtual interface so we can instantiate them
 struct compressor {
     static iobuf compress(const iobuf&, type);
+    // the level is specific to the codec, see compression/internal. snappy
+    // has no levels and ignores it
+    static iobuf compress(const iobuf&, type, int level);
     static iobuf uncompress(const iobuf&, type);
 };
 
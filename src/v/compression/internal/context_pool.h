@@ -0,0 +1,78 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include <concepts>
+#include <utility>
+#include <vector>
+
+namespace compression::internal {
+
+/*
+ * Shard local cache of codec contexts, e.g. lz4 frame contexts, zlib streams
+ * or zstd contexts. Creating a context allocates and initializes its tables,
+ * which costs more than compressing a small batch.
+ *
+ * The codecs are synchronous so a single context per codec is normally in
+ * use at a time; only max_idle of them are kept. The pool does not reset
+ * the contexts: users reset a context after acquiring it, which also
+ * recovers the contexts released after an error.
+ */
+template<std::movable T>
+class context_pool {
+public:
+    static constexpr size_t max_idle = 2;
+
+    // releasing never allocates
+    context_pool() { _idle.reserve(max_idle); }
+
+    class lease {
+    public:
+        lease(context_pool& pool, T obj) noexcept
+          : _pool(&pool)
+          , _obj(std::move(obj)) {}
+        lease(const lease&) = delete;
+        lease& operator=(const lease&) = delete;
+        lease(lease&&) = delete;
+        lease& operator=(lease&&) = delete;
+        ~lease() { _pool->release(std::move(_obj)); }
+
+        T& operator*() noexcept { return _obj; }
+        T* operator->() noexcept { return &_obj; }
+
+    private:
+        context_pool* _pool;
+        T _obj;
+    };
+
+    /// the most recently released context, or a new one from make()
+    template<std::invocable Make>
+    lease acquire(Make&& make) {
+        if (_idle.empty()) {
+            return lease(*this, make());
+        }
+        auto obj = std::move(_idle.back());
+        _idle.pop_back();
+        return lease(*this, std::move(obj));
+    }
+
+private:
+    void release(T obj) noexcept {
+        if (_idle.size() < max_idle) {
+            _idle.push_back(std::move(obj));
+        }
+    }
+
+    std::vector<T> _idle;
+};
+
+} // namespace compression::internal
@@ -10,6 +10,7 @@
 #include "compression/internal/gzip_compressor.h"
 
 #include "bytes/bytes.h"
+#include "compression/internal/context_pool.h"
 #include "vassert.h"
 
 #include <seastar/core/temporary_buffer.hh>
@@ -39,6 +40,11 @@ inline z_stream default_zstream() {
     return zs;
 }
 
+/*
+ * The codecs are pooled, see context_pool: allocating the deflate state
+ * alone takes more than 256KiB. They are held by pointer since zlib keeps
+ * a pointer to the z_stream in its state.
+ */
 class gzip_compression_codec {
 public:
     gzip_compression_codec() noexcept = default;
@@ -48,19 +54,29 @@ public:
     gzip_compression_codec& operator=(gzip_compression_codec&&) noexcept
       = delete;
 
-    void reset() {
-        vassert(!_init, "Double initialized gzip decompression codec");
+    void reset(int level) {
+        if (_init && level == _level) {
+            throw_if_zstream_error(
+              "gzip compress deflateReset error: {}", deflateReset(&_stream));
+            return;
+        }
+        if (_init) {
+            // deflateParams() may flush, it is simpler to start over
+            _init = false;
+            deflateEnd(&_stream);
+        }
         _stream = default_zstream();
         throw_if_zstream_error(
           "gzip compress deflateInit2 error: {}",
           deflateInit2(
             &_stream,
-            Z_DEFAULT_COMPRESSION,
+            level,
             Z_DEFLATED,
             15 + 16,
             8 /*512 byte*/,
             Z_DEFAULT_STRATEGY));
         _init = true;
+        _level = level;
     }
     z_stream& stream() { return _stream; }
     ~gzip_compression_codec() {
@@ -72,13 +88,12 @@ public:
 
 private:
     bool _init{false};
+    int _level{Z_DEFAULT_COMPRESSION};
     z_stream _stream;
 };
 class gzip_decompression_codec {
 public:
-    gzip_decompression_codec(const iobuf& input) noexcept
-      : _input(input)
-      , _input_chunk(input.begin()) {}
+    gzip_decompression_codec() noexcept = default;
     gzip_decompression_codec(const gzip_decompression_codec&) = delete;
     gzip_decompression_codec& operator=(const gzip_decompression_codec&)
       = delete;
@@ -86,24 +101,30 @@ public:
     gzip_decompression_codec& operator=(gzip_decompression_codec&&) noexcept
       = delete;
 
-    void reset() {
-        vassert(!_init, "Double initialized gzip decompression codec");
-        _stream = default_zstream();
+    void reset(const iobuf& input) {
+        _input_chunk = input.begin();
+        if (_init) {
+            throw_if_zstream_error(
+              "gzip inflateReset error:{}", inflateReset(&_stream));
+        } else {
+            _stream = default_zstream();
+            throw_if_zstream_error(
+              "gzip error with inflateInit2:{}",
+              inflateInit2(&_stream, 15 + 32));
+            // marking init must happen before gzip header
+            _init = true;
+        }
         // zlib is not const-correct
         // NOLINTNEXTLINE
         _stream.next_in = (unsigned char*)(_input_chunk->get());
         _stream.avail_in = _input_chunk->size();
-        throw_if_zstream_error(
-          "gzip error with inflateInit2:{}", inflateInit2(&_stream, 15 + 32));
-        // marking init must happen before gzip header
-        _init = true;
 
-        // last
+        // last, the reset forgets the header
         throw_if_zstream_error(
           "gzip inflateGetHeader error:{}", inflateGetHeader(&_stream, &_hdr));
     }
 
-    iobuf inflate_to_iobuf();
+    iobuf inflate_to_iobuf(const iobuf& input);
 
     ~gzip_decompression_codec() {
         if (_init) {
@@ -118,19 +139,24 @@ public:
 private:
     bool _init{false};
 
-    const iobuf& _input;
     iobuf::const_iterator _input_chunk;
 
     gz_header _hdr; // needed for gzip
     z_stream _stream;
 };
 
-iobuf gzip_compressor::compress(const iobuf& b) {
+static thread_local context_pool<std::unique_ptr<gzip_compression_codec>>
+  compression_codecs;
+static thread_local context_pool<std::unique_ptr<gzip_decompression_codec>>
+  decompression_codecs;
+
+iobuf gzip_compressor::compress_with_level(const iobuf& b, int level) {
     const size_t max_chunk_size = details::io_allocation_size::max_chunk_size;
 
-    gzip_compression_codec def;
-    def.reset();
-    z_stream& strm = def.stream();
+    auto def = compression_codecs.acquire(
+      [] { return std::make_unique<gzip_compression_codec>(); });
+    (*def)->reset(level);
+    z_stream& strm = (*def)->stream();
 
     const size_t output_size_estimate = deflateBound(&strm, b.size_bytes());
     size_t output_chunk_size = std::min(max_chunk_size, output_size_estimate);
@@ -174,13 +200,13 @@ iobuf gzip_compressor::compress(const iobuf& b) {
     return ret;
 }
 
-iobuf gzip_decompression_codec::inflate_to_iobuf() {
+iobuf gzip_decompression_codec::inflate_to_iobuf(const iobuf& input) {
     // Max memory allocation
     const size_t max_chunk_size = details::io_allocation_size::max_chunk_size;
 
     // Rough guess at compression ratio to guess initial chunk size for
     // small buffers.
-    size_t chunk_size = std::min(max_chunk_size, _input.size_bytes() * 3);
+    size_t chunk_size = std::min(max_chunk_size, input.size_bytes() * 3);
 
     int code = 0;
     iobuf output;
@@ -201,9 +227,9 @@ iobuf gzip_decompression_codec::inflate_to_iobuf() {
         default: /*do nothing*/;
         }
 
-        while (_stream.avail_in == 0 && _input_chunk != _input.end()) {
+        while (_stream.avail_in == 0 && _input_chunk != input.end()) {
             _input_chunk++;
-            if (_input_chunk != _input.end()) {
+            if (_input_chunk != input.end()) {
                 _stream.next_in = const_cast<unsigned char*>(
                   reinterpret_cast<const unsigned char*>(_input_chunk->get()));
                 _stream.avail_in = _input_chunk->size();
@@ -223,9 +249,87 @@ iobuf gzip_decompression_codec::inflate_to_iobuf() {
 }
 
 iobuf gzip_compressor::uncompress(const iobuf& b) {
-    auto codec = gzip_decompression_codec(b);
-    codec.reset();
-    return codec.inflate_to_iobuf();
+    auto codec = decompression_codecs.acquire(
+      [] { return std::make_unique<gzip_decompression_codec>(); });
+    (*codec)->reset(b);
+    return (*codec)->inflate_to_iobuf(b);
+}
+
+namespace {
+
+class gzip_stream_decompressor final : public stream_decompressor {
+public:
+    gzip_stream_decompressor(iobuf input, size_t chunk_size)
+      : _input(std::move(input))
+      , _next_chunk(_input.cbegin())
+      , _chunk_size(chunk_size)
+      , _stream(default_zstream()) {
+        feed();
+        throw_if_zstream_error(
+          "gzip error with inflateInit2:{}", inflateInit2(&_stream, 15 + 32));
+        _init = true;
+    }
+
+    ~gzip_stream_decompressor() override {
+        if (_init) {
+            inflateEnd(&_stream);
+        }
+    }
+
+    iobuf next() final {
+        iobuf ret;
+        if (_done) {
+            return ret;
+        }
+        ss::temporary_buffer<char> obuf(_chunk_size);
+        _stream.next_out = reinterpret_cast<unsigned char*>(obuf.get_write());
+        _stream.avail_out = obuf.size();
+        while (_stream.avail_out > 0) {
+            feed();
+            const auto code = inflate(&_stream, Z_NO_FLUSH);
+            if (code == Z_STREAM_END) {
+                _done = true;
+                break;
+            }
+            if (code == Z_BUF_ERROR && _stream.avail_in == 0) {
+                // like uncompress(), a truncated stream ends the output
+                _done = true;
+                break;
+            }
+            throw_if_zstream_error("gzip uncompress error:{}", code);
+        }
+        obuf.trim(obuf.size() - _stream.avail_out);
+        if (!obuf.empty()) {
+            ret.append(std::move(obuf));
+        }
+        return ret;
+    }
+
+private:
+    void feed() {
+        while (_stream.avail_in == 0 && _next_chunk != _input.cend()) {
+            // zlib is not const-correct
+            // NOLINTNEXTLINE
+            _stream.next_in = (unsigned char*)(_next_chunk->get());
+            _stream.avail_in = _next_chunk->size();
+            ++_next_chunk;
+        }
+    }
+
+    iobuf _input;
+    iobuf::const_iterator _next_chunk;
+    size_t _chunk_size;
+    bool _init{false};
+    bool _done{false};
+    z_stream _stream;
+};
+
+} // namespace
+
+std::unique_ptr<stream_decompressor>
+gzip_compressor::make_stream_decompressor(iobuf input, size_t chunk_size) {
+    return std::make_unique<gzip_stream_decompressor>(
+      std::move(input), chunk_size);
 }
 
 } // namespace compression::internal
@@ -11,10 +11,20 @@
 
 #pragma once
 #include "bytes/iobuf.h"
+#include "compression/stream_decompressor.h"
 namespace compression::internal {
 
 struct gzip_compressor {
-    static iobuf compress(const iobuf&);
+    // Z_DEFAULT_COMPRESSION, i.e. level 6
+    static constexpr int default_level = -1;
+
+    static iobuf compress(const iobuf& b) {
+        return compress_with_level(b, default_level);
+    }
+    /// level between 1 (fastest) and 9 (smallest)
+    static iobuf compress_with_level(const iobuf&, int level);
     static iobuf uncompress(const iobuf&);
+    static std::unique_ptr<stream_decompressor>
+    make_stream_decompressor(iobuf, size_t chunk_size);
 };
 } // namespace compression::internal
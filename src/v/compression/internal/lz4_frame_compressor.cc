@@ -10,6 +10,7 @@
 #include "compression/internal/lz4_frame_compressor.h"
 
 #include "bytes/bytes.h"
+#include "compression/internal/context_pool.h"
 #include "static_deleter_fn.h"
 #include "units.h"
 #include "vassert.h"
@@ -65,13 +66,18 @@ static lz4_decompression_ctx make_decompression_context() {
     return lz4_decompression_ctx(c);
 }
 
-iobuf lz4_frame_compressor::compress(const iobuf& b) {
-    auto ctx_ptr = make_compression_context();
-    LZ4F_compressionContext_t ctx = ctx_ptr.get();
+static thread_local context_pool<lz4_compression_ctx> compression_contexts;
+static thread_local context_pool<lz4_decompression_ctx>
+  decompression_contexts;
+
+iobuf lz4_frame_compressor::compress_with_level(const iobuf& b, int level) {
+    // LZ4F_compressBegin() resets the context
+    auto ctx_ptr = compression_contexts.acquire(make_compression_context);
+    LZ4F_compressionContext_t ctx = ctx_ptr->get();
     /* Required by Kafka */
     LZ4F_preferences_t prefs;
     std::memset(&prefs, 0, sizeof(prefs));
-    prefs.compressionLevel = 1; // default
+    prefs.compressionLevel = level;
     prefs.frameInfo = {
       .blockMode = LZ4F_blockIndependent, .contentSize = b.size_bytes()};
 
@@ -175,8 +181,10 @@ iobuf lz4_frame_compressor::uncompress(iobuf const& input) {
     size_t read_this_chunk{0};
     size_t read_total{0};
 
-    auto ctx_ptr = make_decompression_context();
-    LZ4F_decompressionContext_t ctx = ctx_ptr.get();
+    auto ctx_ptr = decompression_contexts.acquire(make_decompression_context);
+    LZ4F_decompressionContext_t ctx = ctx_ptr->get();
+    // the previous frame may have ended in an error
+    LZ4F_resetDecompressionContext(ctx);
 
     // Prior to main loop, optionally consume header to learn total size
     LZ4F_errorCode_t code = 0;
@@ -274,4 +282,83 @@ iobuf lz4_frame_compressor::uncompress(iobuf const& input) {
     return ret;
 }
 
+namespace {
+
+class lz4_stream_decompressor final : public stream_decompressor {
+public:
+    lz4_stream_decompressor(iobuf input, size_t chunk_size)
+      : _input(std::move(input))
+      , _chunk(_input.cbegin())
+      , _chunk_size(chunk_size)
+      , _ctx(make_decompression_context()) {}
+
+    iobuf next() final {
+        iobuf ret;
+        if (_done) {
+            return ret;
+        }
+        ss::temporary_buffer<char> obuf(_chunk_size);
+        size_t written = 0;
+        while (written < obuf.size()) {
+            const bool input_left = _chunk != _input.cend();
+            // the context may hold decoded bytes that did not fit in the
+            // previous chunk, they are flushed without more input
+            size_t read = input_left ? _chunk->size() - _read_this_chunk : 0;
+            size_t out = obuf.size() - written;
+            const auto code = LZ4F_decompress(
+              _ctx.get(),
+              obuf.get_write() + written,
+              &out,
+              input_left ? _chunk->get() + _read_this_chunk : nullptr,
+              &read,
+              nullptr);
+            check_lz4_error("lz4f_decompress error: {}", code);
+            written += out;
+            _read_this_chunk += read;
+            while (_chunk != _input.cend()
+                   && _read_this_chunk == _chunk->size()) {
+                _read_this_chunk = 0;
+                ++_chunk;
+            }
+            if (code == 0) {
+                // end of the frame
+                if (unlikely(_chunk != _input.cend())) {
+                    throw std::runtime_error(fmt::format(
+                      "lz4 error. could not consume all input bytes in "
+                      "decompression. Input:{}",
+                      _input.size_bytes()));
+                }
+                _done = true;
+                break;
+            }
+            if (!input_left && out == 0) {
+                // like uncompress(), a truncated frame ends the output
+                _done = true;
+                break;
+            }
+        }
+        obuf.trim(written);
+        if (!obuf.empty()) {
+            ret.append(std::move(obuf));
+        }
+        return ret;
+    }
+
+private:
+    iobuf _input;
+    iobuf::const_iterator _chunk;
+    size_t _read_this_chunk{0};
+    size_t _chunk_size;
+    lz4_decompression_ctx _ctx;
+    bool _done{false};
+};
+
+} // namespace
+
+std::unique_ptr<stream_decompressor>
+lz4_frame_compressor::make_stream_decompressor(iobuf input, size_t chunk_size) {
+    return std::make_unique<lz4_stream_decompressor>(
+      std::move(input), chunk_size);
+}
+
 } // namespace compression::internal
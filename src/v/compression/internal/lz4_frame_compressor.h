@@ -11,11 +11,20 @@
 
 #pragma once
 #include "bytes/iobuf.h"
+#include "compression/stream_decompressor.h"
 namespace compression::internal {
 
 struct lz4_frame_compressor {
-    static iobuf compress(const iobuf&);
+    static constexpr int default_level = 1;
+
+    static iobuf compress(const iobuf& b) {
+        return compress_with_level(b, default_level);
+    }
+    /// level up to 12, from level 3 on the slower lz4 HC is used
+    static iobuf compress_with_level(const iobuf&, int level);
     static iobuf uncompress(const iobuf&);
+    static std::unique_ptr<stream_decompressor>
+    make_stream_decompressor(iobuf, size_t chunk_size);
 };
 
 } // namespace compression::internal
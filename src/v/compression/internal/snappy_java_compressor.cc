@@ -108,4 +108,79 @@ iobuf snappy_java_compressor::uncompress(const iobuf& x) {
     return ret;
 }
 
+namespace {
+
+/*
+ * snappy-java frames are a sequence of independently compressed blocks,
+ * next() decompresses blocks until about chunk_size bytes are output. Raw
+ * snappy is a single block and decompressed at once.
+ */
+class snappy_java_stream_decompressor final : public stream_decompressor {
+public:
+    snappy_java_stream_decompressor(iobuf input, size_t chunk_size)
+      : _input(std::move(input))
+      , _iter(_input.cbegin(), _input.cend())
+      , _chunk_size(chunk_size) {
+        if (_input.size_bytes() < snappy_magic::header_len) {
+            return;
+        }
+        std::array<uint8_t, snappy_magic::java_magic.size()> magic{};
+        _iter.consume_to(magic.size(), magic.data());
+        if (snappy_magic::java_magic != magic) {
+            return;
+        }
+        _framed = true;
+        // NOTE: version and min_version are LITTLE_ENDIAN!
+        const auto version = _iter.consume_type<int32_t>();
+        const auto min_version = _iter.consume_type<int32_t>();
+        if (unlikely(min_version < snappy_magic::min_compatible_version)) {
+            throw std::runtime_error(fmt_with_ctx(
+              fmt::format,
+              "version missmatch. iobuf: {} - version:{}, min_version:{}",
+              _input,
+              version,
+              min_version));
+        }
+    }
+
+    iobuf next() final {
+        iobuf ret;
+        if (_done) {
+            return ret;
+        }
+        if (!_framed) {
+            _done = true;
+            return snappy_standard_compressor::uncompress(_input);
+        }
+        const size_t input_bytes = _input.size_bytes();
+        while (ret.size_bytes() < _chunk_size
+               && _iter.bytes_consumed() != input_bytes) {
+            auto compressed_length = _iter.consume_be_type<int32_t>();
+            auto block = iobuf_copy(_iter, compressed_length);
+            auto output_size
+              = snappy_standard_compressor::get_uncompressed_length(block);
+            snappy_standard_compressor::uncompress_append(
+              block, ret, output_size);
+        }
+        _done = _iter.bytes_consumed() == input_bytes;
+        return ret;
+    }
+
+private:
+    iobuf _input;
+    details::io_iterator_consumer _iter;
+    size_t _chunk_size;
+    bool _framed{false};
+    bool _done{false};
+};
+
+} // namespace
+
+std::unique_ptr<stream_decompressor>
+snappy_java_compressor::make_stream_decompressor(
+  iobuf input, size_t chunk_size) {
+    return std::make_unique<snappy_java_stream_decompressor>(
+      std::move(input), chunk_size);
+}
+
 } // namespace compression::internal
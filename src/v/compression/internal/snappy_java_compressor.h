@@ -12,11 +12,14 @@
 #pragma once
 
 #include "bytes/iobuf.h"
+#include "compression/stream_decompressor.h"
 
 namespace compression::internal {
 struct snappy_java_compressor {
     static iobuf compress(const iobuf&);
     static iobuf uncompress(const iobuf&);
+    static std::unique_ptr<stream_decompressor>
+    make_stream_decompressor(iobuf, size_t chunk_size);
 };
 
 } // namespace compression::internal
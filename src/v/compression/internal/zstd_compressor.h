@@ -11,18 +11,28 @@
 
 #pragma once
 #include "bytes/iobuf.h"
+#include "compression/stream_decompressor.h"
 #include "compression/stream_zstd.h"
 namespace compression::internal {
 
 struct zstd_compressor {
+    static constexpr int default_level = stream_zstd::default_compression_level;
+
     static iobuf compress(const iobuf& b) {
         stream_zstd fn;
         return fn.compress(b);
     }
+    static iobuf compress_with_level(const iobuf& b, int level) {
+        stream_zstd fn;
+        return fn.compress(b, level);
+    }
     static iobuf uncompress(const iobuf& b) {
         stream_zstd fn;
         return fn.uncompress(b);
     }
+    // defined in stream_zstd.cc
+    static std::unique_ptr<stream_decompressor>
+    make_stream_decompressor(iobuf, size_t chunk_size);
 };
 
 } // namespace compression::internal
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "model/compression.h"
+#include "units.h"
+
+#include <memory>
+
+namespace compression {
+
+/*
+ * Decompresses a buffer a chunk at a time, so that the whole decompressed
+ * data of a large batch is never in memory at once and callers can yield
+ * between chunks. Only the chunk returned by next() and the state of the
+ * codec (e.g. the zstd window) are held.
+ */
+class stream_decompressor {
+public:
+    static constexpr size_t default_chunk_size = 128_KiB;
+
+    stream_decompressor() = default;
+    stream_decompressor(const stream_decompressor&) = delete;
+    stream_decompressor& operator=(const stream_decompressor&) = delete;
+    stream_decompressor(stream_decompressor&&) = delete;
+    stream_decompressor& operator=(stream_decompressor&&) = delete;
+    virtual ~stream_decompressor() = default;
+
+    /// The next decompressed bytes, about chunk_size of them. Empty once the
+    /// input is decompressed.
+    virtual iobuf next() = 0;
+};
+
+std::unique_ptr<stream_decompressor> make_stream_decompressor(
+  iobuf,
+  model::compression,
+  size_t chunk_size = stream_decompressor::default_chunk_size);
+
+} // namespace compression
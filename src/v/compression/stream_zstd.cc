@@ -11,6 +11,8 @@
 
 #include "bytes/bytes.h"
 #include "bytes/details/io_allocation_size.h"
+#include "compression/internal/context_pool.h"
+#include "compression/internal/zstd_compressor.h"
 #include "likely.h"
 #include "units.h"
 #include "vassert.h"
@@ -57,17 +59,16 @@ void stream_zstd::init_workspace(size_t size) {
     }
 }
 
-void stream_zstd::reset_compressor() {
-    _compress.reset(ZSTD_createCCtx());
-    if (!_compress) {
+// compression contexts, created on demand and reused across calls
+static thread_local internal::context_pool<stream_zstd::zstd_compress_ctx>
+  cctx_pool;
+
+static stream_zstd::zstd_compress_ctx make_compress_ctx() {
+    stream_zstd::zstd_compress_ctx ctx(ZSTD_createCCtx());
+    if (!ctx) {
         throw std::bad_alloc{};
     }
-}
-stream_zstd::zstd_compress_ctx& stream_zstd::compressor() {
-    if (!_compress) {
-        reset_compressor();
-    }
-    return _compress;
+    return ctx;
 }
 
 ZSTD_DCtx* stream_zstd::decompressor() {
@@ -85,9 +86,12 @@ ZSTD_DCtx* stream_zstd::decompressor() {
     return ctx;
 }
 
-iobuf stream_zstd::do_compress(const iobuf& x) {
-    reset_compressor();
-    ZSTD_CCtx* ctx = compressor().get();
+iobuf stream_zstd::do_compress(const iobuf& x, int level) {
+    auto ctx_ptr = cctx_pool.acquire(make_compress_ctx);
+    ZSTD_CCtx* ctx = ctx_ptr->get();
+    // also drops a frame left unfinished by an error
+    throw_if_error(ZSTD_CCtx_reset(ctx, ZSTD_reset_session_and_parameters));
+    throw_if_error(ZSTD_CCtx_setParameter(ctx, ZSTD_c_compressionLevel, level));
     // NOTE: always enable content size. **decompression** depends on this
     throw_if_error(ZSTD_CCtx_setPledgedSrcSize(ctx, x.size_bytes()));
 
@@ -221,4 +225,79 @@ iobuf stream_zstd::do_uncompress(const iobuf& x) {
     return ret;
 }
 
+namespace {
+
+/*
+ * Unlike stream_zstd, which decompresses with a workspace shared by the
+ * shard, every stream has its own context: several streams can be in
+ * progress at once.
+ */
+class zstd_stream_decompressor final : public stream_decompressor {
+public:
+    using zstd_decompress_ctx = std::unique_ptr<
+      ZSTD_DCtx,
+      static_sized_deleter_fn<ZSTD_DCtx, &ZSTD_freeDCtx>>;
+
+    zstd_stream_decompressor(iobuf input, size_t chunk_size)
+      : _input(std::move(input))
+      , _next_chunk(_input.cbegin())
+      , _chunk_size(chunk_size)
+      , _ctx(ZSTD_createDCtx()) {
+        if (!_ctx) {
+            throw std::bad_alloc{};
+        }
+    }
+
+    iobuf next() final {
+        iobuf ret;
+        if (_done) {
+            return ret;
+        }
+        ss::temporary_buffer<char> obuf(_chunk_size);
+        ZSTD_outBuffer out = {
+          .dst = obuf.get_write(), .size = obuf.size(), .pos = 0};
+        while (out.pos < out.size) {
+            if (_in.pos == _in.size && _next_chunk != _input.cend()) {
+                _in = {
+                  .src = _next_chunk->get(),
+                  .size = _next_chunk->size(),
+                  .pos = 0};
+                ++_next_chunk;
+                continue;
+            }
+            const auto written = out.pos;
+            throw_if_error(ZSTD_decompressStream(_ctx.get(), &out, &_in));
+            // without input, the context is flushed once it outputs nothing
+            if (
+              _in.pos == _in.size && _next_chunk == _input.cend()
+              && out.pos == written) {
+                _done = true;
+                break;
+            }
+        }
+        obuf.trim(out.pos);
+        if (!obuf.empty()) {
+            ret.append(std::move(obuf));
+        }
+        return ret;
+    }
+
+private:
+    iobuf _input;
+    iobuf::const_iterator _next_chunk;
+    size_t _chunk_size;
+    zstd_decompress_ctx _ctx;
+    ZSTD_inBuffer _in{.src = nullptr, .size = 0, .pos = 0};
+    bool _done{false};
+};
+
+} // namespace
+
+std::unique_ptr<stream_decompressor>
+internal::zstd_compressor::make_stream_decompressor(
+  iobuf input, size_t chunk_size) {
+    return std::make_unique<zstd_stream_decompressor>(
+      std::move(input), chunk_size);
+}
+
 } // namespace compression
@@ -24,22 +24,26 @@ public:
       // wrap ZSTD C API
       static_sized_deleter_fn<ZSTD_CCtx, &ZSTD_freeCCtx>>;
 
-    iobuf compress(const iobuf& b) { return do_compress(b); }
+    static constexpr int default_compression_level = ZSTD_CLEVEL_DEFAULT;
+
+    iobuf compress(const iobuf& b) {
+        return do_compress(b, default_compression_level);
+    }
     iobuf uncompress(const iobuf& b) { return do_uncompress(b); }
-    iobuf compress(iobuf&& b) { return do_compress(b); }
+    iobuf compress(iobuf&& b) {
+        return do_compress(b, default_compression_level);
+    }
     iobuf uncompress(iobuf&& b) { return do_uncompress(b); }
+    /// level up to ZSTD_maxCLevel(), negative levels trade ratio for speed
+    iobuf compress(const iobuf& b, int level) { return do_compress(b, level); }
 
     static void init_workspace(size_t);
 
 private:
-    iobuf do_compress(const iobuf&);
+    iobuf do_compress(const iobuf&, int level);
     iobuf do_uncompress(const iobuf&);
 
-    void reset_compressor();
-    zstd_compress_ctx& compressor();
     ZSTD_DCtx* decompressor();
-
-    zstd_compress_ctx _compress{nullptr};
 };
 
 } // namespace compression
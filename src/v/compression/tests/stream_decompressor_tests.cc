@@ -0,0 +1,87 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "compression/compression.h"
+#include "compression/snappy_standard_compressor.h"
+#include "compression/stream_decompressor.h"
+#include "random/generators.h"
+#include "units.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <array>
+
+static constexpr std::array<size_t, 7> sizes{{
+  1,
+  100,
+  4_KiB,
+  64_KiB + 1,
+  128_KiB,
+  1_MiB + 3,
+  5_MiB,
+}};
+
+static constexpr std::array<size_t, 3> chunk_sizes{{
+  1_KiB,
+  32_KiB,
+  compression::stream_decompressor::default_chunk_size,
+}};
+
+static iobuf compressible(size_t size) {
+    iobuf ret;
+    const auto data = random_generators::gen_alphanum_string(512);
+    while (ret.size_bytes() < size) {
+        ret.append(data.data(), std::min(data.size(), size - ret.size_bytes()));
+    }
+    return ret;
+}
+
+static iobuf
+stream(const iobuf& compressed, compression::type t, size_t chunk_size) {
+    auto d = compression::make_stream_decompressor(
+      compressed.copy(), t, chunk_size);
+    iobuf ret;
+    for (auto chunk = d->next(); !chunk.empty(); chunk = d->next()) {
+        ret.append(std::move(chunk));
+    }
+    BOOST_REQUIRE(d->next().empty());
+    return ret;
+}
+
+static void roundtrip(compression::type t) {
+    for (auto size : sizes) {
+        for (auto& data :
+             {random_generators::make_iobuf(size), compressible(size)}) {
+            const auto compressed = compression::compressor::compress(data, t);
+            for (auto chunk_size : chunk_sizes) {
+                BOOST_CHECK_EQUAL(stream(compressed, t, chunk_size), data);
+            }
+        }
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(stream_gzip_test) {
+    roundtrip(compression::type::gzip);
+}
+SEASTAR_THREAD_TEST_CASE(stream_lz4_test) { roundtrip(compression::type::lz4); }
+SEASTAR_THREAD_TEST_CASE(stream_snappy_java_test) {
+    roundtrip(compression::type::snappy);
+}
+SEASTAR_THREAD_TEST_CASE(stream_zstd_test) {
+    roundtrip(compression::type::zstd);
+}
+
+SEASTAR_THREAD_TEST_CASE(stream_raw_snappy_test) {
+    // producers may send snappy without the java framing
+    const auto data = compressible(1_MiB);
+    const auto compressed = compression::snappy_standard_compressor::compress(
+      data);
+    BOOST_CHECK_EQUAL(
+      stream(compressed, compression::type::snappy, 1_MiB), data);
+}
@@ -10,6 +10,8 @@
 #include "compression/async_stream_zstd.h"
 #include "compression/internal/gzip_compressor.h"
 #include "compression/internal/lz4_frame_compressor.h"
+#include "compression/internal/snappy_java_compressor.h"
+#include "compression/internal/zstd_compressor.h"
 #include "compression/stream_zstd.h"
 #include "random/generators.h"
 #include "units.h"
@@ -144,6 +146,70 @@ PERF_TEST(gzip_10mb, uncompress) {
       10 << 20);
 }
 
+/*
+ * Small batches, where creating the codec contexts used to cost as much as
+ * compressing, the contexts are now reused across calls.
+ */
+PERF_TEST(lz4_1kb, compress) {
+    return compress_fn_test(
+      compression::internal::lz4_frame_compressor::compress, 1 << 10);
+}
+
+PERF_TEST(lz4_1kb, uncompress) {
+    return uncompress_fn_test(
+      compression::internal::lz4_frame_compressor::compress,
+      compression::internal::lz4_frame_compressor::uncompress,
+      1 << 10);
+}
+
+PERF_TEST(gzip_1kb, compress) {
+    return compress_fn_test(
+      compression::internal::gzip_compressor::compress, 1 << 10);
+}
+
+PERF_TEST(gzip_1kb, uncompress) {
+    return uncompress_fn_test(
+      compression::internal::gzip_compressor::compress,
+      compression::internal::gzip_compressor::uncompress,
+      1 << 10);
+}
+
+PERF_TEST(zstd_1kb, compress) {
+    return compress_fn_test(
+      compression::internal::zstd_compressor::compress, 1 << 10);
+}
+
+PERF_TEST(zstd_1kb, uncompress) {
+    return uncompress_fn_test(
+      compression::internal::zstd_compressor::compress,
+      compression::internal::zstd_compressor::uncompress,
+      1 << 10);
+}
+
+PERF_TEST(snappy_1kb, compress) {
+    return compress_fn_test(
+      compression::internal::snappy_java_compressor::compress, 1 << 10);
+}
+
+PERF_TEST(snappy_1kb, uncompress) {
+    return uncompress_fn_test(
+      compression::internal::snappy_java_compressor::compress,
+      compression::internal::snappy_java_compressor::uncompress,
+      1 << 10);
+}
+
+PERF_TEST(snappy_1mb, compress) {
+    return compress_fn_test(
+      compression::internal::snappy_java_compressor::compress, 1 << 20);
+}
+
+PERF_TEST(snappy_1mb, uncompress) {
+    return uncompress_fn_test(
+      compression::internal::snappy_java_compressor::compress,
+      compression::internal::snappy_java_compressor::uncompress,
+      1 << 20);
+}
+
 struct async_stream_zstd {};
 PERF_TEST_C(async_stream_zstd, 1mb_compress) {
     co_await async_compress_test(1 << 20);
@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "compression/async_stream_zstd.h"
+#include "compression/compression.h"
 #include "compression/internal/gzip_compressor.h"
 #include "compression/internal/lz4_frame_compressor.h"
 #include "compression/internal/snappy_java_compressor.h"
@@ -186,3 +187,41 @@ SEASTAR_THREAD_TEST_CASE(gzip_test) {
     using fn = compression::internal::gzip_compressor;
     roundtrip_compression(fn::compress, fn::uncompress);
 }
+
+SEASTAR_THREAD_TEST_CASE(compression_levels_test) {
+    const auto buf = gen(64_KiB);
+    for (auto t :
+         {compression::type::gzip,
+          compression::type::lz4,
+          compression::type::zstd}) {
+        for (int level : {1, 3, 9}) {
+            auto cbuf = compression::compressor::compress(buf, t, level);
+            BOOST_CHECK_EQUAL(
+              compression::compressor::uncompress(cbuf, t), buf);
+        }
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(pooled_contexts_after_error_test) {
+    // the pooled contexts are reused after a call which stopped mid stream
+    const auto buf = gen(64_KiB);
+    for (auto t :
+         {compression::type::gzip,
+          compression::type::lz4,
+          compression::type::zstd}) {
+        auto cbuf = compression::compressor::compress(buf, t);
+        auto corrupt = cbuf.copy();
+        corrupt.trim_back(corrupt.size_bytes() / 2);
+        corrupt.append(gen(1_KiB));
+        try {
+            compression::compressor::uncompress(corrupt, t);
+        } catch (const std::exception&) {
+            // not every codec detects the corruption
+        }
+        BOOST_CHECK_EQUAL(compression::compressor::uncompress(cbuf, t), buf);
+        BOOST_CHECK_EQUAL(
+          compression::compressor::uncompress(
+            compression::compressor::compress(buf, t), t),
+          buf);
+    }
+}
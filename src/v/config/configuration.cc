@@ -142,6 +142,15 @@ configuration::configuration()
       {.example = "8"},
       8,
       {.min = 8})
+  , rpc_client_connections_per_shard(
+      *this,
+      "rpc_client_connections_per_shard",
+      "The number of connections to a peer that each core spreads its raft "
+      "replication traffic over. Every raft group sticks to one of them so "
+      "that its requests are not reordered",
+      {.example = "4", .visibility = visibility::tunable},
+      1,
+      {.min = 1, .max = 128})
   , enable_coproc(*this, "enable_coproc")
   , coproc_max_inflight_bytes(*this, "coproc_max_inflight_bytes")
   , coproc_max_ingest_bytes(*this, "coproc_max_ingest_bytes")
@@ -292,12 +301,56 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       512_KiB,
       {.min = 128, .max = 5_MiB})
+  , raft_recovery_bulk_read_size(
+      *this,
+      "raft_recovery_bulk_read_size",
+      "size of reads issued during raft follower recovery when the follower "
+      "is behind by at least this many bytes, f.e. a new replica",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4_MiB,
+      {.min = 128, .max = 32_MiB})
+  , raft_recovery_read_ahead(
+      *this,
+      "raft_recovery_read_ahead",
+      "read the next range for a recovering follower while the previous one "
+      "is in flight, adapting the read size to the recovery throttle and to "
+      "the follower acknowledgement latency",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , raft_enable_lw_heartbeat(
       *this,
       "raft_enable_lw_heartbeat",
       "enables raft optimization of heartbeats",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       true)
+  , raft_group_quiescence_timeout_ms(
+      *this,
+      "raft_group_quiescence_timeout_ms",
+      "Time without writes after which a raft group whose followers are fully "
+      "caught up stops sending per group heartbeats, relying on node liveness "
+      "instead. null disables quiescence",
+      {.needs_restart = needs_restart::no,
+       .example = "30000",
+       .visibility = visibility::tunable},
+      std::nullopt,
+      {.min = 1s})
+  , raft_enable_leader_lease(
+      *this,
+      "raft_enable_leader_lease",
+      "Allow a raft leader to serve linearizable barriers without a round of "
+      "heartbeats while it holds a lease. The lease lasts for the election "
+      "timeout, less raft_leader_lease_clock_drift_ms, since a majority of "
+      "replicas acknowledged a request from the leader",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , raft_leader_lease_clock_drift_ms(
+      *this,
+      "raft_leader_lease_clock_drift_ms",
+      "Upper bound of the clock drift between replicas over an election "
+      "timeout, the raft leader lease is shortened by it",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      200ms,
+      {.min = 0ms})
   , raft_recovery_concurrency_per_shard(
       *this,
       "raft_recovery_concurrency_per_shard",
@@ -433,6 +486,32 @@ configuration::configuration()
       "partition labels.",
       {.needs_restart = needs_restart::no},
       false)
+  , aggregate_metrics_labels(
+      *this,
+      "aggregate_metrics_labels",
+      "Labels which are always aggregated on the prometheus '/metrics' "
+      "endpoint, in addition to those aggregated as per aggregate_metrics. "
+      "For example ['partition'] keeps the per topic series of the partition "
+      "metrics while reducing their cardinality.",
+      {.needs_restart = needs_restart::no},
+      {})
+  , metrics_scrape_cache_ttl_ms(
+      *this,
+      "metrics_scrape_cache_ttl_ms",
+      "How long a serialized response of the prometheus '/metrics' and "
+      "'/public_metrics' endpoints is reused for the following scrapes. "
+      "Concurrent scrapes always share a single serialization. 0 disables the "
+      "cache.",
+      {.needs_restart = needs_restart::no},
+      0ms)
+  , semaphore_wait_metrics_enabled(
+      *this,
+      "semaphore_wait_metrics_enabled",
+      "Export, per shard and semaphore name, how long the acquisitions of the "
+      "semaphores and mutexes gating shared resources waited, how many are "
+      "waiting and how many units are held.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      false)
   , group_min_session_timeout_ms(
       *this,
       "group_min_session_timeout_ms",
@@ -475,6 +554,24 @@ configuration::configuration()
       "How often the system should check for expired group offsets.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10min)
+  , group_offset_commit_coalescing_window_ms(
+      *this,
+      "group_offset_commit_coalescing_window_ms",
+      "Offset commits of the groups of a __consumer_offsets partition arriving "
+      "within this window are replicated in a single batch. 0 disables the "
+      "coalescing",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
+  , group_recovery_snapshot_interval_ms(
+      *this,
+      "group_recovery_snapshot_interval_ms",
+      "How often the group state of the __consumer_offsets partitions this "
+      "node does not lead is rebuilt in memory from the new part of the log. "
+      "Becoming the leader of a partition then only replays the log after "
+      "the last update instead of the whole log, at the cost of keeping the "
+      "state in memory. 0 disables the snapshots",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
   , legacy_group_offset_retention_enabled(
       *this,
       "legacy_group_offset_retention_enabled",
@@ -537,6 +634,48 @@ configuration::configuration()
       "wasn't reached",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       1ms)
+  , fetch_reads_wait_for_new_data(
+      *this,
+      "fetch_reads_wait_for_new_data",
+      "When a fetch request did not reach the requested min bytes, wait for "
+      "new data to become visible in any of the partitions it read nothing "
+      "from before the next read, instead of polling them",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      true)
+  , fetch_zero_copy_foreign_reads(
+      *this,
+      "fetch_zero_copy_foreign_reads",
+      "Link data read for a fetch on another shard into the response without "
+      "copying it on the connection shard. The memory is released on the "
+      "shard that read the data once the response was sent",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , fetch_response_cache_max_bytes(
+      *this,
+      "fetch_response_cache_max_bytes",
+      "Per shard memory limit of the cache of data read for fetches. Fetches "
+      "of the same partition data by many consumer groups are served from "
+      "the cache for a short time instead of reading the log again. 0 "
+      "disables the cache",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
+  , kafka_metadata_response_cache(
+      *this,
+      "kafka_metadata_response_cache",
+      "Cache the topic parts of metadata responses on every shard. The "
+      "entries of a topic are dropped when the topic or the leadership of "
+      "its partitions change",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , fetch_session_skip_idle_partitions(
+      *this,
+      "fetch_session_skip_idle_partitions",
+      "Incremental fetches only visit the session partitions that may have "
+      "new data or a changed state. Partitions a fetch found idle are watched "
+      "for new data and skipped until they get some, or for at most 10 "
+      "seconds",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , alter_topic_cfg_timeout_ms(
       *this,
       "alter_topic_cfg_timeout_ms",
@@ -734,6 +873,35 @@ configuration::configuration()
       "Use sliding window compaction.",
       {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
       true)
+  , log_compaction_max_sliding_windows(
+      *this,
+      "log_compaction_max_sliding_windows",
+      "Maximum number of consecutive sliding window compactions of a log in a "
+      "single compaction round. When a log has more keys than fit in the "
+      "compaction key-offset map, each window deduplicates the segments below "
+      "the previous one. Only respected when "
+      "`log_compaction_use_sliding_window` is true.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      8,
+      {.min = 1})
+  , log_compaction_max_concurrency(
+      *this,
+      "log_compaction_max_concurrency",
+      "Maximum number of partitions compacted concurrently on each shard. The "
+      "memory reserved for compaction key-offset maps is split evenly between "
+      "them. Partitions with the largest compaction backlog relative to their "
+      "size are compacted first.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      1,
+      {.min = 1, .max = 64})
+  , housekeeping_offload_enabled(
+      *this,
+      "housekeeping_offload_enabled",
+      "Run CPU intensive and shard independent parts of housekeeping, such as "
+      "the batch compression of compaction, on less busy shards when the "
+      "shard owning the partition is busy.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , retention_bytes(
       *this,
       "retention_bytes",
@@ -850,6 +1018,31 @@ configuration::configuration()
       "Max size of requests cached for replication",
       {.visibility = visibility::tunable},
       1_MiB)
+  , raft_replicate_batcher_max_linger_ms(
+      *this,
+      "raft_replicate_batcher_max_linger_ms",
+      "Upper bound on how long a partition leader may hold replicate requests "
+      "to coalesce them into fewer append entries requests. The actual wait "
+      "is derived from recent flush latency, 0 disables lingering",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms,
+      {.min = 0ms, .max = 100ms})
+  , raft_replication_compression(
+      *this,
+      "raft_replication_compression",
+      "Compress append entries requests carrying uncompressed batches with "
+      "zstd, followers store the original batches. Trades CPU for less "
+      "replication traffic between nodes",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , raft_replication_compression_min_bytes(
+      *this,
+      "raft_replication_compression_min_bytes",
+      "Minimum size of uncompressed batches in an append entries request for "
+      "the request to be compressed, see raft_replication_compression",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4_KiB,
+      {.min = 128, .max = 1_MiB})
   , raft_learner_recovery_rate(
       *this,
       "raft_learner_recovery_rate",
@@ -874,8 +1067,9 @@ configuration::configuration()
       "raft_max_concurrent_append_requests_per_follower",
       "Maximum number of concurrent append entries requests sent by leader to "
       "one follower",
-      {.visibility = visibility::tunable},
-      16)
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      16,
+      {.min = 1})
   , reclaim_min_size(
       *this,
       "reclaim_min_size",
@@ -906,6 +1100,14 @@ configuration::configuration()
       "Free memory limit that will be kept by batch cache background reclaimer",
       {.visibility = visibility::tunable},
       64_MiB)
+  , batch_cache_admission_filter(
+      *this,
+      "batch_cache_admission_filter",
+      "Only cache batches read from disk once they have been read repeatedly. "
+      "Prevents sequential scans of historical data from evicting batches "
+      "read by tail consumers",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      true)
   , auto_create_topics_enabled(
       *this,
       "auto_create_topics_enabled",
@@ -1011,6 +1213,64 @@ configuration::configuration()
        .example = "1",
        .visibility = visibility::tunable},
       10)
+  , storage_read_page_cache_size(
+      *this,
+      "storage_read_page_cache_size",
+      "Per-shard size in bytes of the page cache used for reading log "
+      "segments. When zero, segments are read with buffered input streams "
+      "and the page cache is disabled.",
+      {.needs_restart = needs_restart::yes,
+       .example = "268435456",
+       .visibility = visibility::tunable},
+      0)
+  , storage_read_readahead_memory(
+      *this,
+      "storage_read_readahead_memory",
+      "Per-shard memory budget in bytes for segment read-ahead buffers. "
+      "Sequential readers are granted up to storage_read_readahead_count "
+      "buffers while the budget allows.",
+      {.needs_restart = needs_restart::no,
+       .example = "67108864",
+       .visibility = visibility::tunable},
+      64_MiB)
+  , storage_max_concurrent_fsyncs(
+      *this,
+      "storage_max_concurrent_fsyncs",
+      "Maximum number of segment files fsync'd concurrently on each shard. "
+      "Flush requests for a segment waiting on this limit are coalesced into "
+      "a single fsync.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      64,
+      {.min = 1})
+  , storage_recovery_concurrency(
+      *this,
+      "storage_recovery_concurrency",
+      "Maximum number of segments opened, index files loaded or segments "
+      "replayed concurrently on each shard while partitions are recovered at "
+      "startup.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      16,
+      {.min = 1})
+  , storage_max_concurrent_stm_snapshots(
+      *this,
+      "storage_max_concurrent_stm_snapshots",
+      "Maximum number of state machine snapshots written concurrently in the "
+      "background on each shard, e.g. when many partitions roll a segment at "
+      "once. Snapshot requests of a state machine waiting on this limit are "
+      "coalesced into a single snapshot.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      8,
+      {.min = 1})
+  , segment_index_resident_stride(
+      *this,
+      "segment_index_resident_stride",
+      "Keep only every Nth entry of a segment index loaded from disk in "
+      "memory; the others are read from the index file when needed. A value "
+      "of 1 keeps the whole index resident. Applies to indices loaded after "
+      "the change.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      8,
+      {.min = 1, .max = 1024})
   , segment_fallocation_step(
       *this,
       "segment_fallocation_step",
@@ -1130,6 +1390,17 @@ configuration::configuration()
       "touching the log until the batch is exhausted.",
       {.visibility = visibility::tunable},
       1000)
+  , id_allocator_node_cache_size(
+      *this,
+      "id_allocator_node_cache_size",
+      "Number of consecutive producer ids each shard reserves from the id "
+      "allocator at once, then serves locally without a round trip to the "
+      "leader of the id allocator partition. The next range is reserved in "
+      "the background once a fifth of the range is left. 1 disables the "
+      "cache.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      100,
+      {.min = 1})
   , enable_sasl(
       *this,
       "enable_sasl",
@@ -1213,6 +1484,14 @@ configuration::configuration()
       "Interval between iterations of controller backend housekeeping loop",
       {.visibility = visibility::tunable},
       1s)
+  , controller_backend_reconciliation_concurrency(
+      *this,
+      "controller_backend_reconciliation_concurrency",
+      "Maximum number of partitions reconciled concurrently by the controller "
+      "backend on each shard",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1024,
+      {.min = 1, .max = 16384})
   , node_management_operation_timeout_ms(
       *this,
       "node_management_operation_timeout_ms",
@@ -1247,6 +1526,69 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       {},
       &validate_non_empty_string_vec)
+  , kafka_produce_validation_on_partition_shard(
+      *this,
+      "kafka_produce_validation_on_partition_shard",
+      "Verify the CRC and records of produced batches on the core handling "
+      "the partition instead of the core handling the client connection",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      true)
+  , kafka_produce_recompression(
+      *this,
+      "kafka_produce_recompression",
+      "Transcode the produced batches to the compression type of their topic "
+      "when it is not the one of the producer, before appending them",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      true)
+  , kafka_produce_recompression_memory(
+      *this,
+      "kafka_produce_recompression_memory",
+      "Bytes of produced batches being transcoded at once per core, produce "
+      "requests wait past it",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      32_MiB)
+  , kafka_max_pipelined_requests_per_connection(
+      *this,
+      "kafka_max_pipelined_requests_per_connection",
+      "Maximum number of requests in flight on a connection when read only "
+      "requests, such as fetch and metadata, are pipelined: the next requests "
+      "are read and executed while they run, and responses are still sent in "
+      "request order. 0 disables pipelining. Applies to new connections",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
+  , kafka_connection_memory_budget(
+      *this,
+      "kafka_connection_memory_budget",
+      "Most memory in bytes the requests in flight on a connection may hold. "
+      "A connection over its budget stops reading requests until its "
+      "requests complete, instead of waiting for the memory of the core "
+      "ahead of other connections. Unset for no per connection budget. "
+      "Applies to new connections",
+      {.needs_restart = needs_restart::no,
+       .example = "16777216",
+       .visibility = visibility::tunable},
+      std::nullopt,
+      {.min = 1_MiB})
+  , kafka_principal_memory_budget(
+      *this,
+      "kafka_principal_memory_budget",
+      "Most memory in bytes the requests in flight of the connections of an "
+      "authenticated principal may hold on a core. Connections of a principal "
+      "over its budget stop reading requests until its requests complete. "
+      "Unset for no per principal budget",
+      {.needs_restart = needs_restart::no,
+       .example = "67108864",
+       .visibility = visibility::tunable},
+      std::nullopt,
+      {.min = 1_MiB})
+  , kafka_request_trace_sample_interval(
+      *this,
+      "kafka_request_trace_sample_interval",
+      "Trace one in this many Kafka requests on each core: the time spent in "
+      "each stage of a traced request, on the shards that ran it, is kept "
+      "for the admin API. 0 disables tracing",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , compaction_ctrl_update_interval_ms(
       *this,
       "compaction_ctrl_update_interval_ms",
@@ -1292,6 +1634,49 @@ configuration::configuration()
       "target compaction backlog would be equal to ",
       {.visibility = visibility::tunable},
       std::nullopt)
+  , kafka_produce_latency_p99_target_ms(
+      *this,
+      "kafka_produce_latency_p99_target_ms",
+      "Target p99 latency of produce requests. When set, the CPU shares of "
+      "the requests are raised while the latency is above the target, and "
+      "lowered in favor of a compaction or upload backlog while it is well "
+      "below.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
+  , kafka_fetch_latency_p99_target_ms(
+      *this,
+      "kafka_fetch_latency_p99_target_ms",
+      "Target p99 latency of a fetch planning and execution, which excludes "
+      "the time waiting for data. When set, the CPU shares of fetches are "
+      "raised while the latency is above the target, and lowered in favor of "
+      "a compaction or upload backlog while it is well below.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
+  , kafka_sched_ctrl_update_interval_ms(
+      *this,
+      "kafka_sched_ctrl_update_interval_ms",
+      "Interval between updates of the CPU shares of kafka requests from "
+      "their latency targets",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1s)
+  , kafka_sched_ctrl_max_step(
+      *this,
+      "kafka_sched_ctrl_max_step",
+      "Maximum change of the CPU shares of kafka requests per update",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      100)
+  , kafka_sched_ctrl_min_shares(
+      *this,
+      "kafka_sched_ctrl_min_shares",
+      "Minimum CPU shares of kafka requests set from their latency targets",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      500)
+  , kafka_sched_ctrl_max_shares(
+      *this,
+      "kafka_sched_ctrl_max_shares",
+      "Maximum CPU shares of kafka requests set from their latency targets",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4000)
   , members_backend_retry_ms(
       *this,
       "members_backend_retry_ms",
@@ -1321,6 +1706,42 @@ configuration::configuration()
        .visibility = visibility::user},
       {},
       validate_connection_rate)
+  , kafka_connection_balancing_enabled(
+      *this,
+      "kafka_connection_balancing_enabled",
+      "Close the busiest idle Kafka connection of the cores that serve much "
+      "more traffic than the average core. The client reconnects and its "
+      "connection is placed on the core with fewest connections",
+      {.needs_restart = needs_restart::no,
+       .example = "true",
+       .visibility = visibility::tunable},
+      false)
+  , kafka_connection_balancing_interval_ms(
+      *this,
+      "kafka_connection_balancing_interval_ms",
+      "Interval between comparisons of the traffic of the cores, at most one "
+      "connection per core is closed at each of them",
+      {.needs_restart = needs_restart::no,
+       .visibility = visibility::tunable},
+      30s)
+  , kafka_connection_balancing_imbalance_threshold(
+      *this,
+      "kafka_connection_balancing_imbalance_threshold",
+      "Fraction by which the bytes per second of a core exceed the average "
+      "core before one of its connections is closed",
+      {.needs_restart = needs_restart::no,
+       .example = "0.5",
+       .visibility = visibility::tunable},
+      0.5,
+      {.min = 0.1, .max = 10.0})
+  , kafka_connection_balancing_min_idle_ms(
+      *this,
+      "kafka_connection_balancing_min_idle_ms",
+      "Time without requests nor responses after which a connection can be "
+      "closed by connection balancing",
+      {.needs_restart = needs_restart::no,
+       .visibility = visibility::tunable},
+      1s)
   , kafka_client_group_byte_rate_quota(
       *this,
       "kafka_client_group_byte_rate_quota",
@@ -1369,6 +1790,36 @@ configuration::configuration()
       // permit setting a max below the min).  The maximum is set to forbid
       // contiguous allocations beyond that size.
       {.min = 512, .max = 512_KiB, .align = 4_KiB})
+  , kafka_rpc_server_stream_recv_buf_min(
+      *this,
+      "kafka_rpc_server_stream_recv_buf_min",
+      "Userspace receive buffer size in bytes a connection starts with and "
+      "shrinks down to while it receives little data. Every connection holds "
+      "a buffer of its current size while waiting for a request, a small "
+      "value reduces the memory of idle connections",
+      {.example = "1024", .visibility = visibility::tunable},
+      std::nullopt,
+      {.min = 512, .max = 128_KiB, .align = 512})
+      *this,
+      "kafka_rpc_server_stream_send_buf",
+      "Userspace send buffer size in bytes. On TLS listeners this is the most "
+      "plaintext encrypted by a single write to the session, a multiple of "
+      "the 16KiB TLS record payload avoids sending partial records",
+      {.example = "65536", .visibility = visibility::tunable},
+      std::nullopt,
+      {.min = 4_KiB, .max = 512_KiB, .align = 4_KiB})
+  , kafka_rpc_server_output_cork_us(
+      *this,
+      "kafka_rpc_server_output_cork_us",
+      "Time in microseconds a Kafka connection waits before flushing a "
+      "response written while no other response is being written. Responses "
+      "written during the wait are sent with the same write call. Zero "
+      "flushes immediately",
+      {.needs_restart = needs_restart::yes,
+       .example = "100",
+       .visibility = visibility::tunable},
+      0,
+      {.min = 0, .max = 10000})
   , kafka_enable_describe_log_dirs_remote_storage(
       *this,
       "kafka_enable_describe_log_dirs_remote_storage",
@@ -1590,6 +2041,27 @@ configuration::configuration()
       "Log segment upload timeout (ms)",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       30s)
+  , cloud_storage_upload_part_size(
+      *this,
+      "cloud_storage_upload_part_size",
+      "Size of the parts of segments uploaded with multipart uploads. Only "
+      "used when `cloud_storage_max_upload_parts_in_flight` is greater than "
+      "1.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      64_MiB,
+      {.min = 5_MiB})
+  , cloud_storage_max_upload_parts_in_flight(
+      *this,
+      "cloud_storage_max_upload_parts_in_flight",
+      "Maximum number of parts of a segment uploaded concurrently. Segments "
+      "larger than `cloud_storage_upload_part_size` are uploaded in parts "
+      "when this is greater than 1, a failed part is uploaded again without "
+      "resending the rest of the segment. Every part in flight is buffered in "
+      "memory and uses a connection from the pool. A value of 1 uploads "
+      "segments with a single request.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1,
+      {.min = 1})
   , cloud_storage_manifest_upload_timeout_ms(
       *this,
       "cloud_storage_manifest_upload_timeout_ms",
@@ -1778,6 +2250,34 @@ configuration::configuration()
       "orphaned in the cloud and will have to be removed manually",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       5000)
+  , cloud_storage_max_concurrent_segment_uploads_per_partition(
+      *this,
+      "cloud_storage_max_concurrent_segment_uploads_per_partition",
+      "The per-partition limit for the number of segments uploaded "
+      "concurrently. The metadata of the uploaded segments is replicated in "
+      "a single batch once all uploads of the group complete. Raise it for "
+      "partitions with high ingest rates if archival lags behind.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      4,
+      {.min = 1, .max = 64})
+  , cloud_storage_compress_segment_uploads(
+      *this,
+      "cloud_storage_compress_segment_uploads",
+      "Compress uncompressed data batches before uploading segments to the "
+      "cloud. The codec is taken from the compression.type property of the "
+      "topic, topics without an explicit codec are uploaded as is. The "
+      "compressed segment is held in memory until it's uploaded.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , cloud_storage_max_concurrent_recovery_downloads_per_shard(
+      *this,
+      "cloud_storage_max_concurrent_recovery_downloads_per_shard",
+      "The per-shard limit for the number of segments downloaded concurrently "
+      "while partitions are recovered from the cloud. The limit is shared by "
+      "all partitions of the shard that are being recovered.",
+      {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
+      8,
+      {.min = 1, .max = 256})
   , cloud_storage_enable_compacted_topic_reupload(
       *this,
       "cloud_storage_enable_compacted_topic_reupload",
@@ -2197,6 +2697,15 @@ configuration::configuration()
       "elapsed",
       {.visibility = visibility::tunable},
       5s)
+  , cloud_storage_cache_shard_quota_bytes(
+      *this,
+      "cloud_storage_cache_shard_quota_bytes",
+      "Space of the tiered storage cache that each shard leases in advance. "
+      "Downloads that fit in the space leased by their shard reserve it "
+      "without a call to shard 0. Leases that are not used for a while are "
+      "given back. 0 disables leases",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , cloud_storage_max_segment_readers_per_shard(
       *this,
       "cloud_storage_max_segment_readers_per_shard",
@@ -2251,6 +2760,26 @@ configuration::configuration()
       "space usage by only downloading the necessary chunk from a segment.",
       {.needs_restart = needs_restart::yes, .visibility = visibility::tunable},
       16_MiB)
+  , cloud_storage_hydration_part_size(
+      *this,
+      "cloud_storage_hydration_part_size",
+      "Size of the byte ranges downloaded concurrently when a whole segment "
+      "is hydrated. Only used when "
+      "`cloud_storage_max_hydration_parts_in_flight` is greater than 1.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      32_MiB,
+      {.min = 4_KiB})
+  , cloud_storage_max_hydration_parts_in_flight(
+      *this,
+      "cloud_storage_max_hydration_parts_in_flight",
+      "Maximum number of byte ranges of a segment downloaded concurrently "
+      "when the whole segment is hydrated. Every range takes one of the "
+      "`cloud_storage_max_concurrent_hydrations_per_shard` slots and is "
+      "buffered in memory until it is written to the cache. A value of 1 "
+      "downloads the segment with a single request.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1,
+      {.min = 1})
   , cloud_storage_hydrated_chunks_per_segment_ratio(
       *this,
       "cloud_storage_hydrated_chunks_per_segment_ratio",
@@ -2290,6 +2819,15 @@ configuration::configuration()
       "Number of chunks to prefetch ahead of every downloaded chunk",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       0)
+  , cloud_storage_chunk_read_ahead(
+      *this,
+      "cloud_storage_chunk_read_ahead",
+      "Number of chunks hydrated in the background ahead of a reader which "
+      "consumes a segment sequentially. The reader is sequential once it moves "
+      "past its first chunk. Read ahead chunks are subject to the same cache "
+      "space reservations as the chunks downloaded for readers.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , superusers(
       *this,
       "superusers",
@@ -2486,6 +3024,29 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       512,
       {.min = 1, .max = 2048})
+  , core_balancing_enabled(
+      *this,
+      "core_balancing_enabled",
+      "Move partition replicas between the cores of a node when some cores "
+      "are much busier than others",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , core_balancing_interval(
+      *this,
+      "core_balancing_interval",
+      "How often the per core utilization is sampled to balance replicas "
+      "between the cores of a node",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1min)
+  , core_balancing_imbalance_threshold(
+      *this,
+      "core_balancing_imbalance_threshold",
+      "Difference between the utilization of the busiest and the least busy "
+      "core of a node, as a fraction of the sampling interval, above which "
+      "a replica is moved between them",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0.2,
+      {.min = 0.01, .max = 1.0})
   , internal_topic_replication_factor(
       *this,
       "internal_topic_replication_factor",
@@ -2511,6 +3072,14 @@ configuration::configuration()
       "Max age of metadata cached in the health monitor of non controller node",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10s)
+  , health_monitor_full_report_interval(
+      *this,
+      "health_monitor_full_report_interval",
+      "Interval at which a node sends its full health report to the "
+      "controller leader. In between, only the partitions that changed since "
+      "the last report are sent",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      5min)
   , storage_space_alert_free_threshold_percent(
       *this,
       "storage_space_alert_free_threshold_percent",
@@ -2737,6 +3306,16 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       256,
       {.min = 0})
+  , kafka_quota_balancer_usage_forecast(
+      *this,
+      "kafka_quota_balancer_usage_forecast",
+      "Forecast the throughput of each shard with the moving average of its "
+      "throughput between the quota balancer runs. Shards do not lend the "
+      "quota they are expected to use, and the collected quota is dispensed "
+      "between shards in proportion to how much quota they lack rather than "
+      "equally.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , kafka_throughput_controlled_api_keys(
       *this,
       "kafka_throughput_controlled_api_keys",
@@ -2813,6 +3392,14 @@ configuration::configuration()
       {.needs_restart = needs_restart::yes, .visibility = visibility::user},
       0.5,
       {.min = 0.0, .max = 1.0})
+  , kafka_fetch_memory_fair_share(
+      *this,
+      "kafka_fetch_memory_fair_share",
+      "Limit each fetch reading from a shard to an equal share of the fetch "
+      "memory of the shard while other fetches read from it, so that large "
+      "fetches do not leave no memory for the small ones",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      true)
   , kafka_memory_batch_size_estimate_for_fetch(
       *this,
       "kafka_memory_batch_size_estimate_for_fetch",
@@ -2835,6 +3422,31 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       100ms,
       {.min = 1ms})
+  , cpu_profiler_continuous_enabled(
+      *this,
+      "cpu_profiler_continuous_enabled",
+      "Enables a low frequency CPU profile which runs continuously and "
+      "aggregates its samples over a rolling window, it can be downloaded in "
+      "the pprof format from the admin API",
+      {.needs_restart = needs_restart::no, .visibility = visibility::user},
+      false)
+  , cpu_profiler_continuous_sample_period_ms(
+      *this,
+      "cpu_profiler_continuous_sample_period_ms",
+      "The sample period for the continuous CPU profile. While "
+      "cpu_profiler_enabled is set, cpu_profiler_sample_period_ms applies to "
+      "both profiles",
+      {.needs_restart = needs_restart::no, .visibility = visibility::user},
+      1000ms,
+      {.min = 1ms})
+  , stall_profiler_enabled(
+      *this,
+      "stall_profiler_enabled",
+      "Aggregate the backtraces of the reactor stalls by scheduling group and "
+      "call site, see the /v1/debug/stall_profile endpoint. The stalls are "
+      "then logged by the profiler, without their duration.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::user},
+      false)
   , oidc_discovery_url(
       *this,
       "oidc_discovery_url",
@@ -60,6 +60,7 @@ struct configuration final : public config_store {
     bounded_property<std::optional<int>> rpc_server_tcp_recv_buf;
     bounded_property<std::optional<int>> rpc_server_tcp_send_buf;
     bounded_property<int> rpc_client_connections_per_peer;
+    bounded_property<int> rpc_client_connections_per_shard;
     // Coproc
     deprecated_property enable_coproc;
     deprecated_property coproc_max_inflight_bytes;
@@ -91,7 +92,14 @@ struct configuration final : public config_store {
     deprecated_property max_version;
     bounded_property<std::optional<size_t>> raft_max_recovery_memory;
     bounded_property<size_t> raft_recovery_default_read_size;
+    bounded_property<size_t> raft_recovery_bulk_read_size;
+    property<bool> raft_recovery_read_ahead;
     property<bool> raft_enable_lw_heartbeat;
+    bounded_property<std::optional<std::chrono::milliseconds>>
+      raft_group_quiescence_timeout_ms;
+    property<bool> raft_enable_leader_lease;
+    bounded_property<std::chrono::milliseconds>
+      raft_leader_lease_clock_drift_ms;
     bounded_property<size_t> raft_recovery_concurrency_per_shard;
     property<std::optional<size_t>> raft_replica_max_pending_flush_bytes;
     property<std::chrono::milliseconds> raft_flush_timer_interval_ms;
@@ -112,12 +120,18 @@ struct configuration final : public config_store {
     property<bool> disable_metrics;
     property<bool> disable_public_metrics;
     property<bool> aggregate_metrics;
+    property<std::vector<ss::sstring>> aggregate_metrics_labels;
+    property<std::chrono::milliseconds> metrics_scrape_cache_ttl_ms;
+    property<bool> semaphore_wait_metrics_enabled;
     property<std::chrono::milliseconds> group_min_session_timeout_ms;
     property<std::chrono::milliseconds> group_max_session_timeout_ms;
     property<std::chrono::milliseconds> group_initial_rebalance_delay;
     property<std::chrono::milliseconds> group_new_member_join_timeout;
     property<std::optional<std::chrono::seconds>> group_offset_retention_sec;
     property<std::chrono::milliseconds> group_offset_retention_check_ms;
+    property<std::chrono::milliseconds>
+      group_offset_commit_coalescing_window_ms;
+    property<std::chrono::milliseconds> group_recovery_snapshot_interval_ms;
     property<bool> legacy_group_offset_retention_enabled;
     property<std::chrono::milliseconds> metadata_dissemination_interval_ms;
     property<std::chrono::milliseconds> metadata_dissemination_retry_delay_ms;
@@ -131,6 +145,11 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> tx_timeout_delay_ms;
     deprecated_property rm_violation_recovery_policy;
     property<std::chrono::milliseconds> fetch_reads_debounce_timeout;
+    property<bool> fetch_reads_wait_for_new_data;
+    property<bool> fetch_zero_copy_foreign_reads;
+    property<size_t> fetch_response_cache_max_bytes;
+    property<bool> kafka_metadata_response_cache;
+    property<bool> fetch_session_skip_idle_partitions;
     property<std::chrono::milliseconds> alter_topic_cfg_timeout_ms;
     property<model::cleanup_policy_bitflags> log_cleanup_policy;
     enum_property<model::timestamp_type> log_message_timestamp_type;
@@ -159,6 +178,9 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> log_compaction_interval_ms;
     property<bool> log_disable_housekeeping_for_tests;
     property<bool> log_compaction_use_sliding_window;
+    bounded_property<size_t> log_compaction_max_sliding_windows;
+    bounded_property<size_t> log_compaction_max_concurrency;
+    property<bool> housekeeping_offload_enabled;
     // same as retention.size in kafka - TODO: size not implemented
     property<std::optional<size_t>> retention_bytes;
     property<int32_t> group_topic_partitions;
@@ -183,16 +205,22 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> replicate_append_timeout_ms;
     property<std::chrono::milliseconds> recovery_append_timeout_ms;
     property<size_t> raft_replicate_batch_window_size;
+    bounded_property<std::chrono::milliseconds>
+      raft_replicate_batcher_max_linger_ms;
+    property<bool> raft_replication_compression;
+    bounded_property<size_t> raft_replication_compression_min_bytes;
     property<size_t> raft_learner_recovery_rate;
     property<bool> raft_recovery_throttle_disable_dynamic_mode;
     property<std::optional<uint32_t>> raft_smp_max_non_local_requests;
-    property<uint32_t> raft_max_concurrent_append_requests_per_follower;
+    bounded_property<uint32_t>
+      raft_max_concurrent_append_requests_per_follower;
 
     property<size_t> reclaim_min_size;
     property<size_t> reclaim_max_size;
     property<std::chrono::milliseconds> reclaim_growth_window;
     property<std::chrono::milliseconds> reclaim_stable_window;
     property<size_t> reclaim_batch_cache_min_free;
+    property<bool> batch_cache_admission_filter;
     property<bool> auto_create_topics_enabled;
     property<bool> enable_pid_file;
     property<std::chrono::milliseconds> kvstore_flush_interval;
@@ -210,6 +238,12 @@ struct configuration final : public config_store {
     bounded_property<size_t> append_chunk_size;
     property<size_t> storage_read_buffer_size;
     property<int16_t> storage_read_readahead_count;
+    property<size_t> storage_read_page_cache_size;
+    property<size_t> storage_read_readahead_memory;
+    bounded_property<size_t> storage_max_concurrent_fsyncs;
+    bounded_property<size_t> storage_recovery_concurrency;
+    bounded_property<size_t> storage_max_concurrent_stm_snapshots;
+    bounded_property<size_t> segment_index_resident_stride;
     property<size_t> segment_fallocation_step;
     bounded_property<uint64_t> storage_target_replay_bytes;
     bounded_property<uint64_t> storage_max_concurrent_replay;
@@ -226,6 +260,7 @@ struct configuration final : public config_store {
     deprecated_property tx_registry_log_capacity;
     property<int16_t> id_allocator_log_capacity;
     property<int16_t> id_allocator_batch_size;
+    bounded_property<int16_t> id_allocator_node_cache_size;
     property<bool> enable_sasl;
     property<std::vector<ss::sstring>> sasl_mechanisms;
     property<ss::sstring> sasl_kerberos_config;
@@ -240,11 +275,19 @@ struct configuration final : public config_store {
     property<bool> kafka_enable_partition_reassignment;
     property<std::chrono::milliseconds>
       controller_backend_housekeeping_interval_ms;
+    bounded_property<size_t> controller_backend_reconciliation_concurrency;
     property<std::chrono::milliseconds> node_management_operation_timeout_ms;
     property<uint32_t> kafka_request_max_bytes;
     property<uint32_t> kafka_batch_max_bytes;
     property<std::vector<ss::sstring>> kafka_nodelete_topics;
     property<std::vector<ss::sstring>> kafka_noproduce_topics;
+    property<bool> kafka_produce_validation_on_partition_shard;
+    property<bool> kafka_produce_recompression;
+    property<size_t> kafka_produce_recompression_memory;
+    property<uint32_t> kafka_max_pipelined_requests_per_connection;
+    bounded_property<std::optional<size_t>> kafka_connection_memory_budget;
+    bounded_property<std::optional<size_t>> kafka_principal_memory_budget;
+    property<uint32_t> kafka_request_trace_sample_interval;
 
     // Compaction controller
     property<std::chrono::milliseconds> compaction_ctrl_update_interval_ms;
@@ -254,10 +297,23 @@ struct configuration final : public config_store {
     property<int16_t> compaction_ctrl_min_shares;
     property<int16_t> compaction_ctrl_max_shares;
     property<std::optional<size_t>> compaction_ctrl_backlog_size;
+    property<std::optional<std::chrono::milliseconds>>
+      kafka_produce_latency_p99_target_ms;
+    property<std::optional<std::chrono::milliseconds>>
+      kafka_fetch_latency_p99_target_ms;
+    property<std::chrono::milliseconds> kafka_sched_ctrl_update_interval_ms;
+    property<int16_t> kafka_sched_ctrl_max_step;
+    property<int16_t> kafka_sched_ctrl_min_shares;
+    property<int16_t> kafka_sched_ctrl_max_shares;
     property<std::chrono::milliseconds> members_backend_retry_ms;
     property<std::optional<uint32_t>> kafka_connections_max;
     property<std::optional<uint32_t>> kafka_connections_max_per_ip;
     property<std::vector<ss::sstring>> kafka_connections_max_overrides;
+    property<bool> kafka_connection_balancing_enabled;
+    property<std::chrono::milliseconds> kafka_connection_balancing_interval_ms;
+    bounded_property<double, numeric_bounds>
+      kafka_connection_balancing_imbalance_threshold;
+    property<std::chrono::milliseconds> kafka_connection_balancing_min_idle_ms;
     one_or_many_map_property<client_group_quota>
       kafka_client_group_byte_rate_quota;
     one_or_many_map_property<client_group_quota>
@@ -265,6 +321,10 @@ struct configuration final : public config_store {
     bounded_property<std::optional<int>> kafka_rpc_server_tcp_recv_buf;
     bounded_property<std::optional<int>> kafka_rpc_server_tcp_send_buf;
     bounded_property<std::optional<size_t>> kafka_rpc_server_stream_recv_buf;
+    bounded_property<std::optional<size_t>>
+      kafka_rpc_server_stream_recv_buf_min;
+    bounded_property<std::optional<size_t>> kafka_rpc_server_stream_send_buf;
+    bounded_property<uint32_t> kafka_rpc_server_output_cork_us;
     property<bool> kafka_enable_describe_log_dirs_remote_storage;
 
     // Audit logging
@@ -302,6 +362,8 @@ struct configuration final : public config_store {
     property<std::optional<ss::sstring>> cloud_storage_trust_file;
     property<std::chrono::milliseconds> cloud_storage_initial_backoff_ms;
     property<std::chrono::milliseconds> cloud_storage_segment_upload_timeout_ms;
+    bounded_property<uint64_t> cloud_storage_upload_part_size;
+    bounded_property<uint16_t> cloud_storage_max_upload_parts_in_flight;
     property<std::chrono::milliseconds>
       cloud_storage_manifest_upload_timeout_ms;
     property<std::chrono::milliseconds>
@@ -338,6 +400,11 @@ struct configuration final : public config_store {
     property<bool> disable_cluster_recovery_loop_for_tests;
     property<bool> enable_cluster_metadata_upload_loop;
     property<size_t> cloud_storage_max_segments_pending_deletion_per_partition;
+    bounded_property<size_t>
+      cloud_storage_max_concurrent_segment_uploads_per_partition;
+    property<bool> cloud_storage_compress_segment_uploads;
+    bounded_property<size_t>
+      cloud_storage_max_concurrent_recovery_downloads_per_shard;
     property<bool> cloud_storage_enable_compacted_topic_reupload;
     property<size_t> cloud_storage_recovery_temporary_retention_bytes_default;
     property<std::optional<size_t>> cloud_storage_segment_size_target;
@@ -403,6 +470,7 @@ struct configuration final : public config_store {
       cloud_storage_cache_size_percent;
     property<uint32_t> cloud_storage_cache_max_objects;
     property<std::chrono::milliseconds> cloud_storage_cache_check_interval_ms;
+    property<uint64_t> cloud_storage_cache_shard_quota_bytes;
     property<std::optional<uint32_t>>
       cloud_storage_max_segment_readers_per_shard;
     property<std::optional<uint32_t>>
@@ -412,12 +480,15 @@ struct configuration final : public config_store {
     property<std::optional<uint32_t>>
       cloud_storage_max_materialized_segments_per_shard;
     property<uint64_t> cloud_storage_cache_chunk_size;
+    bounded_property<uint64_t> cloud_storage_hydration_part_size;
+    bounded_property<uint16_t> cloud_storage_max_hydration_parts_in_flight;
     property<double> cloud_storage_hydrated_chunks_per_segment_ratio;
     property<uint64_t> cloud_storage_min_chunks_per_segment_threshold;
     property<bool> cloud_storage_disable_chunk_reads;
     enum_property<model::cloud_storage_chunk_eviction_strategy>
       cloud_storage_chunk_eviction_strategy;
     property<uint16_t> cloud_storage_chunk_prefetch;
+    property<uint16_t> cloud_storage_chunk_read_ahead;
 
     one_or_many_property<ss::sstring> superusers;
 
@@ -456,12 +527,17 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> leader_balancer_mute_timeout;
     property<std::chrono::milliseconds> leader_balancer_node_mute_timeout;
     bounded_property<size_t> leader_balancer_transfer_limit_per_shard;
+    property<bool> core_balancing_enabled;
+    property<std::chrono::milliseconds> core_balancing_interval;
+    bounded_property<double, numeric_bounds>
+      core_balancing_imbalance_threshold;
     property<int> internal_topic_replication_factor;
     property<std::chrono::milliseconds> health_manager_tick_interval;
 
     // health monitor
     property<std::chrono::milliseconds> health_monitor_tick_interval;
     property<std::chrono::milliseconds> health_monitor_max_metadata_age;
+    property<std::chrono::milliseconds> health_monitor_full_report_interval;
     bounded_property<unsigned> storage_space_alert_free_threshold_percent;
     bounded_property<size_t> storage_space_alert_free_threshold_bytes;
     bounded_property<size_t> storage_min_free_bytes;
@@ -511,6 +587,7 @@ struct configuration final : public config_store {
       kafka_quota_balancer_node_period;
     property<double> kafka_quota_balancer_min_shard_throughput_ratio;
     bounded_property<int64_t> kafka_quota_balancer_min_shard_throughput_bps;
+    property<bool> kafka_quota_balancer_usage_forecast;
     property<std::vector<ss::sstring>> kafka_throughput_controlled_api_keys;
     property<std::vector<throughput_control_group>> kafka_throughput_control;
 
@@ -527,10 +604,15 @@ struct configuration final : public config_store {
     config::property<size_t> kafka_schema_id_validation_cache_capacity;
 
     bounded_property<double, numeric_bounds> kafka_memory_share_for_fetch;
+    property<bool> kafka_fetch_memory_fair_share;
     property<size_t> kafka_memory_batch_size_estimate_for_fetch;
     // debug controls
     property<bool> cpu_profiler_enabled;
     bounded_property<std::chrono::milliseconds> cpu_profiler_sample_period_ms;
+    property<bool> cpu_profiler_continuous_enabled;
+    bounded_property<std::chrono::milliseconds>
+      cpu_profiler_continuous_sample_period_ms;
+    property<bool> stall_profiler_enabled;
 
     // oidc authentication
     property<ss::sstring> oidc_discovery_url;
@@ -28,6 +28,8 @@
 #include <chrono>
 #include <functional>
 #include <optional>
+#include <string_view>
+#include <vector>
 
 namespace config {
 
@@ -68,6 +70,98 @@ public:
     legacy_version max_original_version;
 };
 
+/**
+ * Non-template part of the bindings, for the callbacks deferred by a
+ * notification_batch.
+ */
+class deferred_notification {
+public:
+    deferred_notification() = default;
+    deferred_notification(const deferred_notification&) noexcept {}
+    deferred_notification& operator=(const deferred_notification&) noexcept {
+        return *this;
+    }
+    // Steals the pending callback of the moved-from binding
+    deferred_notification(deferred_notification&& rhs) noexcept {
+        _pending_hook.swap_nodes(rhs._pending_hook);
+    }
+    virtual ~deferred_notification() = default;
+
+private:
+    friend class notification_batch;
+
+    virtual void notify() = 0;
+    virtual std::string_view property_name() const = 0;
+
+    // Unlinked on destruction, a binding destroyed while its callback is
+    // pending is skipped
+    intrusive_list_hook _pending_hook;
+};
+
+/**
+ * While an instance is alive, the on_change callbacks of the bindings of this
+ * shard are deferred until flush(): a batch of properties is set before any
+ * callback runs, so that a callback which reads other properties sees the
+ * whole batch, and each callback runs once per batch.
+ *
+ * Batches may be nested, the callbacks run when the outermost one is flushed
+ * or destroyed.
+ */
+class notification_batch {
+public:
+    notification_batch() noexcept { ++_depth; }
+    notification_batch(const notification_batch&) = delete;
+    notification_batch& operator=(const notification_batch&) = delete;
+    notification_batch(notification_batch&&) = delete;
+    notification_batch& operator=(notification_batch&&) = delete;
+
+    ~notification_batch() {
+        if (_depth == 1) {
+            run_pending();
+        }
+        --_depth;
+    }
+
+    /// Runs the deferred callbacks if this is the outermost batch. Returns
+    /// the names of the properties whose callbacks threw.
+    std::vector<std::string_view> flush() {
+        if (_depth != 1) {
+            return {};
+        }
+        return run_pending();
+    }
+
+    static bool active() { return _depth > 0; }
+
+    static void defer(deferred_notification& n) {
+        if (!n._pending_hook.is_linked()) {
+            _pending.push_back(n);
+        }
+    }
+
+private:
+    static std::vector<std::string_view> run_pending() {
+        std::vector<std::string_view> failed;
+        // Callbacks deferred by the callbacks are run in turn
+        while (!_pending.empty()) {
+            auto& n = _pending.front();
+            _pending.pop_front();
+            try {
+                n.notify();
+            } catch (...) {
+                failed.push_back(n.property_name());
+            }
+        }
+        return failed;
+    }
+
+    static inline thread_local int _depth{0};
+    static inline thread_local intrusive_list<
+      deferred_notification,
+      &deferred_notification::_pending_hook>
+      _pending;
+};
+
 template<class T>
 class property : public base_property {
 public:
@@ -295,7 +389,7 @@ private:
 };
 
 template<class T>
-class binding_base {
+class binding_base : public deferred_notification {
     property<T>* _parent{nullptr};
     intrusive_list_hook _hook;
     std::optional<std::function<void()>> _on_change;
@@ -347,7 +441,8 @@ protected:
      * after startup time.
      */
     binding_base(binding_base&& rhs) noexcept
-      : _parent(rhs._parent)
+      : deferred_notification(std::move(rhs))
+      , _parent(rhs._parent)
       , _on_change(std::move(rhs._on_change)) {
         if (_parent) {
             // May not move between shards, parent is
@@ -391,10 +486,24 @@ private:
         oncore_debug_verify(_verify_shard);
         const bool changed = do_update(v);
         if (changed && _on_change.has_value()) {
+            if (notification_batch::active()) {
+                notification_batch::defer(*this);
+            } else {
+                _on_change.value()();
+            }
+        }
+    }
+
+    void notify() final {
+        if (_on_change.has_value()) {
             _on_change.value()();
         }
     }
 
+    std::string_view property_name() const final {
+        return _parent ? _parent->name() : std::string_view{};
+    }
+
     // override interface
 protected:
     /// Apply the updated property value to the binding, return true if
@@ -501,6 +501,63 @@ SEASTAR_THREAD_TEST_CASE(property_conversion_bind) {
     BOOST_TEST(watch_count == 6);
 }
 
+SEASTAR_THREAD_TEST_CASE(property_bind_batch) {
+    auto cfg = test_config();
+    auto bool_binding = cfg.boolean.bind();
+    auto str_binding = cfg.required_string.bind();
+
+    int watch_count = 0;
+    ss::sstring seen_string;
+    bool_binding.watch([&]() {
+        ++watch_count;
+        seen_string = cfg.required_string();
+    });
+    str_binding.watch([&watch_count]() { ++watch_count; });
+
+    {
+        config::notification_batch batch;
+        cfg.boolean.set_value(true);
+        cfg.required_string.set_value(ss::sstring("newvalue"));
+        cfg.boolean.set_value(false);
+        cfg.boolean.set_value(true);
+        // The values are set, the callbacks are deferred
+        BOOST_TEST(bool_binding() == true);
+        BOOST_TEST(str_binding() == "newvalue");
+        BOOST_TEST(watch_count == 0);
+
+        // Once per binding, after the whole batch is set
+        BOOST_TEST(batch.flush().empty());
+        BOOST_TEST(watch_count == 2);
+        BOOST_TEST(seen_string == "newvalue");
+    }
+
+    // The failures of the callbacks are reported by property
+    str_binding.watch([]() { throw std::runtime_error("watch"); });
+    {
+        config::notification_batch batch;
+        cfg.required_string.set_value(ss::sstring("newvalue2"));
+        auto failed = batch.flush();
+        BOOST_REQUIRE_EQUAL(failed.size(), 1);
+        BOOST_TEST(failed[0] == "required_string");
+    }
+
+    // A binding destroyed before the batch is flushed is skipped
+    {
+        config::notification_batch batch;
+        {
+            auto tmp_binding = cfg.boolean.bind();
+            tmp_binding.watch([&watch_count]() { ++watch_count; });
+            cfg.boolean.set_value(false);
+        }
+        batch.flush();
+        BOOST_TEST(watch_count == 3);
+    }
+
+    // Not deferred outside of a batch
+    cfg.boolean.set_value(true);
+    BOOST_TEST(watch_count == 4);
+}
+
 SEASTAR_THREAD_TEST_CASE(property_aliasing) {
     auto cfg = test_config();
 
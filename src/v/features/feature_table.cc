@@ -97,6 +97,12 @@ std::string_view to_string_view(feature f) {
         return "cloud_metadata_cluster_recovery";
     case feature::audit_logging:
         return "audit_logging";
+    case feature::kvstore_incremental_snapshots:
+        return "kvstore_incremental_snapshots";
+    case feature::compact_offset_translator_map:
+        return "compact_offset_translator_map";
+    case feature::raft_quiescent_groups:
+        return "raft_quiescent_groups";
 
     /*
      * testing features
@@ -388,8 +394,9 @@ void feature_table::bootstrap_original_version(cluster_version v) {
  * Update any watchers, update bitmask
  */
 void feature_table::on_update() {
-    // Update mask for fast is_active() lookup
+    // Update masks for fast is_active() and is_preparing() lookups
     _active_features_mask = 0x0;
+    _preparing_features_mask = 0x0;
     for (const auto& fs : _feature_state) {
         if (fs.get_state() == feature_state::state::active) {
             _active_features_mask |= uint64_t(fs.spec.bits);
@@ -400,6 +407,7 @@ void feature_table::on_update() {
             // to go to 'preparing' and we don't want to wait forever.
             _waiters_preparing.notify(fs.spec.bits);
         } else if (fs.get_state() == feature_state::state::preparing) {
+            _preparing_features_mask |= uint64_t(fs.spec.bits);
             _waiters_preparing.notify(fs.spec.bits);
         }
     }
@@ -73,6 +73,9 @@ enum class feature : std::uint64_t {
     disabling_partitions = 1ULL << 39U,
     cloud_metadata_cluster_recovery = 1ULL << 40U,
     audit_logging = 1ULL << 41U,
+    kvstore_incremental_snapshots = 1ULL << 42U,
+    compact_offset_translator_map = 1ULL << 43U,
+    raft_quiescent_groups = 1ULL << 44U,
 
     // Dummy features for testing only
     test_alpha = 1ULL << 61U,
@@ -363,6 +366,24 @@ constexpr static std::array feature_schema{
     "audit_logging",
     feature::audit_logging,
     feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "kvstore_incremental_snapshots",
+    feature::kvstore_incremental_snapshots,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "compact_offset_translator_map",
+    feature::compact_offset_translator_map,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{11},
+    "raft_quiescent_groups",
+    feature::raft_quiescent_groups,
+    feature_spec::available_policy::always,
     feature_spec::prepare_policy::always}};
 
 std::string_view to_string_view(feature);
@@ -410,7 +431,7 @@ public:
      * RPC to the controller leader
      */
     bool is_preparing(feature f) const noexcept {
-        return get_state(f).get_state() == feature_state::state::preparing;
+        return (uint64_t(f) & _preparing_features_mask) != 0;
     }
 
     ss::future<> await_feature(feature f, ss::abort_source& as);
@@ -570,6 +591,7 @@ private:
     // Bitmask only used at runtime: if we run out of bits for features
     // just use a bigger one.  Do not serialize this as a bitmask anywhere.
     uint64_t _active_features_mask{0};
+    uint64_t _preparing_features_mask{0};
 
     // Waiting for a particular feature to be active
     waiter_queue<feature> _waiters_active;
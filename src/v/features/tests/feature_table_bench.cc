@@ -0,0 +1,62 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "features/feature_table.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <vector>
+
+struct feature_table_bench {
+    static constexpr size_t lookups = 10'000;
+
+    feature_table_bench() {
+        table.testing_activate_all();
+        const auto& states = table.get_feature_state();
+        targets.reserve(lookups);
+        for (size_t i = 0; i < lookups; ++i) {
+            targets.push_back(states[i % states.size()].spec.bits);
+        }
+    }
+
+    features::feature_table table;
+    std::vector<features::feature> targets;
+};
+
+PERF_TEST_F(feature_table_bench, is_active) {
+    perf_tests::start_measuring_time();
+    for (auto f : targets) {
+        perf_tests::do_not_optimize(table.is_active(f));
+    }
+    perf_tests::stop_measuring_time();
+    return targets.size();
+}
+
+PERF_TEST_F(feature_table_bench, is_preparing) {
+    perf_tests::start_measuring_time();
+    for (auto f : targets) {
+        perf_tests::do_not_optimize(table.is_preparing(f));
+    }
+    perf_tests::stop_measuring_time();
+    return targets.size();
+}
+
+// The lookup of the state of a feature, that is_preparing() did before
+PERF_TEST_F(feature_table_bench, get_state) {
+    perf_tests::start_measuring_time();
+    for (auto f : targets) {
+        const auto& state = table.get_state(f);
+        perf_tests::do_not_optimize(
+          state.get_state() == features::feature_state::state::preparing);
+    }
+    perf_tests::stop_measuring_time();
+    return targets.size();
+}
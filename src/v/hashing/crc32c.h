@@ -14,10 +14,74 @@
 
 #include <crc32c/crc32c.h>
 
+#include <array>
+#include <cstdint>
 #include <type_traits>
 
 namespace crc {
 
+namespace detail {
+
+// the castagnoli polynomial, reflected
+constexpr uint32_t crc32c_poly = 0x82f63b78;
+
+// a * b modulo the polynomial, a must not be zero
+constexpr uint32_t crc32c_multmodp(uint32_t a, uint32_t b) {
+    uint32_t m = uint32_t(1) << 31;
+    uint32_t p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0) {
+                break;
+            }
+        }
+        m >>= 1;
+        b = b & 1 ? (b >> 1) ^ crc32c_poly : b >> 1;
+    }
+    return p;
+}
+
+// x^(2^k) modulo the polynomial, for k in [0, 32)
+constexpr std::array<uint32_t, 32> crc32c_x2n_table = [] {
+    std::array<uint32_t, 32> table{};
+    uint32_t p = uint32_t(1) << 30; // x^1
+    table[0] = p;
+    for (size_t k = 1; k < table.size(); ++k) {
+        p = crc32c_multmodp(p, p);
+        table[k] = p;
+    }
+    return table;
+}();
+
+// x^(n * 2^k) modulo the polynomial
+constexpr uint32_t crc32c_x2nmodp(uint64_t n, unsigned k) {
+    uint32_t p = uint32_t(1) << 31; // x^0
+    while (n) {
+        if (n & 1) {
+            p = crc32c_multmodp(crc32c_x2n_table[k & 31], p);
+        }
+        n >>= 1;
+        k++;
+    }
+    return p;
+}
+
+} // namespace detail
+
+/**
+ * Returns the crc32c of the concatenation of two buffers, given their crcs
+ * and the size of the second one. The cost is logarithmic in the size, so
+ * the crcs of the parts of large data can be computed independently, e.g.
+ * in parallel, and combined.
+ */
+constexpr uint32_t
+crc32c_combine(uint32_t crc1, uint32_t crc2, size_t size2) {
+    // the crc of the first buffer is shifted by the size of the second one
+    return detail::crc32c_multmodp(detail::crc32c_x2nmodp(size2, 3), crc1)
+           ^ crc2;
+}
+
 class crc32c {
 public:
     template<typename T, typename = std::enable_if_t<std::is_integral_v<T>, T>>
@@ -35,6 +99,11 @@ public:
           size);
     }
 
+    /// Extends the crc with \p other, computed over the next \p size bytes
+    void combine(const crc32c& other, size_t size) {
+        _crc = crc32c_combine(_crc, other._crc, size);
+    }
+
     uint32_t value() const { return _crc; }
 
 private:
@@ -43,11 +112,12 @@ private:
 
 } // namespace crc
 
+/*
+ * The fragments are hashed with ::crc32c::Extend, which already interleaves
+ * three streams with the SSE4.2 or ARMv8 crc instructions for large inputs.
+ */
 inline void crc_extend_iobuf(crc::crc32c& crc, const iobuf& buf) {
-    auto in = iobuf::iterator_consumer(buf.cbegin(), buf.cend());
-    (void)in.consume(buf.size_bytes(), [&crc](const char* src, size_t sz) {
-        // NOLINTNEXTLINE
-        crc.extend(reinterpret_cast<const uint8_t*>(src), sz);
-        return ss::stop_iteration::no;
-    });
+    for (const auto& frag : buf) {
+        crc.extend(frag.get(), frag.size());
+    }
 }
@@ -0,0 +1,65 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#define BOOST_TEST_MODULE crc32c
+#include "bytes/iobuf.h"
+#include "hashing/crc32c.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <string_view>
+
+namespace {
+constexpr std::string_view text
+  = "Combining the crcs of two buffers gives the crc of their concatenation";
+
+uint32_t crc_of(std::string_view s) {
+    crc::crc32c crc;
+    crc.extend(s.data(), s.size());
+    return crc.value();
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(crc32c_check_value) {
+    BOOST_REQUIRE_EQUAL(crc_of("123456789"), 0xe3069283);
+}
+
+BOOST_AUTO_TEST_CASE(crc32c_combine_any_split) {
+    const auto expected = crc_of(text);
+    for (size_t i = 0; i <= text.size(); ++i) {
+        auto first = text.substr(0, i);
+        auto second = text.substr(i);
+        BOOST_REQUIRE_EQUAL(
+          crc::crc32c_combine(crc_of(first), crc_of(second), second.size()),
+          expected);
+
+        crc::crc32c crc;
+        crc.extend(first.data(), first.size());
+        crc::crc32c other;
+        other.extend(second.data(), second.size());
+        crc.combine(other, second.size());
+        BOOST_REQUIRE_EQUAL(crc.value(), expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(crc32c_extend_iobuf_fragments) {
+    iobuf buf;
+    size_t pos = 0;
+    // fragments of increasing sizes
+    for (size_t size = 1; pos < text.size(); ++size) {
+        auto part = text.substr(pos, size);
+        buf.append(ss::temporary_buffer<char>(part.data(), part.size()));
+        pos += part.size();
+    }
+    BOOST_REQUIRE_GT(std::distance(buf.begin(), buf.end()), 1);
+
+    crc::crc32c crc;
+    crc_extend_iobuf(crc, buf);
+    BOOST_REQUIRE_EQUAL(crc.value(), crc_of(text));
+}
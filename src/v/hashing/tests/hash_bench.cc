@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "bytes/iobuf.h"
 #include "hashing/crc32c.h"
 #include "hashing/fnv.h"
 #include "hashing/twang.h"
@@ -129,6 +130,58 @@ PERF_TEST(header_hash, crc32_fn) {
     });
 }
 
+static constexpr size_t iobuf_bytes = 1024 * 1024;
+
+// crc of a 1MiB iobuf made of fragments of the given size
+template<typename F>
+static size_t iobuf_crc_body(size_t fragment_size, F f) {
+    auto data = random_generators::gen_alphanum_string(fragment_size);
+    iobuf buf;
+    while (buf.size_bytes() < iobuf_bytes) {
+        iobuf frag;
+        frag.append(ss::temporary_buffer<char>(data.data(), data.size()));
+        buf.append_fragments(std::move(frag));
+    }
+    perf_tests::start_measuring_time();
+    auto crc = f(buf);
+    perf_tests::do_not_optimize(crc);
+    perf_tests::stop_measuring_time();
+    return buf.size_bytes();
+}
+
+static uint32_t crc_iobuf_extend(const iobuf& buf) {
+    crc::crc32c crc;
+    crc_extend_iobuf(crc, buf);
+    return crc.value();
+}
+
+// the fragments are hashed independently and combined
+static uint32_t crc_iobuf_combine(const iobuf& buf) {
+    crc::crc32c crc;
+    for (const auto& frag : buf) {
+        crc::crc32c frag_crc;
+        frag_crc.extend(frag.get(), frag.size());
+        crc.combine(frag_crc, frag.size());
+    }
+    return crc.value();
+}
+
+PERF_TEST(iobuf_crc32c, extend_4k_fragments) {
+    return iobuf_crc_body(4096, crc_iobuf_extend);
+}
+
+PERF_TEST(iobuf_crc32c, combine_4k_fragments) {
+    return iobuf_crc_body(4096, crc_iobuf_combine);
+}
+
+PERF_TEST(iobuf_crc32c, extend_128k_fragments) {
+    return iobuf_crc_body(128 * 1024, crc_iobuf_extend);
+}
+
+PERF_TEST(iobuf_crc32c, combine_128k_fragments) {
+    return iobuf_crc_body(128 * 1024, crc_iobuf_combine);
+}
+
 PERF_TEST(header_hash, xx32_fn) {
     return header_body(
       [](auto& buffer) { return xxhash_32(buffer.data(), buffer.size()); });
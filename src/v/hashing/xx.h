@@ -26,6 +26,11 @@ inline uint32_t xxhash_32(const unsigned char* data, size_t length) {
     return XXH32(data, length, 0);
 }
 
+inline XXH128_hash_t
+xxhash_128(const char* data, size_t length, uint64_t seed = 0) {
+    return XXH3_128bits_withSeed(data, length, seed);
+}
+
 inline uint64_t xxhash_64(const char* data, const size_t& length) {
     return XXH64(data, length, 0);
 }
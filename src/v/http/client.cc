@@ -99,6 +99,7 @@ ss::future<client::request_response_t> client::make_request(
         if (age < _max_idle_time) {
             // Reuse connection
             vlog(ctxlog.debug, "reusing connection, age {}", age.count());
+            _probe->register_connection_reuse();
             return ss::make_ready_future<request_response_t>(
               std::make_tuple(req, res));
         } else {
@@ -110,7 +111,7 @@ ss::future<client::request_response_t> client::make_request(
         }
     }
     return get_connected(timeout, ctxlog)
-      .then([req, res, target, ctxlog](reconnect_result_t r) {
+      .then([this, req, res, target, ctxlog](reconnect_result_t r) {
           if (r == reconnect_result_t::timed_out) {
               vlog(
                 ctxlog.warn,
@@ -119,6 +120,7 @@ ss::future<client::request_response_t> client::make_request(
               ss::timed_out_error err;
               return ss::make_exception_future<client::request_response_t>(err);
           }
+          _probe->register_new_connection();
           return ss::make_ready_future<request_response_t>(
             std::make_tuple(req, res));
       })
@@ -478,68 +480,45 @@ bool client::request_stream::is_done() { return _serializer.is_done(); }
 // Wait until remaining data will be transmitted
 ss::future<> client::request_stream::send_eof() { return _gate.close(); }
 
-static ss::temporary_buffer<char> iobuf_as_tmpbuf(iobuf&& buf) {
-    if (buf.begin() == buf.end()) {
-        // empty buf
-        return ss::temporary_buffer<char>();
-    }
-    auto full_size_bytes = buf.size_bytes();
-    if (auto it = buf.begin(); full_size_bytes == it->size()) {
-        // fast path
-        return std::move(*it).release();
-    }
-    // linearize the iobuf
-    auto consumer = iobuf::iterator_consumer(buf.begin(), buf.end());
-    ss::temporary_buffer<char> res(full_size_bytes);
-    consumer.consume_to(full_size_bytes, res.get_write());
-    return res;
-}
 /// Represents response body as a data source for ss::input_stream
+///
+/// The fragments of the received body are handed out one by one as they
+/// are, the body is never linearized, e.g. when a chunk header splits the
+/// payload of a read from the socket.
 struct response_data_source final : ss::data_source_impl {
     explicit response_data_source(client::response_stream_ref resp)
       : _io(std::move(resp)) {}
     ss::future<> close() final {
         _done = true;
+        _pending.clear();
         return ss::now();
     }
     ss::future<ss::temporary_buffer<char>> skip(uint64_t n) final {
-        _skip += n;
+        auto trimmed = std::min<uint64_t>(n, _pending.size_bytes());
+        _pending.trim_front(trimmed);
+        _skip += n - trimmed;
         return get();
     }
     ss::future<ss::temporary_buffer<char>> get() final {
-        return ss::do_with(
-          ss::temporary_buffer<char>(),
-          [this](ss::temporary_buffer<char>& result) {
-              return ss::repeat([this, &result] {
-                         if (_done || _io->is_done()) {
-                             return ss::make_ready_future<ss::stop_iteration>(
-                               ss::stop_iteration::yes);
-                         }
-                         return _io->recv_some().then([this, &result](
-                                                        iobuf&& bufseq) {
-                             if (_skip) {
-                                 auto n = std::min(bufseq.size_bytes(), _skip);
-                                 bufseq.trim_front(n);
-                                 _skip -= n;
-                             }
-                             if (bufseq.begin() == bufseq.end()) {
-                                 return ss::make_ready_future<
-                                   ss::stop_iteration>(
-                                   _io->is_done() ? ss::stop_iteration::yes
-                                                  : ss::stop_iteration::no);
-                             }
-                             result = iobuf_as_tmpbuf(std::move(bufseq));
-                             return ss::make_ready_future<ss::stop_iteration>(
-                               ss::stop_iteration::yes);
-                         });
-                     })
-                .then([&result] {
-                    return ss::make_ready_future<ss::temporary_buffer<char>>(
-                      std::move(result));
-                });
-          });
+        while (_pending.empty()) {
+            if (_done || _io->is_done()) {
+                co_return ss::temporary_buffer<char>();
+            }
+            auto bufseq = co_await _io->recv_some();
+            if (_skip) {
+                auto n = std::min(bufseq.size_bytes(), _skip);
+                bufseq.trim_front(n);
+                _skip -= n;
+            }
+            _pending = std::move(bufseq);
+        }
+        auto buf = _pending.begin()->share();
+        _pending.pop_front();
+        co_return buf;
     }
     client::response_stream_ref _io;
+    /// Received fragments not handed out yet
+    iobuf _pending;
     size_t _skip{0};
     bool _done{false};
 };
@@ -548,13 +527,12 @@ struct request_data_sink final : ss::data_sink_impl {
       : _io(std::move(req)) {}
     ss::future<> put(ss::net::packet data) final { return put(data.release()); }
     ss::future<> put(std::vector<ss::temporary_buffer<char>> all) final {
-        return ss::do_with(
-          std::move(all), [this](std::vector<ss::temporary_buffer<char>>& all) {
-              return ss::do_for_each(
-                all, [this](ss::temporary_buffer<char>& buf) {
-                    return put(std::move(buf));
-                });
-          });
+        // a single write of all the buffers rather than one per buffer
+        iobuf seq;
+        for (auto& buf : all) {
+            seq.append(std::move(buf));
+        }
+        return _io->send_some(std::move(seq));
     }
     ss::future<> put(ss::temporary_buffer<char> buf) final {
         return _io->send_some(std::move(buf));
@@ -564,6 +542,39 @@ struct request_data_sink final : ss::data_sink_impl {
     client::request_stream_ref _io;
 };
 
+/// Sends the buffers read from \p input as the request body
+///
+/// The buffers are handed to the request as they are read, e.g. the DMA
+/// buffers of a file input stream, rather than copied into the buffer of an
+/// output_stream first.
+static ss::future<> send_body(
+  client::request_stream_ref request,
+  ss::input_stream<char>& input,
+  bool empty_input_stream) {
+    std::exception_ptr ex;
+    try {
+        bool sent = false;
+        while (!empty_input_stream) {
+            auto buf = co_await input.read();
+            if (buf.empty()) {
+                break;
+            }
+            co_await request->send_some(std::move(buf));
+            sent = true;
+        }
+        if (!sent) {
+            // empty body, the header still has to be sent
+            co_await request->send_some(iobuf());
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await request->send_eof();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+}
+
 ss::future<client::response_stream_ref> client::request(
   client::request_header&& header,
   ss::input_stream<char>& input,
@@ -573,30 +584,10 @@ ss::future<client::response_stream_ref> client::request(
     if (plen != header.cend()) {
         empty_input_stream = plen->value() == "0";
     }
-    return make_request(std::move(header), timeout)
-      .then([&input, empty_input_stream](request_response_t reqresp) mutable {
-          auto [request, response] = std::move(reqresp);
-          auto fsend = ss::now();
-          if (empty_input_stream) {
-              // special case - empty input stream, don't use ss::copy
-              // since it won't invoke the underlying implementation
-              fsend = request->send_some(iobuf()).then(
-                [request = request]() { return request->send_eof(); });
-          } else {
-              // since the input stream has some data we can use
-              // output_stream interace of the request
-              fsend = ss::do_with(
-                request->as_output_stream(),
-                [&input](ss::output_stream<char>& output) {
-                    return ss::copy(input, output).finally([&output] {
-                        return output.close();
-                    });
-                });
-          }
-          return fsend.then([response = response]() {
-              return ss::make_ready_future<response_stream_ref>(response);
-          });
-      });
+    auto [request, response] = co_await make_request(
+      std::move(header), timeout);
+    co_await send_body(request, input, empty_input_stream);
+    co_return response;
 }
 
 ss::future<client::response_stream_ref> client::request(
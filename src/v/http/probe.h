@@ -95,6 +95,12 @@ public:
 
     void register_transport_error() { _transport_errors += 1; }
 
+    /// Register request sent over an already established connection
+    void register_connection_reuse() { _reused_connections += 1; }
+
+    /// Register new connection established to send a request
+    void register_new_connection() { _new_connections += 1; }
+
     /// Return total incomming traffic
     uint64_t get_inbound_bytes() const { return _in; }
 
@@ -104,6 +110,12 @@ public:
     /// Return total number of transport errors
     uint64_t get_transport_errors() const { return _transport_errors; }
 
+    /// Return number of requests that reused an open connection
+    uint64_t get_reused_connections() const { return _reused_connections; }
+
+    /// Return number of connections established to send requests
+    uint64_t get_new_connections() const { return _new_connections; }
+
     /// Get total number of GET requests
     uint64_t get_total_get_requests() const { return _get_requests.total(); }
 
@@ -135,6 +147,10 @@ private:
     diff_counter _all_requests;
     /// Number of connection errors
     uint64_t _transport_errors;
+    /// Number of requests sent over an already open connection
+    uint64_t _reused_connections{0};
+    /// Number of connections established to send requests
+    uint64_t _new_connections{0};
 };
 
 } // namespace http
@@ -13,3 +13,5 @@
 #include "io/page.h"
 #include "io/page_set.h"
 #include "io/persistence.h"
+#include "io/page_cache.h"
+#include "io/pager.h"
@@ -10,6 +10,8 @@
  */
 #include "io/page.h"
 
+#include <cassert>
+
 namespace experimental::io {
 
 page::page(uint64_t offset, seastar::temporary_buffer<char> data)
@@ -25,4 +27,11 @@ const seastar::temporary_buffer<char>& page::data() const noexcept {
     return data_;
 }
 
+void page::set_data(seastar::temporary_buffer<char> data) noexcept {
+    assert(data.size() == size_);
+    data_ = std::move(data);
+}
+
+void page::clear() noexcept { data_ = {}; }
+
 } // namespace experimental::io
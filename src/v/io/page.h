@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include "io/cache.h"
+
 #include <seastar/core/temporary_buffer.hh>
 
 #include <cstdint>
@@ -51,6 +53,27 @@ public:
      */
     [[nodiscard]] const seastar::temporary_buffer<char>& data() const noexcept;
 
+    /**
+     * Replace the data stored in this page.
+     *
+     * The size of \p data must match the fixed size of the page. This is used
+     * to rehydrate a page whose data was previously released by clear().
+     */
+    void set_data(seastar::temporary_buffer<char> data) noexcept;
+
+    /**
+     * Release the data stored in this page.
+     *
+     * The offset and size of the page are retained. This is the operation
+     * performed when a page is evicted from a \ref page_cache.
+     */
+    void clear() noexcept;
+
+    /**
+     * Cache metadata and control structure.
+     */
+    cache_hook hook;
+
 private:
     uint64_t offset_;
     uint64_t size_;
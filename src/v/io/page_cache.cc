@@ -0,0 +1,43 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "io/page_cache.h"
+
+namespace experimental::io {
+
+page_cache::page_cache(config config)
+  : cache_(config) {}
+
+void page_cache::insert(page& page) noexcept { cache_.insert(page); }
+
+void page_cache::remove(const page& page) noexcept { cache_.remove(page); }
+
+bool page_cache::ghost_queue_contains(const page& page) const noexcept {
+    return cache_.ghost_queue_contains(page);
+}
+
+void page_cache::hit(page& page) noexcept {
+    page.hook.touch();
+    ++hits_;
+}
+
+void page_cache::miss() noexcept { ++misses_; }
+
+struct page_cache::stat page_cache::stat() const noexcept {
+    const auto stat = cache_.stat();
+    return {
+      .small_queue_size = stat.small_queue_size,
+      .main_queue_size = stat.main_queue_size,
+      .hits = hits_,
+      .misses = misses_,
+    };
+}
+
+} // namespace experimental::io
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "io/cache.h"
+#include "io/page.h"
+
+namespace experimental::io {
+
+/**
+ * A page cache using the s3-fifo eviction algorithm.
+ *
+ * The page cache does not own pages. Pages are owned by an index structure
+ * such as \ref pager, and the page cache decides which pages retain their data.
+ * The cost of a page is its size in bytes, hence the capacity of the cache is
+ * expressed in bytes.
+ *
+ * When a page is evicted its data is released with page::clear(), but the page
+ * itself remains in the owner's index so that the s3-fifo ghost queue can
+ * continue to track it.
+ */
+class page_cache {
+    struct evict {
+        bool operator()(page& page) noexcept {
+            page.clear();
+            return true;
+        }
+    };
+
+    struct cost {
+        size_t operator()(const page& page) noexcept { return page.size(); }
+    };
+
+    using cache_type = cache<page, &page::hook, evict, cost>;
+
+public:
+    using config = cache_type::config;
+
+    /**
+     * Cache statistics.
+     */
+    struct stat {
+        /// Current size of the small queue in bytes.
+        size_t small_queue_size;
+        /// Current size of the main queue in bytes.
+        size_t main_queue_size;
+        /// Number of lookups that found data in the cache.
+        uint64_t hits;
+        /// Number of lookups that did not find data in the cache.
+        uint64_t misses;
+    };
+
+    /**
+     * Create a page cache with the provided \p config.
+     */
+    explicit page_cache(config config);
+
+    page_cache(const page_cache&) = delete;
+    page_cache& operator=(const page_cache&) = delete;
+    page_cache(page_cache&&) noexcept = delete;
+    page_cache& operator=(page_cache&&) noexcept = delete;
+    ~page_cache() noexcept = default;
+
+    /**
+     * Insert \p page into the cache, possibly evicting other pages.
+     */
+    void insert(page& page) noexcept;
+
+    /**
+     * Remove \p page from the cache.
+     */
+    void remove(const page& page) noexcept;
+
+    /**
+     * Returns true if \p page is on the ghost queue.
+     */
+    [[nodiscard]] bool ghost_queue_contains(const page& page) const noexcept;
+
+    /**
+     * Record a lookup that found \p page with data in the cache.
+     */
+    void hit(page& page) noexcept;
+
+    /**
+     * Record a lookup that did not find data in the cache.
+     */
+    void miss() noexcept;
+
+    /**
+     * Return the current cache statistics.
+     */
+    [[nodiscard]] stat stat() const noexcept;
+
+private:
+    cache_type cache_;
+    uint64_t hits_{0};
+    uint64_t misses_{0};
+};
+
+} // namespace experimental::io
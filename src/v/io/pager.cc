@@ -0,0 +1,143 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "io/pager.h"
+
+#include <seastar/core/coroutine.hh>
+
+#include <vector>
+
+namespace experimental::io {
+
+pager::pager(uint64_t page_size, page_cache* cache) noexcept
+  : page_size_(page_size)
+  , cache_(cache) {
+    assert(page_size_ > 0);
+}
+
+pager::~pager() noexcept {
+    for (const auto& page : pages_) {
+        cache_->remove(*page);
+    }
+}
+
+uint64_t pager::page_size() const noexcept { return page_size_; }
+
+seastar::future<seastar::temporary_buffer<char>>
+pager::read(persistence::file& file, uint64_t offset, uint64_t limit) {
+    if (offset >= limit) {
+        co_return seastar::temporary_buffer<char>();
+    }
+
+    const auto page_offset = offset - (offset % page_size_);
+    seastar::temporary_buffer<char> data;
+
+    if (auto it = pages_.find(page_offset);
+        it != pages_.end() && !(*it)->data().empty()) {
+        cache_->hit(**it);
+        data = (*it)->data().share();
+    } else {
+        cache_->miss();
+        data = co_await read_page(file, page_offset, limit);
+    }
+
+    const auto skip = offset - page_offset;
+    if (skip >= data.size()) {
+        co_return seastar::temporary_buffer<char>();
+    }
+    data.trim_front(skip);
+    data.trim(std::min<uint64_t>(data.size(), limit - offset));
+    co_return data;
+}
+
+seastar::future<seastar::temporary_buffer<char>>
+pager::read_page(persistence::file& file, uint64_t offset, uint64_t limit) {
+    auto data = seastar::temporary_buffer<char>::aligned(
+      file.memory_dma_alignment(), page_size_);
+
+    auto size = co_await file.dma_read(
+      offset, data.get_write(), data.size());
+
+    /*
+     * the file may contain data past the readable limit, such as padding or
+     * data that has not yet been made visible to readers.
+     */
+    size = std::min<uint64_t>(size, limit - offset);
+    data.trim(size);
+
+    if (data.size() == page_size_) {
+        maybe_cache(offset, data.share());
+    }
+
+    co_return data;
+}
+
+void pager::maybe_cache(uint64_t offset, seastar::temporary_buffer<char> data) {
+    /*
+     * the index is re-examined after the read completes since a concurrent
+     * reader may have populated or truncated the page in the meantime.
+     */
+    if (auto it = pages_.find(offset); it != pages_.end()) {
+        const auto& page = *it;
+        if (
+          page->offset() == offset && page->size() == data.size()
+          && page->data().empty()) {
+            page->set_data(std::move(data));
+            cache_->insert(*page);
+        }
+        return;
+    }
+
+    auto page = seastar::make_lw_shared<io::page>(offset, std::move(data));
+    auto res = pages_.insert(page);
+    if (res.second) {
+        cache_->insert(*page);
+        ++num_pages_;
+        maybe_sweep();
+    }
+}
+
+void pager::truncate(uint64_t size) noexcept {
+    std::vector<uint64_t> offsets;
+    for (const auto& page : pages_) {
+        if ((page->offset() + page->size()) > size) {
+            offsets.push_back(page->offset());
+        }
+    }
+    for (auto offset : offsets) {
+        erase(pages_.find(offset));
+    }
+}
+
+void pager::erase(page_set::const_iterator it) noexcept {
+    cache_->remove(**it);
+    pages_.erase(it);
+    --num_pages_;
+}
+
+void pager::maybe_sweep() noexcept {
+    if (num_pages_ < sweep_threshold_) {
+        return;
+    }
+
+    std::vector<uint64_t> offsets;
+    for (const auto& page : pages_) {
+        if (page->hook.evicted() && !cache_->ghost_queue_contains(*page)) {
+            offsets.push_back(page->offset());
+        }
+    }
+    for (auto offset : offsets) {
+        erase(pages_.find(offset));
+    }
+
+    sweep_threshold_ = std::max(min_sweep_threshold, num_pages_ * 2);
+}
+
+} // namespace experimental::io
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "io/page_cache.h"
+#include "io/page_set.h"
+#include "io/persistence.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+namespace experimental::io {
+
+/**
+ * Cached, page-granular read access to a single file.
+ *
+ * The pager divides a file into fixed size pages and serves reads from pages
+ * held in a shared \ref page_cache, reading missing pages from the file. Only
+ * complete pages are cached: a page that extends past the readable limit of the
+ * file (e.g. the tail of a file that is still being appended to) is read from
+ * the file on each access and never inserted into the cache.
+ *
+ * The pager assumes that data below the readable limit of the file is
+ * immutable, with the exception of truncation which must be communicated to
+ * the pager with truncate().
+ */
+class pager {
+public:
+    /**
+     * Create a pager with pages of \p page_size bytes backed by \p cache.
+     *
+     * The page size must be a multiple of the file's read alignment.
+     */
+    pager(uint64_t page_size, page_cache* cache) noexcept;
+
+    pager(const pager&) = delete;
+    pager& operator=(const pager&) = delete;
+    pager(pager&&) noexcept = delete;
+    pager& operator=(pager&&) noexcept = delete;
+    ~pager() noexcept;
+
+    /**
+     * Read data from \p file starting at \p offset.
+     *
+     * The returned buffer contains data starting at \p offset up to the end of
+     * the page containing \p offset, or up to \p limit, whichever comes first.
+     * An empty buffer is returned if \p offset is at or beyond \p limit.
+     */
+    seastar::future<seastar::temporary_buffer<char>>
+    read(persistence::file& file, uint64_t offset, uint64_t limit);
+
+    /**
+     * Drop any page that contains data at or beyond \p size.
+     */
+    void truncate(uint64_t size) noexcept;
+
+    /**
+     * Size of pages managed by this pager.
+     */
+    [[nodiscard]] uint64_t page_size() const noexcept;
+
+private:
+    seastar::future<seastar::temporary_buffer<char>>
+    read_page(persistence::file& file, uint64_t offset, uint64_t limit);
+    void maybe_cache(uint64_t offset, seastar::temporary_buffer<char> data);
+    void erase(page_set::const_iterator it) noexcept;
+
+    /*
+     * pages whose data has been evicted remain in the index while they are on
+     * the ghost queue. sweep periodically removes those that have aged out.
+     */
+    void maybe_sweep() noexcept;
+
+    static constexpr size_t min_sweep_threshold = 64;
+
+    uint64_t page_size_;
+    page_cache* cache_;
+    page_set pages_;
+    size_t num_pages_{0};
+    size_t sweep_threshold_{min_sweep_threshold};
+};
+
+} // namespace experimental::io
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "io/pager.h"
+#include "io/persistence.h"
+#include "io/tests/common.h"
+#include "test_utils/test.h"
+#include "units.h"
+
+namespace io = experimental::io;
+
+class PagerTest : public ::testing::Test {
+public:
+    static constexpr auto page_size = 4_KiB;
+    static constexpr auto num_pages = 4;
+    static constexpr auto file_size = page_size * num_pages;
+
+    void SetUp() override {
+        file = fs.create("file").get();
+        data = make_random_data(file_size, file->memory_dma_alignment()).get();
+        file->dma_write(0, data.get(), data.size()).get();
+    }
+
+    void TearDown() override { file->close().get(); }
+
+    std::string_view expected(uint64_t offset, uint64_t size) const {
+        return {data.get() + offset, size};
+    }
+
+    static std::string_view view(const seastar::temporary_buffer<char>& buf) {
+        return {buf.get(), buf.size()};
+    }
+
+    io::memory_persistence fs;
+    seastar::shared_ptr<io::persistence::file> file;
+    seastar::temporary_buffer<char> data;
+    io::page_cache cache{{.cache_size = file_size, .small_size = page_size}};
+};
+
+TEST_F(PagerTest, ReadToEndOfPage) {
+    io::pager pager(page_size, &cache);
+
+    auto buf = pager.read(*file, 10, file_size).get();
+    EXPECT_EQ(view(buf), expected(10, page_size - 10));
+
+    buf = pager.read(*file, page_size, file_size).get();
+    EXPECT_EQ(view(buf), expected(page_size, page_size));
+}
+
+TEST_F(PagerTest, ReadAtOrBeyondLimit) {
+    io::pager pager(page_size, &cache);
+    EXPECT_TRUE(pager.read(*file, 100, 100).get().empty());
+    EXPECT_TRUE(pager.read(*file, file_size, file_size).get().empty());
+}
+
+TEST_F(PagerTest, HitAfterMiss) {
+    io::pager pager(page_size, &cache);
+
+    pager.read(*file, 0, file_size).get();
+    EXPECT_EQ(cache.stat().misses, 1);
+    EXPECT_EQ(cache.stat().hits, 0);
+    EXPECT_EQ(cache.stat().small_queue_size, page_size);
+
+    auto buf = pager.read(*file, 100, file_size).get();
+    EXPECT_EQ(view(buf), expected(100, page_size - 100));
+    EXPECT_EQ(cache.stat().misses, 1);
+    EXPECT_EQ(cache.stat().hits, 1);
+}
+
+TEST_F(PagerTest, PartialPageNotCached) {
+    io::pager pager(page_size, &cache);
+
+    // limit falls in the middle of the last page
+    const auto limit = file_size - 100;
+    auto buf = pager.read(*file, page_size * 3, limit).get();
+    EXPECT_EQ(view(buf), expected(page_size * 3, page_size - 100));
+
+    pager.read(*file, page_size * 3, limit).get();
+    EXPECT_EQ(cache.stat().misses, 2);
+    EXPECT_EQ(cache.stat().hits, 0);
+    EXPECT_EQ(cache.stat().small_queue_size, 0);
+}
+
+TEST_F(PagerTest, Truncate) {
+    io::pager pager(page_size, &cache);
+
+    for (uint64_t offset = 0; offset < file_size; offset += page_size) {
+        pager.read(*file, offset, file_size).get();
+    }
+
+    const auto stat = cache.stat();
+    EXPECT_EQ(stat.small_queue_size + stat.main_queue_size, file_size);
+
+    // drops the page containing the truncation point and all that follow
+    pager.truncate(page_size + 1);
+    const auto truncated = cache.stat();
+    EXPECT_EQ(
+      truncated.small_queue_size + truncated.main_queue_size, page_size);
+
+    auto buf = pager.read(*file, 0, file_size).get();
+    EXPECT_EQ(view(buf), expected(0, page_size));
+    EXPECT_EQ(cache.stat().hits, 1);
+}
+
+TEST_F(PagerTest, EvictionRehydrates) {
+    io::pager pager(page_size, &cache);
+
+    // read more data than the cache can hold
+    for (int round = 0; round < 3; ++round) {
+        for (uint64_t offset = 0; offset < file_size; offset += page_size) {
+            auto buf = pager.read(*file, offset, file_size).get();
+            EXPECT_EQ(view(buf), expected(offset, page_size));
+        }
+    }
+
+    const auto stat = cache.stat();
+    EXPECT_LE(stat.small_queue_size + stat.main_queue_size, file_size);
+}
+
+TEST_F(PagerTest, DestructorRemovesPages) {
+    {
+        io::pager pager(page_size, &cache);
+        pager.read(*file, 0, file_size).get();
+        EXPECT_EQ(cache.stat().small_queue_size, page_size);
+    }
+    EXPECT_EQ(cache.stat().small_queue_size, 0);
+    EXPECT_EQ(cache.stat().main_queue_size, 0);
+}
@@ -53,6 +53,18 @@ client::client(const YAML::Node& cfg, external_mitigate mitigater)
   , _wait_or_start_update_metadata{[this](wait_or_start::tag tag) {
       return update_metadata(tag);
   }}
+  , _metadata_refresh_timer{[this]() {
+      ssx::spawn_with_gate(_gate, [this]() {
+          return _wait_or_start_update_metadata().handle_exception(
+            [this](std::exception_ptr ex) {
+                vlog(
+                  kclog.debug,
+                  "{}Failed to refresh metadata in the background: {}",
+                  *this,
+                  ex);
+            });
+      });
+  }}
   , _producer{_config, _topic_cache, _brokers, _config.produce_ack_level(), [this](std::exception_ptr ex) {
       return mitigate_error(std::move(ex));
   }}
@@ -84,7 +96,14 @@ ss::future<> client::connect() {
               return _external_mitigate(ex);
           },
           _as);
-    });
+    }).then([this]() { arm_metadata_refresh(); });
+}
+
+void client::arm_metadata_refresh() {
+    const auto max_age = _config.metadata_max_age();
+    if (max_age > 0ms && !_metadata_refresh_timer.armed()) {
+        _metadata_refresh_timer.arm_periodic(max_age);
+    }
 }
 
 namespace {
@@ -101,6 +120,7 @@ ss::future<> catch_and_log(client const& c, Func&& f) noexcept {
 
 ss::future<> client::stop() noexcept {
     _as.request_abort();
+    _metadata_refresh_timer.cancel();
     co_await catch_and_log(*this, [this]() { return _producer.stop(); });
     co_await _gate.close();
     for (auto& [id, group] : _consumers) {
@@ -144,6 +164,41 @@ ss::future<> client::update_metadata(wait_or_start::tag) {
     });
 }
 
+ss::future<> client::update_topic_metadata(const model::topic& topic) {
+    return _wait_or_start_update_topic_metadata
+      .try_emplace(
+        topic,
+        [this, topic](wait_or_start::tag tag) {
+            return update_topic_metadata(topic, tag);
+        })
+      .first->second();
+}
+
+ss::future<>
+client::update_topic_metadata(model::topic topic, wait_or_start::tag) {
+    return ss::try_with_gate(_gate, [this, topic{std::move(topic)}]() mutable {
+        vlog(kclog.debug, "{}updating metadata of {}", *this, topic);
+        return _brokers.any()
+          .then([this, topic{std::move(topic)}](shared_broker_t broker) {
+              std::vector<metadata_request_topic> topics{
+                metadata_request_topic{.name{topic}}};
+              return broker
+                ->dispatch(metadata_request{
+                  .data{
+                    .topics{std::move(topics)},
+                    .allow_auto_topic_creation = false}})
+                .then([this](metadata_response res) {
+                    return apply_topics(std::move(res));
+                })
+                .finally([this, topic]() {
+                    vlog(kclog.trace, "{}updated metadata of {}", *this, topic);
+                });
+          })
+          .handle_exception_type(
+            [this](const broker_error&) { return connect(); });
+    });
+}
+
 ss::future<> client::apply(metadata_response res) {
     try {
         co_await _brokers.apply(std::move(res.data.brokers));
@@ -155,6 +210,17 @@ ss::future<> client::apply(metadata_response res) {
     }
 }
 
+ss::future<> client::apply_topics(metadata_response res) {
+    try {
+        co_await _brokers.apply(std::move(res.data.brokers));
+        co_await _topic_cache.apply_topics(std::move(res.data.topics));
+        _controller = res.data.controller_id;
+    } catch (const std::exception& ex) {
+        vlog(kclog.debug, "{}Failed to apply metadata request: {}", *this, ex);
+        throw;
+    }
+}
+
 ss::future<> client::mitigate_error(std::exception_ptr ex) {
     return _external_mitigate(ex).handle_exception(
       [this](std::exception_ptr ex) {
@@ -190,7 +256,7 @@ ss::future<> client::mitigate_error(std::exception_ptr ex) {
               case error_code::not_leader_for_partition:
               case error_code::leader_not_available: {
                   vlog(kclog.debug, "{}partition_error: {}", *this, ex);
-                  return _wait_or_start_update_metadata();
+                  return update_topic_metadata(ex.tp.topic);
               }
               default:
                   vlog(kclog.warn, "{}partition_error: {}", *this, ex);
@@ -200,7 +266,7 @@ ss::future<> client::mitigate_error(std::exception_ptr ex) {
               switch (ex.error) {
               case error_code::unknown_topic_or_partition:
                   vlog(kclog.debug, "{}topic_error: {}", *this, ex);
-                  return _wait_or_start_update_metadata();
+                  return update_topic_metadata(ex.topic);
               default:
                   vlog(kclog.warn, "{}topic_error: {}", *this, ex);
                   return ss::make_exception_future(ex);
@@ -31,6 +31,7 @@
 #include "utils/retry.h"
 
 #include <seastar/core/condition-variable.hh>
+#include <seastar/core/timer.hh>
 
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
@@ -185,6 +186,18 @@ private:
     /// Uses round-robin load-balancing strategy.
     ss::future<> update_metadata(wait_or_start::tag);
 
+    /// \brief Update the metadata of a topic
+    ///
+    /// Requests the metadata of \p topic alone, rather than of all of the
+    /// topics. If an update of the topic is in progress, the future returned
+    /// will be satisfied by the outstanding request.
+    ss::future<> update_topic_metadata(const model::topic& topic);
+    ss::future<> update_topic_metadata(model::topic topic, wait_or_start::tag);
+
+    /// \brief Refresh the metadata every metadata_max_age_ms, so that the
+    /// leadership changes are picked up before requests fail on them.
+    void arm_metadata_refresh();
+
     /// \brief Handle errors by performing an action that may fix the cause of
     /// the error
     ss::future<> mitigate_error(std::exception_ptr ex);
@@ -192,6 +205,9 @@ private:
     /// \brief Apply metadata update
     ss::future<> apply(metadata_response res);
 
+    /// \brief Apply metadata update of some of the topics
+    ss::future<> apply_topics(metadata_response res);
+
     /// \brief Log the client ID if it exists, otherwise don't log
     friend std::ostream& operator<<(std::ostream& os, client const& c) {
         if (c._config.client_identifier().has_value()) {
@@ -212,6 +228,11 @@ private:
     model::node_id _controller{unknown_node_id};
     /// \brief Update metadata, or wait for an existing one.
     wait_or_start _wait_or_start_update_metadata;
+    /// \brief Update the metadata of a topic, or wait for an existing one.
+    absl::node_hash_map<model::topic, wait_or_start>
+      _wait_or_start_update_topic_metadata;
+    /// \brief Refresh the metadata in the background.
+    ss::timer<> _metadata_refresh_timer;
     /// \brief Batching producer.
     producer _producer;
     /// \brief Consumers
@@ -42,6 +42,13 @@ configuration::configuration()
       "Delay (in milliseconds) for initial retry backoff",
       {},
       100ms)
+  , metadata_max_age(
+      *this,
+      "metadata_max_age_ms",
+      "Interval (in milliseconds) at which the metadata is refreshed in the "
+      "background, 0 disables the refresh",
+      {},
+      5min)
   , produce_batch_record_count(
       *this,
       "produce_batch_record_count",
@@ -119,6 +126,14 @@ configuration::configuration()
       {},
       1_MiB,
       {.min = 0})
+  , consumer_prefetch_max_bytes(
+      *this,
+      "consumer_prefetch_max_bytes",
+      "Max bytes to fetch ahead of the next consumer fetch, 0 disables the "
+      "prefetch",
+      {},
+      1_MiB,
+      {.min = 0})
   , consumer_session_timeout(
       *this,
       "consumer_session_timeout_ms",
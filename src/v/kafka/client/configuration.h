@@ -31,6 +31,7 @@ struct configuration final : public config::config_store {
     config::property<config::tls_config> broker_tls;
     config::property<size_t> retries;
     config::property<std::chrono::milliseconds> retry_base_backoff;
+    config::property<std::chrono::milliseconds> metadata_max_age;
     config::property<int32_t> produce_batch_record_count;
     config::property<int32_t> produce_batch_size_bytes;
     config::property<std::chrono::milliseconds> produce_batch_delay;
@@ -40,6 +41,7 @@ struct configuration final : public config::config_store {
     config::property<std::chrono::milliseconds> consumer_request_timeout;
     config::bounded_property<int32_t> consumer_request_min_bytes;
     config::bounded_property<int32_t> consumer_request_max_bytes;
+    config::bounded_property<int32_t> consumer_prefetch_max_bytes;
     config::property<std::chrono::milliseconds> consumer_session_timeout;
     config::property<std::chrono::milliseconds> consumer_rebalance_timeout;
     config::property<std::chrono::milliseconds> consumer_heartbeat_interval;
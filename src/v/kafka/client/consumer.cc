@@ -34,11 +34,14 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/sleep.hh>
+#include <seastar/core/when_all.hh>
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <iterator>
 #include <utility>
+#include <vector>
 
 namespace kafka::client {
 
@@ -143,6 +146,12 @@ ss::future<> consumer::stop() {
     _as.request_abort();
     return _coordinator->stop()
       .then([this]() { return _gate.close(); })
+      .then([this]() {
+          // The prefetch holds the gate, so it's complete by now.
+          if (auto p = std::exchange(_prefetched, std::nullopt)) {
+              p->fetches.ignore_ready_future();
+          }
+      })
       .finally([me{shared_from_this()}] {});
 }
 
@@ -409,7 +418,7 @@ consumer::offset_commit(std::vector<offset_commit_request_topic> topics) {
     co_return co_await req_res(std::move(req_builder));
 }
 
-ss::future<fetch_response>
+ss::future<consumer::broker_fetch>
 consumer::dispatch_fetch(broker_reqs_t::value_type br) {
     auto& [broker, req] = br;
     vlog(kclog.trace, "Consumer: {}, fetch_req: {}", *this, req);
@@ -419,14 +428,11 @@ consumer::dispatch_fetch(broker_reqs_t::value_type br) {
     if (res.data.error_code != error_code::none) {
         throw broker_error(broker->id(), res.data.error_code);
     }
-
-    _fetch_sessions[broker].apply(res);
-    co_return res;
+    co_return broker_fetch{.broker = broker, .response = std::move(res)};
 }
 
-ss::future<fetch_response> consumer::fetch(
-  std::chrono::milliseconds timeout, std::optional<int32_t> max_bytes) {
-    refresh_inactivity_timer();
+ss::future<consumer::broker_fetches_t> consumer::dispatch_fetches(
+  std::chrono::milliseconds timeout, int32_t max_bytes) {
     // Split requests by broker
     broker_reqs_t broker_reqs;
     for (auto const& [t, ps] : _assignment) {
@@ -444,8 +450,7 @@ ss::future<fetch_response> consumer::fetch(
                               .replica_id = consumer_replica_id,
                               .max_wait_ms = timeout,
                               .min_bytes = _config.consumer_request_min_bytes,
-                              .max_bytes = max_bytes.value_or(
-                                _config.consumer_request_max_bytes),
+                              .max_bytes = max_bytes,
                               .isolation_level = model::isolation_level::
                                 read_uncommitted, // READ_UNCOMMITTED
                               .session_id = session.id(),
@@ -461,21 +466,109 @@ ss::future<fetch_response> consumer::fetch(
               fetch_request::partition{
                 .partition_index = p,
                 .fetch_offset = session.offset(tp),
-                .max_bytes = max_bytes.value_or(
-                  _config.consumer_request_max_bytes)});
+                .max_bytes = max_bytes});
+        }
+    }
+
+    std::vector<ss::future<broker_fetch>> futs;
+    futs.reserve(broker_reqs.size());
+    for (auto& br : broker_reqs) {
+        futs.push_back(dispatch_fetch(std::move(br)));
+    }
+    auto results = co_await ss::when_all(futs.begin(), futs.end());
+    broker_fetches_t fetches;
+    fetches.reserve(results.size());
+    std::exception_ptr ex;
+    for (auto& r : results) {
+        if (r.failed()) {
+            ex = r.get_exception();
+        } else {
+            fetches.push_back(r.get());
         }
     }
+    if (ex) {
+        // The records of the other brokers are fetched again, rather than
+        // being skipped.
+        discard(fetches);
+        std::rethrow_exception(ex);
+    }
+    co_return fetches;
+}
+
+fetch_response consumer::deliver(broker_fetches_t fetches) {
+    fetch_response res{
+      .data = {
+        .throttle_time_ms{},
+        .error_code = error_code::none,
+        .session_id = kafka::invalid_fetch_session_id}};
+    for (auto& f : fetches) {
+        _fetch_sessions[f.broker].apply(f.response);
+        res = detail::reduce_fetch_response(
+          std::move(res), std::move(f.response));
+    }
+    return res;
+}
+
+void consumer::discard(const broker_fetches_t& fetches) {
+    for (const auto& f : fetches) {
+        _fetch_sessions[f.broker].discard(f.response);
+    }
+}
+
+void consumer::prefetch(int32_t max_bytes) {
+    max_bytes = std::min(max_bytes, _config.consumer_prefetch_max_bytes());
+    if (max_bytes <= 0 || _gate.is_closed() || _assignment.empty()) {
+        return;
+    }
+    // The requests to a broker are serialized, so the prefetch doesn't wait
+    // for records to hold up the heartbeats and commits.
+    _prefetched.emplace(prefetched{
+      .generation = _generation_id,
+      .fetches = ss::try_with_gate(_gate, [this, max_bytes] {
+          return dispatch_fetches(0ms, max_bytes);
+      })});
+}
 
-    co_return co_await ss::map_reduce(
-      std::make_move_iterator(broker_reqs.begin()),
-      std::make_move_iterator(broker_reqs.end()),
-      [this](broker_reqs_t::value_type br) {
-          return dispatch_fetch(std::move(br));
-      },
-      fetch_response{
-        .data
-        = {.throttle_time_ms{}, .error_code = error_code::none, .session_id = kafka::invalid_fetch_session_id}},
-      detail::reduce_fetch_response);
+ss::future<fetch_response> consumer::fetch(
+  std::chrono::milliseconds timeout, std::optional<int32_t> max_bytes) {
+    refresh_inactivity_timer();
+    const auto fetch_max_bytes = max_bytes.value_or(
+      _config.consumer_request_max_bytes);
+    if (auto p = std::exchange(_prefetched, std::nullopt)) {
+        broker_fetches_t fetches;
+        try {
+            fetches = co_await std::move(p->fetches);
+        } catch (...) {
+            // Left to the fetch below, which reports the error
+            vlog(
+              kclog.debug,
+              "Consumer: {}, prefetch failed: {}",
+              *this,
+              std::current_exception());
+        }
+        auto has_records = [&fetches] {
+            for (auto& f : fetches) {
+                for (auto& part : f.response) {
+                    const auto& records = part.partition_response->records;
+                    if (records && !records->empty()) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        };
+        if (p->generation == _generation_id && has_records()) {
+            auto res = deliver(std::move(fetches));
+            prefetch(fetch_max_bytes);
+            co_return res;
+        }
+        // Fetched for a previous assignment, or nothing was available: fetch
+        // again, waiting up to the timeout for records.
+        discard(fetches);
+    }
+    auto res = deliver(co_await dispatch_fetches(timeout, fetch_max_bytes));
+    prefetch(fetch_max_bytes);
+    co_return res;
 }
 
 template<typename request_factory>
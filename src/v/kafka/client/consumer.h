@@ -30,6 +30,8 @@
 
 #include <chrono>
 #include <iterator>
+#include <optional>
+#include <vector>
 
 namespace kafka::client {
 
@@ -99,7 +101,22 @@ private:
 
     ss::future<describe_groups_response> describe_group();
 
-    ss::future<fetch_response> dispatch_fetch(broker_reqs_t::value_type br);
+    struct broker_fetch {
+        shared_broker_t broker;
+        fetch_response response;
+    };
+    using broker_fetches_t = std::vector<broker_fetch>;
+
+    ss::future<broker_fetch> dispatch_fetch(broker_reqs_t::value_type br);
+    // Fetch from the leaders of the assigned partitions, the fetch sessions
+    // are only advanced once the responses are delivered or discarded.
+    ss::future<broker_fetches_t>
+    dispatch_fetches(std::chrono::milliseconds timeout, int32_t max_bytes);
+    fetch_response deliver(broker_fetches_t fetches);
+    void discard(const broker_fetches_t& fetches);
+    // Fetch the records already available, without waiting, while the
+    // previous response is consumed.
+    void prefetch(int32_t max_bytes);
 
     template<typename RequestFactory>
     ss::future<
@@ -171,6 +188,12 @@ private:
     std::unique_ptr<assignment_plan> _plan{};
     assignment_t _assignment{};
     absl::node_hash_map<shared_broker_t, fetch_session> _fetch_sessions;
+    struct prefetched {
+        // The generation of the assignment the records were fetched for
+        generation_id generation;
+        ss::future<broker_fetches_t> fetches;
+    };
+    std::optional<prefetched> _prefetched;
     ss::noncopyable_function<void(const kafka::member_id&)> _on_stopped;
     ss::noncopyable_function<ss::future<>(std::exception_ptr)>
       _external_mitigate;
@@ -30,13 +30,19 @@ model::offset fetch_session::offset(model::topic_partition_view tpv) const {
     return part_it->second;
 }
 
-bool fetch_session::apply(fetch_response& res) {
+void fetch_session::advance(const fetch_response& res) {
     if (_id == invalid_fetch_session_id) {
         _id = fetch_session_id{res.data.session_id};
     }
     vassert(res.data.session_id == _id, "session mismatch: {}", *this);
 
     ++_epoch;
+}
+
+void fetch_session::discard(const fetch_response& res) { advance(res); }
+
+bool fetch_session::apply(fetch_response& res) {
+    advance(res);
     for (auto& part : res) {
         if (part.partition_response->error_code != error_code::none) {
             continue;
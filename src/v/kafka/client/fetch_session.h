@@ -41,12 +41,17 @@ public:
     kafka::fetch_session_epoch epoch() const { return _epoch; }
     model::offset offset(model::topic_partition_view tpv) const;
     bool apply(fetch_response& res);
+    /// \brief Advance the session past a response whose records are not
+    /// consumed, they are fetched again from the same offsets.
+    void discard(const fetch_response& res);
     std::vector<kafka::offset_commit_request_topic>
     make_offset_commit_request() const;
 
     friend std::ostream& operator<<(std::ostream& os, fetch_session const&);
 
 private:
+    void advance(const fetch_response& res);
+
     kafka::fetch_session_id _id{kafka::invalid_fetch_session_id};
     kafka::fetch_session_epoch _epoch{kafka::initial_fetch_session_epoch};
     absl::node_hash_map<
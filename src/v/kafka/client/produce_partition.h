@@ -80,11 +80,15 @@ private:
                              || _size_bytes >= batch_size_bytes;
 
         if (!timed_out && !threshold_met) {
-            _timer.cancel();
-            _timer.arm(_config.produce_batch_delay());
+            // The delay runs from the first record of the batch, it isn't
+            // pushed back by the records that follow.
+            if (!_timer.armed()) {
+                _timer.arm(_config.produce_batch_delay());
+            }
             return false;
         }
 
+        _timer.cancel();
         _consumer(do_consume());
         return true;
     }
@@ -17,26 +17,24 @@
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/produce.h"
 #include "model/fundamental.h"
+#include "units.h"
 
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/gate.hh>
 
+#include <algorithm>
 #include <exception>
+#include <optional>
 
 namespace kafka::client {
 
-produce_request make_produce_request(
-  model::topic_partition tp, model::record_batch&& batch, int16_t acks) {
-    std::vector<produce_request::partition> partitions;
-    partitions.emplace_back(produce_request::partition{
-      .partition_index{tp.partition},
-      .records = produce_request_record_data(std::move(batch))});
+namespace {
 
-    std::vector<produce_request::topic> topics;
-    topics.emplace_back(produce_request::topic{
-      .name{std::move(tp.topic)}, .partitions{std::move(partitions)}});
-    std::optional<ss::sstring> t_id;
-    return produce_request(t_id, acks, std::move(topics));
-}
+// The bytes of the batches sent in a single request, at least one batch is
+// sent whatever its size.
+constexpr size_t max_queued_request_bytes = 16_MiB;
+
+} // namespace
 
 produce_response::partition
 make_produce_response(model::partition_id p_id, std::exception_ptr ex) {
@@ -122,18 +120,87 @@ producer::produce(model::topic_partition tp, model::record_batch&& batch) {
 ss::future<produce_response::partition>
 producer::do_send(model::topic_partition tp, model::record_batch batch) {
     auto leader = co_await _topic_cache.leader(tp);
-    auto broker = co_await _brokers.find(leader);
-    auto res = co_await broker->dispatch(
-      make_produce_request(std::move(tp), std::move(batch), _acks));
-    auto topic = std::move(res.data.responses[0]);
-    auto partition = std::move(topic.partitions[0]);
-    if (partition.error_code != error_code::none) {
-        throw partition_error(
-          model::topic_partition(topic.name, partition.partition_index),
-          partition.error_code);
+    auto& q = _broker_queues[leader];
+    q.batches.push_back(queued_batch{
+      .tp = std::move(tp), .batch = std::move(batch), .promise = {}});
+    auto fut = q.batches.back().promise.get_future();
+
+    // Whoever holds the mutex sends all of the queued batches, including
+    // those of the producers waiting behind it.
+    auto units = co_await q.mu.get_units();
+    if (!fut.available()) {
+        co_await dispatch_queued(leader, q);
+    }
+    units.return_all();
+    co_return co_await std::move(fut);
+}
+
+ss::future<>
+producer::dispatch_queued(model::node_id leader, broker_queue& q) {
+    std::vector<queued_batch> batches;
+    size_t request_bytes = 0;
+    auto it = q.batches.begin();
+    for (; it != q.batches.end(); ++it) {
+        if (!batches.empty() && request_bytes >= max_queued_request_bytes) {
+            break;
+        }
+        request_bytes += it->batch.size_bytes();
+        batches.push_back(std::move(*it));
     }
+    q.batches.erase(q.batches.begin(), it);
 
-    co_return partition;
+    std::vector<produce_request::topic> topics;
+    for (auto& b : batches) {
+        auto t_it = std::find_if(
+          topics.begin(), topics.end(), [&b](const auto& t) {
+              return t.name == b.tp.topic;
+          });
+        if (t_it == topics.end()) {
+            t_it = topics.insert(
+              topics.end(), produce_request::topic{.name{b.tp.topic}});
+        }
+        t_it->partitions.push_back(produce_request::partition{
+          .partition_index{b.tp.partition},
+          .records = produce_request_record_data(std::move(b.batch))});
+    }
+
+    produce_response res;
+    try {
+        auto broker = co_await _brokers.find(leader);
+        std::optional<ss::sstring> t_id;
+        res = co_await broker->dispatch(
+          produce_request(t_id, _acks, std::move(topics)));
+    } catch (...) {
+        auto ex = std::current_exception();
+        for (auto& b : batches) {
+            b.promise.set_exception(ex);
+        }
+        co_return;
+    }
+
+    for (auto& b : batches) {
+        std::optional<produce_response::partition> partition;
+        for (auto& topic : res.data.responses) {
+            if (topic.name != b.tp.topic) {
+                continue;
+            }
+            for (auto& p : topic.partitions) {
+                if (p.partition_index == b.tp.partition) {
+                    partition = std::move(p);
+                    break;
+                }
+            }
+        }
+        if (!partition) {
+            b.promise.set_exception(
+              partition_error(b.tp, error_code::unknown_server_error));
+        } else if (partition->error_code != error_code::none) {
+            b.promise.set_exception(
+              partition_error(b.tp, partition->error_code));
+        } else {
+            b.promise.set_value(std::move(*partition));
+        }
+    }
 }
 
 ss::future<>
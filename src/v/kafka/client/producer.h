@@ -17,8 +17,12 @@
 #include "kafka/client/topic_cache.h"
 #include "model/fundamental.h"
 #include "ssx/future-util.h"
+#include "utils/mutex.h"
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/node_hash_map.h>
+
+#include <vector>
 
 namespace kafka::client {
 
@@ -56,6 +60,24 @@ private:
     ss::future<produce_response::partition>
     do_send(model::topic_partition tp, model::record_batch batch);
 
+    /// \brief A batch queued to be sent to the leader of its partition
+    struct queued_batch {
+        model::topic_partition tp;
+        model::record_batch batch;
+        ss::promise<produce_response::partition> promise;
+    };
+
+    /// \brief The batches queued for a broker
+    ///
+    /// The requests to a broker are serialized, the batches queued while a
+    /// request is in flight are sent together in the next one.
+    struct broker_queue {
+        std::vector<queued_batch> batches;
+        mutex mu;
+    };
+
+    ss::future<> dispatch_queued(model::node_id leader, broker_queue& q);
+
     auto make_consumer(model::topic_partition tp) {
         return [this, tp](model::record_batch&& batch) {
             (void)send(tp, std::move(batch));
@@ -80,6 +102,7 @@ private:
     topic_cache& _topic_cache;
     brokers& _brokers;
     int16_t _acks;
+    absl::node_hash_map<model::node_id, broker_queue> _broker_queues;
     ss::abort_source _as;
     ss::abort_source _ingest_as;
     ss::gate _gate;
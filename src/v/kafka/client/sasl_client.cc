@@ -14,6 +14,9 @@
 #include "security/oidc_authenticator.h"
 #include "security/scram_authenticator.h"
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
+
 namespace kafka::client {
 
 ss::future<>
@@ -126,6 +129,53 @@ static ss::future<security::server_final_message> send_scram_client_final(
       std::move(client_last_resp.data.auth_bytes));
 }
 
+namespace {
+
+struct salted_password_key {
+    ss::sstring password;
+    bytes salt;
+    int iterations;
+
+    friend bool
+    operator==(const salted_password_key&, const salted_password_key&)
+      = default;
+
+    template<typename H>
+    friend H AbslHashValue(H h, const salted_password_key& k) {
+        return H::combine(
+          std::move(h),
+          std::string_view{k.password},
+          std::string_view{
+            reinterpret_cast<const char*>(k.salt.data()), k.salt.size()},
+          k.iterations);
+    }
+};
+
+/// The passwords salted by the recent authentications of the shard. A broker
+/// answers with the salt and iterations of the credential, which are the
+/// same on every broker and every connection until the credential changes:
+/// the clients reconnecting to the brokers need not salt the password again.
+template<typename ScramAlgo>
+ss::future<bytes> salt_password(
+  const ss::sstring& password, const bytes& salt, int iterations) {
+    static constexpr size_t max_cached = 64;
+    static thread_local absl::flat_hash_map<salted_password_key, bytes> cache;
+
+    salted_password_key key{password, salt, iterations};
+    if (auto it = cache.find(key); it != cache.end()) {
+        co_return it->second;
+    }
+    auto salted_password = co_await ScramAlgo::hi_gently(
+      bytes(password.cbegin(), password.cend()), salt, iterations);
+    if (cache.size() >= max_cached) {
+        cache.clear();
+    }
+    cache.insert_or_assign(std::move(key), salted_password);
+    co_return salted_password;
+}
+
+} // namespace
+
 template<typename ScramAlgo>
 static ss::future<> do_authenticate_scram(
   shared_broker_t broker, ss::sstring username, ss::sstring password) {
@@ -166,10 +216,8 @@ static ss::future<> do_authenticate_scram(
     security::client_final_message client_final(
       bytes("n,,"), server_first.nonce());
 
-    auto salted_password = ScramAlgo::hi(
-      bytes(password.cbegin(), password.cend()),
-      server_first.salt(),
-      server_first.iterations());
+    auto salted_password = co_await salt_password<ScramAlgo>(
+      password, server_first.salt(), server_first.iterations());
 
     client_final.set_proof(ScramAlgo::client_proof(
       salted_password, client_first, server_first, client_final));
@@ -0,0 +1,83 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/client/topic_cache.h"
+
+#include "kafka/client/exceptions.h"
+#include "kafka/protocol/errors.h"
+#include "kafka/protocol/metadata.h"
+#include "model/fundamental.h"
+#include "utils/fragmented_vector.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+
+namespace kc = kafka::client;
+
+namespace {
+
+kafka::metadata_response::topic make_topic(
+  std::string_view name,
+  std::vector<model::node_id> leaders,
+  kafka::error_code ec = kafka::error_code::none) {
+    kafka::metadata_response::topic t{
+      .error_code = ec, .name = model::topic{name}};
+    for (size_t i = 0; i < leaders.size(); ++i) {
+        t.partitions.push_back(kafka::metadata_response::partition{
+          .partition_index = model::partition_id(i),
+          .leader_id = leaders[i]});
+    }
+    return t;
+}
+
+small_fragment_vector<kafka::metadata_response::topic>
+make_topics(std::vector<kafka::metadata_response::topic> topics) {
+    small_fragment_vector<kafka::metadata_response::topic> res;
+    for (auto& t : topics) {
+        res.push_back(std::move(t));
+    }
+    return res;
+}
+
+model::node_id leader(kc::topic_cache& c, std::string_view t, int p) {
+    return c
+      .leader(model::topic_partition{model::topic{t}, model::partition_id{p}})
+      .get();
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_topic_cache_apply_topics) {
+    kc::topic_cache cache;
+    cache
+      .apply(make_topics(
+        {make_topic("a", {model::node_id{1}, model::node_id{2}}),
+         make_topic("b", {model::node_id{1}})}))
+      .get();
+    BOOST_REQUIRE_EQUAL(leader(cache, "a", 1), model::node_id{2});
+    BOOST_REQUIRE_EQUAL(leader(cache, "b", 0), model::node_id{1});
+
+    // Only the topics of the response are updated
+    cache
+      .apply_topics(
+        make_topics({make_topic("a", {model::node_id{1}, model::node_id{3}})}))
+      .get();
+    BOOST_REQUIRE_EQUAL(leader(cache, "a", 1), model::node_id{3});
+    BOOST_REQUIRE_EQUAL(leader(cache, "b", 0), model::node_id{1});
+
+    // New topics are added, and the topics with an error removed
+    cache
+      .apply_topics(make_topics(
+        {make_topic("c", {model::node_id{2}}),
+         make_topic("b", {}, kafka::error_code::unknown_topic_or_partition)}))
+      .get();
+    BOOST_REQUIRE_EQUAL(leader(cache, "c", 0), model::node_id{2});
+    BOOST_REQUIRE_THROW(leader(cache, "b", 0), kc::partition_error);
+}
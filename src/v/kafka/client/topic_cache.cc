@@ -12,6 +12,7 @@
 #include "kafka/client/brokers.h"
 #include "kafka/client/exceptions.h"
 #include "kafka/client/partitioners.h"
+#include "kafka/protocol/errors.h"
 #include "kafka/protocol/metadata.h"
 #include "random/generators.h"
 #include "utils/fragmented_vector.h"
@@ -20,27 +21,56 @@
 
 namespace kafka::client {
 
+topic_cache::topic_data
+topic_cache::make_topic_data(const metadata_response::topic& t) {
+    const auto initial_partition_id = model::partition_id{
+      random_generators::get_int<model::partition_id::type>(
+        t.partitions.size())};
+    topic_data topic_data{
+      .partitioner_func = default_partitioner(initial_partition_id)};
+    topic_data.partitions.reserve(t.partitions.size());
+    for (auto const& p : t.partitions) {
+        topic_data.partitions.emplace(
+          p.partition_index, partition_data{.leader = p.leader_id});
+    }
+    topic_data.partitions.rehash(0);
+    return topic_data;
+}
+
 ss::future<>
 topic_cache::apply(small_fragment_vector<metadata_response::topic>&& topics) {
     topics_t cache;
     cache.reserve(topics.size());
     for (const auto& t : topics) {
-        const auto initial_partition_id = model::partition_id{
-          random_generators::get_int<model::partition_id::type>(
-            t.partitions.size())};
-        topic_data topic_data{
-          .partitioner_func = default_partitioner(initial_partition_id)};
-        auto& cache_t
-          = cache.emplace(t.name, std::move(topic_data)).first->second;
-        cache_t.partitions.reserve(t.partitions.size());
+        cache.emplace(t.name, make_topic_data(t));
+    }
+    cache.rehash(0);
+    std::exchange(_topics, std::move(cache));
+    return ss::now();
+}
+
+ss::future<> topic_cache::apply_topics(
+  small_fragment_vector<metadata_response::topic>&& topics) {
+    for (const auto& t : topics) {
+        if (t.error_code != error_code::none) {
+            _topics.erase(t.name);
+            continue;
+        }
+        auto it = _topics.find(t.name);
+        if (it == _topics.end()) {
+            _topics.emplace(t.name, make_topic_data(t));
+            continue;
+        }
+        // Keep the partitioner, so that the records without a key keep
+        // being spread from where they were.
+        auto& partitions = it->second.partitions;
+        partitions.clear();
+        partitions.reserve(t.partitions.size());
         for (auto const& p : t.partitions) {
-            cache_t.partitions.emplace(
+            partitions.emplace(
               p.partition_index, partition_data{.leader = p.leader_id});
         }
-        cache_t.partitions.rehash(0);
     }
-    cache.rehash(0);
-    std::exchange(_topics, std::move(cache));
     return ss::now();
 }
 
@@ -50,6 +50,11 @@ public:
     ss::future<>
     apply(small_fragment_vector<metadata_response::topic>&& topics);
 
+    /// \brief Apply the metadata of some of the topics, leaving the others
+    /// as they are. The topics with an error are removed.
+    ss::future<>
+    apply_topics(small_fragment_vector<metadata_response::topic>&& topics);
+
     /// \brief Obtain the leader for the given topic-partition
     ss::future<model::node_id> leader(model::topic_partition tp) const;
 
@@ -58,6 +63,8 @@ public:
     partition_for(model::topic_view tv, const record_essence& rec);
 
 private:
+    static topic_data make_topic_data(const metadata_response::topic& t);
+
     /// \brief Cache of topic information.
     topics_t _topics;
 };
@@ -21,6 +21,7 @@
 
 #include <seastar/core/metrics.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/node_hash_map.h>
 
 namespace kafka {
@@ -95,7 +96,7 @@ class group_probe {
     using member_map = absl::node_hash_map<kafka::member_id, member_ptr>;
     using static_member_map
       = absl::node_hash_map<kafka::group_instance_id, kafka::member_id>;
-    using offsets_map = absl::node_hash_map<KeyType, ValType>;
+    using offsets_map = absl::flat_hash_map<KeyType, ValType>;
 
 public:
     explicit group_probe(
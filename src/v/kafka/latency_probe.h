@@ -14,7 +14,7 @@
 #include "config/configuration.h"
 #include "metrics/metrics.h"
 #include "prometheus/prometheus_sanitize.h"
-#include "utils/log_hist.h"
+#include "utils/latency_hist.h"
 
 #include <seastar/core/metrics.hh>
 
@@ -23,7 +23,7 @@
 namespace kafka {
 class latency_probe {
 public:
-    using hist_t = log_hist_internal;
+    using hist_t = latency_hist;
 
     latency_probe() = default;
     latency_probe(const latency_probe&) = delete;
@@ -107,23 +107,29 @@ public:
           });
     }
 
-    std::unique_ptr<hist_t::measurement> auto_produce_measurement() {
-        return _produce_latency.auto_measure();
+    void record_produce_latency(std::chrono::nanoseconds d) {
+        _produce_latency.record(d);
     }
 
-    void record_fetch_latency(std::chrono::microseconds micros) {
-        _fetch_latency.record(micros.count());
+    void record_fetch_latency(std::chrono::nanoseconds d) {
+        _fetch_latency.record(d);
     }
 
     void record_fetch_plan_and_execute_measurement(
-      std::chrono::microseconds micros, bool empty) {
+      std::chrono::nanoseconds d, bool empty) {
         if (empty) {
-            _fetch_plan_and_execute_latency_empty.record(micros.count());
+            _fetch_plan_and_execute_latency_empty.record(d);
         } else {
-            _fetch_plan_and_execute_latency.record(micros.count());
+            _fetch_plan_and_execute_latency.record(d);
         }
     }
 
+    const hist_t& produce_latency() const { return _produce_latency; }
+    /// unlike the fetch latency, excludes the time waiting for data
+    const hist_t& fetch_plan_and_execute_latency() const {
+        return _fetch_plan_and_execute_latency;
+    }
+
 private:
     hist_t _produce_latency;
     hist_t _fetch_latency;
@@ -133,7 +133,49 @@ void kafka_batch_adapter::verify_crc(int32_t expected_crc, iobuf_parser in) {
     }
 }
 
+bool kafka_batch_adapter::validate_records(const model::record_batch& b) {
+    /**
+     * Perform some type of validation on the uncompressed input. In this case
+     * we make sure that the records can be materialized but we avoid
+     * re-encoding them using the lazy-record optimization.
+     */
+    if (!b.compressed()) {
+        try {
+            b.for_each_record([](model::record r) { (void)r; });
+        } catch (const std::exception& e) {
+            vlog(klog.error, "Parsing uncompressed records: {}", e.what());
+            return false;
+        }
+    }
+    return true;
+}
+
+void kafka_batch_adapter::verify() {
+    if (!_unverified) {
+        return;
+    }
+    auto data = std::move(*_unverified);
+    _unverified.reset();
+    if (!batch) {
+        return;
+    }
+
+    verify_crc(batch->header().crc, iobuf_parser(std::move(data)));
+    if (unlikely(!valid_crc)) {
+        vlog(klog.warn, "batch has invalid CRC: {}", batch->header());
+        batch.reset();
+        return;
+    }
+    if (!validate_records(*batch)) {
+        batch.reset();
+    }
+}
+
 iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
+    return do_adapt(std::move(kbatch), false);
+}
+
+iobuf kafka_batch_adapter::do_adapt(iobuf&& kbatch, bool defer_verification) {
     // The batch size given in the kafka header does not include the offset
     // preceeding the length field nor the size of the length field itself.
     constexpr size_t kafka_length_diff
@@ -155,7 +197,7 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
       batch_length, kbatch.size_bytes() - batch_length);
     kbatch.trim_back(remainder.size_bytes());
 
-    auto crcparser = iobuf_parser(kbatch.share(0, kbatch.size_bytes()));
+    auto crcdata = kbatch.share(0, kbatch.size_bytes());
     auto parser = iobuf_parser(std::move(kbatch));
 
     auto header = read_header(parser);
@@ -166,10 +208,16 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
         return remainder;
     }
 
-    verify_crc(header.crc, std::move(crcparser));
-    if (unlikely(!valid_crc)) {
-        vlog(klog.warn, "batch has invalid CRC: {}", header);
-        return remainder;
+    if (defer_verification) {
+        // checked by verify()
+        valid_crc = true;
+        _unverified = std::move(crcdata);
+    } else {
+        verify_crc(header.crc, iobuf_parser(std::move(crcdata)));
+        if (unlikely(!valid_crc)) {
+            vlog(klog.warn, "batch has invalid CRC: {}", header);
+            return remainder;
+        }
     }
 
     auto records_size = header.size_bytes
@@ -179,18 +227,8 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
     auto new_batch = model::record_batch(
       header, std::move(records), model::record_batch::tag_ctor_ng{});
 
-    /**
-     * Perform some type of validation on the uncompressed input. In this case
-     * we make sure that the records can be materialized but we avoid
-     * re-encoding them using the lazy-record optimization.
-     */
-    if (!new_batch.compressed()) {
-        try {
-            new_batch.for_each_record([](model::record r) { (void)r; });
-        } catch (const std::exception& e) {
-            vlog(klog.error, "Parsing uncompressed records: {}", e.what());
-            return remainder;
-        }
+    if (!defer_verification && !validate_records(new_batch)) {
+        return remainder;
     }
 
     batch = std::move(new_batch);
@@ -276,7 +314,7 @@ void kafka_batch_adapter::convert_message_set(
 void kafka_batch_adapter::adapt_with_version(
   iobuf kbatch, api_version version) {
     if (version >= api_version(3)) {
-        adapt(std::move(kbatch));
+        do_adapt(std::move(kbatch), true);
         return;
     }
 
@@ -68,12 +68,28 @@ public:
 
     std::optional<model::record_batch> batch;
 
+    /*
+     * Decodes the batch of a produce request. The CRC and records checks of
+     * version 2 batches are deferred: valid_crc is true until verify() runs
+     * them, so that they can be done on the core handling the partition.
+     */
     void adapt_with_version(iobuf, api_version);
 
+    /*
+     * Runs the checks deferred by adapt_with_version. On failure, valid_crc is
+     * cleared or the batch is reset, as adapt would have done.
+     */
+    void verify();
+
 private:
+    iobuf do_adapt(iobuf&&, bool defer_verification);
     void verify_crc(int32_t, iobuf_parser);
+    bool validate_records(const model::record_batch&);
     model::record_batch_header read_header(iobuf_parser&);
     void convert_message_set(storage::record_batch_builder&, iobuf, bool);
+
+    // the checksummed batch data, shared with the batch, until verified
+    std::optional<iobuf> _unverified;
 };
 
 /*
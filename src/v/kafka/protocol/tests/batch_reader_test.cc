@@ -143,6 +143,37 @@ SEASTAR_THREAD_TEST_CASE(consumer_records_consume_batch_fail_crc) {
     BOOST_REQUIRE(!kba.valid_crc);
 }
 
+SEASTAR_THREAD_TEST_CASE(produce_batch_deferred_verification) {
+    auto ctx = make_context(base_offset, 1);
+
+    kafka::kafka_batch_adapter kba;
+    kba.adapt_with_version(std::move(ctx.record_set), kafka::api_version(9));
+    BOOST_REQUIRE(kba.v2_format);
+    BOOST_REQUIRE(kba.valid_crc);
+    BOOST_REQUIRE(kba.batch);
+
+    kba.verify();
+    BOOST_REQUIRE(kba.valid_crc);
+    BOOST_REQUIRE(kba.batch);
+    BOOST_REQUIRE_EQUAL(kba.batch->last_offset(), ctx.last_offset);
+}
+
+SEASTAR_THREAD_TEST_CASE(produce_batch_deferred_verification_fail_crc) {
+    auto ctx = make_context(base_offset, 1);
+    corrupt_offset<int32_t>(
+      ctx.record_set, crc_offset, [](int32_t& t) { --t; });
+
+    kafka::kafka_batch_adapter kba;
+    kba.adapt_with_version(std::move(ctx.record_set), kafka::api_version(9));
+    // the CRC is only checked by verify()
+    BOOST_REQUIRE(kba.valid_crc);
+    BOOST_REQUIRE(kba.batch);
+
+    kba.verify();
+    BOOST_REQUIRE(!kba.valid_crc);
+    BOOST_REQUIRE(!kba.batch);
+}
+
 SEASTAR_THREAD_TEST_CASE(batch_reader_record_batch_reader_impl) {
     auto ctx = make_context(base_offset, many_batches);
 
@@ -0,0 +1,81 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "kafka/protocol/batch_consumer.h"
+#include "kafka/protocol/kafka_batch_adapter.h"
+#include "model/fundamental.h"
+#include "model/tests/random_batch.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <vector>
+
+namespace {
+
+constexpr int records_per_batch = 1000;
+constexpr size_t record_size = 1024;
+
+// a kafka encoded, uncompressed batch of about 1MiB
+iobuf& produced_batch() {
+    static thread_local iobuf data = [] {
+        auto batch = model::test::make_random_batch(
+          model::offset(0),
+          records_per_batch,
+          false,
+          model::record_batch_type::raft_data,
+          std::vector<size_t>(records_per_batch, record_size));
+        kafka::kafka_batch_serializer serializer;
+        (void)serializer(std::move(batch));
+        return serializer.end_of_stream().data;
+    }();
+    return data;
+}
+
+template<typename F>
+size_t decode_body(F f) {
+    auto& data = produced_batch();
+    kafka::kafka_batch_adapter adapter;
+    perf_tests::start_measuring_time();
+    f(adapter, data.share(0, data.size_bytes()));
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(adapter.batch);
+    return data.size_bytes();
+}
+
+} // namespace
+
+// the work done on the connection's shard when the batch is verified there
+PERF_TEST(produce_batch, decode_and_verify) {
+    return decode_body([](kafka::kafka_batch_adapter& adapter, iobuf data) {
+        adapter.adapt_with_version(std::move(data), kafka::api_version(9));
+        adapter.verify();
+    });
+}
+
+// the work left on the connection's shard when the batch is verified on the
+// shard of the partition
+PERF_TEST(produce_batch, decode_deferred_verification) {
+    return decode_body([](kafka::kafka_batch_adapter& adapter, iobuf data) {
+        adapter.adapt_with_version(std::move(data), kafka::api_version(9));
+    });
+}
+
+// the work moved to the shard of the partition
+PERF_TEST(produce_batch, verify) {
+    auto& data = produced_batch();
+    kafka::kafka_batch_adapter adapter;
+    adapter.adapt_with_version(
+      data.share(0, data.size_bytes()), kafka::api_version(9));
+    perf_tests::start_measuring_time();
+    adapter.verify();
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(adapter.valid_crc);
+    return data.size_bytes();
+}
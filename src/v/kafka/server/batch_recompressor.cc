@@ -0,0 +1,58 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/batch_recompressor.h"
+
+#include "storage/parser_utils.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/with_scheduling_group.hh>
+
+#include <algorithm>
+
+namespace kafka {
+
+batch_recompressor::batch_recompressor(
+  ss::scheduling_group sg, size_t max_bytes)
+  : _sg(sg)
+  , _max_bytes(max_bytes)
+  , _memory(max_bytes, "kafka/batch-recompression") {}
+
+std::optional<model::compression> batch_recompressor::target_compression(
+  model::compression topic_compression,
+  const model::record_batch_header& hdr) {
+    if (
+      topic_compression == model::compression::producer
+      || topic_compression == hdr.attrs.compression()
+      || hdr.attrs.is_control()) {
+        return std::nullopt;
+    }
+    return topic_compression;
+}
+
+ss::future<model::record_batch> batch_recompressor::recompress(
+  model::record_batch batch, model::compression target) {
+    // a batch larger than the bound waits for the others to complete
+    const auto in = static_cast<size_t>(batch.size_bytes());
+    auto units = co_await ss::get_units(_memory, std::min(in, _max_bytes));
+    auto out = co_await ss::with_scheduling_group(
+      _sg, [target, batch = std::move(batch)]() mutable {
+          return storage::internal::decompress_batch(std::move(batch))
+            .then([target](model::record_batch batch) {
+                return storage::internal::compress_batch(
+                  target, std::move(batch));
+            });
+      });
+    ++_batches;
+    _bytes_in += in;
+    _bytes_out += out.size_bytes();
+    co_return out;
+}
+
+} // namespace kafka
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "model/compression.h"
+#include "model/record.h"
+#include "seastarx.h"
+#include "ssx/semaphore.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/scheduling.hh>
+
+#include <optional>
+
+namespace kafka {
+
+/**
+ * Transcodes produced batches to the compression type of their topic, on
+ * the shard of the partition before they are appended, e.g. to compress
+ * with zstd the batches of producers which cannot be reconfigured.
+ *
+ * The codecs run in their own scheduling group, so that the produce
+ * requests of the other topics are not delayed behind them. The bytes of
+ * the batches being transcoded are bounded: past the bound the produce
+ * requests wait, which in turn holds back the reads of their connections.
+ */
+class batch_recompressor {
+public:
+    batch_recompressor(ss::scheduling_group, size_t max_bytes);
+
+    /**
+     * The compression type the batch must be transcoded to, or nullopt
+     * when it is appended as produced: the topic keeps the compression of
+     * the producer, or it is already the one of the batch.
+     */
+    static std::optional<model::compression> target_compression(
+      model::compression topic_compression,
+      const model::record_batch_header&);
+
+    /// \throw std::exception If the batch can not be decompressed
+    ss::future<model::record_batch>
+      recompress(model::record_batch, model::compression);
+
+    uint64_t batches() const { return _batches; }
+    uint64_t bytes_in() const { return _bytes_in; }
+    uint64_t bytes_out() const { return _bytes_out; }
+
+private:
+    ss::scheduling_group _sg;
+    size_t _max_bytes;
+    ssx::semaphore _memory;
+    uint64_t _batches{0};
+    uint64_t _bytes_in{0};
+    uint64_t _bytes_out{0};
+};
+
+} // namespace kafka
@@ -15,6 +15,13 @@
 #include "bytes/scattered_message.h"
 #include "config/configuration.h"
 #include "kafka/protocol/sasl_authenticate.h"
+#include "kafka/protocol/schemata/api_versions_request.h"
+#include "kafka/protocol/schemata/describe_configs_request.h"
+#include "kafka/protocol/schemata/describe_groups_request.h"
+#include "kafka/protocol/schemata/fetch_request.h"
+#include "kafka/protocol/schemata/list_groups_request.h"
+#include "kafka/protocol/schemata/list_offset_request.h"
+#include "kafka/protocol/schemata/metadata_request.h"
 #include "kafka/sasl_probe.h"
 #include "kafka/server/handlers/fetch.h"
 #include "kafka/server/handlers/handler_interface.h"
@@ -46,6 +53,20 @@ using namespace std::chrono_literals;
 
 namespace kafka {
 
+namespace {
+/*
+ * Requests that only read state, so the next requests of the connection do not
+ * depend on their execution and can be read and dispatched while they run.
+ * Their responses are still sent in request order.
+ */
+bool is_pipelined(api_key key) {
+    return key == fetch_api::key || key == metadata_api::key
+           || key == api_versions_api::key || key == list_offsets_api::key
+           || key == describe_configs_api::key
+           || key == describe_groups_api::key || key == list_groups_api::key;
+}
+} // namespace
+
 connection_context::connection_context(
   std::optional<
     std::reference_wrapper<boost::intrusive::list<connection_context>>> hook,
@@ -69,9 +90,28 @@ connection_context::connection_context(
   , _mtls_state(std::move(mtls_state))
   , _max_request_size(std::move(max_request_size))
   , _kafka_throughput_controlled_api_keys(
-      std::move(kafka_throughput_controlled_api_keys)) {}
+      std::move(kafka_throughput_controlled_api_keys))
+  , _memory_budget(
+      config::shard_local_cfg().kafka_connection_memory_budget().value_or(
+        static_cast<size_t>(s.cfg.max_service_memory_per_core)))
+  , _memory(_memory_budget, "kafka/conn-mem") {
+    if (auto window = config::shard_local_cfg()
+                        .kafka_max_pipelined_requests_per_connection();
+        window > 0) {
+        _in_flight.emplace(window, "kafka/conn-in-flight");
+    }
+}
 
-connection_context::~connection_context() noexcept = default;
+connection_context::~connection_context() noexcept {
+    if (_budget_principal) {
+        _principal_memory = nullptr;
+        _server.release_principal_memory(*_budget_principal);
+    }
+}
+
+size_t connection_context::memory_held() const {
+    return _memory_budget - std::min(_memory_budget, _memory.current());
+}
 
 ss::future<> connection_context::start() {
     co_await _as.start(_server.abort_source());
@@ -260,6 +300,7 @@ ss::future<> connection_context::process_one_request() {
     if (!sz.has_value()) {
         co_return;
     }
+    conn->mark_active(sz.value());
 
     if (sz.value() > _max_request_size()) {
         throw net::invalid_request_error(fmt::format(
@@ -489,7 +530,7 @@ ss::future<session_resources> connection_context::throttle_request(
              delay = delay.request,
              track,
              tracker = std::move(tracker),
-             &h_probe](ssx::semaphore_units units) mutable {
+             &h_probe](request_memory units) mutable {
           return server().get_request_unit().then(
             [this,
              r_data = std::move(r_data),
@@ -500,7 +541,10 @@ ss::future<session_resources> connection_context::throttle_request(
              &h_probe](ssx::semaphore_units qd_units) mutable {
                 session_resources r{
                   .backpressure_delay = delay,
-                  .memlocks = std::move(mem_units),
+                  .memlocks = std::move(mem_units.server),
+                  .connection_memlocks = std::move(mem_units.connection),
+                  .principal_memory = std::move(mem_units.principal_memory),
+                  .principal_memlocks = std::move(mem_units.principal),
                   .queue_units = std::move(qd_units),
                   .tracker = std::move(tracker),
                   .request_data = std::move(r_data)};
@@ -513,7 +557,26 @@ ss::future<session_resources> connection_context::throttle_request(
       });
 }
 
-ss::future<ssx::semaphore_units>
+ss::lw_shared_ptr<principal_memory_budget>
+connection_context::principal_memory() {
+    auto budget = config::shard_local_cfg().kafka_principal_memory_budget();
+    auto principal = get_principal();
+    if (_budget_principal != principal) {
+        if (_budget_principal) {
+            _principal_memory = nullptr;
+            _server.release_principal_memory(*_budget_principal);
+            _budget_principal.reset();
+        }
+        // anonymous connections don't share a budget
+        if (budget && !principal.name().empty()) {
+            _principal_memory = _server.principal_memory(principal, *budget);
+            _budget_principal = std::move(principal);
+        }
+    }
+    return _principal_memory;
+}
+
+ss::future<connection_context::request_memory>
 connection_context::reserve_request_units(api_key key, size_t size) {
     // Defer to the handler for the request type for the memory estimate, but
     // if the request isn't found, use the default estimate (although in that
@@ -530,15 +593,53 @@ connection_context::reserve_request_units(api_key key, size_t size) {
           mem_estimate,
           handler ? (*handler)->name() : "<bad key>"));
     }
-    auto fut = ss::get_units(_server.memory(), mem_estimate);
+
+    request_memory units;
+    // a request larger than a budget takes all of it and runs alone
+    const auto conn_units = std::min(mem_estimate, _memory_budget);
+    if (_memory.current() < conn_units) {
+        vlog(
+          klog.debug,
+          "{} holds {} bytes of its memory budget, waiting for {} more",
+          conn ? conn->addr : ss::socket_address{},
+          memory_held(),
+          conn_units);
+        _server.connection_waiting_for_memory();
+    }
+    const auto& wait_stats = _server.get_memory_wait_stats();
+    units.connection = co_await record_semaphore_wait(
+      wait_stats.connection, ss::get_units(_memory, conn_units));
+
+    units.principal_memory = principal_memory();
+    if (units.principal_memory) {
+        auto& sem = units.principal_memory->memory;
+        const auto principal_units = std::min(
+          mem_estimate, units.principal_memory->budget);
+        if (sem.current() < principal_units) {
+            vlog(
+              klog.debug,
+              "{} waits for {} bytes of the memory budget of {}",
+              conn ? conn->addr : ss::socket_address{},
+              principal_units,
+              *_budget_principal);
+            _server.principal_waiting_for_memory();
+        }
+        units.principal = co_await record_semaphore_wait(
+          wait_stats.principal, ss::get_units(sem, principal_units));
+    }
+
+    auto fut = record_semaphore_wait(
+      wait_stats.server, ss::get_units(_server.memory(), mem_estimate));
     if (_server.memory().waiters()) {
         _server.probe().waiting_for_available_memory();
     }
-    return fut;
+    units.server = co_await std::move(fut);
+    co_return units;
 }
 
 ss::future<>
 connection_context::dispatch_method_once(request_header hdr, size_t size) {
+    auto trace = _server.maybe_trace_request(hdr.key);
     auto sres_in = co_await throttle_request(hdr, size);
     if (abort_requested()) {
         // protect against shutdown behavior
@@ -559,6 +660,16 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
         }
     }
 
+    if (_in_flight) {
+        // the window is released when the response has been written
+        sres_in.in_flight_units = co_await ss::get_units(*_in_flight, 1);
+        if (abort_requested()) {
+            co_return;
+        }
+    }
+
+    request_trace::end_stage(trace.get(), "kafka.throttle");
+    sres_in.trace = std::move(trace);
     auto sres = ss::make_lw_shared(std::move(sres_in));
 
     auto remaining = size - request_header_size - hdr.client_id_buffer.size()
@@ -568,9 +679,11 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
         // _server._cntrl etc might not be alive
         co_return;
     }
+    request_trace::end_stage(sres->trace.get(), "kafka.read_request");
     auto self = shared_from_this();
     auto rctx = request_context(
       self, std::move(hdr), std::move(buf), sres->backpressure_delay);
+    rctx.set_trace(sres->trace.get());
     /*
      * we process requests in order since all subsequent requests
      * are dependent on authentication having completed.
@@ -592,13 +705,44 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
      */
 
     const auto correlation = rctx.header().correlation;
+    const auto pipelined = _in_flight && is_pipelined(rctx.header().key);
     const sequence_id seq = _seq_idx;
     _seq_idx = _seq_idx + sequence_id(1);
     auto res = kafka::process_request(
       std::move(rctx), _server.smp_group(), *sres);
 
     /*
-     * first stage processed in a foreground.
+     * a pipelined request is dispatched in the background: the next requests
+     * are read while it runs, e.g. a produce is not held back by a fetch
+     * waiting for data. the window of in flight requests bounds how far ahead
+     * the connection is read.
+     */
+    if (pipelined) {
+        ssx::spawn_with_gate(
+          _server.conn_gate(),
+          [this,
+           self,
+           res = std::move(res),
+           sres = std::move(sres),
+           seq,
+           correlation]() mutable {
+              return handle_dispatch(
+                self, std::move(res), std::move(sres), seq, correlation);
+          });
+        co_return;
+    }
+    co_await handle_dispatch(
+      std::move(self), std::move(res), std::move(sres), seq, correlation);
+}
+
+ss::future<> connection_context::handle_dispatch(
+  ss::lw_shared_ptr<connection_context> self,
+  process_result_stages res,
+  ss::lw_shared_ptr<session_resources> sres,
+  sequence_id seq,
+  correlation_id correlation) {
+    /*
+     * first stage processed in a foreground, unless the request is pipelined.
      *
      * if the dispatch/first stage failed, then we need to
      * need to consume the second stage since it might be
@@ -623,6 +767,7 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
         sres->tracker->mark_errored();
         co_return;
     }
+    request_trace::end_stage(sres->trace.get(), "kafka.dispatch");
 
     /**
      * second stage processed in background.
@@ -648,8 +793,10 @@ ss::future<> connection_context::handle_response(
     std::exception_ptr e;
     try {
         auto r = co_await std::move(f);
+        request_trace::end_stage(sres->trace.get(), "kafka.handle");
         r->set_correlation(correlation);
-        response_and_resources randr{std::move(r), sres};
+        response_and_resources randr{
+          std::move(r), sres, std::chrono::steady_clock::now()};
         _responses.insert({seq, std::move(randr)});
         co_return co_await maybe_process_responses();
     } catch (...) {
@@ -679,6 +826,12 @@ ss::future<> connection_context::handle_response(
     self->conn->shutdown_input();
 }
 
+void connection_context::finish_trace(session_resources& sres) {
+    if (sres.trace) [[unlikely]] {
+        _server.finish_request_trace(std::move(sres.trace));
+    }
+}
+
 /**
  * This method processes as many responses as possible, in request order. Since
  * we proces the second stage asynchronously within a given connection, reponses
@@ -706,10 +859,19 @@ ss::future<> connection_context::maybe_process_responses() {
 
         _responses.erase(it);
 
+        // head of line blocking: the response was ready but had to wait for
+        // the responses to earlier requests
+        _server.handler_probe(resp_and_res.resources->request_data.request_key)
+          .add_response_blocked(
+            std::chrono::steady_clock::now() - resp_and_res.ready_at);
+
         if (resp_and_res.response->is_noop()) {
+            finish_trace(*resp_and_res.resources);
             return ss::make_ready_future<ss::stop_iteration>(
               ss::stop_iteration::no);
         }
+        request_trace::end_stage(
+          resp_and_res.resources->trace.get(), "kafka.response_queue");
 
         auto msg = response_as_scattered(std::move(resp_and_res.response));
         if (
@@ -742,7 +904,11 @@ ss::future<> connection_context::maybe_process_responses() {
               })
               // release the resources only once it has been written to the
               // connection.
-              .finally([resources = resp_and_res.resources] {});
+              .finally([this, resources = resp_and_res.resources] {
+                  request_trace::end_stage(
+                    resources->trace.get(), "kafka.write_response");
+                  finish_trace(*resources);
+              });
         } catch (...) {
             resp_and_res.resources->tracker->mark_errored();
             vlog(
@@ -25,6 +25,7 @@
 #include "ssx/semaphore.h"
 #include "utils/log_hist.h"
 #include "utils/named_type.h"
+#include "utils/request_trace.h"
 
 #include <seastar/core/future.hh>
 #include <seastar/core/lowres_clock.hh>
@@ -34,6 +35,7 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <system_error>
@@ -108,16 +110,35 @@ struct request_data {
 // The resources in particular should be not be destroyed until
 // the request is complete (e.g., all the information written to
 // the socket so that no userspace buffers remain).
+/// Memory budget shared by the connections of a principal on a shard
+struct principal_memory_budget {
+    explicit principal_memory_budget(size_t budget)
+      : budget(budget)
+      , memory(budget, "kafka/principal-mem") {}
+
+    size_t budget;
+    ssx::semaphore memory;
+};
+
 struct session_resources {
     using pointer = ss::lw_shared_ptr<session_resources>;
 
     ss::lowres_clock::duration backpressure_delay;
     ssx::semaphore_units memlocks;
+    // the same memory reserved from the budgets of the connection and of its
+    // principal, if any
+    ssx::semaphore_units connection_memlocks;
+    ss::lw_shared_ptr<principal_memory_budget> principal_memory;
+    ssx::semaphore_units principal_memlocks;
     ssx::semaphore_units queue_units;
+    // the unit of the connection's window of pipelined requests, if any
+    ssx::semaphore_units in_flight_units;
     std::unique_ptr<log_hist_internal::measurement> method_latency;
     std::unique_ptr<handler_probe::hist_t::measurement> handler_latency;
     std::unique_ptr<request_tracker> tracker;
     request_data request_data;
+    // only for sampled requests
+    std::unique_ptr<request_trace> trace;
 };
 
 class connection_context final
@@ -171,6 +192,9 @@ public:
 
     bool tls_enabled() const { return conn->tls_enabled(); }
 
+    /// Memory held by the requests in flight on the connection
+    size_t memory_held() const;
+
 private:
     template<typename T>
     security::auth_result authorized_user(
@@ -191,11 +215,23 @@ private:
 
     bool is_finished_parsing() const;
 
+    struct request_memory {
+        ssx::semaphore_units connection;
+        ss::lw_shared_ptr<principal_memory_budget> principal_memory;
+        ssx::semaphore_units principal;
+        ssx::semaphore_units server;
+    };
+
     // Reserve units from memory from the memory semaphore in proportion
     // to the number of bytes the request procesisng is expected to
-    // take.
-    ss::future<ssx::semaphore_units>
-    reserve_request_units(api_key key, size_t size);
+    // take. The units are first reserved from the budgets of the connection
+    // and of the principal, so that a connection over budget stops reading
+    // without queueing for the memory of the server.
+    ss::future<request_memory> reserve_request_units(api_key key, size_t size);
+
+    // budget of the principal of the connection, reset when the principal
+    // changes
+    ss::lw_shared_ptr<principal_memory_budget> principal_memory();
 
     /// Calculated throttle delay pair.
     /// \p request is the primary throttle delay that should be applied now.
@@ -240,6 +276,8 @@ private:
      * @return ss::future<> a future which as described above.
      */
     ss::future<> maybe_process_responses();
+    // hands the trace of a completed request, if any, to the server
+    void finish_trace(session_resources&);
     ss::future<> do_process(request_context);
 
     ss::future<> handle_auth_v0(size_t);
@@ -251,6 +289,9 @@ private:
     struct response_and_resources {
         response_ptr response;
         session_resources::pointer resources;
+        // when the response was ready, to track the time it waits for the
+        // responses to earlier requests
+        std::chrono::steady_clock::time_point ready_at;
     };
 
     using sequence_id = named_type<uint64_t, struct kafka_protocol_sequence>;
@@ -263,6 +304,12 @@ private:
      * stage of processing and allows for some request handling overlap.
      */
     ss::future<> dispatch_method_once(request_header, size_t sz);
+    ss::future<> handle_dispatch(
+      ss::lw_shared_ptr<connection_context>,
+      process_result_stages,
+      ss::lw_shared_ptr<session_resources>,
+      sequence_id,
+      correlation_id);
     ss::future<> handle_response(
       ss::lw_shared_ptr<connection_context>,
       ss::future<response_ptr>,
@@ -328,6 +375,14 @@ private:
     sequence_id _next_response;
     sequence_id _seq_idx;
     map_t _responses;
+    // bounds the requests in flight when requests are pipelined
+    std::optional<ssx::semaphore> _in_flight;
+    // memory budget of the requests in flight, the memory of the server when
+    // the connection has no budget of its own
+    size_t _memory_budget;
+    ssx::semaphore _memory;
+    std::optional<security::acl_principal> _budget_principal;
+    ss::lw_shared_ptr<principal_memory_budget> _principal_memory;
     ssx::sharded_abort_source _as;
     std::optional<security::sasl_server> _sasl;
     const ss::net::inet_address _client_addr;
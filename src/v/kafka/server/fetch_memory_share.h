@@ -0,0 +1,106 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "config/property.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace kafka {
+
+/**
+ * Fair sharing of the fetch memory of a shard between the fetches reading
+ * from it at the same time.
+ *
+ * Fetch reads reserve memory without waiting for it: a large fetch reading
+ * first may take most of the memory and the fetches reading next are capped
+ * or skipped until it is released. With the sharing enabled, each fetch
+ * reading from the shard is limited to an equal share of the memory. Fetches
+ * asking for less than their share are not limited, so small fetches are not
+ * held back by large ones.
+ */
+class fetch_memory_share {
+public:
+    /// Registration of a fetch reading from the shard, released on destruction
+    class reader {
+    public:
+        reader() = default;
+        explicit reader(fetch_memory_share* share)
+          : _share(share) {
+            ++_share->_readers;
+        }
+        reader(const reader&) = delete;
+        reader& operator=(const reader&) = delete;
+        reader(reader&& o) noexcept
+          : _share(std::exchange(o._share, nullptr)) {}
+        reader& operator=(reader&& o) noexcept {
+            if (this != &o) {
+                release();
+                _share = std::exchange(o._share, nullptr);
+            }
+            return *this;
+        }
+        ~reader() { release(); }
+
+    private:
+        void release() {
+            if (_share) {
+                --_share->_readers;
+                _share = nullptr;
+            }
+        }
+
+        fetch_memory_share* _share{nullptr};
+    };
+
+    fetch_memory_share(size_t capacity, config::binding<bool> enabled)
+      : _capacity(capacity)
+      , _enabled(std::move(enabled)) {}
+
+    fetch_memory_share(const fetch_memory_share&) = delete;
+    fetch_memory_share(fetch_memory_share&&) = delete;
+    fetch_memory_share& operator=(const fetch_memory_share&) = delete;
+    fetch_memory_share& operator=(fetch_memory_share&&) = delete;
+    ~fetch_memory_share() = default;
+
+    reader register_reader() { return reader(this); }
+
+    /**
+     * Caps \p max_bytes of a registered fetch at its share of the memory.
+     * The fetches limited this way are counted.
+     */
+    size_t limit(size_t max_bytes) {
+        if (!_enabled() || _readers <= 1) {
+            return max_bytes;
+        }
+        const size_t share = _capacity / _readers;
+        if (max_bytes <= share) {
+            return max_bytes;
+        }
+        ++_limited;
+        return share;
+    }
+
+    size_t capacity() const { return _capacity; }
+    size_t readers() const { return _readers; }
+    uint64_t limited() const { return _limited; }
+
+private:
+    size_t _capacity;
+    config::binding<bool> _enabled;
+    size_t _readers{0};
+    uint64_t _limited{0};
+};
+
+} // namespace kafka
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "config/property.h"
+#include "kafka/protocol/types.h"
+#include "model/fundamental.h"
+#include "model/ktp.h"
+#include "model/record.h"
+#include "utils/intrusive_list_helpers.h"
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/timer.hh>
+
+#include <absl/container/node_hash_map.h>
+
+#include <optional>
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Short lived, shard local cache of the encoded data read for fetches.
+ *
+ * When many consumer groups tail the same partition they issue the same reads
+ * (same partition, start offset and limits) within a short time. The first
+ * read is cached and the following ones are served with fragments shared with
+ * the cached buffer, without reading and encoding the batches again.
+ *
+ * An entry is only served while the partition is in the state it was read in:
+ * the same high watermark, last stable offset and leader epoch. Otherwise the
+ * read could return more data or, after a truncation, different data. Entries
+ * expire after a fixed time, and the oldest ones are evicted when the cache
+ * grows past its byte limit. A limit of 0 disables the cache.
+ */
+class fetch_response_cache {
+public:
+    struct key {
+        model::ktp ktp;
+        model::offset start_offset;
+        model::offset max_offset;
+        size_t max_bytes;
+        model::isolation_level isolation_level;
+        bool strict_max_bytes;
+
+        bool operator==(const key&) const = default;
+
+        template<typename H>
+        friend H AbslHashValue(H h, const key& k) {
+            return H::combine(
+              std::move(h),
+              std::hash<model::ktp>{}(k.ktp),
+              k.start_offset(),
+              k.max_offset(),
+              k.max_bytes,
+              k.isolation_level,
+              k.strict_max_bytes);
+        }
+    };
+
+    struct value {
+        iobuf data;
+        uint32_t record_count{0};
+        model::offset high_watermark;
+        model::offset last_stable_offset;
+        kafka::leader_epoch leader_epoch;
+        std::vector<model::tx_range> aborted_transactions;
+
+        // data are shared, not copied
+        value share() {
+            return value{
+              .data = data.share(0, data.size_bytes()),
+              .record_count = record_count,
+              .high_watermark = high_watermark,
+              .last_stable_offset = last_stable_offset,
+              .leader_epoch = leader_epoch,
+              .aborted_transactions = aborted_transactions,
+            };
+        }
+    };
+
+    explicit fetch_response_cache(config::binding<size_t> max_bytes)
+      : _max_bytes(std::move(max_bytes)) {
+        _max_bytes.watch([this] { evict_to_fit(); });
+        _eviction_timer.set_callback([this] {
+            evict_expired();
+            if (!_entries.empty()) {
+                _eviction_timer.arm(ttl);
+            }
+        });
+    }
+
+    fetch_response_cache(const fetch_response_cache&) = delete;
+    fetch_response_cache(fetch_response_cache&&) = delete;
+    fetch_response_cache& operator=(const fetch_response_cache&) = delete;
+    fetch_response_cache& operator=(fetch_response_cache&&) = delete;
+    ~fetch_response_cache() { _eviction_timer.cancel(); }
+
+    bool enabled() const { return _max_bytes() > 0; }
+
+    /**
+     * Returns the cached read for the key if it is still valid for the
+     * current state of the partition. Stale entries are evicted.
+     */
+    std::optional<value> get(
+      const key& k,
+      model::offset high_watermark,
+      model::offset last_stable_offset,
+      kafka::leader_epoch leader_epoch) {
+        auto it = _entries.find(k);
+        if (it == _entries.end()) {
+            ++_misses;
+            return std::nullopt;
+        }
+        auto& v = it->second.v;
+        if (
+          v.high_watermark != high_watermark
+          || v.last_stable_offset != last_stable_offset
+          || v.leader_epoch != leader_epoch) {
+            erase(it);
+            ++_misses;
+            return std::nullopt;
+        }
+        ++_hits;
+        return v.share();
+    }
+
+    /// Caches the read, \p v usually shares its data with the response
+    void put(const key& k, value v) {
+        const auto size = v.data.size_bytes();
+        if (!enabled() || size == 0 || size > _max_bytes()) {
+            return;
+        }
+        if (auto it = _entries.find(k); it != _entries.end()) {
+            erase(it);
+        }
+        auto [it, _] = _entries.try_emplace(k, k, std::move(v));
+        _lru.push_back(it->second);
+        _size_bytes += size;
+        evict_to_fit();
+        if (!_eviction_timer.armed()) {
+            _eviction_timer.arm(ttl);
+        }
+    }
+
+    size_t size() const { return _entries.size(); }
+    size_t size_bytes() const { return _size_bytes; }
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+
+    constexpr static std::chrono::milliseconds ttl{1000};
+
+private:
+    struct entry {
+        entry(key k, value v)
+          : k(std::move(k))
+          , v(std::move(v))
+          , timestamp(ss::lowres_clock::now()) {}
+
+        // kept to find the entry in the map when evicting from the list
+        key k;
+        value v;
+        ss::lowres_clock::time_point timestamp;
+        intrusive_list_hook hook;
+    };
+
+    using entries_t = absl::node_hash_map<key, entry>;
+
+    void erase(entries_t::iterator it) {
+        _size_bytes -= it->second.v.data.size_bytes();
+        _lru.erase(_lru.iterator_to(it->second));
+        _entries.erase(it);
+    }
+
+    // the front of the list is the oldest entry
+    void evict_front() { erase(_entries.find(_lru.front().k)); }
+
+    void evict_to_fit() {
+        while (!_lru.empty() && _size_bytes > _max_bytes()) {
+            evict_front();
+        }
+    }
+
+    void evict_expired() {
+        const auto now = ss::lowres_clock::now();
+        while (!_lru.empty() && _lru.front().timestamp + ttl <= now) {
+            evict_front();
+        }
+    }
+
+    config::binding<size_t> _max_bytes;
+    entries_t _entries;
+    intrusive_list<entry, &entry::hook> _lru;
+    size_t _size_bytes{0};
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+    ss::timer<ss::lowres_clock> _eviction_timer;
+};
+
+} // namespace kafka
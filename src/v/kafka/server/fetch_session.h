@@ -16,6 +16,8 @@
 #include "model/timeout_clock.h"
 #include "model/timestamp.h"
 
+#include <seastar/core/future.hh>
+
 #include <absl/container/flat_hash_map.h>
 #include <boost/iterator/iterator_adaptor.hpp>
 #include <boost/iterator/transform_iterator.hpp>
@@ -40,6 +42,12 @@ struct fetch_session_partition {
  * Internally the map is based on absl::flat_hash_map containing entries that
  * are additionally linked by being elements of an intrusive list. The intrusive
  * list provides the insertion order traversal across the partitions.
+ *
+ * Partitions are also linked in a second list while they are dirty, i.e. while
+ * incremental fetches have to visit them. Partitions are dirty when added and
+ * may be marked clean once a fetch found no new data and no state change for
+ * them, until something marks them dirty again. Incremental fetches that skip
+ * idle partitions only traverse the dirty list, in the same relative order.
  */
 class fetch_partitions_linked_hash_map {
 private:
@@ -49,6 +57,7 @@ private:
 
         kafka::fetch_session_partition partition;
         intrusive_list_hook _hook;
+        intrusive_list_hook _dirty_hook;
     };
 
     struct topic_partition_hash {
@@ -99,6 +108,8 @@ private:
 
     using io_list_t = intrusive_list<entry, &entry::_hook>;
 
+    using dirty_list_t = intrusive_list<entry, &entry::_dirty_hook>;
+
     static auto make_partition_iterator(io_list_t::const_iterator it) {
         return boost::iterators::make_transform_iterator(
           it, [](const entry& e) -> const kafka::fetch_session_partition& {
@@ -106,6 +117,13 @@ private:
           });
     }
 
+    static auto make_dirty_partition_iterator(dirty_list_t::const_iterator it) {
+        return boost::iterators::make_transform_iterator(
+          it, [](const entry& e) -> const kafka::fetch_session_partition& {
+              return e.partition;
+          });
+    }
+
 public:
     using iterator = typename underlying_t::iterator;
     using const_iterator = typename underlying_t::const_iterator;
@@ -126,13 +144,24 @@ public:
           "Can not insert {} to partitions map as it is already present.",
           it->second->partition.topic_partition);
         insertion_order.push_back(*it->second);
+        dirty_order.push_back(*it->second);
+        ++_dirty_count;
     }
 
     bool contains(model::topic_partition_view v) {
         return partitions.contains(v);
     }
 
-    void erase(model::topic_partition_view v) { partitions.erase(v); }
+    void erase(model::topic_partition_view v) {
+        auto it = partitions.find(v);
+        if (it == partitions.end()) {
+            return;
+        }
+        if (it->second->_dirty_hook.is_linked()) {
+            --_dirty_count;
+        }
+        partitions.erase(it);
+    }
 
     iterator find(model::topic_partition_view v) { return partitions.find(v); }
 
@@ -152,6 +181,33 @@ public:
         return make_partition_iterator(insertion_order.cend());
     }
 
+    auto cbegin_dirty_order() const {
+        return make_dirty_partition_iterator(dirty_order.cbegin());
+    }
+
+    auto cend_dirty_order() const {
+        return make_dirty_partition_iterator(dirty_order.cend());
+    }
+
+    size_t dirty_count() const { return _dirty_count; }
+
+    /// returns true if the partition was clean
+    bool mark_dirty(iterator it) {
+        if (it->second->_dirty_hook.is_linked()) {
+            return false;
+        }
+        dirty_order.push_back(*it->second);
+        ++_dirty_count;
+        return true;
+    }
+
+    void mark_clean(iterator it) {
+        if (it->second->_dirty_hook.is_linked()) {
+            it->second->_dirty_hook.unlink();
+            --_dirty_count;
+        }
+    }
+
     size_t mem_usage() {
         using debug = absl::container_internal::hashtable_debug_internal::
           HashtableDebugAccess<underlying_t>;
@@ -162,6 +218,10 @@ public:
     void move_to_end(iterator it) {
         it->second->_hook.unlink();
         insertion_order.push_back(*it->second);
+        if (it->second->_dirty_hook.is_linked()) {
+            it->second->_dirty_hook.unlink();
+            dirty_order.push_back(*it->second);
+        }
     }
 
     iterator begin() { return partitions.begin(); }
@@ -176,6 +236,8 @@ public:
 private:
     underlying_t partitions;
     intrusive_list<entry, &entry::_hook> insertion_order;
+    dirty_list_t dirty_order;
+    size_t _dirty_count{0};
 };
 
 inline fetch_session_epoch next_epoch(fetch_session_epoch current) {
@@ -214,6 +276,37 @@ public:
 
     bool is_locked() const { return _locked; }
 
+    /**
+     * Marks a clean partition dirty, i.e. one that got new data or changed
+     * state since a fetch last found it idle. Wakes up a pending
+     * wait_for_dirty_partition.
+     */
+    void mark_dirty(model::topic_partition_view tp) {
+        auto it = _partitions.find(tp);
+        if (it == _partitions.end() || !_partitions.mark_dirty(it)) {
+            return;
+        }
+        ++_dirtied;
+        release_dirty_waiter();
+    }
+
+    /// number of times partitions were marked dirty again, see mark_dirty
+    uint64_t dirtied() const { return _dirtied; }
+
+    /// resolved by the next mark_dirty or by release_dirty_waiter
+    ss::future<> wait_for_dirty_partition() {
+        release_dirty_waiter();
+        _dirty_waiter.emplace();
+        return _dirty_waiter->get_future();
+    }
+
+    void release_dirty_waiter() {
+        if (_dirty_waiter) {
+            _dirty_waiter->set_value();
+            _dirty_waiter.reset();
+        }
+    }
+
     size_t mem_usage() {
         return sizeof(fetch_session) + _partitions.mem_usage();
     }
@@ -227,6 +320,8 @@ private:
     model::timeout_clock::time_point _last_used;
     fetch_session_epoch _epoch;
     bool _locked;
+    uint64_t _dirtied{0};
+    std::optional<ss::promise<>> _dirty_waiter;
 };
 
 using fetch_session_ptr = ss::lw_shared_ptr<fetch_session>;
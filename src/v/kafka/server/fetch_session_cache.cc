@@ -36,6 +36,8 @@ void update_fetch_session(fetch_session& session, const fetch_request& req) {
             s_it != session.partitions().end()) {
             s_it->second->partition.max_bytes = partition.max_bytes;
             s_it->second->partition.fetch_offset = partition.fetch_offset;
+            // the next fetch has to visit the partitions the client updated
+            session.partitions().mark_dirty(s_it);
         } else {
             session.partitions().emplace(
               make_fetch_partition(topic.name, partition));
@@ -144,6 +146,13 @@ fetch_session_cache::maybe_get_session(const fetch_request& req) {
     return fetch_session_ctx(session, false);
 }
 
+void fetch_session_cache::mark_dirty(
+  fetch_session_id session_id, model::topic_partition_view tp) {
+    if (auto it = _sessions.find(session_id); it != _sessions.end()) {
+        it->second->mark_dirty(tp);
+    }
+}
+
 // we split whole range from 1 to max int32_t betewen all shards
 std::optional<fetch_session_id> fetch_session_cache::new_session_id() {
     if (unlikely(
@@ -40,6 +40,9 @@ public:
     fetch_session_ctx maybe_get_session(const fetch_request& req);
     size_t size() const { return _sessions.size(); }
 
+    /// marks the partition of the session dirty, if the session still exists
+    void mark_dirty(fetch_session_id, model::topic_partition_view);
+
 private:
     using underlying_t
       = absl::flat_hash_map<fetch_session_id, fetch_session_ptr>;
@@ -20,6 +20,7 @@ class fetch_session_cache;
 class group_manager;
 class group_router;
 class partition_proxy;
+struct process_result_stages;
 class quota_manager;
 class request_context;
 class response;
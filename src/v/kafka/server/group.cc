@@ -51,6 +51,7 @@ group::group(
   config::configuration& conf,
   ss::lw_shared_ptr<ssx::rwlock> catchup_lock,
   ss::lw_shared_ptr<cluster::partition> partition,
+  ss::lw_shared_ptr<offset_commit_batcher> commit_batcher,
   model::term_id term,
   ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
   ss::sharded<features::feature_table>& feature_table,
@@ -65,6 +66,7 @@ group::group(
   , _conf(conf)
   , _catchup_lock(std::move(catchup_lock))
   , _partition(std::move(partition))
+  , _commit_batcher(std::move(commit_batcher))
   , _probe(_members, _static_members, _offsets)
   , _ctxlog(klog, *this)
   , _ctx_txlog(cluster::txlog, *this)
@@ -88,6 +90,7 @@ group::group(
   config::configuration& conf,
   ss::lw_shared_ptr<ssx::rwlock> catchup_lock,
   ss::lw_shared_ptr<cluster::partition> partition,
+  ss::lw_shared_ptr<offset_commit_batcher> commit_batcher,
   model::term_id term,
   ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
   ss::sharded<features::feature_table>& feature_table,
@@ -108,6 +111,7 @@ group::group(
   , _conf(conf)
   , _catchup_lock(std::move(catchup_lock))
   , _partition(std::move(partition))
+  , _commit_batcher(std::move(commit_batcher))
   , _probe(_members, _static_members, _offsets)
   , _ctxlog(klog, *this)
   , _ctx_txlog(cluster::txlog, *this)
@@ -1536,9 +1540,18 @@ ss::future<heartbeat_response> group::handle_heartbeat(heartbeat_request&& r) {
         vlog(_ctxlog.trace, "Heartbeat rejected for group state {}", _state);
         return make_heartbeat_error(error_code::unknown_member_id);
 
-    case group_state::completing_rebalance:
-        vlog(_ctxlog.trace, "Heartbeat rejected for group state {}", _state);
-        return make_heartbeat_error(error_code::rebalance_in_progress);
+    case group_state::completing_rebalance: {
+        // <kafka>consumers may start sending heartbeat after join-group
+        // response, in which case we should treat them as normal hb request
+        // and reset the timer</kafka>
+        //
+        // members of incremental cooperative groups keep consuming their
+        // partitions while the leader computes the assignment, they must not
+        // be told to rejoin nor expire while waiting for the sync.
+        auto member = get_member(r.data.member_id);
+        schedule_next_heartbeat_expiration(member);
+        return make_heartbeat_error(error_code::none);
+    }
 
     case group_state::preparing_rebalance: {
         auto member = get_member(r.data.member_id);
@@ -2197,6 +2210,25 @@ kafka::error_code map_store_offset_error_code(std::error_code ec) {
 
 void group::update_store_offset_builder(
   cluster::simple_batch_builder& builder,
+  const model::topic& name,
+  model::partition_id partition,
+  model::offset committed_offset,
+  leader_epoch committed_leader_epoch,
+  const ss::sstring& metadata,
+  model::timestamp commit_timestamp,
+  std::optional<model::timestamp> expiry_timestamp) {
+    auto kv = make_offset_kv(
+      name,
+      partition,
+      committed_offset,
+      committed_leader_epoch,
+      metadata,
+      commit_timestamp,
+      expiry_timestamp);
+    builder.add_raw_kv(std::move(kv.key), std::move(kv.value));
+}
+
+group_metadata_serializer::key_value group::make_offset_kv(
   const model::topic& name,
   model::partition_id partition,
   model::offset committed_offset,
@@ -2218,14 +2250,12 @@ void group::update_store_offset_builder(
         value.expiry_timestamp = expiry_timestamp.value();
     }
 
-    auto kv = _md_serializer.to_kv(
+    return _md_serializer.to_kv(
       offset_metadata_kv{.key = std::move(key), .value = std::move(value)});
-    builder.add_raw_kv(std::move(kv.key), std::move(kv.value));
 }
 
 group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
-    cluster::simple_batch_builder builder(
-      model::record_batch_type::raft_data, model::offset(0));
+    std::vector<group_metadata_serializer::key_value> records;
 
     std::vector<std::pair<model::topic_partition, offset_metadata>>
       offset_commits;
@@ -2249,15 +2279,14 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
     for (const auto& t : r.data.topics) {
         for (const auto& p : t.partitions) {
             const auto commit_timestamp = get_commit_timestamp(p);
-            update_store_offset_builder(
-              builder,
+            records.push_back(make_offset_kv(
               t.name,
               p.partition_index,
               p.committed_offset,
               p.committed_leader_epoch,
               p.committed_metadata.value_or(""),
               commit_timestamp,
-              expiry_timestamp);
+              expiry_timestamp));
 
             model::topic_partition tp(t.name, p.partition_index);
 
@@ -2285,13 +2314,7 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
         }
     }
 
-    auto batch = std::move(builder).build();
-    auto reader = model::make_memory_record_batch_reader(std::move(batch));
-
-    auto replicate_stages = _partition->raft()->replicate_in_stages(
-      _term,
-      std::move(reader),
-      raft::replicate_options(raft::consistency_level::quorum_ack));
+    auto replicate_stages = replicate_offset_commit(std::move(records));
 
     auto f = replicate_stages.replicate_finished.then(
       [this, req = std::move(r), commits = std::move(offset_commits)](
@@ -2324,6 +2347,28 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
     return {std::move(replicate_stages.request_enqueued), std::move(f)};
 }
 
+raft::replicate_stages group::replicate_offset_commit(
+  std::vector<group_metadata_serializer::key_value> records) {
+    if (_commit_batcher && _commit_batcher->enabled()) {
+        // the batcher keeps the order of the commits, they are ordered once
+        // they were added to the batch
+        return {
+          ss::now(), _commit_batcher->replicate(_term, std::move(records))};
+    }
+    cluster::simple_batch_builder builder(
+      model::record_batch_type::raft_data, model::offset(0));
+    for (auto& kv : records) {
+        builder.add_raw_kv(std::move(kv.key), std::move(kv.value));
+    }
+    auto reader = model::make_memory_record_batch_reader(
+      std::move(builder).build());
+
+    return _partition->raft()->replicate_in_stages(
+      _term,
+      std::move(reader),
+      raft::replicate_options(raft::consistency_level::quorum_ack));
+}
+
 ss::future<cluster::commit_group_tx_reply>
 group::handle_commit_tx(cluster::commit_group_tx_request r) {
     if (in_state(group_state::dead)) {
@@ -3424,6 +3469,22 @@ group::get_expired_offsets(std::chrono::seconds retention_period) {
     }
 }
 
+size_t group::offsets_memory_usage() const {
+    // the slots of the map and the separately allocated values. the strings
+    // are counted at their size, ignoring the small string optimization.
+    size_t usage = _offsets.capacity()
+                   * (sizeof(model::topic_partition)
+                      + sizeof(std::unique_ptr<offset_metadata_with_probe>));
+    for (const auto& [tp, o] : _offsets) {
+        usage += sizeof(offset_metadata_with_probe) + tp.topic().size()
+                 + o->metadata.metadata.size();
+        if (o->probe) {
+            usage += sizeof(group_offset_probe);
+        }
+    }
+    return usage;
+}
+
 bool group::has_offsets() const {
     return !_offsets.empty() || !_pending_offset_commits.empty()
            || !_volatile_txs.empty() || !_tx_data.empty();
@@ -22,6 +22,7 @@
 #include "kafka/server/group_metadata.h"
 #include "kafka/server/logger.h"
 #include "kafka/server/member.h"
+#include "kafka/server/offset_commit_batcher.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
@@ -37,6 +38,7 @@
 #include <seastar/util/bool_class.hh>
 #include <seastar/util/log.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/node_hash_map.h>
 #include <absl/container/node_hash_set.h>
 
@@ -176,18 +178,20 @@ public:
 
     struct offset_metadata_with_probe {
         offset_metadata metadata;
-        group_offset_probe probe;
+        // only allocated when the group metrics are enabled, the metric
+        // groups are a large part of the size of a committed offset
+        std::unique_ptr<group_offset_probe> probe;
 
         offset_metadata_with_probe(
           offset_metadata _metadata,
           const kafka::group_id& group_id,
           const model::topic_partition& tp,
           enable_group_metrics enable_metrics)
-          : metadata(std::move(_metadata))
-          , probe(metadata.offset) {
+          : metadata(std::move(_metadata)) {
             if (enable_metrics) {
-                probe.setup_metrics(group_id, tp);
-                probe.setup_public_metrics(group_id, tp);
+                probe = std::make_unique<group_offset_probe>(metadata.offset);
+                probe->setup_metrics(group_id, tp);
+                probe->setup_public_metrics(group_id, tp);
             }
         }
     };
@@ -204,6 +208,7 @@ public:
       config::configuration& conf,
       ss::lw_shared_ptr<ssx::rwlock> catchup_lock,
       ss::lw_shared_ptr<cluster::partition> partition,
+      ss::lw_shared_ptr<offset_commit_batcher> commit_batcher,
       model::term_id,
       ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
       ss::sharded<features::feature_table>&,
@@ -217,6 +222,7 @@ public:
       config::configuration& conf,
       ss::lw_shared_ptr<ssx::rwlock> catchup_lock,
       ss::lw_shared_ptr<cluster::partition> partition,
+      ss::lw_shared_ptr<offset_commit_batcher> commit_batcher,
       model::term_id,
       ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
       ss::sharded<features::feature_table>&,
@@ -523,6 +529,9 @@ public:
 
     const auto& offsets() const { return _offsets; }
 
+    /// Estimate of the memory used by the committed offsets of the group
+    size_t offsets_memory_usage() const;
+
     void complete_offset_commit(
       const model::topic_partition& tp, const offset_metadata& md);
 
@@ -857,6 +866,18 @@ private:
       model::timestamp commited_timestemp,
       std::optional<model::timestamp> expiry_timestamp);
 
+    group_metadata_serializer::key_value make_offset_kv(
+      const model::topic& name,
+      model::partition_id partition,
+      model::offset committed_offset,
+      leader_epoch committed_leader_epoch,
+      const ss::sstring& metadata,
+      model::timestamp commit_timestamp,
+      std::optional<model::timestamp> expiry_timestamp);
+
+    raft::replicate_stages replicate_offset_commit(
+      std::vector<group_metadata_serializer::key_value>);
+
     ss::future<cluster::abort_group_tx_reply> do_abort(
       kafka::group_id group_id,
       model::producer_identity pid,
@@ -911,7 +932,10 @@ private:
     config::configuration& _conf;
     ss::lw_shared_ptr<ssx::rwlock> _catchup_lock;
     ss::lw_shared_ptr<cluster::partition> _partition;
-    absl::node_hash_map<
+    ss::lw_shared_ptr<offset_commit_batcher> _commit_batcher;
+    // the values are allocated separately, a flat map keeps them stable
+    // without a node per entry
+    absl::flat_hash_map<
       model::topic_partition,
       std::unique_ptr<offset_metadata_with_probe>>
       _offsets;
@@ -30,6 +30,7 @@
 #include "model/fundamental.h"
 #include "model/namespace.h"
 #include "model/record.h"
+#include "prometheus/prometheus_sanitize.h"
 #include "raft/errc.h"
 #include "raft/types.h"
 #include "resource_mgmt/io_priority.h"
@@ -47,6 +48,8 @@ using cluster::cloud_metadata::group_offsets;
 using cluster::cloud_metadata::group_offsets_snapshot;
 using cluster::cloud_metadata::group_offsets_snapshot_result;
 
+using namespace std::chrono_literals;
+
 namespace kafka {
 
 group_manager::group_manager(
@@ -68,7 +71,9 @@ group_manager::group_manager(
   , _conf(config::shard_local_cfg())
   , _self(cluster::make_self_broker(config::node()))
   , _enable_group_metrics(enable_metrics)
-  , _offset_retention_check(_conf.group_offset_retention_check_ms.bind()) {}
+  , _offset_retention_check(_conf.group_offset_retention_check_ms.bind())
+  , _recovery_snapshot_interval(
+      _conf.group_recovery_snapshot_interval_ms.bind()) {}
 
 ss::future<> group_manager::start() {
     /*
@@ -139,6 +144,37 @@ ss::future<> group_manager::start() {
         }
     });
 
+    setup_metrics();
+
+    /*
+     * periodically catch up the recovery snapshots of the partitions this
+     * node is not the leader of, so that becoming their leader only replays
+     * the tail of the log.
+     */
+    _recovery_snapshot_timer.set_callback([this] {
+        ssx::spawn_with_gate(_gate, [this] {
+            return update_recovery_snapshots().finally([this] {
+                const auto interval = _recovery_snapshot_interval();
+                if (!_gate.is_closed() && interval > 0ms) {
+                    _recovery_snapshot_timer.arm(interval);
+                }
+            });
+        });
+    });
+    if (_recovery_snapshot_interval() > 0ms) {
+        _recovery_snapshot_timer.arm(_recovery_snapshot_interval());
+    }
+    _recovery_snapshot_interval.watch([this] {
+        _recovery_snapshot_timer.cancel();
+        if (_recovery_snapshot_interval() > 0ms) {
+            _recovery_snapshot_timer.arm(_recovery_snapshot_interval());
+        } else {
+            for (auto& [_, p] : _partitions) {
+                p->recovery_snapshot.reset();
+            }
+        }
+    });
+
     return ss::make_ready_future<>();
 }
 /*
@@ -392,6 +428,7 @@ ss::future<> group_manager::stop() {
     }
 
     _timer.cancel();
+    _recovery_snapshot_timer.cancel();
 
     return _gate.close().then([this]() {
         /**
@@ -827,10 +864,22 @@ ss::future<> group_manager::handle_partition_leader_change(
                  * the full log is read and deduplicated. the dedupe
                  * processing is based on the record keys, so this code
                  * should be ready to transparently take advantage of
-                 * key-based compaction in the future.
+                 * key-based compaction in the future. when a recovery
+                 * snapshot was built while this node was a follower only
+                 * the log after it is read.
                  */
+                auto snapshot = take_recovery_snapshot(*p);
+                const auto start_offset
+                  = snapshot ? model::next_offset(snapshot->last_offset)
+                             : p->partition->raft_start_offset();
+                vlog(
+                  klog.debug,
+                  "Recovering groups of {} from offset {}, snapshot: {}",
+                  p->partition->ntp(),
+                  start_offset,
+                  snapshot.has_value());
                 storage::log_reader_config reader_config(
-                  p->partition->raft_start_offset(),
+                  start_offset,
                   model::model_limits<model::offset>::max(),
                   0,
                   std::numeric_limits<size_t>::max(),
@@ -840,11 +889,19 @@ ss::future<> group_manager::handle_partition_leader_change(
                   std::nullopt);
 
                 return p->partition->make_reader(reader_config)
-                  .then([this, term, p, timeout](
-                          model::record_batch_reader reader) {
+                  .then([this,
+                         term,
+                         p,
+                         timeout,
+                         snapshot = std::move(snapshot)](
+                          model::record_batch_reader reader) mutable {
                       return std::move(reader)
                         .consume(
-                          group_recovery_consumer(_serializer_factory(), p->as),
+                          group_recovery_consumer(
+                            _serializer_factory(),
+                            p->as,
+                            std::move(snapshot).value_or(
+                              group_recovery_consumer_state{})),
                           timeout)
                         .then([this, term, p](
                                 group_recovery_consumer_state state) {
@@ -862,6 +919,119 @@ ss::future<> group_manager::handle_partition_leader_change(
       });
 }
 
+void group_manager::setup_metrics() {
+    namespace sm = ss::metrics;
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("kafka:group_manager"),
+      {
+        sm::make_gauge(
+          "committed_offsets",
+          [this] {
+              size_t offsets = 0;
+              for (const auto& [_, g] : _groups) {
+                  offsets += g->offsets().size();
+              }
+              return offsets;
+          },
+          sm::description("Number of committed offsets of the groups")),
+        sm::make_gauge(
+          "committed_offsets_memory_bytes",
+          [this] {
+              size_t usage = 0;
+              for (const auto& [_, g] : _groups) {
+                  usage += g->offsets_memory_usage();
+              }
+              return usage;
+          },
+          sm::description(
+            "Estimated memory used by the committed offsets of the groups")),
+      });
+}
+
+std::optional<group_recovery_consumer_state>
+group_manager::take_recovery_snapshot(attached_partition& p) {
+    auto snapshot = std::exchange(p.recovery_snapshot, std::nullopt);
+    if (!snapshot || snapshot->last_offset == model::offset{}) {
+        return std::nullopt;
+    }
+    // the log after the snapshot was prefix truncated, it can not be
+    // replayed on top of it
+    if (
+      model::next_offset(snapshot->last_offset)
+      < p.partition->raft_start_offset()) {
+        return std::nullopt;
+    }
+    return snapshot;
+}
+
+ss::future<> group_manager::update_recovery_snapshots() {
+    std::vector<ss::lw_shared_ptr<attached_partition>> partitions;
+    partitions.reserve(_partitions.size());
+    for (auto& [_, p] : _partitions) {
+        partitions.push_back(p);
+    }
+    for (auto& p : partitions) {
+        if (_recovery_snapshot_interval() <= 0ms) {
+            co_return;
+        }
+        co_await update_recovery_snapshot(p);
+    }
+}
+
+ss::future<> group_manager::update_recovery_snapshot(
+  ss::lw_shared_ptr<attached_partition> p) {
+    // the leader serves the groups from memory. leave the partition alone
+    // while it is being recovered or detached.
+    if (p->partition->is_leader() || p->as.abort_requested()) {
+        co_return;
+    }
+    auto units = ss::try_get_units(p->sem, 1);
+    if (!units) {
+        co_return;
+    }
+    auto snapshot = take_recovery_snapshot(*p);
+    const auto start_offset = snapshot
+                                ? model::next_offset(snapshot->last_offset)
+                                : p->partition->raft_start_offset();
+    // only committed batches are consumed, they are never truncated
+    const auto committed_offset = p->partition->committed_offset();
+    if (start_offset > committed_offset) {
+        p->recovery_snapshot = std::move(snapshot);
+        co_return;
+    }
+    storage::log_reader_config reader_config(
+      start_offset,
+      committed_offset,
+      0,
+      std::numeric_limits<size_t>::max(),
+      kafka_read_priority(),
+      std::nullopt,
+      std::nullopt,
+      std::nullopt);
+    auto reader = co_await p->partition->make_reader(reader_config);
+    auto state = co_await std::move(reader).consume(
+      group_recovery_consumer(
+        _serializer_factory(),
+        p->as,
+        std::move(snapshot).value_or(group_recovery_consumer_state{})),
+      model::no_timeout);
+    // the consumed batches were committed, the state stays valid when the
+    // partition became leader while the log was read
+    if (p->as.abort_requested()) {
+        co_return;
+    }
+    vlog(
+      klog.trace,
+      "Recovery snapshot of {} updated to offset {} with {} groups",
+      p->partition->ntp(),
+      state.last_offset,
+      state.groups.size());
+    p->recovery_snapshot = std::move(state);
+}
+
 /*
  * TODO: this routine can be improved from a copy vs move perspective, but is
  * rather complicated at the moment to start having to also analyze all the data
@@ -920,6 +1090,7 @@ ss::future<> group_manager::do_recover_group(
               _conf,
               p->catchup_lock,
               p->partition,
+              p->commit_batcher,
               term,
               _tx_frontend,
               _feature_table,
@@ -1121,6 +1292,7 @@ group::join_group_stages group_manager::join_group(join_group_request&& r) {
           _conf,
           it->second->catchup_lock,
           p,
+          it->second->commit_batcher,
           it->second->term,
           _tx_frontend,
           _feature_table,
@@ -1270,6 +1442,7 @@ group_manager::txn_offset_commit(txn_offset_commit_request&& r) {
                 _conf,
                 p->catchup_lock,
                 p->partition,
+                p->commit_batcher,
                 p->term,
                 _tx_frontend,
                 _feature_table,
@@ -1357,6 +1530,7 @@ group_manager::begin_tx(cluster::begin_group_tx_request&& r) {
                 _conf,
                 p->catchup_lock,
                 p->partition,
+                p->commit_batcher,
                 p->term,
                 _tx_frontend,
                 _feature_table,
@@ -1428,6 +1602,7 @@ group_manager::offset_commit(offset_commit_request&& r) {
               _conf,
               p->catchup_lock,
               p->partition,
+              p->commit_batcher,
               p->term,
               _tx_frontend,
               _feature_table,
@@ -13,6 +13,7 @@
 #include "cluster/cloud_metadata/offsets_recovery_rpc_types.h"
 #include "cluster/cloud_metadata/offsets_snapshot.h"
 #include "cluster/fwd.h"
+#include "config/configuration.h"
 #include "kafka/protocol/delete_groups.h"
 #include "kafka/protocol/describe_groups.h"
 #include "kafka/protocol/errors.h"
@@ -29,6 +30,8 @@
 #include "kafka/server/group_recovery_consumer.h"
 #include "kafka/server/group_stm.h"
 #include "kafka/server/member.h"
+#include "kafka/server/offset_commit_batcher.h"
+#include "metrics/metrics.h"
 #include "model/metadata.h"
 #include "model/namespace.h"
 #include "raft/group_manager.h"
@@ -219,12 +222,20 @@ private:
         ss::abort_source as;
         ss::lw_shared_ptr<cluster::partition> partition;
         ss::lw_shared_ptr<ssx::rwlock> catchup_lock;
+        ss::lw_shared_ptr<offset_commit_batcher> commit_batcher;
         model::term_id term{-1};
+        // state built from the log in the background while not leader, the
+        // next recovery only replays the log after it
+        std::optional<group_recovery_consumer_state> recovery_snapshot;
 
         explicit attached_partition(ss::lw_shared_ptr<cluster::partition> p)
           : loading(true)
           , partition(std::move(p)) {
             catchup_lock = ss::make_lw_shared<ssx::rwlock>();
+            commit_batcher = ss::make_lw_shared<offset_commit_batcher>(
+              partition,
+              config::shard_local_cfg()
+                .group_offset_commit_coalescing_window_ms.bind());
         }
     };
 
@@ -265,6 +276,14 @@ private:
 
     ss::future<> gc_partition_state(ss::lw_shared_ptr<attached_partition>);
 
+    void setup_metrics();
+
+    ss::future<> update_recovery_snapshots();
+    ss::future<>
+      update_recovery_snapshot(ss::lw_shared_ptr<attached_partition>);
+    std::optional<group_recovery_consumer_state>
+    take_recovery_snapshot(attached_partition&);
+
     ss::future<std::error_code> inject_noop(
       ss::lw_shared_ptr<cluster::partition> p,
       ss::lowres_clock::time_point timeout);
@@ -304,6 +323,9 @@ private:
     model::broker _self;
     enable_group_metrics _enable_group_metrics;
     config::binding<std::chrono::milliseconds> _offset_retention_check;
+    config::binding<std::chrono::milliseconds> _recovery_snapshot_interval;
+    ss::timer<> _recovery_snapshot_timer;
+    metrics::internal_metric_groups _metrics;
 };
 
 } // namespace kafka
@@ -31,6 +31,11 @@ struct group_recovery_consumer_state {
      * retention feature is activated. see group::offset_metadata for more info.
      */
     bool has_offset_retention_feature_fence{false};
+    /*
+     * the offset of the last batch consumed into this state. a recovery may
+     * start from a state built earlier and replay the log after this offset.
+     */
+    model::offset last_offset;
 };
 
 class group_recovery_consumer {
@@ -45,6 +50,18 @@ public:
       : _serializer(std::move(serializer))
       , _as(as) {}
 
+    /*
+     * Continues consuming the log into a state built from the log up to its
+     * last_offset.
+     */
+    group_recovery_consumer(
+      group_metadata_serializer serializer,
+      ss::abort_source& as,
+      group_recovery_consumer_state state)
+      : _state(std::move(state))
+      , _serializer(std::move(serializer))
+      , _as(as) {}
+
     ss::future<ss::stop_iteration> operator()(model::record_batch batch);
 
     group_recovery_consumer_state end_of_stream() { return std::move(_state); }
@@ -105,11 +105,17 @@ static ss::future<partition_dir_set> collect(
           return collect_mapper(pm, filter);
       },
       partition_dir_set{},
-      [](partition_dir_set acc, const partition_dir_set& update) {
-          for (auto& topic : update) {
-              for (auto partition : topic.second) {
-                  acc[topic.first].push_back(partition);
+      [](partition_dir_set acc, partition_dir_set update) {
+          for (auto& [topic, partitions] : update) {
+              auto& dst = acc[topic];
+              if (dst.empty()) {
+                  dst = std::move(partitions);
+                  continue;
               }
+              dst.insert(
+                dst.end(),
+                std::make_move_iterator(partitions.begin()),
+                std::make_move_iterator(partitions.end()));
           }
           return acc;
       });
@@ -161,10 +167,11 @@ ss::future<response_ptr> describe_log_dirs_handler::handle(
 
         std::vector<describe_log_dirs_partition> local_partitions;
         std::vector<describe_log_dirs_partition> remote_partitions;
-        for (const auto& i : node.mapped()) {
-            local_partitions.push_back(i.local);
+        local_partitions.reserve(node.mapped().size());
+        for (auto& i : node.mapped()) {
+            local_partitions.push_back(std::move(i.local));
             if (i.remote.has_value()) {
-                remote_partitions.push_back(i.remote.value());
+                remote_partitions.push_back(std::move(i.remote.value()));
             }
         }
 
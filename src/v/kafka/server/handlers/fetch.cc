@@ -17,6 +17,7 @@
 #include "kafka/protocol/batch_consumer.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/fetch.h"
+#include "kafka/server/fetch_response_cache.h"
 #include "kafka/server/fetch_session.h"
 #include "kafka/server/fwd.h"
 #include "kafka/server/handlers/details/leader_epoch.h"
@@ -32,10 +33,13 @@
 #include "model/timeout_clock.h"
 #include "random/generators.h"
 #include "resource_mgmt/io_priority.h"
+#include "ssx/future-util.h"
 #include "ssx/semaphore.h"
 #include "storage/parser_utils.h"
 #include "utils/to_string.h"
 
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/condition-variable.hh>
 #include <seastar/core/do_with.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/scheduling.hh>
@@ -66,14 +70,35 @@ make_partition_response_error(model::partition_id p_id, error_code error) {
     };
 }
 
+static read_result make_read_result(
+  std::unique_ptr<iobuf> data,
+  bool foreign_read,
+  model::offset start_offset,
+  model::offset hw,
+  model::offset lso,
+  std::vector<cluster::rm_stm::tx_range> aborted_transactions) {
+    if (foreign_read) {
+        return read_result(
+          ss::make_foreign<read_result::data_t>(std::move(data)),
+          start_offset,
+          hw,
+          lso,
+          std::move(aborted_transactions));
+    }
+    return read_result(
+      std::move(data), start_offset, hw, lso, std::move(aborted_transactions));
+}
+
 /**
  * Low-level handler for reading from an ntp. Runs on ntp's home core.
  */
 static ss::future<read_result> read_from_partition(
   kafka::partition_proxy part,
+  const model::ktp& ktp,
   fetch_config config,
   bool foreign_read,
-  std::optional<model::timeout_clock::time_point> deadline) {
+  std::optional<model::timeout_clock::time_point> deadline,
+  fetch_response_cache* cache) {
     auto lso = part.last_stable_offset();
     if (unlikely(!lso)) {
         co_return read_result(lso.error());
@@ -87,6 +112,37 @@ static ss::future<read_result> read_from_partition(
         co_return read_result(start_o, hw, lso.value());
     }
 
+    // reads below the start offset are left to the reader, they fail with
+    // offset out of range
+    std::optional<fetch_response_cache::key> cache_key;
+    if (cache && cache->enabled() && config.start_offset >= start_o) {
+        cache_key = fetch_response_cache::key{
+          .ktp = ktp,
+          .start_offset = config.start_offset,
+          .max_offset = config.max_offset,
+          .max_bytes = config.max_bytes,
+          .isolation_level = config.isolation_level,
+          .strict_max_bytes = config.strict_max_bytes,
+        };
+        auto cached = cache->get(
+          *cache_key, hw, lso.value(), part.leader_epoch());
+        if (cached) {
+            part.probe().add_records_fetched(cached->record_count);
+            part.probe().add_bytes_fetched(cached->data.size_bytes());
+            if (!part.is_leader()) {
+                part.probe().add_bytes_fetched_from_follower(
+                  cached->data.size_bytes());
+            }
+            co_return make_read_result(
+              std::make_unique<iobuf>(std::move(cached->data)),
+              foreign_read,
+              start_o,
+              hw,
+              lso.value(),
+              std::move(cached->aborted_transactions));
+        }
+    }
+
     storage::log_reader_config reader_config(
       config.start_offset,
       config.max_offset,
@@ -101,16 +157,24 @@ static ss::future<read_result> read_from_partition(
       config.client_address);
 
     reader_config.strict_max_bytes = config.strict_max_bytes;
+    if (config.session_id) {
+        reader_config.reader_session = (*config.session_id)();
+    }
     auto rdr = co_await part.make_reader(reader_config);
     std::exception_ptr e;
     std::unique_ptr<iobuf> data;
     std::vector<cluster::rm_stm::tx_range> aborted_transactions;
+    uint32_t record_count = 0;
     try {
         auto result = co_await rdr.reader.consume(
           kafka_batch_serializer(), deadline ? *deadline : model::no_timeout);
         data = std::make_unique<iobuf>(std::move(result.data));
+        record_count = result.record_count;
         part.probe().add_records_fetched(result.record_count);
         part.probe().add_bytes_fetched(data->size_bytes());
+        if (!part.is_leader()) {
+            part.probe().add_bytes_fetched_from_follower(data->size_bytes());
+        }
         if (result.first_tx_batch_offset && result.record_count > 0) {
             // Reader should live at least until this point to hold on to the
             // segment locks so that prefix truncation doesn't happen.
@@ -142,17 +206,22 @@ static ss::future<read_result> read_from_partition(
         std::rethrow_exception(e);
     }
 
-    if (foreign_read) {
-        co_return read_result(
-          ss::make_foreign<read_result::data_t>(std::move(data)),
-          start_o,
-          hw,
-          lso.value(),
-          std::move(aborted_transactions));
+    if (cache_key && !data->empty()) {
+        cache->put(
+          *cache_key,
+          fetch_response_cache::value{
+            .data = data->share(0, data->size_bytes()),
+            .record_count = record_count,
+            .high_watermark = hw,
+            .last_stable_offset = lso.value(),
+            .leader_epoch = part.leader_epoch(),
+            .aborted_transactions = aborted_transactions,
+          });
     }
 
-    co_return read_result(
+    co_return make_read_result(
       std::move(data),
+      foreign_read,
       start_o,
       hw,
       lso.value(),
@@ -178,6 +247,35 @@ read_result::memory_units_t::~memory_units_t() noexcept {
     }
 }
 
+/**
+ * With \p zero_copy the fragments of data read on another shard are linked
+ * into the returned buffer without copying them. All the fragments share one
+ * deleter owning the foreign buffer, which is destroyed on its home shard once
+ * the last fragment is released, after the response was sent. The fragments
+ * are full so nothing is ever written into the foreign memory.
+ */
+iobuf read_result::release_data(zero_copy_foreign_data zero_copy) && {
+    return ss::visit(
+      data,
+      [](data_t& d) { return std::move(*d); },
+      [zero_copy](foreign_data_t& d) {
+          if (!zero_copy || d->empty()) {
+              auto ret = d->copy();
+              d.reset();
+              return ret;
+          }
+          const iobuf* foreign = d.get();
+          auto del = ss::make_object_deleter(std::move(d));
+          iobuf ret;
+          for (const auto& frag : *foreign) {
+              ret.append(std::make_unique<iobuf::fragment>(
+                ss::temporary_buffer<char>(
+                  const_cast<char*>(frag.get()), frag.size(), del.share())));
+          }
+          return ret;
+      });
+}
+
 void read_result::memory_units_t::adopt(memory_units_t&& o) {
     // Adopts assert internally that the units are from the same semaphore.
     // So there is no need to assert that they are from the same shard here.
@@ -277,7 +375,8 @@ static ss::future<read_result> do_read_from_ntp(
   std::optional<model::timeout_clock::time_point> deadline,
   const bool obligatory_batch_read,
   ssx::semaphore& memory_sem,
-  ssx::semaphore& memory_fetch_sem) {
+  ssx::semaphore& memory_fetch_sem,
+  fetch_response_cache* cache) {
     // control available memory
     read_result::memory_units_t memory_units(memory_sem, memory_fetch_sem);
     if (!ntp_config.cfg.skip_read) {
@@ -367,7 +466,12 @@ static ss::future<read_result> do_read_from_ntp(
         }
     }
     read_result result = co_await read_from_partition(
-      std::move(*kafka_partition), ntp_config.cfg, foreign_read, deadline);
+      std::move(*kafka_partition),
+      ntp_config.ktp(),
+      ntp_config.cfg,
+      foreign_read,
+      deadline,
+      cache);
 
     adjust_memory_units(
       memory_sem, memory_fetch_sem, memory_units, result.data_size_bytes());
@@ -395,7 +499,8 @@ ss::future<read_result> read_from_ntp(
       deadline,
       obligatory_batch_read,
       memory_sem,
-      memory_fetch_sem);
+      memory_fetch_sem,
+      nullptr);
 }
 
 read_result::memory_units_t reserve_memory_units(
@@ -430,6 +535,8 @@ static void fill_fetch_responses(
 
     // Used to aggregate semaphore_units from results.
     std::optional<read_result::memory_units_t> total_memory_units;
+    const read_result::zero_copy_foreign_data zero_copy{
+      config::shard_local_cfg().fetch_zero_copy_foreign_reads()};
 
     for (auto idx : range) {
         auto& res = results[idx];
@@ -502,17 +609,16 @@ static void fill_fetch_responses(
                   });
                 resp.aborted = std::move(aborted);
             }
-            resp.records = batch_reader(std::move(res).release_data());
+            resp.records = batch_reader(
+              std::move(res).release_data(zero_copy));
         } else {
             // TODO: add probe to measure how much of read data is discarded
             resp.records = batch_reader();
         }
 
         resp_it->set(std::move(resp));
-        std::chrono::microseconds fetch_latency
-          = std::chrono::duration_cast<std::chrono::microseconds>(
-            op_context::latency_clock::now() - start_time);
-        octx.rctx.probe().record_fetch_latency(fetch_latency);
+        octx.rctx.probe().record_fetch_latency(
+          op_context::latency_clock::now() - start_time);
     }
 }
 
@@ -524,7 +630,11 @@ static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
   std::optional<model::timeout_clock::time_point> deadline,
   const size_t bytes_left,
   ssx::semaphore& memory_sem,
-  ssx::semaphore& memory_fetch_sem) {
+  ssx::semaphore& memory_fetch_sem,
+  fetch_memory_share& memory_share,
+  fetch_response_cache& cache) {
+    // the fetch counts in the shares of the fetches reading after it
+    auto share_reader = memory_share.register_reader();
     size_t total_max_bytes = 0;
     for (const auto& c : ntp_fetch_configs) {
         total_max_bytes += c.cfg.max_bytes;
@@ -532,8 +642,8 @@ static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
 
     // bytes_left comes from the fetch plan and also accounts for the max_bytes
     // field in the fetch request
-    const size_t max_bytes_per_fetch = std::min<size_t>(
-      config::shard_local_cfg().kafka_max_bytes_per_fetch(), bytes_left);
+    const size_t max_bytes_per_fetch = memory_share.limit(std::min<size_t>(
+      config::shard_local_cfg().kafka_max_bytes_per_fetch(), bytes_left));
     if (total_max_bytes > max_bytes_per_fetch) {
         auto per_partition = max_bytes_per_fetch / ntp_fetch_configs.size();
         vlog(
@@ -557,7 +667,8 @@ static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
        foreign_read,
        first_p_id,
        &memory_sem,
-       &memory_fetch_sem](const ntp_fetch_config& ntp_cfg) {
+       &memory_fetch_sem,
+       &cache](const ntp_fetch_config& ntp_cfg) {
           auto p_id = ntp_cfg.ktp().get_partition();
           return do_read_from_ntp(
                    cluster_pm,
@@ -567,7 +678,8 @@ static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
                    deadline,
                    first_p_id == p_id,
                    memory_sem,
-                   memory_fetch_sem)
+                   memory_fetch_sem,
+                   &cache)
             .then([p_id](read_result res) {
                 res.partition = p_id;
                 return res;
@@ -617,30 +729,46 @@ handle_shard_fetch(ss::shard_id shard, op_context& octx, shard_fetch fetch) {
     }
 
     const bool foreign_read = shard != ss::this_shard_id();
+    auto* trace = octx.rctx.trace();
+    const auto dispatched_at = request_trace::now(trace);
 
     // dispatch to remote core
     return octx.rctx.partition_manager()
       .invoke_on(
         shard,
         octx.ssg,
-        [foreign_read, configs = std::move(fetch.requests), &octx](
-          cluster::partition_manager& mgr) mutable {
+        [foreign_read,
+         configs = std::move(fetch.requests),
+         trace,
+         dispatched_at,
+         &octx](cluster::partition_manager& mgr) mutable {
+            request_trace::add_span(trace, "kafka.fetch.hop", dispatched_at);
+            const auto read_start = request_trace::now(trace);
             // &octx is captured only to immediately use its accessors here so
             // that there is a list of all objects accessed next to `invoke_on`.
             // This is meant to help avoiding unintended cross shard access
             return fetch_ntps_in_parallel(
-              mgr,
-              octx.rctx.server().local().get_replica_selector(),
-              std::move(configs),
-              foreign_read,
-              octx.deadline,
-              octx.bytes_left,
-              octx.rctx.server().local().memory(),
-              octx.rctx.server().local().memory_fetch_sem());
+                     mgr,
+                     octx.rctx.server().local().get_replica_selector(),
+                     std::move(configs),
+                     foreign_read,
+                     octx.deadline,
+                     octx.bytes_left,
+                     octx.rctx.server().local().memory(),
+                     octx.rctx.server().local().memory_fetch_sem(),
+                     octx.rctx.server().local().get_fetch_memory_share(),
+                     octx.rctx.server().local().get_fetch_response_cache())
+              .finally([trace, read_start] {
+                  request_trace::add_span(
+                    trace, "kafka.fetch.read", read_start);
+              });
         })
       .then([responses = std::move(fetch.responses),
              start_time = fetch.start_time,
+             trace,
+             dispatched_at,
              &octx](std::vector<read_result> results) mutable {
+          request_trace::add_span(trace, "kafka.fetch.shard", dispatched_at);
           fill_fetch_responses(
             octx, std::move(results), std::move(responses), start_time);
       });
@@ -672,6 +800,8 @@ size_t op_context::fetch_partition_count() const {
       || (session_ctx.is_full_fetch() && initial_fetch)) {
         // too hard to get the right size, this is only an estimate
         return 0;
+    } else if (skip_idle_session_partitions) {
+        return session_ctx.session()->partitions().dirty_count();
     } else {
         return session_ctx.session()->partitions().size();
     }
@@ -701,6 +831,11 @@ void op_context::for_each_fetch_partition(Func&& f) const {
                 .fetch_offset = part.fetch_offset,
               });
           });
+    } else if (skip_idle_session_partitions) {
+        std::for_each(
+          session_ctx.session()->partitions().cbegin_dirty_order(),
+          session_ctx.session()->partitions().cend_dirty_order(),
+          std::forward<Func>(f));
     } else {
         std::for_each(
           session_ctx.session()->partitions().cbegin_insertion_order(),
@@ -709,11 +844,110 @@ void op_context::for_each_fetch_partition(Func&& f) const {
     }
 }
 
+/**
+ * Checks that the partition can be read and returns its shard. Partitions
+ * that can not be read have their error response set, partitions that do not
+ * need to be read again in this round are skipped. Both are not planned.
+ */
+static std::optional<ss::shard_id> plan_partition_shard(
+  op_context& octx,
+  const fetch_session_partition& fp,
+  op_context::response_placeholder_ptr resp) {
+    // if this is not an initial fetch we are allowed to skip
+    // partions that aleready have an error or we have enough data
+    if (!octx.initial_fetch) {
+        bool has_enough_data = !resp->empty() && octx.over_min_bytes();
+
+        if (resp->has_error() || has_enough_data) {
+            return std::nullopt;
+        }
+    }
+
+    // We audit successful messages only on the initial fetch
+    audit_on_success audit{octx.initial_fetch};
+
+    /**
+     * if not authorized do not include into a plan
+     */
+    if (!octx.rctx.authorized(
+          security::acl_operation::read,
+          fp.topic_partition.get_topic(),
+          audit)) {
+        resp->set(make_partition_response_error(
+          fp.topic_partition.get_partition(),
+          error_code::topic_authorization_failed));
+        return std::nullopt;
+    }
+
+    auto& tp = fp.topic_partition;
+
+    if (unlikely(octx.rctx.metadata_cache().is_disabled(
+          tp.as_tn_view(), tp.get_partition()))) {
+        resp->set(make_partition_response_error(
+          fp.topic_partition.get_partition(),
+          error_code::replica_not_available));
+        return std::nullopt;
+    }
+
+    auto shard = octx.rctx.shards().shard_for(tp);
+    if (unlikely(!shard)) {
+        // there is given partition in topic metadata, return
+        // unknown_topic_or_partition error
+
+        /**
+         * no shard is found on current node, but topic exists in
+         * cluster metadata, this mean that the partition was
+         * moved but consumer has not updated its metadata yet. we
+         * return not_leader_for_partition error to force metadata
+         * update.
+         */
+        auto ec = octx.rctx.metadata_cache().contains(tp.to_ntp())
+                    ? error_code::not_leader_for_partition
+                    : error_code::unknown_topic_or_partition;
+        resp->set(make_partition_response_error(tp.get_partition(), ec));
+        return std::nullopt;
+    }
+    return shard;
+}
+
+static fetch_config make_partition_fetch_config(
+  const op_context& octx,
+  const fetch_session_partition& fp,
+  size_t max_bytes,
+  bool skip_read,
+  const model::client_address_t& client_address) {
+    return fetch_config{
+      .start_offset = fp.fetch_offset,
+      .max_offset = model::model_limits<model::offset>::max(),
+      .max_bytes = max_bytes,
+      .timeout = octx.deadline.value_or(model::no_timeout),
+      .current_leader_epoch = fp.current_leader_epoch,
+      .isolation_level = octx.request.data.isolation_level,
+      .strict_max_bytes = octx.response_size > 0,
+      .skip_read = skip_read,
+      .read_from_follower = octx.request.has_rack_id(),
+      .consumer_rack_id = octx.request.data.rack_id,
+      .abort_source = octx.rctx.abort_source(),
+      .client_address = client_address,
+      .session_id = octx.session_ctx.is_sessionless()
+                      ? std::nullopt
+                      : std::make_optional(octx.session_ctx.session()->id()),
+    };
+}
+
+static model::client_address_t fetch_client_address(const op_context& octx) {
+    return model::client_address_t{fmt::format(
+      "{}:{}",
+      octx.rctx.connection()->client_host(),
+      octx.rctx.connection()->client_port())};
+}
+
 class simple_fetch_planner final : public fetch_planner::impl {
     fetch_plan create_plan(op_context& octx) final {
         fetch_plan plan(ss::smp::count);
         auto resp_it = octx.response_begin();
         auto bytes_left_in_plan = octx.bytes_left;
+        const auto client_address = fetch_client_address(octx);
 
         plan.reserve_from_partition_count(octx.fetch_partition_count());
 
@@ -723,69 +957,17 @@ class simple_fetch_planner final : public fetch_planner::impl {
         octx.for_each_fetch_partition([&resp_it,
                                        &octx,
                                        &plan,
-                                       &bytes_left_in_plan](
+                                       &bytes_left_in_plan,
+                                       &client_address](
                                         const fetch_session_partition& fp) {
-            // if this is not an initial fetch we are allowed to skip
-            // partions that aleready have an error or we have enough data
-            if (!octx.initial_fetch) {
-                bool has_enough_data = !resp_it->empty()
-                                       && octx.over_min_bytes();
-
-                if (resp_it->has_error() || has_enough_data) {
-                    ++resp_it;
-                    return;
-                }
-            }
-
-            // We audit successful messages only on the initial fetch
-            audit_on_success audit{octx.initial_fetch};
-
-            /**
-             * if not authorized do not include into a plan
-             */
-            if (!octx.rctx.authorized(
-                  security::acl_operation::read,
-                  fp.topic_partition.get_topic(),
-                  audit)) {
-                resp_it->set(make_partition_response_error(
-                  fp.topic_partition.get_partition(),
-                  error_code::topic_authorization_failed));
-                ++resp_it;
+            auto resp = &(*resp_it);
+            ++resp_it;
+            auto shard = plan_partition_shard(octx, fp, resp);
+            if (!shard) {
                 return;
             }
 
             auto& tp = fp.topic_partition;
-
-            if (unlikely(octx.rctx.metadata_cache().is_disabled(
-                  tp.as_tn_view(), tp.get_partition()))) {
-                resp_it->set(make_partition_response_error(
-                  fp.topic_partition.get_partition(),
-                  error_code::replica_not_available));
-                ++resp_it;
-                return;
-            }
-
-            auto shard = octx.rctx.shards().shard_for(tp);
-            if (unlikely(!shard)) {
-                // there is given partition in topic metadata, return
-                // unknown_topic_or_partition error
-
-                /**
-                 * no shard is found on current node, but topic exists in
-                 * cluster metadata, this mean that the partition was
-                 * moved but consumer has not updated its metadata yet. we
-                 * return not_leader_for_partition error to force metadata
-                 * update.
-                 */
-                auto ec = octx.rctx.metadata_cache().contains(tp.to_ntp())
-                            ? error_code::not_leader_for_partition
-                            : error_code::unknown_topic_or_partition;
-                resp_it->set(make_partition_response_error(
-                  fp.topic_partition.get_partition(), ec));
-                ++resp_it;
-                return;
-            }
-
             auto fetch_md = octx.rctx.get_fetch_metadata_cache().get(tp);
             auto max_bytes = std::min(bytes_left_in_plan, size_t(fp.max_bytes));
             /**
@@ -795,33 +977,377 @@ class simple_fetch_planner final : public fetch_planner::impl {
                 bytes_left_in_plan -= max_bytes;
             }
 
-            const auto client_address = fmt::format(
-              "{}:{}",
-              octx.rctx.connection()->client_host(),
-              octx.rctx.connection()->client_port());
-
-            fetch_config config{
-              .start_offset = fp.fetch_offset,
-              .max_offset = model::model_limits<model::offset>::max(),
-              .max_bytes = max_bytes,
-              .timeout = octx.deadline.value_or(model::no_timeout),
-              .current_leader_epoch = fp.current_leader_epoch,
-              .isolation_level = octx.request.data.isolation_level,
-              .strict_max_bytes = octx.response_size > 0,
-              .skip_read = bytes_left_in_plan == 0 && max_bytes == 0,
-              .read_from_follower = octx.request.has_rack_id(),
-              .consumer_rack_id = octx.request.data.rack_id,
-              .abort_source = octx.rctx.abort_source(),
-              .client_address = model::client_address_t{client_address},
-            };
-
-            plan.fetches_per_shard[*shard].push_back({tp, config}, &(*resp_it));
-            ++resp_it;
+            plan.fetches_per_shard[*shard].push_back(
+              {tp,
+               make_partition_fetch_config(
+                 octx,
+                 fp,
+                 max_bytes,
+                 bytes_left_in_plan == 0 && max_bytes == 0,
+                 client_address)},
+              resp);
         });
         return plan;
     }
 };
 
+/**
+ * Planner that splits the response budget over the partitions by the data
+ * they are expected to return.
+ *
+ * The simple planner hands out the budget in request order and only charges
+ * it for partitions known to have data, every other partition may still read
+ * up to its max_bytes. With large sessions this plans reads of many times the
+ * response size, all of them reserving memory units and reading from disk
+ * only for the data to be dropped when the response is assembled.
+ *
+ * Here the budget is shared by every partition that may return data. It goes
+ * first to the partitions the fetch metadata cache knows to have data past
+ * the fetch offset, then to the partitions without cached metadata, each of
+ * them getting an even share of what is left. Every shard is also limited to
+ * the per shard read limit (kafka_max_bytes_per_fetch), the shard budget is
+ * shared the same way. Partitions known to be caught up only get the budget
+ * that is left, without being charged, as they rarely return data.
+ * Partitions left without budget are not read.
+ *
+ * The shares are handed out starting from a random partition, the budget not
+ * used by a partition goes to the ones after it. Fetch sessions already move
+ * the partitions that returned data to the end of the session, sessionless
+ * and full fetches would otherwise always favour the partitions at the front
+ * of the request.
+ */
+class balanced_fetch_planner final : public fetch_planner::impl {
+    enum class expected_data { available, unknown, none };
+
+    struct candidate {
+        fetch_session_partition fp;
+        ss::shard_id shard;
+        op_context::response_placeholder_ptr resp;
+        expected_data expected;
+        size_t max_bytes{0};
+        bool skip_read{false};
+    };
+
+    fetch_plan create_plan(op_context& octx) final {
+        fetch_plan plan(ss::smp::count);
+        plan.reserve_from_partition_count(octx.fetch_partition_count());
+
+        std::vector<candidate> candidates;
+        candidates.reserve(octx.fetch_partition_count());
+        auto resp_it = octx.response_begin();
+        octx.for_each_fetch_partition(
+          [&resp_it, &octx, &candidates](const fetch_session_partition& fp) {
+              auto resp = &(*resp_it);
+              ++resp_it;
+              auto shard = plan_partition_shard(octx, fp, resp);
+              if (!shard) {
+                  return;
+              }
+              auto fetch_md = octx.rctx.get_fetch_metadata_cache().get(
+                fp.topic_partition);
+              auto expected = !fetch_md ? expected_data::unknown
+                              : fetch_md->high_watermark > fp.fetch_offset
+                                ? expected_data::available
+                                : expected_data::none;
+              candidates.push_back(candidate{
+                .fp = fp,
+                .shard = *shard,
+                .resp = resp,
+                .expected = expected,
+              });
+          });
+        if (candidates.empty()) {
+            return plan;
+        }
+
+        assign_budget(octx, candidates);
+
+        const auto client_address = fetch_client_address(octx);
+        for (auto& c : candidates) {
+            auto config = make_partition_fetch_config(
+              octx, c.fp, c.max_bytes, c.skip_read, client_address);
+            plan.fetches_per_shard[c.shard].push_back(
+              {std::move(c.fp.topic_partition), std::move(config)}, c.resp);
+        }
+        return plan;
+    }
+
+    static void
+    assign_budget(const op_context& octx, std::vector<candidate>& candidates) {
+        size_t bytes_left = octx.bytes_left;
+        const size_t shard_limit = std::min<size_t>(
+          config::shard_local_cfg().kafka_max_bytes_per_fetch(), bytes_left);
+        std::vector<size_t> shard_bytes(ss::smp::count, 0);
+
+        const bool rotate = octx.session_ctx.is_sessionless()
+                            || octx.session_ctx.is_full_fetch();
+        const size_t first
+          = rotate ? random_generators::get_int<size_t>(candidates.size() - 1)
+                   : 0;
+
+        // partitions expected to return data share the budget evenly, the
+        // share of a partition is what is left of the budget (and of its shard
+        // limit) divided by the number of partitions still to be assigned, so
+        // the budget a partition does not ask for goes to the next ones
+        auto assign_shares = [&](expected_data expected) {
+            size_t count = 0;
+            std::vector<size_t> shard_count(ss::smp::count, 0);
+            for (const auto& c : candidates) {
+                if (c.expected == expected) {
+                    ++count;
+                    ++shard_count[c.shard];
+                }
+            }
+            for (size_t i = 0; i < candidates.size() && count > 0; ++i) {
+                auto& c = candidates[(first + i) % candidates.size()];
+                if (c.expected != expected) {
+                    continue;
+                }
+                auto& on_shard = shard_bytes[c.shard];
+                c.max_bytes = std::min(
+                  {requested_bytes(c),
+                   bytes_left / count,
+                   (shard_limit - on_shard) / shard_count[c.shard]});
+                c.skip_read = is_out_of_budget(c, bytes_left);
+                bytes_left -= c.max_bytes;
+                on_shard += c.max_bytes;
+                --count;
+                --shard_count[c.shard];
+            }
+        };
+
+        assign_shares(expected_data::available);
+        assign_shares(expected_data::unknown);
+        // caught up partitions are very likely to return nothing, they may
+        // use what is left without being charged
+        for (auto& c : candidates) {
+            if (c.expected == expected_data::none) {
+                c.max_bytes = std::min(
+                  {requested_bytes(c),
+                   bytes_left,
+                   shard_limit - shard_bytes[c.shard]});
+                c.skip_read = is_out_of_budget(c, bytes_left);
+            }
+        }
+    }
+
+    static size_t requested_bytes(const candidate& c) {
+        return static_cast<size_t>(std::max(c.fp.max_bytes, 0));
+    }
+
+    // partitions asking for no bytes still read a batch (KIP-74) as long as
+    // there is any budget left
+    static bool is_out_of_budget(const candidate& c, size_t bytes_left) {
+        return c.max_bytes == 0 && (requested_bytes(c) > 0 || bytes_left == 0);
+    }
+};
+
+namespace {
+/**
+ * Partition of a fetch request that is waited on for new data.
+ */
+struct partition_wait_target {
+    model::ktp ktp;
+    model::offset fetch_offset;
+};
+
+/**
+ * Waiters registered by a fetch request on the partitions of one shard. The
+ * state lives on that shard, the first partition that gets new data visible
+ * past its fetch offset, the deadline or the connection being aborted wakes
+ * the request up and aborts the remaining waiters.
+ */
+struct partition_wait_state {
+    ss::abort_source as;
+    std::optional<ss::abort_source::subscription> connection_sub;
+    ss::promise<> woken;
+    bool done = false;
+
+    void wake() {
+        if (done) {
+            return;
+        }
+        done = true;
+        connection_sub.reset();
+        woken.set_value();
+        as.request_abort();
+    }
+};
+
+/// partitions to wait on, grouped by the shard they live on
+using partition_wait_targets
+  = std::vector<std::vector<partition_wait_target>>;
+/// wait targets together with the response the partition was read into
+using partition_wait_candidates = std::vector<std::vector<
+  std::pair<op_context::response_placeholder_ptr, partition_wait_target>>>;
+
+using partition_wait_ptr
+  = ss::foreign_ptr<ss::lw_shared_ptr<partition_wait_state>>;
+
+partition_wait_ptr register_partition_waiters(
+  cluster::partition_manager& mgr,
+  const std::vector<partition_wait_target>& targets,
+  model::timeout_clock::time_point deadline,
+  ssx::sharded_abort_source& connection_as) {
+    auto state = ss::make_lw_shared<partition_wait_state>();
+    state->connection_sub = connection_as.subscribe(
+      [s = state.get()]() noexcept { s->wake(); });
+    if (!state->connection_sub) {
+        state->wake();
+    }
+    for (const auto& t : targets) {
+        if (state->done) {
+            break;
+        }
+        auto partition = mgr.get(t.ktp);
+        if (!partition) {
+            // partition was moved, the next read reports the error
+            state->wake();
+            break;
+        }
+        /**
+         * Translating an offset past the end of the log uses the last known
+         * delta, it may only underestimate the log offset the data will be
+         * at, so the worst case is an early wake up.
+         */
+        auto log_offset = partition->get_offset_translator_state()
+                            ->to_log_offset(t.fetch_offset);
+        ssx::background = partition->raft()
+                            ->visible_offset_monitor()
+                            .wait(log_offset, deadline, state->as)
+                            .then_wrapped([state](ss::future<> f) {
+                                f.ignore_ready_future();
+                                state->wake();
+                            });
+    }
+    return ss::make_foreign(std::move(state));
+}
+
+/**
+ * Waits until any of the partitions that returned no data in the last round
+ * has new data visible, or for the fetch deadline, so that idle partitions
+ * are not read repeatedly while the request waits for min bytes.
+ */
+ss::future<>
+wait_for_new_data(op_context& octx, partition_wait_targets targets) {
+    const auto deadline = octx.deadline.value_or(model::no_timeout);
+    std::vector<ss::future<partition_wait_ptr>> registrations;
+    for (ss::shard_id shard = 0; shard < targets.size(); ++shard) {
+        if (targets[shard].empty()) {
+            continue;
+        }
+        registrations.push_back(octx.rctx.partition_manager().invoke_on(
+          shard,
+          octx.ssg,
+          [targets = std::move(targets[shard]),
+           deadline,
+           &octx](cluster::partition_manager& mgr) {
+              return register_partition_waiters(
+                mgr, targets, deadline, octx.rctx.abort_source());
+          }));
+    }
+    if (registrations.empty()) {
+        co_return;
+    }
+    auto states = co_await ss::when_all_succeed(
+      registrations.begin(), registrations.end());
+
+    ss::condition_variable cv;
+    bool woken = false;
+    std::vector<ss::future<>> waits;
+    waits.reserve(states.size());
+    for (auto& s : states) {
+        waits.push_back(
+          ss::smp::submit_to(
+            s.get_owner_shard(),
+            [s = s.get()] { return s->woken.get_future(); })
+            .then([&woken, &cv] {
+                woken = true;
+                cv.signal();
+            }));
+    }
+    if (octx.skip_idle_session_partitions) {
+        waits.push_back(
+          octx.session_ctx.session()->wait_for_dirty_partition().then_wrapped(
+            [&woken, &cv](ss::future<> f) {
+                f.ignore_ready_future();
+                woken = true;
+                cv.signal();
+            }));
+    }
+    co_await cv.wait([&woken] { return woken; });
+
+    if (octx.skip_idle_session_partitions) {
+        octx.session_ctx.session()->release_dirty_waiter();
+    }
+    // release the waiters on the other shards
+    co_await ss::parallel_for_each(states, [](partition_wait_ptr& s) {
+        return ss::smp::submit_to(
+          s.get_owner_shard(), [s = s.get()] { s->wake(); });
+    });
+    co_await ss::when_all_succeed(waits.begin(), waits.end());
+}
+
+/**
+ * Partitions of the plan that should be waited on if they return no data.
+ */
+partition_wait_candidates collect_wait_candidates(const fetch_plan& plan) {
+    partition_wait_candidates candidates(plan.fetches_per_shard.size());
+    for (size_t shard = 0; shard < plan.fetches_per_shard.size(); ++shard) {
+        const auto& fetch = plan.fetches_per_shard[shard];
+        candidates[shard].reserve(fetch.requests.size());
+        for (size_t i = 0; i < fetch.requests.size(); ++i) {
+            const auto& req = fetch.requests[i];
+            candidates[shard].emplace_back(
+              fetch.responses[i],
+              partition_wait_target{
+                .ktp = req.ktp(), .fetch_offset = req.cfg.start_offset});
+        }
+    }
+    return candidates;
+}
+
+/**
+ * Longest time a partition a fetch session found idle is skipped without
+ * being visited. It bounds how late the session reports changes that are not
+ * new data, e.g. a leadership change.
+ */
+constexpr auto idle_partition_watch_timeout = std::chrono::seconds(10);
+
+/**
+ * Watches a partition a fetch session found idle, runs on the partition shard.
+ * The session partition is marked dirty on the session shard once data past
+ * the fetch offset is visible, the partition is gone or the watch times out.
+ */
+ss::future<> watch_idle_partition(
+  server& srv,
+  ss::shard_id session_shard,
+  fetch_session_id session_id,
+  partition_wait_target target) {
+    if (auto partition = srv.partition_manager().local().get(target.ktp);
+        partition) {
+        auto log_offset = partition->get_offset_translator_state()
+                            ->to_log_offset(target.fetch_offset);
+        try {
+            co_await partition->raft()->visible_offset_monitor().wait(
+              log_offset,
+              model::timeout_clock::now() + idle_partition_watch_timeout,
+              srv.abort_source());
+        } catch (...) {
+            // timed out or the partition was stopped, the next fetch reads it
+            // and reports its state
+        }
+    }
+    if (srv.abort_requested()) {
+        co_return;
+    }
+    co_await srv.container().invoke_on(
+      session_shard, [session_id, ktp = std::move(target.ktp)](server& s) {
+          s.fetch_sessions_cache().mark_dirty(session_id, ktp.as_tp_view());
+      });
+}
+} // namespace
+
 /**
  * Process partition fetch requests.
  *
@@ -850,9 +1376,14 @@ static ss::future<> fetch_topic_partitions(op_context& octx) {
     auto bytes_left_before = octx.bytes_left;
 
     auto start_time = latency_probe::hist_t::clock_type::now();
-    auto planner = make_fetch_planner<simple_fetch_planner>();
+    auto planner = make_fetch_planner<balanced_fetch_planner>();
 
     auto fetch_plan = planner.create_plan(octx);
+    const bool wait_for_data
+      = config::shard_local_cfg().fetch_reads_wait_for_new_data()
+        && octx.deadline.has_value();
+    auto wait_candidates = wait_for_data ? collect_wait_candidates(fetch_plan)
+                                         : partition_wait_candidates{};
 
     fetch_plan_executor executor
       = make_fetch_plan_executor<parallel_fetch_plan_executor>();
@@ -860,16 +1391,25 @@ static ss::future<> fetch_topic_partitions(op_context& octx) {
 
     auto end_time = latency_probe::hist_t::clock_type::now();
 
-    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
-      end_time - start_time);
-
     octx.rctx.probe().record_fetch_plan_and_execute_measurement(
-      latency, bytes_left_before == octx.bytes_left);
+      end_time - start_time, bytes_left_before == octx.bytes_left);
 
     if (octx.should_stop_fetch()) {
         co_return;
     }
 
+    if (wait_for_data) {
+        partition_wait_targets targets(wait_candidates.size());
+        for (size_t shard = 0; shard < wait_candidates.size(); ++shard) {
+            for (auto& [response, target] : wait_candidates[shard]) {
+                if (!response->has_error() && response->empty()) {
+                    targets[shard].push_back(std::move(target));
+                }
+            }
+        }
+        co_await wait_for_new_data(octx, std::move(targets));
+    }
+
     octx.reset_context();
     // debounce next read retry
     co_await ss::sleep(std::min(
@@ -882,6 +1422,11 @@ kafka::fetch_plan make_simple_fetch_plan(op_context& octx) {
     auto planner = make_fetch_planner<simple_fetch_planner>();
     return planner.create_plan(octx);
 }
+
+kafka::fetch_plan make_balanced_fetch_plan(op_context& octx) {
+    auto planner = make_fetch_planner<balanced_fetch_planner>();
+    return planner.create_plan(octx);
+}
 } // namespace testing
 
 template<>
@@ -921,6 +1466,7 @@ fetch_handler::handle(request_context rctx, ss::smp_service_group ssg) {
                         return std::move(octx).send_error_response(
                           error_code::broker_not_available);
                     }
+                    octx.watch_idle_session_partitions();
                     return std::move(octx).send_response();
                 });
           });
@@ -956,9 +1502,76 @@ op_context::op_context(request_context&& ctx, ss::smp_service_group ssg)
       config::shard_local_cfg().fetch_max_bytes(),
       size_t(request.data.max_bytes));
     session_ctx = rctx.fetch_sessions().maybe_get_session(request);
+    if (
+      !session_ctx.is_sessionless()
+      && config::shard_local_cfg().fetch_session_skip_idle_partitions()) {
+        skip_idle_session_partitions = true;
+        session_dirtied_at_start = session_ctx.session()->dirtied();
+    }
     create_response_placeholders();
 }
 
+void op_context::watch_idle_session_partitions() {
+    if (!skip_idle_session_partitions) {
+        return;
+    }
+    auto& session_partitions = session_ctx.session()->partitions();
+    std::vector<std::vector<partition_wait_target>> targets(ss::smp::count);
+    bool any = false;
+    for (auto& ph : iteration_order) {
+        if (ph.has_to_be_included()) {
+            continue;
+        }
+        auto it = session_partitions.find(
+          model::topic_partition_view(ph.topic(), ph.partition_id()));
+        if (it == session_partitions.end()) {
+            continue;
+        }
+        const auto& fp = it->second->partition;
+        auto shard = rctx.shards().shard_for(fp.topic_partition);
+        if (!shard) {
+            continue;
+        }
+        session_partitions.mark_clean(it);
+        targets[*shard].push_back(partition_wait_target{
+          .ktp = fp.topic_partition, .fetch_offset = fp.fetch_offset});
+        any = true;
+    }
+    if (!any) {
+        return;
+    }
+    auto& srv = rctx.server();
+    const auto session_shard = ss::this_shard_id();
+    const auto session_id = session_ctx.session()->id();
+    for (ss::shard_id shard = 0; shard < targets.size(); ++shard) {
+        if (targets[shard].empty()) {
+            continue;
+        }
+        ssx::spawn_with_gate(
+          srv.local().conn_gate(),
+          [&srv,
+           shard,
+           session_shard,
+           session_id,
+           targets = std::move(targets[shard])]() mutable {
+              return srv.invoke_on(
+                shard,
+                [session_shard, session_id, targets = std::move(targets)](
+                  server& s) mutable {
+                    for (auto& t : targets) {
+                        ssx::spawn_with_gate(
+                          s.conn_gate(),
+                          [&s, session_shard, session_id, t = std::move(t)]()
+                            mutable {
+                              return watch_idle_partition(
+                                s, session_shard, session_id, std::move(t));
+                          });
+                    }
+                });
+          });
+    }
+}
+
 // insert and reserve space for a new topic in the response
 void op_context::start_response_topic(const fetch_request::topic& topic) {
     response.data.topics.emplace_back(
@@ -988,25 +1601,35 @@ void op_context::create_response_placeholders() {
           });
     } else {
         model::topic last_topic;
-        std::for_each(
-          session_ctx.session()->partitions().cbegin_insertion_order(),
-          session_ctx.session()->partitions().cend_insertion_order(),
-          [this, &last_topic](const fetch_session_partition& fp) {
-              auto& topic = fp.topic_partition.get_topic();
-              if (last_topic != topic) {
-                  response.data.topics.emplace_back(
-                    fetchable_topic_response{.name = topic});
-                  last_topic = topic;
-              }
-              fetch_response::partition_response p{
-                .partition_index = fp.topic_partition.get_partition(),
-                .error_code = error_code::none,
-                .high_watermark = fp.high_watermark,
-                .last_stable_offset = fp.last_stable_offset,
-                .records = batch_reader()};
-
-              response.data.topics.back().partitions.push_back(std::move(p));
-          });
+        auto add_partition = [this, &last_topic](
+                               const fetch_session_partition& fp) {
+            auto& topic = fp.topic_partition.get_topic();
+            if (last_topic != topic) {
+                response.data.topics.emplace_back(
+                  fetchable_topic_response{.name = topic});
+                last_topic = topic;
+            }
+            fetch_response::partition_response p{
+              .partition_index = fp.topic_partition.get_partition(),
+              .error_code = error_code::none,
+              .high_watermark = fp.high_watermark,
+              .last_stable_offset = fp.last_stable_offset,
+              .records = batch_reader()};
+
+            response.data.topics.back().partitions.push_back(std::move(p));
+        };
+        const auto& partitions = session_ctx.session()->partitions();
+        if (skip_idle_session_partitions) {
+            std::for_each(
+              partitions.cbegin_dirty_order(),
+              partitions.cend_dirty_order(),
+              add_partition);
+        } else {
+            std::for_each(
+              partitions.cbegin_insertion_order(),
+              partitions.cend_insertion_order(),
+              add_partition);
+        }
     }
     for (auto it = response.begin(); it != response.end(); ++it) {
         auto raw = new response_placeholder(it, this); // NOLINT
@@ -19,9 +19,10 @@
 #include "model/metadata.h"
 #include "ssx/abort_source.h"
 #include "utils/intrusive_list_helpers.h"
-#include "utils/log_hist.h"
+#include "utils/latency_hist.h"
 
 #include <seastar/core/smp.hh>
+#include <seastar/util/bool_class.hh>
 
 #include <memory>
 
@@ -33,7 +34,7 @@ using fetch_handler = single_stage_handler<fetch_api, 4, 11>;
  * Fetch operation context
  */
 struct op_context {
-    using latency_clock = log_hist_internal::clock_type;
+    using latency_clock = latency_hist::clock_type;
     using latency_point = latency_clock::time_point;
 
     class response_placeholder {
@@ -51,6 +52,9 @@ struct op_context {
         bool has_error() {
             return _it->partition_response->error_code != error_code::none;
         }
+        bool has_to_be_included() {
+            return _it->partition_response->has_to_be_included;
+        }
         void move_to_end() {
             _ctx->iteration_order.erase(
               _ctx->iteration_order.iterator_to(*this));
@@ -111,9 +115,26 @@ struct op_context {
         return !request.debounce_delay() || over_min_bytes()
                || is_empty_request() || contains_preferred_replica
                || response_error || rctx.abort_requested()
-               || deadline <= model::timeout_clock::now();
+               || deadline <= model::timeout_clock::now()
+               || session_partitions_dirtied();
+    }
+
+    /**
+     * True if session partitions this fetch does not visit got new data since
+     * it started, it is better to return and let the client fetch again than
+     * to keep waiting on the partitions of this fetch.
+     */
+    bool session_partitions_dirtied() const {
+        return skip_idle_session_partitions
+               && session_ctx.session()->dirtied() != session_dirtied_at_start;
     }
 
+    /**
+     * Marks the session partitions this fetch found idle clean and watches
+     * them for new data, so that the following incremental fetches skip them.
+     */
+    void watch_idle_session_partitions();
+
     bool over_min_bytes() const {
         return static_cast<int32_t>(response_size) >= request.data.min_bytes;
     }
@@ -157,6 +178,10 @@ struct op_context {
     // for fetches that have preferred replica set we skip read, therefore we
     // need other indicator of finished fetch request.
     bool contains_preferred_replica = false;
+    // incremental fetches visit only the dirty session partitions, see
+    // fetch_partitions_linked_hash_map
+    bool skip_idle_session_partitions = false;
+    uint64_t session_dirtied_at_start = 0;
 };
 
 struct fetch_config {
@@ -173,6 +198,7 @@ struct fetch_config {
     std::optional<std::reference_wrapper<ssx::sharded_abort_source>>
       abort_source;
     std::optional<model::client_address_t> client_address;
+    std::optional<fetch_session_id> session_id;
 
     friend std::ostream& operator<<(std::ostream& o, const fetch_config& cfg) {
         fmt::print(
@@ -219,6 +245,8 @@ struct read_result {
     using foreign_data_t = ss::foreign_ptr<std::unique_ptr<iobuf>>;
     using data_t = std::unique_ptr<iobuf>;
     using variant_t = std::variant<data_t, foreign_data_t>;
+    using zero_copy_foreign_data
+      = ss::bool_class<struct zero_copy_foreign_data_tag>;
 
     /// Holds semaphore units from memory semaphores. Can be passed across
     /// shards, semaphore units will be released in the shard where the instance
@@ -307,16 +335,10 @@ struct read_result {
           });
     }
 
-    iobuf release_data() && {
-        return ss::visit(
-          data,
-          [](data_t& d) { return std::move(*d); },
-          [](foreign_data_t& d) {
-              auto ret = d->copy();
-              d.reset();
-              return ret;
-          });
-    }
+    /// Data read on another shard are copied, unless \p zero_copy is set,
+    /// see release_data in fetch.cc
+    iobuf release_data(zero_copy_foreign_data zero_copy
+                       = zero_copy_foreign_data::no) &&;
 
     variant_t data;
     model::offset start_offset;
@@ -415,6 +437,13 @@ ss::future<read_result> read_from_ntp(
  */
 kafka::fetch_plan make_simple_fetch_plan(op_context& octx);
 
+/**
+ * Create a fetch plan with the balanced fetch planner.
+ *
+ * Exposed for testing/benchmarking only.
+ */
+kafka::fetch_plan make_balanced_fetch_plan(op_context& octx);
+
 read_result::memory_units_t reserve_memory_units(
   ssx::semaphore& memory_sem,
   ssx::semaphore& memory_fetch_sem,
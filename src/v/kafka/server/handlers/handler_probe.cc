@@ -100,6 +100,13 @@ void handler_probe::setup_metrics(
           [this] { return _bytes_sent; },
           sm::description("Number of bytes sent in kafka replies"),
           labels),
+        sm::make_counter(
+          "response_blocked_microseconds_total",
+          [this] { return _response_blocked_us; },
+          sm::description(
+            "Time responses were ready but waited for the responses to earlier "
+            "requests of the same connection"),
+          labels),
         sm::make_histogram(
           "latency_microseconds",
           sm::description("Latency histogram of kafka requests"),
@@ -15,6 +15,7 @@
 #include "metrics/metrics.h"
 #include "utils/log_hist.h"
 
+#include <chrono>
 #include <optional>
 
 namespace kafka {
@@ -59,6 +60,11 @@ public:
 
     void add_bytes_sent(size_t bytes) { _bytes_sent += bytes; }
 
+    void add_response_blocked(std::chrono::steady_clock::duration d) {
+        _response_blocked_us
+          += std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+    }
+
     std::unique_ptr<hist_t::measurement> auto_latency_measurement() {
         return _latency.auto_measure();
     }
@@ -74,6 +80,7 @@ private:
 
     uint64_t _bytes_received{0};
     uint64_t _bytes_sent{0};
+    uint64_t _response_blocked_us{0};
 
     hist_t _latency{};
 };
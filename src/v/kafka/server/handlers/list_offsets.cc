@@ -21,6 +21,14 @@
 #include "kafka/server/response.h"
 #include "model/namespace.h"
 #include "resource_mgmt/io_priority.h"
+#include "vassert.h"
+
+#include <seastar/core/coroutine.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <functional>
+#include <vector>
 
 namespace kafka {
 
@@ -142,102 +150,148 @@ static ss::future<list_offset_partition_response> list_offsets_partition(
     co_return list_offsets_response::make_partition(id, error_code::none);
 }
 
-static ss::future<list_offset_partition_response> list_offsets_partition(
-  list_offsets_ctx& octx,
-  model::timestamp timestamp,
-  list_offset_topic& topic,
-  list_offset_partition& part) {
-    model::ktp ktp(topic.name, part.partition_index);
-
-    auto shard = octx.rctx.shards().shard_for(ktp);
-    if (!shard) {
-        return ss::make_ready_future<list_offset_partition_response>(
-          list_offsets_response::make_partition(
-            ktp.get_partition(), error_code::unknown_topic_or_partition));
-    }
+struct list_offsets_partition_request {
+    model::ktp ktp;
+    model::timestamp timestamp;
+    kafka::leader_epoch current_leader_epoch;
+};
 
+/*
+ * the partitions of the request led by a shard, along with their placeholder
+ * in the response. queries are routed to shards in batches rather than one
+ * cross-shard call per partition, which matters for the monitoring tools
+ * listing the offsets of every partition of a cluster.
+ */
+struct shard_op_ctx {
+    std::vector<list_offsets_partition_request> requests;
+    std::vector<std::reference_wrapper<list_offset_partition_response>>
+      responses;
+};
+
+static ss::future<std::vector<list_offset_partition_response>>
+list_offsets_shard(
+  list_offsets_ctx& octx,
+  ss::shard_id shard,
+  std::vector<list_offsets_partition_request> requests) {
     return octx.rctx.partition_manager().invoke_on(
-      *shard,
+      shard,
       octx.ssg,
-      [timestamp,
-       &octx,
-       ntp = std::move(ktp),
+      [&octx,
+       requests = std::move(requests),
        isolation_lvl = model::isolation_level(
-         octx.request.data.isolation_level),
-       current_leader_epoch = part.current_leader_epoch](
+         octx.request.data.isolation_level)](
         cluster::partition_manager& mgr) mutable {
-          return list_offsets_partition(
-            octx,
-            timestamp,
-            std::move(ntp),
-            isolation_lvl,
-            current_leader_epoch,
-            mgr);
+          std::vector<ss::future<list_offset_partition_response>> partitions;
+          partitions.reserve(requests.size());
+          for (auto& r : requests) {
+              partitions.push_back(list_offsets_partition(
+                octx,
+                r.timestamp,
+                std::move(r.ktp),
+                isolation_lvl,
+                r.current_leader_epoch,
+                mgr));
+          }
+          return ss::when_all_succeed(partitions.begin(), partitions.end());
       });
 }
 
-static ss::future<list_offset_topic_response>
-list_offsets_topic(list_offsets_ctx& octx, list_offset_topic& topic) {
-    std::vector<ss::future<list_offset_partition_response>> partitions;
-    partitions.reserve(topic.partitions.size());
-
-    const auto* disabled_set
-      = octx.rctx.metadata_cache().get_topic_disabled_set(
-        model::topic_namespace_view{model::kafka_namespace, topic.name});
-
-    for (auto& part : topic.partitions) {
-        if (octx.request.duplicate_tp(topic.name, part.partition_index)) {
-            partitions.push_back(
-              ss::make_ready_future<list_offset_partition_response>(
-                list_offsets_response::make_partition(
-                  part.partition_index, error_code::invalid_request)));
-            continue;
-        }
-
-        if (!octx.rctx.metadata_cache().contains(
-              model::topic_namespace_view(model::kafka_namespace, topic.name),
-              part.partition_index)) {
-            partitions.push_back(
-              ss::make_ready_future<list_offset_partition_response>(
-                list_offsets_response::make_partition(
-                  part.partition_index,
-                  error_code::unknown_topic_or_partition)));
-            continue;
-        }
-
-        if (disabled_set && disabled_set->is_disabled(part.partition_index)) {
-            partitions.push_back(
-              ss::make_ready_future<list_offset_partition_response>(
-                list_offsets_response::make_partition(
-                  part.partition_index, error_code::replica_not_available)));
-            continue;
-        }
-
-        auto pr = list_offsets_partition(octx, part.timestamp, topic, part);
-        partitions.push_back(std::move(pr));
-    }
-
-    return when_all_succeed(partitions.begin(), partitions.end())
-      .then([name = std::move(topic.name)](
-              std::vector<list_offset_partition_response> parts) mutable {
-          return list_offset_topic_response{
-            .name = std::move(name),
-            .partitions = std::move(parts),
-          };
+static ss::future<> list_offsets_shards(
+  list_offsets_ctx& octx,
+  absl::flat_hash_map<ss::shard_id, shard_op_ctx> requests_per_shard) {
+    using value_t = absl::flat_hash_map<ss::shard_id, shard_op_ctx>::value_type;
+    return ss::parallel_for_each(
+      std::move(requests_per_shard), [&octx](value_t& p) {
+          return list_offsets_shard(octx, p.first, std::move(p.second.requests))
+            .then([responses = std::move(p.second.responses)](
+                    std::vector<list_offset_partition_response> results) {
+                vassert(
+                  results.size() == responses.size(),
+                  "expected a list offsets result for each requested "
+                  "partition. Requested partitions: {}, results: {}",
+                  responses.size(),
+                  results.size());
+                auto it = responses.begin();
+                for (auto& r : results) {
+                    it->get() = std::move(r);
+                    ++it;
+                }
+            });
       });
 }
 
-static std::vector<ss::future<list_offset_topic_response>>
+static ss::future<std::vector<list_offset_topic_response>>
 list_offsets_topics(list_offsets_ctx& octx) {
-    std::vector<ss::future<list_offset_topic_response>> topics;
+    std::vector<list_offset_topic_response> topics;
     topics.reserve(octx.request.data.topics.size());
 
+    absl::flat_hash_map<ss::shard_id, shard_op_ctx> requests_per_shard;
+
     for (auto& topic : octx.request.data.topics) {
-        auto tr = list_offsets_topic(octx, topic);
-        topics.push_back(std::move(tr));
+        topics.push_back(list_offset_topic_response{});
+        auto& topic_response = topics.back();
+        topic_response.partitions.reserve(topic.partitions.size());
+
+        const auto* disabled_set
+          = octx.rctx.metadata_cache().get_topic_disabled_set(
+            model::topic_namespace_view{model::kafka_namespace, topic.name});
+
+        for (auto& part : topic.partitions) {
+            if (octx.request.duplicate_tp(topic.name, part.partition_index)) {
+                topic_response.partitions.push_back(
+                  list_offsets_response::make_partition(
+                    part.partition_index, error_code::invalid_request));
+                continue;
+            }
+
+            if (!octx.rctx.metadata_cache().contains(
+                  model::topic_namespace_view(
+                    model::kafka_namespace, topic.name),
+                  part.partition_index)) {
+                topic_response.partitions.push_back(
+                  list_offsets_response::make_partition(
+                    part.partition_index,
+                    error_code::unknown_topic_or_partition));
+                continue;
+            }
+
+            if (
+              disabled_set && disabled_set->is_disabled(part.partition_index)) {
+                topic_response.partitions.push_back(
+                  list_offsets_response::make_partition(
+                    part.partition_index, error_code::replica_not_available));
+                continue;
+            }
+
+            model::ktp ktp(topic.name, part.partition_index);
+            auto shard = octx.rctx.shards().shard_for(ktp);
+            if (!shard) {
+                topic_response.partitions.push_back(
+                  list_offsets_response::make_partition(
+                    part.partition_index,
+                    error_code::unknown_topic_or_partition));
+                continue;
+            }
+
+            // add response placeholder. partitions are reserved, reference to
+            // the response is stable and we can capture it
+            topic_response.partitions.push_back(
+              list_offset_partition_response{
+                .partition_index = part.partition_index});
+            auto& per_shard = requests_per_shard[*shard];
+            per_shard.requests.push_back(list_offsets_partition_request{
+              .ktp = std::move(ktp),
+              .timestamp = part.timestamp,
+              .current_leader_epoch = part.current_leader_epoch,
+            });
+            per_shard.responses.push_back(
+              std::ref(topic_response.partitions.back()));
+        }
+        topic_response.name = std::move(topic.name);
     }
 
-    return topics;
+    co_await list_offsets_shards(octx, std::move(requests_per_shard));
+    co_return topics;
 }
 
 /*
@@ -324,9 +378,8 @@ list_offsets_handler::handle(request_context ctx, ss::smp_service_group ssg) {
       std::move(ctx), std::move(request), ssg, std::move(unauthorized_topics));
 
     return ss::do_with(std::move(octx), [](list_offsets_ctx& octx) {
-        auto topics = list_offsets_topics(octx);
-        return when_all_succeed(topics.begin(), topics.end())
-          .then([&octx](std::vector<list_offset_topic_response> topics) {
+        return list_offsets_topics(octx).then(
+          [&octx](std::vector<list_offset_topic_response> topics) {
               octx.response.data.topics = std::move(topics);
               handle_unauthorized(octx);
               return octx.rctx.respond(std::move(octx.response));
@@ -21,7 +21,9 @@
 #include "kafka/server/handlers/details/leader_epoch.h"
 #include "kafka/server/handlers/details/security.h"
 #include "kafka/server/handlers/topics/topic_utils.h"
+#include "kafka/server/metadata_response_cache.h"
 #include "kafka/server/response.h"
+#include "kafka/server/server.h"
 #include "kafka/types.h"
 #include "likely.h"
 #include "model/metadata.h"
@@ -237,6 +239,22 @@ make_error_topic_response(model::topic tp, error_code ec) {
     return metadata_response::topic{.error_code = ec, .name = std::move(tp)};
 }
 
+/**
+ * Leaderless partitions are answered with a former or a random replica, these
+ * responses can not be cached.
+ */
+static bool all_partitions_have_leader(
+  const cluster::metadata_cache& md_cache, const cluster::topic_metadata& md) {
+    const auto& tp_ns = md.get_configuration().tp_ns;
+    return std::all_of(
+      md.get_assignments().begin(),
+      md.get_assignments().end(),
+      [&](const auto& p_as) {
+          auto lt = md_cache.get_leader_term(tp_ns, p_as.id);
+          return lt && lt->leader.has_value();
+      });
+}
+
 static metadata_response::topic make_topic_response(
   request_context& ctx,
   metadata_request& rq,
@@ -251,8 +269,25 @@ static metadata_response::topic make_topic_response(
           details::authorized_operations(ctx, md.get_configuration().tp_ns.tp));
     }
 
+    const auto& tp_ns = md.get_configuration().tp_ns;
+    auto& cache = ctx.server().local().get_metadata_response_cache();
+    // the responses of an isolated node or in recovery mode are not cached,
+    // they are built from the state of the node, not of the topic
+    const bool use_cache = cache.enabled() && !is_node_isolated
+                           && !ctx.recovery_mode_enabled()
+                           && tp_ns.ns == model::kafka_namespace;
+    if (use_cache) {
+        if (auto cached = cache.get(tp_ns.tp); cached) {
+            cached->topic_authorized_operations = auth_operations;
+            return std::move(*cached);
+        }
+    }
+
     auto res = make_topic_response_from_topic_metadata(
       ctx.metadata_cache(), md, is_node_isolated, ctx.recovery_mode_enabled());
+    if (use_cache && all_partitions_have_leader(ctx.metadata_cache(), md)) {
+        cache.put(tp_ns.tp, res);
+    }
     res.topic_authorized_operations = auth_operations;
     return res;
 }
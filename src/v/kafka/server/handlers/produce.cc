@@ -17,6 +17,7 @@
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/kafka_batch_adapter.h"
 #include "kafka/server/replicated_partition.h"
+#include "kafka/server/server.h"
 #include "likely.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -32,6 +33,7 @@
 #include "utils/to_string.h"
 #include "vlog.h"
 
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/execution_stage.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/shared_ptr.hh>
@@ -192,9 +194,11 @@ static partition_produce_stages partition_append(
   int16_t acks,
   int32_t num_records,
   int64_t num_bytes,
-  std::chrono::milliseconds timeout_ms) {
-    auto stages = partition->replicate(
-      bid, std::move(reader), acks_to_replicate_options(acks, timeout_ms));
+  std::chrono::milliseconds timeout_ms,
+  request_trace* trace) {
+    auto opts = acks_to_replicate_options(acks, timeout_ms);
+    opts.trace = trace;
+    auto stages = partition->replicate(bid, std::move(reader), opts);
     return partition_produce_stages{
       .dispatched = std::move(stages.request_enqueued),
       .produced = stages.replicate_finished.then_wrapped(
@@ -316,6 +320,38 @@ static auto validate_batch_timestamps(
     }
 }
 
+/**
+ * Transcodes the batch to the compression type its topic enforces, if any,
+ * then validates its schema ids.
+ */
+static ss::future<pandaproxy::schema_registry::schema_id_validator::result>
+recompress_and_validate(
+  batch_recompressor& recompressor,
+  std::optional<model::compression> recompression,
+  model::record_batch batch,
+  std::optional<pandaproxy::schema_registry::schema_id_validator> validator,
+  cluster::partition_probe* probe,
+  request_trace* trace) {
+    request_trace::scope span(trace, "kafka.produce.validate");
+    if (recompression) {
+        const auto hdr = batch.header();
+        try {
+            batch = co_await recompressor.recompress(
+              std::move(batch), *recompression);
+        } catch (...) {
+            vlog(
+              klog.warn,
+              "Failed to transcode batch {} to {}: {}",
+              hdr,
+              *recompression,
+              std::current_exception());
+            co_return error_code::corrupt_message;
+        }
+    }
+    co_return co_await pandaproxy::schema_registry::maybe_validate_schema_id(
+      std::move(validator), reader_from_lcore_batch(std::move(batch)), probe);
+}
+
 /**
  * \brief handle writing to a single topic partition.
  */
@@ -338,9 +374,6 @@ static partition_produce_stages produce_topic_partition(
           .error_code = error_code::not_leader_for_partition});
     }
 
-    // steal the batch from the adapter
-    auto batch = std::move(part.records->adapter.batch.value());
-
     auto topic_cfg = octx.rctx.metadata_cache().get_topic_cfg(
       model::topic_namespace_view(model::kafka_namespace, topic.name));
 
@@ -355,34 +388,39 @@ static partition_produce_stages produce_topic_partition(
     const auto batch_max_bytes = topic_cfg->properties.batch_max_bytes.value_or(
       octx.rctx.metadata_cache().get_default_batch_max_bytes());
 
-    // validate the batch timestamps by checking skew against broker time
-    if (
-      auto new_timestamp = validate_batch_timestamps(
-        ntp, batch.header(), timestamp_type, octx.rctx.server_probe())) {
-        batch.set_max_timestamp(
-          model::timestamp_type::append_time, new_timestamp.value());
-    }
+    // validate the batch timestamps by checking skew against broker time, the
+    // append time is set on the partition's shard as it recomputes the CRC
+    const auto& hdr = part.records->adapter.batch->header();
+    auto new_timestamp = validate_batch_timestamps(
+      ntp, hdr, timestamp_type, octx.rctx.server_probe());
 
-    const auto& hdr = batch.header();
     auto bid = model::batch_identity::from(hdr);
-    auto batch_size = batch.size_bytes();
-    auto num_records = batch.record_count();
-    auto reader = reader_from_lcore_batch(std::move(batch));
+    auto batch_size = part.records->adapter.batch->size_bytes();
+    auto num_records = hdr.record_count;
     auto validator
       = pandaproxy::schema_registry::maybe_make_schema_id_validator(
         octx.rctx.schema_registry(), topic.name, topic_cfg->properties);
+    std::optional<model::compression> recompression;
+    if (config::shard_local_cfg().kafka_produce_recompression()) {
+        recompression = batch_recompressor::target_compression(
+          topic_cfg->properties.compression.value_or(
+            octx.rctx.metadata_cache().get_default_compression()),
+          hdr);
+    }
     auto start = std::chrono::steady_clock::now();
 
     auto dispatch = std::make_unique<ss::promise<>>();
     auto dispatch_f = dispatch->get_future();
-    auto m = octx.rctx.probe().auto_produce_measurement();
     auto f
       = octx.rctx.partition_manager()
           .invoke_on(
             *shard,
             octx.ssg,
-            [reader = std::move(reader),
+            [adapter = std::move(part.records->adapter),
+             new_timestamp,
              validator = std::move(validator),
+             recompression,
+             &servers = octx.rctx.connection()->server().container(),
              ntp = std::move(ntp),
              dispatch = std::move(dispatch),
              num_records,
@@ -391,8 +429,11 @@ static partition_produce_stages produce_topic_partition(
              acks = octx.request.data.acks,
              batch_max_bytes,
              timeout = octx.request.data.timeout_ms,
+             trace = octx.rctx.trace(),
+             start,
              source_shard = ss::this_shard_id()](
               cluster::partition_manager& mgr) mutable {
+                request_trace::add_span(trace, "kafka.produce.hop", start);
                 auto partition = mgr.get(ntp);
                 if (!partition) {
                     return finalize_request_with_error_code(
@@ -417,9 +458,38 @@ static partition_produce_stages produce_topic_partition(
                       source_shard);
                 }
 
+                // the CRC and records checks run on this shard, overlapped
+                // with the work of the connection's shard, unless they were
+                // already done when the request was handled
+                adapter.verify();
+                if (unlikely(!adapter.valid_crc)) {
+                    return finalize_request_with_error_code(
+                      error_code::corrupt_message,
+                      std::move(dispatch),
+                      ntp,
+                      source_shard);
+                }
+                if (unlikely(!adapter.batch)) {
+                    return finalize_request_with_error_code(
+                      error_code::invalid_record,
+                      std::move(dispatch),
+                      ntp,
+                      source_shard);
+                }
+                auto batch = std::move(adapter.batch.value());
+                if (new_timestamp) {
+                    batch.set_max_timestamp(
+                      model::timestamp_type::append_time,
+                      new_timestamp.value());
+                }
                 auto probe = std::addressof(partition->probe());
-                return pandaproxy::schema_registry::maybe_validate_schema_id(
-                         std::move(validator), std::move(reader), probe)
+                return recompress_and_validate(
+                         servers.local().get_batch_recompressor(),
+                         recompression,
+                         std::move(batch),
+                         std::move(validator),
+                         probe,
+                         trace)
                   .then([ntp{std::move(ntp)},
                          partition{std::move(partition)},
                          dispatch = std::move(dispatch),
@@ -428,7 +498,8 @@ static partition_produce_stages produce_topic_partition(
                          source_shard,
                          num_records,
                          batch_size,
-                         timeout](auto reader) mutable {
+                         timeout,
+                         trace](auto reader) mutable {
                       if (reader.has_error()) {
                           return finalize_request_with_error_code(
                             reader.assume_error(),
@@ -445,7 +516,8 @@ static partition_produce_stages produce_topic_partition(
                         acks,
                         num_records,
                         batch_size,
-                        timeout);
+                        timeout,
+                        trace);
                       return stages.dispatched
                         .then_wrapped(
                           [source_shard, dispatch = std::move(dispatch)](
@@ -472,13 +544,13 @@ static partition_produce_stages produce_topic_partition(
                         });
                   });
             })
-          .then([&octx, start, m = std::move(m)](
-                  produce_response::partition p) {
+          .then([&octx, start](produce_response::partition p) {
+              request_trace::add_span(
+                octx.rctx.trace(), "kafka.produce.partition", start);
               if (p.error_code == error_code::none) {
                   auto dur = std::chrono::steady_clock::now() - start;
+                  octx.rctx.probe().record_produce_latency(dur);
                   octx.rctx.connection()->server().update_produce_latency(dur);
-              } else {
-                  m->cancel();
               }
               return p;
           });
@@ -561,6 +633,13 @@ produce_topic(produce_ctx& octx, produce_request::topic& topic) {
             continue;
         }
 
+        // the batch checks run here unless they are deferred to the shard of
+        // the partition, see produce_topic_partition
+        if (!config::shard_local_cfg()
+               .kafka_produce_validation_on_partition_shard()) {
+            part.records->adapter.verify();
+        }
+
         if (unlikely(!part.records->adapter.valid_crc)) {
             push_error_response(error_code::corrupt_message);
             continue;
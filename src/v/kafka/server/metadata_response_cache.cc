@@ -0,0 +1,68 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/metadata_response_cache.h"
+
+#include "cluster/metadata_cache.h"
+#include "model/namespace.h"
+
+namespace kafka {
+
+metadata_response_cache::metadata_response_cache(
+  cluster::metadata_cache& md_cache, config::binding<bool> enabled)
+  : _md_cache(md_cache)
+  , _enabled(std::move(enabled)) {
+    _enabled.watch([this] {
+        if (!_enabled()) {
+            _topics.clear();
+        }
+    });
+    _topics_notification = _md_cache.register_topic_delta_notification(
+      [this](cluster::topic_table::delta_range_t deltas) {
+          for (const auto& d : deltas) {
+              invalidate(model::topic_namespace_view(d.ntp));
+          }
+      });
+    _leaders_notification = _md_cache.register_leaders_update_notification(
+      [this](model::topic_namespace_view tp_ns) { invalidate(tp_ns); });
+}
+
+metadata_response_cache::~metadata_response_cache() {
+    _md_cache.unregister_topic_delta_notification(_topics_notification);
+    _md_cache.unregister_leaders_update_notification(_leaders_notification);
+}
+
+std::optional<metadata_response::topic>
+metadata_response_cache::get(const model::topic& topic) {
+    auto it = _topics.find(topic);
+    if (it == _topics.end()) {
+        ++_misses;
+        return std::nullopt;
+    }
+    ++_hits;
+    return it->second;
+}
+
+void metadata_response_cache::put(
+  const model::topic& topic, const metadata_response::topic& response) {
+    if (!enabled()) {
+        return;
+    }
+    _topics.insert_or_assign(topic, response);
+}
+
+void metadata_response_cache::invalidate(model::topic_namespace_view tp_ns) {
+    if (_topics.empty() || tp_ns.ns != model::kafka_namespace) {
+        return;
+    }
+    _topics.erase(tp_ns.tp);
+}
+
+} // namespace kafka
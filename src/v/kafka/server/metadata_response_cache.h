@@ -0,0 +1,68 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "cluster/fwd.h"
+#include "cluster/types.h"
+#include "config/property.h"
+#include "kafka/protocol/metadata.h"
+#include "model/fundamental.h"
+
+#include <absl/container/flat_hash_map.h>
+
+#include <optional>
+
+namespace kafka {
+
+/**
+ * Shard local cache of the topic parts of metadata responses.
+ *
+ * Clients polling the metadata of many topics ask again and again for the
+ * same, rarely changing, data. The topic responses built from the metadata
+ * cache are kept and copied into the next responses, which skips the leaders
+ * lookups of every partition. An entry is dropped when the topic table or the
+ * leadership of one of the topic's partitions changes.
+ */
+class metadata_response_cache {
+public:
+    metadata_response_cache(cluster::metadata_cache&, config::binding<bool>);
+
+    metadata_response_cache(const metadata_response_cache&) = delete;
+    metadata_response_cache(metadata_response_cache&&) = delete;
+    metadata_response_cache& operator=(const metadata_response_cache&)
+      = delete;
+    metadata_response_cache& operator=(metadata_response_cache&&) = delete;
+    ~metadata_response_cache();
+
+    bool enabled() const { return _enabled(); }
+
+    /// Returns a copy of the cached response of the kafka topic
+    std::optional<metadata_response::topic> get(const model::topic&);
+
+    void put(const model::topic&, const metadata_response::topic&);
+
+    size_t size() const { return _topics.size(); }
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+
+private:
+    void invalidate(model::topic_namespace_view);
+
+    cluster::metadata_cache& _md_cache;
+    config::binding<bool> _enabled;
+    cluster::notification_id_type _topics_notification;
+    cluster::notification_id_type _leaders_notification;
+    absl::flat_hash_map<model::topic, metadata_response::topic> _topics;
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+};
+
+} // namespace kafka
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/offset_commit_batcher.h"
+
+#include "cluster/partition.h"
+#include "kafka/server/logger.h"
+#include "model/record_batch_reader.h"
+#include "ssx/future-util.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/as_future.hh>
+
+namespace kafka {
+
+offset_commit_batcher::offset_commit_batcher(
+  ss::lw_shared_ptr<cluster::partition> partition,
+  config::binding<std::chrono::milliseconds> window)
+  : _partition(std::move(partition))
+  , _window(std::move(window)) {
+    _flush_timer.set_callback([this] { flush(); });
+    _window.watch([this] {
+        if (!enabled()) {
+            flush();
+        }
+    });
+}
+
+offset_commit_batcher::~offset_commit_batcher() {
+    _flush_timer.cancel();
+    if (_pending) {
+        for (auto& w : _pending->waiters) {
+            w.set_value(make_error_code(raft::errc::shutting_down));
+        }
+    }
+}
+
+ss::future<result<raft::replicate_result>> offset_commit_batcher::replicate(
+  model::term_id term, std::vector<key_value> records) {
+    // a batch is replicated in a single term
+    if (_pending && _pending->term != term) {
+        flush();
+    }
+    if (!_pending) {
+        _pending.emplace(term);
+    }
+    for (auto& kv : records) {
+        _pending->size_bytes += kv.key.size_bytes() + kv.value.size_bytes();
+        _pending->builder.add_raw_kv(std::move(kv.key), std::move(kv.value));
+    }
+    auto f = _pending->waiters.emplace_back().get_future();
+    if (_pending->size_bytes >= max_batch_bytes || !enabled()) {
+        flush();
+    } else if (!_flush_timer.armed()) {
+        _flush_timer.arm(_window());
+    }
+    return f;
+}
+
+void offset_commit_batcher::flush() {
+    _flush_timer.cancel();
+    if (!_pending) {
+        return;
+    }
+    auto batch = std::move(*_pending);
+    _pending.reset();
+    ++_batches;
+    _commits += batch.waiters.size();
+    ssx::background = do_flush(std::move(batch));
+}
+
+ss::future<> offset_commit_batcher::do_flush(pending_batch batch) {
+    // the batcher is kept alive until the batch is replicated
+    auto self = shared_from_this();
+    auto units = co_await _enqueue_lock.get_units();
+
+    vlog(
+      klog.trace,
+      "replicating {} coalesced offset commits ({} bytes) to {}",
+      batch.waiters.size(),
+      batch.size_bytes,
+      _partition->ntp());
+    auto reader = model::make_memory_record_batch_reader(
+      std::move(batch.builder).build());
+    auto stages = _partition->raft()->replicate_in_stages(
+      batch.term,
+      std::move(reader),
+      raft::replicate_options(raft::consistency_level::quorum_ack));
+
+    // failures to enqueue are reported by the replicate_finished stage
+    co_await ss::coroutine::as_future(std::move(stages.request_enqueued));
+    units.return_all();
+
+    auto f = co_await ss::coroutine::as_future(
+      std::move(stages.replicate_finished));
+    if (f.failed()) {
+        auto e = f.get_exception();
+        for (auto& w : batch.waiters) {
+            w.set_exception(e);
+        }
+        co_return;
+    }
+    auto r = f.get();
+    for (auto& w : batch.waiters) {
+        w.set_value(r);
+    }
+}
+
+} // namespace kafka
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "cluster/fwd.h"
+#include "cluster/simple_batch_builder.h"
+#include "config/property.h"
+#include "kafka/server/group_metadata.h"
+#include "model/fundamental.h"
+#include "raft/types.h"
+#include "seastarx.h"
+#include "utils/mutex.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/timer.hh>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Coalesces the offset commits of the groups of a coordinator partition.
+ *
+ * Groups with many members committing often replicate many tiny batches to
+ * their __consumer_offsets partition. The records of the commits arriving
+ * within a short window are merged into a single batch, replicated once, and
+ * all the commits of the batch complete with its result. Batches are
+ * enqueued in raft in the order of the commits, so the commits of a group
+ * stay ordered. A window of 0 disables the coalescing.
+ */
+class offset_commit_batcher
+  : public ss::enable_lw_shared_from_this<offset_commit_batcher> {
+public:
+    using key_value = group_metadata_serializer::key_value;
+
+    offset_commit_batcher(
+      ss::lw_shared_ptr<cluster::partition>,
+      config::binding<std::chrono::milliseconds> window);
+
+    offset_commit_batcher(const offset_commit_batcher&) = delete;
+    offset_commit_batcher(offset_commit_batcher&&) = delete;
+    offset_commit_batcher& operator=(const offset_commit_batcher&) = delete;
+    offset_commit_batcher& operator=(offset_commit_batcher&&) = delete;
+    ~offset_commit_batcher();
+
+    bool enabled() const { return _window() > std::chrono::milliseconds(0); }
+
+    /**
+     * Adds the records of a commit to the batch replicated in \p term. The
+     * returned future completes once the batch is replicated.
+     */
+    ss::future<result<raft::replicate_result>>
+      replicate(model::term_id term, std::vector<key_value> records);
+
+    /// Replicates the pending batch without waiting for the window to end
+    void flush();
+
+    uint64_t batches() const { return _batches; }
+    uint64_t commits() const { return _commits; }
+
+    // batches are flushed early when growing past this size
+    static constexpr size_t max_batch_bytes = 512 * 1024;
+
+private:
+    struct pending_batch {
+        explicit pending_batch(model::term_id term)
+          : term(term)
+          , builder(model::record_batch_type::raft_data, model::offset(0)) {}
+
+        model::term_id term;
+        cluster::simple_batch_builder builder;
+        size_t size_bytes{0};
+        std::vector<ss::promise<result<raft::replicate_result>>> waiters;
+    };
+
+    ss::future<> do_flush(pending_batch);
+
+    ss::lw_shared_ptr<cluster::partition> _partition;
+    config::binding<std::chrono::milliseconds> _window;
+    std::optional<pending_batch> _pending;
+    ss::timer<> _flush_timer;
+    // batches are enqueued in raft one at a time to keep them in order
+    mutex _enqueue_lock{"k/offset-commit-batcher"};
+    uint64_t _batches{0};
+    uint64_t _commits{0};
+};
+
+} // namespace kafka
@@ -64,14 +64,15 @@ quota_manager::maybe_add_and_retrieve_quota(
     // shares a default quota. the anonymous group is keyed on empty string.
     auto qid = quota_id ? *quota_id : "";
 
-    // find or create the throughput tracker for this client
-    //
-    // c++20: heterogeneous lookup for unordered_map can avoid creation of
-    // an sstring here but std::unordered_map::find isn't using an
-    // equal_to<> overload. this is a general issue we'll be looking at. for
-    // now, these client-name strings are small. This will be solved in
-    // c++20 via Hash::transparent_key_equal.
-    auto [it, inserted] = _client_quotas.try_emplace(
+    // the lookup is heterogeneous, the key is only allocated for new clients
+    if (auto it = _client_quotas.find(qid); it != _client_quotas.end()) {
+        // bump to prevent gc
+        it->second.last_seen = now;
+        return it;
+    }
+
+    // create the throughput tracker for this client
+    auto [it, _] = _client_quotas.try_emplace(
       ss::sstring(qid),
       client_quota{
         now,
@@ -86,57 +87,34 @@ quota_manager::maybe_add_and_retrieve_quota(
              _default_window_width()})
           : std::optional<token_bucket_rate_tracker>()});
 
-    // bump to prevent gc
-    if (!inserted) {
-        it->second.last_seen = now;
-    }
-
     return it;
 }
 
+namespace {
+struct client_quota_id {
+    std::optional<std::string_view> id;
+    // the group quota of the client, if it is part of a group
+    const config::client_group_quota* group{nullptr};
+};
+
 // If client is part of some group then client quota ID is a group
 // else client quota ID is client_id
-static std::optional<std::string_view> get_client_quota_id(
+client_quota_id get_client_quota_id(
   const std::optional<std::string_view>& client_id,
   const std::unordered_map<ss::sstring, config::client_group_quota>&
     group_quota) {
     if (!client_id) {
-        return std::nullopt;
+        return {};
     }
     for (const auto& group_and_limit : group_quota) {
         if (client_id->starts_with(
               std::string_view(group_and_limit.second.clients_prefix))) {
-            return group_and_limit.first;
+            return {group_and_limit.first, &group_and_limit.second};
         }
     }
-    return client_id;
-}
-
-int64_t quota_manager::get_client_target_produce_tp_rate(
-  const std::optional<std::string_view>& quota_id) {
-    if (!quota_id) {
-        return _default_target_produce_tp_rate();
-    }
-    auto group_tp_rate = _target_produce_tp_rate_per_client_group().find(
-      ss::sstring(quota_id.value()));
-    if (group_tp_rate != _target_produce_tp_rate_per_client_group().end()) {
-        return group_tp_rate->second.quota;
-    }
-    return _default_target_produce_tp_rate();
-}
-
-std::optional<int64_t> quota_manager::get_client_target_fetch_tp_rate(
-  const std::optional<std::string_view>& quota_id) {
-    if (!quota_id) {
-        return _default_target_fetch_tp_rate();
-    }
-    auto group_tp_rate = _target_fetch_tp_rate_per_client_group().find(
-      ss::sstring(quota_id.value()));
-    if (group_tp_rate != _target_fetch_tp_rate_per_client_group().end()) {
-        return group_tp_rate->second.quota;
-    }
-    return _default_target_fetch_tp_rate();
+    return {client_id};
 }
+} // namespace
 
 ss::future<std::chrono::milliseconds> quota_manager::record_partition_mutations(
   std::optional<std::string_view> client_id,
@@ -163,7 +141,7 @@ std::chrono::milliseconds quota_manager::do_record_partition_mutations(
       "This method can only be executed from quota manager home shard");
 
     auto quota_id = get_client_quota_id(client_id, {});
-    auto it = maybe_add_and_retrieve_quota(quota_id, now);
+    auto it = maybe_add_and_retrieve_quota(quota_id.id, now);
     const auto units = it->second.pm_rate->record_and_measure(mutations, now);
     auto delay_ms = 0ms;
     if (units < 0) {
@@ -239,12 +217,14 @@ throttle_delay quota_manager::record_produce_tp_and_throttle(
   clock::time_point now) {
     auto quota_id = get_client_quota_id(
       client_id, _target_produce_tp_rate_per_client_group());
-    auto it = maybe_add_and_retrieve_quota(quota_id, now);
+    auto it = maybe_add_and_retrieve_quota(quota_id.id, now);
 
     it->second.tp_produce_rate.record(bytes, now);
-    auto target_tp_rate = get_client_target_produce_tp_rate(quota_id);
+    const int64_t target_tp_rate = quota_id.group
+                                     ? quota_id.group->quota
+                                     : _default_target_produce_tp_rate();
     auto delay_ms = throttle(
-      quota_id, target_tp_rate, now, it->second.tp_produce_rate);
+      quota_id.id, target_tp_rate, now, it->second.tp_produce_rate);
     auto prev = it->second.delay;
     it->second.delay = delay_ms;
     throttle_delay res{};
@@ -259,7 +239,7 @@ void quota_manager::record_fetch_tp(
   clock::time_point now) {
     auto quota_id = get_client_quota_id(
       client_id, _target_fetch_tp_rate_per_client_group());
-    auto it = maybe_add_and_retrieve_quota(quota_id, now);
+    auto it = maybe_add_and_retrieve_quota(quota_id.id, now);
     it->second.tp_fetch_rate.record(bytes, now);
 }
 
@@ -267,15 +247,18 @@ throttle_delay quota_manager::throttle_fetch_tp(
   std::optional<std::string_view> client_id, clock::time_point now) {
     auto quota_id = get_client_quota_id(
       client_id, _target_fetch_tp_rate_per_client_group());
-    auto target_tp_rate = get_client_target_fetch_tp_rate(quota_id);
+    std::optional<int64_t> target_tp_rate = _default_target_fetch_tp_rate();
+    if (quota_id.group) {
+        target_tp_rate = quota_id.group->quota;
+    }
 
     if (!target_tp_rate) {
         return {};
     }
-    auto it = maybe_add_and_retrieve_quota(quota_id, now);
+    auto it = maybe_add_and_retrieve_quota(quota_id.id, now);
     it->second.tp_fetch_rate.maybe_advance_current(now);
     auto delay_ms = throttle(
-      quota_id, *target_tp_rate, now, it->second.tp_fetch_rate);
+      quota_id.id, *target_tp_rate, now, it->second.tp_fetch_rate);
     throttle_delay res{};
     res.enforce = true;
     res.duration = delay_ms;
@@ -15,6 +15,7 @@
 #include "kafka/server/token_bucket_rate_tracker.h"
 #include "resource_mgmt/rate.h"
 #include "seastarx.h"
+#include "utils/absl_sstring_hash.h"
 
 #include <seastar/core/future.hh>
 #include <seastar/core/lowres_clock.hh>
@@ -130,7 +131,9 @@ private:
         rate_tracker tp_fetch_rate;
         std::optional<token_bucket_rate_tracker> pm_rate;
     };
-    using client_quotas_t = absl::flat_hash_map<ss::sstring, client_quota>;
+    // keyed by quota id, looked up without allocating the key
+    using client_quotas_t = absl::
+      flat_hash_map<ss::sstring, client_quota, sstring_hash, sstring_eq>;
 
 private:
     // erase inactive tracked quotas. windows are considered inactive if they
@@ -139,10 +142,6 @@ private:
 
     client_quotas_t::iterator maybe_add_and_retrieve_quota(
       const std::optional<std::string_view>&, const clock::time_point&);
-    int64_t get_client_target_produce_tp_rate(
-      const std::optional<std::string_view>& quota_id);
-    std::optional<int64_t> get_client_target_fetch_tp_rate(
-      const std::optional<std::string_view>& quota_id);
 
 private:
     config::binding<int16_t> _default_num_windows;
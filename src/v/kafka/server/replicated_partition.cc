@@ -12,6 +12,7 @@
 
 #include "cloud_storage/types.h"
 #include "cluster/errc.h"
+#include "config/configuration.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/server/errors.h"
 #include "kafka/server/logger.h"
@@ -26,6 +27,7 @@
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/timed_out_error.hh>
 
 #include <optional>
 
@@ -453,6 +455,26 @@ ss::future<error_code> replicated_partition::prefix_truncate(
     co_return map_topic_error_code(cluster::errc(errc.value()));
 }
 
+ss::future<> replicated_partition::wait_for_leader_high_watermark(
+  model::timeout_clock::time_point deadline) {
+    /// The follower learns of the leader's visible offset at the latest with
+    /// the next heartbeat
+    const auto timeout = std::min(
+      deadline,
+      model::timeout_clock::now()
+        + config::shard_local_cfg().raft_heartbeat_interval_ms());
+    try {
+        co_await _partition->raft()->visible_offset_monitor().wait(
+          _partition->raft()->last_leader_visible_index(),
+          timeout,
+          std::nullopt);
+    } catch (const ss::timed_out_error&) {
+        // left to the offset validation
+    } catch (const ss::abort_requested_exception&) {
+        // shutting down
+    }
+}
+
 ss::future<error_code> replicated_partition::validate_fetch_offset(
   model::offset fetch_offset,
   bool reading_from_follower,
@@ -471,6 +493,14 @@ ss::future<error_code> replicated_partition::validate_fetch_offset(
 
     // offset validation logic on follower
     if (reading_from_follower && !_partition->is_leader()) {
+        if (
+          fetch_offset > high_watermark()
+          && fetch_offset <= leader_high_watermark()) {
+            /// The offset is committed but not yet visible on this follower,
+            /// it is only behind by the append or heartbeat in flight: wait
+            /// for it rather than having the consumer back off and retry
+            co_await wait_for_leader_high_watermark(deadline);
+        }
         auto ec = error_code::none;
         if (fetch_offset < start_offset()) {
             ec = error_code::offset_out_of_range;
@@ -184,6 +184,12 @@ public:
     result<partition_info> get_partition_info() const final;
 
 private:
+    /// On a follower, waits until the follower has caught up with the high
+    /// watermark of the leader known to it, the deadline or a heartbeat
+    /// interval, whichever comes first
+    ss::future<>
+    wait_for_leader_high_watermark(model::timeout_clock::time_point deadline);
+
     // Returns the Kafka offset corresponding to the lowest offset in the
     // log, including local and cloud storage. Doesn't take into account any
     // start offset overrides (see start_offset()).
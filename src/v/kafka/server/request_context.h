@@ -117,6 +117,11 @@ public:
     protocol::decoder& reader() { return _reader; }
 
     latency_probe& probe() { return _conn->server().latency_probe(); }
+
+    /// Trace of the request, null unless it is sampled. The trace is owned by
+    /// the session resources and outlives the handler.
+    request_trace* trace() const { return _trace; }
+    void set_trace(request_trace* trace) { _trace = trace; }
     sasl_probe& sasl_probe() { return _conn->server().sasl_probe(); }
 
     // used to reach for server_probe::produce_bad_timestamp
@@ -487,6 +492,7 @@ private:
     ss::lowres_clock::duration _throttle_delay;
     bool _audit_successful{true};
     bool _request_contains_audit_topic{false};
+    request_trace* _trace{nullptr};
 };
 
 // Executes the API call identified by the specified request_context.
@@ -60,6 +60,7 @@
 #include "security/scram_algorithm.h"
 #include "security/scram_authenticator.h"
 #include "ssx/future-util.h"
+#include "ssx/sformat.h"
 #include "ssx/thread_worker.h"
 #include "utils/string_switch.h"
 #include "utils/utf8.h"
@@ -108,6 +109,7 @@ server::server(
   ss::sharded<net::server_configuration>* cfg,
   ss::smp_service_group smp,
   ss::scheduling_group fetch_sg,
+  ss::scheduling_group recompression_sg,
   ss::sharded<cluster::metadata_cache>& meta,
   ss::sharded<cluster::topics_frontend>& tf,
   ss::sharded<cluster::config_frontend>& cf,
@@ -157,6 +159,11 @@ server::server(
   , _security_frontend(sec_fe)
   , _controller_api(controller_api)
   , _tx_gateway_frontend(tx_gateway_frontend)
+  , _fetch_response_cache(
+      config::shard_local_cfg().fetch_response_cache_max_bytes.bind())
+  , _metadata_response_cache(
+      _metadata_cache.local(),
+      config::shard_local_cfg().kafka_metadata_response_cache.bind())
   , _mtls_principal_mapper(
       config::shard_local_cfg().kafka_mtls_principal_mapping_rules.bind())
   , _gssapi_principal_mapper(
@@ -167,12 +174,45 @@ server::server(
         cfg->local().max_service_memory_per_core
         * config::shard_local_cfg().kafka_memory_share_for_fetch()),
       "kafka/server-mem-fetch")
+  , _fetch_memory_share(
+      _memory_fetch_sem.available_units(),
+      config::shard_local_cfg().kafka_fetch_memory_fair_share.bind())
+  , _fetch_memory_accounting(
+      resources::memory_accounting::local().register_reporter(
+        resources::memory_subsystem::kafka_fetch,
+        [this]() -> size_t {
+            const auto available = _memory_fetch_sem.current();
+            const auto capacity = _fetch_memory_share.capacity();
+            return capacity > available ? capacity - available : 0;
+        }))
+  , _batch_recompressor(
+      recompression_sg,
+      config::shard_local_cfg().kafka_produce_recompression_memory())
   , _probe(std::make_unique<class latency_probe>())
   , _sasl_probe(std::make_unique<class sasl_probe>())
   , _thread_worker(tw)
   , _replica_selector(
       std::make_unique<rack_aware_replica_selector>(_metadata_cache.local()))
-  , _schema_registry(sr) {
+  , _schema_registry(sr)
+  , _memory_wait_stats{
+      .connection = resources::semaphore_metrics::local().stats(
+        "kafka/conn-mem"),
+      .principal = resources::semaphore_metrics::local().stats(
+        "kafka/principal-mem"),
+      .server = resources::semaphore_metrics::local().stats(
+        "net/server-mem"),
+    }
+  , _conn_balancing_enabled(
+      config::shard_local_cfg().kafka_connection_balancing_enabled.bind())
+  , _conn_balancing_interval(
+      config::shard_local_cfg().kafka_connection_balancing_interval_ms.bind())
+  , _conn_balancing_threshold(
+      config::shard_local_cfg()
+        .kafka_connection_balancing_imbalance_threshold.bind())
+  , _conn_balancing_min_idle(
+      config::shard_local_cfg().kafka_connection_balancing_min_idle_ms.bind())
+  , _request_trace_sample_interval(
+      config::shard_local_cfg().kafka_request_trace_sample_interval.bind()) {
     vlog(
       klog.debug,
       "Starting kafka server with {} byte limit on fetch requests",
@@ -185,6 +225,128 @@ server::server(
     _probe->setup_public_metrics();
 
     _sasl_probe->setup_metrics(cfg->local().name);
+
+    if (ss::this_shard_id() == 0) {
+        _conn_balancing_timer.set_callback([this] { balance_connections(); });
+        _conn_balancing_timer.arm(_conn_balancing_interval());
+    }
+}
+
+ss::lw_shared_ptr<principal_memory_budget> server::principal_memory(
+  const security::acl_principal& principal, size_t budget) {
+    auto [it, _] = _principal_memory.try_emplace(principal, nullptr);
+    if (!it->second) {
+        it->second = ss::make_lw_shared<principal_memory_budget>(budget);
+    }
+    return it->second;
+}
+
+void server::release_principal_memory(
+  const security::acl_principal& principal) {
+    auto it = _principal_memory.find(principal);
+    if (it != _principal_memory.end() && it->second.use_count() == 1) {
+        _principal_memory.erase(it);
+    }
+}
+
+std::unique_ptr<request_trace> server::start_request_trace(api_key key) {
+    _requests_since_trace = 0;
+    auto handler = handler_for_key(key);
+    return std::make_unique<request_trace>(
+      handler ? ss::sstring((*handler)->name()) : ssx::sformat("{}", key));
+}
+
+void server::finish_request_trace(std::unique_ptr<request_trace> trace) {
+    trace->finish();
+    vlog(
+      klog.trace,
+      "traced {} request: {} spans in {}us",
+      trace->name(),
+      trace->spans().size(),
+      std::chrono::duration_cast<std::chrono::microseconds>(trace->duration())
+        .count());
+    if (_recent_request_traces.size() == max_recent_request_traces) {
+        _recent_request_traces.pop_front();
+    }
+    _recent_request_traces.push_back(std::move(trace));
+}
+
+void server::balance_connections() {
+    ssx::spawn_with_gate(conn_gate(), [this] {
+        return do_balance_connections()
+          .handle_exception([](const std::exception_ptr& e) {
+              vlog(klog.debug, "connection balancing failed: {}", e);
+          })
+          .finally([this] {
+              if (!conn_gate().is_closed()) {
+                  _conn_balancing_timer.arm(_conn_balancing_interval());
+              }
+          });
+    });
+}
+
+ss::future<> server::do_balance_connections() {
+    if (!_conn_balancing_enabled() || ss::smp::count < 2) {
+        _conn_balancing_last_bytes.clear();
+        co_return;
+    }
+
+    struct shard_load {
+        uint64_t bytes;
+        size_t connections;
+    };
+    auto loads = co_await container().map([](server& s) {
+        return shard_load{
+          .bytes = s.probe().in_bytes() + s.probe().out_bytes(),
+          .connections = s.connection_count(),
+        };
+    });
+
+    std::vector<uint64_t> bytes;
+    bytes.reserve(loads.size());
+    for (const auto& l : loads) {
+        bytes.push_back(l.bytes);
+    }
+    auto last_bytes = std::exchange(_conn_balancing_last_bytes, bytes);
+    if (last_bytes.size() != bytes.size()) {
+        co_return;
+    }
+
+    // the traffic of the last interval is compared, the connections are
+    // placed by count so a shard is only shed when the reconnection is placed
+    // on another one
+    std::vector<uint64_t> delta;
+    delta.reserve(bytes.size());
+    uint64_t total = 0;
+    size_t min_connections = std::numeric_limits<size_t>::max();
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        delta.push_back(
+          bytes[i] >= last_bytes[i] ? bytes[i] - last_bytes[i] : 0);
+        total += delta.back();
+        min_connections = std::min(min_connections, loads[i].connections);
+    }
+    const double mean = static_cast<double>(total)
+                        / static_cast<double>(delta.size());
+    const double limit = mean * (1 + _conn_balancing_threshold());
+
+    for (ss::shard_id shard = 0; shard < delta.size(); ++shard) {
+        if (
+          total == 0 || static_cast<double>(delta[shard]) <= limit
+          || loads[shard].connections <= min_connections + 1) {
+            continue;
+        }
+        auto shed = co_await container().invoke_on(
+          shard, [min_idle = _conn_balancing_min_idle()](server& s) {
+              return s.shed_connection(min_idle);
+          });
+        if (shed) {
+            vlog(
+              klog.info,
+              "closed connection from {} to balance the traffic of core {}",
+              *shed,
+              shard);
+        }
+    }
 }
 
 void server::setup_metrics() {
@@ -201,6 +363,90 @@ void server::setup_metrics() {
           [this] { return _memory_fetch_sem.current(); },
           sm::description(ssx::sformat(
             "{}: Memory available for fetch request processing", cfg.name))),
+        sm::make_gauge(
+          "fetch_memory_share_readers",
+          [this] { return _fetch_memory_share.readers(); },
+          sm::description(ssx::sformat(
+            "{}: Fetches sharing the fetch memory of the shard", cfg.name))),
+        sm::make_counter(
+          "fetch_memory_share_limited",
+          [this] { return _fetch_memory_share.limited(); },
+          sm::description(ssx::sformat(
+            "{}: Fetches limited to their share of the fetch memory",
+            cfg.name))),
+        sm::make_counter(
+          "fetch_response_cache_hits",
+          [this] { return _fetch_response_cache.hits(); },
+          sm::description(ssx::sformat(
+            "{}: Partition fetch reads served from the fetch response cache",
+            cfg.name))),
+        sm::make_counter(
+          "fetch_response_cache_misses",
+          [this] { return _fetch_response_cache.misses(); },
+          sm::description(ssx::sformat(
+            "{}: Partition fetch reads not found in the fetch response cache",
+            cfg.name))),
+        sm::make_gauge(
+          "fetch_response_cache_bytes",
+          [this] { return _fetch_response_cache.size_bytes(); },
+          sm::description(ssx::sformat(
+            "{}: Memory used by the fetch response cache", cfg.name))),
+        sm::make_counter(
+          "metadata_response_cache_hits",
+          [this] { return _metadata_response_cache.hits(); },
+          sm::description(ssx::sformat(
+            "{}: Topic metadata served from the metadata response cache",
+            cfg.name))),
+        sm::make_counter(
+          "metadata_response_cache_misses",
+          [this] { return _metadata_response_cache.misses(); },
+          sm::description(ssx::sformat(
+            "{}: Topic metadata not found in the metadata response cache",
+            cfg.name))),
+        sm::make_counter(
+          "recompressed_batches",
+          [this] { return _batch_recompressor.batches(); },
+          sm::description(ssx::sformat(
+            "{}: Produced batches transcoded to the compression of their "
+            "topic",
+            cfg.name))),
+        sm::make_counter(
+          "recompressed_bytes_in",
+          [this] { return _batch_recompressor.bytes_in(); },
+          sm::description(ssx::sformat(
+            "{}: Bytes of the produced batches before their transcoding",
+            cfg.name))),
+        sm::make_counter(
+          "recompressed_bytes_out",
+          [this] { return _batch_recompressor.bytes_out(); },
+          sm::description(ssx::sformat(
+            "{}: Bytes of the produced batches after their transcoding",
+            cfg.name))),
+        sm::make_counter(
+          "connections_blocked_memory",
+          [this] { return _connections_blocked_memory; },
+          sm::description(ssx::sformat(
+            "{}: Requests that waited for the memory budget of their "
+            "connection",
+            cfg.name))),
+        sm::make_counter(
+          "principals_blocked_memory",
+          [this] { return _principals_blocked_memory; },
+          sm::description(ssx::sformat(
+            "{}: Requests that waited for the memory budget of their principal",
+            cfg.name))),
+        sm::make_total_bytes(
+          "connection_max_memory_held",
+          [this] {
+              size_t held = 0;
+              for (const auto& c : _connections) {
+                  held = std::max(held, c.memory_held());
+              }
+              return held;
+          },
+          sm::description(ssx::sformat(
+            "{}: Most memory held by the requests of a single connection",
+            cfg.name))),
       });
 }
 
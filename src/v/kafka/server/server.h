@@ -17,8 +17,12 @@
 #include "kafka/latency_probe.h"
 #include "kafka/protocol/types.h"
 #include "kafka/sasl_probe.h"
+#include "kafka/server/batch_recompressor.h"
 #include "kafka/server/connection_context.h"
 #include "kafka/server/fetch_metadata_cache.hh"
+#include "kafka/server/fetch_memory_share.h"
+#include "kafka/server/fetch_response_cache.h"
+#include "kafka/server/metadata_response_cache.h"
 #include "kafka/server/fetch_session_cache.h"
 #include "kafka/server/fwd.h"
 #include "kafka/server/handlers/fetch/replica_selector.h"
@@ -27,6 +31,8 @@
 #include "metrics/metrics.h"
 #include "net/server.h"
 #include "pandaproxy/schema_registry/fwd.h"
+#include "resource_mgmt/memory_accounting.h"
+#include "resource_mgmt/semaphore_metrics.h"
 #include "security/audit/audit_log_manager.h"
 #include "security/fwd.h"
 #include "security/gssapi_principal_mapper.h"
@@ -34,11 +40,16 @@
 #include "security/mtls.h"
 #include "ssx/fwd.h"
 #include "utils/ema.h"
+#include "utils/request_trace.h"
 
+#include <seastar/core/circular_buffer.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/core/timer.hh>
+
+#include <absl/container/flat_hash_map.h>
 
 namespace kafka {
 
@@ -49,7 +60,8 @@ public:
     server(
       ss::sharded<net::server_configuration>*,
       ss::smp_service_group,
-      ss::scheduling_group,
+      ss::scheduling_group fetch_sg,
+      ss::scheduling_group recompression_sg,
       ss::sharded<cluster::metadata_cache>&,
       ss::sharded<cluster::topics_frontend>&,
       ss::sharded<cluster::config_frontend>&,
@@ -166,6 +178,18 @@ public:
         return _fetch_metadata_cache;
     }
 
+    kafka::fetch_response_cache& get_fetch_response_cache() {
+        return _fetch_response_cache;
+    }
+
+    kafka::metadata_response_cache& get_metadata_response_cache() {
+        return _metadata_response_cache;
+    }
+
+    batch_recompressor& get_batch_recompressor() {
+        return _batch_recompressor;
+    }
+
     security::gssapi_principal_mapper& gssapi_principal_mapper() {
         return _gssapi_principal_mapper;
     }
@@ -198,11 +222,58 @@ public:
     }
 
     ssx::semaphore& memory_fetch_sem() noexcept { return _memory_fetch_sem; }
+    fetch_memory_share& get_fetch_memory_share() noexcept {
+        return _fetch_memory_share;
+    }
 
     ss::future<> revoke_credentials(std::string_view name);
 
+    /**
+     * Memory budget shared by the connections of the principal on this
+     * shard, created by the first of them with the given budget.
+     */
+    ss::lw_shared_ptr<principal_memory_budget>
+    principal_memory(const security::acl_principal&, size_t budget);
+    /// Drops the budget of the principal once no connection refers to it
+    void release_principal_memory(const security::acl_principal&);
+
+    void connection_waiting_for_memory() { ++_connections_blocked_memory; }
+    void principal_waiting_for_memory() { ++_principals_blocked_memory; }
+
+    /// waits of the requests for memory, null unless
+    /// semaphore_wait_metrics_enabled
+    struct memory_wait_stats {
+        ss::lw_shared_ptr<semaphore_wait_stats> connection;
+        ss::lw_shared_ptr<semaphore_wait_stats> principal;
+        ss::lw_shared_ptr<semaphore_wait_stats> server;
+    };
+    const memory_wait_stats& get_memory_wait_stats() const {
+        return _memory_wait_stats;
+    }
+
+    /// A trace for the request if it is sampled, see
+    /// kafka_request_trace_sample_interval
+    std::unique_ptr<request_trace> maybe_trace_request(api_key key) {
+        const auto interval = _request_trace_sample_interval();
+        if (interval == 0 || ++_requests_since_trace < interval) [[likely]] {
+            return nullptr;
+        }
+        return start_request_trace(key);
+    }
+    /// Keeps the finished trace among the most recent ones of the shard
+    void finish_request_trace(std::unique_ptr<request_trace>);
+    const ss::circular_buffer<std::unique_ptr<request_trace>>&
+    recent_request_traces() const {
+        return _recent_request_traces;
+    }
+
 private:
     void setup_metrics();
+    std::unique_ptr<request_trace> start_request_trace(api_key);
+
+    /// Connection balancing, runs on shard 0 only
+    void balance_connections();
+    ss::future<> do_balance_connections();
 
     ss::smp_service_group _smp_group;
     ss::scheduling_group _fetch_scheduling_group;
@@ -230,10 +301,15 @@ private:
     ss::sharded<cluster::tx_gateway_frontend>& _tx_gateway_frontend;
     std::optional<qdc_monitor> _qdc_mon;
     kafka::fetch_metadata_cache _fetch_metadata_cache;
+    kafka::fetch_response_cache _fetch_response_cache;
+    kafka::metadata_response_cache _metadata_response_cache;
     security::tls::principal_mapper _mtls_principal_mapper;
     security::gssapi_principal_mapper _gssapi_principal_mapper;
     security::krb5::configurator _krb_configurator;
     ssx::semaphore _memory_fetch_sem;
+    fetch_memory_share _fetch_memory_share;
+    resources::memory_accounting::deregister_holder _fetch_memory_accounting;
+    batch_recompressor _batch_recompressor;
 
     handler_probe_manager _handler_probes;
     metrics::internal_metric_groups _metrics;
@@ -243,6 +319,26 @@ private:
     std::unique_ptr<replica_selector> _replica_selector;
     const std::unique_ptr<pandaproxy::schema_registry::api>& _schema_registry;
     boost::intrusive::list<connection_context> _connections;
+    absl::flat_hash_map<
+      security::acl_principal,
+      ss::lw_shared_ptr<principal_memory_budget>>
+      _principal_memory;
+    uint64_t _connections_blocked_memory{0};
+    uint64_t _principals_blocked_memory{0};
+    memory_wait_stats _memory_wait_stats;
+
+    config::binding<bool> _conn_balancing_enabled;
+    config::binding<std::chrono::milliseconds> _conn_balancing_interval;
+    config::binding<double> _conn_balancing_threshold;
+    config::binding<std::chrono::milliseconds> _conn_balancing_min_idle;
+    // bytes received and sent by every shard at the last balancing tick
+    std::vector<uint64_t> _conn_balancing_last_bytes;
+    ss::timer<> _conn_balancing_timer;
+
+    static constexpr size_t max_recent_request_traces = 64;
+    config::binding<uint32_t> _request_trace_sample_interval;
+    uint32_t _requests_since_trace{0};
+    ss::circular_buffer<std::unique_ptr<request_trace>> _recent_request_traces;
 };
 
 } // namespace kafka
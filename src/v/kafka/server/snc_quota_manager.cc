@@ -92,6 +92,27 @@ void snc_quotas_probe::setup_metrics() {
         metric_defs.emplace_back(sm::make_counter(
           name, [this] { return _qm.get_quota().eg; }, desc, {label_egress}));
     }
+    {
+        static const char* name = "usage_forecast";
+        static const auto desc = sm::description(
+          "Forecast of the shard throughput used by the quota balancer, in "
+          "bytes/s");
+        metric_defs.emplace_back(sm::make_gauge(
+          name,
+          [this] { return _qm.get_usage_forecast().in; },
+          desc,
+          {label_ingress}));
+        metric_defs.emplace_back(sm::make_gauge(
+          name,
+          [this] { return _qm.get_usage_forecast().eg; },
+          desc,
+          {label_egress}));
+    }
+    metric_defs.emplace_back(sm::make_histogram(
+      "throttle_delay_us",
+      sm::description("Throttling delays requested from the clients by the "
+                      "shard throughput quotas, in microseconds"),
+      [this] { return _throttle_delay.internal_histogram_logform(); }));
     metric_defs.emplace_back(sm::make_counter(
       "traffic_intake",
       _traffic_in,
@@ -144,6 +165,8 @@ snc_quota_manager::snc_quota_manager()
   , _kafka_quota_balancer_min_shard_throughput_bps(
       config::shard_local_cfg()
         .kafka_quota_balancer_min_shard_throughput_bps.bind())
+  , _kafka_quota_balancer_usage_forecast(
+      config::shard_local_cfg().kafka_quota_balancer_usage_forecast.bind())
   , _kafka_throughput_control(config::shard_local_cfg().kafka_throughput_control.bind())
   , _node_quota_default{calc_node_quota_default()}
   , _shard_quota{
@@ -182,6 +205,12 @@ snc_quota_manager::snc_quota_manager()
       [this] { update_shard_quota_minimum(); });
     _kafka_quota_balancer_min_shard_throughput_bps.watch(
       [this] { update_shard_quota_minimum(); });
+    _kafka_quota_balancer_usage_forecast.watch([this] {
+        // start over so that a stale forecast does not affect the balancer
+        _usage_forecast = {0, 0};
+        _usage_since_forecast = {0, 0};
+        _usage_forecast_last_updated = clock::now();
+    });
 
     if (ss::this_shard_id() == quota_balancer_shard) {
         _balancer_timer.set_callback([this] {
@@ -293,7 +322,7 @@ void snc_quota_manager::get_or_create_quota_context(
 }
 
 snc_quota_manager::delays_t snc_quota_manager::get_shard_delays(
-  snc_quota_context& ctx, const clock::time_point now) const {
+  snc_quota_context& ctx, const clock::time_point now) {
     delays_t res;
 
     // force throttle whatever the client did not do on its side
@@ -307,6 +336,10 @@ snc_quota_manager::delays_t snc_quota_manager::get_shard_delays(
       _max_kafka_throttle_delay(),
       std::max(eval_delay(_shard_quota.in), eval_delay(_shard_quota.eg)));
     ctx._throttled_until = now + res.request;
+    if (res.request > clock::duration::zero()) {
+        _probe.rec_throttle_delay(
+          std::chrono::duration_cast<std::chrono::microseconds>(res.request));
+    }
 
     return res;
 }
@@ -319,6 +352,7 @@ void snc_quota_manager::record_request_receive(
         return;
     }
     _shard_quota.in.use(request_size, now);
+    _usage_since_forecast.in += request_size;
 }
 
 void snc_quota_manager::record_request_intake(
@@ -337,6 +371,7 @@ void snc_quota_manager::record_response(
         return;
     }
     _shard_quota.eg.use(request_size, now);
+    _usage_since_forecast.eg += request_size;
 }
 
 ss::lowres_clock::duration
@@ -423,6 +458,9 @@ struct borrower_t {
     ss::shard_id shard_id;
     // how many borrowers the shard counts towards as, can be 0 or 1
     ingress_egress_state<shard_count_t> borrowers_count;
+    // how much of the collected quota the shard should get relative to the
+    // other borrowers
+    ingress_egress_state<quota_t> weight;
 };
 
 ss::future<> snc_quota_manager::quota_balancer_step() {
@@ -434,12 +472,15 @@ ss::future<> snc_quota_manager::quota_balancer_step() {
     // determine the borrowers and whether any balancing is needed now
     const auto borrowers = co_await container().map(
       [](snc_quota_manager& qm) -> borrower_t {
-          qm.refill_buckets(clock::now());
+          const auto now = clock::now();
+          qm.refill_buckets(now);
+          qm.update_usage_forecast(now);
           const ingress_egress_state<quota_t> def = qm.get_deficiency();
           return {
             .shard_id = ss::this_shard_id(),
             .borrowers_count{
-              .in = def.in > 0 ? 1u : 0u, .eg = def.eg > 0 ? 1u : 0u}};
+              .in = def.in > 0 ? 1u : 0u, .eg = def.eg > 0 ? 1u : 0u},
+            .weight = def};
       });
 
     const auto borrowers_count = std::accumulate(
@@ -477,41 +518,33 @@ ss::future<> snc_quota_manager::quota_balancer_step() {
         std::plus{});
     vlog(klog.trace, "qb - Collected: {}", collected);
 
-    // dispense the collected amount among the borrowers
-    using split_t = decltype(std::div(quota_t{}, shard_count_t{}));
-    ingress_egress_state<split_t> split{{0, 0}, {0, 0}};
-    if (borrowers_count.in > 0) {
-        split.in = std::div(collected.in, borrowers_count.in);
-    }
-    if (borrowers_count.eg > 0) {
-        split.eg = std::div(collected.eg, borrowers_count.eg);
+    // dispense the collected amount among the borrowers, pro rata to their
+    // deficiency. Unless the forecast is enabled all the borrowers have
+    // the same deficiency, so they get equal shares
+    ingress_egress_state<std::vector<quota_t>> weights;
+    weights.in.reserve(borrowers.size());
+    weights.eg.reserve(borrowers.size());
+    for (const borrower_t& b : borrowers) {
+        weights.in.push_back(b.weight.in);
+        weights.eg.push_back(b.weight.eg);
     }
+    ingress_egress_state<std::vector<quota_t>> shares{
+      std::vector<quota_t>(borrowers.size()),
+      std::vector<quota_t>(borrowers.size())};
+    detail::dispense_pro_rata(shares.in, collected.in, weights.in);
+    detail::dispense_pro_rata(shares.eg, collected.eg, weights.eg);
+    vlog(klog.trace, "qb - Dispense collected as {}", shares);
 
-    const auto equal_share_or_0 =
-      [](split_t& split, const shard_count_t borrowers_count) -> quota_t {
-        if (borrowers_count == 0) {
-            return 0;
-        }
-        if (split.rem == 0) {
-            return split.quot;
-        }
-        --split.rem;
-        return split.quot + 1;
-    };
-    for (const borrower_t& b : borrowers) {
+    for (size_t k = 0; k != borrowers.size(); ++k) {
         const ingress_egress_state<quota_t> share{
-          .in = equal_share_or_0(split.in, b.borrowers_count.in),
-          .eg = equal_share_or_0(split.eg, b.borrowers_count.eg)};
+          .in = shares.in[k], .eg = shares.eg[k]};
         if (!is_zero(share)) {
             // TBD: make the invocation parallel
             co_await container().invoke_on(
-              b.shard_id,
+              borrowers[k].shard_id,
               [share](snc_quota_manager& qm) { qm.adjust_quota(share); });
         }
     }
-    if (split.in.rem != 0 || split.eg.rem != 0) {
-        vlog(klog.error, "qb - Split not dispensed in full: {}", split);
-    }
 }
 
 namespace detail {
@@ -536,6 +569,48 @@ void dispense_equally(std::vector<quota_t>& target, const quota_t value) {
     }
 }
 
+/// Split non-negative \p value between the elements of vector \p target in
+/// full pro rata to the non-negative \p weights, adding the shares to the
+/// elements already in the vector. Elements with zero weight get nothing.
+/// The remainder of the integer division is dispensed one by one to the front
+/// elements with non-zero weights, so equal weights make equal shares just
+/// like \ref dispense_equally does.
+/// \pre target.size() == weights.size()
+void dispense_pro_rata(
+  std::vector<quota_t>& target,
+  quota_t value,
+  const std::vector<quota_t>& weights) {
+    if (unlikely(target.size() != weights.size())) {
+        vlog(
+          klog.error,
+          "Target and weights sizes must be equal. target: {}, weights: {}",
+          target,
+          weights);
+        return;
+    }
+    const auto total_weight = std::reduce(
+      weights.cbegin(), weights.cend(), quota_t{0}, std::plus{});
+    if (value <= 0 || total_weight <= 0) {
+        return;
+    }
+    const double value_d = value;
+    for (size_t k = 0; k != target.size(); ++k) {
+        // the product of value and weight may not fit into an integer
+        const auto share = std::min<quota_t>(
+          value,
+          static_cast<quota_t>(value_d * weights[k] / total_weight));
+        target[k] += share;
+        value -= share;
+    }
+    // what is left due to rounding goes to the front borrowers
+    for (size_t k = 0; value > 0; k = (k + 1) % target.size()) {
+        if (weights[k] > 0) {
+            target[k] += 1;
+            value -= 1;
+        }
+    }
+}
+
 /// If \p value is less than \p limit, set it to the \p limit value and
 /// return the difference as positive number. Otherwise \p value is unchanged
 /// and 0 is returned
@@ -770,19 +845,53 @@ void snc_quota_manager::refill_buckets(const clock::time_point now) noexcept {
     _shard_quota.eg.refill(now);
 }
 
+void snc_quota_manager::update_usage_forecast(
+  const clock::time_point now) noexcept {
+    // weight of the previous forecast in the new one
+    static constexpr double smoothing = 0.5;
+    const auto elapsed = now - _usage_forecast_last_updated;
+    if (!_kafka_quota_balancer_usage_forecast() || elapsed <= 0ms) {
+        return;
+    }
+    const auto f = [elapsed](quota_t& forecast, quota_t& used) {
+        const double rate = used
+                            / std::chrono::duration<double>(elapsed).count();
+        forecast = std::llround(
+          smoothing * static_cast<double>(forecast)
+          + (1. - smoothing) * rate);
+        used = 0;
+    };
+    f(_usage_forecast.in, _usage_since_forecast.in);
+    f(_usage_forecast.eg, _usage_since_forecast.eg);
+    _usage_forecast_last_updated = now;
+}
+
 ingress_egress_state<quota_t>
 snc_quota_manager::get_deficiency() const noexcept {
-    const auto f = [](
+    const auto f = [this](
                      const bottomless_token_bucket& b,
-                     const quota_t shard_quota_min) -> quota_t {
-        if (b.tokens() < 0 || b.quota() < shard_quota_min) {
-            return 1;
+                     const quota_t shard_quota_min,
+                     const quota_t forecast) -> quota_t {
+        if (!_kafka_quota_balancer_usage_forecast()) {
+            if (b.tokens() < 0 || b.quota() < shard_quota_min) {
+                return 1;
+            }
+            return 0;
+        }
+        // tokens below the bottom of the bucket, as a rate, plus the part
+        // of the forecast the quota does not cover
+        const quota_t lacking
+          = std::max(-b.get_current_rate(), quota_t{0})
+            + std::max(forecast - b.quota(), quota_t{0})
+            + std::max(shard_quota_min - b.quota(), quota_t{0});
+        if (lacking > 0 || b.tokens() < 0) {
+            return std::max(lacking, quota_t{1});
         }
         return 0;
     };
     return {
-      .in = f(_shard_quota.in, _shard_quota_minimum.in),
-      .eg = f(_shard_quota.eg, _shard_quota_minimum.eg)};
+      .in = f(_shard_quota.in, _shard_quota_minimum.in, _usage_forecast.in),
+      .eg = f(_shard_quota.eg, _shard_quota_minimum.eg, _usage_forecast.eg)};
 }
 
 ingress_egress_state<quota_t> snc_quota_manager::get_quota() const noexcept {
@@ -790,13 +899,19 @@ ingress_egress_state<quota_t> snc_quota_manager::get_quota() const noexcept {
 }
 
 ingress_egress_state<quota_t> snc_quota_manager::get_surplus() const noexcept {
+    const auto f = [this](
+                     const bottomless_token_bucket& b,
+                     const quota_t shard_quota_min,
+                     const quota_t forecast) -> quota_t {
+        quota_t available = b.get_current_rate();
+        if (_kafka_quota_balancer_usage_forecast()) {
+            available = std::min(available, b.quota() - forecast);
+        }
+        return std::max(available - shard_quota_min, quota_t{0});
+    };
     return {
-      .in = std::max(
-        _shard_quota.in.get_current_rate() - _shard_quota_minimum.in,
-        quota_t{0}),
-      .eg = std::max(
-        _shard_quota.eg.get_current_rate() - _shard_quota_minimum.eg,
-        quota_t{0})};
+      .in = f(_shard_quota.in, _shard_quota_minimum.in, _usage_forecast.in),
+      .eg = f(_shard_quota.eg, _shard_quota_minimum.eg, _usage_forecast.eg)};
 }
 
 void snc_quota_manager::maybe_set_quota(
@@ -858,14 +973,10 @@ struct fmt::formatter<kafka::borrower_t> : parseless_formatter {
     template<typename Ctx>
     auto format(const kafka::borrower_t& v, Ctx& ctx) const {
         return fmt::format_to(
-          ctx.out(), "{{{}, {}}}", v.shard_id, v.borrowers_count);
-    }
-};
-
-template<>
-struct fmt::formatter<std::ldiv_t> : parseless_formatter {
-    template<typename Ctx>
-    auto format(const std::ldiv_t& v, Ctx& ctx) const {
-        return fmt::format_to(ctx.out(), "(q:{}, r:{})", v.quot, v.rem);
+          ctx.out(),
+          "{{{}, {}, {}}}",
+          v.shard_id,
+          v.borrowers_count,
+          v.weight);
     }
 };
@@ -15,6 +15,7 @@
 #include "metrics/metrics.h"
 #include "seastarx.h"
 #include "utils/bottomless_token_bucket.h"
+#include "utils/log_hist.h"
 #include "utils/mutex.h"
 
 #include <seastar/core/future.hh>
@@ -49,6 +50,9 @@ public:
 
     void rec_balancer_step() noexcept { ++_balancer_runs; }
     void rec_traffic_in(const size_t bytes) noexcept { _traffic_in += bytes; }
+    void rec_throttle_delay(const std::chrono::microseconds d) noexcept {
+        _throttle_delay.record(d.count());
+    }
 
     void setup_metrics();
 
@@ -59,6 +63,7 @@ private:
     metrics::internal_metric_groups _metrics;
     uint64_t _balancer_runs = 0;
     size_t _traffic_in = 0;
+    log_hist_internal _throttle_delay;
 };
 
 class snc_quota_context {
@@ -121,7 +126,7 @@ public:
       std::optional<std::string_view> client_id);
 
     /// Determine throttling required by shard level TP quotas.
-    delays_t get_shard_delays(snc_quota_context&, clock::time_point now) const;
+    delays_t get_shard_delays(snc_quota_context&, clock::time_point now);
 
     /// Record the request size when it has arrived from the transport.
     /// This should be done before calling \ref get_shard_delays because the
@@ -150,6 +155,12 @@ public:
     /// Return current effective quota values
     ingress_egress_state<quota_t> get_quota() const noexcept;
 
+    /// Return the forecast of the shard throughput, in bytes/s. It is 0 unless
+    /// the balancer forecast is enabled
+    ingress_egress_state<quota_t> get_usage_forecast() const noexcept {
+        return _usage_forecast;
+    }
+
 private:
     // Returns value based on upstream values, not the _node_quota_default
     ingress_egress_state<std::optional<quota_t>>
@@ -182,13 +193,20 @@ private:
     /// get_deficiency() and get_surplus() will return actual data
     void refill_buckets(const clock::time_point now) noexcept;
 
+    /// Fold the throughput used since the last call into the exponential
+    /// moving average that forecasts the shard throughput
+    void update_usage_forecast(const clock::time_point now) noexcept;
+
     /// If the current quota is sufficient for the shard, returns 0,
-    /// otherwise returns a positive value
+    /// otherwise returns a positive value. With the forecast enabled the value
+    /// is how much quota the shard lacks, so that the shards with the largest
+    /// bursts get the largest part of the collected quota.
     ingress_egress_state<quota_t> get_deficiency() const noexcept;
 
     /// If the current quota is more than sufficient for the shard,
     /// returns how much it is more than sufficient as a positive value,
-    /// otherwise returns 0.
+    /// otherwise returns 0. With the forecast enabled the quota the shard is
+    /// expected to use is not considered surplus.
     ingress_egress_state<quota_t> get_surplus() const noexcept;
 
     /// If the argument has a value, set the current shard quota to the value
@@ -208,6 +226,7 @@ private:
       _kafka_quota_balancer_node_period;
     config::binding<double> _kafka_quota_balancer_min_shard_throughput_ratio;
     config::binding<quota_t> _kafka_quota_balancer_min_shard_throughput_bps;
+    config::binding<bool> _kafka_quota_balancer_usage_forecast;
     config::binding<std::vector<config::throughput_control_group>>
       _kafka_throughput_control;
 
@@ -222,6 +241,9 @@ private:
     ingress_egress_state<std::optional<quota_t>> _node_quota_default;
     ingress_egress_state<quota_t> _shard_quota_minimum;
     ingress_egress_state<bottomless_token_bucket> _shard_quota;
+    ingress_egress_state<quota_t> _usage_forecast{0, 0};
+    ingress_egress_state<quota_t> _usage_since_forecast{0, 0};
+    clock::time_point _usage_forecast_last_updated{clock::now()};
 
     // service
     snc_quotas_probe _probe;
@@ -238,6 +260,10 @@ void dispense_negative_deltas(
 void dispense_equally(
   std::vector<snc_quota_manager::quota_t>& target,
   snc_quota_manager::quota_t value);
+void dispense_pro_rata(
+  std::vector<snc_quota_manager::quota_t>& target,
+  snc_quota_manager::quota_t value,
+  const std::vector<snc_quota_manager::quota_t>& weights);
 } // namespace detail
 
 } // namespace kafka
@@ -0,0 +1,77 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/batch_recompressor.h"
+#include "model/record_utils.h"
+#include "model/tests/random_batch.h"
+#include "storage/parser_utils.h"
+#include "units.h"
+
+#include <seastar/core/scheduling.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <vector>
+
+namespace {
+model::record_batch make_batch(model::compression c) {
+    auto b = model::test::make_random_batch(model::offset(0), 100, false);
+    if (c == model::compression::none) {
+        return b;
+    }
+    return storage::internal::compress_batch(c, std::move(b)).get0();
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(target_compression_test) {
+    using kafka::batch_recompressor;
+    const auto zstd = make_batch(model::compression::zstd);
+    BOOST_REQUIRE(!batch_recompressor::target_compression(
+      model::compression::producer, zstd.header()));
+    BOOST_REQUIRE(!batch_recompressor::target_compression(
+      model::compression::zstd, zstd.header()));
+    BOOST_REQUIRE(
+      batch_recompressor::target_compression(
+        model::compression::lz4, zstd.header())
+      == model::compression::lz4);
+    BOOST_REQUIRE(
+      batch_recompressor::target_compression(
+        model::compression::none, zstd.header())
+      == model::compression::none);
+}
+
+SEASTAR_THREAD_TEST_CASE(recompress_test) {
+    kafka::batch_recompressor recompressor(
+      ss::default_scheduling_group(), 1_MiB);
+    const std::vector<model::compression> types{
+      model::compression::none,
+      model::compression::gzip,
+      model::compression::snappy,
+      model::compression::lz4,
+      model::compression::zstd};
+    for (auto from : types) {
+        for (auto to : types) {
+            auto batch = make_batch(from);
+            const auto records = storage::internal::decompress_batch(
+                                   batch.copy())
+                                   .get0()
+                                   .copy_records();
+            auto out = recompressor.recompress(std::move(batch), to).get0();
+            BOOST_REQUIRE_EQUAL(out.header().attrs.compression(), to);
+            BOOST_REQUIRE_EQUAL(
+              static_cast<size_t>(out.header().record_count), records.size());
+            BOOST_REQUIRE(out.header().crc == model::crc_record_batch(out));
+            BOOST_REQUIRE(
+              storage::internal::decompress_batch(std::move(out))
+                .get0()
+                .copy_records()
+              == records);
+        }
+    }
+    BOOST_REQUIRE_EQUAL(recompressor.batches(), types.size() * types.size());
+}
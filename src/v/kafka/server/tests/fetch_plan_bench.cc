@@ -70,7 +70,6 @@ struct fixture {
 struct fetch_plan_fixture : redpanda_thread_fixture {
     static constexpr size_t topic_name_length = 30;
     static constexpr size_t total_partition_count = 800;
-    static constexpr size_t session_partition_count = 100;
 
     model::topic t;
 
@@ -91,123 +90,153 @@ struct fetch_plan_fixture : redpanda_thread_fixture {
 
         BOOST_TEST_CHECKPOINT("HERE");
     }
-};
 
-PERF_TEST_F(fetch_plan_fixture, test_fetch_plan) {
-    // make the fetch topic
-    kafka::fetch_topic ft;
-    ft.name = t;
-
-    // add the partitions to the fetch request
-    for (int pid = 0; pid < session_partition_count; pid++) {
-        kafka::fetch_partition fp;
-        fp.partition_index = model::partition_id(pid);
-        fp.fetch_offset = model::offset(0);
-        fp.current_leader_epoch = kafka::leader_epoch(-1);
-        fp.log_start_offset = model::offset(-1);
-        fp.max_bytes = 1048576;
-        ft.fetch_partitions.push_back(std::move(fp));
-    }
+    /**
+     * Plans an incremental fetch of a session of \p session_partition_count
+     * partitions. With \p mixed_metadata a quarter of the partitions has
+     * data past the fetch offset, half of them are caught up and the rest has
+     * no cached metadata, as in a large session with uneven traffic.
+     */
+    template<typename PlanFn>
+    size_t run_fetch_plan(
+      size_t session_partition_count, bool mixed_metadata, PlanFn make_plan) {
+        // make the fetch topic
+        kafka::fetch_topic ft;
+        ft.name = t;
+
+        // add the partitions to the fetch request
+        for (int pid = 0; pid < session_partition_count; pid++) {
+            kafka::fetch_partition fp;
+            fp.partition_index = model::partition_id(pid);
+            fp.fetch_offset = model::offset(0);
+            fp.current_leader_epoch = kafka::leader_epoch(-1);
+            fp.log_start_offset = model::offset(-1);
+            fp.max_bytes = 1048576;
+            ft.fetch_partitions.push_back(std::move(fp));
+        }
 
-    BOOST_TEST_CHECKPOINT("HERE");
-
-    // create a request
-    kafka::fetch_request_data frq_data;
-    frq_data.replica_id = kafka::client::consumer_replica_id;
-    frq_data.max_wait_ms = 500ms;
-    frq_data.min_bytes = 1;
-    frq_data.max_bytes = 52428800;
-    frq_data.isolation_level = model::isolation_level::read_uncommitted;
-    frq_data.session_id = kafka::invalid_fetch_session_id;
-    frq_data.session_epoch = kafka::initial_fetch_session_epoch;
-    frq_data.topics.push_back(std::move(ft));
-
-    kafka::fetch_request fetch_req{frq_data};
-
-    BOOST_TEST_CHECKPOINT("HERE");
-
-    // we need to share a connection among any requests here since the
-    // session cache is associated with a connection
-    auto conn = make_connection_context();
-
-    BOOST_TEST_CHECKPOINT("HERE");
-
-    // use this initial request to populate the fetch session
-    // in the session cache
-    kafka::fetch_session_id sess_id;
-    {
-        auto rctx = make_request_context(fetch_req, conn);
-        // set up a fetch session
-        auto ctx = rctx.fetch_sessions().maybe_get_session(fetch_req);
-        BOOST_REQUIRE_EQUAL(ctx.has_error(), false);
-        // first fetch has to be full fetch
-        BOOST_REQUIRE_EQUAL(ctx.is_full_fetch(), true);
-        BOOST_REQUIRE_EQUAL(ctx.is_sessionless(), false);
-
-        BOOST_REQUIRE_EQUAL(
-          ctx.session()->partitions().size(), session_partition_count);
-
-        sess_id = ctx.session()->id();
-        BOOST_REQUIRE(sess_id > 0);
-    }
+        BOOST_TEST_CHECKPOINT("HERE");
 
-    BOOST_TEST_CHECKPOINT("HERE");
+        // create a request
+        kafka::fetch_request_data frq_data;
+        frq_data.replica_id = kafka::client::consumer_replica_id;
+        frq_data.max_wait_ms = 500ms;
+        frq_data.min_bytes = 1;
+        frq_data.max_bytes = 52428800;
+        frq_data.isolation_level = model::isolation_level::read_uncommitted;
+        frq_data.session_id = kafka::invalid_fetch_session_id;
+        frq_data.session_epoch = kafka::initial_fetch_session_epoch;
+        frq_data.topics.push_back(std::move(ft));
 
-    fetch_req.data.session_id = sess_id;
-    fetch_req.data.session_epoch = 1;
-    fetch_req.data.topics.clear();
+        kafka::fetch_request fetch_req{frq_data};
 
-    auto rctx = make_request_context(fetch_req);
-    BOOST_REQUIRE_EQUAL(rctx.fetch_sessions().size(), 1);
+        BOOST_TEST_CHECKPOINT("HERE");
 
-    // add all partitions to fetch metadata
-    auto& mdc = rctx.get_fetch_metadata_cache();
-    for (int i = 0; i < total_partition_count; i++) {
-        mdc.insert_or_assign(
-          {t, i}, model::offset(0), model::offset(100), model::offset(100));
-    }
+        // we need to share a connection among any requests here since the
+        // session cache is associated with a connection
+        auto conn = make_connection_context();
 
-    vassert(mdc.size() == total_partition_count, "mdc.size(): {}", mdc.size());
+        BOOST_TEST_CHECKPOINT("HERE");
 
-    auto octx = kafka::op_context(
-      std::move(rctx), ss::default_smp_service_group());
+        // use this initial request to populate the fetch session
+        // in the session cache
+        kafka::fetch_session_id sess_id;
+        {
+            auto rctx = make_request_context(fetch_req, conn);
+            // set up a fetch session
+            auto ctx = rctx.fetch_sessions().maybe_get_session(fetch_req);
+            BOOST_REQUIRE_EQUAL(ctx.has_error(), false);
+            // first fetch has to be full fetch
+            BOOST_REQUIRE_EQUAL(ctx.is_full_fetch(), true);
+            BOOST_REQUIRE_EQUAL(ctx.is_sessionless(), false);
+
+            BOOST_REQUIRE_EQUAL(
+              ctx.session()->partitions().size(), session_partition_count);
+
+            sess_id = ctx.session()->id();
+            BOOST_REQUIRE(sess_id > 0);
+        }
 
-    BOOST_REQUIRE(!octx.session_ctx.is_sessionless());
-    BOOST_REQUIRE_EQUAL(octx.session_ctx.session()->id(), sess_id);
+        BOOST_TEST_CHECKPOINT("HERE");
 
-    BOOST_TEST_CHECKPOINT("HERE");
+        fetch_req.data.session_id = sess_id;
+        fetch_req.data.session_epoch = 1;
+        fetch_req.data.topics.clear();
+
+        auto rctx = make_request_context(fetch_req);
+        BOOST_REQUIRE_EQUAL(rctx.fetch_sessions().size(), 1);
+
+        // add partitions to fetch metadata
+        auto& mdc = rctx.get_fetch_metadata_cache();
+        size_t cached_partitions = 0;
+        for (int i = 0; i < total_partition_count; i++) {
+            if (mixed_metadata && i % 4 == 3) {
+                continue;
+            }
+            auto hw = mixed_metadata && i % 2 == 0 ? model::offset(0)
+                                                   : model::offset(100);
+            mdc.insert_or_assign({t, i}, model::offset(0), hw, hw);
+            ++cached_partitions;
+        }
 
-    constexpr size_t iters = 10000; // 0000000U;
+        vassert(mdc.size() == cached_partitions, "mdc.size(): {}", mdc.size());
 
-    perf_tests::start_measuring_time();
-    for (size_t i = 0; i < iters; i++) {
-        auto plan = kafka::testing::make_simple_fetch_plan(octx);
-        perf_tests::do_not_optimize(plan);
+        auto octx = kafka::op_context(
+          std::move(rctx), ss::default_smp_service_group());
+
+        BOOST_REQUIRE(!octx.session_ctx.is_sessionless());
+        BOOST_REQUIRE_EQUAL(octx.session_ctx.session()->id(), sess_id);
+
+        BOOST_TEST_CHECKPOINT("HERE");
+
+        constexpr size_t iters = 10000; // 0000000U;
+
+        perf_tests::start_measuring_time();
+        for (size_t i = 0; i < iters; i++) {
+            auto plan = make_plan(octx);
+            perf_tests::do_not_optimize(plan);
+        }
+        perf_tests::stop_measuring_time();
+
+        vassert(
+          mdc.size() == cached_partitions,
+          "mdc.size(): {}",
+          mdc.size()); // check that nothing was evicted
+
+        // bytes the plan allows to read, compared to the response budget
+        size_t planned_bytes = 0;
+        auto plan = make_plan(octx);
+        for (const auto& sf : plan.fetches_per_shard) {
+            for (const auto& r : sf.requests) {
+                if (!r.cfg.skip_read) {
+                    planned_bytes += r.cfg.max_bytes;
+                }
+            }
+        }
+        fpt_logger.info(
+          "session partitions: {}, planned bytes: {}, response budget: {}",
+          session_partition_count,
+          planned_bytes,
+          octx.bytes_left);
+
+        return (size_t)(session_partition_count * iters);
     }
-    perf_tests::stop_measuring_time();
-
-    vassert(
-      mdc.size() == total_partition_count,
-      "mdc.size(): {}",
-      mdc.size()); // check that nothing was evicted
-
-    // double micros_per_iter = timer._total_duration / 1ns / 1000.
-    //                          / timer._total_timings;
-    // fmt::print(
-    //   "FPT {} iters, {} micros/iter micros/part {}\n",
-    //   timer._total_timings,
-    //   micros_per_iter,
-    //   micros_per_iter / session_partition_count);
-
-    // auto plan = kafka::make_simple_fetch_plan(octx);
-    // auto& pfps = plan.fetches_per_shard;
-    // fmt::print("FPT plan count: {}\n", pfps.size());
-    // if (pfps.size()) {
-    //     fmt::print("FPT plan[0] parts: {}\n", pfps[0].requests.size());
-    // }
-
-    // for (auto& sf : plan.fetches_per_shard) {
-    //     fmt::print("FPT plan: {}\n", sf);
-    // }
-    return (size_t)(session_partition_count * iters);
+};
+
+PERF_TEST_F(fetch_plan_fixture, test_fetch_plan) {
+    return run_fetch_plan(100, false, kafka::testing::make_simple_fetch_plan);
+}
+
+PERF_TEST_F(fetch_plan_fixture, test_balanced_fetch_plan) {
+    return run_fetch_plan(100, false, kafka::testing::make_balanced_fetch_plan);
+}
+
+PERF_TEST_F(fetch_plan_fixture, test_fetch_plan_large_session) {
+    return run_fetch_plan(
+      total_partition_count, true, kafka::testing::make_simple_fetch_plan);
+}
+
+PERF_TEST_F(fetch_plan_fixture, test_balanced_fetch_plan_large_session) {
+    return run_fetch_plan(
+      total_partition_count, true, kafka::testing::make_balanced_fetch_plan);
 }
@@ -0,0 +1,112 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "config/property.h"
+#include "kafka/server/fetch_response_cache.h"
+#include "units.h"
+
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+namespace {
+kafka::fetch_response_cache::key make_key(int32_t partition, int64_t offset) {
+    return {
+      .ktp = model::ktp("tapioca", partition),
+      .start_offset = model::offset(offset),
+      .max_offset = model::offset::max(),
+      .max_bytes = 1_MiB,
+      .isolation_level = model::isolation_level::read_uncommitted,
+      .strict_max_bytes = false,
+    };
+}
+
+kafka::fetch_response_cache::value make_value(size_t size) {
+    iobuf data;
+    data.append(ss::temporary_buffer<char>(size));
+    return {
+      .data = std::move(data),
+      .record_count = 1,
+      .high_watermark = model::offset(10),
+      .last_stable_offset = model::offset(10),
+      .leader_epoch = kafka::leader_epoch(1),
+    };
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(fetch_response_cache_hit_and_invalidation) {
+    kafka::fetch_response_cache cache(config::mock_binding<size_t>(1_MiB));
+    const auto hw = model::offset(10);
+    const auto epoch = kafka::leader_epoch(1);
+
+    auto v = make_value(100);
+    const auto* ptr = v.data.begin()->get();
+    cache.put(make_key(0, 5), std::move(v));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 100);
+
+    // other key
+    BOOST_REQUIRE(!cache.get(make_key(0, 6), hw, hw, epoch));
+    BOOST_REQUIRE(!cache.get(make_key(1, 5), hw, hw, epoch));
+
+    // hits share the cached buffer
+    auto hit = cache.get(make_key(0, 5), hw, hw, epoch);
+    BOOST_REQUIRE(hit);
+    BOOST_REQUIRE_EQUAL(hit->data.size_bytes(), 100);
+    BOOST_REQUIRE_EQUAL(hit->data.begin()->get(), ptr);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 2);
+
+    // the partition moved on, the entry is evicted
+    BOOST_REQUIRE(!cache.get(make_key(0, 5), model::offset(11), hw, epoch));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 0);
+
+    cache.put(make_key(0, 5), make_value(100));
+    BOOST_REQUIRE(!cache.get(make_key(0, 5), hw, hw, kafka::leader_epoch(2)));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(fetch_response_cache_eviction) {
+    kafka::fetch_response_cache cache(config::mock_binding<size_t>(250));
+    const auto hw = model::offset(10);
+    const auto epoch = kafka::leader_epoch(1);
+
+    // larger than the cache
+    cache.put(make_key(0, 0), make_value(300));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+
+    // the oldest entry is evicted to fit the new one
+    cache.put(make_key(0, 0), make_value(100));
+    cache.put(make_key(0, 1), make_value(100));
+    cache.put(make_key(0, 2), make_value(100));
+    BOOST_REQUIRE_EQUAL(cache.size(), 2);
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 200);
+    BOOST_REQUIRE(!cache.get(make_key(0, 0), hw, hw, epoch));
+    BOOST_REQUIRE(cache.get(make_key(0, 1), hw, hw, epoch));
+    BOOST_REQUIRE(cache.get(make_key(0, 2), hw, hw, epoch));
+
+    // entries expire
+    ss::sleep(kafka::fetch_response_cache::ttl * 3).get();
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+    BOOST_REQUIRE_EQUAL(cache.size_bytes(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(fetch_response_cache_disabled) {
+    kafka::fetch_response_cache cache(config::mock_binding<size_t>(0));
+    BOOST_REQUIRE(!cache.enabled());
+    cache.put(make_key(0, 0), make_value(100));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+}
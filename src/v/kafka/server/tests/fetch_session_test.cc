@@ -225,3 +225,131 @@ FIXTURE_TEST(test_session_operations, fixture) {
         BOOST_REQUIRE(cache.size() == 0);
     }
 }
+
+FIXTURE_TEST(test_session_dirty_partitions, fixture) {
+    kafka::fetch_session session(kafka::fetch_session_id(123));
+    auto& partitions = session.partitions();
+    model::topic topic("test");
+    for (int i = 0; i < 5; ++i) {
+        partitions.emplace(fixture::make_fetch_partition(
+          topic, model::partition_id(i), model::offset(0)));
+    }
+    auto dirty_partitions = [&partitions] {
+        std::vector<model::partition_id> ret;
+        auto rng = boost::make_iterator_range(
+          partitions.cbegin_dirty_order(), partitions.cend_dirty_order());
+        for (const auto& fp : rng) {
+            ret.push_back(fp.topic_partition.get_partition());
+        }
+        return ret;
+    };
+    auto key = [&topic](int p) {
+        return model::topic_partition_view(topic, model::partition_id(p));
+    };
+    using pids = std::vector<model::partition_id>;
+
+    BOOST_TEST_MESSAGE("new partitions are dirty");
+    BOOST_REQUIRE_EQUAL(partitions.dirty_count(), 5);
+    BOOST_REQUIRE(
+      dirty_partitions()
+      == pids(
+        {model::partition_id(0),
+         model::partition_id(1),
+         model::partition_id(2),
+         model::partition_id(3),
+         model::partition_id(4)}));
+
+    BOOST_TEST_MESSAGE("clean partitions are skipped");
+    for (int i : {0, 2, 3}) {
+        partitions.mark_clean(partitions.find(key(i)));
+    }
+    BOOST_REQUIRE_EQUAL(partitions.dirty_count(), 2);
+    BOOST_REQUIRE(
+      dirty_partitions()
+      == pids({model::partition_id(1), model::partition_id(4)}));
+
+    BOOST_TEST_MESSAGE("marking partitions dirty wakes up the waiter");
+    auto f = session.wait_for_dirty_partition();
+    session.mark_dirty(key(1));
+    BOOST_REQUIRE_EQUAL(session.dirtied(), 0);
+    BOOST_REQUIRE(!f.available());
+    session.mark_dirty(key(2));
+    BOOST_REQUIRE_EQUAL(session.dirtied(), 1);
+    BOOST_REQUIRE(f.available());
+    f.get();
+    BOOST_REQUIRE(
+      dirty_partitions()
+      == pids(
+        {model::partition_id(1),
+         model::partition_id(4),
+         model::partition_id(2)}));
+
+    BOOST_TEST_MESSAGE("rotation keeps the dirty order");
+    partitions.move_to_end(partitions.find(key(1)));
+    partitions.move_to_end(partitions.find(key(0)));
+    BOOST_REQUIRE(
+      dirty_partitions()
+      == pids(
+        {model::partition_id(4),
+         model::partition_id(2),
+         model::partition_id(1)}));
+
+    BOOST_TEST_MESSAGE("erasing a dirty partition");
+    partitions.erase(key(4));
+    partitions.erase(key(3));
+    BOOST_REQUIRE_EQUAL(partitions.dirty_count(), 2);
+    BOOST_REQUIRE(
+      dirty_partitions()
+      == pids({model::partition_id(2), model::partition_id(1)}));
+
+    BOOST_TEST_MESSAGE("released waiter");
+    auto released = session.wait_for_dirty_partition();
+    session.release_dirty_waiter();
+    BOOST_REQUIRE(released.available());
+    released.get();
+}
+
+FIXTURE_TEST(test_session_update_marks_partitions_dirty, fixture) {
+    kafka::fetch_session_cache cache(120s);
+    kafka::fetch_request req;
+    req.data.session_epoch = kafka::initial_fetch_session_epoch;
+    req.data.session_id = kafka::invalid_fetch_session_id;
+    req.data.topics = {make_fetch_request_topic(model::topic("test"), 3)};
+
+    kafka::fetch_session_ptr session;
+    {
+        auto ctx = cache.maybe_get_session(req);
+        session = ctx.session();
+        for (auto it = session->partitions().begin();
+             it != session->partitions().end();
+             ++it) {
+            session->partitions().mark_clean(it);
+        }
+        BOOST_REQUIRE_EQUAL(session->partitions().dirty_count(), 0);
+        req.data.session_id = session->id();
+        req.data.session_epoch = session->epoch();
+    }
+
+    // the client only sends the partitions it updated
+    req.data.topics[0].fetch_partitions.erase(
+      req.data.topics[0].fetch_partitions.begin());
+    req.data.topics[0].fetch_partitions.pop_back();
+    auto incremental = cache.maybe_get_session(req);
+    BOOST_REQUIRE_EQUAL(incremental.is_full_fetch(), false);
+    BOOST_REQUIRE_EQUAL(session->partitions().dirty_count(), 1);
+    BOOST_REQUIRE_EQUAL(
+      session->partitions().cbegin_dirty_order()->topic_partition,
+      model::ktp(model::topic("test"), model::partition_id(1)));
+
+    // marking partitions of other sessions is a no-op
+    cache.mark_dirty(
+      kafka::fetch_session_id(session->id()() + 1),
+      model::topic_partition_view(
+        model::topic("test"), model::partition_id(0)));
+    BOOST_REQUIRE_EQUAL(session->partitions().dirty_count(), 1);
+    cache.mark_dirty(
+      session->id(),
+      model::topic_partition_view(
+        model::topic("test"), model::partition_id(0)));
+    BOOST_REQUIRE_EQUAL(session->partitions().dirty_count(), 2);
+}
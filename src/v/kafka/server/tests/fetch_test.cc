@@ -507,6 +507,48 @@ FIXTURE_TEST(fetch_one_debounce, redpanda_thread_fixture) {
     BOOST_REQUIRE(resp.data.topics[0].partitions[0].records->size_bytes() > 0);
 }
 
+FIXTURE_TEST(fetch_idle_partition_waits_for_deadline, redpanda_thread_fixture) {
+    model::topic topic("foo");
+    model::partition_id pid(0);
+    auto ntp = make_default_ntp(topic, pid);
+
+    wait_for_controller_leadership().get0();
+
+    add_topic(model::topic_namespace_view(ntp)).get();
+    wait_for_partition_offset(ntp, model::offset(0)).get0();
+
+    // no data is ever produced, the request waits on the partition until the
+    // deadline and returns an empty response
+    kafka::fetch_request req;
+    req.data.max_bytes = std::numeric_limits<int32_t>::max();
+    req.data.min_bytes = 1;
+    req.data.max_wait_ms = std::chrono::milliseconds(500);
+    req.data.session_id = kafka::invalid_fetch_session_id;
+    req.data.topics = {{
+      .name = topic,
+      .fetch_partitions = {{
+        .partition_index = pid,
+        .fetch_offset = model::offset(0),
+      }},
+    }};
+
+    auto client = make_kafka_client().get0();
+    client.connect().get();
+    const auto start = ss::lowres_clock::now();
+    auto resp = client.dispatch(req, kafka::api_version(4)).get0();
+    const auto elapsed = ss::lowres_clock::now() - start;
+    client.stop().then([&client] { client.shutdown(); }).get();
+
+    BOOST_REQUIRE_GE(elapsed, std::chrono::milliseconds(400));
+    BOOST_REQUIRE_EQUAL(resp.data.topics.size(), 1);
+    BOOST_REQUIRE_EQUAL(resp.data.topics[0].partitions.size(), 1);
+    BOOST_REQUIRE_EQUAL(
+      resp.data.topics[0].partitions[0].error_code, kafka::error_code::none);
+    BOOST_REQUIRE(
+      !resp.data.topics[0].partitions[0].records
+      || resp.data.topics[0].partitions[0].records->size_bytes() == 0);
+}
+
 FIXTURE_TEST(fetch_multi_topics, redpanda_thread_fixture) {
     // create a topic partition with some data
     model::topic topic_1("foo");
@@ -7,13 +7,18 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "config/property.h"
+#include "kafka/server/fetch_memory_share.h"
 #include "kafka/server/handlers/fetch.h"
 #include "seastarx.h"
 #include "ssx/semaphore.h"
+#include "units.h"
 
 #include <boost/test/auto_unit_test.hpp>
 #include <boost/test/test_tools.hpp>
 
+#include <algorithm>
+
 struct reserve_mem_units_test_result {
     size_t kafka, fetch;
     explicit reserve_mem_units_test_result(size_t size)
@@ -145,3 +150,66 @@ BOOST_AUTO_TEST_CASE(reserve_memory_units_test) {
     memsemunits.return_all();
     kafka_mem = memory_sem.available_units();
 }
+
+BOOST_AUTO_TEST_CASE(release_foreign_data_test) {
+    using namespace kafka;
+    auto make_result = [] {
+        auto buf = std::make_unique<iobuf>();
+        for (int i = 0; i < 4; ++i) {
+            auto frag = ss::temporary_buffer<char>(16_KiB);
+            std::fill_n(frag.get_write(), frag.size(), 'a' + i);
+            buf->append(std::make_unique<iobuf::fragment>(std::move(frag)));
+        }
+        return read_result(
+          ss::make_foreign(std::move(buf)),
+          model::offset(0),
+          model::offset(10),
+          model::offset(10),
+          {});
+    };
+
+    auto copied = make_result();
+    auto zero_copy = make_result();
+    const auto expected = std::get<read_result::foreign_data_t>(copied.data)
+                            ->copy();
+    std::vector<const char*> zero_copy_frags;
+    const auto& foreign = std::get<read_result::foreign_data_t>(zero_copy.data);
+    for (const auto& f : *foreign) {
+        zero_copy_frags.push_back(f.get());
+    }
+
+    auto copy_data = std::move(copied).release_data();
+    auto zero_copy_data = std::move(zero_copy).release_data(
+      read_result::zero_copy_foreign_data::yes);
+
+    BOOST_REQUIRE_EQUAL(copy_data, expected);
+    BOOST_REQUIRE_EQUAL(zero_copy_data, expected);
+    // the fragments of the foreign buffer are linked, not copied
+    std::vector<const char*> frags;
+    for (const auto& f : zero_copy_data) {
+        frags.push_back(f.get());
+    }
+    BOOST_REQUIRE(frags == zero_copy_frags);
+}
+
+BOOST_AUTO_TEST_CASE(fetch_memory_share_test) {
+    kafka::fetch_memory_share share(100_MiB, config::mock_binding<bool>(true));
+
+    // a single fetch may use all the memory
+    auto first = share.register_reader();
+    BOOST_TEST(share.readers() == 1);
+    BOOST_TEST(share.limit(200_MiB) == 200_MiB);
+
+    {
+        // the fetches reading at the same time share the memory, the ones
+        // asking for less than their share are not limited
+        auto second = share.register_reader();
+        auto third = std::move(second);
+        BOOST_TEST(share.readers() == 2);
+        BOOST_TEST(share.limit(10_MiB) == 10_MiB);
+        BOOST_TEST(share.limit(200_MiB) == 50_MiB);
+        BOOST_TEST(share.limited() == 1);
+    }
+    BOOST_TEST(share.readers() == 1);
+    BOOST_TEST(share.limit(200_MiB) == 200_MiB);
+}
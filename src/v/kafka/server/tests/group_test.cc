@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "config/configuration.h"
+#include "kafka/protocol/heartbeat.h"
 #include "kafka/server/group.h"
 #include "kafka/server/group_metadata.h"
 #include "utils/to_string.h"
@@ -53,6 +54,7 @@ static group get() {
       conf,
       nullptr,
       nullptr,
+      nullptr,
       model::term_id(),
       fr,
       feature_table,
@@ -301,6 +303,24 @@ SEASTAR_THREAD_TEST_CASE(advance_generation_non_empty) {
     BOOST_TEST(*g.protocol() == "n0");
 }
 
+SEASTAR_THREAD_TEST_CASE(heartbeat_completing_rebalance) {
+    auto g = get();
+    auto m = get_group_member();
+    (void)g.add_member(m);
+    g.set_state(group_state::preparing_rebalance);
+    g.advance_generation();
+    BOOST_REQUIRE(g.in_state(group_state::completing_rebalance));
+
+    // members waiting for the sync keep heartbeating without being asked to
+    // rejoin the group
+    heartbeat_request r;
+    r.data.group_id = g.id();
+    r.data.member_id = m->id();
+    r.data.generation_id = g.generation();
+    auto resp = g.handle_heartbeat(std::move(r)).get();
+    BOOST_TEST(resp.data.error_code == error_code::none);
+}
+
 SEASTAR_THREAD_TEST_CASE(member_metadata) {
     auto g = get();
 
@@ -0,0 +1,258 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "bytes/iobuf.h"
+#include "kafka/client/transport.h"
+#include "kafka/protocol/fetch.h"
+#include "kafka/protocol/produce.h"
+#include "model/fundamental.h"
+#include "model/namespace.h"
+#include "random/generators.h"
+#include "redpanda/tests/fixture.h"
+#include "storage/record_batch_builder.h"
+#include "utils/hdr_hist.h"
+#include "vlog.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/reactor.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+#include <fmt/ostream.h>
+
+#include <chrono>
+
+static ss::logger pcb_logger("produce_consume_bench");
+
+using namespace std::chrono_literals; // NOLINT
+
+/// End to end benchmark of the produce and fetch paths of a single node
+///
+/// Each iteration is a single request to a broker booted in process: a produce
+/// with acks=all of a batch to every partition of a topic, or a fetch from
+/// every partition of a topic filled beforehand. Besides the per iteration
+/// figures of perf_tests the workload reports, once a test completes, the
+/// throughput over the time measured, the latency percentiles of the requests
+/// and the reactor busy time spent per byte.
+struct produce_consume_bench_fixture : redpanda_thread_fixture {
+    struct workload {
+        size_t partitions;
+        size_t records_per_batch;
+        size_t record_size;
+    };
+
+    produce_consume_bench_fixture() {
+        wait_for_controller_leadership().get();
+        producer = std::make_unique<kafka::client::transport>(
+          make_kafka_client().get());
+        consumer = std::make_unique<kafka::client::transport>(
+          make_kafka_client().get());
+        producer->connect().get();
+        consumer->connect().get();
+    }
+
+    ~produce_consume_bench_fixture() {
+        if (requests == 0) {
+            return;
+        }
+        const auto seconds
+          = std::chrono::duration_cast<std::chrono::duration<double>>(
+              measured_time)
+              .count();
+        vlog(
+          pcb_logger.info,
+          "{} requests, {} bytes, throughput: {:.2f} MiB/s, latency: {}, "
+          "reactor busy: {:.2f} ns/byte",
+          requests,
+          bytes,
+          static_cast<double>(bytes) / (1_MiB * seconds),
+          latency,
+          static_cast<double>(busy_time.count()) / static_cast<double>(bytes));
+    }
+
+    /// Creates the topic of \p w on first use
+    ss::future<model::topic> topic_for(const workload& w) {
+        auto it = topics.find(w.partitions);
+        if (it != topics.end()) {
+            co_return it->second;
+        }
+        model::topic t(random_generators::gen_alphanum_string(20));
+        co_await add_topic(
+          model::topic_namespace_view(model::kafka_namespace, t),
+          static_cast<int>(w.partitions));
+        topics.emplace(w.partitions, t);
+        co_return t;
+    }
+
+    kafka::produce_request
+    make_produce_request(const model::topic& t, const workload& w) {
+        kafka::produce_request::topic tp;
+        tp.name = t;
+        for (size_t p = 0; p < w.partitions; ++p) {
+            storage::record_batch_builder builder(
+              model::record_batch_type::raft_data, model::offset(0));
+            for (size_t r = 0; r < w.records_per_batch; ++r) {
+                auto data = random_generators::gen_alphanum_string(
+                  w.record_size);
+                iobuf value;
+                value.append(data.data(), data.size());
+                builder.add_raw_kv(std::nullopt, std::move(value));
+            }
+            kafka::produce_request::partition partition;
+            partition.partition_index = model::partition_id(p);
+            partition.records.emplace(std::move(builder).build());
+            tp.partitions.push_back(std::move(partition));
+        }
+        std::vector<kafka::produce_request::topic> topics;
+        topics.push_back(std::move(tp));
+        // acks=all
+        kafka::produce_request req(std::nullopt, -1, std::move(topics));
+        req.data.timeout_ms = 10s;
+        req.has_idempotent = false;
+        req.has_transactional = false;
+        return req;
+    }
+
+    ss::future<> produce(kafka::produce_request req) {
+        auto resp = co_await producer->dispatch(std::move(req));
+        for (const auto& topic : resp.data.responses) {
+            for (const auto& p : topic.partitions) {
+                if (p.error_code != kafka::error_code::none) {
+                    throw std::runtime_error(
+                      fmt::format("produce error: {}", p.error_code));
+                }
+            }
+        }
+    }
+
+    kafka::fetch_request make_fetch_request(
+      const model::topic& t, const workload& w, size_t max_bytes) {
+        kafka::fetch_request::topic topic;
+        topic.name = t;
+        for (size_t p = 0; p < w.partitions; ++p) {
+            kafka::fetch_request::partition partition;
+            partition.partition_index = model::partition_id(p);
+            partition.fetch_offset = model::offset(0);
+            partition.log_start_offset = model::offset(0);
+            partition.max_bytes = static_cast<int32_t>(max_bytes);
+            topic.fetch_partitions.push_back(std::move(partition));
+        }
+        kafka::fetch_request req;
+        req.data.min_bytes = 1;
+        req.data.max_bytes = static_cast<int32_t>(max_bytes * w.partitions);
+        req.data.max_wait_ms = 1s;
+        req.data.topics.push_back(std::move(topic));
+        return req;
+    }
+
+    /// Measures a single request, issued by \p f, that moves the bytes it
+    /// returns
+    template<typename Func>
+    ss::future<> measure(Func f) {
+        const auto busy = ss::engine().total_busy_time();
+        const auto start = hdr_hist::clock_type::now();
+        perf_tests::start_measuring_time();
+        const size_t request_bytes = co_await f();
+        perf_tests::stop_measuring_time();
+        const auto elapsed = hdr_hist::clock_type::now() - start;
+        busy_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+          ss::engine().total_busy_time() - busy);
+        measured_time += elapsed;
+        latency.record(
+          std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+            .count());
+        bytes += request_bytes;
+        ++requests;
+    }
+
+    ss::future<size_t> run_produce(workload w) {
+        const auto t = co_await topic_for(w);
+        auto req = make_produce_request(t, w);
+        co_await measure([this, &req, &w]() -> ss::future<size_t> {
+            co_await produce(std::move(req));
+            co_return w.partitions * w.records_per_batch * w.record_size;
+        });
+        co_return w.partitions;
+    }
+
+    ss::future<size_t> run_fetch(workload w) {
+        const auto t = co_await topic_for(w);
+        if (!filled.contains(w.partitions)) {
+            // enough batches to fill the max bytes of each partition
+            for (size_t i = 0; i < fill_batches; ++i) {
+                co_await produce(make_produce_request(t, w));
+            }
+            filled.insert(w.partitions);
+        }
+        const size_t max_bytes = fill_batches * w.records_per_batch
+                                 * w.record_size;
+        co_await measure([this, &t, &w, max_bytes]() -> ss::future<size_t> {
+            auto resp = co_await consumer->dispatch(
+              make_fetch_request(t, w, max_bytes), kafka::api_version(4));
+            if (resp.data.error_code != kafka::error_code::none) {
+                throw std::runtime_error(
+                  fmt::format("fetch error: {}", resp.data.error_code));
+            }
+            size_t fetched = 0;
+            for (const auto& topic : resp.data.topics) {
+                for (const auto& p : topic.partitions) {
+                    if (p.error_code != kafka::error_code::none) {
+                        throw std::runtime_error(
+                          fmt::format("fetch error: {}", p.error_code));
+                    }
+                    if (p.records) {
+                        fetched += p.records->size_bytes();
+                    }
+                }
+            }
+            co_return fetched;
+        });
+        co_return w.partitions;
+    }
+
+    static constexpr size_t fill_batches = 4;
+
+    std::unique_ptr<kafka::client::transport> producer;
+    std::unique_ptr<kafka::client::transport> consumer;
+    absl::flat_hash_map<size_t, model::topic> topics;
+    absl::flat_hash_set<size_t> filled;
+
+    hdr_hist latency;
+    hdr_hist::clock_type::duration measured_time{0};
+    std::chrono::nanoseconds busy_time{0};
+    size_t bytes{0};
+    size_t requests{0};
+};
+
+PERF_TEST_F(produce_consume_bench_fixture, produce_16_partitions_1KiB) {
+    return run_produce(
+      {.partitions = 16, .records_per_batch = 16, .record_size = 1_KiB});
+}
+
+PERF_TEST_F(produce_consume_bench_fixture, produce_128_partitions_1KiB) {
+    return run_produce(
+      {.partitions = 128, .records_per_batch = 16, .record_size = 1_KiB});
+}
+
+PERF_TEST_F(produce_consume_bench_fixture, produce_16_partitions_100B) {
+    return run_produce(
+      {.partitions = 16, .records_per_batch = 64, .record_size = 100});
+}
+
+PERF_TEST_F(produce_consume_bench_fixture, fetch_16_partitions_1KiB) {
+    return run_fetch(
+      {.partitions = 16, .records_per_batch = 16, .record_size = 1_KiB});
+}
+
+PERF_TEST_F(produce_consume_bench_fixture, fetch_128_partitions_1KiB) {
+    return run_fetch(
+      {.partitions = 128, .records_per_batch = 16, .record_size = 1_KiB});
+}
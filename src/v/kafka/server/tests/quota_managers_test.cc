@@ -72,3 +72,37 @@ BOOST_AUTO_TEST_CASE(dispense_equally_test) {
             BOOST_CHECK_EQUAL(schedule_total, delta);
         }
 }
+
+BOOST_AUTO_TEST_CASE(dispense_pro_rata_test) {
+    using namespace kafka::detail;
+    using quota_t = kafka::snc_quota_manager::quota_t;
+    using quota_vec = std::vector<quota_t>;
+    {
+        // equal weights make the same split as dispense_equally
+        quota_vec schedule(3, 0);
+        quota_vec expected(3, 0);
+        dispense_pro_rata(schedule, 100, quota_vec{1, 1, 1});
+        dispense_equally(expected, 100);
+        BOOST_CHECK_EQUAL(schedule, expected);
+    }
+    {
+        quota_vec schedule{0, 10, 0};
+        dispense_pro_rata(schedule, 1000, quota_vec{3, 0, 1});
+        BOOST_CHECK_EQUAL(schedule, (quota_vec{750, 10, 250}));
+    }
+    {
+        // weights and values too large for integer products
+        quota_vec schedule(2, 0);
+        dispense_pro_rata(
+          schedule, 1'070'810'392'239, quota_vec{8'000'000'000, 1});
+        const auto total = std::reduce(
+          schedule.cbegin(), schedule.cend(), quota_t{0}, std::plus{});
+        BOOST_CHECK_EQUAL(total, 1'070'810'392'239);
+        BOOST_CHECK_GT(schedule[0], schedule[1]);
+    }
+    {
+        quota_vec schedule(2, 0);
+        dispense_pro_rata(schedule, 100, quota_vec{0, 0});
+        BOOST_CHECK_EQUAL(schedule, (quota_vec{0, 0}));
+    }
+}
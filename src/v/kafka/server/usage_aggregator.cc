@@ -30,22 +30,24 @@ struct persisted_state {
     fragmented_vector<usage_window> current_state;
 };
 
+/// Writes the state with a single put_many(), so that the keys are flushed
+/// together rather than waiting on a kvstore flush each
 static ss::future<>
 persist_to_disk(storage::kvstore& kvstore, persisted_state s) {
     using kv_ks = storage::kvstore::key_space;
 
-    co_await kvstore.put(
-      kv_ks::usage,
-      key_to_bytes(period_key),
-      serde::to_iobuf(s.configured_period));
-    co_await kvstore.put(
-      kv_ks::usage,
-      key_to_bytes(max_duration_key),
-      serde::to_iobuf(s.configured_windows));
-    co_await kvstore.put(
-      kv_ks::usage,
-      key_to_bytes(buckets_key),
-      serde::to_iobuf(std::move(s.current_state)));
+    std::vector<storage::kvstore::key_value> kvs;
+    kvs.reserve(3);
+    kvs.push_back(
+      {.key = key_to_bytes(period_key),
+       .value = serde::to_iobuf(s.configured_period)});
+    kvs.push_back(
+      {.key = key_to_bytes(max_duration_key),
+       .value = serde::to_iobuf(s.configured_windows)});
+    kvs.push_back(
+      {.key = key_to_bytes(buckets_key),
+       .value = serde::to_iobuf(std::move(s.current_state))});
+    co_await kvstore.put_many(kv_ks::usage, std::move(kvs));
 }
 
 static std::optional<persisted_state>
@@ -84,9 +86,11 @@ restore_from_disk(storage::kvstore& kvstore) {
 static ss::future<> clear_persisted_state(storage::kvstore& kvstore) {
     using kv_ks = storage::kvstore::key_space;
     try {
-        co_await kvstore.remove(kv_ks::usage, key_to_bytes(period_key));
-        co_await kvstore.remove(kv_ks::usage, key_to_bytes(max_duration_key));
-        co_await kvstore.remove(kv_ks::usage, key_to_bytes(buckets_key));
+        co_await kvstore.remove_many(
+          kv_ks::usage,
+          {key_to_bytes(period_key),
+           key_to_bytes(max_duration_key),
+           key_to_bytes(buckets_key)});
     } catch (const std::exception& ex) {
         vlog(klog.debug, "Ignoring exception from storage layer: {}", ex);
     }
@@ -138,6 +142,12 @@ usage_aggregator<clock_type>::usage_aggregator(
       usage_window_width_interval,
       usage_disk_persistance_interval);
     _persist_disk_timer.set_callback([this] {
+        if (!_dirty) {
+            /// Nothing was accounted for since the last write
+            _persist_disk_timer.arm(_usage_disk_persistance_interval);
+            return;
+        }
+        _dirty = false;
         ssx::background
           = ssx::spawn_with_gate_then(
               _bg_write_gate,
@@ -160,6 +170,7 @@ usage_aggregator<clock_type>::usage_aggregator(
                     "Encountered exception when persisting usage data to disk: "
                     "{} , retrying",
                     eptr);
+                  _dirty = true;
                   if (!_gate.is_closed()) {
                       const auto retry = std::min(
                         _usage_disk_persistance_interval, 5s);
@@ -319,6 +330,7 @@ ss::future<> usage_aggregator<clock_type>::grab_data(size_t idx) {
             _buckets[idx].u += usage_data;
             _buckets[idx].u.bytes_cloud_storage
               = usage_data.bytes_cloud_storage;
+            _dirty = true;
         }
     } catch (const std::exception& e) {
         vlog(
@@ -338,6 +350,7 @@ void usage_aggregator<clock_type>::close_window() {
     const auto now_ts = epoch_time_secs(now);
     auto& cur = _buckets[_current_window];
     cur.end = now_ts;
+    _dirty = true;
     if ((cur.end - cur.begin) != interval) {
         const auto err_str = fmt::format(
           "Observed a bucket (with index {}) that begin ts {} and end "
@@ -154,6 +154,8 @@ private:
     ss::gate _gate;
     size_t _current_window{0};
     fragmented_vector<usage_window> _buckets;
+    /// Whether the buckets changed since they were last persisted
+    bool _dirty{true};
     storage::kvstore& _kvstore;
 };
 } // namespace kafka
@@ -15,18 +15,25 @@
 #include "config/property.h"
 #include "metrics/metrics_registry.h"
 
-// Very simple class that watches the `aggregate_metrics` config and triggers a
-// global update of aggregation labels via the `metrics_registry`
+// Very simple class that watches the `aggregate_metrics` and
+// `aggregate_metrics_labels` configs and triggers a global update of
+// aggregation labels via the `metrics_registry`
 class aggregate_metrics_watcher {
 public:
     aggregate_metrics_watcher()
-      : _aggregate_metrics(config::shard_local_cfg().aggregate_metrics.bind()) {
-        _aggregate_metrics.watch([this]() {
-            metrics_registry::local().update_aggregation_labels(
-              _aggregate_metrics());
-        });
+      : _aggregate_metrics(config::shard_local_cfg().aggregate_metrics.bind())
+      , _aggregate_metrics_labels(
+          config::shard_local_cfg().aggregate_metrics_labels.bind()) {
+        _aggregate_metrics.watch([this]() { update(); });
+        _aggregate_metrics_labels.watch([this]() { update(); });
     }
 
 private:
+    void update() {
+        metrics_registry::local().update_aggregation_labels(
+          _aggregate_metrics(), _aggregate_metrics_labels());
+    }
+
     config::binding<bool> _aggregate_metrics;
+    config::binding<std::vector<ss::sstring>> _aggregate_metrics_labels;
 };
@@ -30,10 +30,11 @@ internal_metric_groups& internal_metric_groups::add_group(
           "Must not use individual aggregation labels when using the "
           "aggregation label per group overload");
 
-        metric.aggregate(
+        metric.aggregate(metrics_registry::aggregation_labels(
           config::shard_local_cfg().aggregate_metrics()
             ? aggregated_labels
-            : non_aggregated_labels);
+            : non_aggregated_labels,
+          config::shard_local_cfg().aggregate_metrics_labels()));
         transformed.emplace_back(metric);
 
         metrics_registry::local().register_metric(
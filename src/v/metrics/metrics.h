@@ -198,6 +198,14 @@ struct public_metrics_group_service {
     }
 };
 
+struct internal_metrics_group_service {
+    internal_metric_groups groups;
+    ss::future<> stop() {
+        groups.clear();
+        return ss::make_ready_future<>();
+    }
+};
+
 /**
  * @brief A class bundling together public and internal metrics.
  *
@@ -2,6 +2,8 @@
 
 #include "vassert.h"
 
+#include <algorithm>
+
 void metrics_registry::register_metric(
   const group_name_t& group_name,
   const metric_name_t& metric_name,
@@ -52,16 +54,36 @@ void metrics_registry::register_metric(
 #endif
 }
 
-void metrics_registry::update_aggregation_labels(bool aggregate_metrics) {
+void metrics_registry::update_aggregation_labels(
+  bool aggregate_metrics,
+  const std::vector<ss::sstring>& always_aggregated_labels) {
     for (const auto& [group_name, group] : _registry) {
         for (const auto& [metric_name, metric_info] : group) {
             ss::metrics::update_aggregate_labels(
               group_name,
               metric_name,
-              aggregate_metrics ? metric_info.aggregated_labels
-                                : metric_info.non_aggregated_labels);
+              aggregation_labels(
+                aggregate_metrics ? metric_info.aggregated_labels
+                                  : metric_info.non_aggregated_labels,
+                always_aggregated_labels));
+        }
+    }
+}
+
+std::vector<ss::metrics::label> metrics_registry::aggregation_labels(
+  const std::vector<ss::metrics::label>& labels,
+  const std::vector<ss::sstring>& always_aggregated_labels) {
+    auto ret = labels;
+    for (const auto& name : always_aggregated_labels) {
+        auto it = std::find_if(
+          labels.begin(), labels.end(), [&name](const auto& l) {
+              return l.name() == name;
+          });
+        if (it == labels.end()) {
+            ret.emplace_back(name);
         }
     }
+    return ret;
 }
 
 thread_local metrics_registry metrics_registry::
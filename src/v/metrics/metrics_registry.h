@@ -32,6 +32,11 @@
  * aggregated labels. I.e.: for two or more metric series that differ only in
  * labels that are "aggregated" labels they will be combined into a single
  * series with their values summed and the aggregated labels removed.
+ *
+ * On top of the labels given at registration, the `aggregate_metrics_labels`
+ * config lists labels which are aggregated on all of the registered metrics
+ * (e.g. the partition label), bounding the cardinality of the `/metrics`
+ * endpoint on clusters with many partitions.
  */
 class metrics_registry {
 public:
@@ -55,8 +60,17 @@ public:
       const std::vector<ss::metrics::label>& aggregated_labels);
 
     // For all registered metrics, update the labels to be used for aggregation
-    // depending on the new state of whether aggregation is turned on
-    void update_aggregation_labels(bool aggregate_metrics);
+    // depending on the new state of whether aggregation is turned on and of
+    // the labels which are always aggregated
+    void update_aggregation_labels(
+      bool aggregate_metrics,
+      const std::vector<ss::sstring>& always_aggregated_labels);
+
+    /// \p labels followed by those of \p always_aggregated_labels which are
+    /// not already part of them
+    static std::vector<ss::metrics::label> aggregation_labels(
+      const std::vector<ss::metrics::label>& labels,
+      const std::vector<ss::sstring>& always_aggregated_labels);
 
 private:
     static thread_local metrics_registry
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "metrics/scrape_cache.h"
+
+#include "bytes/iostream.h"
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+#include "vassert.h"
+
+#include <seastar/core/do_with.hh>
+#include <seastar/core/metrics.hh>
+
+namespace metrics {
+
+scrape_cache_handler::scrape_cache_handler(
+  ss::sstring endpoint,
+  std::unique_ptr<ss::httpd::handler_base> handler,
+  config::binding<std::chrono::milliseconds> ttl)
+  : _endpoint(std::move(endpoint))
+  , _handler(std::move(handler))
+  , _ttl(std::move(ttl)) {
+    _ttl.watch([this] { _cached.reset(); });
+    setup_metrics();
+}
+
+bool scrape_cache_handler::cacheable(const ss::http::request& req) {
+    return req.query_parameters.empty()
+           && req.get_header("Accept").find("protobuf") == ss::sstring::npos;
+}
+
+bool scrape_cache_handler::fresh() const {
+    return _cached
+           && ss::lowres_clock::now() - _cached->serialized_at < _ttl();
+}
+
+ss::future<std::unique_ptr<ss::http::reply>> scrape_cache_handler::handle(
+  const ss::sstring& path,
+  std::unique_ptr<ss::http::request> req,
+  std::unique_ptr<ss::http::reply> rep) {
+    ++_scrapes;
+    if (_ttl() <= std::chrono::milliseconds(0) || !cacheable(*req)) {
+        co_return co_await handle_uncached(
+          path, std::move(req), std::move(rep));
+    }
+
+    exposition e;
+    if (fresh()) {
+        ++_cache_hits;
+        e = *_cached;
+    } else {
+        if (!_serializing) {
+            _serializing.emplace(serialize(path, std::move(req)));
+        }
+        std::exception_ptr ex;
+        try {
+            e = co_await _serializing->get_future();
+        } catch (...) {
+            ex = std::current_exception();
+        }
+        // the first of the waiters allows the next serialization
+        if (_serializing && _serializing->available()) {
+            _serializing.reset();
+        }
+        if (ex) {
+            std::rethrow_exception(ex);
+        }
+    }
+
+    // a later serialization may replace the cached exposition while the
+    // reply is written, the fragments we share stay alive until then
+    rep->set_mime_type(e.content_type);
+    rep->_body_writer =
+      [body = e.body->share(0, e.body->size_bytes())](
+        ss::output_stream<char>&& out) mutable {
+          return ss::do_with(
+            std::move(out),
+            std::move(body),
+            [](ss::output_stream<char>& out, iobuf& body) {
+                return write_iobuf_to_output_stream(std::move(body), out)
+                  .finally([&out] { return out.close(); });
+            });
+      };
+    co_return std::move(rep);
+}
+
+ss::future<std::unique_ptr<ss::http::reply>>
+scrape_cache_handler::handle_uncached(
+  const ss::sstring& path,
+  std::unique_ptr<ss::http::request> req,
+  std::unique_ptr<ss::http::reply> rep) {
+    rep = co_await _handler->handle(path, std::move(req), std::move(rep));
+    if (!rep->_body_writer) {
+        co_return std::move(rep);
+    }
+    // the metrics are serialized while the reply is written
+    rep->_body_writer = [this, writer = std::move(rep->_body_writer)](
+                          ss::output_stream<char>&& out) mutable {
+        auto start = latency_hist::clock_type::now();
+        return writer(std::move(out)).finally([this, start] {
+            _serialize_latency.record_since(start);
+        });
+    };
+    co_return std::move(rep);
+}
+
+ss::future<scrape_cache_handler::exposition> scrape_cache_handler::serialize(
+  const ss::sstring& path, std::unique_ptr<ss::http::request> req) {
+    const auto start = latency_hist::clock_type::now();
+    auto rep = co_await _handler->handle(
+      path, std::move(req), std::make_unique<ss::http::reply>());
+
+    auto body = ss::make_lw_shared<iobuf>();
+    if (rep->_body_writer) {
+        co_await rep->_body_writer(make_iobuf_ref_output_stream(*body));
+    } else {
+        body->append(rep->_content.data(), rep->_content.size());
+    }
+
+    _serialize_latency.record_since(start);
+    _serialized_bytes += body->size_bytes();
+    _cached = exposition{
+      .body = std::move(body),
+      .content_type = rep->get_header("Content-Type"),
+      .serialized_at = ss::lowres_clock::now(),
+    };
+    co_return *_cached;
+}
+
+void scrape_cache_handler::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    const std::vector<sm::label_instance> labels = {
+      sm::label("endpoint")(_endpoint)};
+
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("metrics_scrape"),
+      {
+        sm::make_counter(
+          "requests",
+          [this] { return _scrapes; },
+          sm::description("Number of scrapes of the metrics endpoint"),
+          labels),
+        sm::make_counter(
+          "cache_hits",
+          [this] { return _cache_hits; },
+          sm::description(
+            "Number of scrapes served from a cached serialization"),
+          labels),
+        sm::make_counter(
+          "serialized_bytes",
+          [this] { return _serialized_bytes; },
+          sm::description("Bytes of the cached serializations"),
+          labels),
+        sm::make_histogram(
+          "serialize_latency",
+          [this] {
+              return _serialize_latency.internal_histogram_logform();
+          },
+          sm::description("Time spent serializing the metrics of a scrape"),
+          labels),
+      });
+}
+
+void cache_prometheus_route(
+  ss::httpd::http_server& server, const ss::sstring& route) {
+    auto* handler = server._routes.drop(ss::httpd::operation_type::GET, route);
+    vassert(handler != nullptr, "No prometheus handler on {}", route);
+    server._routes.put(
+      ss::httpd::operation_type::GET,
+      route,
+      new scrape_cache_handler(
+        route,
+        std::unique_ptr<ss::httpd::handler_base>(handler),
+        config::shard_local_cfg().metrics_scrape_cache_ttl_ms.bind()));
+}
+
+} // namespace metrics
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "config/property.h"
+#include "metrics/metrics.h"
+#include "seastarx.h"
+#include "utils/latency_hist.h"
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/http/handlers.hh>
+#include <seastar/http/httpd.hh>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+
+namespace metrics {
+
+/*
+ * Wraps the seastar prometheus handler of a metrics endpoint. Serializing the
+ * metrics of all the shards is expensive on brokers with many partitions, so
+ * the serialized exposition is kept for `metrics_scrape_cache_ttl_ms` and
+ * handed to the following scrapes without copying it. Concurrent scrapes of a
+ * stale exposition wait for a single serialization.
+ *
+ * Scrapes filtering the metrics with query parameters or asking for the
+ * protobuf format are not cached. The cost of the scrapes is exported per
+ * endpoint on the internal metrics.
+ */
+class scrape_cache_handler final : public ss::httpd::handler_base {
+public:
+    scrape_cache_handler(
+      ss::sstring endpoint,
+      std::unique_ptr<ss::httpd::handler_base> handler,
+      config::binding<std::chrono::milliseconds> ttl);
+
+    ss::future<std::unique_ptr<ss::http::reply>> handle(
+      const ss::sstring& path,
+      std::unique_ptr<ss::http::request> req,
+      std::unique_ptr<ss::http::reply> rep) final;
+
+private:
+    struct exposition {
+        ss::lw_shared_ptr<iobuf> body;
+        ss::sstring content_type;
+        ss::lowres_clock::time_point serialized_at;
+    };
+
+    static bool cacheable(const ss::http::request&);
+    bool fresh() const;
+
+    ss::future<std::unique_ptr<ss::http::reply>> handle_uncached(
+      const ss::sstring& path,
+      std::unique_ptr<ss::http::request> req,
+      std::unique_ptr<ss::http::reply> rep);
+    ss::future<exposition>
+    serialize(const ss::sstring& path, std::unique_ptr<ss::http::request>);
+
+    void setup_metrics();
+
+    ss::sstring _endpoint;
+    std::unique_ptr<ss::httpd::handler_base> _handler;
+    config::binding<std::chrono::milliseconds> _ttl;
+
+    std::optional<exposition> _cached;
+    std::optional<ss::shared_future<exposition>> _serializing;
+
+    uint64_t _scrapes{0};
+    uint64_t _cache_hits{0};
+    uint64_t _serialized_bytes{0};
+    latency_hist _serialize_latency;
+    internal_metric_groups _metrics;
+};
+
+/// Puts a scrape_cache_handler in front of the prometheus handler registered
+/// on \p route of \p server
+void cache_prometheus_route(
+  ss::httpd::http_server& server, const ss::sstring& route);
+
+} // namespace metrics
@@ -29,6 +29,17 @@ model::record record_batch_iterator::next() {
     return r;
 }
 
+model::record_key record_batch_iterator::next_key() {
+    auto r = model::parse_one_record_key_copy_from_buffer(_parser);
+    ++_index;
+    if (!has_next() && _parser.bytes_left()) [[unlikely]] {
+        throw std::out_of_range(fmt::format(
+          "Record iteration stopped with {} bytes remaining",
+          _parser.bytes_left()));
+    }
+    return r;
+}
+
 record_batch_iterator
 record_batch_iterator::create(const model::record_batch& b) {
     b.verify_iterable();
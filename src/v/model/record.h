@@ -586,6 +586,16 @@ struct batch_identity {
     friend std::ostream& operator<<(std::ostream&, const batch_identity&);
 };
 
+/**
+ * The offset delta and key of a record. Its value and headers are skipped
+ * without being decoded, which is all that compaction needs from most
+ * records.
+ */
+struct record_key {
+    int32_t offset_delta;
+    iobuf key;
+};
+
 // A simple iterator for model::record_batch
 //
 // Usage:
@@ -603,6 +613,8 @@ public:
     bool has_next() const noexcept;
 
     model::record next();
+    /// the key of the next record, see record_key
+    model::record_key next_key();
 
     static record_batch_iterator create(const model::record_batch& b);
 
@@ -816,6 +828,19 @@ public:
 
     auto serde_fields() { return std::tie(_header, _records); }
 
+    /*
+     * Same encoding as the serde_fields, except that the fragments of the
+     * records are linked into the output rather than copied. Batches are the
+     * bulk of replication traffic and are usually held by their producer
+     * until the request is sent anyway.
+     */
+    void serde_write(iobuf& out) {
+        using serde::write;
+        write(out, _header);
+        write<serde::serde_size_t>(out, _records.size_bytes());
+        out.append_fragments(std::move(_records));
+    }
+
     static model::record_batch
     serde_direct_read(iobuf_parser& in, const serde::header& h) {
         using serde::read_nested;
@@ -869,6 +894,26 @@ private:
     for_each_record(const model::record_batch& batch, Func&& f);
 };
 
+/**
+ * Iterate over the keys of the records, see record_key.
+ */
+template<typename Func>
+inline ss::future<>
+for_each_record_key(const model::record_batch& batch, Func&& f) {
+    return ss::do_with(
+      record_batch_iterator::create(batch),
+      record_key{},
+      [f = std::forward<Func>(f)](
+        record_batch_iterator& it, record_key& r) mutable {
+          return ss::do_until(
+            [&it]() { return !it.has_next(); },
+            [&it, &r, f = std::forward<Func>(f)]() {
+                r = it.next_key();
+                return ss::futurize_invoke(f, r);
+            });
+      });
+}
+
 /**
  * Iterate over records with lazy record materialization.
  */
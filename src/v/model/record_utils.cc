@@ -175,6 +175,31 @@ model::record parse_one_record_copy_from_buffer(iobuf_const_parser& parser) {
       });
 }
 
+model::record_key
+parse_one_record_key_copy_from_buffer(iobuf_const_parser& parser) {
+    auto [record_size, attr] = parse_record_meta_from_buffer(parser);
+    // the record size counts the bytes from the attributes on
+    const auto start = parser.bytes_consumed() - sizeof(attr);
+    parser.read_varlong(); // timestamp delta
+    auto [offset_delta, ov] = parser.read_varlong();
+    auto [key_length, kv] = parser.read_varlong();
+    model::record_key ret{.offset_delta = static_cast<int32_t>(offset_delta)};
+    if (key_length > 0) {
+        ret.key = parser.copy(key_length);
+    }
+    const auto consumed = static_cast<int64_t>(
+      parser.bytes_consumed() - start);
+    if (record_size < consumed) [[unlikely]] {
+        throw std::out_of_range(fmt::format(
+          "Record size {} is smaller than its first {} bytes",
+          record_size,
+          consumed));
+    }
+    // value and headers
+    parser.skip(record_size - consumed);
+    return ret;
+}
+
 static inline void append_vint_to_iobuf(iobuf& b, int64_t v) {
     auto vb = vint::to_bytes(v);
     b.append(vb.data(), vb.size());
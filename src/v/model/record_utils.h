@@ -19,6 +19,7 @@ namespace model {
 struct record_batch_header;
 class record_batch;
 class record;
+struct record_key;
 
 void crc_record_batch_header(crc::crc32c&, const record_batch_header&);
 
@@ -32,6 +33,8 @@ uint32_t internal_header_only_crc(const record_batch_header&);
 
 model::record parse_one_record_from_buffer(iobuf_parser& parser);
 model::record parse_one_record_copy_from_buffer(iobuf_const_parser& parser);
+model::record_key
+parse_one_record_key_copy_from_buffer(iobuf_const_parser& parser);
 void append_record_to_buffer(iobuf& a, const model::record& r);
 
 } // namespace model
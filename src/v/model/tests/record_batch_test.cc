@@ -91,6 +91,26 @@ SEASTAR_THREAD_TEST_CASE(iterator) {
     BOOST_TEST(!it.has_next());
 }
 
+SEASTAR_THREAD_TEST_CASE(key_iterator) {
+    auto b = model::test::make_random_batch(model::offset(0), 10, false);
+    auto records = b.copy_records();
+
+    auto it = model::record_batch_iterator::create(b);
+    for (const auto& r : records) {
+        BOOST_REQUIRE(it.has_next());
+        auto k = it.next_key();
+        BOOST_REQUIRE_EQUAL(k.offset_delta, r.offset_delta());
+        BOOST_REQUIRE_EQUAL(k.key, r.key());
+    }
+    BOOST_REQUIRE(!it.has_next());
+
+    size_t i = 0;
+    model::for_each_record_key(b, [&](const model::record_key& k) {
+        BOOST_REQUIRE_EQUAL(k.key, records[i++].key());
+    }).get();
+    BOOST_REQUIRE_EQUAL(i, records.size());
+}
+
 SEASTAR_THREAD_TEST_CASE(extra_bytes_iterator) {
     auto b = model::test::make_random_batch(model::offset(0), 1, false);
     auto buf = b.data().copy();
@@ -106,3 +126,26 @@ SEASTAR_THREAD_TEST_CASE(extra_bytes_iterator) {
     BOOST_TEST(it.has_next());
     BOOST_REQUIRE_THROW(it.next(), std::out_of_range);
 }
+
+SEASTAR_THREAD_TEST_CASE(serde_write_links_records) {
+    auto b = model::test::make_random_batch(model::offset(0), 10, false);
+    auto records = b.data().copy();
+
+    iobuf out;
+    serde::write(out, b.copy());
+
+    // the encoding is the one of the serde fields
+    iobuf fields;
+    serde::write(fields, model::record_batch::redpanda_serde_version);
+    serde::write(fields, model::record_batch::redpanda_serde_compat_version);
+    iobuf body;
+    serde::write(body, b.header());
+    serde::write(body, records.copy());
+    serde::write(fields, static_cast<serde::serde_size_t>(body.size_bytes()));
+    fields.append(std::move(body));
+    BOOST_REQUIRE(out == fields);
+
+    auto decoded = serde::from_iobuf<model::record_batch>(std::move(out));
+    BOOST_REQUIRE(decoded.data() == records);
+    BOOST_REQUIRE_EQUAL(decoded, b);
+}
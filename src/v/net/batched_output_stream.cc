@@ -10,6 +10,7 @@
 #include "net/batched_output_stream.h"
 
 #include "likely.h"
+#include "ssx/future-util.h"
 #include "ssx/semaphore.h"
 #include "vassert.h"
 
@@ -21,9 +22,14 @@
 namespace net {
 
 batched_output_stream::batched_output_stream(
-  ss::output_stream<char> o, size_t cache)
+  ss::output_stream<char> o,
+  size_t cache,
+  std::chrono::microseconds cork_delay,
+  stats* stats)
   : _out(std::move(o))
   , _cache_size(cache)
+  , _cork_delay(cork_delay)
+  , _stats(stats)
   , _write_sem(std::make_unique<ssx::semaphore>(1, "net/batch-ostream")) {
     // Size zero reserved for identifying default-initialized
     // instances in stop()
@@ -48,19 +54,43 @@ ss::future<bool> batched_output_stream::write(ss::scattered_message<char> msg) {
           const size_t vbytes = v.size();
           return _out.write(std::move(v)).then([this, vbytes] {
               _unflushed_bytes += vbytes;
+              if (_stats) {
+                  ++_stats->writes;
+              }
+              const bool last_writer = _write_sem->waiters() == 0;
               if (
-                _write_sem->waiters() == 0 || _unflushed_bytes >= _cache_size) {
+                (last_writer && _cork_delay.count() == 0)
+                || _unflushed_bytes >= _cache_size) {
                   return do_flush().then([] { return true; });
               }
+              if (last_writer && !_cork_timer.armed()) {
+                  arm_cork_timer();
+              }
               return ss::make_ready_future<bool>(false);
           });
       });
 }
+void batched_output_stream::arm_cork_timer() {
+    _cork_timer.set_callback([this] {
+        if (_closed) {
+            return;
+        }
+        // a failed flush leaves the stream broken, the error is returned to
+        // the next writer
+        ssx::background = flush().handle_exception(
+          [](const std::exception_ptr&) {});
+    });
+    _cork_timer.arm(_cork_delay);
+}
 ss::future<> batched_output_stream::do_flush() {
+    _cork_timer.cancel();
     if (_unflushed_bytes == 0) {
         return ss::make_ready_future<>();
     }
     _unflushed_bytes = 0;
+    if (_stats) {
+        ++_stats->flushes;
+    }
     return _out.flush();
 }
 ss::future<> batched_output_stream::flush() {
@@ -71,6 +101,7 @@ ss::future<> batched_output_stream::stop() {
         return ss::make_ready_future<>();
     }
     _closed = true;
+    _cork_timer.cancel();
 
     if (_cache_size == 0) {
         // A default-initialized batched_output_stream has a default
@@ -15,7 +15,9 @@
 #include "ssx/semaphore.h"
 
 #include <seastar/core/iostream.hh>
+#include <seastar/core/timer.hh>
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 
@@ -43,22 +45,43 @@ private:
  * flushes when multiple writes are in progress on the stream: a flush occurs
  * only when the last pending writer completes or when a configured amount of
  * unflushed bytes have accumulated.
+ *
+ * With a non zero cork delay the flush of the last pending writer is deferred
+ * by up to that delay, so that the small messages written in the meantime are
+ * sent with the same flush, i.e. with a single writev call. The writers don't
+ * wait for a deferred flush.
  */
 class batched_output_stream {
 public:
     static constexpr size_t default_max_unflushed_bytes = 1024 * 1024;
 
+    /// Counters of the writes and flushes, may be shared by many streams
+    struct stats {
+        uint64_t writes{0};
+        uint64_t flushes{0};
+    };
+
     batched_output_stream() = default;
     explicit batched_output_stream(
-      ss::output_stream<char>, size_t cache = default_max_unflushed_bytes);
+      ss::output_stream<char>,
+      size_t cache = default_max_unflushed_bytes,
+      std::chrono::microseconds cork_delay = std::chrono::microseconds{0},
+      stats* = nullptr);
     ~batched_output_stream() noexcept = default;
     // NOTE: explicitly defined for a gcc
     batched_output_stream(batched_output_stream&& o) noexcept
       : _out(std::move(o._out))
       , _cache_size(o._cache_size)
+      , _cork_delay(o._cork_delay)
+      , _stats(o._stats)
       , _write_sem(std::move(o._write_sem))
       , _unflushed_bytes(o._unflushed_bytes)
-      , _closed(o._closed) {}
+      , _closed(o._closed) {
+        // an armed timer refers to the moved from stream
+        if (o._cork_timer.cancel()) {
+            arm_cork_timer();
+        }
+    }
     batched_output_stream& operator=(batched_output_stream&& o) noexcept {
         if (this != &o) {
             this->~batched_output_stream();
@@ -92,9 +115,13 @@ public:
 
 private:
     ss::future<> do_flush();
+    void arm_cork_timer();
 
     ss::output_stream<char> _out;
     size_t _cache_size{0};
+    std::chrono::microseconds _cork_delay{0};
+    stats* _stats{nullptr};
+    ss::timer<> _cork_timer;
     std::unique_ptr<ssx::semaphore> _write_sem;
     size_t _unflushed_bytes{0};
     bool _closed = false;
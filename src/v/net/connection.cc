@@ -19,6 +19,8 @@
 
 #include <gnutls/gnutls.h>
 
+#include <algorithm>
+
 namespace net {
 
 /**
@@ -128,18 +130,37 @@ connection::connection(
   ss::socket_address a,
   server_probe& p,
   std::optional<size_t> in_max_buffer_size,
-  bool tls_enabled)
+  std::optional<size_t> in_min_buffer_size,
+  std::optional<size_t> out_buffer_size,
+  bool tls_enabled,
+  std::chrono::microseconds output_cork_delay)
   : addr(a)
   , _hook(hook)
   , _name(std::move(name))
   , _fd(std::move(f))
   , _in(_fd.input())
-  , _out(_fd.output())
+  , _out(
+      out_buffer_size ? _fd.output(*out_buffer_size) : _fd.output(),
+      batched_output_stream::default_max_unflushed_bytes,
+      output_cork_delay,
+      &p.output_stream_stats())
   , _probe(p)
   , _tls_enabled(tls_enabled) {
-    if (in_max_buffer_size.has_value()) {
+    if (in_max_buffer_size.has_value() || in_min_buffer_size.has_value()) {
         auto in_config = ss::connected_socket_input_stream_config{};
-        in_config.max_buffer_size = in_max_buffer_size.value();
+        if (in_max_buffer_size.has_value()) {
+            in_config.max_buffer_size = in_max_buffer_size.value();
+        }
+        if (in_min_buffer_size.has_value()) {
+            // a pending read holds a buffer of the current size, starting
+            // from the minimum keeps the memory of idle connections low
+            in_config.min_buffer_size = in_min_buffer_size.value();
+            in_config.buffer_size = in_min_buffer_size.value();
+        }
+        in_config.max_buffer_size = std::max(
+          in_config.max_buffer_size, in_config.min_buffer_size);
+        in_config.buffer_size = std::min(
+          in_config.buffer_size, in_config.max_buffer_size);
         _in = _fd.input(in_config);
     } else {
         _in = _fd.input();
@@ -166,7 +187,14 @@ ss::future<> connection::shutdown() {
     return _out.stop();
 }
 
+double connection::bytes_rate() const {
+    const auto age = std::chrono::duration<double>(
+      ss::lowres_clock::now() - _established);
+    return age.count() > 0 ? static_cast<double>(_bytes) / age.count() : 0;
+}
+
 ss::future<> connection::write(ss::scattered_message<char> msg) {
+    mark_active(msg.size());
     _probe.add_bytes_sent(msg.size());
     return _out.write(std::move(msg)).discard_result();
 }
@@ -16,12 +16,15 @@
 #include "seastarx.h"
 
 #include <seastar/core/iostream.hh>
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/net/api.hh>
 #include <seastar/net/socket_defs.hh>
 #include <seastar/net/tls.hh>
 
 #include <boost/intrusive/list.hpp>
 
+#include <chrono>
+
 /*
  * FIXME:
  *  - server_probe contains bits from simple_protocol
@@ -42,7 +45,11 @@ public:
       ss::socket_address a,
       server_probe& p,
       std::optional<size_t> in_max_buffer_size,
-      bool tls_enabled);
+      std::optional<size_t> in_min_buffer_size,
+      std::optional<size_t> out_buffer_size,
+      bool tls_enabled,
+      std::chrono::microseconds output_cork_delay
+      = std::chrono::microseconds{0});
     ~connection() noexcept;
     connection(const connection&) = delete;
     connection& operator=(const connection&) = delete;
@@ -75,6 +82,21 @@ public:
 
     bool tls_enabled() const { return _tls_enabled; }
 
+    /// Records a request of the given size read by the protocol, responses
+    /// are recorded by write()
+    void mark_active(size_t bytes) {
+        _last_activity = ss::lowres_clock::now();
+        _bytes += bytes;
+    }
+    /// Time since a request was read from or a response written to the
+    /// connection
+    ss::lowres_clock::duration idle_for() const {
+        return ss::lowres_clock::now() - _last_activity;
+    }
+    /// Bytes per second of the requests and responses since the connection
+    /// was established
+    double bytes_rate() const;
+
 private:
     boost::intrusive::list<connection>& _hook;
     ss::sstring _name;
@@ -83,6 +105,9 @@ private:
     net::batched_output_stream _out;
     server_probe& _probe;
     bool _tls_enabled;
+    ss::lowres_clock::time_point _established{ss::lowres_clock::now()};
+    ss::lowres_clock::time_point _last_activity{_established};
+    uint64_t _bytes{0};
 };
 
 } // namespace net
@@ -115,6 +115,18 @@ void server_probe::setup_metrics(
           [this] { return _produce_bad_create_time; },
           sm::description("number of produce requests with timestamps too far "
                           "in the future or in the past")),
+        sm::make_counter(
+          "output_writes",
+          [this] { return _output_stream_stats.writes; },
+          sm::description(ssx::sformat(
+            "{}: Number of responses written to connections", proto))),
+        sm::make_counter(
+          "output_flushes",
+          [this] { return _output_stream_stats.flushes; },
+          sm::description(ssx::sformat(
+            "{}: Number of flushes of the connections, the ratio of writes "
+            "to flushes is the number of responses sent per write call",
+            proto))),
       },
       {},
       {sm::shard_label});
@@ -263,7 +263,10 @@ ss::future<ss::stop_iteration> server::accept_finish(
       ar.remote_address,
       *_probe,
       cfg.stream_recv_buf,
-      tls_enabled);
+      cfg.stream_recv_buf_min,
+      cfg.stream_send_buf,
+      tls_enabled,
+      cfg.output_cork_delay);
     vlog(
       _log.trace,
       "{} - Incoming connection from {} on \"{}\"",
@@ -326,6 +329,33 @@ ss::future<> server::stop() {
     return wait_for_shutdown();
 }
 
+std::optional<ss::socket_address>
+server::shed_connection(ss::lowres_clock::duration min_idle) {
+    net::connection* busiest = nullptr;
+    double busiest_rate = 0;
+    for (auto& c : _connections) {
+        if (c.idle_for() < min_idle) {
+            continue;
+        }
+        const auto rate = c.bytes_rate();
+        if (busiest == nullptr || rate > busiest_rate) {
+            busiest = &c;
+            busiest_rate = rate;
+        }
+    }
+    if (busiest == nullptr) {
+        return std::nullopt;
+    }
+    vlog(
+      _log.debug,
+      "{} - Shedding connection from {} with {} bytes/s",
+      name(),
+      busiest->addr,
+      busiest_rate);
+    busiest->shutdown_input();
+    return busiest->addr;
+}
+
 void server::setup_metrics() {
     namespace sm = ss::metrics;
     _metrics.add_group(
@@ -377,7 +407,10 @@ std::ostream& operator<<(std::ostream& o, const server_configuration& c) {
       << ", listen_backlog:" << c.listen_backlog
       << ", tcp_recv_buf:" << c.tcp_recv_buf
       << ", tcp_send_buf:" << c.tcp_send_buf
-      << ", stream_recv_buf:" << c.stream_recv_buf;
+      << ", stream_recv_buf:" << c.stream_recv_buf
+      << ", stream_recv_buf_min:" << c.stream_recv_buf_min
+      << ", stream_send_buf:" << c.stream_send_buf
+      << ", output_cork_delay:" << c.output_cork_delay.count() << "us";
     return o << "}";
 }
 
@@ -28,6 +28,7 @@
 
 #include <boost/intrusive/list.hpp>
 
+#include <chrono>
 #include <list>
 #include <optional>
 #include <type_traits>
@@ -85,6 +86,15 @@ struct server_configuration {
     std::optional<int> tcp_recv_buf;
     std::optional<int> tcp_send_buf;
     std::optional<size_t> stream_recv_buf;
+    // size a connection's receive buffer starts with and shrinks down to
+    std::optional<size_t> stream_recv_buf_min;
+    // size of the userspace send buffer of a connection. With TLS it is also
+    // the most plaintext handed to the session by a single write, which the
+    // session splits into records
+    std::optional<size_t> stream_send_buf;
+    // delay of the flush of responses written while no other response is
+    // being written, allows to coalesce small responses into a single write
+    std::chrono::microseconds output_cork_delay{0};
     net::metrics_disabled disable_metrics = net::metrics_disabled::no;
     net::public_metrics_disabled disable_public_metrics
       = net::public_metrics_disabled::no;
@@ -146,6 +156,19 @@ public:
     ss::abort_source& abort_source() { return _as; }
     bool abort_requested() const { return _as.abort_requested(); }
 
+    /**
+     * Shuts down the input of the connection with the highest bytes rate
+     * among those idle for at least min_idle. Its client reconnects and is
+     * placed again by the accept distribution of the listener.
+     *
+     * \return the address of the client, if a connection was shut down
+     */
+    std::optional<ss::socket_address>
+    shed_connection(ss::lowres_clock::duration min_idle);
+
+    /// Number of open connections
+    size_t connection_count() const { return _connections.size(); }
+
 private:
     struct listener {
         ss::sstring name;
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "metrics/metrics.h"
+#include "net/batched_output_stream.h"
 #include "seastarx.h"
 
 #include <seastar/core/metrics_registration.hh>
@@ -70,6 +71,13 @@ public:
         return _produce_bad_create_time;
     }
 
+    uint64_t in_bytes() const { return _in_bytes; }
+    uint64_t out_bytes() const { return _out_bytes; }
+
+    batched_output_stream::stats& output_stream_stats() {
+        return _output_stream_stats;
+    }
+
     void
     setup_metrics(metrics::internal_metric_groups& mgs, std::string_view proto);
 
@@ -92,6 +100,7 @@ private:
     uint32_t _declined_new_connections = 0;
     uint32_t _connections_wait_rate = 0;
     uint32_t _produce_bad_create_time = 0;
+    batched_output_stream::stats _output_stream_stats;
     friend std::ostream& operator<<(std::ostream& o, const server_probe& p);
 };
 
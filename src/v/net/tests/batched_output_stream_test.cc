@@ -0,0 +1,96 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "net/batched_output_stream.h"
+#include "seastarx.h"
+
+#include <seastar/core/scattered_message.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+struct sink_state {
+    size_t puts = 0;
+    size_t bytes = 0;
+};
+
+class counting_sink final : public ss::data_sink_impl {
+public:
+    explicit counting_sink(sink_state& s)
+      : _state(s) {}
+
+    ss::future<> put(ss::net::packet data) final {
+        ++_state.puts;
+        _state.bytes += data.len();
+        return ss::make_ready_future<>();
+    }
+    ss::future<> flush() final { return ss::make_ready_future<>(); }
+    ss::future<> close() final { return ss::make_ready_future<>(); }
+
+private:
+    sink_state& _state;
+};
+
+net::batched_output_stream make_stream(
+  sink_state& s,
+  std::chrono::microseconds cork_delay,
+  net::batched_output_stream::stats& stats) {
+    return net::batched_output_stream(
+      ss::output_stream<char>(
+        ss::data_sink(std::make_unique<counting_sink>(s)), 4096),
+      net::batched_output_stream::default_max_unflushed_bytes,
+      cork_delay,
+      &stats);
+}
+
+ss::scattered_message<char> make_message() {
+    ss::scattered_message<char> msg;
+    msg.append(ss::sstring("response"));
+    return msg;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(flush_every_last_writer) {
+    sink_state state;
+    net::batched_output_stream::stats stats;
+    auto out = make_stream(state, 0us, stats);
+    for (int i = 0; i < 10; ++i) {
+        BOOST_REQUIRE(out.write(make_message()).get());
+    }
+    BOOST_REQUIRE_EQUAL(stats.writes, 10);
+    BOOST_REQUIRE_EQUAL(stats.flushes, 10);
+    BOOST_REQUIRE_EQUAL(state.puts, 10);
+    out.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(cork_delay_coalesces_writes) {
+    sink_state state;
+    net::batched_output_stream::stats stats;
+    auto out = make_stream(state, 10ms, stats);
+    for (int i = 0; i < 10; ++i) {
+        BOOST_REQUIRE(!out.write(make_message()).get());
+    }
+    BOOST_REQUIRE_EQUAL(stats.writes, 10);
+    BOOST_REQUIRE_EQUAL(stats.flushes, 0);
+    BOOST_REQUIRE_EQUAL(state.bytes, 0);
+
+    ss::sleep(50ms).get();
+    BOOST_REQUIRE_EQUAL(stats.flushes, 1);
+    BOOST_REQUIRE_EQUAL(state.puts, 1);
+    BOOST_REQUIRE_EQUAL(state.bytes, 10 * make_message().size());
+    out.stop().get();
+}
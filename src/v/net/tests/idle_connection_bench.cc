@@ -0,0 +1,109 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "net/connection.h"
+#include "net/server_probe.h"
+#include "seastarx.h"
+
+#include <seastar/core/future-util.hh>
+#include <seastar/core/memory.hh>
+#include <seastar/core/reactor.hh>
+#include <seastar/net/api.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <boost/intrusive/list.hpp>
+#include <fmt/core.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+
+/*
+ * Opens the given number of loopback connections, each of them waiting for a
+ * request like an idle Kafka client connection, and prints the memory
+ * allocated per connection.
+ */
+ss::future<size_t>
+run_test(size_t connections, std::optional<size_t> min_buffer_size) {
+    ss::listen_options lo;
+    lo.reuse_address = true;
+    auto listener = ss::engine().listen(
+      ss::socket_address(ss::ipv4_addr("127.0.0.1", 0)), lo);
+    const auto addr = listener.local_address();
+
+    boost::intrusive::list<net::connection> hook;
+    net::server_probe probe;
+    std::vector<ss::connected_socket> clients;
+    std::vector<ss::lw_shared_ptr<net::connection>> conns;
+    std::vector<ss::future<ss::temporary_buffer<char>>> reads;
+    clients.reserve(connections);
+    conns.reserve(connections);
+    reads.reserve(connections);
+
+    const auto before = ss::memory::stats().allocated_memory();
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < connections; ++i) {
+        clients.push_back(co_await ss::connect(addr));
+        auto ar = co_await listener.accept();
+        conns.push_back(ss::make_lw_shared<net::connection>(
+          hook,
+          "bench",
+          std::move(ar.connection),
+          ar.remote_address,
+          probe,
+          std::nullopt,
+          min_buffer_size,
+          std::nullopt,
+          false));
+        reads.push_back(conns.back()->input().read());
+    }
+    perf_tests::stop_measuring_time();
+    const auto after = ss::memory::stats().allocated_memory();
+
+    fmt::print(
+      "{} idle connections, min receive buffer {}: {} bytes per connection\n",
+      connections,
+      min_buffer_size ? fmt::to_string(*min_buffer_size)
+                      : std::string("default"),
+      (after - before) / connections);
+
+    for (auto& c : conns) {
+        c->shutdown_input();
+    }
+    for (auto& c : clients) {
+        c.shutdown_output();
+        c.shutdown_input();
+    }
+    co_await ss::when_all(reads.begin(), reads.end()).discard_result();
+    for (auto& c : conns) {
+        co_await c->shutdown();
+    }
+    listener.abort_accept();
+    co_return connections;
+}
+
+} // namespace
+
+struct idle_connection_bench {};
+
+PERF_TEST_C(idle_connection_bench, default_buffer) {
+    co_return co_await run_test(1000, std::nullopt);
+}
+
+PERF_TEST_C(idle_connection_bench, min_buffer_1k) {
+    co_return co_await run_test(1000, 1024);
+}
+
+PERF_TEST_C(idle_connection_bench, min_buffer_512) {
+    co_return co_await run_test(1000, 512);
+}
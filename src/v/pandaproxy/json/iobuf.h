@@ -16,11 +16,13 @@
 #include "json/reader.h"
 #include "json/stream.h"
 #include "json/stringbuffer.h"
+#include "json/types.h"
 #include "json/writer.h"
 #include "pandaproxy/json/types.h"
 #include "utils/base64.h"
 
 #include <seastar/core/loop.hh>
+#include <seastar/core/sstring.hh>
 
 #include <optional>
 
@@ -84,8 +86,13 @@ public:
         if (buf.empty()) {
             return w.Null();
         }
-        // TODO Ben: Implement custom OutputStream to prevent this linearization
-        return w.String(iobuf_to_base64(buf));
+        // Encoded in place of the quoted value: base64 needs no escaping
+        const auto capacity = base64_encode_capacity(buf.size_bytes());
+        ss::sstring quoted(ss::sstring::initialized_later{}, capacity + 2);
+        quoted[0] = '"';
+        auto len = iobuf_to_base64(buf, quoted.data() + 1);
+        quoted[len + 1] = '"';
+        return w.RawValue(quoted.data(), len + 2, ::json::Type::kStringType);
     };
 
     bool encode_json(::json::Writer<::json::StringBuffer>& w, iobuf buf) {
@@ -91,6 +91,45 @@ private:
     model::offset _base_offset;
 };
 
+namespace detail {
+
+/// Serializes the records of \p batch, calling \p flush after each of them
+template<typename Flush>
+void rjson_serialize_batch(
+  ::json::Writer<::json::StringBuffer>& w,
+  serialization_format fmt,
+  model::topic_partition_view tpv,
+  model::record_batch batch,
+  Flush& flush) {
+    if (batch.header().attrs.is_control()) {
+        return;
+    }
+
+    auto rjs = rjson_serialize_impl<model::record>(
+      fmt, tpv, batch.base_offset());
+
+    if (batch.compressed()) {
+        batch = storage::internal::maybe_decompress_batch_sync(batch);
+    }
+
+    batch.for_each_record([&rjs, &w, &flush](model::record record) {
+        auto offset = record.offset_delta() + rjs.base_offset()();
+        if (!rjs(w, std::move(record))) {
+            throw serialize_error(
+              make_error_code(error_code::unable_to_serialize),
+              fmt::format(
+                "Unable to serialize record at offset {} in "
+                "topic:partition {}:{}",
+                offset,
+                rjs.tpv().topic(),
+                rjs.tpv().partition()));
+        }
+        flush();
+    });
+}
+
+} // namespace detail
+
 template<>
 class rjson_serialize_impl<kafka::fetch_response> {
 public:
@@ -99,6 +138,21 @@ public:
 
     bool operator()(
       ::json::Writer<::json::StringBuffer>& w, kafka::fetch_response&& res) {
+        auto flush = [] {};
+        return serialize(w, std::move(res), flush);
+    }
+
+    bool operator()(rjson_chunked_writer& w, kafka::fetch_response&& res) {
+        auto flush = [&w] { w.maybe_flush(); };
+        return serialize(w.writer(), std::move(res), flush);
+    }
+
+private:
+    template<typename Flush>
+    bool serialize(
+      ::json::Writer<::json::StringBuffer>& w,
+      kafka::fetch_response&& res,
+      Flush& flush) {
         // Eager check for errors
         for (auto& v : res) {
             if (v.partition_response->error_code != kafka::error_code::none) {
@@ -113,43 +167,65 @@ public:
               v.partition->name, r.partition_index);
             while (r.records && !r.records->empty()) {
                 auto adapter = r.records->consume_batch();
-                if (
-                  !adapter.batch
-                  || adapter.batch->header().attrs.is_control()) {
-                    continue;
+                if (adapter.batch) {
+                    detail::rjson_serialize_batch(
+                      w, _fmt, tpv, std::move(*adapter.batch), flush);
                 }
+            }
+        }
+        w.EndArray();
 
-                auto rjs = rjson_serialize_impl<model::record>(
-                  _fmt, tpv, adapter.batch->base_offset());
+        return true;
+    }
 
-                auto batch = std::move(*adapter.batch);
+    serialization_format _fmt;
+};
 
-                if (batch.compressed()) {
-                    batch = storage::internal::maybe_decompress_batch_sync(
-                      batch);
-                }
+/// The batches of a partition read without going through the kafka protocol
+struct partition_batches {
+    model::topic_partition tp;
+    kafka::error_code error{kafka::error_code::none};
+    model::record_batch_reader::data_t batches;
+};
 
-                batch.for_each_record([&rjs, &w](model::record record) {
-                    auto offset = record.offset_delta() + rjs.base_offset()();
-                    if (!rjs(w, std::move(record))) {
-                        throw serialize_error(
-                          make_error_code(error_code::unable_to_serialize),
-                          fmt::format(
-                            "Unable to serialize record at offset {} in "
-                            "topic:partition {}:{}",
-                            offset,
-                            rjs.tpv().topic(),
-                            rjs.tpv().partition()));
-                    }
-                });
-            }
+template<>
+class rjson_serialize_impl<partition_batches> {
+public:
+    explicit rjson_serialize_impl(serialization_format fmt)
+      : _fmt(fmt) {}
+
+    bool operator()(
+      ::json::Writer<::json::StringBuffer>& w, partition_batches&& res) {
+        auto flush = [] {};
+        return serialize(w, std::move(res), flush);
+    }
+
+    bool operator()(rjson_chunked_writer& w, partition_batches&& res) {
+        auto flush = [&w] { w.maybe_flush(); };
+        return serialize(w.writer(), std::move(res), flush);
+    }
+
+private:
+    template<typename Flush>
+    bool serialize(
+      ::json::Writer<::json::StringBuffer>& w,
+      partition_batches&& res,
+      Flush& flush) {
+        if (res.error != kafka::error_code::none) {
+            throw serialize_error(res.error);
+        }
+
+        w.StartArray();
+        model::topic_partition_view tpv(res.tp);
+        for (auto& batch : res.batches) {
+            detail::rjson_serialize_batch(
+              w, _fmt, tpv, std::move(batch), flush);
         }
         w.EndArray();
 
         return true;
     }
 
-private:
     serialization_format _fmt;
 };
 
@@ -25,6 +25,7 @@
 #include "tristate.h"
 
 #include <seastar/core/sstring.hh>
+#include <seastar/util/noncopyable_function.hh>
 
 namespace pandaproxy::json {
 
@@ -78,11 +79,19 @@ private:
 public:
     using Ch = typename Encoding::Ch;
     using rjson_parse_result = std::vector<kafka::client::record_essence>;
+    using record_sink
+      = ss::noncopyable_function<void(kafka::client::record_essence&&)>;
     rjson_parse_result result;
 
     explicit produce_request_handler(serialization_format fmt)
       : _fmt(fmt) {}
 
+    /// Hands each record to \p sink once it is parsed rather than collecting
+    /// them in the result, so that they need not be held all at once
+    produce_request_handler(serialization_format fmt, record_sink sink)
+      : _fmt(fmt)
+      , _sink(std::move(sink)) {}
+
     bool Null() {
         if (auto res = maybe_json(&json_writer::Null);
             res.has_optional_value()) {
@@ -234,6 +243,10 @@ public:
             return res.value();
         }
         if (state == state::record) {
+            if (_sink) {
+                _sink(std::move(result.back()));
+                result.pop_back();
+            }
             state = state::records;
             return true;
         }
@@ -263,6 +276,7 @@ public:
 private:
     ::json::StringBuffer _buf;
     std::optional<json_writer> _json_writer;
+    record_sink _sink;
 };
 
 inline void rjson_serialize(
@@ -9,6 +9,7 @@
 
 #include "pandaproxy/json/requests/fetch.h"
 
+#include "bytes/iobuf_parser.h"
 #include "json/stringbuffer.h"
 #include "json/writer.h"
 #include "kafka/client/test/utils.h"
@@ -97,3 +98,25 @@ SEASTAR_THREAD_TEST_CASE(test_produce_fetch_one) {
 
     BOOST_REQUIRE_EQUAL(str_buf.GetString(), expected);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_produce_fetch_chunked) {
+    std::vector<model::topic_partition> tps = {
+      {model::topic{"topic1"}, model::partition_id{1}},
+      {model::topic{"topic2"}, model::partition_id{2}},
+    };
+    auto fmt = ppj::serialization_format::binary_v2;
+
+    ::json::StringBuffer str_buf;
+    ::json::Writer<::json::StringBuffer> w(str_buf);
+    ppj::rjson_serialize_fmt(fmt)(
+      w, make_fetch_response(tps, model::offset{42}, 10));
+
+    // flushed after every record
+    ppj::rjson_chunked_writer chunked_w(1);
+    ppj::rjson_serialize_fmt(fmt)(
+      chunked_w, make_fetch_response(tps, model::offset{42}, 10));
+    auto chunked = std::move(chunked_w).release();
+
+    iobuf_parser p(std::move(chunked));
+    BOOST_REQUIRE_EQUAL(p.read_string(p.bytes_left()), str_buf.GetString());
+}
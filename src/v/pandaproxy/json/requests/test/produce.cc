@@ -96,6 +96,46 @@ SEASTAR_THREAD_TEST_CASE(test_produce_json_request) {
       value, R"({"integer":-5,"string":"str","array":["element"]})");
 }
 
+SEASTAR_THREAD_TEST_CASE(test_produce_request_record_sink) {
+    auto input = R"(
+      {
+        "records": [
+          {
+            "value": {"text": "vectorized"},
+            "partition": 0
+          },
+          {
+            "key": "k",
+            "value": "pandaproxy"
+          }
+        ]
+      })";
+
+    std::vector<kafka::client::record_essence> sunk;
+    auto records = ppj::rjson_parse(
+      input,
+      ppj::produce_request_handler<>(
+        ppj::serialization_format::json_v2,
+        [&sunk](kafka::client::record_essence&& r) {
+            sunk.push_back(std::move(r));
+        }));
+    BOOST_REQUIRE(records.empty());
+    BOOST_REQUIRE_EQUAL(sunk.size(), 2);
+
+    BOOST_REQUIRE_EQUAL(sunk[0].partition_id, model::partition_id(0));
+    BOOST_REQUIRE(!sunk[0].key);
+    auto parser = iobuf_parser(std::move(*sunk[0].value));
+    BOOST_REQUIRE_EQUAL(
+      parser.read_string(parser.bytes_left()), R"({"text":"vectorized"})");
+
+    BOOST_REQUIRE(!sunk[1].partition_id);
+    parser = iobuf_parser(std::move(*sunk[1].key));
+    BOOST_REQUIRE_EQUAL(parser.read_string(parser.bytes_left()), R"("k")");
+    parser = iobuf_parser(std::move(*sunk[1].value));
+    BOOST_REQUIRE_EQUAL(
+      parser.read_string(parser.bytes_left()), R"("pandaproxy")");
+}
+
 SEASTAR_THREAD_TEST_CASE(test_produce_invalid_json_request) {
     auto input = R"(
       {
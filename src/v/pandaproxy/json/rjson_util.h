@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
 #include "json/json.h"
 #include "json/prettywriter.h"
 #include "json/reader.h"
@@ -19,6 +20,7 @@
 #include "json/writer.h"
 #include "pandaproxy/json/exceptions.h"
 #include "pandaproxy/json/types.h"
+#include "units.h"
 
 #include <seastar/core/sstring.hh>
 
@@ -38,6 +40,46 @@ ss::sstring rjson_serialize(const T& v) {
     return ss::sstring(str_buf.GetString(), str_buf.GetSize());
 }
 
+/// Serializes to an iobuf rather than to a contiguous buffer: the writer's
+/// buffer is moved to the iobuf whenever it exceeds the chunk size at the
+/// points the serializer calls maybe_flush(), and then reused.
+class rjson_chunked_writer {
+public:
+    static constexpr size_t default_chunk_size = 128_KiB;
+
+    explicit rjson_chunked_writer(size_t chunk_size = default_chunk_size)
+      : _chunk_size(chunk_size) {}
+    rjson_chunked_writer(const rjson_chunked_writer&) = delete;
+    rjson_chunked_writer& operator=(const rjson_chunked_writer&) = delete;
+    rjson_chunked_writer(rjson_chunked_writer&&) = delete;
+    rjson_chunked_writer& operator=(rjson_chunked_writer&&) = delete;
+    ~rjson_chunked_writer() = default;
+
+    ::json::Writer<::json::StringBuffer>& writer() { return _writer; }
+
+    void maybe_flush() {
+        if (_str_buf.GetSize() >= _chunk_size) {
+            flush();
+        }
+    }
+
+    iobuf release() && {
+        flush();
+        return std::move(_out);
+    }
+
+private:
+    void flush() {
+        _out.append(_str_buf.GetString(), _str_buf.GetSize());
+        _str_buf.Clear();
+    }
+
+    size_t _chunk_size;
+    ::json::StringBuffer _str_buf;
+    ::json::Writer<::json::StringBuffer> _writer{_str_buf};
+    iobuf _out;
+};
+
 struct rjson_serialize_fmt_impl {
     explicit rjson_serialize_fmt_impl(serialization_format fmt)
       : fmt{fmt} {}
@@ -53,6 +95,11 @@ struct rjson_serialize_fmt_impl {
         return rjson_serialize_impl<std::remove_reference_t<T>>{fmt}(
           w, std::forward<T>(t));
     }
+    template<typename T>
+    bool operator()(rjson_chunked_writer& w, T&& t) {
+        return rjson_serialize_impl<std::remove_reference_t<T>>{fmt}(
+          w, std::forward<T>(t));
+    }
 };
 
 inline rjson_serialize_fmt_impl rjson_serialize_fmt(serialization_format fmt) {
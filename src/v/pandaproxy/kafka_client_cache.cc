@@ -11,11 +11,16 @@
 
 #include "pandaproxy/kafka_client_cache.h"
 
+#include "config/configuration.h"
 #include "pandaproxy/logger.h"
+#include "prometheus/prometheus_sanitize.h"
 #include "random/generators.h"
 #include "ssx/future-util.h"
 
 #include <seastar/core/loop.hh>
+#include <seastar/core/metrics.hh>
+
+#include <algorithm>
 
 #include <chrono>
 
@@ -85,15 +90,33 @@ std::pair<client_ptr, client_mu_ptr> kafka_client_cache::fetch_or_insert(
                 vlog(plog.debug, "Cache size reached, evicting {}", item.key);
                 inner_list.pop_back();
                 _evicted_items.push_back(std::move(item));
+                ++_stats.evictions;
             }
         }
 
-        vlog(plog.debug, "Make client for user {}", k);
-
-        client = make_client(user, authn_method);
-        client_mu = ss::make_lw_shared<mutex>();
+        auto it_evicted = std::find_if(
+          _evicted_items.begin(),
+          _evicted_items.end(),
+          [&k](const timestamped_user& item) { return item.key == k; });
+        if (it_evicted != _evicted_items.end()) {
+            // The evicted client is not stopped yet, take it back
+            vlog(plog.debug, "Reclaim evicted client for user {}", k);
+            client = it_evicted->client;
+            client_mu = it_evicted->client_mu;
+            _evicted_items.erase(it_evicted);
+            if (client->config().scram_password.value() != user.pass) {
+                client->config().scram_password.set_value(user.pass);
+            }
+            ++_stats.reclaims;
+        } else {
+            vlog(plog.debug, "Make client for user {}", k);
+            client = make_client(user, authn_method);
+            client_mu = ss::make_lw_shared<mutex>();
+            ++_stats.misses;
+        }
         inner_list.emplace_front(k, client, client_mu);
     } else {
+        ++_stats.hits;
         // If the passwords don't match, update the password on the client, so
         // that it can reconnect.
         if (it_hash->client->config().scram_password.value() != user.pass) {
@@ -120,8 +143,9 @@ std::pair<client_ptr, client_mu_ptr> kafka_client_cache::fetch_or_insert(
     return std::make_pair(client, client_mu);
 }
 
+/// Stops the clients of \p list matching \p pred, returns how many
 template<typename List, typename Pred>
-ss::future<> remove_client_if(List& list, Pred pred) {
+ss::future<size_t> remove_client_if(List& list, Pred pred) {
     std::list<typename List::value_type> remove;
     auto first = list.begin();
     auto last = list.end();
@@ -148,6 +172,7 @@ ss::future<> remove_client_if(List& list, Pred pred) {
           })
           .finally([client{item.client}]() {});
     }
+    co_return remove.size();
 }
 
 ss::future<> kafka_client_cache::clean_stale_clients() {
@@ -166,13 +191,15 @@ ss::future<> kafka_client_cache::clean_stale_clients() {
     auto guard = _gc_gate.hold();
 
     auto& inner_list = _cache.get<underlying_list>();
-    co_await remove_client_if(inner_list, is_expired(_keep_alive));
+    _stats.expirations += co_await remove_client_if(
+      inner_list, is_expired(_keep_alive));
 
     constexpr auto always = [](auto&&) { return true; };
     co_await remove_client_if(_evicted_items, always);
 }
 
 ss::future<> kafka_client_cache::start() {
+    setup_metrics();
     _gc_timer.arm(gc_timer_period);
     return ss::now();
 }
@@ -180,6 +207,7 @@ ss::future<> kafka_client_cache::start() {
 ss::future<> kafka_client_cache::stop() {
     co_await _gc_gate.close();
     _gc_timer.cancel();
+    _metrics.clear();
 
     constexpr auto always = [](auto&&) { return true; };
     auto& inner_list = _cache.get<underlying_list>();
@@ -190,4 +218,41 @@ ss::future<> kafka_client_cache::stop() {
 size_t kafka_client_cache::size() const { return _cache.size(); }
 size_t kafka_client_cache::max_size() const { return _cache_max_size; }
 
+void kafka_client_cache::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("pandaproxy:client_cache"),
+      {
+        sm::make_gauge(
+          "clients",
+          [this] { return _cache.size(); },
+          sm::description("Kafka clients of the authenticated users cached")),
+        sm::make_counter(
+          "hits",
+          [this] { return _stats.hits; },
+          sm::description("Requests served by a cached kafka client")),
+        sm::make_counter(
+          "misses",
+          [this] { return _stats.misses; },
+          sm::description("Requests for which a kafka client was created")),
+        sm::make_counter(
+          "reclaims",
+          [this] { return _stats.reclaims; },
+          sm::description(
+            "Requests served by an evicted kafka client not yet stopped")),
+        sm::make_counter(
+          "evictions",
+          [this] { return _stats.evictions; },
+          sm::description("Kafka clients evicted as the cache was full")),
+        sm::make_counter(
+          "expirations",
+          [this] { return _stats.expirations; },
+          sm::description("Kafka clients removed after the keep alive")),
+      });
+}
+
 } // namespace pandaproxy
@@ -11,6 +11,7 @@
 
 #pragma once
 #include "config/rest_authn_endpoint.h"
+#include "metrics/metrics.h"
 #include "pandaproxy/types.h"
 #include "utils/mutex.h"
 
@@ -34,8 +35,25 @@ namespace pandaproxy {
 // frequency where the most recently used client is at the front.
 // When the cache is full remove the client from the end of the
 // list. The hash is for constant time look-ups of the kafka clients.
+//
+// The evicted clients are only stopped by the next clean up: a user evicted
+// in the meantime gets its client, with its connections and metadata, back
+// rather than a new one.
 class kafka_client_cache {
 public:
+    struct stats {
+        // requests for a user with a cached client
+        uint64_t hits{0};
+        // requests for a user whose client was created
+        uint64_t misses{0};
+        // requests for a user whose evicted client was not yet stopped
+        uint64_t reclaims{0};
+        // clients evicted because the cache is full
+        uint64_t evictions{0};
+        // clients removed after the keep alive
+        uint64_t expirations{0};
+    };
+
     kafka_client_cache(
       YAML::Node const& cfg,
       size_t max_size,
@@ -70,6 +88,7 @@ public:
 
     size_t size() const;
     size_t max_size() const;
+    const stats& get_stats() const { return _stats; }
 
 protected:
     std::pair<client_ptr, client_mu_ptr>
@@ -94,6 +113,8 @@ private:
           std::hash<ss::sstring>,
           std::equal_to<>>>>;
 
+    void setup_metrics();
+
     kafka::client::configuration _config;
     size_t _cache_max_size;
     std::chrono::milliseconds _keep_alive;
@@ -102,5 +123,7 @@ private:
     ss::timer<ss::lowres_clock> _gc_timer;
     ss::gate _gc_gate;
     mutex _gc_lock;
+    stats _stats;
+    metrics::internal_metric_groups _metrics;
 };
 } // namespace pandaproxy
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
+#include "bytes/iostream.h"
 #include "kafka/client/exceptions.h"
 #include "kafka/protocol/exceptions.h"
 #include "pandaproxy/error.h"
@@ -22,7 +24,9 @@
 #include "pandaproxy/schema_registry/exceptions.h"
 #include "seastarx.h"
 
+#include <seastar/core/do_with.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/iostream.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/http/exception.hh>
 #include <seastar/http/reply.hh>
@@ -66,6 +70,20 @@ inline std::unique_ptr<ss::http::reply> reply_unavailable() {
     return rep;
 }
 
+/// Writes \p body to the connection in chunks, rather than linearizing it
+/// into the reply's content
+inline void write_body(ss::http::reply& rep, iobuf body) {
+    rep.write_body(
+      "json",
+      [body = std::move(body)](ss::output_stream<char>&& os) mutable {
+          return ss::do_with(
+            std::move(os), [body = std::move(body)](auto& os) mutable {
+                return write_iobuf_to_output_stream(std::move(body), os)
+                  .finally([&os] { return os.close(); });
+            });
+      });
+}
+
 inline std::unique_ptr<ss::http::reply>
 errored_body(std::error_condition ec, ss::sstring msg) {
     pandaproxy::json::error_body body{.ec = ec, .message = std::move(msg)};
@@ -85,5 +85,14 @@ configuration::configuration()
               msg = ss::sstring{"Client keep alive must be greater than 0"};
           }
           return msg;
-      }) {}
+      })
+  , local_data_path_enabled(
+      *this,
+      "local_data_path_enabled",
+      "Produce to and fetch from the partitions led by this broker in process "
+      "rather than through the kafka client. Only used by the listeners "
+      "without authentication, with the kafka audit and schema id validation "
+      "disabled",
+      {},
+      false) {}
 } // namespace pandaproxy::rest
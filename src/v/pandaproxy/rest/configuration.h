@@ -38,6 +38,7 @@ struct configuration final : public config::config_store {
     config::property<std::chrono::milliseconds> consumer_instance_timeout;
     config::property<size_t> client_cache_max_size;
     config::property<std::chrono::milliseconds> client_keep_alive;
+    config::property<bool> local_data_path_enabled;
 
     configuration();
     explicit configuration(const YAML::Node& cfg);
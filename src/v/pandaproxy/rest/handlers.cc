@@ -154,27 +154,89 @@ get_topics_records(server::request_t rq, server::reply_t rp) {
       timeout,
       max_bytes);
 
+    if (rq.service().use_local_data_path(rq.authn_method)) {
+        auto json_rslt = co_await rq.service().data_path().fetch(
+          tp,
+          offset,
+          max_bytes,
+          timeout,
+          [res_fmt](ppj::partition_batches res) {
+              ppj::rjson_chunked_writer w;
+              ppj::rjson_serialize_fmt(res_fmt)(w, std::move(res));
+              return std::move(w).release();
+          });
+        if (json_rslt) {
+            write_body(*rp.rep, std::move(*json_rslt));
+            rp.mime_type = res_fmt;
+            co_return rp;
+        }
+    }
+
     co_return co_await rq
       .dispatch([offset, timeout, max_bytes, res_fmt, tp{std::move(tp)}](
                   kafka::client::client& client) mutable {
           return client
             .fetch_partition(std::move(tp), offset, max_bytes, timeout)
             .then([res_fmt](kafka::fetch_response res) {
-                ::json::StringBuffer str_buf;
-                ::json::Writer<::json::StringBuffer> w(str_buf);
-
+                ppj::rjson_chunked_writer w;
                 ppj::rjson_serialize_fmt(res_fmt)(w, std::move(res));
-                // TODO Ben: Prevent this linearization
-                return ss::make_ready_future<ss::sstring>(str_buf.GetString());
+                return std::move(w).release();
             });
       })
-      .then([res_fmt, rp = std::move(rp)](ss::sstring json_rslt) mutable {
-          rp.rep->write_body("json", json_rslt);
+      .then([res_fmt, rp = std::move(rp)](iobuf json_rslt) mutable {
+          write_body(*rp.rep, std::move(json_rslt));
           rp.mime_type = res_fmt;
           return std::move(rp);
       });
 }
 
+/// Produces the records of the partitions led by this broker in process,
+/// those of the other partitions with the kafka client
+static ss::future<server::reply_t> post_topics_name_local(
+  server::request_t rq,
+  server::reply_t rp,
+  model::topic topic,
+  json::serialization_format req_fmt,
+  json::serialization_format res_fmt) {
+    auto& data_path = rq.service().data_path();
+    local_data_path::produce_result res;
+    if (auto batches = data_path.make_topic_batches(topic); batches) {
+        // the records are built into batches as they are parsed
+        ppj::rjson_parse(
+          rq.req->content.data(),
+          ppj::produce_request_handler(
+            req_fmt, [&batches](kafka::client::record_essence&& r) {
+                batches->add(std::move(r));
+            }));
+        rq.req.reset();
+        res = co_await data_path.produce(
+          std::move(*batches),
+          rq.service().client().local().config().produce_ack_level());
+    } else {
+        res.remaining = ppj::rjson_parse(
+          rq.req->content.data(), ppj::produce_request_handler(req_fmt));
+        rq.req.reset();
+    }
+
+    kafka::produce_response::topic response{.name = topic};
+    response.partitions = std::move(res.partitions);
+    if (!res.remaining.empty()) {
+        auto remote = co_await rq.dispatch(
+          [topic, remaining{std::move(res.remaining)}](
+            kafka::client::client& client) mutable {
+              return client.produce_records(topic, std::move(remaining));
+          });
+        for (auto& p : remote.data.responses[0].partitions) {
+            response.partitions.push_back(std::move(p));
+        }
+    }
+
+    auto json_rslt = ppj::rjson_serialize(response);
+    rp.rep->write_body("json", json_rslt);
+    rp.mime_type = res_fmt;
+    co_return rp;
+}
+
 ss::future<server::reply_t>
 post_topics_name(server::request_t rq, server::reply_t rp) {
     auto req_fmt = parse::content_type_header(
@@ -189,6 +251,11 @@ post_topics_name(server::request_t rq, server::reply_t rp) {
 
     vlog(plog.debug, "get_topics_name: topic: {}", topic);
 
+    if (rq.service().use_local_data_path(rq.authn_method)) {
+        co_return co_await post_topics_name_local(
+          std::move(rq), std::move(rp), std::move(topic), req_fmt, res_fmt);
+    }
+
     co_return co_await rq.dispatch(
       [data{rq.req->content.data()},
        topic,
@@ -410,14 +477,9 @@ consumer_fetch(server::request_t rq, server::reply_t rp) {
 
           return client.consumer_fetch(group_id, name, timeout, max_bytes)
             .then([res_fmt, rp{std::move(rp)}](auto res) mutable {
-                ::json::StringBuffer str_buf;
-                ::json::Writer<::json::StringBuffer> w(str_buf);
-
+                ppj::rjson_chunked_writer w;
                 ppj::rjson_serialize_fmt(res_fmt)(w, std::move(res));
-
-                // TODO Ben: Prevent this linearization
-                ss::sstring json_rslt = str_buf.GetString();
-                rp.rep->write_body("json", json_rslt);
+                write_body(*rp.rep, std::move(w).release());
                 rp.mime_type = res_fmt;
                 return std::move(rp);
             });
@@ -0,0 +1,327 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "pandaproxy/rest/local_data_path.h"
+
+#include "cluster/controller.h"
+#include "cluster/errc.h"
+#include "cluster/partition_leaders_table.h"
+#include "cluster/partition_manager.h"
+#include "cluster/shard_table.h"
+#include "cluster/topic_table.h"
+#include "config/configuration.h"
+#include "kafka/server/partition_proxy.h"
+#include "model/namespace.h"
+#include "model/record_batch_reader.h"
+#include "pandaproxy/logger.h"
+#include "raft/errc.h"
+#include "random/generators.h"
+#include "resource_mgmt/io_priority.h"
+#include "storage/record_batch_builder.h"
+#include "vlog.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/coroutine/parallel_for_each.hh>
+
+namespace pandaproxy::rest {
+
+namespace {
+
+constexpr auto produce_timeout = std::chrono::seconds(10);
+// bytes of a record, or of a header, besides its key and value, at most
+constexpr size_t record_overhead = 32;
+
+raft::replicate_options acks_to_replicate_options(int16_t acks) {
+    switch (acks) {
+    case 0:
+        return {raft::consistency_level::no_ack, produce_timeout};
+    case 1:
+        return {raft::consistency_level::leader_ack, produce_timeout};
+    default:
+        return {raft::consistency_level::quorum_ack, produce_timeout};
+    }
+}
+
+kafka::error_code map_produce_error(std::error_code ec) {
+    if (ec.category() == kafka::error_category()) {
+        return static_cast<kafka::error_code>(ec.value());
+    }
+    if (ec.category() == raft::error_category()) {
+        switch (static_cast<raft::errc>(ec.value())) {
+        case raft::errc::not_leader:
+        case raft::errc::replicated_entry_truncated:
+            return kafka::error_code::not_leader_for_partition;
+        default:
+            return kafka::error_code::request_timed_out;
+        }
+    }
+    if (
+      ec.category() == cluster::error_category()
+      && static_cast<cluster::errc>(ec.value()) == cluster::errc::not_leader) {
+        return kafka::error_code::not_leader_for_partition;
+    }
+    return kafka::error_code::request_timed_out;
+}
+
+/// Replicates the batches of \p rdr, on the partition's shard
+ss::future<kafka::produce_response::partition> replicate(
+  cluster::partition_manager& mgr,
+  model::ntp ntp,
+  model::record_batch_reader rdr,
+  int32_t record_count,
+  raft::replicate_options opts) {
+    kafka::produce_response::partition res{
+      .partition_index = ntp.tp.partition};
+    auto pp = kafka::make_partition_proxy(ntp, mgr);
+    if (!pp || !pp->is_leader()) {
+        res.error_code = kafka::error_code::not_leader_for_partition;
+        co_return res;
+    }
+    auto r = co_await pp->replicate(std::move(rdr), opts);
+    if (r.has_error()) {
+        res.error_code = map_produce_error(r.error());
+        co_return res;
+    }
+    // mirrors the produce handler: the base offset of the first batch
+    res.base_offset = model::offset(r.value() - (record_count - 1));
+    co_return res;
+}
+
+/// Reads from \p offset, on the partition's shard. Polls for records until
+/// \p deadline when there are none yet.
+ss::future<std::optional<json::partition_batches>> read(
+  cluster::partition_manager& mgr,
+  model::ntp ntp,
+  model::offset offset,
+  int32_t max_bytes,
+  model::timeout_clock::time_point deadline) {
+    json::partition_batches res{.tp = ntp.tp};
+    while (true) {
+        auto pp = kafka::make_partition_proxy(ntp, mgr);
+        if (!pp || !pp->is_leader()) {
+            co_return std::nullopt;
+        }
+        auto ec = co_await pp->validate_fetch_offset(offset, false, deadline);
+        if (ec != kafka::error_code::none) {
+            res.error = ec;
+            co_return res;
+        }
+        auto max_offset = model::prev_offset(pp->high_watermark());
+        if (offset <= max_offset) {
+            storage::log_reader_config cfg(
+              offset,
+              max_offset,
+              0,
+              max_bytes,
+              kafka_read_priority(),
+              std::nullopt,
+              std::nullopt,
+              std::nullopt);
+            auto rdr = co_await pp->make_reader(cfg);
+            res.batches = co_await model::consume_reader_to_memory(
+              std::move(rdr.reader), deadline);
+            co_return res;
+        }
+
+        auto now = model::timeout_clock::now();
+        if (now >= deadline) {
+            co_return res;
+        }
+        co_await ss::sleep(std::min<model::timeout_clock::duration>(
+          config::shard_local_cfg().fetch_reads_debounce_timeout(),
+          deadline - now));
+    }
+}
+
+} // namespace
+
+std::optional<ss::shard_id>
+local_data_path::local_leader_shard(const model::ntp& ntp) const {
+    auto leader = _controller->get_partition_leaders().local().get_leader(ntp);
+    if (!leader || *leader != _controller->self()) {
+        return std::nullopt;
+    }
+    return _controller->get_shard_table().local().shard_for(ntp);
+}
+
+void local_data_path::topic_batches::add(
+  kafka::client::record_essence&& record) {
+    // records are assigned to a partition as the kafka client would
+    if (!record.partition_id) {
+        record.partition_id = _partitioner(record, _partition_count);
+    }
+    model::ntp ntp(model::kafka_namespace, _topic, *record.partition_id);
+    if (!_parent.local_leader_shard(ntp)) {
+        _remaining.push_back(std::move(record));
+        return;
+    }
+
+    size_t bytes = record_overhead
+                   + (record.key ? record.key->size_bytes() : 0)
+                   + (record.value ? record.value->size_bytes() : 0);
+    for (const auto& h : record.headers) {
+        bytes += record_overhead + h.key().size_bytes()
+                 + h.value().size_bytes();
+    }
+
+    auto& p = _partitions[*record.partition_id];
+    if (p.builder && p.builder_bytes + bytes > _batch_max_bytes) {
+        seal(p);
+    }
+    if (!p.builder) {
+        p.builder.emplace(
+          model::record_batch_type::raft_data, model::offset(0));
+        p.builder_bytes = model::packed_record_batch_header_size;
+    }
+    p.builder->add_raw_kw(
+      std::move(record.key).value_or(iobuf{}),
+      std::move(record.value),
+      std::move(record.headers));
+    p.builder_bytes += bytes;
+}
+
+void local_data_path::topic_batches::seal(partition& p) {
+    p.batches.push_back(std::move(*p.builder).build());
+    p.builder.reset();
+    p.builder_bytes = 0;
+}
+
+std::optional<local_data_path::topic_batches>
+local_data_path::make_topic_batches(const model::topic& topic) {
+    model::topic_namespace_view tp_ns{model::kafka_namespace, topic};
+    auto topic_cfg = _controller->get_topics_state().local().get_topic_cfg(
+      tp_ns);
+    if (!topic_cfg) {
+        return std::nullopt;
+    }
+
+    auto p_it = _partitioners.find(topic);
+    if (p_it == _partitioners.end()) {
+        const auto initial_partition_id = model::partition_id{
+          random_generators::get_int<model::partition_id::type>(
+            topic_cfg->partition_count)};
+        p_it = _partitioners
+                 .emplace(
+                   topic,
+                   kafka::client::default_partitioner(initial_partition_id))
+                 .first;
+    }
+    return topic_batches(
+      *this,
+      topic,
+      topic_cfg->partition_count,
+      topic_cfg->properties.batch_max_bytes.value_or(
+        config::shard_local_cfg().kafka_batch_max_bytes()),
+      p_it->second);
+}
+
+ss::future<local_data_path::produce_result>
+local_data_path::produce(topic_batches batches, int16_t acks) {
+    produce_result result{.remaining = std::move(batches._remaining)};
+    model::topic_namespace_view tp_ns{model::kafka_namespace, batches._topic};
+    auto topic_cfg = _controller->get_topics_state().local().get_topic_cfg(
+      tp_ns);
+    const auto timestamp_type = topic_cfg
+                                  ? topic_cfg->properties.timestamp_type
+                                  : std::nullopt;
+    const bool append_time
+      = timestamp_type.value_or(
+          config::shard_local_cfg().log_message_timestamp_type())
+        == model::timestamp_type::append_time;
+    const auto opts = acks_to_replicate_options(acks);
+
+    co_await ss::coroutine::parallel_for_each(
+      batches._partitions, [&](auto& pb) -> ss::future<> {
+          auto& [p_id, partition] = pb;
+          if (partition.builder) {
+              batches.seal(partition);
+          }
+          int32_t record_count = 0;
+          for (auto& batch : partition.batches) {
+              if (
+                static_cast<uint32_t>(batch.size_bytes())
+                > batches._batch_max_bytes) {
+                  // a single record larger than the batches may be
+                  result.partitions.push_back(
+                    kafka::produce_response::partition{
+                      .partition_index = p_id,
+                      .error_code = kafka::error_code::message_too_large});
+                  co_return;
+              }
+              if (append_time) {
+                  batch.set_max_timestamp(
+                    model::timestamp_type::append_time,
+                    model::timestamp::now());
+              }
+              record_count += batch.record_count();
+          }
+
+          model::ntp ntp(model::kafka_namespace, batches._topic, p_id);
+          auto shard = local_leader_shard(ntp);
+          if (!shard) {
+              result.partitions.push_back(kafka::produce_response::partition{
+                .partition_index = p_id,
+                .error_code = kafka::error_code::not_leader_for_partition});
+              co_return;
+          }
+          auto rdr = model::make_foreign_memory_record_batch_reader(
+            std::move(partition.batches));
+          result.partitions.push_back(
+            co_await _controller->get_partition_manager().invoke_on(
+              *shard,
+              [ntp = std::move(ntp), rdr = std::move(rdr), record_count, opts](
+                cluster::partition_manager& mgr) mutable {
+                  return replicate(
+                    mgr, std::move(ntp), std::move(rdr), record_count, opts);
+              }));
+      });
+
+    vlog(
+      plog.trace,
+      "local produce: topic: {}, partitions: {}, remaining records: {}",
+      batches._topic,
+      result.partitions.size(),
+      result.remaining.size());
+    co_return result;
+}
+
+ss::future<std::optional<iobuf>> local_data_path::fetch(
+  model::topic_partition tp,
+  model::offset offset,
+  int32_t max_bytes,
+  std::chrono::milliseconds timeout,
+  fetch_serializer serializer) {
+    model::ntp ntp(model::kafka_namespace, std::move(tp.topic), tp.partition);
+    auto shard = local_leader_shard(ntp);
+    if (!shard) {
+        co_return std::nullopt;
+    }
+    auto deadline = model::timeout_clock::now() + timeout;
+    co_return co_await _controller->get_partition_manager().invoke_on(
+      *shard,
+      [ntp = std::move(ntp),
+       offset,
+       max_bytes,
+       deadline,
+       serializer = std::move(serializer)](
+        cluster::partition_manager& mgr) mutable {
+          return read(mgr, std::move(ntp), offset, max_bytes, deadline)
+            .then([serializer = std::move(serializer)](
+                    std::optional<json::partition_batches> res) mutable
+                  -> std::optional<iobuf> {
+                if (!res) {
+                    return std::nullopt;
+                }
+                return serializer(std::move(*res));
+            });
+      });
+}
+
+} // namespace pandaproxy::rest
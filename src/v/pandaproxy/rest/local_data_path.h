@@ -0,0 +1,131 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "cluster/fwd.h"
+#include "kafka/client/partitioners.h"
+#include "kafka/client/types.h"
+#include "kafka/protocol/produce.h"
+#include "model/fundamental.h"
+#include "model/record_batch_reader.h"
+#include "pandaproxy/json/requests/fetch.h"
+#include "seastarx.h"
+#include "storage/record_batch_builder.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <absl/container/node_hash_map.h>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace pandaproxy::rest {
+
+/**
+ * Produces to and fetches from the partitions led by this broker without
+ * going through the kafka client: the batches are handed to the partition's
+ * shard, skipping the encoding of the kafka requests, the loopback connection
+ * and the decoding of the responses.
+ *
+ * The kafka authorization, quotas and audit of the requests are skipped, it
+ * is therefore only used for the requests made as the proxy's own principal,
+ * see proxy::use_local_data_path(). The partitions led by other brokers are
+ * left to the kafka client.
+ */
+class local_data_path {
+public:
+    using fetch_serializer
+      = ss::noncopyable_function<iobuf(json::partition_batches)>;
+
+    /**
+     * Builds the batches of the records of a topic as they are parsed, so
+     * that they are serialized once and need not be held twice. The batches
+     * of a partition are sealed when they reach the topic's batch_max_bytes.
+     */
+    class topic_batches {
+    public:
+        void add(kafka::client::record_essence&& record);
+
+    private:
+        friend class local_data_path;
+
+        struct partition {
+            std::optional<storage::record_batch_builder> builder;
+            size_t builder_bytes{0};
+            model::record_batch_reader::data_t batches;
+        };
+
+        topic_batches(
+          local_data_path& parent,
+          model::topic topic,
+          int32_t partition_count,
+          uint32_t batch_max_bytes,
+          kafka::client::partitioner& partitioner)
+          : _parent(parent)
+          , _topic(std::move(topic))
+          , _partition_count(partition_count)
+          , _batch_max_bytes(batch_max_bytes)
+          , _partitioner(partitioner) {}
+
+        void seal(partition&);
+
+        local_data_path& _parent;
+        model::topic _topic;
+        int32_t _partition_count;
+        uint32_t _batch_max_bytes;
+        kafka::client::partitioner& _partitioner;
+        absl::node_hash_map<model::partition_id, partition> _partitions;
+        std::vector<kafka::client::record_essence> _remaining;
+    };
+
+    struct produce_result {
+        std::vector<kafka::produce_response::partition> partitions;
+        // the records of the partitions not led by this broker, to produce
+        // with the kafka client
+        std::vector<kafka::client::record_essence> remaining;
+    };
+
+    explicit local_data_path(cluster::controller* controller)
+      : _controller(controller) {}
+
+    /// The batches to add the records of \p topic to, nullopt when the topic
+    /// is unknown to this broker
+    std::optional<topic_batches> make_topic_batches(const model::topic& topic);
+
+    /// Produces the batches of the partitions led by this broker, with the
+    /// acks level of the kafka client
+    ss::future<produce_result> produce(topic_batches batches, int16_t acks);
+
+    /// Reads from \p offset of \p tp, waiting up to \p timeout for records
+    /// when there are none. The batches are serialized by \p serializer on
+    /// the partition's shard, nullopt when the partition is not led by this
+    /// broker.
+    ss::future<std::optional<iobuf>> fetch(
+      model::topic_partition tp,
+      model::offset offset,
+      int32_t max_bytes,
+      std::chrono::milliseconds timeout,
+      fetch_serializer serializer);
+
+private:
+    std::optional<ss::shard_id> local_leader_shard(const model::ntp&) const;
+
+    cluster::controller* _controller;
+    // the partitioners of the records without a partition, per topic
+    absl::node_hash_map<model::topic, kafka::client::partitioner> _partitioners;
+};
+
+} // namespace pandaproxy::rest
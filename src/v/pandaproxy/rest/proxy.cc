@@ -12,6 +12,7 @@
 #include "cluster/controller.h"
 #include "cluster/ephemeral_credential_frontend.h"
 #include "cluster/members_table.h"
+#include "config/configuration.h"
 #include "kafka/client/config_utils.h"
 #include "net/unresolved_address.h"
 #include "pandaproxy/api/api-doc/rest.json.hh"
@@ -21,6 +22,7 @@
 #include "pandaproxy/parsing/from_chars.h"
 #include "pandaproxy/rest/configuration.h"
 #include "pandaproxy/rest/handlers.h"
+#include "pandaproxy/schema_registry/schema_id_validation.h"
 #include "security/ephemeral_credential_store.h"
 
 #include <seastar/core/future-util.hh>
@@ -125,7 +127,8 @@ proxy::proxy(
       _ctx,
       json::serialization_format::application_json)
   , _ensure_started{[this]() { return do_start(); }}
-  , _controller(controller) {}
+  , _controller(controller)
+  , _data_path(controller) {}
 
 ss::future<> proxy::start() {
     _server.routes(get_proxy_routes(_gate, _ensure_started));
@@ -202,6 +205,26 @@ ss::future<> proxy::configure() {
       5s);
 }
 
+bool proxy::use_local_data_path(config::rest_authn_method authn_method) const {
+    if (
+      !_config.local_data_path_enabled() || _controller == nullptr
+      || authn_method != config::rest_authn_method::none) {
+        return false;
+    }
+    const auto& cfg = config::shard_local_cfg();
+    // the requests are made as the proxy's principal, which configure()
+    // allows everything on topics when authorization is enabled
+    const bool authz = cfg.kafka_enable_authorization().value_or(
+      cfg.enable_sasl());
+    if (authz && !_has_ephemeral_credentials) {
+        return false;
+    }
+    // the produce and fetch requests would have to be audited and validated
+    return !cfg.audit_enabled()
+           && cfg.enable_schema_id_validation()
+                == pandaproxy::schema_registry::schema_id_validation_mode::none;
+}
+
 ss::future<> proxy::mitigate_error(std::exception_ptr eptr) {
     if (_gate.is_closed()) {
         // Return so that the client doesn't try to mitigate.
@@ -13,7 +13,9 @@
 
 #include "cluster/fwd.h"
 #include "pandaproxy/fwd.h"
+#include "config/rest_authn_endpoint.h"
 #include "pandaproxy/rest/configuration.h"
+#include "pandaproxy/rest/local_data_path.h"
 #include "pandaproxy/server.h"
 #include "pandaproxy/util.h"
 #include "seastarx.h"
@@ -46,6 +48,10 @@ public:
     kafka::client::configuration& client_config();
     ss::sharded<kafka::client::client>& client() { return _client; }
     ss::sharded<kafka_client_cache>& client_cache() { return _client_cache; }
+    local_data_path& data_path() { return _data_path; }
+    /// Whether the requests authenticated with \p authn_method may bypass
+    /// the kafka client, see local_data_path
+    bool use_local_data_path(config::rest_authn_method authn_method) const;
     ss::future<> mitigate_error(std::exception_ptr);
 
 private:
@@ -63,6 +69,7 @@ private:
     server _server;
     one_shot _ensure_started;
     cluster::controller* _controller;
+    local_data_path _data_path;
     bool _has_ephemeral_credentials{false};
     bool _is_started{false};
 };
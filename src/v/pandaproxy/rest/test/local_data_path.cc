@@ -0,0 +1,124 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "http/client.h"
+#include "pandaproxy/rest/configuration.h"
+#include "pandaproxy/test/pandaproxy_fixture.h"
+#include "pandaproxy/test/utils.h"
+
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/status.hpp>
+#include <boost/beast/http/verb.hpp>
+#include <boost/test/tools/old/interface.hpp>
+
+namespace ppj = pandaproxy::json;
+
+FIXTURE_TEST(pandaproxy_local_data_path, pandaproxy_test_fixture) {
+    using namespace std::chrono_literals;
+
+    set_config("local_data_path_enabled", true);
+    set_client_config("retry_base_backoff_ms", 10ms);
+    set_client_config("produce_batch_delay_ms", 0ms);
+
+    info("Waiting for leadership");
+    wait_for_controller_leadership().get();
+
+    info("Connecting client");
+    auto client = make_proxy_client();
+    const ss::sstring produce_body(
+      R"({
+   "records":[
+      {
+         "value":"dmVjdG9yaXplZA==",
+         "partition":0
+      },
+      {
+         "value":"cGFuZGFwcm94eQ==",
+         "partition":0
+      }
+   ]
+})");
+
+    {
+        info("Produce without topic - left to the kafka client");
+        set_client_config("retries", size_t(0));
+        auto body = iobuf();
+        body.append(produce_body.data(), produce_body.size());
+        auto res = http_request(
+          client,
+          "/topics/t",
+          std::move(body),
+          boost::beast::http::verb::post,
+          ppj::serialization_format::binary_v2,
+          ppj::serialization_format::v2);
+
+        BOOST_REQUIRE_EQUAL(
+          res.headers.result(), boost::beast::http::status::ok);
+        BOOST_REQUIRE_EQUAL(
+          res.body,
+          R"({"offsets":[{"partition":0,"error_code":3,"offset":-1}]})");
+    }
+
+    info("Adding known topic");
+    auto tp = model::topic_partition(model::topic("t"), model::partition_id(0));
+    auto ntp = make_default_ntp(tp.topic, tp.partition);
+    add_topic(model::topic_namespace_view(ntp)).get();
+    wait_for_leader(ntp).get();
+
+    {
+        info("Produce to known topic in process");
+        set_client_config("retries", size_t(5));
+        auto body = iobuf();
+        body.append(produce_body.data(), produce_body.size());
+        auto res = http_request(
+          client,
+          "/topics/t",
+          std::move(body),
+          boost::beast::http::verb::post,
+          ppj::serialization_format::binary_v2,
+          ppj::serialization_format::v2);
+
+        BOOST_REQUIRE_EQUAL(
+          res.headers.result(), boost::beast::http::status::ok);
+        BOOST_REQUIRE_EQUAL(
+          res.body, R"({"offsets":[{"partition":0,"offset":0}]})");
+    }
+
+    {
+        info("Fetch offset 0 in process - expect offsets 0-1");
+        auto res = http_request(
+          client,
+          "/topics/t/partitions/0/"
+          "records?offset=0&max_bytes=1024&timeout=5000",
+          boost::beast::http::verb::get,
+          ppj::serialization_format::v2,
+          ppj::serialization_format::binary_v2);
+
+        BOOST_REQUIRE_EQUAL(
+          res.headers.result(), boost::beast::http::status::ok);
+        BOOST_REQUIRE_EQUAL(
+          res.body,
+          R"([{"topic":"t","key":null,"value":"dmVjdG9yaXplZA==","partition":0,"offset":0},{"topic":"t","key":null,"value":"cGFuZGFwcm94eQ==","partition":0,"offset":1}])");
+    }
+
+    {
+        info("Fetch past the end in process - expect no records");
+        auto res = http_request(
+          client,
+          "/topics/t/partitions/0/"
+          "records?offset=2&max_bytes=1024&timeout=100",
+          boost::beast::http::verb::get,
+          ppj::serialization_format::v2,
+          ppj::serialization_format::binary_v2);
+
+        BOOST_REQUIRE_EQUAL(
+          res.headers.result(), boost::beast::http::status::ok);
+        BOOST_REQUIRE_EQUAL(res.body, R"([])");
+    }
+}
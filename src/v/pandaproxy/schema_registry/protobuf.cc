@@ -16,6 +16,7 @@
 #include "pandaproxy/schema_registry/errors.h"
 #include "pandaproxy/schema_registry/sharded_store.h"
 #include "ssx/sformat.h"
+#include "units.h"
 #include "utils/base64.h"
 #include "vlog.h"
 
@@ -23,6 +24,10 @@
 
 #include <absl/container/flat_hash_set.h>
 #include <boost/algorithm/string/trim.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
 #include <confluent/meta.pb.h>
 #include <confluent/types/decimal.pb.h>
 #include <fmt/core.h>
@@ -63,6 +68,7 @@
 
 #include <string_view>
 #include <unordered_set>
+#include <utility>
 
 namespace pandaproxy::schema_registry {
 
@@ -250,6 +256,75 @@ private:
     pb::FileDescriptorProto _fdp;
 };
 
+///\brief MRU of the files parsed for the schemas and their references, so
+/// that the imports shared by many schemas are parsed once per shard rather
+/// than for every schema built with them.
+///
+/// The files are keyed by their name and definition, so they need not be
+/// invalidated: the references are resolved to their definition in the store
+/// before they are looked up.
+class parsed_file_cache {
+public:
+    static constexpr size_t max_bytes = 16_MiB;
+
+    const pb::FileDescriptorProto& parse(const canonical_schema& schema) {
+        auto& map = _cache.get<underlying_map>();
+        auto it = map.find(key_t{schema.sub()(), schema.def().raw()()});
+        if (it != map.end()) {
+            auto& list = _cache.get<underlying_list>();
+            list.relocate(list.begin(), _cache.project<underlying_list>(it));
+            return it->fdp;
+        }
+
+        parser p;
+        const auto& fdp = p.parse(schema);
+        auto& list = _cache.get<underlying_list>();
+        auto [e, _] = list.emplace_front(
+          key_t{schema.sub()(), schema.def().raw()()}, fdp);
+        _bytes += e->bytes;
+        // Keep the file just parsed, however large
+        while (_bytes > max_bytes && list.size() > 1) {
+            _bytes -= list.back().bytes;
+            list.pop_back();
+        }
+        return e->fdp;
+    }
+
+private:
+    struct underlying_list {};
+    struct underlying_map {};
+
+    using key_t = std::pair<ss::sstring, ss::sstring>;
+
+    struct entry {
+        entry(key_t key, const pb::FileDescriptorProto& fdp)
+          : key{std::move(key)}
+          , fdp{fdp}
+          , bytes{this->key.second.size() + this->fdp.SpaceUsedLong()} {}
+
+        key_t key;
+        pb::FileDescriptorProto fdp;
+        size_t bytes;
+    };
+
+    using cache_t = boost::multi_index::multi_index_container<
+      entry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        boost::multi_index::hashed_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::member<entry, key_t, &entry::key>,
+          absl::Hash<key_t>>>>;
+
+    cache_t _cache;
+    size_t _bytes{0};
+};
+
+const pb::FileDescriptorProto& parse_file(const canonical_schema& schema) {
+    static thread_local parsed_file_cache cache;
+    return cache.parse(schema);
+}
+
 ///\brief Build a FileDescriptor using the DescriptorPool.
 ///
 /// Dependencies are required to be in the DescriptorPool.
@@ -289,8 +364,7 @@ ss::future<const pb::FileDescriptor*> build_file_with_refs(
           canonical_schema{subject{ref.name}, std::move(dep.schema).def()});
     }
 
-    parser p;
-    co_return build_file(dp, p.parse(schema));
+    co_return build_file(dp, parse_file(schema));
 }
 
 ///\brief Import a schema in the DescriptorPool and return the FileDescriptor.
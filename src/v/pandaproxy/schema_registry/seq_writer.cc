@@ -77,9 +77,8 @@ ss::future<> seq_writer::wait_for(model::offset offset) {
 /// \return true if the write landed at `write_at`, else false
 ss::future<bool> seq_writer::produce_and_check(
   model::offset write_at, model::record_batch batch) {
-    // Because we rely on checking exactly where our message (singular) landed,
-    // only use this function with batches of a single message.
-    vassert(batch.record_count() == 1, "Only single-message batches allowed");
+    // The records of a batch land at consecutive offsets: checking where the
+    // first one landed is enough.
 
     kafka::partition_produce_response res
       = co_await _client.local().produce_record_batch(
@@ -128,63 +127,114 @@ void seq_writer::advance_offset_inner(model::offset offset) {
     }
 }
 
-ss::future<std::optional<schema_id>> seq_writer::do_write_subject_version(
-  subject_schema schema, model::offset write_at, seq_writer& seq) {
+ss::future<std::optional<std::vector<schema_id>>>
+seq_writer::do_write_subject_versions(
+  std::vector<subject_schema> schemas,
+  model::offset write_at,
+  seq_writer& seq) {
     // Check if store already contains this data: if
     // so, we do no I/O and return the schema ID.
-    auto projected = co_await seq._store.project_ids(schema).handle_exception(
+    auto projected = co_await seq._store.project_ids(schemas).handle_exception(
       [](std::exception_ptr e) {
           vlog(plog.debug, "write_subject_version: project_ids failed: {}", e);
-          return ss::make_exception_future<sharded_store::insert_result>(e);
+          return ss::make_exception_future<
+            std::vector<sharded_store::insert_result>>(e);
       });
 
-    if (!projected.inserted) {
-        vlog(plog.debug, "write_subject_version: no-op");
-        co_return projected.id;
-    } else {
+    std::vector<schema_id> ids;
+    ids.reserve(projected.size());
+    std::vector<std::pair<schema_key, canonical_schema_value>> records;
+    storage::record_batch_builder rb{
+      model::record_batch_type::raft_data, model::offset{0}};
+    for (size_t i = 0; i < schemas.size(); ++i) {
+        auto& schema = schemas[i];
+        const auto& p = projected[i];
+        ids.push_back(p.id);
+        if (!p.inserted) {
+            vlog(plog.debug, "write_subject_version: no-op");
+            continue;
+        }
+
+        // The records of a batch land at consecutive offsets
+        auto offset = write_at + model::offset(records.size());
         vlog(
           plog.debug,
           "seq_writer::write_subject_version project offset={} "
           "subject={} "
           "schema={} "
           "version={}",
-          write_at,
+          offset,
           schema.schema.sub(),
-          projected.id,
-          projected.version);
+          p.id,
+          p.version);
 
         auto key = schema_key{
-          .seq{write_at},
+          .seq{offset},
           .node{seq._node_id},
           .sub{schema.schema.sub()},
-          .version{projected.version}};
+          .version{p.version}};
         auto value = canonical_schema_value{
-          .schema{schema.schema},
-          .version{projected.version},
-          .id{projected.id},
+          .schema{std::move(schema.schema)},
+          .version{p.version},
+          .id{p.id},
           .deleted = is_deleted::no};
+        rb.add_raw_kv(to_json_iobuf(key), to_json_iobuf(value));
+        records.emplace_back(std::move(key), std::move(value));
+    }
 
-        auto batch = as_record_batch(key, value);
+    if (records.empty()) {
+        co_return ids;
+    }
 
-        auto success = co_await seq.produce_and_check(
-          write_at, std::move(batch));
-        if (success) {
-            auto applier = consume_to_store(seq._store, seq);
-            using Tag = decltype(value.schema)::tag;
-            co_await applier.apply<Tag>(write_at, key, value);
-            seq.advance_offset_inner(write_at);
-            co_return projected.id;
-        } else {
-            co_return std::nullopt;
-        }
+    auto success = co_await seq.produce_and_check(
+      write_at, std::move(rb).build());
+    if (!success) {
+        co_return std::nullopt;
+    }
+
+    auto applier = consume_to_store(seq._store, seq);
+    for (const auto& [key, value] : records) {
+        using Tag = decltype(value.schema)::tag;
+        co_await applier.apply<Tag>(key.seq, key, value);
+        seq.advance_offset_inner(key.seq);
     }
+    co_return ids;
 }
 
 ss::future<schema_id> seq_writer::write_subject_version(subject_schema schema) {
-    return sequenced_write([this, schema{std::move(schema)}](
-                             model::offset write_at, seq_writer& seq) {
-        return do_write_subject_version(schema, write_at, seq);
+    std::vector<subject_schema> schemas;
+    schemas.push_back(std::move(schema));
+    auto ids = co_await sequenced_write([this, schemas{std::move(schemas)}](
+                                          model::offset write_at,
+                                          seq_writer& seq) {
+        return do_write_subject_versions(schemas, write_at, seq);
     });
+    co_return ids.front();
+}
+
+ss::future<std::vector<schema_id>>
+seq_writer::write_subject_versions(std::vector<subject_schema> schemas) {
+    std::vector<schema_id> ids;
+    ids.reserve(schemas.size());
+    auto it = schemas.begin();
+    while (it != schemas.end()) {
+        // Each batch is retried on its own on a collision
+        std::vector<subject_schema> batch;
+        size_t batch_bytes = 0;
+        for (; it != schemas.end()
+               && (batch.empty() || batch_bytes < max_batch_bytes);
+             ++it) {
+            batch_bytes += it->schema.def().raw()().size();
+            batch.push_back(std::move(*it));
+        }
+        auto batch_ids = co_await sequenced_write(
+          [this, batch{std::move(batch)}](
+            model::offset write_at, seq_writer& seq) {
+              return do_write_subject_versions(batch, write_at, seq);
+          });
+        ids.insert(ids.end(), batch_ids.begin(), batch_ids.end());
+    }
+    co_return ids;
 }
 
 ss::future<std::optional<bool>> seq_writer::do_write_config(
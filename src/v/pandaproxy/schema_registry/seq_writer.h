@@ -18,6 +18,7 @@
 #include "pandaproxy/schema_registry/types.h"
 #include "random/simple_time_jitter.h"
 #include "ssx/semaphore.h"
+#include "units.h"
 #include "utils/retry.h"
 
 namespace pandaproxy::schema_registry {
@@ -26,6 +27,9 @@ using namespace std::chrono_literals;
 
 static const int max_retries = 4;
 
+// The size of the schemas written by a batch of write_subject_versions
+static constexpr size_t max_batch_bytes = 512_KiB;
+
 class seq_writer final : public ss::peering_sharded_service<seq_writer> {
 public:
     seq_writer(
@@ -45,6 +49,15 @@ public:
 
     ss::future<schema_id> write_subject_version(subject_schema schema);
 
+    ///\brief Write many subject versions, a produce and a wait per batch of
+    /// up to max_batch_bytes rather than per version.
+    ///
+    /// As for write_subject_version, the schemas are expected to be
+    /// validated and the id of those already registered to be set. Returns
+    /// the ids of the schemas, in order.
+    ss::future<std::vector<schema_id>>
+    write_subject_versions(std::vector<subject_schema> schemas);
+
     ss::future<bool>
     write_config(std::optional<subject> sub, compatibility_level compat);
 
@@ -69,8 +82,11 @@ private:
 
     void advance_offset_inner(model::offset offset);
 
-    ss::future<std::optional<schema_id>> do_write_subject_version(
-      subject_schema schema, model::offset write_at, seq_writer& seq);
+    ss::future<std::optional<std::vector<schema_id>>>
+    do_write_subject_versions(
+      std::vector<subject_schema> schemas,
+      model::offset write_at,
+      seq_writer& seq);
 
     ss::future<std::optional<bool>> do_write_config(
       std::optional<subject> sub,
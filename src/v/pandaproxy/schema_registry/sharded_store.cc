@@ -30,10 +30,13 @@
 #include <seastar/coroutine/exception.hh>
 
 #include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 #include <fmt/core.h>
 
 #include <functional>
 #include <iterator>
+#include <string_view>
 
 namespace pandaproxy::schema_registry {
 
@@ -69,10 +72,16 @@ constexpr auto set_accumulator =
 
 ss::future<> sharded_store::start(ss::smp_service_group sg) {
     _smp_opts = ss::smp_submit_to_options{sg};
-    return _store.start();
+    co_await _store.start();
+    co_await _valid_schema_cache.start();
+    co_await _subjects_summary.start();
 }
 
-ss::future<> sharded_store::stop() { return _store.stop(); }
+ss::future<> sharded_store::stop() {
+    co_await _subjects_summary.stop();
+    co_await _valid_schema_cache.stop();
+    co_await _store.stop();
+}
 
 ss::future<canonical_schema>
 sharded_store::make_canonical_schema(unparsed_schema schema) {
@@ -123,6 +132,25 @@ sharded_store::make_valid_schema(canonical_schema schema) {
     throw as_exception(invalid_schema_type(schema.type()));
 }
 
+ss::future<valid_schema>
+sharded_store::make_valid_schema(schema_id id, canonical_schema schema) {
+    auto& cache = _valid_schema_cache.local();
+    if (auto valid = cache.get_schema(id, schema.def()); valid) {
+        co_return std::move(*valid);
+    }
+    const auto generation = cache.generation();
+    auto valid = co_await make_valid_schema(schema);
+    if (cache.generation() == generation) {
+        cache.put_schema(id, std::move(schema).def(), valid);
+    }
+    co_return valid;
+}
+
+ss::future<> sharded_store::clear_valid_schema_cache() {
+    return _valid_schema_cache.invoke_on_all(
+      [](valid_schema_cache& c) { c.clear(); });
+}
+
 ss::future<sharded_store::has_schema_result>
 sharded_store::get_schema_version(subject_schema schema) {
     // Validate the schema (may throw)
@@ -207,27 +235,76 @@ sharded_store::get_schema_version(subject_schema schema) {
 
 ss::future<sharded_store::insert_result>
 sharded_store::project_ids(subject_schema schema) {
-    auto const& sub = schema.schema.sub();
-    auto s_id = schema.id;
-    if (s_id == invalid_schema_id) {
-        // New schema, project an ID for it.
-        s_id = co_await project_schema_id();
-        vlog(plog.debug, "project_ids: projected new ID {}", s_id);
-    }
+    std::vector<subject_schema> schemas;
+    schemas.push_back(std::move(schema));
+    auto results = co_await project_ids(std::move(schemas));
+    co_return results.front();
+}
 
-    auto sub_shard{shard_for(sub)};
-    auto v_id = co_await _store.invoke_on(
-      sub_shard, _smp_opts, [sub, s_id](store& s) {
-          return s.project_version(sub, s_id);
-      });
+ss::future<std::vector<sharded_store::insert_result>>
+sharded_store::project_ids(std::vector<subject_schema> schemas) {
+    struct projected_subject {
+        schema_version version{invalid_schema_version};
+        absl::flat_hash_set<schema_id> ids;
+    };
+    // What the earlier schemas would have inserted
+    absl::flat_hash_map<subject, projected_subject> subjects;
+    absl::flat_hash_map<std::string_view, std::vector<size_t>> new_ids;
+    auto next_id = co_await project_schema_id();
+
+    std::vector<insert_result> results;
+    results.reserve(schemas.size());
+    for (size_t i = 0; i < schemas.size(); ++i) {
+        const auto& schema = schemas[i];
+        auto const& sub = schema.schema.sub();
+        auto s_id = schema.id;
+        auto new_id_it = new_ids.end();
+        if (s_id == invalid_schema_id) {
+            // An earlier schema of the batch may have the same definition
+            const auto& def = schema.schema.def();
+            new_id_it = new_ids.try_emplace(def.raw()()).first;
+            auto it = absl::c_find_if(new_id_it->second, [&](size_t j) {
+                return schemas[j].schema.def() == def;
+            });
+            if (it != new_id_it->second.end()) {
+                s_id = results[*it].id;
+                new_id_it = new_ids.end();
+            } else {
+                // New schema, project an ID for it.
+                s_id = next_id;
+                vlog(plog.debug, "project_ids: projected new ID {}", s_id);
+            }
+        }
 
-    const bool is_new = v_id.has_value();
-    if (is_new && schema.version != invalid_schema_version) {
-        v_id = schema.version;
-    }
+        auto& projected = subjects[sub];
+        std::optional<schema_version> v_id;
+        if (!projected.ids.contains(s_id)) {
+            v_id = co_await _store.invoke_on(
+              shard_for(sub), _smp_opts, [sub, s_id](store& s) {
+                  return s.project_version(sub, s_id);
+              });
+            if (v_id && projected.version != invalid_schema_version) {
+                v_id = std::max(*v_id, projected.version + 1);
+            }
+        }
+
+        const bool is_new = v_id.has_value();
+        if (is_new && schema.version != invalid_schema_version) {
+            v_id = schema.version;
+        }
+        if (is_new) {
+            projected.ids.insert(s_id);
+            projected.version = std::max(projected.version, *v_id);
+            next_id = std::max(next_id, s_id + 1);
+            if (new_id_it != new_ids.end()) {
+                new_id_it->second.push_back(i);
+            }
+        }
 
-    co_return insert_result{
-      v_id.value_or(invalid_schema_version), s_id, is_new};
+        results.push_back(insert_result{
+          v_id.value_or(invalid_schema_version), s_id, is_new});
+    }
+    co_return results;
 }
 
 ss::future<bool> sharded_store::upsert(
@@ -357,15 +434,36 @@ ss::future<subject_schema> sharded_store::get_subject_schema(
 
 ss::future<std::vector<subject>>
 sharded_store::get_subjects(include_deleted inc_del) {
-    auto map = [inc_del](store& s) { return s.get_subjects(inc_del); };
-    auto reduce = [](std::vector<subject> acc, std::vector<subject> subs) {
-        acc.insert(
-          acc.end(),
+    auto& summary = _subjects_summary.local();
+    auto& listing = inc_del ? summary.all : summary.live;
+    const auto generation = _subjects_generation.load(
+      std::memory_order_acquire);
+    if (listing && listing->generation == generation) {
+        co_return listing->subjects;
+    }
+
+    auto per_shard = co_await _store.map(
+      [inc_del](store& s) { return s.get_subjects(inc_del); });
+    size_t count = 0;
+    for (const auto& subs : per_shard) {
+        count += subs.size();
+    }
+    std::vector<subject> subjects;
+    subjects.reserve(count);
+    for (auto& subs : per_shard) {
+        subjects.insert(
+          subjects.end(),
           std::make_move_iterator(subs.begin()),
           std::make_move_iterator(subs.end()));
-        return acc;
-    };
-    co_return co_await _store.map_reduce0(map, std::vector<subject>{}, reduce);
+    }
+
+    // Keep a copy allocated on this shard, rather than the subjects of the
+    // other shards; a listing made across a write is already stale.
+    if (!listing || listing->generation < generation) {
+        listing = subjects_summary::listing{
+          .generation = generation, .subjects = subjects};
+    }
+    co_return subjects;
 }
 
 ss::future<std::vector<schema_version>>
@@ -437,10 +535,15 @@ ss::future<std::vector<schema_id>> sharded_store::referenced_by(
 ss::future<std::vector<schema_version>> sharded_store::delete_subject(
   seq_marker marker, subject sub, permanent_delete permanent) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto versions = co_await _store.invoke_on(
       sub_shard, _smp_opts, [marker, sub{std::move(sub)}, permanent](store& s) {
           return s.delete_subject(marker, sub, permanent).value();
       });
+    invalidate_subjects_summary();
+    if (permanent) {
+        co_await clear_valid_schema_cache();
+    }
+    co_return versions;
 }
 
 ss::future<is_deleted> sharded_store::is_subject_deleted(subject sub) {
@@ -490,10 +593,13 @@ sharded_store::get_subject_version_written_at(subject sub, schema_version ver) {
 ss::future<bool>
 sharded_store::delete_subject_version(subject sub, schema_version ver) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto deleted = co_await _store.invoke_on(
       sub_shard, _smp_opts, [sub{std::move(sub)}, ver](store& s) {
           return s.delete_subject_version(sub, ver).value();
       });
+    invalidate_subjects_summary();
+    co_await clear_valid_schema_cache();
+    co_return deleted;
 }
 
 ss::future<compatibility_level> sharded_store::get_compatibility() {
@@ -554,6 +660,7 @@ sharded_store::insert_subject(subject sub, schema_id id) {
       sub_shard, _smp_opts, [sub{std::move(sub)}, id](store& s) mutable {
           return s.insert_subject(sub, id);
       });
+    invalidate_subjects_summary();
     co_return insert_subject_result{version, inserted};
 }
 
@@ -564,12 +671,14 @@ ss::future<bool> sharded_store::upsert_subject(
   schema_id id,
   is_deleted deleted) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto inserted = co_await _store.invoke_on(
       sub_shard,
       _smp_opts,
       [marker, sub{std::move(sub)}, version, id, deleted](store& s) mutable {
           return s.upsert_subject(marker, std::move(sub), version, id, deleted);
       });
+    invalidate_subjects_summary();
+    co_return inserted;
 }
 
 /// \brief Get the schema ID to be used for next insert
@@ -652,7 +761,45 @@ ss::future<bool> sharded_store::is_compatible(
         ver_it = versions.begin();
     }
 
-    auto new_valid = co_await make_valid_schema(new_schema);
+    const bool backward = compat == compatibility_level::backward
+                          || compat == compatibility_level::backward_transitive
+                          || compat == compatibility_level::full
+                          || compat == compatibility_level::full_transitive;
+    const bool forward = compat == compatibility_level::forward
+                         || compat == compatibility_level::forward_transitive
+                         || compat == compatibility_level::full
+                         || compat == compatibility_level::full_transitive;
+
+    // The schemas are only parsed for the checks not cached yet
+    using reader = valid_schema_cache::reader;
+    std::optional<valid_schema> new_valid;
+    auto check = [this, &new_schema, &new_valid](
+                   const subject_schema& old_schema,
+                   std::optional<valid_schema>& old_valid,
+                   reader r) -> ss::future<bool> {
+        auto& cache = _valid_schema_cache.local();
+        auto res = cache.get_compatible(old_schema.id, new_schema.def(), r);
+        if (res) {
+            co_return *res;
+        }
+        const auto generation = cache.generation();
+        if (!new_valid) {
+            new_valid.emplace(co_await make_valid_schema(new_schema));
+        }
+        if (!old_valid) {
+            old_valid.emplace(
+              co_await make_valid_schema(old_schema.id, old_schema.schema));
+        }
+        auto compatible = r == reader::new_schema
+                            ? check_compatible(*new_valid, *old_valid)
+                            : check_compatible(*old_valid, *new_valid);
+        // Unless a delete cleared the cache meanwhile
+        if (cache.generation() == generation) {
+            cache.put_compatible(
+              old_schema.id, new_schema.def(), r, compatible);
+        }
+        co_return compatible;
+    };
 
     auto is_compat = true;
     for (; is_compat && ver_it != versions.end(); ++ver_it) {
@@ -662,21 +809,15 @@ ss::future<bool> sharded_store::is_compatible(
 
         auto old_schema = co_await get_subject_schema(
           sub, ver_it->version, include_deleted::no);
-        auto old_valid = co_await make_valid_schema(old_schema.schema);
-
-        if (
-          compat == compatibility_level::backward
-          || compat == compatibility_level::backward_transitive
-          || compat == compatibility_level::full
-          || compat == compatibility_level::full_transitive) {
-            is_compat = is_compat && check_compatible(new_valid, old_valid);
+        std::optional<valid_schema> old_valid;
+
+        if (backward) {
+            is_compat = co_await check(
+              old_schema, old_valid, reader::new_schema);
         }
-        if (
-          compat == compatibility_level::forward
-          || compat == compatibility_level::forward_transitive
-          || compat == compatibility_level::full
-          || compat == compatibility_level::full_transitive) {
-            is_compat = is_compat && check_compatible(old_valid, new_valid);
+        if (is_compat && forward) {
+            is_compat = co_await check(
+              old_schema, old_valid, reader::registered_schema);
         }
     }
     co_return is_compat;
@@ -12,9 +12,14 @@
 #pragma once
 
 #include "pandaproxy/schema_registry/types.h"
+#include "pandaproxy/schema_registry/valid_schema_cache.h"
 
 #include <seastar/core/sharded.hh>
 
+#include <atomic>
+#include <optional>
+#include <vector>
+
 namespace pandaproxy::schema_registry {
 
 class store;
@@ -48,6 +53,11 @@ public:
     };
     ss::future<insert_result> project_ids(subject_schema schema);
 
+    ///\brief Project the ids of \p schemas as if each of them was inserted
+    /// before the next one is projected.
+    ss::future<std::vector<insert_result>>
+    project_ids(std::vector<subject_schema> schemas);
+
     ss::future<bool> upsert(
       seq_marker marker,
       canonical_schema schema,
@@ -169,8 +179,38 @@ private:
 
     ss::future<schema_id> project_schema_id();
 
+    ///\brief Construct the schema registered with \p id, from the cache of
+    /// this shard when there
+    ss::future<valid_schema>
+    make_valid_schema(schema_id id, canonical_schema schema);
+
+    ///\brief Drop the parsed schemas and compatibility results cached
+    ss::future<> clear_valid_schema_cache();
+
+    ///\brief Invalidate the subjects listed on every shard, once the subjects
+    /// or their versions are written.
+    void invalidate_subjects_summary() {
+        _subjects_generation.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    ///\brief The subjects listed by get_subjects, kept on every shard until
+    /// _subjects_generation moves past the generation they were listed at.
+    struct subjects_summary {
+        struct listing {
+            uint64_t generation;
+            std::vector<subject> subjects;
+        };
+        std::optional<listing> live;
+        std::optional<listing> all;
+
+        ss::future<> stop() { return ss::now(); }
+    };
+
     ss::smp_submit_to_options _smp_opts;
     ss::sharded<store> _store;
+    ss::sharded<valid_schema_cache> _valid_schema_cache;
+    ss::sharded<subjects_summary> _subjects_summary;
+    std::atomic<uint64_t> _subjects_generation{0};
 
     ///\brief Access must occur only on shard 0.
     schema_id _next_schema_id{1};
@@ -20,6 +20,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+
 namespace pp = pandaproxy;
 namespace pps = pp::schema_registry;
 
@@ -131,3 +133,133 @@ SEASTAR_THREAD_TEST_CASE(test_sharded_store_find_unordered) {
     BOOST_REQUIRE_EQUAL(res.id, pps::schema_id{1});
     BOOST_REQUIRE_EQUAL(res.version, ver1);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_sharded_store_project_ids_batch) {
+    pps::sharded_store store;
+    store.start(ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&store]() { store.stop().get(); });
+
+    const pps::subject sub_a{"a"};
+    const pps::subject sub_b{"b"};
+    const pps::canonical_schema_definition string_def{
+      R"({"type":"string"})", pps::schema_type::avro};
+    const pps::canonical_schema_definition int_def{
+      R"({"type":"int"})", pps::schema_type::avro};
+    const pps::canonical_schema_definition long_def{
+      R"({"type":"long"})", pps::schema_type::avro};
+    const pps::schema_version ver1{1};
+
+    store
+      .upsert(
+        pps::seq_marker{
+          std::nullopt, std::nullopt, ver1, pps::seq_marker_key_type::schema},
+        pps::canonical_schema{sub_a, string_def},
+        pps::schema_id{1},
+        ver1,
+        pps::is_deleted::no)
+      .get();
+
+    auto make = [](
+                  const pps::subject& sub,
+                  const pps::canonical_schema_definition& def,
+                  pps::schema_id id = pps::invalid_schema_id) {
+        return pps::subject_schema{
+          .schema{pps::canonical_schema{sub, def}}, .id{id}};
+    };
+    std::vector<pps::subject_schema> schemas;
+    schemas.push_back(make(sub_a, string_def, pps::schema_id{1}));
+    schemas.push_back(make(sub_a, int_def));
+    schemas.push_back(make(sub_b, int_def));
+    schemas.push_back(make(sub_a, int_def));
+    schemas.push_back(make(sub_a, long_def));
+
+    auto res = store.project_ids(std::move(schemas)).get();
+    BOOST_REQUIRE_EQUAL(res.size(), 5);
+
+    // Already registered
+    BOOST_REQUIRE(!res[0].inserted);
+    BOOST_REQUIRE_EQUAL(res[0].id, pps::schema_id{1});
+
+    // A new schema and version
+    BOOST_REQUIRE(res[1].inserted);
+    BOOST_REQUIRE_EQUAL(res[1].id, pps::schema_id{2});
+    BOOST_REQUIRE_EQUAL(res[1].version, pps::schema_version{2});
+
+    // The id projected for the same definition earlier in the batch
+    BOOST_REQUIRE(res[2].inserted);
+    BOOST_REQUIRE_EQUAL(res[2].id, pps::schema_id{2});
+    BOOST_REQUIRE_EQUAL(res[2].version, pps::schema_version{1});
+
+    // Projected by the batch already
+    BOOST_REQUIRE(!res[3].inserted);
+    BOOST_REQUIRE_EQUAL(res[3].id, pps::schema_id{2});
+
+    // The versions and ids follow those projected by the batch
+    BOOST_REQUIRE(res[4].inserted);
+    BOOST_REQUIRE_EQUAL(res[4].id, pps::schema_id{3});
+    BOOST_REQUIRE_EQUAL(res[4].version, pps::schema_version{3});
+}
+
+SEASTAR_THREAD_TEST_CASE(test_sharded_store_get_subjects_after_writes) {
+    pps::sharded_store store;
+    store.start(ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&store]() { store.stop().get(); });
+
+    const pps::canonical_schema_definition string_def{
+      R"({"type":"string"})", pps::schema_type::avro};
+    const pps::schema_version ver1{1};
+    auto upsert = [&](const pps::subject& sub, pps::is_deleted deleted) {
+        store
+          .upsert(
+            pps::seq_marker{
+              std::nullopt,
+              std::nullopt,
+              ver1,
+              pps::seq_marker_key_type::schema},
+            pps::canonical_schema{sub, string_def},
+            pps::schema_id{1},
+            ver1,
+            deleted)
+          .get();
+    };
+    auto get_subjects = [&](pps::include_deleted inc_del) {
+        auto subjects = store.get_subjects(inc_del).get();
+        std::sort(subjects.begin(), subjects.end());
+        return subjects;
+    };
+
+    const pps::subject sub_a{"a"};
+    const pps::subject sub_b{"b"};
+    const std::vector<pps::subject> only_a{sub_a};
+    const std::vector<pps::subject> both{sub_a, sub_b};
+    BOOST_REQUIRE(get_subjects(pps::include_deleted::no).empty());
+
+    // The listing is not served past a write
+    upsert(sub_a, pps::is_deleted::no);
+    BOOST_REQUIRE(get_subjects(pps::include_deleted::no) == only_a);
+    upsert(sub_b, pps::is_deleted::no);
+    BOOST_REQUIRE(get_subjects(pps::include_deleted::no) == both);
+    BOOST_REQUIRE(get_subjects(pps::include_deleted::yes) == both);
+
+    // Soft deleted subjects are only listed when deleted are included
+    store
+      .delete_subject(
+        pps::seq_marker{
+          std::nullopt,
+          std::nullopt,
+          ver1,
+          pps::seq_marker_key_type::delete_subject},
+        sub_b,
+        pps::permanent_delete::no)
+      .get();
+    BOOST_REQUIRE(get_subjects(pps::include_deleted::no) == only_a);
+    BOOST_REQUIRE(get_subjects(pps::include_deleted::yes) == both);
+
+    // Listed on every shard
+    for (ss::shard_id s = 0; s < ss::smp::count; ++s) {
+        auto subjects = ss::smp::submit_to(s, [&] {
+                            return store.get_subjects(pps::include_deleted::no);
+                        }).get();
+        BOOST_REQUIRE(subjects == only_a);
+    }
+}
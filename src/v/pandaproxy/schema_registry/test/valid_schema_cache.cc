@@ -0,0 +1,65 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "pandaproxy/schema_registry/valid_schema_cache.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace pps = pandaproxy::schema_registry;
+
+using reader = pps::valid_schema_cache::reader;
+
+const pps::schema_id s_id1{1};
+const pps::schema_id s_id2{2};
+const pps::schema_id s_id3{3};
+
+const pps::canonical_schema_definition def1{
+  R"({"type":"string"})", pps::schema_type::avro};
+const pps::canonical_schema_definition def2{
+  R"({"type":"int"})", pps::schema_type::avro};
+const pps::canonical_schema_definition def2_refs{
+  R"({"type":"int"})",
+  pps::schema_type::avro,
+  {{.name{"ref"}, .sub{pps::subject{"sub"}}, .version{1}}}};
+
+BOOST_AUTO_TEST_CASE(test_valid_schema_cache_checks) {
+    pps::valid_schema_cache c{1, 2};
+
+    c.put_compatible(s_id1, def2, reader::new_schema, true);
+    c.put_compatible(s_id1, def2, reader::registered_schema, false);
+
+    BOOST_REQUIRE(c.get_compatible(s_id1, def2, reader::new_schema) == true);
+    BOOST_REQUIRE(
+      c.get_compatible(s_id1, def2, reader::registered_schema) == false);
+
+    // Wrong registered schema, definition or references
+    BOOST_REQUIRE(!c.get_compatible(s_id2, def2, reader::new_schema));
+    BOOST_REQUIRE(!c.get_compatible(s_id1, def1, reader::new_schema));
+    BOOST_REQUIRE(!c.get_compatible(s_id1, def2_refs, reader::new_schema));
+
+    // The least recently used is evicted
+    c.get_compatible(s_id1, def2, reader::new_schema);
+    c.put_compatible(s_id3, def2_refs, reader::new_schema, true);
+    BOOST_REQUIRE_EQUAL(c.checks_size(), 2);
+    BOOST_REQUIRE(c.get_compatible(s_id1, def2, reader::new_schema));
+    BOOST_REQUIRE(!c.get_compatible(s_id1, def2, reader::registered_schema));
+    BOOST_REQUIRE(c.get_compatible(s_id3, def2_refs, reader::new_schema));
+}
+
+BOOST_AUTO_TEST_CASE(test_valid_schema_cache_clear) {
+    pps::valid_schema_cache c;
+
+    c.put_compatible(s_id1, def2, reader::new_schema, true);
+    const auto generation = c.generation();
+    c.clear();
+
+    BOOST_REQUIRE_NE(c.generation(), generation);
+    BOOST_REQUIRE_EQUAL(c.checks_size(), 0);
+    BOOST_REQUIRE(!c.get_compatible(s_id1, def2, reader::new_schema));
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "pandaproxy/schema_registry/types.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+
+#include <absl/hash/hash.h>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <functional>
+#include <optional>
+#include <string_view>
+
+namespace pandaproxy::schema_registry {
+
+///\brief MRU caches of the schemas parsed for the compatibility checks, and
+/// of the results of those checks.
+///
+/// The parsed schemas are neither copied nor shared across shards, there is
+/// a cache per shard.
+///
+/// A schema is looked up by id and is only returned if its definition matches
+/// the one it was parsed from. The results of the checks are keyed by the id
+/// of the registered schema and the definition of the new one. As the ids and
+/// versions may be reused once deleted, the caches are cleared on deletes.
+class valid_schema_cache {
+public:
+    static constexpr size_t default_schemas_capacity = 1000;
+    static constexpr size_t default_checks_capacity = 10000;
+
+    ///\brief Which of the two schemas reads the data written with the other
+    enum class reader : uint8_t { new_schema, registered_schema };
+
+    explicit valid_schema_cache(
+      size_t schemas_capacity = default_schemas_capacity,
+      size_t checks_capacity = default_checks_capacity)
+      : _schemas_capacity{schemas_capacity}
+      , _checks_capacity{checks_capacity} {}
+
+    ss::future<> stop() { return ss::now(); }
+
+    std::optional<valid_schema>
+    get_schema(schema_id id, const canonical_schema_definition& def) {
+        auto& map = _schemas.get<underlying_map>();
+        auto it = map.find(id);
+        if (it == map.end() || it->def != def) {
+            return std::nullopt;
+        }
+        touch(_schemas, it);
+        return it->schema;
+    }
+
+    void put_schema(
+      schema_id id, canonical_schema_definition def, valid_schema schema) {
+        auto& map = _schemas.get<underlying_map>();
+        if (auto it = map.find(id); it != map.end()) {
+            map.erase(it);
+        }
+        auto& list = _schemas.get<underlying_list>();
+        list.emplace_front(id, std::move(def), std::move(schema));
+        shrink_to_capacity(_schemas, _schemas_capacity);
+    }
+
+    std::optional<bool> get_compatible(
+      schema_id registered,
+      const canonical_schema_definition& new_def,
+      reader r) {
+        auto& map = _checks.get<underlying_map>();
+        auto it = map.find(check_key{registered, new_def, r});
+        if (it == map.end()) {
+            return std::nullopt;
+        }
+        touch(_checks, it);
+        return it->compatible;
+    }
+
+    void put_compatible(
+      schema_id registered,
+      canonical_schema_definition new_def,
+      reader r,
+      bool compatible) {
+        auto& list = _checks.get<underlying_list>();
+        auto [it, inserted] = list.emplace_front(
+          check_key{registered, std::move(new_def), r}, compatible);
+        if (inserted) {
+            shrink_to_capacity(_checks, _checks_capacity);
+        }
+    }
+
+    void clear() {
+        _schemas.clear();
+        _checks.clear();
+        ++_generation;
+    }
+
+    ///\brief Incremented by clear(): the entries computed across a clear are
+    /// not to be put
+    uint64_t generation() const { return _generation; }
+
+    size_t schemas_size() const { return _schemas.size(); }
+    size_t checks_size() const { return _checks.size(); }
+
+private:
+    struct underlying_list {};
+    struct underlying_map {};
+
+    template<typename Cache, typename It>
+    static void touch(Cache& cache, It it) {
+        auto& list = cache.template get<underlying_list>();
+        list.relocate(
+          list.begin(), cache.template project<underlying_list>(it));
+    }
+
+    // Truncate the cache from the back of the sequence
+    template<typename Cache>
+    static void shrink_to_capacity(Cache& cache, size_t capacity) {
+        auto& list = cache.template get<underlying_list>();
+        if (list.size() > capacity) {
+            list.resize(capacity);
+        }
+    }
+
+    struct schema_entry {
+        schema_entry(
+          schema_id id, canonical_schema_definition def, valid_schema schema)
+          : id{id}
+          , def{std::move(def)}
+          , schema{std::move(schema)} {}
+
+        schema_id id;
+        canonical_schema_definition def;
+        valid_schema schema;
+    };
+
+    struct check_key {
+        schema_id registered;
+        canonical_schema_definition new_def;
+        reader r;
+
+        friend bool operator==(const check_key&, const check_key&) = default;
+
+        template<typename H>
+        friend H AbslHashValue(H h, const check_key& k) {
+            h = H::combine(
+              std::move(h),
+              k.registered(),
+              std::string_view{k.new_def.raw()()},
+              k.new_def.type(),
+              k.r);
+            for (const auto& ref : k.new_def.refs()) {
+                h = H::combine(
+                  std::move(h),
+                  std::string_view{ref.name},
+                  std::string_view{ref.sub()},
+                  ref.version());
+            }
+            return h;
+        }
+    };
+
+    struct check_entry {
+        check_entry(check_key key, bool compatible)
+          : key{std::move(key)}
+          , compatible{compatible} {}
+
+        check_key key;
+        bool compatible;
+    };
+
+    using schemas_t = boost::multi_index::multi_index_container<
+      schema_entry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        boost::multi_index::hashed_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::
+            member<schema_entry, schema_id, &schema_entry::id>,
+          std::hash<schema_id>>>>;
+
+    using checks_t = boost::multi_index::multi_index_container<
+      check_entry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        boost::multi_index::hashed_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::
+            member<check_entry, check_key, &check_entry::key>,
+          absl::Hash<check_key>>>>;
+
+    size_t _schemas_capacity;
+    size_t _checks_capacity;
+    schemas_t _schemas;
+    checks_t _checks;
+    uint64_t _generation{0};
+};
+
+} // namespace pandaproxy::schema_registry
@@ -78,7 +78,7 @@ auto make_subject(
     }
 };
 
-std::vector<int32_t> get_proto_offsets(iobuf_parser& p) {
+std::vector<int32_t> get_proto_offsets(iobuf_parser_base& p) {
     // The encoding is a length, followed by indexes into the file or message.
     // Each number is a zigzag encoded integer.
     std::vector<int32_t> offsets;
@@ -305,6 +305,69 @@ public:
         co_return true;
     };
 
+    /// The schema of the field of the previous record of a batch
+    struct validated_field {
+        schema_id id;
+        schema_id_cache::offsets_t offsets;
+    };
+
+    /// Whether \p buf is valid according to the previous record of the batch
+    /// or the cache of this shard: it is left to validate_field otherwise.
+    bool validated_by_cache(
+      field field,
+      subject_name_strategy sns,
+      const iobuf& buf,
+      std::optional<validated_field>& last) {
+        iobuf_const_parser parser(buf);
+        if (parser.bytes_left() < 5 || parser.consume_type<int8_t>() != 0) {
+            return false;
+        }
+        auto id = schema_id{parser.consume_be_type<int32_t>()};
+        auto& probe = _api->_schema_id_validation_probe.local();
+        auto& cache = _api->_schema_id_cache.local();
+        const bool same_id = last && last->id == id;
+
+        if (same_id && !last->offsets) {
+            probe.batch_hit();
+            return true;
+        }
+        // The ids of protobuf schemas are only cached with offsets
+        if (!same_id && cache.has(_topic, field, sns, id, std::nullopt)) {
+            probe.hit();
+            last = validated_field{.id = id};
+            return true;
+        }
+
+        // Only protobuf schemas are cached with offsets, the bytes are
+        // parsed as offsets regardless of the type of the schema: if it is
+        // not protobuf they don't match.
+        auto offsets = get_proto_offsets(parser);
+        if (offsets.empty()) {
+            return false;
+        }
+        if (same_id && last->offsets == offsets) {
+            probe.batch_hit();
+            return true;
+        }
+        if (cache.has(_topic, field, sns, id, offsets)) {
+            probe.hit();
+            last = validated_field{.id = id, .offsets = std::move(offsets)};
+            return true;
+        }
+        return false;
+    }
+
+    ss::future<bool> validate_record_field(
+      field field,
+      subject_name_strategy sns,
+      const iobuf& buf,
+      std::optional<validated_field>& last) {
+        if (validated_by_cache(field, sns, buf, last)) {
+            return ss::make_ready_future<bool>(true);
+        }
+        return validate_field(field, _topic, sns, buf.copy());
+    }
+
     ss::future<bool> validate(const model::record_batch& batch) {
         if (
           !_record_key_schema_id_validation
@@ -312,30 +375,6 @@ public:
             co_return true;
         }
 
-        auto key_is_valid =
-          [this](const model::record& record) -> ss::future<bool> {
-            if (!_record_key_schema_id_validation) {
-                return ss::make_ready_future<bool>(true);
-            }
-            return validate_field(
-              field::key,
-              _topic,
-              _record_key_subject_name_strategy,
-              record.key().copy());
-        };
-
-        auto value_is_valid =
-          [this](const model::record& record) -> ss::future<bool> {
-            if (!_record_value_schema_id_validation) {
-                return ss::make_ready_future<bool>(true);
-            }
-            return validate_field(
-              field::val,
-              _topic,
-              _record_value_subject_name_strategy,
-              record.value().copy());
-        };
-
         const model::record_batch& b = batch;
         std::optional<const model::record_batch> u;
         bool compressed = batch.compressed();
@@ -345,18 +384,34 @@ public:
             _api->_schema_id_validation_probe.local().decompressed();
         }
 
-        bool valid{true};
-        co_await model::for_each_record(
-          compressed ? u.value() : b,
-          [&valid, k{std::move(key_is_valid)}, v{std::move(value_is_valid)}](
-            const model::record& r) {
-              return k(r)
-                .then([&r, v{std::move(v)}](bool k) {
-                    return k ? v(r) : ss::make_ready_future<bool>(false);
-                })
-                .then([&valid](bool v) { valid = v; });
-          });
-        co_return valid;
+        // The records of a batch are usually written with the same schema,
+        // they are validated without suspending nor looking up the cache
+        std::optional<validated_field> last_key;
+        std::optional<validated_field> last_value;
+        auto it = model::record_batch_iterator::create(
+          compressed ? u.value() : b);
+        while (it.has_next()) {
+            auto r = it.next();
+            if (
+              _record_key_schema_id_validation
+              && !co_await validate_record_field(
+                field::key,
+                _record_key_subject_name_strategy,
+                r.key(),
+                last_key)) {
+                co_return false;
+            }
+            if (
+              _record_value_schema_id_validation
+              && !co_await validate_record_field(
+                field::val,
+                _record_value_subject_name_strategy,
+                r.value(),
+                last_value)) {
+                co_return false;
+            }
+        }
+        co_return true;
     }
 
     ss::future<bool> validate(const data_t& data) {
@@ -44,6 +44,13 @@ public:
                               "schema ID validation cache (see cluster config: "
                               "kafka_schema_id_validation_cache_capacity)"),
               {}),
+            sm::make_counter(
+              "batch_hits",
+              [this]() { return _batch_hits; },
+              sm::description("Total number of records validated with the "
+                              "schema ID of the previous record of their "
+                              "batch, without a lookup of the cache"),
+              {}),
             sm::make_counter(
               "batches_decompressed",
               [this]() { return _batches_decompressed; },
@@ -57,13 +64,15 @@ public:
 
     void hit() { ++_hits; }
     void miss() { ++_misses; }
+    void batch_hit() { ++_batch_hits; }
     void decompressed() { ++_batches_decompressed; }
 
 private:
     metrics::internal_metric_groups _metrics;
-    int64_t _hits;
-    int64_t _misses;
-    int64_t _batches_decompressed;
+    int64_t _hits{0};
+    int64_t _misses{0};
+    int64_t _batch_hits{0};
+    int64_t _batches_decompressed{0};
 };
 
 } // namespace pandaproxy::schema_registry
@@ -193,3 +193,42 @@ SEASTAR_THREAD_TEST_CASE(test_keep_alive) {
     s = client_cache.size();
     BOOST_CHECK(s == 0);
 }
+
+SEASTAR_THREAD_TEST_CASE(cache_reclaim_evicted) {
+    pp::credential_t red{
+      "red", "panda", security::scram_sha256_authenticator::name};
+    pp::credential_t party{
+      "party", "parrot", security::scram_sha256_authenticator::name};
+    pp::test_client_cache client_cache{1};
+
+    auto red_client
+      = client_cache.get_client(red, config::rest_authn_method::http_basic)
+          .first;
+    client_cache.get_client(red, config::rest_authn_method::http_basic);
+
+    // Evicts red's client
+    auto party_client
+      = client_cache.get_client(party, config::rest_authn_method::http_basic)
+          .first;
+    BOOST_TEST(client_cache.size() == 1);
+
+    // Until the clean up red's client is reclaimed rather than recreated
+    red.pass = "pandas";
+    auto item = client_cache.get_client(
+      red, config::rest_authn_method::http_basic);
+    BOOST_TEST(item.first == red_client);
+    BOOST_TEST(item.first->config().scram_password.value() == red.pass);
+    BOOST_TEST(client_cache.size() == 1);
+
+    // party's client was evicted in turn, and is stopped by the clean up
+    client_cache.clean_stale_clients().get();
+    item = client_cache.get_client(
+      party, config::rest_authn_method::http_basic);
+    BOOST_TEST(item.first != party_client);
+
+    const auto& stats = client_cache.get_stats();
+    BOOST_TEST(stats.hits == 1);
+    BOOST_TEST(stats.misses == 3);
+    BOOST_TEST(stats.reclaims == 1);
+    BOOST_TEST(stats.evictions == 3);
+}
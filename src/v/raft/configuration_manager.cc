@@ -325,11 +325,9 @@ ss::future<>
 configuration_manager::start(bool reset, model::revision_id initial_revision) {
     _initial_revision = initial_revision;
     if (reset) {
-        co_await _storage.kvs().remove(
-          storage::kvstore::key_space::consensus, configurations_map_key());
-
-        co_return co_await _storage.kvs().remove(
-          storage::kvstore::key_space::consensus, highest_known_offset_key());
+        co_return co_await _storage.kvs().remove_many(
+          storage::kvstore::key_space::consensus,
+          {configurations_map_key(), highest_known_offset_key()});
     }
 
     auto map_buf = _storage.kvs().get(
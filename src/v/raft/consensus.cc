@@ -24,6 +24,7 @@
 #include "raft/consensus_utils.h"
 #include "raft/errc.h"
 #include "raft/group_configuration.h"
+#include "raft/heartbeat_manager.h"
 #include "raft/logger.h"
 #include "raft/prevote_stm.h"
 #include "raft/recovery_stm.h"
@@ -122,8 +123,11 @@ consensus::consensus(
   , _fstats(
       _self,
       config::shard_local_cfg()
-        .raft_max_concurrent_append_requests_per_follower())
-  , _batcher(this, config::shard_local_cfg().raft_replicate_batch_window_size())
+        .raft_max_concurrent_append_requests_per_follower.bind())
+  , _batcher(
+      this,
+      config::shard_local_cfg().raft_replicate_batch_window_size(),
+      config::shard_local_cfg().raft_replicate_batcher_max_linger_ms.bind())
   , _event_manager(this)
   , _probe(std::make_unique<probe>())
   , _ctxlog(group, _log->config().ntp())
@@ -133,6 +137,16 @@ consensus::consensus(
       config::shard_local_cfg().recovery_append_timeout_ms())
   , _heartbeat_disconnect_failures(
       config::shard_local_cfg().raft_heartbeat_disconnect_failures())
+  , _quiescence_timeout(
+      config::shard_local_cfg().raft_group_quiescence_timeout_ms.bind())
+  , _leader_lease_enabled(
+      config::shard_local_cfg().raft_enable_leader_lease.bind())
+  , _replication_compression(
+      config::shard_local_cfg().raft_replication_compression.bind())
+  , _replication_compression_min_bytes(
+      config::shard_local_cfg().raft_replication_compression_min_bytes.bind())
+  , _leader_lease_clock_drift(
+      config::shard_local_cfg().raft_leader_lease_clock_drift_ms.bind())
   , _storage(storage)
   , _recovery_throttle(recovery_throttle)
   , _recovery_mem_quota(recovery_mem_quota)
@@ -237,6 +251,36 @@ void consensus::maybe_step_down() {
     });
 }
 
+bool consensus::has_leader_lease() const {
+    if (
+      !_leader_lease_enabled() || _transferring_leadership || !is_leader()
+      || _vstate != vote_state::leader) {
+        return false;
+    }
+    const auto lease_duration = _jit.base_duration()
+                                - _leader_lease_clock_drift();
+    if (lease_duration <= clock_type::duration::zero()) {
+        return false;
+    }
+    const auto lease_start = config().quorum_match([this](vnode rni) {
+        if (rni == _self) {
+            return clock_type::now();
+        }
+        if (auto it = _fstats.find(rni); it != _fstats.end()) {
+            return it->second.last_acked_request_sent_at;
+        }
+        return clock_type::time_point::min();
+    });
+    // acknowledgements of requests from before the current leadership or
+    // from before the last leadership transfer do not count
+    if (
+      lease_start < _became_leader_at
+      || lease_start < _leadership_transfer_finished_at) {
+        return false;
+    }
+    return lease_start + lease_duration > clock_type::now();
+}
+
 clock_type::time_point consensus::majority_heartbeat() const {
     return config().quorum_match([this](vnode rni) {
         if (rni == _self) {
@@ -244,7 +288,16 @@ clock_type::time_point consensus::majority_heartbeat() const {
         }
 
         if (auto it = _fstats.find(rni); it != _fstats.end()) {
-            return it->second.last_received_reply_timestamp;
+            auto last_reply = it->second.last_received_reply_timestamp;
+            // quiescent followers are only sent periodic heartbeats, use the
+            // node liveness to tell if they are still there
+            if (it->second.quiescent && _node_liveness) {
+                last_reply = std::max(
+                  last_reply,
+                  _node_liveness->last_seen(rni.id())
+                    .value_or(clock_type::time_point::min()));
+            }
+            return last_reply;
         }
 
         // if we do not know the follower state yet i.e. we have
@@ -446,6 +499,12 @@ consensus::success_reply consensus::update_follower_index(
     }
 
     if (reply.result == reply_result::success) {
+        // the request was sent after the lease probe, see
+        // follower_index_metadata::next_follower_sequence
+        if (seq >= idx.lease_probe_seq) {
+            idx.last_acked_request_sent_at = std::max(
+              idx.last_acked_request_sent_at, idx.lease_probe_sent_at);
+        }
         successfull_append_entries_reply(idx, std::move(reply));
         return success_reply::yes;
     } else {
@@ -648,6 +707,18 @@ ss::future<result<model::offset>> consensus::linearizable_barrier() {
      * Flush log on leader, to make sure the _commited_index will be updated
      */
     co_await flush_log();
+    /**
+     * No other leader may have been elected while the lease is held, the
+     * commit index of this leader is the linearizable offset
+     */
+    if (has_leader_lease()) {
+        _probe->leader_lease_barrier();
+        vlog(
+          _ctxlog.trace,
+          "Linearizable offset from the leader lease: {}",
+          _commit_index);
+        co_return ret_t(_commit_index);
+    }
     const auto cfg = config();
     const auto offsets = _log->offsets();
 
@@ -841,7 +912,13 @@ replicate_stages consensus::do_replicate(
     }
 
     return wrap_stages_with_gate(
-      _bg, _batcher.replicate(expected_term, std::move(rdr), opts.consistency));
+      _bg,
+      _batcher.replicate(
+        expected_term,
+        std::move(rdr),
+        opts.consistency,
+        std::nullopt,
+        opts.trace));
 }
 
 ss::future<model::record_batch_reader>
@@ -869,12 +946,56 @@ ss::future<model::record_batch_reader> consensus::make_reader(
     });
 }
 
+bool consensus::is_quiescent() const {
+    const auto& timeout = _quiescence_timeout();
+    if (
+      !timeout || !is_elected_leader() || _transferring_leadership
+      || !_node_liveness || !_node_liveness->has_probe()
+      || !_features.is_active(features::feature::raft_quiescent_groups)) {
+        return false;
+    }
+    if (clock_type::now() - _last_write < *timeout) {
+        return false;
+    }
+    const auto dirty_offset = _log->offsets().dirty_offset;
+    if (
+      _commit_index != dirty_offset || _flushed_offset != dirty_offset
+      || config().get_state() != configuration_state::simple) {
+        return false;
+    }
+    return std::all_of(
+      _fstats.begin(), _fstats.end(), [dirty_offset](const auto& f) {
+          const auto& meta = f.second;
+          return !meta.is_recovering && meta.match_index == dirty_offset
+                 && meta.last_flushed_log_index == dirty_offset;
+      });
+}
+
+clock_type::duration consensus::quiescent_heartbeat_deadline() const {
+    // twice the period of full heartbeats sent to quiescent followers
+    return 2 * heartbeat_manager::full_heartbeat_sync_period
+           * config::shard_local_cfg().raft_heartbeat_interval_ms();
+}
+
+bool consensus::is_quiescent_follower() const {
+    if (!_quiescent_follower || !_leader_id || !_node_liveness) {
+        return false;
+    }
+    // the leader keeps sending periodic full heartbeats, if even those stop
+    // arriving do not rely on node liveness only
+    if (_hbeat + quiescent_heartbeat_deadline() < clock_type::now()) {
+        return false;
+    }
+    return _node_liveness->is_alive(_leader_id->id(), _jit.base_duration());
+}
+
 bool consensus::should_skip_vote(bool ignore_heartbeat) {
     bool skip_vote = false;
 
     if (likely(!ignore_heartbeat)) {
         auto last_election = clock_type::now() - _jit.base_duration();
         skip_vote |= (_hbeat > last_election); // nothing to do.
+        skip_vote |= is_quiescent_follower();
     }
 
     skip_vote |= _vstate == vote_state::leader; // already a leader
@@ -1751,9 +1872,14 @@ ss::future<vote_reply> consensus::do_vote(vote_request r) {
     // timeout duration When the vote was requested because of leadership
     // transfer grant the vote immediately.
     auto prev_election = clock_type::now() - _jit.base_duration();
+    // a vote repeated in the same term is granted again. With leader leases a
+    // vote from an earlier term must not bypass the check, the candidate could
+    // be elected while the current leader holds a lease
+    const bool repeated_vote = r.node_id == _voted_for
+                               && (r.term == _term || !_leader_lease_enabled());
     if (
-      _hbeat > prev_election && !r.leadership_transfer
-      && r.node_id != _voted_for) {
+      (_hbeat > prev_election || is_quiescent_follower())
+      && !r.leadership_transfer && !repeated_vote) {
         vlog(
           _ctxlog.trace,
           "Already heard from the leader, not granting vote to node {}",
@@ -1852,6 +1978,7 @@ ss::future<vote_reply> consensus::do_vote(vote_request r) {
 
 ss::future<append_entries_reply>
 consensus::append_entries(append_entries_request&& r) {
+    _quiescent_follower = false;
     return with_gate(_bg, [this, r = std::move(r)]() mutable {
         return _append_requests_buffer.enqueue(std::move(r));
     });
@@ -2641,7 +2768,9 @@ ss::future<consensus::flushed> consensus::flush_log() {
     auto flushed_up_to = _log->offsets().dirty_offset;
     _probe->log_flushed();
     _not_flushed_bytes = 0;
+    const auto flush_started = ss::steady_clock_type::now();
     co_await _log->flush();
+    _probe->log_flush(ss::steady_clock_type::now() - flush_started);
     const auto lstats = _log->offsets();
     /**
      * log flush may be interleaved with trucation, hence we need to check
@@ -2670,6 +2799,7 @@ ss::future<storage::append_result> consensus::disk_append(
   model::record_batch_reader&& reader,
   update_last_quorum_index should_update_last_quorum_idx) {
     using ret_t = storage::append_result;
+    _last_write = clock_type::now();
     auto cfg = storage::log_append_config{
       // no fsync explicit on a per write, we verify at the end to
       // batch fsync
@@ -2789,6 +2919,8 @@ protocol_metadata consensus::meta() const {
 void consensus::update_node_append_timestamp(vnode id) {
     if (auto it = _fstats.find(id); it != _fstats.end()) {
         it->second.last_sent_append_entries_req_timestamp = clock_type::now();
+        // append entries request wakes the follower up
+        it->second.quiescent = false;
     }
 }
 void consensus::maybe_update_node_reply_timestamp(vnode id) {
@@ -3461,16 +3593,17 @@ consensus::do_transfer_leadership(transfer_leadership_request req) {
           });
     });
 
-    return f.finally([this] { _transferring_leadership = false; });
+    return f.finally([this] {
+        _transferring_leadership = false;
+        _leadership_transfer_finished_at = clock_type::now();
+    });
 }
 
 ss::future<> consensus::remove_persistent_state() {
-    // voted for
-    co_await _storage.kvs().remove(
-      storage::kvstore::key_space::consensus, voted_for_key());
-    // last applied key
-    co_await _storage.kvs().remove(
-      storage::kvstore::key_space::consensus, last_applied_key());
+    // voted for and last applied key
+    co_await _storage.kvs().remove_many(
+      storage::kvstore::key_space::consensus,
+      {voted_for_key(), last_applied_key()});
     // configuration manager
     co_await _configuration_manager.remove_persistent_state();
     // offset translator
@@ -3566,6 +3699,28 @@ consensus::suppress_heartbeats_guard consensus::suppress_heartbeats(vnode id) {
     return suppress_heartbeats_guard{*this, id};
 }
 
+void consensus::extend_leader_lease(vnode id, clock_type::time_point sent_at) {
+    if (auto it = _fstats.find(id); it != _fstats.end()) {
+        it->second.last_acked_request_sent_at = std::max(
+          it->second.last_acked_request_sent_at, sent_at);
+    }
+}
+
+void consensus::maybe_compress_append_entries(
+  rpc::client_opts& opts, size_t uncompressed_bytes) const {
+    // already compressed batches would only cost CPU to compress again
+    if (
+      !_replication_compression()
+      || uncompressed_bytes < _replication_compression_min_bytes()) {
+        return;
+    }
+    // the RPC layer compresses the whole request and followers decompress it
+    // before processing, they write the batches as they were produced
+    opts.compression = rpc::compression_type::zstd;
+    opts.min_compression_bytes = _replication_compression_min_bytes();
+    _probe->compressed_append_entries_request();
+}
+
 void consensus::update_heartbeat_status(vnode id, bool success) {
     if (auto it = _fstats.find(id); it != _fstats.end()) {
         if (success) {
@@ -3783,6 +3938,8 @@ reply_result consensus::lightweight_heartbeat(
         return reply_result::failure;
     }
 
+    // quiescent leaders do not send lightweight heartbeats
+    _quiescent_follower = false;
     _hbeat = clock_type::now();
     return reply_result::success;
 }
@@ -3806,6 +3963,7 @@ ss::future<full_heartbeat_reply> consensus::full_heartbeat(
         reply.result = reply_result::failure;
         co_return reply;
     }
+    const bool quiescent = hb_data.quiescent;
     /**
      * IMPORTANT: do not use request reference after the scheduling point
      */
@@ -3825,6 +3983,7 @@ ss::future<full_heartbeat_reply> consensus::full_heartbeat(
         ss::circular_buffer<model::record_batch>{}),
       flush_after_append::no));
 
+    _quiescent_follower = r.result == reply_result::success && quiescent;
     reply.result = r.result;
     reply.data = heartbeat_reply_data{
       .source_revision = _self.revision(),
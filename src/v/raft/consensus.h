@@ -28,6 +28,7 @@
 #include "raft/heartbeats.h"
 #include "raft/logger.h"
 #include "raft/mutex_buffer.h"
+#include "raft/node_liveness.h"
 #include "raft/offset_translator.h"
 #include "raft/prevote_stm.h"
 #include "raft/probe.h"
@@ -36,6 +37,7 @@
 #include "raft/replicate_batcher.h"
 #include "raft/state_machine_manager.h"
 #include "raft/timeout_jitter.h"
+#include "rpc/types.h"
 #include "seastarx.h"
 #include "ssx/semaphore.h"
 #include "storage/fwd.h"
@@ -197,6 +199,16 @@ public:
      * details see paragraph 6.4 of Raft protocol dissertation.
      */
     ss::future<result<model::offset>> linearizable_barrier();
+    /**
+     * Followers do not grant votes, other than for leadership transfer, for an
+     * election timeout after they heard from the leader. Leader holds a lease
+     * until an election timeout, less the clock drift guard, passed since a
+     * majority of replicas acknowledged a request sent by it. While holding a
+     * lease no other leader can be elected and the leader serves linearizable
+     * barriers without a round of heartbeats. Enabled with
+     * raft_enable_leader_lease.
+     */
+    bool has_leader_lease() const;
 
     vnode self() const { return _self; }
     protocol_metadata meta() const;
@@ -205,6 +217,21 @@ public:
     group_configuration config() const;
     const model::ntp& ntp() const { return _log->config().ntp(); }
     clock_type::time_point last_heartbeat() const { return _hbeat; };
+
+    /**
+     * A leader whose group was not written to for
+     * raft_group_quiescence_timeout_ms and whose followers have all entries
+     * flushed stops sending per group heartbeats, only the periodic full ones
+     * are still sent. Followers are told with a flag in the full heartbeat
+     * and do not time out elections while the leader node is alive according
+     * to the node liveness. Leader uses node liveness of quiescent followers to
+     * keep leadership. The next write, append entries or vote request wakes
+     * the group up.
+     */
+    bool is_quiescent() const;
+    void set_node_liveness(const node_liveness* liveness) {
+        _node_liveness = liveness;
+    }
     clock_type::time_point became_leader_at() const {
         return _became_leader_at;
     };
@@ -406,6 +433,8 @@ public:
 
     ss::shared_ptr<storage::log> log() { return _log; }
 
+    storage::api& storage_api() { return _storage; }
+
     ss::lw_shared_ptr<const storage::offset_translator_state>
     get_offset_translator_state() {
         return _offset_translator.state();
@@ -452,6 +481,11 @@ public:
     suppress_heartbeats_guard suppress_heartbeats(vnode);
 
     void update_heartbeat_status(vnode, bool);
+    /// enables compression of an append entries request if it carries enough
+    /// uncompressed data, see raft_replication_compression
+    void maybe_compress_append_entries(
+      rpc::client_opts&, size_t uncompressed_bytes) const;
+    void extend_leader_lease(vnode, clock_type::time_point);
 
     bool should_reconnect_follower(const follower_index_metadata&);
 
@@ -596,6 +630,11 @@ private:
     void dispatch_vote(bool leadership_transfer);
     ss::future<bool> dispatch_prevote(bool leadership_transfer);
     bool should_skip_vote(bool ignore_heartbeat);
+    /// true if this follower was told by the leader that the group is
+    /// quiescent and the leader node is still alive
+    bool is_quiescent_follower() const;
+    /// quiescent followers expect a full heartbeat at least this often
+    clock_type::duration quiescent_heartbeat_deadline() const;
 
     /// Replicates configuration to other nodes,
     //  caller have to pass in _op_sem semaphore units
@@ -800,6 +839,9 @@ private:
     vnode _voted_for;
     std::optional<vnode> _leader_id;
     bool _transferring_leadership{false};
+    // votes for the leadership transfer target are granted regardless of the
+    // lease, only requests sent after the transfer count towards it
+    clock_type::time_point _leadership_transfer_finished_at;
 
     /// useful for when we are not the leader
     clock_type::time_point _hbeat = clock_type::now();
@@ -838,6 +880,16 @@ private:
     std::chrono::milliseconds _replicate_append_timeout;
     std::chrono::milliseconds _recovery_append_timeout;
     size_t _heartbeat_disconnect_failures;
+    config::binding<std::optional<std::chrono::milliseconds>>
+      _quiescence_timeout;
+    config::binding<bool> _leader_lease_enabled;
+    config::binding<bool> _replication_compression;
+    config::binding<size_t> _replication_compression_min_bytes;
+    config::binding<std::chrono::milliseconds> _leader_lease_clock_drift;
+    const node_liveness* _node_liveness{nullptr};
+    clock_type::time_point _last_write = clock_type::now();
+    // set on followers which were told that the group is quiescent
+    bool _quiescent_follower{false};
     metrics::internal_metric_groups _metrics;
     ss::abort_source _as;
     storage::api& _storage;
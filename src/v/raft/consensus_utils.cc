@@ -531,7 +531,8 @@ ss::future<> create_offset_translator_state_for_pre_existing_partition(
     co_await api.kvs().put(
       storage::kvstore::key_space::offset_translator,
       raft::offset_translator::kvstore_offsetmap_key(group),
-      ot_state->serialize_map());
+      ot_state->serialize_map(api.feature_table().local().is_active(
+        features::feature::compact_offset_translator_map)));
     vlog(
       raftlog.debug,
       "{} Set highest_known_offset in kv-store to {}",
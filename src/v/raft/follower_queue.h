@@ -28,6 +28,13 @@ public:
 
     ss::future<ssx::semaphore_units> get_append_entries_unit();
 
+    /**
+     * Changes the number of append entries requests that may be in flight to
+     * the follower. Requests already in flight are not affected, when the
+     * limit is lowered new ones wait until enough of them have finished.
+     */
+    void set_max_concurrent_append_entries(uint32_t);
+
     ss::future<> stop();
 
     bool is_idle() const {
@@ -38,11 +45,11 @@ public:
 private:
     /**
      * TODO: consider using queue depth control to automatically adjust number
-     * of concurrent requests per follower. In general it should be fine to make
-     * this static since scaling throughput is usually achieved by increasing
-     * partition count. We may need to increase number of concurrent requests
-     * per partition to increase throughput when partition number is low and we
-     * are fine with increasing latency.
+     * of concurrent requests per follower. Scaling throughput is usually
+     * achieved by increasing partition count, when partition number is low
+     * over high RTT links the limit can be raised at runtime (see
+     * raft_max_concurrent_append_requests_per_follower) trading latency for
+     * throughput.
      *
      * Things to consider:
      * - per shard concurrency controll
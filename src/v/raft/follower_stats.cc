@@ -14,6 +14,18 @@
 #include <absl/container/node_hash_map.h>
 
 namespace raft {
+follower_stats::follower_stats(
+  vnode self, config::binding<uint32_t> max_concurrent_append_entries)
+  : _self(self)
+  , _max_concurrent_append_entries(std::move(max_concurrent_append_entries)) {
+    _max_concurrent_append_entries.watch([this] {
+        for (auto& [_, q] : _queues) {
+            q.set_max_concurrent_append_entries(
+              _max_concurrent_append_entries());
+        }
+    });
+}
+
 void follower_stats::update_with_configuration(const group_configuration& cfg) {
     cfg.for_each_broker_id([this](const vnode& rni) {
         if (rni == _self || _followers.contains(rni)) {
@@ -52,7 +64,7 @@ follower_stats::get_append_entries_unit(vnode id) {
     if (auto it = _queues.find(id); it != _queues.end()) {
         return it->second.get_append_entries_unit();
     }
-    auto [it, _] = _queues.emplace(id, _max_concurrent_append_entries);
+    auto [it, _] = _queues.emplace(id, _max_concurrent_append_entries());
 
     return it->second.get_append_entries_unit();
 }
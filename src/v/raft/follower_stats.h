@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "config/property.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "raft/follower_queue.h"
@@ -27,9 +28,14 @@ public:
     using iterator = container_t::iterator;
     using const_iterator = container_t::const_iterator;
 
-    explicit follower_stats(vnode self, uint32_t max_concurrent_append_entries)
-      : _self(self)
-      , _max_concurrent_append_entries(max_concurrent_append_entries) {}
+    follower_stats(
+      vnode self, config::binding<uint32_t> max_concurrent_append_entries);
+
+    follower_stats(follower_stats&&) = delete;
+    follower_stats& operator=(follower_stats&&) = delete;
+    follower_stats(const follower_stats&) = delete;
+    follower_stats& operator=(const follower_stats&) = delete;
+    ~follower_stats() = default;
 
     const follower_index_metadata& get(vnode n) const {
         auto it = _followers.find(n);
@@ -86,7 +92,7 @@ public:
 private:
     friend std::ostream& operator<<(std::ostream&, const follower_stats&);
     vnode _self;
-    uint32_t _max_concurrent_append_entries;
+    config::binding<uint32_t> _max_concurrent_append_entries;
     container_t _followers;
     absl::node_hash_map<vnode, follower_queue> _queues;
 };
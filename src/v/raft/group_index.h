@@ -0,0 +1,87 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "raft/types.h"
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace raft {
+
+/**
+ * Shard local index of values (usually consensus instances) by group id.
+ *
+ * Group ids are stored sorted in one contiguous vector and the values in a
+ * second one at the same positions. A lookup is a binary search over the
+ * group ids only, it never dereferences the values, which keeps it cheap even
+ * with hundreds of thousands of groups on a shard. Inserts and removals are
+ * linear, they happen only when groups are created or removed.
+ */
+template<typename T>
+class group_index {
+public:
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    /// returns false if the group is already present
+    bool insert(group_id group, T value) {
+        auto it = std::lower_bound(_groups.begin(), _groups.end(), group);
+        if (it != _groups.end() && *it == group) {
+            return false;
+        }
+        auto pos = std::distance(_groups.begin(), it);
+        _groups.insert(it, group);
+        _values.insert(_values.begin() + pos, std::move(value));
+        return true;
+    }
+
+    /// returns false if the group is not present
+    bool erase(group_id group) {
+        auto pos = position(group);
+        if (!pos) {
+            return false;
+        }
+        _groups.erase(_groups.begin() + *pos);
+        _values.erase(_values.begin() + *pos);
+        return true;
+    }
+
+    /// pointer to the value of the group or nullptr if it is not present
+    const T* find(group_id group) const {
+        auto pos = position(group);
+        return pos ? &_values[*pos] : nullptr;
+    }
+
+    bool contains(group_id group) const { return position(group).has_value(); }
+
+    size_t size() const { return _groups.size(); }
+    bool empty() const { return _groups.empty(); }
+
+    /// iterates over values in group id order
+    const_iterator begin() const { return _values.cbegin(); }
+    const_iterator end() const { return _values.cend(); }
+
+private:
+    std::optional<size_t> position(group_id group) const {
+        auto it = std::lower_bound(_groups.begin(), _groups.end(), group);
+        if (it == _groups.end() || *it != group) {
+            return std::nullopt;
+        }
+        return std::distance(_groups.begin(), it);
+    }
+
+    std::vector<group_id> _groups;
+    std::vector<T> _values;
+};
+
+} // namespace raft
@@ -15,6 +15,7 @@
 #include "model/metadata.h"
 #include "prometheus/prometheus_sanitize.h"
 #include "raft/group_configuration.h"
+#include "raft/probe.h"
 #include "raft/rpc_client_protocol.h"
 #include "resource_mgmt/io_priority.h"
 
@@ -132,6 +133,7 @@ ss::future<ss::lw_shared_ptr<raft::consensus>> group_manager::create_group(
       _feature_table,
       _is_ready ? std::nullopt : std::make_optional(min_voter_priority),
       keep_snapshotted_log);
+    raft->set_node_liveness(&_node_liveness);
     return _groups_mutex.with([this, raft = std::move(raft)] {
         return ss::with_gate(_gate, [this, raft] {
             return _heartbeats.register_group(raft).then([this, raft] {
@@ -221,6 +223,75 @@ void group_manager::setup_metrics() {
         "group_count",
         [this] { return _groups.size(); },
         sm::description("Number of raft groups"))});
+
+    // replication latencies are tracked per shard, a per group histogram
+    // would be too expensive with thousands of partitions
+    auto& latencies = probe::shard_latencies();
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("raft"),
+      {
+        sm::make_histogram(
+          "replicate_batcher_wait_latency",
+          [&latencies] {
+              return latencies.replicate_batcher_wait
+                .internal_histogram_logform();
+          },
+          sm::description(
+            "Time replicate requests waited in the batcher before being sent")),
+        sm::make_histogram(
+          "leader_append_latency",
+          [&latencies] {
+              return latencies.leader_append.internal_histogram_logform();
+          },
+          sm::description("Leader append to the local log latency")),
+        sm::make_histogram(
+          "follower_append_entries_latency",
+          [&latencies] {
+              return latencies.follower_append_entries
+                .internal_histogram_logform();
+          },
+          sm::description(
+            "Append entries round trip latency to followers, including the "
+            "follower append and flush")),
+        sm::make_histogram(
+          "log_flush_latency",
+          [&latencies] {
+              return latencies.log_flush.internal_histogram_logform();
+          },
+          sm::description("Log flush latency")),
+        sm::make_histogram(
+          "replicate_commit_latency",
+          [&latencies] {
+              return latencies.replicate_commit.internal_histogram_logform();
+          },
+          sm::description(
+            "Time from the leader append until the data were committed")),
+      },
+      {},
+      {sm::shard_label});
+
+    auto& snapshots = probe::shard_stm_snapshots();
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("raft"),
+      {
+        sm::make_histogram(
+          "stm_snapshot_write_latency",
+          [&snapshots] {
+              return snapshots.write_latency.internal_histogram_logform();
+          },
+          sm::description(
+            "Time to take and persist a state machine snapshot")),
+        sm::make_counter(
+          "stm_snapshots_written",
+          [&snapshots] { return snapshots.writes; },
+          sm::description("Number of state machine snapshots written")),
+        sm::make_counter(
+          "stm_snapshot_bytes_written",
+          [&snapshots] { return snapshots.bytes_written; },
+          sm::description("Bytes of state machine snapshots written")),
+      },
+      {},
+      {sm::shard_label});
 }
 
 ss::future<> group_manager::flush_groups() {
@@ -15,6 +15,7 @@
 #include "model/metadata.h"
 #include "raft/consensus_client_protocol.h"
 #include "raft/heartbeat_manager.h"
+#include "raft/node_liveness.h"
 #include "raft/recovery_memory_quota.h"
 #include "raft/recovery_scheduler.h"
 #include "raft/timeout_jitter.h"
@@ -95,6 +96,13 @@ public:
         return _recovery_scheduler.get_status();
     }
 
+    /// Node level liveness used by quiescent groups, until it is set groups
+    /// never become quiescent.
+    void set_node_liveness_probe(node_liveness::probe_fn probe) {
+        _node_liveness.set_probe(std::move(probe));
+    }
+    void reset_node_liveness_probe() { _node_liveness.reset_probe(); }
+
 private:
     void trigger_leadership_notification(raft::leadership_status);
     void setup_metrics();
@@ -109,6 +117,7 @@ private:
     raft::consensus_client_protocol _client;
     configuration _configuration;
     raft::heartbeat_manager _heartbeats;
+    node_liveness _node_liveness;
     ss::gate _gate;
     std::vector<ss::lw_shared_ptr<raft::consensus>> _groups;
     notification_list<leader_cb_t, cluster::notification_id_type>
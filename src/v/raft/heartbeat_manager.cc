@@ -139,6 +139,7 @@ heartbeat_manager::requests_for_range_v2() {
         if (!r->is_elected_leader()) {
             continue;
         }
+        const bool quiescent = r->is_quiescent();
 
         for (auto& [id, follower_metadata] : r->_fstats) {
             if (follower_metadata.are_heartbeats_suppressed()) {
@@ -151,16 +152,28 @@ heartbeat_manager::requests_for_range_v2() {
                 vlog(r->_ctxlog.trace, "[{}] heartbeat skipped", id);
                 continue;
             }
+            const auto raft_metadata = r->meta();
+            /**
+             * Quiescent group, the follower already knows about it and only
+             * needs the periodic full heartbeat.
+             */
+            if (
+              quiescent && follower_metadata.quiescent
+              && !needs_full_heartbeat(
+                follower_metadata, raft_metadata, r->flushed_offset())) {
+                r->_probe->quiescent_heartbeat_skipped();
+                continue;
+            }
             auto [it, _] = pending_beats.try_emplace(id.id());
             group_heartbeat group_beat{
               .group = r->group(),
             };
-            const auto raft_metadata = r->meta();
             if (
-              _enable_lw_heartbeat()
+              !quiescent && _enable_lw_heartbeat()
               && !needs_full_heartbeat(
                 follower_metadata, raft_metadata, r->flushed_offset())) {
                 r->_probe->lw_heartbeat();
+                follower_metadata.quiescent = false;
                 // we do not fill the dirty offset and follower request sequence
                 // here as those fields are not used to process lightweight
                 // heartbeats
@@ -175,6 +188,8 @@ heartbeat_manager::requests_for_range_v2() {
             auto const seq_id = follower_metadata.next_follower_sequence();
 
             follower_metadata.last_sent_protocol_meta = raft_metadata;
+            follower_metadata.last_full_heartbeat_timestamp = clock_type::now();
+            follower_metadata.quiescent = quiescent;
             group_beat.data = heartbeat_request_data{
               .source_revision = r->_self.revision(),
               .target_revision = id.revision(),
@@ -183,6 +198,7 @@ heartbeat_manager::requests_for_range_v2() {
               .prev_log_index = raft_metadata.prev_log_index,
               .prev_log_term = raft_metadata.prev_log_term,
               .last_visible_index = raft_metadata.last_visible_index,
+              .quiescent = quiescent,
             };
             it->second.emplace_back(
               group_beat,
@@ -231,14 +247,21 @@ bool heartbeat_manager::needs_full_heartbeat(
      * Full heartbeat will be sent to the follower every time its responded with
      * error, requests were reordered or leader log was flushed.
      *
-     * Last condition is necessary to progress committed index if nothing but
-     * the leader flushed offset changed. Flushed offset isn't part of protocol
-     * metadata hence it must be checked separately.
+     * The flushed offset condition is necessary to progress committed index if
+     * nothing but the leader flushed offset changed. Flushed offset isn't part
+     * of protocol metadata hence it must be checked separately.
+     *
+     * Finally a full heartbeat is sent every `full_heartbeat_sync_period`
+     * heartbeat intervals so that the follower state is resynchronized even
+     * if nothing changed. Last full heartbeat timestamps differ between
+     * groups, so the periodic full heartbeats are spread over time.
      */
 
     return f_meta.last_sent_seq != f_meta.last_successful_received_seq
            || f_meta.last_sent_protocol_meta != p_meta
-           || leader_flushed_offset != f_meta.last_flushed_log_index;
+           || leader_flushed_offset != f_meta.last_flushed_log_index
+           || clock_type::now() - f_meta.last_full_heartbeat_timestamp
+                > _heartbeat_interval() * full_heartbeat_sync_period;
 }
 
 heartbeat_manager::heartbeat_manager(
@@ -361,6 +384,8 @@ ss::future<> heartbeat_manager::do_heartbeat(node_heartbeat_v2 r) {
       r.meta_map.size(),
       r.target);
 
+    // taken before the request is sent, the follower receives it later
+    const auto sent_at = clock_type::now();
     auto f = _client_protocol
                .heartbeat_v2(
                  r.target,
@@ -372,10 +397,11 @@ ss::future<> heartbeat_manager::do_heartbeat(node_heartbeat_v2 r) {
                .then([node = r.target,
                       groups = std::move(r.meta_map),
                       gate = std::move(gate),
+                      sent_at,
                       this](result<heartbeat_reply_v2> ret) mutable {
                    // this will happen after RPC client will return and resume
                    // sending heartbeats to follower
-                   process_reply(node, groups, std::move(ret));
+                   process_reply(node, groups, sent_at, std::move(ret));
                });
     // fail fast to make sure that not lagging nodes will be able to receive
     // hearteats
@@ -394,6 +420,7 @@ ss::future<> heartbeat_manager::do_heartbeat(node_heartbeat_v2 r) {
 void heartbeat_manager::process_reply(
   model::node_id n,
   const absl::node_hash_map<raft::group_id, follower_request_meta>& groups,
+  clock_type::time_point sent_at,
   result<heartbeat_reply_v2> r) {
     if (!r) {
         vlog(
@@ -403,7 +430,7 @@ void heartbeat_manager::process_reply(
           r.error().message());
         for (auto& [g, req_meta] : groups) {
             auto it = _consensus_groups.find(g);
-            if (it == _consensus_groups.end()) {
+            if (!it) {
                 vlog(
                   hbeatlog.warn,
                   "cannot find consensus group:{}, may have been moved or "
@@ -439,75 +466,78 @@ void heartbeat_manager::process_reply(
         return;
     }
     auto& reply = r.value();
-    reply.for_each_lw_reply([this, n, target = reply.target(), &groups](
-                              group_id group, reply_result result) {
-        auto it = _consensus_groups.find(group);
-        if (it == _consensus_groups.end()) {
-            vlog(
-              hbeatlog.debug,
-              "Could not find consensus for group:{} (shutting down?)",
-              group);
-            return;
-        }
-        auto consensus = *it;
-
-        if (unlikely(result == reply_result::group_unavailable)) {
-            // We may see these if the responding node is still starting up
-            // and the replica has yet to bootstrap.
-            vlog(
-              hbeatlog.debug,
-              "Heartbeat request for group {} was unavailable on node {}",
-              group,
-              n);
-            return;
-        }
+    reply.for_each_lw_reply(
+      [this, n, target = reply.target(), &groups, sent_at](
+        group_id group, reply_result result) {
+          auto it = _consensus_groups.find(group);
+          if (!it) {
+              vlog(
+                hbeatlog.debug,
+                "Could not find consensus for group:{} (shutting down?)",
+                group);
+              return;
+          }
+          auto consensus = *it;
+
+          if (unlikely(result == reply_result::group_unavailable)) {
+              // We may see these if the responding node is still starting up
+              // and the replica has yet to bootstrap.
+              vlog(
+                hbeatlog.debug,
+                "Heartbeat request for group {} was unavailable on node {}",
+                group,
+                n);
+              return;
+          }
 
-        if (unlikely(result == reply_result::timeout)) {
-            vlog(
-              hbeatlog.debug,
-              "Heartbeat request for group {} timed out on the node {}",
-              group,
-              n);
-            return;
-        }
-        if (unlikely(target != consensus->self().id())) {
-            vlog(
-              hbeatlog.warn,
-              "Heartbeat response addressed to different node: {}, current "
-              "node: {}, source node: {}",
-              target,
-              consensus->self().id(),
-              n);
-            return;
-        }
+          if (unlikely(result == reply_result::timeout)) {
+              vlog(
+                hbeatlog.debug,
+                "Heartbeat request for group {} timed out on the node {}",
+                group,
+                n);
+              return;
+          }
+          if (unlikely(target != consensus->self().id())) {
+              vlog(
+                hbeatlog.warn,
+                "Heartbeat response addressed to different node: {}, current "
+                "node: {}, source node: {}",
+                target,
+                consensus->self().id(),
+                n);
+              return;
+          }
 
-        auto meta_it = groups.find(group);
+          auto meta_it = groups.find(group);
 
-        if (unlikely(meta_it == groups.end())) {
-            vlog(
-              hbeatlog.warn,
-              "Unexpected heartbeat reply for group {} from node {}",
-              group,
-              n);
-            return;
-        }
+          if (unlikely(meta_it == groups.end())) {
+              vlog(
+                hbeatlog.warn,
+                "Unexpected heartbeat reply for group {} from node {}",
+                group,
+                n);
+              return;
+          }
 
-        /**
-         * Failed lightweight heartbeat, fallback to full heartbeat
-         */
-        if (unlikely(result == reply_result::failure)) {
-            consensus->reset_last_sent_protocol_meta(
-              meta_it->second.follower_vnode);
-            return;
-        }
+          /**
+           * Failed lightweight heartbeat, fallback to full heartbeat
+           */
+          if (unlikely(result == reply_result::failure)) {
+              consensus->reset_last_sent_protocol_meta(
+                meta_it->second.follower_vnode);
+              return;
+          }
 
-        consensus->update_heartbeat_status(
-          meta_it->second.follower_vnode, true);
-    });
+          consensus->update_heartbeat_status(
+            meta_it->second.follower_vnode, true);
+          consensus->extend_leader_lease(
+            meta_it->second.follower_vnode, sent_at);
+      });
 
     for (auto& m : reply.full_replies()) {
         auto it = _consensus_groups.find(m.group);
-        if (it == _consensus_groups.end()) {
+        if (!it) {
             vlog(
               hbeatlog.debug,
               "Could not find consensus for group:{} (shutting down?)",
@@ -590,7 +620,7 @@ void heartbeat_manager::process_reply(
           r.error().message());
         for (auto& [g, req_meta] : groups) {
             auto it = _consensus_groups.find(g);
-            if (it == _consensus_groups.end()) {
+            if (!it) {
                 vlog(
                   hbeatlog.warn,
                   "cannot find consensus group:{}, may have been moved or "
@@ -623,7 +653,7 @@ void heartbeat_manager::process_reply(
     }
     for (auto& m : r.value().meta) {
         auto it = _consensus_groups.find(m.group);
-        if (it == _consensus_groups.end()) {
+        if (!it) {
             vlog(
               hbeatlog.debug,
               "Could not find consensus for group:{} (shutting down?)",
@@ -705,18 +735,17 @@ void heartbeat_manager::dispatch_heartbeats() {
 
 ss::future<> heartbeat_manager::deregister_group(group_id g) {
     return _lock.with([this, g] {
-        auto it = _consensus_groups.find(g);
-        vassert(it != _consensus_groups.end(), "group not found: {}", g);
-        _consensus_groups.erase(it);
+        auto erased = _consensus_groups.erase(g);
+        vassert(erased, "group not found: {}", g);
     });
 }
 
 ss::future<>
 heartbeat_manager::register_group(ss::lw_shared_ptr<consensus> ptr) {
     return _lock.with([this, ptr = std::move(ptr)] {
-        auto ret = _consensus_groups.insert(ptr);
+        auto inserted = _consensus_groups.insert(ptr->group(), ptr);
         vassert(
-          ret.second,
+          inserted,
           "double registration of group: {}:{}",
           ptr->ntp(),
           ptr->group());
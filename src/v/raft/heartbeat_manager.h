@@ -17,6 +17,7 @@
 #include "raft/consensus.h"
 #include "raft/consensus_client_protocol.h"
 #include "raft/group_configuration.h"
+#include "raft/group_index.h"
 #include "raft/types.h"
 #include "utils/mutex.h"
 
@@ -25,30 +26,6 @@
 
 #include <absl/container/btree_map.h>
 #include <absl/container/node_hash_map.h>
-#include <boost/container/flat_set.hpp>
-
-namespace raft::details {
-struct consensus_ptr_by_group_id {
-    using is_transparent = std::true_type;
-
-    bool operator()(
-      const ss::lw_shared_ptr<consensus>& l,
-      const ss::lw_shared_ptr<consensus>& r) const {
-        return l->group() < r->group();
-    }
-
-    bool operator()(
-      const ss::lw_shared_ptr<consensus>& ptr, raft::group_id value) const {
-        return ptr->group() < value;
-    }
-
-    bool operator()(
-      raft::group_id value, const ss::lw_shared_ptr<consensus>& ptr) const {
-        return value < ptr->group();
-    }
-};
-
-} // namespace raft::details
 
 namespace raft {
 extern ss::logger hbeatlog;
@@ -86,8 +63,7 @@ extern ss::logger hbeatlog;
 class heartbeat_manager {
 public:
     using consensus_ptr = ss::lw_shared_ptr<consensus>;
-    using consensus_set = boost::container::
-      flat_set<consensus_ptr, details::consensus_ptr_by_group_id>;
+    using consensus_set = group_index<consensus_ptr>;
 
     struct follower_request_meta {
         follower_request_meta(
@@ -188,6 +164,10 @@ private:
     ss::future<> do_heartbeat(node_heartbeat&&);
     ss::future<> do_heartbeat(node_heartbeat_v2);
 
+    /// every this many heartbeat intervals an idle follower receives a full
+    /// heartbeat even if its state did not change
+    static constexpr int full_heartbeat_sync_period = 100;
+
     bool needs_full_heartbeat(
       const follower_index_metadata& follower_metadata,
       const protocol_metadata& leader_protocol_metadata,
@@ -202,9 +182,12 @@ private:
       const absl::node_hash_map<raft::group_id, follower_request_meta>& groups,
       result<heartbeat_reply> result);
 
+    /// \param sent_at time the request was sent at, lightweight heartbeat
+    /// replies extend the leader lease from it
     void process_reply(
       model::node_id n,
       const absl::node_hash_map<raft::group_id, follower_request_meta>& groups,
+      clock_type::time_point sent_at,
       result<heartbeat_reply_v2> result);
 
     consensus_ptr validate_heartbeat_reply(
@@ -200,7 +200,7 @@ void for_each_column(Func f, const C&... values) {
 struct heartbeat_request_data
   : serde::envelope<
       heartbeat_request_data,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     model::revision_id source_revision;
     model::revision_id target_revision;
@@ -209,6 +209,9 @@ struct heartbeat_request_data
     model::offset prev_log_index;
     model::term_id prev_log_term;
     model::offset last_visible_index;
+    // set when the leader stops sending heartbeats for the group until its
+    // next write, see consensus::is_quiescent()
+    bool quiescent{false};
 
     auto serde_fields() {
         return std::tie(
@@ -218,7 +221,8 @@ struct heartbeat_request_data
           term,
           prev_log_index,
           prev_log_term,
-          last_visible_index);
+          last_visible_index,
+          quiescent);
     }
 
     friend bool
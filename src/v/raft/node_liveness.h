@@ -0,0 +1,61 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "model/metadata.h"
+#include "raft/types.h"
+
+#include <seastar/util/noncopyable_function.hh>
+
+#include <optional>
+
+namespace raft {
+
+/**
+ * Node level liveness as seen by this node, independent of any raft group.
+ *
+ * Raft groups that stopped heartbeating (quiescent groups) use it in place of
+ * per group heartbeats to tell whether the other replicas are still around.
+ * The information itself is provided by the owner of the group manager (the
+ * node status backend), until a probe is set every node is treated as
+ * unknown and groups never become quiescent.
+ */
+class node_liveness {
+public:
+    using probe_fn = ss::noncopyable_function<std::optional<
+      clock_type::time_point>(model::node_id)>;
+
+    void set_probe(probe_fn probe) { _probe = std::move(probe); }
+    void reset_probe() { _probe = std::nullopt; }
+
+    bool has_probe() const { return _probe.has_value(); }
+
+    /// last time the node was known to be alive
+    std::optional<clock_type::time_point> last_seen(model::node_id id) const {
+        if (!_probe) {
+            return std::nullopt;
+        }
+        return (*_probe)(id);
+    }
+
+    /// true if the node was seen alive within the last \p timeout
+    bool is_alive(model::node_id id, clock_type::duration timeout) const {
+        auto seen = last_seen(id);
+        return seen && *seen + timeout > clock_type::now();
+    }
+
+private:
+    // mutable as invoking a noncopyable_function is not const
+    mutable std::optional<probe_fn> _probe;
+};
+
+} // namespace raft
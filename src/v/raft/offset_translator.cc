@@ -363,7 +363,9 @@ ss::future<> offset_translator::do_checkpoint() {
 
     std::optional<iobuf> map_buf;
     if (map_version > _map_version_at_checkpoint) {
-        map_buf.emplace(_state->serialize_map());
+        map_buf.emplace(_state->serialize_map(
+          _storage_api.feature_table().local().is_active(
+            features::feature::compact_offset_translator_map)));
     }
 
     iobuf hko_buf = reflection::to_iobuf(_highest_known_offset);
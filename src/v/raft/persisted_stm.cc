@@ -13,8 +13,10 @@
 #include "raft/consensus.h"
 #include "raft/errc.h"
 #include "raft/offset_monitor.h"
+#include "raft/probe.h"
 #include "raft/state_machine_base.h"
 #include "raft/types.h"
+#include "resource_mgmt/io_priority.h"
 #include "ssx/sformat.h"
 #include "storage/api.h"
 #include "storage/kvstore.h"
@@ -24,6 +26,7 @@
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
+#include <seastar/coroutine/as_future.hh>
 
 #include <filesystem>
 namespace raft {
@@ -132,7 +135,7 @@ file_backed_stm_snapshot::file_backed_stm_snapshot(
   , _snapshot_mgr(
       std::filesystem::path(c->log_config().work_directory()),
       std::move(snapshot_name),
-      ss::default_priority_class()) {}
+      stm_snapshot_priority()) {}
 
 ss::future<> file_backed_stm_snapshot::perform_initial_cleanup() {
     // Do nothing as the log directory name contains the partition revision,
@@ -336,16 +339,45 @@ ss::future<> persisted_stm<T>::wait_for_snapshot_hydrated() {
 
 template<supported_stm_snapshot T>
 ss::future<> persisted_stm<T>::do_write_local_snapshot() {
+    const auto start = probe::hist_t::clock_type::now();
     auto snapshot = co_await take_local_snapshot();
     auto offset = snapshot.header.offset;
+    const auto bytes = snapshot.data.size_bytes();
 
     co_await _snapshot_backend.persist_local_snapshot(std::move(snapshot));
     _last_snapshot_offset = std::max(_last_snapshot_offset, offset);
+
+    auto& stats = probe::shard_stm_snapshots();
+    stats.write_latency.record_since(start);
+    ++stats.writes;
+    stats.bytes_written += bytes;
 }
 
 template<supported_stm_snapshot T>
 void persisted_stm<T>::write_local_snapshot_in_background() {
-    ssx::spawn_with_gate(_gate, [this] { return write_local_snapshot(); });
+    // a snapshot is already waiting for its turn, it will cover everything
+    // applied until it is taken
+    if (_background_snapshot_queued) {
+        return;
+    }
+    _background_snapshot_queued = true;
+    ssx::spawn_with_gate(
+      _gate, [this] { return do_write_local_snapshot_in_background(); });
+}
+
+template<supported_stm_snapshot T>
+ss::future<> persisted_stm<T>::do_write_local_snapshot_in_background() {
+    /*
+     * the hints come from the log, on segment roll or once the stms of the
+     * shard wrote enough bytes, so after a restart or a leadership change
+     * many stms request a snapshot at once. those writes are throttled
+     * shard-wide to leave the disk to the data path.
+     */
+    auto units = co_await ss::coroutine::as_future(
+      _raft->storage_api().resources().get_stm_snapshot_units());
+    _background_snapshot_queued = false;
+    auto holder = units.get();
+    co_await write_local_snapshot();
 }
 
 template<supported_stm_snapshot T>
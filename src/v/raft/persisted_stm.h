@@ -184,7 +184,9 @@ public:
      */
     ss::future<> write_local_snapshot();
     /**
-     * Takes and persists local persisted_stm snapshot in background fiber
+     * Takes and persists local persisted_stm snapshot in background fiber.
+     * Background snapshots are throttled shard-wide, the requests made while
+     * one is queued are coalesced into it.
      */
     void write_local_snapshot_in_background() final;
     /**
@@ -248,11 +250,13 @@ private:
     ss::future<> wait_for_snapshot_hydrated();
 
     ss::future<> do_write_local_snapshot();
+    ss::future<> do_write_local_snapshot_in_background();
 
     mutex _op_lock;
     std::vector<ss::lw_shared_ptr<expiring_promise<bool>>> _sync_waiters;
     ss::condition_variable _on_snapshot_hydrated;
     bool _snapshot_hydrated{false};
+    bool _background_snapshot_queued{false};
     T _snapshot_backend;
     model::offset _last_snapshot_offset;
 };
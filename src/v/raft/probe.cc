@@ -135,6 +135,31 @@ void probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _recovery_requests; },
           sm::description("Number of recovery requests"),
           labels),
+        sm::make_counter(
+          "recovery_read_ahead_hits",
+          [this] { return _recovery_read_ahead_hits; },
+          sm::description(
+            "Number of recovery requests sent with data read ahead of time"),
+          labels),
+        sm::make_counter(
+          "recovery_read_ahead_misses",
+          [this] { return _recovery_read_ahead_misses; },
+          sm::description(
+            "Number of recovery read aheads discarded as the follower did not "
+            "continue from the read ahead offset"),
+          labels),
+        sm::make_counter(
+          "leader_lease_barriers",
+          [this] { return _leader_lease_barriers; },
+          sm::description(
+            "Number of linearizable barriers served with the leader lease"),
+          labels),
+        sm::make_counter(
+          "compressed_append_entries_requests",
+          [this] { return _compressed_append_entries_requests; },
+          sm::description(
+            "Number of append entries requests sent with compression"),
+          labels),
         sm::make_counter(
           "group_configuration_updates",
           [this] { return _configuration_updates; },
@@ -145,6 +170,12 @@ void probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _replicate_batch_flushed; },
           sm::description("Number of replicate batch flushes"),
           labels),
+        sm::make_counter(
+          "replicate_batcher_lingers",
+          [this] { return _replicate_batcher_lingers; },
+          sm::description(
+            "Number of replicate batch flushes delayed to coalesce requests"),
+          labels),
         sm::make_counter(
           "lightweight_heartbeat_requests",
           [this] { return _lw_heartbeat_requests; },
@@ -156,6 +187,13 @@ void probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _full_heartbeat_requests; },
           sm::description("Number of full heartbeats sent by the leader"),
           labels),
+        sm::make_counter(
+          "quiescent_heartbeats_skipped",
+          [this] { return _quiescent_heartbeats_skipped; },
+          sm::description(
+            "Number of heartbeats not sent by the leader as the group was "
+            "quiescent"),
+          labels),
       },
       {},
       {sm::shard_label, sm::label("partition")});
@@ -12,14 +12,62 @@
 #pragma once
 #include "metrics/metrics.h"
 #include "model/fundamental.h"
+#include "utils/latency_hist.h"
 
 #include <seastar/core/metrics.hh>
 #include <seastar/core/metrics_registration.hh>
 
+#include <chrono>
 #include <cstdint>
 namespace raft {
 class probe {
 public:
+    using hist_t = latency_hist;
+
+    /**
+     * Latency breakdown of a replication round, each stage is recorded
+     * separately so that the end to end produce latency can be attributed:
+     *  - time a replicate request waited in the batcher before being flushed
+     *  - leader append to the local log
+     *  - append entries round trip to a follower, it includes the network and
+     *    the follower append and flush
+     *  - log flush, on followers this is the fsync in the replication path
+     *  - time from the leader append until the data were committed
+     *
+     * The stages are recorded on every replication, the histograms are
+     * shared by all the groups of a shard and exported by the group_manager.
+     */
+    struct replication_latencies {
+        hist_t replicate_batcher_wait;
+        hist_t leader_append;
+        hist_t follower_append_entries;
+        hist_t log_flush;
+        hist_t replicate_commit;
+    };
+
+    static replication_latencies& shard_latencies() {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        static thread_local constinit replication_latencies latencies{};
+        return latencies;
+    }
+
+    /**
+     * Snapshots written by the persisted_stms of a shard: time to take and
+     * persist a snapshot, the number of snapshots and the bytes written.
+     * Shared by all the stms of a shard, like the replication latencies.
+     */
+    struct stm_snapshot_stats {
+        hist_t write_latency;
+        uint64_t writes{0};
+        uint64_t bytes_written{0};
+    };
+
+    static stm_snapshot_stats& shard_stm_snapshots() {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+        static thread_local constinit stm_snapshot_stats snapshots{};
+        return snapshots;
+    }
+
     probe() = default;
     probe(const probe&) = delete;
     probe& operator=(const probe&) = delete;
@@ -41,11 +89,34 @@ public:
     void log_flushed() { ++_log_flushes; }
 
     void replicate_batch_flushed() { ++_replicate_batch_flushed; }
+    void replicate_batcher_lingered() { ++_replicate_batcher_lingers; }
     void recovery_append_request() { ++_recovery_requests; }
+    void recovery_read_ahead_hit() { ++_recovery_read_ahead_hits; }
+    void recovery_read_ahead_miss() { ++_recovery_read_ahead_misses; }
+    void leader_lease_barrier() { ++_leader_lease_barriers; }
+    void compressed_append_entries_request() {
+        ++_compressed_append_entries_requests;
+    }
     void configuration_update() { ++_configuration_updates; }
 
     void leadership_changed() { ++_leadership_changes; }
 
+    void replicate_batcher_wait(std::chrono::nanoseconds d) {
+        shard_latencies().replicate_batcher_wait.record(d);
+    }
+    void leader_append(std::chrono::nanoseconds d) {
+        shard_latencies().leader_append.record(d);
+    }
+    void follower_append_entries(std::chrono::nanoseconds d) {
+        shard_latencies().follower_append_entries.record(d);
+    }
+    void log_flush(std::chrono::nanoseconds d) {
+        shard_latencies().log_flush.record(d);
+    }
+    void replicate_commit(std::chrono::nanoseconds d) {
+        shard_latencies().replicate_commit.record(d);
+    }
+
     static std::vector<ss::metrics::label_instance>
     create_metric_labels(const model::ntp& ntp);
 
@@ -58,6 +129,7 @@ public:
 
     void full_heartbeat() { ++_full_heartbeat_requests; }
     void lw_heartbeat() { ++_lw_heartbeat_requests; }
+    void quiescent_heartbeat_skipped() { ++_quiescent_heartbeats_skipped; }
 
     void clear() {
         _metrics.clear();
@@ -74,15 +146,21 @@ private:
     uint64_t _replicate_requests_done = 0;
     uint64_t _log_flushes = 0;
     uint64_t _replicate_batch_flushed = 0;
+    uint64_t _replicate_batcher_lingers = 0;
     uint32_t _log_truncations = 0;
     uint32_t _configuration_updates = 0;
     uint64_t _recovery_requests = 0;
+    uint64_t _recovery_read_ahead_hits = 0;
+    uint64_t _recovery_read_ahead_misses = 0;
+    uint64_t _leader_lease_barriers = 0;
+    uint64_t _compressed_append_entries_requests = 0;
     uint64_t _leadership_changes = 0;
     uint64_t _heartbeat_request_error = 0;
     uint64_t _replicate_request_error = 0;
     uint64_t _recovery_request_error = 0;
     uint64_t _full_heartbeat_requests = 0;
     uint64_t _lw_heartbeat_requests = 0;
+    uint64_t _quiescent_heartbeats_skipped = 0;
 
     metrics::internal_metric_groups _metrics;
     metrics::public_metric_groups _public_metrics;
@@ -24,7 +24,15 @@ recovery_memory_quota::recovery_memory_quota(
   : _cfg(config_provider())
   , _current_max_recovery_mem(_cfg.max_recovery_memory().value_or(
       memory_groups().recovery_max_memory()))
-  , _memory(_current_max_recovery_mem, "raft/recovery-quota") {
+  , _memory(_current_max_recovery_mem, "raft/recovery-quota")
+  , _memory_accounting(
+      resources::memory_accounting::local().register_reporter(
+        resources::memory_subsystem::raft_recovery, [this]() -> size_t {
+            const auto available = _memory.available_units();
+            const auto capacity = static_cast<ssize_t>(
+              _current_max_recovery_mem);
+            return capacity > available ? capacity - available : 0;
+        })) {
     _cfg.max_recovery_memory.watch([this] { on_max_memory_changed(); });
 }
 
@@ -34,6 +42,24 @@ ss::future<ssx::semaphore_units> recovery_memory_quota::acquire_read_memory() {
       std::min(_current_max_recovery_mem, _cfg.default_read_buffer_size()));
 }
 
+ss::future<ssx::semaphore_units>
+recovery_memory_quota::acquire_bulk_read_memory() {
+    return ss::get_units(
+      _memory,
+      std::min(_current_max_recovery_mem, _cfg.bulk_read_buffer_size()));
+}
+
+ss::future<ssx::semaphore_units>
+recovery_memory_quota::acquire_read_memory(size_t size) {
+    return ss::get_units(_memory, std::min(_current_max_recovery_mem, size));
+}
+
+std::optional<ssx::semaphore_units>
+recovery_memory_quota::try_acquire_read_memory(size_t size) {
+    return ss::try_get_units(
+      _memory, std::min(_current_max_recovery_mem, size));
+}
+
 void recovery_memory_quota::on_max_memory_changed() {
     int64_t new_size = int64_t(_cfg.max_recovery_memory().value_or(
       memory_groups().recovery_max_memory()));
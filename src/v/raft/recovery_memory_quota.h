@@ -10,11 +10,14 @@
  */
 #pragma once
 #include "config/property.h"
+#include "resource_mgmt/memory_accounting.h"
 #include "seastarx.h"
 #include "ssx/semaphore.h"
 
 #include <seastar/util/noncopyable_function.hh>
 
+#include <optional>
+
 namespace raft {
 /**
  * Thread local memory quota for raft recovery
@@ -24,12 +27,25 @@ public:
     struct configuration {
         config::binding<std::optional<size_t>> max_recovery_memory;
         config::binding<size_t> default_read_buffer_size;
+        config::binding<size_t> bulk_read_buffer_size;
     };
     using config_provider_fn = ss::noncopyable_function<configuration()>;
 
     explicit recovery_memory_quota(config_provider_fn);
 
     ss::future<ssx::semaphore_units> acquire_read_memory();
+    /// Memory for a read of a follower that is far behind, see
+    /// raft_recovery_bulk_read_size.
+    ss::future<ssx::semaphore_units> acquire_bulk_read_memory();
+    /// Memory for a read of the given size, used by adaptive recovery reads
+    /// sized between the default and the bulk read size.
+    ss::future<ssx::semaphore_units> acquire_read_memory(size_t);
+    /// Same as above but never waits, used for speculative reads
+    std::optional<ssx::semaphore_units> try_acquire_read_memory(size_t);
+    size_t default_read_size() const {
+        return _cfg.default_read_buffer_size();
+    }
+    size_t bulk_read_size() const { return _cfg.bulk_read_buffer_size(); }
 
 private:
     void on_max_memory_changed();
@@ -37,6 +53,7 @@ private:
     configuration _cfg;
     size_t _current_max_recovery_mem;
     ssx::semaphore _memory;
+    resources::memory_accounting::deregister_holder _memory_accounting;
 };
 
 } // namespace raft
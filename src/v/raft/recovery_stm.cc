@@ -10,6 +10,7 @@
 #include "raft/recovery_stm.h"
 
 #include "bytes/iostream.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/record_batch_reader.h"
 #include "outcome_future_utils.h"
@@ -51,7 +52,9 @@ recovery_stm::recovery_stm(
         _node_id,
         _ptr->group(),
         _ptr->ntp()))
-  , _memory_quota(quota) {}
+  , _memory_quota(quota)
+  , _read_ahead_enabled(config::shard_local_cfg().raft_recovery_read_ahead()) {
+}
 
 ss::future<> recovery_stm::recover() {
     auto meta = get_follower_meta();
@@ -150,14 +153,38 @@ ss::future<> recovery_stm::do_recover(ss::io_priority_class iopc) {
           });
         co_return;
     }
-    // acquire read memory:
-    auto read_memory_units = co_await _memory_quota.acquire_read_memory();
-    auto reader = co_await read_range_for_recovery(
-      follower_next_offset, iopc, is_learner, read_memory_units.count());
+    std::optional<recovery_range> range;
+    if (_read_ahead) {
+        range = co_await take_read_ahead(follower_next_offset);
+    }
+    if (!range) {
+        // a follower that is far behind, f.e. a new replica, is recovered
+        // with larger reads. that means fewer round trips and fewer requests
+        // for the same amount of data.
+        const bool bulk = _ptr->_log->size_bytes_after_offset(
+                            follower_next_offset)
+                          >= _memory_quota.bulk_read_size();
+        // acquire read memory:
+        auto read_memory_units = co_await (
+          _read_ahead_enabled
+            ? _memory_quota.acquire_read_memory(next_read_size(bulk))
+          : bulk ? _memory_quota.acquire_bulk_read_memory()
+                 : _memory_quota.acquire_read_memory());
+        range = co_await read_range_for_recovery(
+          follower_next_offset,
+          iopc,
+          is_learner,
+          std::move(read_memory_units),
+          bulk);
+    }
     // no batches for recovery, do nothing
-    if (!reader) {
+    if (!range) {
+        _stop_requested = true;
         co_return;
     }
+    _base_batch_offset = range->base_offset;
+    _last_batch_offset = range->last_offset;
+    _recovered_bytes_since_flush += range->size_bytes;
 
     if (is_recovery_finished()) {
         _stop_requested = true;
@@ -169,7 +196,126 @@ ss::future<> recovery_stm::do_recover(ss::io_priority_class iopc) {
         _recovered_bytes_since_flush = 0;
     }
 
-    co_await replicate(std::move(*reader), flush, std::move(read_memory_units));
+    if (_read_ahead_enabled) {
+        maybe_start_read_ahead(iopc, is_learner);
+    }
+
+    const auto throttle_wait = range->throttle_wait;
+    const auto dispatched_at = clock_type::now();
+    co_await replicate(
+      std::move(range->reader),
+      flush,
+      std::move(range->memory),
+      range->uncompressed_bytes);
+    if (_read_ahead_enabled && !_stop_requested) {
+        update_read_size(throttle_wait, clock_type::now() - dispatched_at);
+    }
+}
+
+void recovery_stm::maybe_start_read_ahead(
+  ss::io_priority_class iopc, bool is_learner) {
+    const auto start_offset = model::next_offset(_last_batch_offset);
+    if (start_offset > _ptr->_log->offsets().dirty_offset) {
+        return;
+    }
+    const bool bulk = _ptr->_log->size_bytes_after_offset(start_offset)
+                      >= _memory_quota.bulk_read_size();
+    // read ahead only uses memory that is not needed by other recoveries
+    auto units = _memory_quota.try_acquire_read_memory(next_read_size(bulk));
+    if (!units) {
+        return;
+    }
+    vlog(_ctxlog.trace, "Reading ahead, starting from: {}", start_offset);
+    // committed offset must be captured before the read, see do_recover
+    auto committed_offset = _ptr->committed_offset();
+    _read_ahead = read_ahead{
+      .start_offset = start_offset,
+      .committed_offset = committed_offset,
+      .range = read_range_for_recovery(
+        start_offset, iopc, is_learner, std::move(*units), bulk),
+    };
+}
+
+ss::future<std::optional<recovery_stm::recovery_range>>
+recovery_stm::take_read_ahead(model::offset next_offset) {
+    auto ra = std::exchange(_read_ahead, std::nullopt);
+    std::optional<recovery_range> range;
+    try {
+        range = co_await std::move(ra->range);
+    } catch (...) {
+        vlog(
+          _ctxlog.debug,
+          "Read ahead from {} failed: {}",
+          ra->start_offset,
+          std::current_exception());
+    }
+    if (!range) {
+        co_return std::nullopt;
+    }
+    // follower did not continue from where the read ahead started, f.e. the
+    // previous request failed, the range is dropped and read again
+    if (ra->start_offset != next_offset) {
+        vlog(
+          _ctxlog.trace,
+          "Dropping read ahead from {}, follower next offset: {}",
+          ra->start_offset,
+          next_offset);
+        _ptr->_probe->recovery_read_ahead_miss();
+        co_return std::nullopt;
+    }
+    _ptr->_probe->recovery_read_ahead_hit();
+    _committed_offset = ra->committed_offset;
+    co_return range;
+}
+
+ss::future<> recovery_stm::discard_read_ahead() {
+    if (!_read_ahead) {
+        co_return;
+    }
+    auto ra = std::exchange(_read_ahead, std::nullopt);
+    try {
+        co_await std::move(ra->range).discard_result();
+    } catch (...) {
+        vlog(
+          _ctxlog.trace,
+          "Ignoring read ahead error: {}",
+          std::current_exception());
+    }
+}
+
+size_t recovery_stm::next_read_size(bool bulk) {
+    const auto min = _memory_quota.default_read_size();
+    const auto max = std::max(min, _memory_quota.bulk_read_size());
+    if (_read_size == 0) {
+        _read_size = bulk ? max : min;
+    }
+    return std::clamp(_read_size, min, max);
+}
+
+void recovery_stm::update_read_size(
+  clock_type::duration throttle_wait, clock_type::duration ack_latency) {
+    const auto min = _memory_quota.default_read_size();
+    const auto max = std::max(min, _memory_quota.bulk_read_size());
+    const auto prev_latency = _ack_latency;
+    _ack_latency = prev_latency == clock_type::duration::zero()
+                     ? ack_latency
+                     : (prev_latency * 7 + ack_latency) / 8;
+
+    if (throttle_wait > ack_latency) {
+        // the throttle is the bottleneck. smaller reads keep requesting
+        // tokens as they are refilled instead of stalling until a large read
+        // fits into the shard share, which makes the rate oscillate.
+        _read_size = std::max(min, _read_size / 2);
+    } else if (
+      prev_latency != clock_type::duration::zero()
+      && ack_latency > 2 * prev_latency) {
+        // follower is slowing down, back off
+        _read_size = std::max(min, _read_size / 2);
+    } else {
+        // neither the throttle nor the follower limit the recovery, send more
+        // per round trip
+        _read_size = std::min(max, _read_size * 2);
+    }
 }
 
 flush_after_append
@@ -237,23 +383,25 @@ recovery_stm::read_range_for_recovery(
   model::offset start_offset,
   ss::io_priority_class iopc,
   bool is_learner,
-  size_t read_size) {
+  ssx::semaphore_units memory,
+  bool bulk) {
     storage::log_reader_config cfg(
       start_offset,
       model::offset::max(),
       1,
-      read_size,
+      memory.count(),
       iopc,
       std::nullopt,
       std::nullopt,
       _ptr->_as);
 
-    if (is_learner || _ptr->estimate_recovering_followers() == 1) {
+    if (bulk || is_learner || _ptr->estimate_recovering_followers() == 1) {
         // skip cache insertion on miss for learners which are throttled and
         // often catching up from the beginning of the log (e.g. new nodes)
         //
-        // also skip if there is only one replica recovering as there is no
-        // need to add batches to the cache for read-once workloads.
+        // also skip for bulk reads of old data, or if there is only one
+        // replica recovering as there is no need to add batches to the cache
+        // for read-once workloads.
         cfg.skip_batch_cache = true;
     }
 
@@ -266,7 +414,6 @@ recovery_stm::read_range_for_recovery(
 
         if (batches.empty()) {
             vlog(_ctxlog.trace, "Read no batches for recovery, stopping");
-            _stop_requested = true;
             co_return std::nullopt;
         }
         vlog(
@@ -277,8 +424,8 @@ recovery_stm::read_range_for_recovery(
 
         auto gap_filled_batches = details::make_ghost_batches_in_gaps(
           start_offset, std::move(batches));
-        _base_batch_offset = gap_filled_batches.front().base_offset();
-        _last_batch_offset = gap_filled_batches.back().last_offset();
+        const auto base_offset = gap_filled_batches.front().base_offset();
+        const auto last_offset = gap_filled_batches.back().last_offset();
 
         const auto size = std::accumulate(
           gap_filled_batches.cbegin(),
@@ -287,8 +434,18 @@ recovery_stm::read_range_for_recovery(
           [](size_t acc, const auto& batch) {
               return acc + batch.size_bytes();
           });
-        _recovered_bytes_since_flush += size;
+        const auto uncompressed_size = std::accumulate(
+          gap_filled_batches.cbegin(),
+          gap_filled_batches.cend(),
+          size_t{0},
+          [](size_t acc, const auto& batch) {
+              return batch.header().attrs.compression()
+                         == model::compression::none
+                       ? acc + batch.size_bytes()
+                       : acc;
+          });
 
+        auto throttle_started = clock_type::now();
         if (is_learner && _ptr->_recovery_throttle) {
             vlog(
               _ctxlog.trace,
@@ -302,14 +459,21 @@ recovery_stm::read_range_for_recovery(
               });
         }
 
-        co_return model::make_foreign_fragmented_memory_record_batch_reader(
-          std::move(gap_filled_batches));
+        co_return recovery_range{
+          .reader = model::make_foreign_fragmented_memory_record_batch_reader(
+            std::move(gap_filled_batches)),
+          .base_offset = base_offset,
+          .last_offset = last_offset,
+          .size_bytes = size,
+          .uncompressed_bytes = uncompressed_size,
+          .memory = std::move(memory),
+          .throttle_wait = clock_type::now() - throttle_started,
+        };
     } catch (const ss::timed_out_error& e) {
         vlog(
           _ctxlog.error,
           "Timeout reading batches starting from {}. Stopping recovery",
           start_offset);
-        _stop_requested = true;
         co_return std::nullopt;
     }
 }
@@ -510,7 +674,8 @@ recovery_stm::take_on_demand_snapshot(model::offset last_included_offset) {
 ss::future<> recovery_stm::replicate(
   model::record_batch_reader&& reader,
   flush_after_append flush,
-  ssx::semaphore_units mem_units) {
+  ssx::semaphore_units mem_units,
+  size_t uncompressed_bytes) {
     // collect metadata for append entries request
     // last persisted offset is last_offset of batch before the first one in the
     // reader
@@ -582,7 +747,8 @@ ss::future<> recovery_stm::replicate(
 
     std::vector<ssx::semaphore_units> units;
     units.push_back(std::move(mem_units));
-    return dispatch_append_entries(std::move(r), std::move(units))
+    return dispatch_append_entries(
+             std::move(r), std::move(units), uncompressed_bytes)
       .finally([hb_guard = std::move(hb_guard)] {})
       .then([this, seq, dirty_offset = lstats.dirty_offset](auto r) {
           if (!r) {
@@ -636,10 +802,14 @@ clock_type::time_point recovery_stm::append_entries_timeout() {
 }
 
 ss::future<result<append_entries_reply>> recovery_stm::dispatch_append_entries(
-  append_entries_request&& r, std::vector<ssx::semaphore_units> units) {
+  append_entries_request&& r,
+  std::vector<ssx::semaphore_units> units,
+  size_t uncompressed_bytes) {
     _ptr->_probe->recovery_append_request();
 
     rpc::client_opts opts(append_entries_timeout());
+    _ptr->maybe_compress_append_entries(opts, uncompressed_bytes);
+    opts.priority = rpc::send_priority::recovery;
     opts.resource_units = ss::make_foreign(
       ss::make_lw_shared<std::vector<ssx::semaphore_units>>(std::move(units)));
 
@@ -699,10 +869,9 @@ ss::future<> recovery_stm::apply() {
               meta.value()->is_recovering = false;
               meta.value()->recovery_finished.broadcast();
           }
-          if (_snapshot_reader != nullptr) {
-              return close_snapshot_reader();
-          }
-          return ss::now();
+          auto f = _snapshot_reader != nullptr ? close_snapshot_reader()
+                                               : ss::now();
+          return f.then([this] { return discard_read_ahead(); });
       });
 }
 
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "model/metadata.h"
+#include "model/record_batch_reader.h"
 #include "outcome.h"
 #include "raft/logger.h"
 #include "raft/recovery_memory_quota.h"
@@ -56,15 +57,54 @@ private:
     // variant encapsulating two different reader types
     using snapshot_reader_t
       = std::variant<storage::snapshot_reader, on_demand_snapshot_reader>;
+    /**
+     * Batches read for a single recovery append entries request together with
+     * the memory units backing them.
+     */
+    struct recovery_range {
+        model::record_batch_reader reader;
+        model::offset base_offset;
+        model::offset last_offset;
+        size_t size_bytes;
+        // size of the batches that are not compressed
+        size_t uncompressed_bytes;
+        ssx::semaphore_units memory;
+        // time spent waiting for the recovery throttle
+        clock_type::duration throttle_wait;
+    };
+    /**
+     * A read of the range following the one that is currently in flight,
+     * issued speculatively (see raft_recovery_read_ahead) so that the disk
+     * read and the recovery throttle wait overlap with the follower round
+     * trip. It is only used if the follower continues from the offset the
+     * read started at.
+     */
+    struct read_ahead {
+        model::offset start_offset;
+        // committed offset captured before the read was issued, see
+        // do_recover for why it must not be read after the batches
+        model::offset committed_offset;
+        ss::future<std::optional<recovery_range>> range;
+    };
     ss::future<> recover();
     ss::future<> do_recover(ss::io_priority_class);
-    ss::future<std::optional<model::record_batch_reader>>
-    read_range_for_recovery(model::offset, ss::io_priority_class, bool, size_t);
+    ss::future<std::optional<recovery_range>> read_range_for_recovery(
+      model::offset, ss::io_priority_class, bool, ssx::semaphore_units, bool);
+    void maybe_start_read_ahead(ss::io_priority_class, bool);
+    ss::future<std::optional<recovery_range>> take_read_ahead(model::offset);
+    ss::future<> discard_read_ahead();
+    size_t next_read_size(bool);
+    void update_read_size(clock_type::duration, clock_type::duration);
 
     ss::future<> replicate(
-      model::record_batch_reader&&, flush_after_append, ssx::semaphore_units);
+      model::record_batch_reader&&,
+      flush_after_append,
+      ssx::semaphore_units,
+      size_t uncompressed_bytes);
     ss::future<result<append_entries_reply>> dispatch_append_entries(
-      append_entries_request&&, std::vector<ssx::semaphore_units>);
+      append_entries_request&&,
+      std::vector<ssx::semaphore_units>,
+      size_t uncompressed_bytes);
     std::optional<follower_index_metadata*> get_follower_meta();
     clock_type::time_point append_entries_timeout();
 
@@ -102,6 +142,13 @@ private:
     bool _stop_requested = false;
     recovery_memory_quota& _memory_quota;
     size_t _recovered_bytes_since_flush = 0;
+
+    bool _read_ahead_enabled;
+    std::optional<read_ahead> _read_ahead;
+    // adaptive read size used when read ahead is enabled, 0 until the first
+    // read
+    size_t _read_size = 0;
+    clock_type::duration _ack_latency{0};
 };
 
 } // namespace raft
@@ -23,16 +23,21 @@
 
 namespace raft {
 using namespace std::chrono_literals; // NOLINT
-replicate_batcher::replicate_batcher(consensus* ptr, size_t cache_size)
+replicate_batcher::replicate_batcher(
+  consensus* ptr,
+  size_t cache_size,
+  config::binding<std::chrono::milliseconds> max_linger)
   : _ptr(ptr)
   , _max_batch_size_sem(cache_size, "raft/repl-batch")
-  , _max_batch_size(cache_size) {}
+  , _max_batch_size(cache_size)
+  , _max_linger(std::move(max_linger)) {}
 
 replicate_stages replicate_batcher::replicate(
   std::optional<model::term_id> expected_term,
   model::record_batch_reader r,
   consistency_level consistency_lvl,
-  std::optional<std::chrono::milliseconds> timeout) {
+  std::optional<std::chrono::milliseconds> timeout,
+  request_trace* trace) {
     ss::promise<> enqueued;
     auto enqueued_f = enqueued.get_future();
 
@@ -41,7 +46,8 @@ replicate_stages replicate_batcher::replicate(
       expected_term,
       std::move(r),
       consistency_lvl,
-      timeout);
+      timeout,
+      trace);
     return {std::move(enqueued_f), std::move(f)};
 }
 
@@ -51,12 +57,13 @@ replicate_batcher::cache_and_wait_for_result(
   std::optional<model::term_id> expected_term,
   model::record_batch_reader r,
   consistency_level consistency_lvl,
-  std::optional<std::chrono::milliseconds> timeout) {
+  std::optional<std::chrono::milliseconds> timeout,
+  request_trace* trace) {
     item_ptr item;
     try {
         auto holder = _bg.hold();
         item = co_await do_cache(
-          expected_term, std::move(r), consistency_lvl, timeout);
+          expected_term, std::move(r), consistency_lvl, timeout, trace);
 
         // now request is already enqueued, we can release first
         // stage future
@@ -74,7 +81,8 @@ replicate_batcher::cache_and_wait_for_result(
         if (!_flush_pending) {
             _flush_pending = true;
             ssx::background = ssx::spawn_with_gate_then(_bg, [this]() {
-                return _lock.get_units()
+                return maybe_linger()
+                  .then([this] { return _lock.get_units(); })
                   .then([this](auto units) {
                       return flush(std::move(units), false);
                   })
@@ -99,7 +107,42 @@ replicate_batcher::cache_and_wait_for_result(
     co_return co_await item->get_future();
 }
 
+std::chrono::microseconds replicate_batcher::linger_window() const {
+    const auto max_linger = _max_linger();
+    if (
+      max_linger == 0ms || _item_cache_bytes >= linger_bytes_threshold()
+      || _ptr->_transferring_leadership) {
+        return 0us;
+    }
+    return std::min<std::chrono::microseconds>(
+      max_linger, _flush_latency / linger_latency_fraction);
+}
+
+ss::future<> replicate_batcher::maybe_linger() {
+    const auto window = linger_window();
+    if (window == 0us) {
+        co_return;
+    }
+    _ptr->_probe->replicate_batcher_lingered();
+    try {
+        co_await _linger_cv.wait(window, [this] {
+            return _item_cache_bytes >= linger_bytes_threshold();
+        });
+    } catch (const ss::condition_variable_timed_out&) {
+        // the window elapsed, flush whatever has been collected
+    } catch (const ss::broken_condition_variable&) {
+        // batcher is stopping
+    }
+}
+
+void replicate_batcher::update_flush_latency(
+  std::chrono::microseconds latency) {
+    // exponential moving average with a weight of 1/8 for the new sample
+    _flush_latency = (_flush_latency * 7 + latency) / 8;
+}
+
 ss::future<> replicate_batcher::stop() {
+    _linger_cv.broken();
     return _bg.close().then([this] {
         // we keep a lock here to make sure that all inflight requests have
         // finished already
@@ -117,7 +160,8 @@ ss::future<replicate_batcher::item_ptr> replicate_batcher::do_cache(
   std::optional<model::term_id> expected_term,
   model::record_batch_reader r,
   consistency_level consistency_lvl,
-  std::optional<std::chrono::milliseconds> timeout) {
+  std::optional<std::chrono::milliseconds> timeout,
+  request_trace* trace) {
     auto batches = co_await model::consume_reader_to_memory(
       std::move(r),
       timeout ? model::timeout_clock::now() + *timeout : model::no_timeout);
@@ -130,7 +174,12 @@ ss::future<replicate_batcher::item_ptr> replicate_batcher::do_cache(
           return sum + b.size_bytes();
       });
     co_return co_await do_cache_with_backpressure(
-      expected_term, std::move(batches), bytes, consistency_lvl, timeout);
+      expected_term,
+      std::move(batches),
+      bytes,
+      consistency_lvl,
+      timeout,
+      trace);
 }
 
 ss::future<replicate_batcher::item_ptr>
@@ -139,7 +188,8 @@ replicate_batcher::do_cache_with_backpressure(
   ss::circular_buffer<model::record_batch> batches,
   size_t bytes,
   consistency_level consistency_lvl,
-  std::optional<std::chrono::milliseconds> timeout) {
+  std::optional<std::chrono::milliseconds> timeout,
+  request_trace* trace) {
     /**
      * Produce a message larger than the internal raft batch accumulator
      * (default 1Mb) the semaphore can't be acquired. Closing
@@ -180,15 +230,21 @@ replicate_batcher::do_cache_with_backpressure(
       std::move(u),
       expected_term,
       consistency_lvl,
-      timeout);
+      timeout,
+      trace);
 
     _item_cache.emplace_back(i);
+    _item_cache_bytes += bytes;
+    if (_item_cache_bytes >= linger_bytes_threshold()) {
+        _linger_cv.signal();
+    }
     co_return i;
 }
 
 ss::future<> replicate_batcher::flush(
   ssx::semaphore_units batcher_units, bool const transfer_flush) {
     auto item_cache = std::exchange(_item_cache, {});
+    _item_cache_bytes = 0;
     // this function should not throw, nor return exceptional futures,
     // since it is usually invoked in the background and there is
     // nowhere suitable to
@@ -228,6 +284,8 @@ ss::future<> replicate_batcher::flush(
         std::vector<item_ptr> notifications;
         ssx::semaphore_units item_memory_units(_max_batch_size_sem, 0);
         auto needs_flush = flush_after_append::no;
+        size_t uncompressed_bytes = 0;
+        const auto now = ss::steady_clock_type::now();
 
         for (auto& n : item_cache) {
             if (
@@ -235,12 +293,20 @@ ss::future<> replicate_batcher::flush(
               || n->get_expected_term().value() == term) {
                 auto [batches, units] = n->release_data();
                 item_memory_units.adopt(std::move(units));
+                _ptr->_probe->replicate_batcher_wait(now - n->enqueued_at());
+                request_trace::add_span(
+                  n->trace(), "raft.batcher_wait", n->enqueued_at(), now);
                 if (
                   n->get_consistency_level() == consistency_level::quorum_ack) {
                     needs_flush = flush_after_append::yes;
                 }
                 for (auto& b : batches) {
                     b.set_term(term);
+                    if (
+                      b.header().attrs.compression()
+                      == model::compression::none) {
+                        uncompressed_bytes += b.size_bytes();
+                    }
                     data.push_back(std::move(b));
                 }
                 notifications.push_back(std::move(n));
@@ -270,7 +336,8 @@ ss::future<> replicate_batcher::flush(
           std::move(notifications),
           std::move(req),
           std::move(units),
-          std::move(seqs));
+          std::move(seqs),
+          uncompressed_bytes);
     } catch (...) {
         for (auto& i : item_cache) {
             i->set_exception(std::current_exception());
@@ -302,6 +369,23 @@ static void propagate_result(
     }
 }
 
+static void trace_replication(
+  const std::vector<replicate_batcher::item_ptr>& notifications,
+  const replicate_entries_stm& stm,
+  ss::steady_clock_type::time_point appended) {
+    const auto now = ss::steady_clock_type::now();
+    for (const auto& n : notifications) {
+        auto trace = n->trace();
+        if (!trace) [[likely]] {
+            continue;
+        }
+        if (auto flush = stm.leader_flush(); flush) {
+            trace->add_span("raft.leader_fsync", flush->first, flush->second);
+        }
+        trace->add_span("raft.replicate_quorum", appended, now);
+    }
+}
+
 static void propagate_current_exception(
   std::vector<replicate_batcher::item_ptr>& notifications) {
     // iterate backward to calculate last offsets
@@ -315,14 +399,24 @@ ss::future<> replicate_batcher::do_flush(
   std::vector<replicate_batcher::item_ptr> notifications,
   append_entries_request req,
   std::vector<ssx::semaphore_units> u,
-  absl::flat_hash_map<vnode, follower_req_seq> seqs) {
+  absl::flat_hash_map<vnode, follower_req_seq> seqs,
+  size_t uncompressed_bytes) {
     auto needs_flush = req.is_flush_required();
     _ptr->_probe->replicate_batch_flushed();
     auto stm = ss::make_lw_shared<replicate_entries_stm>(
-      _ptr, std::move(req), std::move(seqs));
+      _ptr, std::move(req), std::move(seqs), uncompressed_bytes);
     try {
         auto holder = _bg.hold();
+        const auto start = ss::steady_clock_type::now();
         auto leader_result = co_await stm->apply(std::move(u));
+        const auto appended = ss::steady_clock_type::now();
+        update_flush_latency(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+            appended - start));
+        for (const auto& n : notifications) {
+            request_trace::add_span(
+              n->trace(), "raft.leader_append", start, appended);
+        }
 
         /**
          * First phase, if leader result has error just propagate error
@@ -346,8 +440,11 @@ ss::future<> replicate_batcher::do_flush(
         if (leader_result && needs_flush) {
             (void)stm->wait_for_majority()
               .then([holder = std::move(holder),
-                     notifications = std::move(notifications)](
+                     notifications = std::move(notifications),
+                     stm,
+                     appended](
                       result<replicate_result> quorum_result) mutable {
+                  trace_replication(notifications, *stm, appended);
                   propagate_result(
                     quorum_result, notifications, [](const item_ptr& item) {
                         return item->get_consistency_level()
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "config/property.h"
 #include "model/record_batch_reader.h"
 #include "outcome.h"
 #include "raft/types.h"
@@ -18,6 +19,7 @@
 #include "units.h"
 #include "utils/mutex.h"
 
+#include <seastar/core/condition_variable.hh>
 #include <seastar/core/gate.hh>
 
 #include <absl/container/flat_hash_map.h>
@@ -34,12 +36,15 @@ public:
           ssx::semaphore_units u,
           std::optional<model::term_id> expected_term,
           consistency_level c_lvl,
-          std::optional<std::chrono::milliseconds> timeout)
+          std::optional<std::chrono::milliseconds> timeout,
+          request_trace* trace)
           : _record_count(record_count)
           , _data(std::move(batches))
           , _units(std::move(u))
           , _expected_term(expected_term)
-          , _consistency_lvl(c_lvl) {
+          , _consistency_lvl(c_lvl)
+          , _enqueued_at(ss::steady_clock_type::now())
+          , _trace(trace) {
             _timeout_timer.set_callback([this] { expire_with_timeout(); });
             if (timeout) {
                 _timeout_timer.arm(timeout.value());
@@ -62,6 +67,12 @@ public:
         consistency_level get_consistency_level() const {
             return _consistency_lvl;
         }
+        ss::steady_clock_type::time_point enqueued_at() const {
+            return _enqueued_at;
+        }
+        // the request may complete (e.g. time out) before the item is done
+        // with, its trace must not be touched afterwards
+        request_trace* trace() const { return _ready ? nullptr : _trace; }
 
         auto release_data() {
             return std::make_tuple(std::move(_data), std::move(_units));
@@ -103,6 +114,8 @@ public:
         // consistency level is stored to distinguish when an item promise
         // should be signaled with replication result
         consistency_level _consistency_lvl;
+        ss::steady_clock_type::time_point _enqueued_at;
+        request_trace* _trace;
         /**
          * Item keeps semaphore units until replicate batcher is done with
          * processing the request.
@@ -113,7 +126,10 @@ public:
         ss::promise<result<replicate_result>> _promise;
     };
     using item_ptr = ss::lw_shared_ptr<item>;
-    explicit replicate_batcher(consensus* ptr, size_t cache_size);
+    replicate_batcher(
+      consensus* ptr,
+      size_t cache_size,
+      config::binding<std::chrono::milliseconds> max_linger);
 
     replicate_batcher(replicate_batcher&&) noexcept = default;
     replicate_batcher& operator=(replicate_batcher&&) noexcept = delete;
@@ -125,43 +141,70 @@ public:
       std::optional<model::term_id>,
       model::record_batch_reader,
       consistency_level,
-      std::optional<std::chrono::milliseconds> = std::nullopt);
+      std::optional<std::chrono::milliseconds> = std::nullopt,
+      request_trace* = nullptr);
 
     ss::future<> flush(ssx::semaphore_units u, bool const transfer_flush);
 
     ss::future<> stop();
 
 private:
+    /**
+     * Adaptive linger. At moderate load every flush carries only the few
+     * requests that arrived while the previous one was in flight. Before a
+     * background flush the batcher may therefore wait for a short window so
+     * that more requests are coalesced into one append entries request. The
+     * window is a fraction of the recent flush latency, bounded by
+     * raft_replicate_batcher_max_linger_ms, and it is skipped (or cut short)
+     * once enough bytes are queued for the flush to be worthwhile anyway.
+     */
+    static constexpr int linger_latency_fraction = 4;
+    std::chrono::microseconds linger_window() const;
+    ss::future<> maybe_linger();
+    size_t linger_bytes_threshold() const { return _max_batch_size / 2; }
+    void update_flush_latency(std::chrono::microseconds);
+
     ss::future<> do_flush(
       std::vector<item_ptr>,
       append_entries_request,
       std::vector<ssx::semaphore_units>,
-      absl::flat_hash_map<vnode, follower_req_seq>);
+      absl::flat_hash_map<vnode, follower_req_seq>,
+      size_t uncompressed_bytes);
 
     ss::future<item_ptr> do_cache(
       std::optional<model::term_id>,
       model::record_batch_reader,
       consistency_level,
-      std::optional<std::chrono::milliseconds>);
+      std::optional<std::chrono::milliseconds>,
+      request_trace*);
 
     ss::future<replicate_batcher::item_ptr> do_cache_with_backpressure(
       std::optional<model::term_id>,
       ss::circular_buffer<model::record_batch>,
       size_t,
       consistency_level,
-      std::optional<std::chrono::milliseconds>);
+      std::optional<std::chrono::milliseconds>,
+      request_trace*);
 
     ss::future<result<replicate_result>> cache_and_wait_for_result(
       ss::promise<> enqueued,
       std::optional<model::term_id> expected_term,
       model::record_batch_reader r,
       consistency_level consistency_lvl,
-      std::optional<std::chrono::milliseconds> timeout);
+      std::optional<std::chrono::milliseconds> timeout,
+      request_trace* trace);
 
     consensus* _ptr;
     ssx::semaphore _max_batch_size_sem;
     size_t _max_batch_size;
     std::vector<item_ptr> _item_cache;
+    // bytes of the requests in _item_cache
+    size_t _item_cache_bytes{0};
+    config::binding<std::chrono::milliseconds> _max_linger;
+    // moving average of the time it takes the leader to append and dispatch
+    // one flush
+    std::chrono::microseconds _flush_latency{0};
+    ss::condition_variable _linger_cv;
     mutex _lock;
     ss::gate _bg;
     // If true, a background flush must be pending. Used to coalesce
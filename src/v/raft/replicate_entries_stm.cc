@@ -54,7 +54,10 @@ ss::future<result<append_entries_reply>> replicate_entries_stm::flush_log() {
     using ret_t = result<append_entries_reply>;
     auto flush_f = ss::now();
     if (_is_flush_required) {
-        flush_f = _ptr->flush_log().discard_result();
+        flush_f = _ptr->flush_log().discard_result().then(
+          [this, start = ss::steady_clock_type::now()] {
+              _leader_flush = {start, ss::steady_clock_type::now()};
+          });
     }
 
     auto f = flush_f
@@ -101,6 +104,7 @@ replicate_entries_stm::send_append_entries_request(
 
     auto opts = rpc::client_opts(append_entries_timeout());
     opts.resource_units = ss::make_foreign<ss::lw_shared_ptr<units_t>>(_units);
+    _ptr->maybe_compress_append_entries(opts, _uncompressed_bytes);
 
     auto f = _ptr->_fstats.get_append_entries_unit(n).then_wrapped(
       [this, batches = std::move(batches), opts = std::move(opts), n](
@@ -117,6 +121,7 @@ replicate_entries_stm::send_append_entries_request(
                 make_error_code(errc::append_entries_dispatch_error));
           }
           auto u = f.get();
+          const auto sent_at = ss::steady_clock_type::now();
 
           return _ptr->_client_protocol
             .append_entries(
@@ -125,8 +130,12 @@ replicate_entries_stm::send_append_entries_request(
                 _ptr->self(), n, _meta, std::move(batches), _is_flush_required),
               std::move(opts),
               _ptr->use_all_serde_append_entries())
-            .then([this, target_node_id = n.id()](
+            .then([this, target_node_id = n.id(), sent_at](
                     result<append_entries_reply> reply) {
+                if (reply) {
+                    _ptr->get_probe().follower_append_entries(
+                      ss::steady_clock_type::now() - sent_at);
+                }
                 return _ptr->validate_reply_target_node(
                   "append_entries_replicate", reply, target_node_id);
             })
@@ -286,7 +295,10 @@ ss::future<result<replicate_result>> replicate_entries_stm::apply(units_t u) {
         }
     });
     _units = ss::make_lw_shared<units_t>(std::move(u));
+    const auto append_started = ss::steady_clock_type::now();
     _append_result = co_await append_to_self();
+    _appended_at = ss::steady_clock_type::now();
+    _ptr->get_probe().leader_append(_appended_at - append_started);
 
     if (!_append_result) {
         co_return build_replicate_result();
@@ -368,6 +380,8 @@ replicate_entries_stm::wait_for_majority() {
     };
     try {
         co_await _ptr->_commit_index_updated.wait(stop_cond);
+        _ptr->get_probe().replicate_commit(
+          ss::steady_clock_type::now() - _appended_at);
         co_return process_result(appended_offset, appended_term);
 
     } catch (const ss::broken_condition_variable&) {
@@ -436,11 +450,13 @@ ss::future<> replicate_entries_stm::wait_for_shutdown() {
 replicate_entries_stm::replicate_entries_stm(
   consensus* p,
   append_entries_request r,
-  absl::flat_hash_map<vnode, follower_req_seq> seqs)
+  absl::flat_hash_map<vnode, follower_req_seq> seqs,
+  size_t uncompressed_bytes)
   : _ptr(p)
   , _meta(r.metadata())
   , _is_flush_required(r.is_flush_required())
   , _batches(std::move(r).release_batches())
+  , _uncompressed_bytes(uncompressed_bytes)
   , _followers_seq(std::move(seqs))
   , _ctxlog(_ptr->_ctxlog) {}
 
@@ -88,10 +88,13 @@ namespace raft {
 class replicate_entries_stm {
 public:
     using units_t = std::vector<ssx::semaphore_units>;
+    /// \param uncompressed_bytes size of the uncompressed batches in the
+    /// request, used to decide if follower requests should be compressed
     replicate_entries_stm(
       consensus*,
       append_entries_request,
-      absl::flat_hash_map<vnode, follower_req_seq>);
+      absl::flat_hash_map<vnode, follower_req_seq>,
+      size_t uncompressed_bytes = 0);
     ~replicate_entries_stm();
 
     /// caller have to pass semaphore units, the apply call will do the
@@ -105,6 +108,14 @@ public:
      */
     ss::future<result<replicate_result>> wait_for_majority();
 
+    using flush_interval = std::pair<
+      ss::steady_clock_type::time_point,
+      ss::steady_clock_type::time_point>;
+    /// start and end of the last flush of the leader log, once completed
+    std::optional<flush_interval> leader_flush() const {
+        return _leader_flush;
+    }
+
     /**
      * Waits for all related background future to finish - required to be called
      * before destorying the stm
@@ -134,6 +145,7 @@ private:
     protocol_metadata _meta;
     flush_after_append _is_flush_required;
     std::optional<model::record_batch_reader> _batches;
+    size_t _uncompressed_bytes;
     absl::flat_hash_map<vnode, follower_req_seq> _followers_seq;
     absl::flat_hash_map<vnode, consensus::suppress_heartbeats_guard> _hb_guards;
     mutex _share_mutex;
@@ -144,6 +156,8 @@ private:
     model::offset _initial_committed_offset;
     ss::lw_shared_ptr<std::vector<ssx::semaphore_units>> _units;
     std::optional<result<storage::append_result>> _append_result;
+    ss::steady_clock_type::time_point _appended_at;
+    std::optional<flush_interval> _leader_flush;
     uint16_t _requests_count = 0;
 };
 
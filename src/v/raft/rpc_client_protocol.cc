@@ -23,6 +23,7 @@ namespace raft {
 
 ss::future<result<vote_reply>> rpc_client_protocol::vote(
   model::node_id n, vote_request&& r, rpc::client_opts opts) {
+    opts.priority = rpc::send_priority::control;
     auto timeout = opts.timeout;
     return _connection_cache.local().with_node_client<raftgen_client_protocol>(
       _self,
@@ -42,10 +43,14 @@ ss::future<result<append_entries_reply>> rpc_client_protocol::append_entries(
   rpc::client_opts opts,
   bool use_all_serde_encoding) {
     auto timeout = opts.timeout;
+    // all appends of a group use the same connection so they are not reordered
+    const rpc::connection_cache::stream_key stream{
+      static_cast<uint64_t>(r.target_group()())};
     return _connection_cache.local().with_node_client<raftgen_client_protocol>(
       _self,
       ss::this_shard_id(),
       n,
+      stream,
       timeout,
       [r = std::move(r), opts = std::move(opts), use_all_serde_encoding](
         raftgen_client_protocol client) mutable {
@@ -63,6 +68,7 @@ ss::future<result<append_entries_reply>> rpc_client_protocol::append_entries(
 
 ss::future<result<heartbeat_reply>> rpc_client_protocol::heartbeat(
   model::node_id n, heartbeat_request&& r, rpc::client_opts opts) {
+    opts.priority = rpc::send_priority::control;
     auto timeout = opts.timeout;
     return _connection_cache.local().with_node_client<raftgen_client_protocol>(
       _self,
@@ -77,6 +83,7 @@ ss::future<result<heartbeat_reply>> rpc_client_protocol::heartbeat(
 }
 ss::future<result<heartbeat_reply_v2>> rpc_client_protocol::heartbeat_v2(
   model::node_id n, heartbeat_request_v2&& r, rpc::client_opts opts) {
+    opts.priority = rpc::send_priority::control;
     auto timeout = opts.timeout;
     return _connection_cache.local().with_node_client<raftgen_client_protocol>(
       _self,
@@ -93,6 +100,7 @@ ss::future<result<heartbeat_reply_v2>> rpc_client_protocol::heartbeat_v2(
 ss::future<result<install_snapshot_reply>>
 rpc_client_protocol::install_snapshot(
   model::node_id n, install_snapshot_request&& r, rpc::client_opts opts) {
+    opts.priority = rpc::send_priority::recovery;
     auto timeout = opts.timeout;
     return _connection_cache.local().with_node_client<raftgen_client_protocol>(
       _self,
@@ -108,6 +116,7 @@ rpc_client_protocol::install_snapshot(
 
 ss::future<result<timeout_now_reply>> rpc_client_protocol::timeout_now(
   model::node_id n, timeout_now_request&& r, rpc::client_opts opts) {
+    opts.priority = rpc::send_priority::control;
     auto timeout = opts.timeout;
     return _connection_cache.local().with_node_client<raftgen_client_protocol>(
       _self,
@@ -157,6 +166,7 @@ ss::future<bool> rpc_client_protocol::ensure_disconnect(model::node_id n) {
 ss::future<result<transfer_leadership_reply>>
 rpc_client_protocol::transfer_leadership(
   model::node_id n, transfer_leadership_request&& r, rpc::client_opts opts) {
+    opts.priority = rpc::send_priority::control;
     auto timeout = opts.timeout;
     return _connection_cache.local().with_node_client<raftgen_client_protocol>(
       _self,
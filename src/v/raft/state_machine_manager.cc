@@ -14,6 +14,7 @@
 #include "bytes/iostream.h"
 #include "config/property.h"
 #include "model/fundamental.h"
+#include "model/record_batch_reader.h"
 #include "model/timeout_clock.h"
 #include "raft/consensus.h"
 #include "raft/logger.h"
@@ -197,6 +198,7 @@ ss::future<> state_machine_manager::stop() {
       "stopping state machine manager with {} state machines",
       _machines.size());
     _apply_mutex.broken();
+    _stm_available.broken();
     _as.request_abort();
 
     co_await _gate.close();
@@ -301,6 +303,27 @@ ss::future<> state_machine_manager::apply() {
             co_return co_await apply_raft_snapshot();
         }
 
+        // collect STMs which has the same _next offset as the offset in
+        // manager and are not applying in a separate fiber, taking their
+        // mutexes for the time of the apply
+        std::vector<std::pair<entry_ptr, mutex::units>> machines;
+        for (auto& [_, entry] : _machines) {
+            if (entry->stm->next() != _next) {
+                continue;
+            }
+            auto units = entry->background_apply_mutex.try_get_units();
+            if (units) {
+                machines.emplace_back(entry, std::move(*units));
+            }
+        }
+        /**
+         * All the STMs are busy applying previous batches, wait for one of
+         * them to finish instead of reading the same batches again.
+         */
+        if (machines.empty()) {
+            co_return co_await _stm_available.wait();
+        }
+
         /**
          * Raft make_reader method allows callers reading up to
          * last_visible index. In order to make the STMs safe and working
@@ -318,35 +341,60 @@ ss::future<> state_machine_manager::apply() {
          */
         storage::log_reader_config config(
           _next, _raft->committed_offset(), ss::default_priority_class());
+        config.max_bytes = apply_read_max_bytes;
 
         model::record_batch_reader reader = co_await _raft->make_reader(config);
-        // collect STMs which has the same _next offset as the offset in
-        // manager and there is no background apply taking place
-        std::vector<entry_ptr> machines;
-        for (auto& [_, entry] : _machines) {
-            /**
-             * We can simply check if a mutex is ready here as calling
-             * maybe_start_background_apply() will make the mutex underlying
-             * semaphore immediately not ready as there are no scheduling points
-             * before calling `get_units`
-             */
-            if (
-              entry->stm->next() == _next
-              && entry->background_apply_mutex.ready()) {
-                machines.push_back(entry);
-            }
+        /**
+         * Batches are read and decoded once and shared by all the STMs. Each
+         * STM applies them in its own fiber, the manager moves on as soon as
+         * any of the STMs applied the batches so that a slow STM does not
+         * hold back the others. An STM that is left behind catches up in the
+         * background apply fiber.
+         */
+        auto batches = ss::make_lw_shared(
+          co_await model::consume_reader_to_memory(
+            std::move(reader), model::no_timeout));
+        auto round = ss::make_lw_shared<apply_round>();
+        round->pending = machines.size();
+        round->next = _next;
+        const auto prev_next = _next;
+        for (auto& [entry, units] : machines) {
+            ssx::spawn_with_gate(
+              _gate,
+              [this,
+               entry = entry,
+               units = std::move(units),
+               batches,
+               round]() mutable {
+                  return apply_to_stm(entry, *batches)
+                    .finally([this,
+                              entry,
+                              units = std::move(units),
+                              batches,
+                              round]() mutable {
+                        round->next = std::max(round->next, entry->stm->next());
+                        --round->pending;
+                        round->progress.broadcast();
+                        units.return_all();
+                        _stm_available.broadcast();
+                        if (!_as.abort_requested()) {
+                            maybe_start_background_apply(entry);
+                        }
+                    });
+              });
         }
-        auto last_applied = co_await std::move(reader).consume(
-          batch_applicator(default_ctx, machines, _as, _log),
-          model::no_timeout);
+        co_await round->progress.wait([round, prev_next] {
+            return round->next > prev_next || round->pending == 0;
+        });
 
-        _next = std::max(model::next_offset(last_applied), _next);
+        _next = std::max(round->next, _next);
         vlog(_log.trace, "updating _next offset with: {}", _next);
     } catch (const ss::timed_out_error&) {
         vlog(_log.debug, "state machine apply timeout");
     } catch (const ss::abort_requested_exception&) {
     } catch (const ss::gate_closed_exception&) {
     } catch (const ss::broken_semaphore&) {
+    } catch (const ss::broken_condition_variable&) {
     } catch (...) {
         vlog(
           _log.warn, "manager apply exception: {}", std::current_exception());
@@ -361,6 +409,17 @@ ss::future<> state_machine_manager::apply() {
     }
 }
 
+ss::future<> state_machine_manager::apply_to_stm(
+  entry_ptr entry, ss::circular_buffer<model::record_batch>& batches) {
+    batch_applicator applicator(default_ctx, {entry}, _as, _log);
+    for (auto& batch : batches) {
+        auto stop = co_await applicator(batch.share());
+        if (stop) {
+            break;
+        }
+    }
+}
+
 void state_machine_manager::maybe_start_background_apply(
   const entry_ptr& entry) {
     if (likely(entry->stm->next() == _next)) {
@@ -385,7 +444,10 @@ void state_machine_manager::maybe_start_background_apply(
               return ss::with_scheduling_group(
                        _apply_sg,
                        [this, entry] { return background_apply_fiber(entry); })
-                .finally([u = std::move(u)] {});
+                .finally([this, u = std::move(u)]() mutable {
+                    u.return_all();
+                    _stm_available.broadcast();
+                });
           });
     });
 }
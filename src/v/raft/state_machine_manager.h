@@ -20,8 +20,11 @@
 #include "serde/envelope.h"
 #include "storage/snapshot.h"
 #include "storage/types.h"
+#include "units.h"
 #include "utils/mutex.h"
 
+#include <seastar/core/circular_buffer.hh>
+#include <seastar/core/condition-variable.hh>
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/shared_ptr.hh>
 
@@ -43,7 +46,9 @@ concept StateMachineIterateFunc = requires(
 /**
  * State machine manager is an entry point for registering state machines
  * built on top of replicated log. State machine managers uses a single
- * fiber to read and apply record batches to all managed state machines.
+ * fiber to read and decode record batches, the batches are then applied to all
+ * managed state machines concurrently, each of them progressing at its own
+ * pace.
  *
  * When a machine throws an exception or timeouts when applying batches to
  * its state subsequent applies are executed in the separate apply fiber
@@ -96,6 +101,8 @@ private:
     friend class state_machine_manager_builder;
     static constexpr const char* default_ctx = "default";
     static constexpr const char* background_ctx = "background";
+    // upper bound of batches read and held in memory for a single apply round
+    static constexpr size_t apply_read_max_bytes = 1_MiB;
 
     struct state_machine_entry {
         explicit state_machine_entry(ss::shared_ptr<state_machine_base> stm)
@@ -112,6 +119,12 @@ private:
     };
     using entry_ptr = ss::lw_shared_ptr<state_machine_entry>;
     using state_machines_t = absl::flat_hash_map<ss::sstring, entry_ptr>;
+    // progress of the STMs applying batches read in a single apply round
+    struct apply_round {
+        model::offset next;
+        size_t pending{0};
+        ss::condition_variable progress;
+    };
 
     void maybe_start_background_apply(const entry_ptr&);
     ss::future<> background_apply_fiber(entry_ptr);
@@ -120,6 +133,8 @@ private:
     ss::future<> do_apply_raft_snapshot(
       raft::snapshot_metadata metadata, storage::snapshot_reader& reader);
     ss::future<> apply();
+    ss::future<>
+    apply_to_stm(entry_ptr, ss::circular_buffer<model::record_batch>&);
 
     ss::future<std::vector<ssx::semaphore_units>>
     acquire_background_apply_mutexes();
@@ -144,6 +159,8 @@ private:
     ctx_log _log;
     mutex _apply_mutex;
     state_machines_t _machines;
+    // signalled when an STM finished applying outside of the manager fiber
+    ss::condition_variable _stm_available;
     model::offset _next{0};
     ss::gate _gate;
     ss::abort_source _as;
@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/record.h"
@@ -18,6 +19,9 @@
 #include "storage/record_batch_builder.h"
 #include "test_utils/async.h"
 #include "test_utils/test.h"
+#include "units.h"
+
+#include <seastar/util/defer.hh>
 
 #include <algorithm>
 
@@ -103,6 +107,108 @@ TEST_F_CORO(raft_fixture, validate_recovery) {
     co_await assert_logs_equal();
 }
 
+TEST_F_CORO(raft_fixture, validate_recovery_with_read_ahead) {
+    config::shard_local_cfg().raft_recovery_read_ahead.set_value(true);
+    auto deferred = ss::defer([] {
+        config::shard_local_cfg().raft_recovery_read_ahead.reset();
+    });
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+
+    // stop one of the nodes
+    co_await stop_node(model::node_id(2));
+
+    leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+
+    // replicate enough data for the recovery to take multiple rounds
+    for (int i = 0; i < 20; ++i) {
+        auto result = co_await leader_node.raft()->replicate(
+          make_batches(10, 10, 1_KiB),
+          replicate_options(consistency_level::quorum_ack));
+        ASSERT_TRUE_CORO(result.has_value());
+    }
+
+    auto& new_n2 = add_node(model::node_id(2), model::revision_id(0));
+    co_await new_n2.init_and_start(all_vnodes());
+
+    // wait for committed offset to propagate
+    auto committed_offset = leader_node.raft()->committed_offset();
+    co_await wait_for_committed_offset(committed_offset, 10s);
+
+    auto all_batches = co_await leader_node.read_all_data_batches();
+
+    ASSERT_EQ_CORO(all_batches.size(), 200);
+
+    co_await assert_logs_equal();
+}
+
+TEST_F_CORO(raft_fixture, validate_replication_with_compression) {
+    config::shard_local_cfg().raft_replication_compression.set_value(true);
+    auto deferred = ss::defer([] {
+        config::shard_local_cfg().raft_replication_compression.reset();
+    });
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+    co_await stop_node(model::node_id(2));
+    leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+
+    // both the replicate path and the recovery of the stopped node send
+    // requests large enough to be compressed
+    for (int i = 0; i < 10; ++i) {
+        auto result = co_await leader_node.raft()->replicate(
+          make_batches(10, 10, 1_KiB),
+          replicate_options(consistency_level::quorum_ack));
+        ASSERT_TRUE_CORO(result.has_value());
+    }
+
+    auto& new_n2 = add_node(model::node_id(2), model::revision_id(0));
+    co_await new_n2.init_and_start(all_vnodes());
+
+    auto committed_offset = leader_node.raft()->committed_offset();
+    co_await wait_for_committed_offset(committed_offset, 10s);
+
+    co_await assert_logs_equal();
+}
+
+TEST_F_CORO(raft_fixture, validate_leader_lease_barrier) {
+    config::shard_local_cfg().raft_enable_leader_lease.set_value(true);
+    auto deferred = ss::defer([] {
+        config::shard_local_cfg().raft_enable_leader_lease.reset();
+    });
+    co_await create_simple_group(3);
+    auto leader = co_await wait_for_leader(10s);
+    auto& leader_node = node(leader);
+
+    auto result = co_await leader_node.raft()->replicate(
+      make_batches({{"k_1", "v_1"}, {"k_2", "v_2"}, {"k_3", "v_3"}}),
+      replicate_options(consistency_level::quorum_ack));
+    ASSERT_TRUE_CORO(result.has_value());
+
+    // heartbeats acknowledged by the followers establish the lease
+    co_await tests::cooperative_spin_wait_with_timeout(10s, [&leader_node] {
+        return leader_node.raft()->has_leader_lease();
+    });
+    auto barrier = co_await leader_node.raft()->linearizable_barrier();
+    ASSERT_TRUE_CORO(barrier.has_value());
+    ASSERT_EQ_CORO(barrier.value(), leader_node.raft()->committed_offset());
+
+    // without a majority the lease expires
+    std::vector<model::node_id> followers;
+    for (auto& [id, _] : nodes()) {
+        if (id != leader) {
+            followers.push_back(id);
+        }
+    }
+    for (auto id : followers) {
+        co_await stop_node(id);
+    }
+    co_await tests::cooperative_spin_wait_with_timeout(10s, [&leader_node] {
+        return !leader_node.raft()->has_leader_lease();
+    });
+}
+
 TEST_F_CORO(raft_fixture, validate_adding_nodes_to_cluster) {
     co_await create_simple_group(1);
     // wait for leader
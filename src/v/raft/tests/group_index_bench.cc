@@ -0,0 +1,99 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "raft/group_index.h"
+#include "random/generators.h"
+
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <boost/container/flat_set.hpp>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace {
+// stand in for the consensus instance, large enough for instances not to
+// share cache lines
+struct group_stub {
+    explicit group_stub(raft::group_id g)
+      : group(g) {}
+    raft::group_id group;
+    std::array<char, 1024> state{};
+};
+
+using group_ptr = ss::lw_shared_ptr<group_stub>;
+
+// previous heartbeat_manager layout, comparing groups through the pointers
+struct by_group_id {
+    using is_transparent = std::true_type;
+    bool operator()(const group_ptr& l, const group_ptr& r) const {
+        return l->group < r->group;
+    }
+    bool operator()(const group_ptr& p, raft::group_id g) const {
+        return p->group < g;
+    }
+    bool operator()(raft::group_id g, const group_ptr& p) const {
+        return g < p->group;
+    }
+};
+} // namespace
+
+struct group_index_bench {
+    static constexpr size_t groups = 100'000;
+    static constexpr size_t lookups = 10'000;
+
+    group_index_bench() {
+        raft::group_id g{0};
+        std::vector<group_ptr> ptrs;
+        ptrs.reserve(groups);
+        for (size_t i = 0; i < groups; ++i) {
+            // group ids of a shard are sparse, groups are spread over shards
+            g += raft::group_id(random_generators::get_int(1, 16));
+            ptrs.push_back(ss::make_lw_shared<group_stub>(g));
+        }
+        // allocate in random order so that the instances are not laid out in
+        // group id order, as in a long running broker
+        std::shuffle(
+          ptrs.begin(), ptrs.end(), random_generators::internal::gen);
+        for (auto& p : ptrs) {
+            index.insert(p->group, p);
+            set.insert(p);
+            targets.push_back(p->group);
+        }
+        std::shuffle(
+          targets.begin(), targets.end(), random_generators::internal::gen);
+        targets.resize(lookups);
+    }
+
+    raft::group_index<group_ptr> index;
+    boost::container::flat_set<group_ptr, by_group_id> set;
+    std::vector<raft::group_id> targets;
+};
+
+PERF_TEST_F(group_index_bench, group_index_lookup) {
+    perf_tests::start_measuring_time();
+    for (auto g : targets) {
+        perf_tests::do_not_optimize(index.find(g));
+    }
+    perf_tests::stop_measuring_time();
+    return targets.size();
+}
+
+PERF_TEST_F(group_index_bench, pointer_set_lookup) {
+    perf_tests::start_measuring_time();
+    for (auto g : targets) {
+        perf_tests::do_not_optimize(set.find(g));
+    }
+    perf_tests::stop_measuring_time();
+    return targets.size();
+}
@@ -0,0 +1,52 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "raft/group_index.h"
+#include "random/generators.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+
+SEASTAR_THREAD_TEST_CASE(group_index_matches_map) {
+    raft::group_index<int> index;
+    std::map<raft::group_id, int> expected;
+
+    for (int i = 0; i < 2000; ++i) {
+        auto g = raft::group_id(random_generators::get_int(0, 500));
+        if (random_generators::get_int(0, 2) == 0) {
+            BOOST_REQUIRE_EQUAL(index.erase(g), expected.erase(g) == 1);
+        } else {
+            BOOST_REQUIRE_EQUAL(
+              index.insert(g, i), expected.emplace(g, i).second);
+        }
+    }
+
+    BOOST_REQUIRE_EQUAL(index.size(), expected.size());
+    for (int g = 0; g <= 500; ++g) {
+        auto it = expected.find(raft::group_id(g));
+        auto found = index.find(raft::group_id(g));
+        BOOST_REQUIRE_EQUAL(found != nullptr, it != expected.end());
+        BOOST_REQUIRE_EQUAL(
+          index.contains(raft::group_id(g)), found != nullptr);
+        if (found) {
+            BOOST_REQUIRE_EQUAL(*found, it->second);
+        }
+    }
+
+    // values are iterated in group id order
+    auto it = expected.begin();
+    for (auto v : index) {
+        BOOST_REQUIRE_EQUAL(v, it->second);
+        ++it;
+    }
+    BOOST_REQUIRE(it == expected.end());
+}
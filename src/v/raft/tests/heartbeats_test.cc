@@ -50,6 +50,7 @@ raft::heartbeat_request_v2 random_request() {
               .prev_log_index = tests::random_named_int<model::offset>(),
               .prev_log_term = tests::random_named_int<model::term_id>(),
               .last_visible_index = tests::random_named_int<model::offset>(),
+              .quiescent = tests::random_bool(),
             };
             hb.data = data;
         }
@@ -371,6 +371,7 @@ raft_node_instance::raft_node_instance(
         .max_recovery_memory = config::mock_binding<std::optional<size_t>>(
           200_MiB),
         .default_read_buffer_size = config::mock_binding<size_t>(128_KiB),
+        .bulk_read_buffer_size = config::mock_binding<size_t>(1_MiB),
       };
   })
   , _recovery_scheduler(
@@ -397,6 +398,7 @@ raft_node_instance::raft_node_instance(
         .max_recovery_memory = config::mock_binding<std::optional<size_t>>(
           200_MiB),
         .default_read_buffer_size = config::mock_binding<size_t>(128_KiB),
+        .bulk_read_buffer_size = config::mock_binding<size_t>(1_MiB),
       };
   })
   , _recovery_scheduler(
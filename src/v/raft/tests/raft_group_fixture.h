@@ -102,6 +102,7 @@ struct raft_node {
             .max_recovery_memory = config::mock_binding<std::optional<size_t>>(
               std::nullopt),
             .default_read_buffer_size = config::mock_binding(512_KiB),
+            .bulk_read_buffer_size = config::mock_binding(4_MiB),
           };
       }) {
         feature_table.start().get();
@@ -0,0 +1,227 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/configuration.h"
+#include "model/record_batch_reader.h"
+#include "raft/tests/raft_fixture.h"
+#include "raft/types.h"
+#include "random/generators.h"
+#include "serde/serde.h"
+#include "ssx/sformat.h"
+#include "storage/record_batch_builder.h"
+#include "test_utils/async.h"
+#include "test_utils/test.h"
+#include "units.h"
+#include "utils/hdr_hist.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/loop.hh>
+#include <seastar/coroutine/parallel_for_each.hh>
+#include <seastar/util/log.hh>
+
+#include <boost/range/irange.hpp>
+
+using namespace raft;
+
+/*
+ * In process replication benchmark. It runs a number of independent three
+ * replica groups, each of the replicas hosted by a separate node instance
+ * connected with the in memory protocol, and drives all of them concurrently
+ * with replicate requests. It reports the throughput and the end to end
+ * replicate latency, the latency breakdown of the replication stages is
+ * available from the raft probe histograms.
+ */
+
+namespace {
+static ss::logger benchlog("replication-bench");
+
+struct bench_group final : public raft_node_map {
+    bench_group(size_t id, ss::sharded<features::feature_table>& features)
+      : id(id)
+      , features(features) {}
+
+    std::optional<std::reference_wrapper<raft_node_instance>>
+    node_for(model::node_id id) final {
+        auto it = nodes.find(id);
+        if (it == nodes.end()) {
+            return std::nullopt;
+        }
+        return *it->second;
+    }
+
+    ss::future<> start(size_t replicas) {
+        std::vector<vnode> vnodes;
+        for (auto i : boost::irange(replicas)) {
+            model::node_id node_id(static_cast<int32_t>(i));
+            auto instance = std::make_unique<raft_node_instance>(
+              node_id,
+              model::revision_id(0),
+              ssx::sformat(
+                "replication_bench_{}_{}_{}",
+                id,
+                i,
+                random_generators::gen_alphanum_string(8)),
+              *this,
+              features,
+              [](leadership_status) {});
+            vnodes.push_back(instance->get_vnode());
+            nodes.emplace(node_id, std::move(instance));
+        }
+        co_await ss::coroutine::parallel_for_each(nodes, [&vnodes](auto& p) {
+            return p.second->init_and_start(vnodes);
+        });
+    }
+
+    ss::future<> stop() {
+        co_await ss::coroutine::parallel_for_each(
+          nodes, [](auto& p) { return p.second->stop(); });
+        co_await ss::coroutine::parallel_for_each(
+          nodes, [](auto& p) { return p.second->remove_data(); });
+        nodes.clear();
+    }
+
+    ss::lw_shared_ptr<consensus> leader() {
+        for (auto& [_, n] : nodes) {
+            if (n->raft()->is_leader()) {
+                return n->raft();
+            }
+        }
+        return nullptr;
+    }
+
+    size_t id;
+    ss::sharded<features::feature_table>& features;
+    absl::flat_hash_map<model::node_id, std::unique_ptr<raft_node_instance>>
+      nodes;
+};
+
+model::record_batch_reader
+make_batches(size_t batch_count, size_t records, size_t payload_size) {
+    ss::circular_buffer<model::record_batch> batches;
+    batches.reserve(batch_count);
+    for (auto b_idx : boost::irange(batch_count)) {
+        storage::record_batch_builder builder(
+          model::record_batch_type::raft_data, model::offset(0));
+        for (auto r_idx : boost::irange(records)) {
+            builder.add_raw_kv(
+              serde::to_iobuf(ssx::sformat("r-{}-{}", b_idx, r_idx)),
+              serde::to_iobuf(random_generators::get_bytes(payload_size)));
+        }
+        batches.push_back(std::move(builder).build());
+    }
+    return model::make_memory_record_batch_reader(std::move(batches));
+}
+} // namespace
+
+class replication_bench : public seastar_test {
+public:
+    struct workload {
+        size_t groups;
+        consistency_level consistency;
+        // number of requests each group replicates
+        size_t requests = 500;
+        // number of requests in flight in each group
+        size_t concurrency = 8;
+        size_t records_per_request = 10;
+        size_t record_size = 1_KiB;
+    };
+
+    ss::future<> SetUpAsync() override {
+        for (auto cpu : ss::smp::all_cpus()) {
+            co_await ss::smp::submit_to(cpu, [] {
+                config::shard_local_cfg().disable_metrics.set_value(true);
+                config::shard_local_cfg().disable_public_metrics.set_value(
+                  true);
+            });
+        }
+        co_await _features.start();
+        co_await _features.invoke_on_all([](features::feature_table& ft) {
+            return ft.testing_activate_all();
+        });
+    }
+
+    ss::future<> TearDownAsync() override {
+        co_await ss::coroutine::parallel_for_each(
+          _groups, [](auto& g) { return g->stop(); });
+        _groups.clear();
+        co_await _features.stop();
+    }
+
+    ss::future<> run(workload w) {
+        for (auto i : boost::irange(w.groups)) {
+            _groups.push_back(std::make_unique<bench_group>(i, _features));
+        }
+        co_await ss::coroutine::parallel_for_each(
+          _groups, [](auto& g) { return g->start(3); });
+        co_await tests::cooperative_spin_wait_with_timeout(30s, [this] {
+            return std::all_of(
+              _groups.begin(), _groups.end(), [](const auto& g) {
+                  return g->leader() != nullptr;
+              });
+        });
+
+        hdr_hist latency;
+        size_t errors = 0;
+        const auto started = ss::steady_clock_type::now();
+        co_await ss::coroutine::parallel_for_each(
+          _groups, [&](auto& g) -> ss::future<> {
+              auto leader = g->leader();
+              co_await ss::max_concurrent_for_each(
+                boost::irange(w.requests),
+                w.concurrency,
+                [&](size_t) -> ss::future<> {
+                    auto m = latency.auto_measure();
+                    auto r = co_await leader->replicate(
+                      make_batches(1, w.records_per_request, w.record_size),
+                      replicate_options(w.consistency));
+                    if (r.has_error()) {
+                        ++errors;
+                    }
+                });
+          });
+        const auto elapsed = std::chrono::duration_cast<
+          std::chrono::duration<double>>(
+          ss::steady_clock_type::now() - started);
+
+        const auto requests = w.groups * w.requests;
+        const auto bytes = requests * w.records_per_request * w.record_size;
+        vlog(
+          benchlog.info,
+          "groups: {}, consistency: {}, requests: {}, errors: {}, "
+          "throughput: {:.1f} req/s {:.1f} MiB/s, latency us p50: {} p99: {} "
+          "p999: {} max: {}",
+          w.groups,
+          w.consistency,
+          requests,
+          errors,
+          requests / elapsed.count(),
+          bytes / elapsed.count() / 1_MiB,
+          latency.get_value_at(50.0),
+          latency.get_value_at(99.0),
+          latency.get_value_at(99.9),
+          latency.get_value_at(100.0));
+        ASSERT_EQ_CORO(errors, 0);
+    }
+
+private:
+    ss::sharded<features::feature_table> _features;
+    std::vector<std::unique_ptr<bench_group>> _groups;
+};
+
+TEST_F_CORO(replication_bench, quorum_ack_single_group) {
+    co_await run({.groups = 1, .consistency = consistency_level::quorum_ack});
+}
+
+TEST_F_CORO(replication_bench, quorum_ack_many_groups) {
+    co_await run({.groups = 32, .consistency = consistency_level::quorum_ack});
+}
+
+TEST_F_CORO(replication_bench, leader_ack_many_groups) {
+    co_await run({.groups = 32, .consistency = consistency_level::leader_ack});
+}
@@ -105,6 +105,7 @@ struct simple_raft_fixture {
                   .max_recovery_memory
                   = config::mock_binding<std::optional<size_t>>(std::nullopt),
                   .default_read_buffer_size = config::mock_binding(512_KiB),
+                  .bulk_read_buffer_size = config::mock_binding(4_MiB),
                 };
             },
             std::ref(_connections),
@@ -9,6 +9,8 @@
 
 #include "raft/tests/stm_test_fixture.h"
 
+#include <seastar/core/condition-variable.hh>
+
 using namespace raft;
 
 inline ss::logger logger("stm-test-logger");
@@ -49,6 +51,28 @@ struct throwing_kv : public simple_kv {
 
     bool _tried_applying = false;
 };
+/**
+ * STM which does not apply anything until it is unblocked.
+ */
+struct blocking_kv : public simple_kv {
+    explicit blocking_kv(raft_node_instance& rn)
+      : simple_kv(rn) {}
+
+    std::string_view get_name() const override { return "blocking_kv"; };
+
+    ss::future<> apply(const model::record_batch& batch) override {
+        co_await _unblocked.wait([this] { return !_blocked; });
+        co_await simple_kv::apply(batch);
+    }
+
+    void unblock() {
+        _blocked = false;
+        _unblocked.broadcast();
+    }
+
+    bool _blocked = true;
+    ss::condition_variable _unblocked;
+};
 /**
  * Local snapshot stm manages its own local snapshot.
  */
@@ -129,6 +153,40 @@ TEST_F_CORO(state_machine_fixture, test_apply_throwing_exception) {
     }
 }
 
+TEST_F_CORO(state_machine_fixture, test_slow_stm_does_not_block_others) {
+    create_nodes();
+    std::vector<ss::shared_ptr<simple_kv>> stms;
+    std::vector<ss::shared_ptr<blocking_kv>> blocking_stms;
+
+    for (auto& [id, node] : nodes()) {
+        raft::state_machine_manager_builder builder;
+        auto kv_stm = builder.create_stm<simple_kv>(*node);
+        auto blocking_kv_stm = builder.create_stm<blocking_kv>(*node);
+        co_await node->init_and_start(all_vnodes(), std::move(builder));
+        stms.push_back(kv_stm);
+        blocking_stms.push_back(blocking_kv_stm);
+    }
+
+    auto expected = co_await build_random_state(1000);
+    // STMs apply independently, the blocked ones do not hold back the others
+    co_await tests::cooperative_spin_wait_with_timeout(10s, [&] {
+        return std::all_of(stms.begin(), stms.end(), [&](const auto& stm) {
+            return stm->state == expected;
+        });
+    });
+
+    for (auto& stm : blocking_stms) {
+        ASSERT_TRUE_CORO(stm->state.empty());
+        stm->unblock();
+    }
+
+    co_await wait_for_apply();
+
+    for (auto& stm : blocking_stms) {
+        ASSERT_EQ_CORO(stm->state, expected);
+    }
+}
+
 TEST_F_CORO(state_machine_fixture, test_recovery_without_snapshot) {
     /**
      * Create 3 replicas group with simple_kv STM
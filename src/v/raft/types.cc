@@ -146,6 +146,11 @@ void follower_index_metadata::reset() {
     last_successful_received_seq = follower_req_seq{0};
     suppress_heartbeats_count = 0;
     last_sent_protocol_meta.reset();
+    last_full_heartbeat_timestamp = {};
+    quiescent = false;
+    lease_probe_seq = follower_req_seq{0};
+    lease_probe_sent_at = {};
+    last_acked_request_sent_at = {};
 }
 
 std::ostream& operator<<(std::ostream& o, const vnode& id) {
@@ -24,6 +24,7 @@
 #include "reflection/async_adl.h"
 #include "serde/envelope.h"
 #include "utils/named_type.h"
+#include "utils/request_trace.h"
 
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/io_priority_class.hh>
@@ -92,7 +93,16 @@ struct follower_index_metadata {
         return suppress_heartbeats_count > 0;
     }
 
-    follower_req_seq next_follower_sequence() { return ++last_sent_seq; }
+    follower_req_seq next_follower_sequence() {
+        ++last_sent_seq;
+        // leader lease is tracked with one request at a time, the next one is
+        // picked when the previous was acknowledged
+        if (lease_probe_seq <= last_successful_received_seq) {
+            lease_probe_seq = last_sent_seq;
+            lease_probe_sent_at = clock_type::now();
+        }
+        return last_sent_seq;
+    }
 
     static bool is_first_request(follower_req_seq seq) { return seq() == 1; }
 
@@ -116,6 +126,9 @@ struct follower_index_metadata {
     // timestamp of last append_entries_rpc call
     clock_type::time_point last_sent_append_entries_req_timestamp;
     clock_type::time_point last_received_reply_timestamp;
+    // timestamp of last full heartbeat, lightweight heartbeats are interleaved
+    // with periodic full ones
+    clock_type::time_point last_full_heartbeat_timestamp;
     uint32_t heartbeats_failed{0};
     // The pair of sequences used to track append entries requests sent and
     // received by the follower. Every time append entries request is created
@@ -192,6 +205,18 @@ struct follower_index_metadata {
 
     std::optional<protocol_metadata> last_sent_protocol_meta;
 
+    // set when the follower was sent a heartbeat marking the group as
+    // quiescent, cleared with any other request sent to it
+    bool quiescent = false;
+
+    // request used to track the leader lease and the time it was sent at
+    follower_req_seq lease_probe_seq{0};
+    clock_type::time_point lease_probe_sent_at;
+    // lower bound of the time the latest request acknowledged by the follower
+    // was sent at. The follower does not grant votes for an election timeout
+    // after it received it, see consensus::has_leader_lease()
+    clock_type::time_point last_acked_request_sent_at;
+
     friend std::ostream&
     operator<<(std::ostream& o, const follower_index_metadata& i);
 };
@@ -527,6 +552,8 @@ struct replicate_options {
 
     consistency_level consistency;
     std::optional<std::chrono::milliseconds> timeout;
+    // trace of the request replicating the batches, if sampled
+    request_trace* trace{nullptr};
 };
 
 struct transfer_leadership_options {
@@ -14,10 +14,35 @@
 #include "cluster/metadata_cache.h"
 #include "cluster/shard_table.h"
 #include "cluster/topics_frontend.h"
+#include "kafka/server/server.h"
 #include "redpanda/admin/api-doc/debug.json.hh"
 #include "redpanda/admin/server.h"
+#include "resource_mgmt/pprof.h"
+#include "resource_mgmt/stall_profiler.h"
 
 namespace {
+std::optional<size_t> cpu_profile_shard(const ss::http::request& req) {
+    std::optional<size_t> shard_id;
+    if (auto e = req.get_query_param("shard"); !e.empty()) {
+        try {
+            shard_id = boost::lexical_cast<size_t>(e);
+        } catch (const boost::bad_lexical_cast&) {
+            throw ss::httpd::bad_param_exception(
+              fmt::format("Invalid parameter 'shard_id' value {{{}}}", e));
+        }
+    }
+
+    if (shard_id.has_value()) {
+        auto all_cpus = ss::smp::all_cpus();
+        auto max_shard_id = std::max_element(all_cpus.begin(), all_cpus.end());
+        if (*shard_id > *max_shard_id) {
+            throw ss::httpd::bad_param_exception(fmt::format(
+              "Shard id too high, max shard id is {}", *max_shard_id));
+        }
+    }
+    return shard_id;
+}
+
 ss::future<result<std::vector<cluster::partition_state>>>
 get_partition_state(model::ntp ntp, cluster::controller& controller) {
     if (ntp == model::controller_ntp) {
@@ -387,12 +412,32 @@ void admin_server::register_debug_routes() {
           return get_partition_state_handler(std::move(req));
       });
 
+    register_route<superuser>(
+      ss::httpd::debug_json::get_request_traces,
+      [this](std::unique_ptr<ss::http::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          return get_request_traces_handler(std::move(req));
+      });
+
     register_route<superuser>(
       ss::httpd::debug_json::cpu_profile,
       [this](std::unique_ptr<ss::http::request> req)
         -> ss::future<ss::json::json_return_type> {
           return cpu_profile_handler(std::move(req));
       });
+    register_route_raw_async<superuser>(
+      ss::httpd::debug_json::continuous_cpu_profile,
+      [this](
+        std::unique_ptr<ss::http::request> req,
+        std::unique_ptr<ss::http::reply> rep) {
+          return continuous_cpu_profile_handler(std::move(req), std::move(rep));
+      });
+    register_route<superuser>(
+      ss::httpd::debug_json::stall_profile,
+      [this](std::unique_ptr<ss::http::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          return stall_profile_handler(std::move(req));
+      });
     register_route<superuser>(
       ss::httpd::debug_json::set_storage_failure_injection_enabled,
       [](std::unique_ptr<ss::http::request> req) {
@@ -453,25 +498,7 @@ ss::future<ss::json::json_return_type>
 admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
     vlog(adminlog.info, "Request to sampled cpu profile");
 
-    std::optional<size_t> shard_id;
-    if (auto e = req->get_query_param("shard"); !e.empty()) {
-        try {
-            shard_id = boost::lexical_cast<size_t>(e);
-        } catch (const boost::bad_lexical_cast&) {
-            throw ss::httpd::bad_param_exception(
-              fmt::format("Invalid parameter 'shard_id' value {{{}}}", e));
-        }
-    }
-
-    if (shard_id.has_value()) {
-        auto all_cpus = ss::smp::all_cpus();
-        auto max_shard_id = std::max_element(all_cpus.begin(), all_cpus.end());
-        if (*shard_id > *max_shard_id) {
-            throw ss::httpd::bad_param_exception(fmt::format(
-              "Shard id too high, max shard id is {}", *max_shard_id));
-        }
-    }
-
+    auto shard_id = cpu_profile_shard(*req);
     auto profiles = co_await _cpu_profiler.local().results(shard_id);
 
     std::vector<ss::httpd::debug_json::cpu_profile_shard_samples> response{
@@ -493,6 +520,66 @@ admin_server::cpu_profile_handler(std::unique_ptr<ss::http::request> req) {
       std::move(response));
 }
 
+ss::future<std::unique_ptr<ss::http::reply>>
+admin_server::continuous_cpu_profile_handler(
+  std::unique_ptr<ss::http::request> req,
+  std::unique_ptr<ss::http::reply> rep) {
+    vlog(adminlog.info, "Request to continuous cpu profile");
+
+    auto shard_id = cpu_profile_shard(*req);
+    auto& profiler = _cpu_profiler.local();
+    auto profiles = co_await profiler.continuous_results(shard_id);
+
+    rep->write_body(
+      "bin",
+      resources::to_pprof(profiles, profiler.continuous_sample_period()));
+    co_return rep;
+}
+
+ss::future<ss::json::json_return_type>
+admin_server::stall_profile_handler(std::unique_ptr<ss::http::request> req) {
+    static constexpr size_t default_limit = 20;
+
+    auto shard_id = cpu_profile_shard(*req);
+    size_t limit = default_limit;
+    if (auto e = req->get_query_param("limit"); !e.empty()) {
+        try {
+            limit = boost::lexical_cast<size_t>(e);
+        } catch (const boost::bad_lexical_cast&) {
+            throw ss::httpd::bad_param_exception(
+              fmt::format("Invalid parameter 'limit' value {{{}}}", e));
+        }
+    }
+    auto profiles = co_await resources::stall_profiler::results(
+      shard_id, limit);
+
+    auto to_ms = [](ss::lowres_system_clock::time_point t) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                 t.time_since_epoch())
+          .count();
+    };
+    std::vector<ss::httpd::debug_json::stall_profile_shard> response{
+      profiles.size()};
+    for (size_t i = 0; i < profiles.size(); i++) {
+        response[i].shard_id = profiles[i].shard;
+        response[i].stalls = profiles[i].stalls;
+        response[i].dropped_stalls = profiles[i].dropped;
+
+        for (auto& stack : profiles[i].stacks) {
+            ss::httpd::debug_json::stall_profile_stack s;
+            s.scheduling_group = stack.scheduling_group;
+            s.backtrace = stack.backtrace;
+            s.occurrences = stack.occurrences;
+            s.first_seen = to_ms(stack.first_seen);
+            s.last_seen = to_ms(stack.last_seen);
+
+            response[i].stacks.push(s);
+        }
+    }
+
+    co_return ss::json::json_return_type(std::move(response));
+}
+
 ss::future<ss::json::json_return_type>
 admin_server::get_local_offsets_translated_handler(
   std::unique_ptr<ss::http::request> req) {
@@ -652,6 +739,46 @@ admin_server::sampled_memory_profile_handler(
       std::move(resp));
 }
 
+ss::future<ss::json::json_return_type>
+admin_server::get_request_traces_handler(std::unique_ptr<ss::http::request>) {
+    using trace_json = ss::httpd::debug_json::request_trace;
+    auto shards = co_await _kafka_server.map([](kafka::server& ks) {
+        std::vector<trace_json> traces;
+        traces.reserve(ks.recent_request_traces().size());
+        for (const auto& t : ks.recent_request_traces()) {
+            trace_json trace;
+            trace.name = t->name();
+            trace.shard = t->shard();
+            trace.duration_us = std::chrono::duration_cast<
+                                  std::chrono::microseconds>(t->duration())
+                                  .count();
+            trace.dropped_spans = t->dropped_spans();
+            for (const auto& s : t->spans()) {
+                ss::httpd::debug_json::request_trace_span span;
+                span.name = ss::sstring(s.name);
+                span.shard = s.shard;
+                span.start_us = std::chrono::duration_cast<
+                                  std::chrono::microseconds>(
+                                  s.start - t->started_at())
+                                  .count();
+                span.duration_us
+                  = std::chrono::duration_cast<std::chrono::microseconds>(
+                      s.end - s.start)
+                      .count();
+                trace.spans.push(span);
+            }
+            traces.push_back(std::move(trace));
+        }
+        return traces;
+    });
+
+    std::vector<trace_json> resp;
+    for (auto& traces : shards) {
+        std::move(traces.begin(), traces.end(), std::back_inserter(resp));
+    }
+    co_return ss::json::json_return_type(std::move(resp));
+}
+
 ss::future<ss::json::json_return_type>
 admin_server::get_local_storage_usage_handler(
   std::unique_ptr<ss::http::request>) {
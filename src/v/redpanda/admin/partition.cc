@@ -24,6 +24,9 @@
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/trim.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
 
 using admin::apply_validator;
 using admin::lw_shared_container;
@@ -431,6 +434,122 @@ ss::future<std::vector<model::broker_shard>> validate_set_replicas(
     co_return replicas;
 }
 
+// The page size of the partitions listing when only a cursor is given
+constexpr size_t default_partitions_page_size = 1000;
+
+/// The cursor of a page of the partitions listing: the
+/// "namespace/topic/partition" of the last partition of the previous page
+std::optional<model::ntp> parse_partitions_cursor(const ss::sstring& after) {
+    if (after.empty()) {
+        return std::nullopt;
+    }
+    std::vector<ss::sstring> tokens;
+    boost::split(tokens, after, boost::is_any_of("/"));
+    if (tokens.size() == 3) {
+        try {
+            return model::ntp(
+              model::ns(tokens[0]),
+              model::topic(tokens[1]),
+              model::partition_id(boost::lexical_cast<int32_t>(tokens[2])));
+        } catch (const boost::bad_lexical_cast&) {
+        }
+    }
+    throw ss::httpd::bad_param_exception(fmt::format(
+      "Invalid parameter 'after' value {{{}}}, expecting "
+      "namespace/topic/partition",
+      after));
+}
+
+size_t parse_partitions_page_size(const ss::sstring& limit) {
+    if (limit.empty()) {
+        return default_partitions_page_size;
+    }
+    try {
+        auto size = boost::lexical_cast<size_t>(limit);
+        if (size > 0) {
+            return size;
+        }
+    } catch (const boost::bad_lexical_cast&) {
+    }
+    throw ss::httpd::bad_param_exception(
+      fmt::format("Invalid parameter 'limit' value {{{}}}", limit));
+}
+
+using partition_summary = ss::httpd::partition_json::partition_summary;
+
+struct partitions_page_entry {
+    model::ntp ntp;
+    partition_summary summary;
+};
+
+bool operator<(
+  const partitions_page_entry& lhs, const partitions_page_entry& rhs) {
+    return lhs.ntp < rhs.ntp;
+}
+
+/**
+ * The first \p limit partitions of this node after \p after, in ntp order.
+ *
+ * Each shard only keeps its first \p limit partitions past the cursor, in a
+ * bounded heap, so that a page costs O(limit) memory per shard rather than a
+ * copy of all the partitions of the node.
+ */
+ss::future<std::vector<partitions_page_entry>> get_partitions_page(
+  ss::sharded<cluster::partition_manager>& partition_manager,
+  std::optional<model::ntp> after,
+  size_t limit) {
+    return partition_manager.map_reduce0(
+      [after = std::move(after), limit](cluster::partition_manager& pm) {
+          std::vector<model::ntp> ntps;
+          for (const auto& [ntp, p] : pm.partitions()) {
+              if (after && !(*after < ntp)) {
+                  continue;
+              }
+              if (ntps.size() < limit) {
+                  ntps.push_back(ntp);
+                  std::push_heap(ntps.begin(), ntps.end());
+              } else if (ntp < ntps.front()) {
+                  std::pop_heap(ntps.begin(), ntps.end());
+                  ntps.back() = ntp;
+                  std::push_heap(ntps.begin(), ntps.end());
+              }
+          }
+          std::sort_heap(ntps.begin(), ntps.end());
+
+          std::vector<partitions_page_entry> page;
+          page.reserve(ntps.size());
+          for (auto& ntp : ntps) {
+              auto p = pm.get(ntp);
+              partition_summary s;
+              s.ns = ntp.ns;
+              s.topic = ntp.tp.topic;
+              s.partition_id = ntp.tp.partition;
+              s.core = ss::this_shard_id();
+              s.materialized = false;
+              s.leader = p->get_leader_id().value_or(model::node_id(-1))();
+              page.push_back({.ntp = std::move(ntp), .summary = std::move(s)});
+          }
+          return page;
+      },
+      std::vector<partitions_page_entry>{},
+      [limit](
+        std::vector<partitions_page_entry> acc,
+        std::vector<partitions_page_entry> update) {
+          std::vector<partitions_page_entry> merged;
+          merged.reserve(std::min(limit, acc.size() + update.size()));
+          std::merge(
+            std::make_move_iterator(acc.begin()),
+            std::make_move_iterator(acc.end()),
+            std::make_move_iterator(update.begin()),
+            std::make_move_iterator(update.end()),
+            std::back_inserter(merged));
+          if (merged.size() > limit) {
+              merged.resize(limit);
+          }
+          return merged;
+      });
+}
+
 } // namespace
 
 ss::future<ss::json::json_return_type>
@@ -577,8 +696,24 @@ void admin_server::register_partition_routes() {
      */
     register_route<user>(
       ss::httpd::partition_json::get_partitions,
-      [this](std::unique_ptr<ss::http::request>) {
+      [this](std::unique_ptr<ss::http::request> req) {
           using summary = ss::httpd::partition_json::partition_summary;
+          auto limit = req->get_query_param("limit");
+          auto after = req->get_query_param("after");
+          if (!limit.empty() || !after.empty()) {
+              return get_partitions_page(
+                       _partition_manager,
+                       parse_partitions_cursor(after),
+                       parse_partitions_page_size(limit))
+                .then([](std::vector<partitions_page_entry> page) {
+                    return ss::json::json_return_type(
+                      ss::json::stream_range_as_array(
+                        lw_shared_container{std::move(page)},
+                        [](const partitions_page_entry& e) -> const summary& {
+                            return e.summary;
+                        }));
+                });
+          }
           auto get_summaries =
             [](auto& partition_manager, bool materialized, auto get_leader) {
                 return partition_manager.map_reduce0(
@@ -58,6 +58,7 @@
 #include "json/writer.h"
 #include "kafka/types.h"
 #include "metrics/metrics.h"
+#include "metrics/scrape_cache.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/namespace.h"
@@ -498,6 +499,8 @@ void admin_server::configure_metrics_route() {
        .handle = metrics::public_metrics_handle,
        .route = "/public_metrics"})
       .get();
+    metrics::cache_prometheus_route(_server, "/metrics");
+    metrics::cache_prometheus_route(_server, "/public_metrics");
 }
 
 ss::future<> admin_server::configure_listeners() {
@@ -2614,10 +2617,13 @@ admin_server::self_test_start_handler(std::unique_ptr<ss::http::request> req) {
                     r.dtos.push_back(cluster::diskcheck_opts::from_json(obj));
                 } else if (test_type == "network") {
                     r.ntos.push_back(cluster::netcheck_opts::from_json(obj));
+                } else if (test_type == "storage") {
+                    r.stos.push_back(
+                      cluster::storagecheck_opts::from_json(obj));
                 } else {
                     throw ss::httpd::bad_param_exception(
-                      "Unknown self_test 'type', valid options are 'disk' or "
-                      "'network'");
+                      "Unknown self_test 'type', valid options are 'disk', "
+                      "'network' or 'storage'");
                 }
             }
         } else {
@@ -590,6 +590,10 @@ private:
     // Debug routes
     ss::future<ss::json::json_return_type>
       cpu_profile_handler(std::unique_ptr<ss::http::request>);
+    ss::future<std::unique_ptr<ss::http::reply>> continuous_cpu_profile_handler(
+      std::unique_ptr<ss::http::request>, std::unique_ptr<ss::http::reply>);
+    ss::future<ss::json::json_return_type>
+      stall_profile_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
       get_local_offsets_translated_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
@@ -598,6 +602,8 @@ private:
       restart_service_handler(std::unique_ptr<ss::http::request>);
     ss::future<ss::json::json_return_type>
       sampled_memory_profile_handler(std::unique_ptr<ss::http::request>);
+    ss::future<ss::json::json_return_type>
+      get_request_traces_handler(std::unique_ptr<ss::http::request>);
 
     // Transform routes
     ss::future<ss::json::json_return_type>
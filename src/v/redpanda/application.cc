@@ -14,6 +14,7 @@
 #include "archival/purger.h"
 #include "archival/upload_controller.h"
 #include "archival/upload_housekeeping_service.h"
+#include "bytes/details/io_allocation_size.h"
 #include "cli_parser.h"
 #include "cloud_storage/cache_service.h"
 #include "cloud_storage/remote.h"
@@ -94,8 +95,11 @@
 #include "raft/service.h"
 #include "redpanda/admin/server.h"
 #include "resource_mgmt/io_priority.h"
+#include "resource_mgmt/memory_accounting.h"
 #include "resource_mgmt/memory_groups.h"
 #include "resource_mgmt/memory_sampling.h"
+#include "resource_mgmt/offload_executor.h"
+#include "resource_mgmt/stall_profiler.h"
 #include "rpc/rpc_utils.h"
 #include "security/audit/audit_log_manager.h"
 #include "ssx/abort_source.h"
@@ -505,9 +509,26 @@ void application::initialize(
         [] { return config::shard_local_cfg().cpu_profiler_enabled.bind(); }),
       ss::sharded_parameter([] {
           return config::shard_local_cfg().cpu_profiler_sample_period_ms.bind();
+      }),
+      ss::sharded_parameter([] {
+          return config::shard_local_cfg()
+            .cpu_profiler_continuous_enabled.bind();
+      }),
+      ss::sharded_parameter([] {
+          return config::shard_local_cfg()
+            .cpu_profiler_continuous_sample_period_ms.bind();
       }))
       .get();
     _cpu_profiler.invoke_on_all(&resources::cpu_profiler::start).get();
+    ss::smp::invoke_on_all([] {
+        resources::stall_profiler::local().start(
+          config::shard_local_cfg().stall_profiler_enabled.bind());
+    }).get();
+    _deferred.emplace_back([] {
+        ss::smp::invoke_on_all([] {
+            return resources::stall_profiler::local().stop();
+        }).get();
+    });
 
     /*
      * allocate per-core zstd decompression workspace and per-core
@@ -681,6 +702,33 @@ void application::setup_internal_metrics() {
           sm::description("Redpanda build information"),
           build_labels),
       });
+
+    _shard_metrics.start().get();
+    _shard_metrics
+      .invoke_on_all([](auto& shard_metrics) {
+          shard_metrics.groups.add_group(
+            "iobuf",
+            {sm::make_histogram(
+              "fragment_allocation_bytes",
+              [] {
+                  using stats = details::io_allocation_stats;
+                  sm::histogram h;
+                  h.buckets.resize(stats::classes);
+                  uint64_t total = 0;
+                  for (size_t i = 0; i < stats::classes; ++i) {
+                      total += stats::counts()[i];
+                      h.buckets[i].count = total;
+                      h.buckets[i].upper_bound = static_cast<double>(
+                        stats::upper_bound(i));
+                  }
+                  h.sample_count = total;
+                  return h;
+              },
+              sm::description(
+                "Fragments allocated for iobufs by size class"))});
+      })
+      .get();
+    _deferred.emplace_back([this] { _shard_metrics.stop().get(); });
 }
 
 void application::validate_arguments(const po::variables_map& cfg) {
@@ -1056,6 +1104,8 @@ static storage::log_config manager_config_from_global_config(
         .max_size = config::shard_local_cfg().reclaim_max_size(),
         .min_free_memory
         = config::shard_local_cfg().reclaim_batch_cache_min_free(),
+        .admission_filter
+        = config::shard_local_cfg().batch_cache_admission_filter(),
       },
       config::shard_local_cfg().readers_cache_eviction_timeout_ms(),
       sgs.compaction_sg(),
@@ -1141,6 +1191,48 @@ make_upload_controller_config(ss::scheduling_group sg) {
       config::shard_local_cfg().cloud_storage_upload_ctrl_max_shares()};
 }
 
+/**
+ * Produce requests are handled in the default scheduling group, fetches in
+ * their own group. Both have the default 1000 shares when not controlled.
+ * The latency of a fetch planning and execution excludes the time a fetch
+ * waits for data, unlike the latency of the whole request.
+ */
+static std::vector<resources::latency_share_controller::group>
+make_latency_share_controller_groups(
+  ss::sharded<kafka::server>& kafka_server, ss::scheduling_group fetch_sg) {
+    static constexpr int baseline_shares = 1000;
+    auto probe = [&kafka_server]() -> const kafka::latency_probe* {
+        if (!kafka_server.local_is_initialized()) {
+            return nullptr;
+        }
+        return &kafka_server.local().latency_probe();
+    };
+    std::vector<resources::latency_share_controller::group> groups;
+    groups.push_back({
+      .name = "produce",
+      .sg = ss::default_scheduling_group(),
+      .baseline_shares = baseline_shares,
+      .latencies = [probe]() -> const latency_hist* {
+          const auto* p = probe();
+          return p != nullptr ? &p->produce_latency() : nullptr;
+      },
+      .p99_target
+      = config::shard_local_cfg().kafka_produce_latency_p99_target_ms.bind(),
+    });
+    groups.push_back({
+      .name = "fetch",
+      .sg = fetch_sg,
+      .baseline_shares = baseline_shares,
+      .latencies = [probe]() -> const latency_hist* {
+          const auto* p = probe();
+          return p != nullptr ? &p->fetch_plan_and_execute_latency() : nullptr;
+      },
+      .p99_target
+      = config::shard_local_cfg().kafka_fetch_latency_p99_target_ms.bind(),
+    });
+    return groups;
+}
+
 // add additional services in here
 void application::wire_up_runtime_services(
   model::node_id node_id, ::stop_signal& app_signal) {
@@ -1236,15 +1328,29 @@ void application::wire_up_redpanda_services(
   model::node_id node_id, ::stop_signal& app_signal) {
     ss::smp::invoke_on_all([] {
         resources::available_memory::local().register_metrics();
+        resources::memory_accounting::local().register_metrics();
+        resources::offload_executor::local().start(
+          config::shard_local_cfg().housekeeping_offload_enabled.bind());
     }).get();
+    _deferred.emplace_back([] {
+        ss::smp::invoke_on_all([] {
+            return resources::offload_executor::local().stop();
+        }).get();
+    });
 
     construct_single_service(thread_worker);
 
     // cluster
     syschecks::systemd_message("Initializing connection cache").get();
     construct_service(
-      _connection_cache, std::ref(_as), std::nullopt, ss::sharded_parameter([] {
+      _connection_cache,
+      std::ref(_as),
+      std::nullopt,
+      ss::sharded_parameter([] {
           return config::shard_local_cfg().rpc_client_connections_per_peer();
+      }),
+      ss::sharded_parameter([] {
+          return config::shard_local_cfg().rpc_client_connections_per_shard();
       }))
       .get();
     syschecks::systemd_message("Building shard-lookup tables").get();
@@ -1299,6 +1405,8 @@ void application::wire_up_redpanda_services(
               .default_read_buffer_size
               = config::shard_local_cfg()
                   .raft_recovery_default_read_size.bind(),
+              .bulk_read_buffer_size
+              = config::shard_local_cfg().raft_recovery_bulk_read_size.bind(),
             };
         },
         std::ref(_connection_cache),
@@ -1432,6 +1540,26 @@ void application::wire_up_redpanda_services(
       .get();
 
     construct_service(node_status_table, node_id).get();
+    raft_group_manager
+      .invoke_on_all([this](raft::group_manager& gm) {
+          gm.set_node_liveness_probe(
+            [&table = node_status_table.local()](model::node_id id)
+              -> std::optional<raft::clock_type::time_point> {
+                auto status = table.get_node_status(id);
+                if (!status) {
+                    return std::nullopt;
+                }
+                return status->last_seen;
+            });
+      })
+      .get();
+    // the probe refers to the node status table, reset it before the table
+    // is stopped
+    _deferred.emplace_back([this] {
+        raft_group_manager
+          .invoke_on_all(&raft::group_manager::reset_node_liveness_probe)
+          .get();
+    });
     // controller
     syschecks::systemd_message("Creating cluster::controller").get();
 
@@ -1849,6 +1977,12 @@ void application::wire_up_redpanda_services(
 
               c.stream_recv_buf
                 = config::shard_local_cfg().kafka_rpc_server_stream_recv_buf;
+              c.stream_recv_buf_min = config::shard_local_cfg()
+                                        .kafka_rpc_server_stream_recv_buf_min;
+              c.stream_send_buf
+                = config::shard_local_cfg().kafka_rpc_server_stream_send_buf;
+              c.output_cork_delay = std::chrono::microseconds(
+                config::shard_local_cfg().kafka_rpc_server_output_cork_us());
               auto& tls_config = config::node().kafka_api_tls.value();
               for (const auto& ep : config::node().kafka_api()) {
                   ss::shared_ptr<ss::tls::server_credentials> credentials
@@ -1934,6 +2068,7 @@ void application::wire_up_redpanda_services(
         &kafka_cfg,
         smp_service_groups.kafka_smp_sg(),
         sched_groups.fetch_sg(),
+        sched_groups.recompression_sg(),
         std::ref(metadata_cache),
         std::ref(controller->get_topics_frontend()),
         std::ref(controller->get_config_frontend()),
@@ -1963,6 +2098,19 @@ void application::wire_up_redpanda_services(
         sched_groups.compaction_sg(),
         priority_manager::local().compaction_priority()))
       .get();
+    construct_service(
+      _latency_share_controller,
+      ss::sharded_parameter([this] {
+          return make_latency_share_controller_groups(
+            _kafka_server, sched_groups.fetch_sg());
+      }),
+      [this] {
+          return (_compaction_controller.local_is_initialized()
+                  && _compaction_controller.local().behind())
+                 || (_archival_upload_controller.local_is_initialized()
+                     && _archival_upload_controller.local().behind());
+      })
+      .get();
 }
 
 ss::future<> application::set_proxy_config(ss::sstring name, std::any val) {
@@ -2402,6 +2550,9 @@ void application::wire_up_and_start(::stop_signal& app_signal, bool test_mode) {
           .stack_memory = {
             .debug_host_stack_usage = false,
           },
+          .compilation_cache = {
+            .directory = config::node().data_directory().path / "wasm_cache",
+          },
         };
         _wasm_runtime->start(config).get();
         _transform_service.invoke_on_all(&transform::service::start).get();
@@ -2648,6 +2799,9 @@ void application::start_runtime_services(
     _archival_upload_controller
       .invoke_on_all(&archival::upload_controller::start)
       .get();
+    _latency_share_controller
+      .invoke_on_all(&resources::latency_share_controller::start)
+      .get();
 
     for (const auto& m : _migrators) {
         m->start(controller->get_abort_source().local());
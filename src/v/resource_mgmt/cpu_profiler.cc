@@ -27,24 +27,22 @@ namespace resources {
 
 cpu_profiler::cpu_profiler(
   config::binding<bool>&& enabled,
-  config::binding<std::chrono::milliseconds>&& sample_period)
+  config::binding<std::chrono::milliseconds>&& sample_period,
+  config::binding<bool>&& continuous_enabled,
+  config::binding<std::chrono::milliseconds>&& continuous_sample_period)
   : _query_timer([this] { poll_samples(); })
   , _enabled(std::move(enabled))
-  , _sample_period(std::move(sample_period)) {
-    _enabled.watch([this] { on_enabled_change(); });
-    _sample_period.watch([this] { on_sample_period_change(); });
+  , _sample_period(std::move(sample_period))
+  , _continuous_enabled(std::move(continuous_enabled))
+  , _continuous_sample_period(std::move(continuous_sample_period)) {
+    _enabled.watch([this] { reconfigure(); });
+    _sample_period.watch([this] { reconfigure(); });
+    _continuous_enabled.watch([this] { reconfigure(); });
+    _continuous_sample_period.watch([this] { reconfigure(); });
 }
 
 ss::future<> cpu_profiler::start() {
-    seastar::engine().set_cpu_profiler_period(_sample_period());
-    seastar::engine().set_cpu_profiler_enabled(_enabled());
-
-    if (_enabled()) {
-        // Arm the timer to fire whenever the profiler collects
-        // the maximum number of traces it can retain.
-        _query_timer.arm_periodic(ss::max_number_of_traces * _sample_period());
-    }
-
+    reconfigure();
     return ss::now();
 }
 
@@ -53,8 +51,9 @@ ss::future<> cpu_profiler::stop() {
     co_await _gate.close();
 }
 
+template<typename Func>
 ss::future<std::vector<cpu_profiler::shard_samples>>
-cpu_profiler::results(std::optional<ss::shard_id> shard_id) {
+cpu_profiler::collect(std::optional<ss::shard_id> shard_id, Func f) {
     if (_gate.is_closed()) {
         co_return std::vector<shard_samples>{};
     }
@@ -64,7 +63,7 @@ cpu_profiler::results(std::optional<ss::shard_id> shard_id) {
 
     if (shard_id) {
         auto shard_result = co_await container().invoke_on(
-          shard_id.value(), [](auto& s) { return s.shard_results(); });
+          shard_id.value(), f);
 
         results.emplace_back(
           shard_result.shard,
@@ -72,7 +71,7 @@ cpu_profiler::results(std::optional<ss::shard_id> shard_id) {
           std::move(shard_result.samples));
     } else {
         results = co_await container().map_reduce0(
-          [](auto& s) { return s.shard_results(); },
+          f,
           std::vector<shard_samples>{},
           [](std::vector<shard_samples> results, shard_samples shard_result) {
               results.emplace_back(
@@ -86,6 +85,17 @@ cpu_profiler::results(std::optional<ss::shard_id> shard_id) {
     co_return results;
 }
 
+ss::future<std::vector<cpu_profiler::shard_samples>>
+cpu_profiler::results(std::optional<ss::shard_id> shard_id) {
+    return collect(shard_id, [](auto& s) { return s.shard_results(); });
+}
+
+ss::future<std::vector<cpu_profiler::shard_samples>>
+cpu_profiler::continuous_results(std::optional<ss::shard_id> shard_id) {
+    return collect(
+      shard_id, [](auto& s) { return s.continuous_shard_results(); });
+}
+
 cpu_profiler::shard_samples cpu_profiler::shard_results() const {
     size_t dropped_samples = 0;
     absl::node_hash_map<ss::simple_backtrace, size_t> backtraces;
@@ -107,7 +117,33 @@ cpu_profiler::shard_samples cpu_profiler::shard_results() const {
     return {ss::this_shard_id(), dropped_samples, results};
 }
 
+cpu_profiler::shard_samples cpu_profiler::continuous_shard_results() const {
+    size_t dropped_samples = 0;
+    for (const auto& window : _continuous_windows) {
+        dropped_samples += window.dropped_samples;
+    }
+
+    std::vector<sample> results{};
+    results.reserve(_continuous_stacks.size());
+    for (const auto& [backtrace, occurrences] : _continuous_stacks) {
+        results.emplace_back(backtrace, occurrences);
+    }
+
+    return {ss::this_shard_id(), dropped_samples, std::move(results)};
+}
+
 void cpu_profiler::poll_samples() {
+    if (!_enabled()) {
+        // Only the continuous profile runs, it keeps no raw samples
+        auto dropped_samples = ss::engine().profiler_results(
+          _continuous_buffer);
+        resourceslog.trace(
+          "Polled {} samples from the CPU profiler",
+          _continuous_buffer.size());
+        aggregate_continuous(_continuous_buffer, dropped_samples);
+        return;
+    }
+
     std::vector<ss::cpu_profiler_trace> results_buffer;
     if (_results_buffers.size() < number_of_results_buffers) {
         results_buffer = std::vector<ss::cpu_profiler_trace>{
@@ -122,28 +158,80 @@ void cpu_profiler::poll_samples() {
     resourceslog.trace(
       "Polled {} samples from the CPU profiler", results_buffer.size());
 
+    if (_continuous_enabled()) {
+        // The on demand sample period applies to both profiles while it is
+        // enabled
+        aggregate_continuous(results_buffer, dropped_samples);
+    }
     _results_buffers.emplace_front(dropped_samples, std::move(results_buffer));
 }
 
-void cpu_profiler::on_enabled_change() {
-    if (_gate.is_closed()) {
-        return;
+void cpu_profiler::aggregate_continuous(
+  const std::vector<ss::cpu_profiler_trace>& traces, size_t dropped_samples) {
+    if (_continuous_windows.size() == number_of_continuous_windows) {
+        expire_continuous_window();
     }
 
-    ss::engine().set_cpu_profiler_enabled(_enabled());
-    _query_timer.cancel();
+    // Format every distinct backtrace of the poll once
+    absl::node_hash_map<ss::simple_backtrace, size_t> backtraces;
+    for (const auto& trace : traces) {
+        backtraces[trace.user_backtrace]++;
+    }
+
+    continuous_window window{.dropped_samples = dropped_samples};
+    window.stacks.reserve(backtraces.size());
+    for (const auto& [backtrace, occurrences] : backtraces) {
+        auto key = ssx::sformat("{}", backtrace);
+        auto it = _continuous_stacks.find(key);
+        if (it == _continuous_stacks.end()) {
+            if (_continuous_stacks.size() >= max_continuous_stacks) {
+                window.dropped_samples += occurrences;
+                continue;
+            }
+            it = _continuous_stacks.emplace(std::move(key), 0).first;
+        }
+        it->second += occurrences;
+        window.stacks.emplace_back(&it->first, occurrences);
+    }
 
-    if (_enabled()) {
-        _query_timer.arm_periodic(ss::max_number_of_traces * _sample_period());
+    _continuous_windows.push_front(std::move(window));
+}
+
+void cpu_profiler::expire_continuous_window() {
+    for (const auto& [backtrace, occurrences] :
+         _continuous_windows.back().stacks) {
+        auto it = _continuous_stacks.find(*backtrace);
+        it->second -= occurrences;
+        if (it->second == 0) {
+            _continuous_stacks.erase(it);
+        }
     }
+    _continuous_windows.pop_back();
 }
 
-void cpu_profiler::on_sample_period_change() {
+void cpu_profiler::reconfigure() {
     if (_gate.is_closed()) {
         return;
     }
 
-    ss::engine().set_cpu_profiler_period(_sample_period());
+    ss::engine().set_cpu_profiler_period(sample_period());
+    ss::engine().set_cpu_profiler_enabled(profiling());
+    _query_timer.cancel();
+
+    if (!_continuous_enabled()) {
+        _continuous_windows.clear();
+        _continuous_stacks.clear();
+        _continuous_buffer = {};
+    } else if (!_enabled() && _continuous_buffer.empty()) {
+        _continuous_buffer = std::vector<ss::cpu_profiler_trace>{
+          ss::max_number_of_traces};
+    }
+
+    if (profiling()) {
+        // Arm the timer to fire whenever the profiler collects
+        // the maximum number of traces it can retain.
+        _query_timer.arm_periodic(ss::max_number_of_traces * sample_period());
+    }
 }
 
 } // namespace resources
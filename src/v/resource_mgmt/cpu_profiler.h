@@ -26,6 +26,8 @@
 #include <chrono>
 #include <cstdint>
 #include <deque>
+#include <utility>
+#include <vector>
 
 namespace resources {
 
@@ -33,6 +35,12 @@ namespace resources {
  * The `cpu_profiler` service polls traces from seastar at fixed intervals.
  * It then aggregates the traces and provides methods for other services
  * to view them.
+ *
+ * Besides the on demand profile, whose samples are kept as polled, a
+ * continuous profile may run at a low sample rate all the time: the samples
+ * are aggregated per stack over a rolling window of
+ * `number_of_continuous_windows` polls, so that a past CPU spike can be
+ * looked at after the fact.
  */
 class cpu_profiler : public ss::peering_sharded_service<cpu_profiler> {
     // The number of results buffers to retain. Each of these buffers
@@ -45,6 +53,13 @@ class cpu_profiler : public ss::peering_sharded_service<cpu_profiler> {
     // activity.
     static constexpr size_t number_of_results_buffers{10};
 
+    // At the default 1s sample period of the continuous profile a window
+    // is `ss::max_number_of_traces` seconds long, 60 of them cover about 2
+    // hours. The number of distinct stacks retained is bounded, further
+    // samples are counted as dropped.
+    static constexpr size_t number_of_continuous_windows{60};
+    static constexpr size_t max_continuous_stacks{4096};
+
 public:
     struct sample {
         ss::sstring user_backtrace;
@@ -62,7 +77,10 @@ public:
     };
 
     cpu_profiler(
-      config::binding<bool>&&, config::binding<std::chrono::milliseconds>&&);
+      config::binding<bool>&&,
+      config::binding<std::chrono::milliseconds>&&,
+      config::binding<bool>&& continuous_enabled,
+      config::binding<std::chrono::milliseconds>&& continuous_sample_period);
 
     ss::future<> start();
     ss::future<> stop();
@@ -76,6 +94,17 @@ public:
     // is called on.
     shard_samples shard_results() const;
 
+    // Same as `results()` for the continuous profile.
+    ss::future<std::vector<shard_samples>>
+    continuous_results(std::optional<ss::shard_id> shard_id);
+
+    // The samples of the continuous profile retained on this shard.
+    shard_samples continuous_shard_results() const;
+
+    std::chrono::milliseconds continuous_sample_period() const {
+        return _continuous_sample_period();
+    }
+
 private:
     // Used to poll seastar at set intervals to capture all samples
     ss::timer<ss::lowres_clock> _query_timer;
@@ -84,6 +113,8 @@ private:
     // Configuration for seastar's cpu profiler
     config::binding<bool> _enabled;
     config::binding<std::chrono::milliseconds> _sample_period;
+    config::binding<bool> _continuous_enabled;
+    config::binding<std::chrono::milliseconds> _continuous_sample_period;
 
     struct profiler_result {
         size_t dropped_samples;
@@ -95,11 +126,35 @@ private:
     // The oldest results buffer is overwritten when polling
     // for new samples from seastar.
     std::deque<profiler_result> _results_buffers;
+    // Polled into when only the continuous profile runs
+    std::vector<seastar::cpu_profiler_trace> _continuous_buffer;
+
+    // Number of samples of the stacks seen in the continuous windows, keyed
+    // by the formatted backtrace. Nodes are stable, the windows point to
+    // their keys.
+    absl::node_hash_map<ss::sstring, size_t> _continuous_stacks;
+    struct continuous_window {
+        size_t dropped_samples{0};
+        std::vector<std::pair<const ss::sstring*, size_t>> stacks;
+    };
+    // The most recent window first
+    std::deque<continuous_window> _continuous_windows;
 
-    void poll_samples();
+    template<typename Func>
+    ss::future<std::vector<shard_samples>>
+    collect(std::optional<ss::shard_id> shard_id, Func f);
 
-    void on_enabled_change();
-    void on_sample_period_change();
+    void poll_samples();
+    void aggregate_continuous(
+      const std::vector<seastar::cpu_profiler_trace>&, size_t dropped_samples);
+    void expire_continuous_window();
+
+    // Applies the configuration of both profiles to seastar's profiler
+    void reconfigure();
+    bool profiling() const { return _enabled() || _continuous_enabled(); }
+    std::chrono::milliseconds sample_period() const {
+        return _enabled() ? _sample_period() : _continuous_sample_period();
+    }
 };
 
 } // namespace resources
@@ -38,6 +38,8 @@ public:
         _node_status = co_await ss::create_scheduling_group("node_status", 50);
         _self_test = co_await ss::create_scheduling_group("self_test", 100);
         _fetch = co_await ss::create_scheduling_group("fetch", 1000);
+        _recompression = co_await ss::create_scheduling_group(
+          "produce_recompression", 200);
     }
 
     ss::future<> destroy_groups() {
@@ -52,6 +54,7 @@ public:
         co_await destroy_scheduling_group(_node_status);
         co_await destroy_scheduling_group(_self_test);
         co_await destroy_scheduling_group(_fetch);
+        co_await destroy_scheduling_group(_recompression);
         co_return;
     }
 
@@ -80,6 +83,14 @@ public:
      * use all the CPU.
      */
     ss::scheduling_group fetch_sg() { return _fetch; }
+    /**
+     * @brief Scheduling group transcoding produced batches to the compression
+     * type of their topic.
+     *
+     * Compressing is expensive: with fewer shares than the kafka group, the
+     * produce requests which need no transcoding are not held back by it.
+     */
+    ss::scheduling_group recompression_sg() { return _recompression; }
 
     std::vector<std::reference_wrapper<const ss::scheduling_group>>
     all_scheduling_groups() const {
@@ -95,7 +106,8 @@ public:
           std::cref(_archival_upload),
           std::cref(_node_status),
           std::cref(_self_test),
-          std::cref(_fetch)};
+          std::cref(_fetch),
+          std::cref(_recompression)};
     }
 
 private:
@@ -112,4 +124,5 @@ private:
     ss::scheduling_group _node_status;
     ss::scheduling_group _self_test;
     ss::scheduling_group _fetch;
+    ss::scheduling_group _recompression;
 };
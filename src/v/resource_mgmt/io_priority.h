@@ -32,6 +32,9 @@ public:
         return _shadow_indexing_priority;
     }
     ss::io_priority_class archival_priority() { return _archival_priority; }
+    ss::io_priority_class stm_snapshot_priority() {
+        return _stm_snapshot_priority;
+    }
 
     static priority_manager& local() {
         static thread_local priority_manager pm = priority_manager();
@@ -60,7 +63,12 @@ private:
       // Background uploads to tiered storage: not user-visible latency, lowest
       // priority.
       , _archival_priority(
-          ss::io_priority_class::register_one("archival", 200)) {}
+          ss::io_priority_class::register_one("archival", 200))
+      // State machine snapshots, written on segment roll for every stm of
+      // every partition: below raft writes so that a burst of them doesn't
+      // compete with the data path.
+      , _stm_snapshot_priority(
+          ss::io_priority_class::register_one("stm-snapshot", 500)) {}
 #pragma clang diagnostic pop
 
     ss::io_priority_class _raft_priority;
@@ -71,6 +79,7 @@ private:
     ss::io_priority_class _raft_learner_recovery_priority;
     ss::io_priority_class _shadow_indexing_priority;
     ss::io_priority_class _archival_priority;
+    ss::io_priority_class _stm_snapshot_priority;
 };
 
 inline ss::io_priority_class raft_priority() {
@@ -104,3 +113,7 @@ inline ss::io_priority_class shadow_indexing_priority() {
 inline ss::io_priority_class archival_priority() {
     return priority_manager::local().archival_priority();
 }
+
+inline ss::io_priority_class stm_snapshot_priority() {
+    return priority_manager::local().stm_snapshot_priority();
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/latency_share_controller.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+#include "resource_mgmt/logger.h"
+#include "vlog.h"
+
+#include <seastar/core/metrics.hh>
+
+#include <algorithm>
+#include <numeric>
+
+namespace resources {
+
+latency_share_controller::latency_share_controller(
+  std::vector<group> groups, std::function<bool()> background_behind)
+  : _background_behind(std::move(background_behind))
+  , _interval(
+      config::shard_local_cfg().kafka_sched_ctrl_update_interval_ms.bind())
+  , _max_step(config::shard_local_cfg().kafka_sched_ctrl_max_step.bind())
+  , _min_shares(config::shard_local_cfg().kafka_sched_ctrl_min_shares.bind())
+  , _max_shares(
+      config::shard_local_cfg().kafka_sched_ctrl_max_shares.bind()) {
+    _groups.reserve(groups.size());
+    for (auto& g : groups) {
+        auto shares = g.baseline_shares;
+        _groups.push_back({.cfg = std::move(g), .shares = shares});
+    }
+    setup_metrics();
+}
+
+ss::future<> latency_share_controller::start() {
+    // the counts before the first interval are not part of its latencies
+    for (auto& g : _groups) {
+        if (const auto* hist = g.cfg.latencies(); hist != nullptr) {
+            g.last_counts = hist->counts();
+        }
+    }
+    _timer.set_callback([this] {
+        update();
+        _timer.arm(_interval());
+    });
+    _timer.arm(_interval());
+    return ss::now();
+}
+
+ss::future<> latency_share_controller::stop() {
+    _timer.cancel();
+    return ss::now();
+}
+
+int latency_share_controller::next_shares(
+  int current,
+  int baseline,
+  std::optional<double> pressure,
+  bool background_behind,
+  limits l) {
+    const auto max_shares = std::max(l.min_shares, l.max_shares);
+    const auto max_step = std::max(l.max_step, 1);
+
+    auto target = baseline;
+    if (pressure && *pressure > 1.0) {
+        target = max_shares;
+    } else if (pressure && *pressure >= latency_headroom) {
+        target = current;
+    } else if (background_behind) {
+        target = l.min_shares;
+    }
+    target = std::clamp(target, l.min_shares, max_shares);
+    return std::clamp(target, current - max_step, current + max_step);
+}
+
+latency_share_controller::limits
+latency_share_controller::current_limits() const {
+    return {
+      .min_shares = _min_shares(),
+      .max_shares = _max_shares(),
+      .max_step = _max_step(),
+    };
+}
+
+std::optional<double>
+latency_share_controller::sample_pressure(group_state& g) {
+    const auto* hist = g.cfg.latencies();
+    if (hist == nullptr) {
+        g.last_p99 = std::chrono::microseconds(0);
+        return std::nullopt;
+    }
+
+    latency_hist::counts_type interval{};
+    const auto& counts = hist->counts();
+    for (size_t i = 0; i < counts.size(); ++i) {
+        // the histogram is new when its counts went down
+        interval[i] = counts[i] >= g.last_counts[i]
+                        ? counts[i] - g.last_counts[i]
+                        : counts[i];
+    }
+    g.last_counts = counts;
+
+    const auto samples = std::accumulate(
+      interval.begin(), interval.end(), uint64_t{0});
+    if (samples < min_samples) {
+        g.last_p99 = std::chrono::microseconds(0);
+        return std::nullopt;
+    }
+    g.last_p99 = latency_hist::quantile(interval, 0.99);
+
+    const auto target = g.cfg.p99_target();
+    if (!target || *target <= std::chrono::milliseconds(0)) {
+        return std::nullopt;
+    }
+    return static_cast<double>(g.last_p99.count())
+           / static_cast<double>(
+             std::chrono::duration_cast<std::chrono::microseconds>(*target)
+               .count());
+}
+
+void latency_share_controller::update() {
+    const auto l = current_limits();
+    const auto behind = _background_behind();
+    for (auto& g : _groups) {
+        const auto pressure = sample_pressure(g);
+        int shares = 0;
+        if (g.cfg.p99_target()) {
+            shares = next_shares(
+              g.shares, g.cfg.baseline_shares, pressure, behind, l);
+        } else {
+            // without a target the group returns to its baseline
+            const auto max_step = std::max(l.max_step, 1);
+            shares = std::clamp(
+              g.cfg.baseline_shares, g.shares - max_step, g.shares + max_step);
+        }
+        if (shares == g.shares) {
+            continue;
+        }
+        vlog(
+          resourceslog.debug,
+          "{} shares {} -> {}, p99: {}us, background behind: {}",
+          g.cfg.name,
+          g.shares,
+          shares,
+          g.last_p99.count(),
+          behind);
+        g.shares = shares;
+        g.cfg.sg.set_shares(static_cast<float>(shares));
+    }
+}
+
+void latency_share_controller::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    for (auto& g : _groups) {
+        const std::vector<sm::label_instance> labels = {
+          sm::label("group")(g.cfg.name)};
+        _metrics.add_group(
+          prometheus_sanitize::metrics_name("kafka:latency:controller"),
+          {
+            sm::make_gauge(
+              "shares",
+              [&g] { return g.shares; },
+              sm::description("CPU shares of the scheduling group"),
+              labels),
+            sm::make_gauge(
+              "p99_latency_us",
+              [&g] { return g.last_p99.count(); },
+              sm::description("p99 latency of the last update interval"),
+              labels),
+            sm::make_gauge(
+              "p99_target_us",
+              [&g] {
+                  return std::chrono::duration_cast<std::chrono::microseconds>(
+                           g.cfg.p99_target().value_or(
+                             std::chrono::milliseconds(0)))
+                    .count();
+              },
+              sm::description("Target p99 latency, zero when not set"),
+              labels),
+          });
+    }
+}
+
+} // namespace resources
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "metrics/metrics.h"
+#include "seastarx.h"
+#include "utils/latency_hist.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/scheduling.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/core/timer.hh>
+
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace resources {
+
+/**
+ * @brief Adjusts the CPU shares of the scheduling groups serving kafka
+ * requests to meet a target p99 latency.
+ *
+ * The shares of the background work (compaction, uploads) are set by their
+ * backlog controllers. Only relative shares matter, so rather than competing
+ * with those, this controller moves the shares of the groups serving requests:
+ *
+ *  - while the p99 latency of a group is above its target, its shares grow
+ *    up to max_shares,
+ *  - while the latency is well below the target and the background work is
+ *    behind, its shares drop down to min_shares,
+ *  - otherwise, or without a target, its shares return to their baseline.
+ *
+ * The latency is the p99 of the requests completed during the last interval,
+ * the shares change by at most max_step per interval.
+ */
+class latency_share_controller {
+public:
+    // latency below this fraction of the target leaves room for background
+    static constexpr double latency_headroom = 0.8;
+    // requests completed during an interval to estimate its p99
+    static constexpr uint64_t min_samples = 100;
+
+    struct group {
+        ss::sstring name;
+        ss::scheduling_group sg;
+        int baseline_shares;
+        // latencies of the requests served by the group, nullptr when they
+        // are not served
+        std::function<const latency_hist*()> latencies;
+        config::binding<std::optional<std::chrono::milliseconds>> p99_target;
+    };
+
+    struct limits {
+        int min_shares;
+        int max_shares;
+        int max_step;
+    };
+
+    latency_share_controller(
+      std::vector<group>, std::function<bool()> background_behind);
+
+    ss::future<> start();
+    ss::future<> stop();
+
+    /// shares of a group for the next interval, \p pressure is the ratio of
+    /// its p99 latency to its target, if known
+    static int next_shares(
+      int current,
+      int baseline,
+      std::optional<double> pressure,
+      bool background_behind,
+      limits);
+
+private:
+    struct group_state {
+        group cfg;
+        int shares;
+        latency_hist::counts_type last_counts{};
+        std::chrono::microseconds last_p99{0};
+    };
+
+    void update();
+    std::optional<double> sample_pressure(group_state&);
+    limits current_limits() const;
+    void setup_metrics();
+
+    std::vector<group_state> _groups;
+    std::function<bool()> _background_behind;
+    config::binding<std::chrono::milliseconds> _interval;
+    config::binding<int16_t> _max_step;
+    config::binding<int16_t> _min_shares;
+    config::binding<int16_t> _max_shares;
+    ss::timer<> _timer;
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace resources
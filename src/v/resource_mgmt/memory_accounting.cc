@@ -0,0 +1,98 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/memory_accounting.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace resources {
+
+std::string_view to_string_view(memory_subsystem s) {
+    switch (s) {
+    case memory_subsystem::batch_cache:
+        return "batch_cache";
+    case memory_subsystem::kafka_fetch:
+        return "kafka_fetch";
+    case memory_subsystem::raft_recovery:
+        return "raft_recovery";
+    case memory_subsystem::stm:
+        return "stm";
+    case memory_subsystem::compaction:
+        return "compaction";
+    case memory_subsystem::cloud_manifests:
+        return "cloud_manifests";
+    case memory_subsystem::cloud_cache_index:
+        return "cloud_cache_index";
+    }
+    return "unknown";
+}
+
+memory_accounting::memory_accounting() {
+    _roots.reserve(memory_subsystems_count);
+    for (size_t i = 0; i < memory_subsystems_count; ++i) {
+        _roots.emplace_back(
+          ss::sstring(to_string_view(static_cast<memory_subsystem>(i))));
+    }
+}
+
+ss::shared_ptr<util::mem_tracker> memory_accounting::create_tracker(
+  memory_subsystem subsystem, ss::sstring label) {
+    return _roots[static_cast<size_t>(subsystem)].create_child(
+      std::move(label));
+}
+
+memory_accounting::deregister_holder
+memory_accounting::inner_register(memory_subsystem subsystem, rfn&& fn) {
+    auto ret = std::unique_ptr<reporter>(
+      new reporter{subsystem, std::move(fn)});
+    _reporters.push_back(*ret);
+    return ret;
+}
+
+int64_t memory_accounting::consumption(memory_subsystem subsystem) const {
+    auto bytes = _roots[static_cast<size_t>(subsystem)].consumption();
+    for (const auto& r : _reporters) {
+        if (r.subsystem == subsystem) {
+            bytes += static_cast<int64_t>(r.bytes_fn());
+        }
+    }
+    return bytes;
+}
+
+void memory_accounting::register_metrics() {
+    if (_metrics || config::shard_local_cfg().disable_metrics()) {
+        // already initialized or disabled
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    auto subsystem_label = sm::label("subsystem");
+    std::vector<sm::metric_definition> defs;
+    defs.reserve(memory_subsystems_count);
+    for (size_t i = 0; i < memory_subsystems_count; ++i) {
+        auto s = static_cast<memory_subsystem>(i);
+        defs.emplace_back(sm::make_gauge(
+          "subsystem_allocated_bytes",
+          [this, s] { return consumption(s); },
+          sm::description("Bytes of memory held by a subsystem"),
+          {subsystem_label(ss::sstring(to_string_view(s)))}));
+    }
+
+    _metrics.emplace().add_group(
+      prometheus_sanitize::metrics_name("memory"), defs);
+}
+
+thread_local memory_accounting memory_accounting::_local_instance;
+
+} // namespace resources
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "metrics/metrics.h"
+#include "seastarx.h"
+#include "utils/intrusive_list_helpers.h"
+#include "utils/tracking_allocator.h"
+
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace resources {
+
+/// The subsystems whose memory is accounted by memory_accounting
+enum class memory_subsystem : uint8_t {
+    batch_cache,
+    kafka_fetch,
+    raft_recovery,
+    stm,
+    compaction,
+    cloud_manifests,
+    cloud_cache_index,
+};
+
+inline constexpr size_t memory_subsystems_count = 7;
+
+std::string_view to_string_view(memory_subsystem);
+
+/**
+ * @brief Shard local accounting of the memory held by each subsystem.
+ *
+ * Containers of a subsystem account for their allocations with a
+ * util::tracking_allocator on a tracker from create_tracker(), a child of
+ * the subsystem's root tracker. Subsystems which already account for their
+ * memory, e.g. with a semaphore or a byte counter, register a reporter
+ * instead, as with available_memory.
+ *
+ * The memory of the subsystems is reported by the
+ * `memory_subsystem_allocated_bytes` metric, labelled by subsystem.
+ */
+class memory_accounting final {
+    using rfn = ss::noncopyable_function<size_t()>;
+
+    struct reporter {
+        friend memory_accounting;
+        memory_subsystem subsystem;
+        rfn bytes_fn;
+        intrusive_list_hook hook;
+    };
+
+public:
+    using deregister_holder = std::unique_ptr<reporter>;
+
+    memory_accounting();
+    memory_accounting(memory_accounting&) = delete;
+    memory_accounting& operator=(const memory_accounting&) = delete;
+
+    /**
+     * @brief A new tracker accounting for memory of \p subsystem.
+     *
+     * The tracker stays part of the subsystem's consumption until it is
+     * destroyed.
+     */
+    ss::shared_ptr<util::mem_tracker>
+    create_tracker(memory_subsystem subsystem, ss::sstring label);
+
+    /**
+     * @brief Register a function reporting bytes held by \p subsystem.
+     *
+     * The reporter is deregistered when the returned holder is destroyed.
+     */
+    template<typename F>
+    [[nodiscard("You need to hold the returned object to maintain "
+                "registration")]] deregister_holder
+    register_reporter(memory_subsystem subsystem, F bytes_fn) {
+        return inner_register(subsystem, std::move(bytes_fn));
+    }
+
+    /// Bytes held by the subsystem: its trackers plus its reporters
+    int64_t consumption(memory_subsystem) const;
+
+    /**
+     * @brief Register the `memory_subsystem_allocated_bytes` metric.
+     *
+     * Without this call the accounting still works, but no metrics are
+     * created.
+     */
+    void register_metrics();
+
+    /**
+     * @brief Get a reference to the shard-global memory_accounting instance.
+     */
+    static memory_accounting& local() { return _local_instance; }
+
+private:
+    deregister_holder inner_register(memory_subsystem, rfn&&);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static thread_local memory_accounting _local_instance;
+
+    // One root per subsystem, indexed by memory_subsystem
+    std::vector<util::mem_tracker> _roots;
+    intrusive_list<reporter, &reporter::hook> _reporters;
+    std::optional<metrics::internal_metric_groups> _metrics;
+};
+
+} // namespace resources
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/offload_executor.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+#include "resource_mgmt/logger.h"
+#include "vlog.h"
+
+#include <seastar/core/metrics.hh>
+#include <seastar/core/reactor.hh>
+
+#include <algorithm>
+
+namespace resources {
+
+void offload_executor::start(config::binding<bool> enabled) {
+    _enabled.emplace(std::move(enabled));
+    if (ss::smp::count > max_shards) {
+        vlog(
+          resourceslog.warn,
+          "Housekeeping offload is not supported with more than {} shards",
+          max_shards);
+        return;
+    }
+
+    _last_sample_at = ss::lowres_clock::now();
+    _last_busy = ss::engine().total_busy_time();
+    _sample_timer.set_callback([this] { sample(); });
+    _sample_timer.arm_periodic(sample_interval);
+    setup_metrics();
+}
+
+ss::future<> offload_executor::stop() {
+    _sample_timer.cancel();
+    _loads[ss::this_shard_id()].utilization.store(
+      0, std::memory_order_relaxed);
+    co_await _gate.close();
+    _metrics.reset();
+}
+
+void offload_executor::sample() {
+    const auto now = ss::lowres_clock::now();
+    const auto busy = ss::engine().total_busy_time();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      now - _last_sample_at);
+    if (elapsed.count() <= 0) {
+        return;
+    }
+    const auto utilization = std::clamp<int64_t>(
+      (busy - _last_busy).count() * 1000 / elapsed.count(), 0, 1000);
+    _last_sample_at = now;
+    _last_busy = busy;
+    _loads[ss::this_shard_id()].utilization.store(
+      utilization, std::memory_order_relaxed);
+}
+
+std::optional<ss::shard_id> offload_executor::pick_shard() const {
+    if (
+      !_enabled || !(*_enabled)() || ss::smp::count < 2
+      || ss::smp::count > max_shards || _inflight >= max_inflight
+      || _gate.is_closed()) {
+        return std::nullopt;
+    }
+
+    const auto self = ss::this_shard_id();
+    const auto local = _loads[self].utilization.load(
+      std::memory_order_relaxed);
+    if (local < busy_utilization) {
+        return std::nullopt;
+    }
+
+    std::optional<ss::shard_id> best;
+    uint32_t best_load = local;
+    for (ss::shard_id s = 0; s < ss::smp::count; ++s) {
+        if (s == self) {
+            continue;
+        }
+        const auto load
+          = _loads[s].utilization.load(std::memory_order_relaxed)
+            + running_task_cost
+                * _loads[s].running.load(std::memory_order_relaxed);
+        if (load < best_load) {
+            best = s;
+            best_load = load;
+        }
+    }
+
+    if (!best || local - best_load < min_utilization_gain) {
+        return std::nullopt;
+    }
+    return best;
+}
+
+void offload_executor::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.emplace();
+    _metrics->add_group(
+      prometheus_sanitize::metrics_name("housekeeping_offload"),
+      {
+        sm::make_counter(
+          "offloaded_tasks",
+          [this] { return _offloaded; },
+          sm::description("Tasks of this shard run on another shard")),
+        sm::make_counter(
+          "local_tasks",
+          [this] { return _local_runs; },
+          sm::description("Offloadable tasks of this shard run locally")),
+        sm::make_gauge(
+          "running_tasks",
+          [] {
+              return _loads[ss::this_shard_id()].running.load(
+                std::memory_order_relaxed);
+          },
+          sm::description("Tasks of other shards running on this shard")),
+        sm::make_gauge(
+          "utilization",
+          [] {
+              return _loads[ss::this_shard_id()].utilization.load(
+                       std::memory_order_relaxed)
+                     / 1000.0;
+          },
+          sm::description(
+            "Utilization of the shard as sampled to pick offload targets")),
+      });
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<offload_executor::shard_load, offload_executor::max_shards>
+  offload_executor::_loads;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local offload_executor offload_executor::_local_instance;
+
+} // namespace resources
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "metrics/metrics.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/scheduling.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/core/timer.hh>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace resources {
+
+/**
+ * @brief Runs CPU only pieces of housekeeping on less busy shards.
+ *
+ * Housekeeping such as compaction runs on the shard owning the partition, a
+ * busy shard accumulates a backlog while other shards idle. Pieces of this
+ * work which only use the CPU and no shard local state (compressing a batch,
+ * building a hash map, encoding an index) can be run on another shard, with
+ * the result returned to the owner.
+ *
+ * Every shard samples its utilization and publishes it, along with the number
+ * of offloaded tasks it is running, in a table shared by all the shards. A
+ * task is offloaded when its shard is busy and another shard is noticeably
+ * less busy, it then runs in the scheduling group of the caller.
+ *
+ * The function passed to maybe_submit() runs and is destroyed on another
+ * shard. It may only read data owned by the caller, which stays alive and
+ * unmodified until the returned future resolves: it must not copy or share
+ * reference counted objects such as iobuf fragments, which are not thread
+ * safe. Its result is moved back to the caller.
+ */
+class offload_executor final {
+public:
+    static constexpr auto sample_interval = std::chrono::milliseconds(100);
+    // utilization, in thousandths, from which the shard offloads work
+    static constexpr uint32_t busy_utilization = 800;
+    // utilization difference with the target shard required to offload
+    static constexpr uint32_t min_utilization_gain = 200;
+    // cost of a running task on a target shard, in thousandths of utilization
+    static constexpr uint32_t running_task_cost = 100;
+    // tasks offloaded by a shard without having completed
+    static constexpr uint32_t max_inflight = 16;
+    static constexpr size_t max_shards = 256;
+
+    offload_executor() = default;
+    offload_executor(const offload_executor&) = delete;
+    offload_executor& operator=(const offload_executor&) = delete;
+    offload_executor(offload_executor&&) = delete;
+    offload_executor& operator=(offload_executor&&) = delete;
+    ~offload_executor() = default;
+
+    /// Starts sampling the utilization of this shard, needs to be called on
+    /// every shard
+    void start(config::binding<bool> enabled);
+    ss::future<> stop();
+
+    /**
+     * @brief Runs \p func on a less busy shard.
+     *
+     * Returns std::nullopt when func should rather run on this shard, e.g.
+     * because no shard is less busy. The caller then runs the work itself,
+     * which allows it to use an implementation yielding to the reactor.
+     */
+    template<typename Func>
+    std::optional<ss::futurize_t<std::invoke_result_t<Func>>>
+    maybe_submit(Func func) {
+        auto target = pick_shard();
+        if (!target) {
+            ++_local_runs;
+            return std::nullopt;
+        }
+        ++_offloaded;
+        ++_inflight;
+        _loads[*target].running.fetch_add(1, std::memory_order_relaxed);
+        return ss::with_gate(
+          _gate,
+          [this, target = *target, func = std::move(func)]() mutable {
+              return ss::smp::submit_to(
+                       target,
+                       [sg = ss::current_scheduling_group(),
+                        func = std::move(func)]() mutable {
+                           return ss::with_scheduling_group(
+                             sg, [&func] { return func(); });
+                       })
+                .finally([this, target] {
+                    _loads[target].running.fetch_sub(
+                      1, std::memory_order_relaxed);
+                    --_inflight;
+                });
+          });
+    }
+
+    /// Get a reference to the shard-global offload_executor instance
+    static offload_executor& local() { return _local_instance; }
+
+private:
+    std::optional<ss::shard_id> pick_shard() const;
+    void sample();
+    void setup_metrics();
+
+    struct alignas(64) shard_load {
+        // thousandths of the last sample interval the shard was busy
+        std::atomic<uint32_t> utilization{0};
+        // offloaded tasks running on the shard
+        std::atomic<uint32_t> running{0};
+    };
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::array<shard_load, max_shards> _loads;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static thread_local offload_executor _local_instance;
+
+    std::optional<config::binding<bool>> _enabled;
+    ss::timer<ss::lowres_clock> _sample_timer;
+    ss::lowres_clock::time_point _last_sample_at;
+    std::chrono::nanoseconds _last_busy{0};
+    uint32_t _inflight{0};
+    ss::gate _gate;
+
+    uint64_t _offloaded{0};
+    uint64_t _local_runs{0};
+    std::optional<metrics::internal_metric_groups> _metrics;
+};
+
+} // namespace resources
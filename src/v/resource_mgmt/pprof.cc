@@ -0,0 +1,306 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/pprof.h"
+
+#include "ssx/sformat.h"
+
+#include <absl/container/flat_hash_map.h>
+
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace resources {
+
+namespace {
+
+// Field numbers of profile.proto
+namespace profile_field {
+constexpr uint32_t sample_type = 1;
+constexpr uint32_t sample = 2;
+constexpr uint32_t mapping = 3;
+constexpr uint32_t location = 4;
+constexpr uint32_t string_table = 6;
+constexpr uint32_t time_nanos = 9;
+constexpr uint32_t period_type = 11;
+constexpr uint32_t period = 12;
+constexpr uint32_t comment = 13;
+} // namespace profile_field
+
+namespace value_type_field {
+constexpr uint32_t type = 1;
+constexpr uint32_t unit = 2;
+} // namespace value_type_field
+
+namespace sample_field {
+constexpr uint32_t location_id = 1;
+constexpr uint32_t value = 2;
+constexpr uint32_t label = 3;
+} // namespace sample_field
+
+namespace label_field {
+constexpr uint32_t key = 1;
+constexpr uint32_t str = 2;
+} // namespace label_field
+
+namespace mapping_field {
+constexpr uint32_t id = 1;
+constexpr uint32_t memory_limit = 3;
+constexpr uint32_t filename = 5;
+} // namespace mapping_field
+
+namespace location_field {
+constexpr uint32_t id = 1;
+constexpr uint32_t mapping_id = 2;
+constexpr uint32_t address = 3;
+} // namespace location_field
+
+// Just enough of the protobuf wire format for the profile message
+class proto_writer {
+public:
+    void varint_field(uint32_t field, uint64_t v) {
+        key(field, wire_varint);
+        varint(v);
+    }
+
+    void bytes_field(uint32_t field, std::string_view v) {
+        key(field, wire_length_delimited);
+        varint(v.size());
+        _buf.append(v);
+    }
+
+    void message_field(uint32_t field, const proto_writer& msg) {
+        bytes_field(field, msg._buf);
+    }
+
+    void packed_field(uint32_t field, const std::vector<uint64_t>& vs) {
+        proto_writer packed;
+        for (auto v : vs) {
+            packed.varint(v);
+        }
+        bytes_field(field, packed._buf);
+    }
+
+    std::string_view data() const { return _buf; }
+
+private:
+    static constexpr uint32_t wire_varint = 0;
+    static constexpr uint32_t wire_length_delimited = 2;
+
+    void key(uint32_t field, uint32_t wire_type) {
+        varint((uint64_t{field} << 3U) | wire_type);
+    }
+
+    void varint(uint64_t v) {
+        while (v >= 0x80) {
+            _buf.push_back(static_cast<char>((v & 0x7fU) | 0x80U));
+            v >>= 7U;
+        }
+        _buf.push_back(static_cast<char>(v));
+    }
+
+    std::string _buf;
+};
+
+struct frame {
+    // Empty for the redpanda binary
+    std::string_view object;
+    uint64_t address;
+};
+
+// Frames of a seastar backtrace are formatted as `0x<addr>`, or
+// `<object>+0x<addr>` outside of the main binary, with the addresses
+// relative to the object.
+std::optional<frame> parse_frame(std::string_view token) {
+    frame f{};
+    auto hex = token;
+    if (auto plus = token.rfind("+0x"); plus != std::string_view::npos) {
+        f.object = token.substr(0, plus);
+        hex = token.substr(plus + 1);
+    }
+    if (!hex.starts_with("0x") || hex.size() == 2) {
+        return std::nullopt;
+    }
+    const auto* end = hex.data() + hex.size();
+    auto [ptr, ec] = std::from_chars(hex.data() + 2, end, f.address, 16);
+    if (ec != std::errc{} || ptr != end) {
+        return std::nullopt;
+    }
+    return f;
+}
+
+class profile_builder {
+public:
+    profile_builder() {
+        string_id("");
+        _shard_label = string_id("shard");
+    }
+
+    uint64_t string_id(std::string_view s) {
+        auto [it, inserted] = _strings.try_emplace(
+          ss::sstring(s), _strings.size());
+        if (inserted) {
+            _out.bytes_field(profile_field::string_table, s);
+        }
+        return it->second;
+    }
+
+    void value_type(uint32_t field, std::string_view type, std::string_view u) {
+        proto_writer vt;
+        vt.varint_field(value_type_field::type, string_id(type));
+        vt.varint_field(value_type_field::unit, string_id(u));
+        _out.message_field(field, vt);
+    }
+
+    void sample(
+      ss::shard_id shard,
+      std::string_view backtrace,
+      size_t occurrences,
+      std::chrono::nanoseconds period) {
+        std::vector<uint64_t> locations;
+        size_t pos = 0;
+        while (pos < backtrace.size()) {
+            auto end = backtrace.find_first_of(" \n", pos);
+            if (end == std::string_view::npos) {
+                end = backtrace.size();
+            }
+            if (auto f = parse_frame(backtrace.substr(pos, end - pos)); f) {
+                locations.push_back(location_id(*f));
+            }
+            pos = end + 1;
+        }
+
+        proto_writer s;
+        s.packed_field(sample_field::location_id, locations);
+        s.packed_field(
+          sample_field::value,
+          {occurrences, occurrences * static_cast<uint64_t>(period.count())});
+        proto_writer l;
+        l.varint_field(label_field::key, _shard_label);
+        l.varint_field(label_field::str, shard_id(shard));
+        s.message_field(sample_field::label, l);
+        _pending.message_field(profile_field::sample, s);
+    }
+
+    void comment(std::string_view c) {
+        _out.varint_field(profile_field::comment, string_id(c));
+    }
+
+    void varint_field(uint32_t field, uint64_t v) {
+        _out.varint_field(field, v);
+    }
+
+    ss::sstring finish() && {
+        ss::sstring ret;
+        ret.reserve(_out.data().size() + _pending.data().size());
+        ret.append(_out.data().data(), _out.data().size());
+        ret.append(_pending.data().data(), _pending.data().size());
+        return ret;
+    }
+
+private:
+    // A string label, pprof drops the numeric labels of value 0
+    uint64_t shard_id(ss::shard_id shard) {
+        if (shard >= _shard_ids.size()) {
+            _shard_ids.resize(shard + 1);
+        }
+        if (!_shard_ids[shard]) {
+            _shard_ids[shard] = string_id(ssx::sformat("{}", shard));
+        }
+        return *_shard_ids[shard];
+    }
+
+    uint64_t location_id(const frame& f) {
+        auto mapping = mapping_id(f.object);
+        auto [it, inserted] = _locations.try_emplace(
+          std::make_pair(mapping, f.address), _locations.size() + 1);
+        if (inserted) {
+            proto_writer loc;
+            loc.varint_field(location_field::id, it->second);
+            loc.varint_field(location_field::mapping_id, mapping);
+            loc.varint_field(location_field::address, f.address);
+            _out.message_field(profile_field::location, loc);
+        }
+        return it->second;
+    }
+
+    // One mapping per object, from address 0 since the addresses are
+    // relative to the object
+    uint64_t mapping_id(std::string_view object) {
+        auto [it, inserted] = _mappings.try_emplace(
+          ss::sstring(object), _mappings.size() + 1);
+        if (inserted) {
+            proto_writer m;
+            m.varint_field(mapping_field::id, it->second);
+            m.varint_field(
+              mapping_field::memory_limit,
+              std::numeric_limits<uint64_t>::max());
+            m.varint_field(
+              mapping_field::filename,
+              string_id(object.empty() ? "redpanda" : object));
+            _out.message_field(profile_field::mapping, m);
+        }
+        return it->second;
+    }
+
+    // Tables and everything but the samples, which are appended at the end:
+    // the fields of a message may come in any order.
+    proto_writer _out;
+    proto_writer _pending;
+    absl::flat_hash_map<ss::sstring, uint64_t> _strings;
+    uint64_t _shard_label;
+    std::vector<std::optional<uint64_t>> _shard_ids;
+    absl::flat_hash_map<ss::sstring, uint64_t> _mappings;
+    absl::flat_hash_map<std::pair<uint64_t, uint64_t>, uint64_t> _locations;
+};
+
+} // namespace
+
+ss::sstring to_pprof(
+  const std::vector<cpu_profiler::shard_samples>& profiles,
+  std::chrono::milliseconds sample_period) {
+    const auto period = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      sample_period);
+
+    profile_builder builder;
+    builder.value_type(profile_field::sample_type, "samples", "count");
+    builder.value_type(profile_field::sample_type, "cpu", "nanoseconds");
+    builder.value_type(profile_field::period_type, "cpu", "nanoseconds");
+    builder.varint_field(profile_field::period, period.count());
+    builder.varint_field(
+      profile_field::time_nanos,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+        .count());
+
+    for (const auto& shard : profiles) {
+        if (shard.dropped_samples > 0) {
+            builder.comment(ssx::sformat(
+              "shard {} dropped {} samples",
+              shard.shard,
+              shard.dropped_samples));
+        }
+        for (const auto& s : shard.samples) {
+            builder.sample(
+              shard.shard, s.user_backtrace, s.occurrences, period);
+        }
+    }
+
+    return std::move(builder).finish();
+}
+
+} // namespace resources
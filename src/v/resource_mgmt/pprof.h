@@ -0,0 +1,36 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "resource_mgmt/cpu_profiler.h"
+#include "seastarx.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <chrono>
+#include <vector>
+
+namespace resources {
+
+/**
+ * Encodes CPU profile samples as a serialized, uncompressed, pprof
+ * `perftools.profiles.Profile` message (profile.proto from google/pprof).
+ *
+ * Each sample carries a `shard` label. The addresses of the backtraces are
+ * not symbolized here, pprof does it against the redpanda binary, e.g.
+ * `pprof -http : /opt/redpanda/libexec/redpanda profile.pb`.
+ */
+ss::sstring to_pprof(
+  const std::vector<cpu_profiler::shard_samples>& profiles,
+  std::chrono::milliseconds sample_period);
+
+} // namespace resources
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/semaphore_metrics.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace resources {
+
+ss::lw_shared_ptr<semaphore_wait_stats>
+semaphore_metrics::stats(const ss::sstring& name) {
+    auto* e = find_or_create(name);
+    return e != nullptr ? e->stats : nullptr;
+}
+
+semaphore_metrics::deregister_holder
+semaphore_metrics::inner_register(const ss::sstring& name, units_fn&& fn) {
+    if (find_or_create(name) == nullptr) {
+        return nullptr;
+    }
+    auto ret = std::unique_ptr<reporter>(new reporter{name, std::move(fn)});
+    _reporters.push_back(*ret);
+    return ret;
+}
+
+size_t semaphore_metrics::held_units(const ss::sstring& name) const {
+    size_t units = 0;
+    for (const auto& r : _reporters) {
+        if (r.name == name) {
+            units += r.units();
+        }
+    }
+    return units;
+}
+
+semaphore_metrics::entry*
+semaphore_metrics::find_or_create(const ss::sstring& name) {
+    if (auto it = _entries.find(name); it != _entries.end()) {
+        return &it->second;
+    }
+    if (!config::shard_local_cfg().semaphore_wait_metrics_enabled()) {
+        return nullptr;
+    }
+
+    auto& e = _entries[name];
+    e.stats = ss::make_lw_shared<semaphore_wait_stats>();
+    if (config::shard_local_cfg().disable_metrics()) {
+        return &e;
+    }
+
+    namespace sm = ss::metrics;
+    const std::vector<sm::label_instance> labels = {sm::label("name")(name)};
+    auto& st = *e.stats;
+    e.metrics.add_group(
+      prometheus_sanitize::metrics_name("semaphore"),
+      {
+        sm::make_counter(
+          "acquisitions",
+          [&st] { return st.acquisitions; },
+          sm::description("Acquisitions of units of the semaphores"),
+          labels),
+        sm::make_counter(
+          "waits",
+          [&st] { return st.waits; },
+          sm::description("Acquisitions which waited for their units"),
+          labels),
+        sm::make_counter(
+          "failed_acquisitions",
+          [&st] { return st.failed; },
+          sm::description(
+            "Acquisitions which timed out, were aborted or broken"),
+          labels),
+        sm::make_gauge(
+          "waiters",
+          [&st] { return st.waiters; },
+          sm::description("Acquisitions waiting for their units"),
+          labels),
+        sm::make_gauge(
+          "held_units",
+          [this, name] { return held_units(name); },
+          sm::description("Units lent by the semaphores"),
+          labels),
+        sm::make_histogram(
+          "wait_time_us",
+          [&st] { return st.wait_time.internal_histogram_logform(); },
+          sm::description("Time the acquisitions waited for their units"),
+          labels),
+      },
+      {},
+      {sm::shard_label});
+    return &e;
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local semaphore_metrics semaphore_metrics::_local_instance;
+
+} // namespace resources
@@ -0,0 +1,95 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "metrics/metrics.h"
+#include "seastarx.h"
+#include "utils/intrusive_list_helpers.h"
+#include "utils/semaphore_wait_stats.h"
+
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <absl/container/node_hash_map.h>
+
+#include <memory>
+
+namespace resources {
+
+/**
+ * @brief Exports the waits on the semaphores and mutexes gating shared
+ * resources of a shard.
+ *
+ * The semaphores of a name share the stats returned by stats(), which are
+ * exported as the `semaphore_*` metrics labelled by name: acquisitions, waits,
+ * failed acquisitions, waiters and the histogram of the wait times. The
+ * owners of the semaphores may also register the units they lend, exported
+ * as `semaphore_held_units`.
+ *
+ * Disabled unless `semaphore_wait_metrics_enabled` is set, the semaphores are
+ * then not instrumented.
+ */
+class semaphore_metrics final {
+    using units_fn = ss::noncopyable_function<size_t()>;
+
+    struct reporter {
+        friend semaphore_metrics;
+        ss::sstring name;
+        units_fn units;
+        intrusive_list_hook hook;
+    };
+
+public:
+    using deregister_holder = std::unique_ptr<reporter>;
+
+    semaphore_metrics() = default;
+    semaphore_metrics(const semaphore_metrics&) = delete;
+    semaphore_metrics& operator=(const semaphore_metrics&) = delete;
+
+    /// The stats of the semaphores named \p name, null when disabled
+    ss::lw_shared_ptr<semaphore_wait_stats> stats(const ss::sstring& name);
+
+    /**
+     * @brief Register a function reporting the units held from a semaphore
+     * named \p name.
+     *
+     * The reporter is deregistered when the returned holder is destroyed.
+     */
+    template<typename F>
+    [[nodiscard("You need to hold the returned object to maintain "
+                "registration")]] deregister_holder
+    register_held_units(const ss::sstring& name, F units) {
+        return inner_register(name, std::move(units));
+    }
+
+    /// Get a reference to the shard-global semaphore_metrics instance
+    static semaphore_metrics& local() { return _local_instance; }
+
+private:
+    struct entry {
+        ss::lw_shared_ptr<semaphore_wait_stats> stats;
+        metrics::internal_metric_groups metrics;
+    };
+
+    deregister_holder inner_register(const ss::sstring&, units_fn&&);
+    entry* find_or_create(const ss::sstring&);
+    size_t held_units(const ss::sstring&) const;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static thread_local semaphore_metrics _local_instance;
+
+    absl::node_hash_map<ss::sstring, entry> _entries;
+    intrusive_list<reporter, &reporter::hook> _reporters;
+};
+
+} // namespace resources
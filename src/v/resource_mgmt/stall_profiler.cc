@@ -0,0 +1,202 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/stall_profiler.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+#include "resource_mgmt/logger.h"
+#include "ssx/sformat.h"
+#include "vlog.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/metrics.hh>
+#include <seastar/core/reactor.hh>
+#include <seastar/core/smp.hh>
+
+#include <algorithm>
+
+namespace resources {
+
+void stall_profiler::start(config::binding<bool> enabled) {
+    _enabled.emplace(std::move(enabled));
+    _enabled->watch([this] { reconfigure(); });
+    reconfigure();
+    _aggregate_timer.set_callback([this] { aggregate(); });
+    _aggregate_timer.arm_periodic(aggregate_interval);
+    setup_metrics();
+}
+
+ss::future<> stall_profiler::stop() {
+    _aggregate_timer.cancel();
+    _enabled.reset();
+    reconfigure();
+    _metrics.clear();
+    return ss::now();
+}
+
+void stall_profiler::reconfigure() {
+    const bool enabled = _enabled && (*_enabled)();
+    if (enabled == _installed) {
+        return;
+    }
+    if (enabled) {
+        _previous_report = ss::engine().get_stall_detector_report_function();
+        ss::engine().set_stall_detector_report_function(
+          [this] { on_stall(); });
+    } else {
+        ss::engine().set_stall_detector_report_function(
+          std::exchange(_previous_report, nullptr));
+    }
+    _installed = enabled;
+}
+
+void stall_profiler::on_stall() noexcept {
+    const auto n = _pending_count.load(std::memory_order_relaxed);
+    if (n < max_pending) {
+        auto& stall = _pending[n];
+        stall.sg = ss::current_scheduling_group();
+        stall.frame_count = 0;
+        ss::backtrace([&stall](ss::frame f) {
+            if (stall.frame_count < max_frames) {
+                stall.frames[stall.frame_count++] = f;
+            }
+        });
+        _pending_count.store(n + 1, std::memory_order_release);
+    } else {
+        _pending_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (_previous_report) {
+        _previous_report();
+    }
+}
+
+void stall_profiler::aggregate() {
+    const auto now = ss::lowres_system_clock::now();
+    size_t done = 0;
+    auto count = _pending_count.load(std::memory_order_acquire);
+    while (true) {
+        for (; done < count; ++done) {
+            const auto& stall = _pending[done];
+            ss::simple_backtrace::vector_type frames(
+              stall.frames.begin(), stall.frames.begin() + stall.frame_count);
+            auto backtrace = ssx::sformat(
+              "{}", ss::simple_backtrace(std::move(frames)));
+            const auto& sg = stall.sg.name();
+            if (!_previous_report) {
+                vlog(
+                  resourceslog.warn,
+                  "Reactor stalled in scheduling group {}. Backtrace: {}",
+                  sg,
+                  backtrace);
+            }
+
+            ++_stalls;
+            auto key = std::make_pair(sg, std::move(backtrace));
+            auto it = _stacks.find(key);
+            if (it == _stacks.end()) {
+                if (_stacks.size() >= max_stacks) {
+                    ++_dropped;
+                    continue;
+                }
+                it = _stacks
+                       .emplace(
+                         key,
+                         stack{
+                           .scheduling_group = key.first,
+                           .backtrace = key.second,
+                           .first_seen = now})
+                       .first;
+            }
+            ++it->second.occurrences;
+            it->second.last_seen = now;
+        }
+        // stalls reported while aggregating are left for the next round
+        if (_pending_count.compare_exchange_strong(
+              count, 0, std::memory_order_acq_rel)) {
+            break;
+        }
+    }
+    _dropped += _pending_dropped.exchange(0, std::memory_order_relaxed);
+}
+
+stall_profiler::shard_stalls stall_profiler::shard_results(size_t limit) {
+    aggregate();
+
+    std::vector<const stack*> stacks;
+    stacks.reserve(_stacks.size());
+    for (const auto& [_, s] : _stacks) {
+        stacks.push_back(&s);
+    }
+    const auto n = std::min(limit, stacks.size());
+    std::partial_sort(
+      stacks.begin(),
+      stacks.begin() + n,
+      stacks.end(),
+      [](const stack* a, const stack* b) {
+          return a->occurrences > b->occurrences;
+      });
+
+    shard_stalls results{
+      .shard = ss::this_shard_id(), .stalls = _stalls, .dropped = _dropped};
+    results.stacks.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        results.stacks.push_back(*stacks[i]);
+    }
+    return results;
+}
+
+ss::future<std::vector<stall_profiler::shard_stalls>>
+stall_profiler::results(std::optional<ss::shard_id> shard_id, size_t limit) {
+    std::vector<shard_stalls> results;
+    if (shard_id) {
+        results.push_back(co_await ss::smp::submit_to(
+          *shard_id, [limit] { return local().shard_results(limit); }));
+        co_return results;
+    }
+
+    results.reserve(ss::smp::count);
+    for (ss::shard_id s = 0; s < ss::smp::count; ++s) {
+        results.push_back(co_await ss::smp::submit_to(
+          s, [limit] { return local().shard_results(limit); }));
+    }
+    co_return results;
+}
+
+void stall_profiler::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("stall_profiler"),
+      {
+        sm::make_counter(
+          "stalls",
+          [this] { return _stalls; },
+          sm::description("Reactor stalls aggregated by the stall profiler")),
+        sm::make_counter(
+          "dropped_stalls",
+          [this] { return _dropped; },
+          sm::description("Reactor stalls which could not be aggregated")),
+        sm::make_gauge(
+          "stacks",
+          [this] { return _stacks.size(); },
+          sm::description("Distinct stalling call sites retained")),
+      });
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local stall_profiler stall_profiler::_local_instance;
+
+} // namespace resources
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "metrics/metrics.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/scheduling.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/core/timer.hh>
+#include <seastar/util/backtrace.hh>
+
+#include <absl/container/node_hash_map.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace resources {
+
+/**
+ * The `stall_profiler` aggregates the reactor stalls reported by seastar's
+ * stall detector by scheduling group and backtrace, so that the call sites
+ * stalling most often can be found without going through the logs.
+ *
+ * Seastar reports a stall from a signal handler: the report only copies the
+ * backtrace in a preallocated slot, the slots are aggregated once a second.
+ * While the profiler is enabled its report function replaces the log of the
+ * stall by seastar, the stalls are instead logged when they are aggregated.
+ * Note that seastar reports at most `--blocked-reactor-reports-per-minute`
+ * stalls per minute.
+ */
+class stall_profiler final {
+public:
+    // frames kept per stall, the innermost ones are those of the detector
+    static constexpr size_t max_frames = 48;
+    // stalls reported between two aggregations, the following are dropped
+    static constexpr size_t max_pending = 32;
+    // distinct stalls retained, the stalls of new stacks are then dropped
+    static constexpr size_t max_stacks = 1024;
+    static constexpr auto aggregate_interval = std::chrono::seconds(1);
+
+    struct stack {
+        ss::sstring scheduling_group;
+        ss::sstring backtrace;
+        uint64_t occurrences{0};
+        ss::lowres_system_clock::time_point first_seen;
+        ss::lowres_system_clock::time_point last_seen;
+    };
+
+    struct shard_stalls {
+        ss::shard_id shard{0};
+        uint64_t stalls{0};
+        uint64_t dropped{0};
+        // the most frequent first
+        std::vector<stack> stacks;
+    };
+
+    stall_profiler() = default;
+    stall_profiler(const stall_profiler&) = delete;
+    stall_profiler& operator=(const stall_profiler&) = delete;
+    stall_profiler(stall_profiler&&) = delete;
+    stall_profiler& operator=(stall_profiler&&) = delete;
+    ~stall_profiler() = default;
+
+    /// Hooks into the stall detector of this shard, needs to be called on
+    /// every shard
+    void start(config::binding<bool> enabled);
+    ss::future<> stop();
+
+    /// The \p limit most frequent stacks of this shard
+    shard_stalls shard_results(size_t limit);
+
+    /// shard_results() of \p shard, or of every shard
+    static ss::future<std::vector<shard_stalls>>
+    results(std::optional<ss::shard_id> shard, size_t limit);
+
+    /// Get a reference to the shard-global stall_profiler instance
+    static stall_profiler& local() { return _local_instance; }
+
+private:
+    struct pending_stall {
+        ss::scheduling_group sg;
+        size_t frame_count{0};
+        std::array<ss::frame, max_frames> frames;
+    };
+
+    // called from the signal handler of the stall detector
+    void on_stall() noexcept;
+    void reconfigure();
+    void aggregate();
+    void setup_metrics();
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    static thread_local stall_profiler _local_instance;
+
+    std::optional<config::binding<bool>> _enabled;
+    std::function<void()> _previous_report;
+    bool _installed{false};
+    ss::timer<ss::lowres_clock> _aggregate_timer;
+
+    // written by on_stall() up to _pending_count, which aggregate() resets
+    // once it consumed them: the signal only interrupts the shard's thread,
+    // it never runs concurrently with aggregate()
+    std::array<pending_stall, max_pending> _pending;
+    std::atomic<size_t> _pending_count{0};
+    std::atomic<uint64_t> _pending_dropped{0};
+
+    // keyed by scheduling group and backtrace
+    absl::node_hash_map<std::pair<ss::sstring, ss::sstring>, stack> _stacks;
+    uint64_t _stalls{0};
+    uint64_t _dropped{0};
+    metrics::internal_metric_groups _metrics;
+};
+
+} // namespace resources
@@ -376,12 +376,29 @@ size_t eviction_policy::evict_balanced_from_level(
   size_t target_excess,
   std::string_view level_name,
   const level_selector& selector) {
-    size_t level_total = 0;
-    bool progress = false;
-    auto partition = sched.current();
-    const auto first = partition;
+    /*
+     * a partition with candidate segments in this level, along with its
+     * distance from the current schedule position.
+     */
+    struct candidate {
+        partition* part;
+        size_t distance;
+    };
+
+    /*
+     * a single pass over the schedule initializes the level iterators and
+     * collects the partitions having candidate segments. the round robin then
+     * only visits those, dropping each one once its candidates are exhausted,
+     * rather than lapping over every partition in the schedule until none
+     * makes progress. on a node with many partitions of which only a few hold
+     * reclaimable data this keeps marking N segments close to O(N) instead of
+     * O(N * partitions).
+     */
+    std::vector<candidate> candidates;
+    for (size_t distance = 0; distance < sched.sched_size; ++distance) {
+        auto partition = sched.current();
+        sched.next();
 
-    while (true) {
         /*
          * if this is the first time visiting this partition and this level then
          * initialize the level iterator at the first segment.
@@ -399,9 +416,55 @@ size_t eviction_policy::evict_balanced_from_level(
               level->size());
         }
 
-        if (partition->iter.has_value()) {
-            if (partition->iter.value() == level->end()) {
-                // suppress further messages about reaching end of level
+        if (!partition->iter.has_value()) {
+            continue;
+        }
+        if (partition->iter.value() == level->end()) {
+            // suppress further messages about reaching end of level
+            partition->iter.reset();
+            vlog(
+              rlog.trace,
+              "Finished level {} iteration for partition {}",
+              level_name,
+              partition->group);
+            continue;
+        }
+        candidates.push_back(candidate{partition, distance});
+    }
+
+    size_t level_total = 0;
+    std::optional<size_t> last_distance;
+    while (!candidates.empty()) {
+        size_t remaining = 0;
+        for (auto& c : candidates) {
+            auto partition = c.part;
+
+            /*
+             * schedule the current segment from this partition for removal.
+             */
+            partition->decision = partition->iter.value()->offset;
+            partition->total += partition->iter.value()->size;
+            level_total += partition->iter.value()->size;
+
+            vlog(
+              rlog.trace,
+              "Mark partition {} at offset {} for {} removal total {} "
+              "level {} total {}",
+              partition->group,
+              partition->decision.value(),
+              human::bytes(partition->iter.value()->size),
+              human::bytes(partition->total),
+              level_name,
+              human::bytes(level_total));
+
+            ++partition->iter.value();
+
+            if (level_total > target_excess) {
+                last_distance = c.distance;
+                break;
+            }
+
+            if (partition->iter.value() == partition->level->end()) {
                 partition->iter.reset();
                 vlog(
                   rlog.trace,
@@ -409,53 +472,34 @@ size_t eviction_policy::evict_balanced_from_level(
                   level_name,
                   partition->group);
             } else {
-                /*
-                 * we haven't reached the end of the candidate set so schedule
-                 * the current segment from this partition for removal.
-                 */
-                partition->decision = partition->iter.value()->offset;
-                partition->total += partition->iter.value()->size;
-                level_total += partition->iter.value()->size;
-                progress = true;
-
-                vlog(
-                  rlog.trace,
-                  "Mark partition {} at offset {} for {} removal total {} "
-                  "level {} total {}",
-                  partition->group,
-                  partition->decision.value(),
-                  human::bytes(partition->iter.value()->size),
-                  human::bytes(partition->total),
-                  level_name,
-                  human::bytes(level_total));
-
-                ++partition->iter.value();
+                candidates[remaining++] = c;
             }
         }
 
-        ++_cursor;
-        sched.next();
-
-        if (level_total > target_excess) {
+        if (last_distance.has_value()) {
             break;
         }
-
-        partition = sched.current();
-
-        // end level iteration if no progress is made
-        if (partition == first) {
-            if (!progress) {
-                vlog(
-                  rlog.trace,
-                  "Ending level {} with no more progress possible",
-                  level_name);
-                break;
-            }
+        candidates.resize(remaining);
+        if (candidates.empty()) {
+            vlog(
+              rlog.trace,
+              "Ending level {} with no more progress possible",
+              level_name);
+        } else {
             vlog(rlog.trace, "Restarting level {} iteration", level_name);
-            progress = false;
         }
     }
 
+    /*
+     * resume the next level, or the next round of eviction, just past the
+     * partition which was marked last. when the level was exhausted the
+     * round robin went full circle, back to where it started.
+     */
+    if (last_distance.has_value()) {
+        _cursor += last_distance.value() + 1;
+        sched.seek(_cursor);
+    }
+
     vlog(
       rlog.info,
       "Marked {} for removal with target {} in level {}",
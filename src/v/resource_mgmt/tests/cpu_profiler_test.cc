@@ -28,7 +28,10 @@ SEASTAR_THREAD_TEST_CASE(test_cpu_profiler) {
     using namespace std::literals;
 
     resources::cpu_profiler cp(
-      config::mock_binding(true), config::mock_binding(2ms));
+      config::mock_binding(true),
+      config::mock_binding(2ms),
+      config::mock_binding(false),
+      config::mock_binding(1000ms));
     cp.start().get();
 
     // The profiler service will request samples from seastar every
@@ -43,3 +46,25 @@ SEASTAR_THREAD_TEST_CASE(test_cpu_profiler) {
     auto results = cp.shard_results();
     BOOST_TEST(results.samples.size() >= 1);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_continuous_cpu_profiler) {
+    using namespace std::literals;
+
+    resources::cpu_profiler cp(
+      config::mock_binding(false),
+      config::mock_binding(100ms),
+      config::mock_binding(true),
+      config::mock_binding(2ms));
+    cp.start().get();
+
+    auto end_time = ss::lowres_clock::now() + 256ms + 10ms;
+    while (ss::lowres_clock::now() < end_time) {
+        ss::thread::maybe_yield();
+    }
+
+    // Only the continuous profile retains the samples
+    BOOST_TEST(cp.shard_results().samples.empty());
+    auto results = cp.continuous_shard_results();
+    BOOST_TEST(results.samples.size() >= 1);
+    cp.stop().get();
+}
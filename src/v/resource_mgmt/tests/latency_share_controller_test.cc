@@ -0,0 +1,70 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/latency_share_controller.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+using controller = resources::latency_share_controller;
+
+constexpr controller::limits limits{
+  .min_shares = 500, .max_shares = 4000, .max_step = 100};
+constexpr int baseline = 1000;
+
+int next(int current, std::optional<double> pressure, bool behind) {
+    return controller::next_shares(
+      current, baseline, pressure, behind, limits);
+}
+} // namespace
+
+TEST(LatencyShareController, RaisesSharesAboveTarget) {
+    EXPECT_EQ(next(1000, 1.5, false), 1100);
+    EXPECT_EQ(next(1000, 1.5, true), 1100);
+    EXPECT_EQ(next(3950, 10.0, false), 4000);
+    EXPECT_EQ(next(4000, 10.0, false), 4000);
+}
+
+TEST(LatencyShareController, HoldsSharesNearTarget) {
+    EXPECT_EQ(next(1500, 0.9, false), 1500);
+    EXPECT_EQ(next(1500, 0.9, true), 1500);
+    EXPECT_EQ(next(1500, 1.0, false), 1500);
+}
+
+TEST(LatencyShareController, YieldsToBackgroundBelowTarget) {
+    EXPECT_EQ(next(1000, 0.5, true), 900);
+    EXPECT_EQ(next(550, 0.5, true), 500);
+    EXPECT_EQ(next(500, std::nullopt, true), 500);
+}
+
+TEST(LatencyShareController, ReturnsToBaseline) {
+    EXPECT_EQ(next(1500, 0.5, false), 1400);
+    EXPECT_EQ(next(600, std::nullopt, false), 700);
+    EXPECT_EQ(next(1050, 0.5, false), 1000);
+    EXPECT_EQ(next(1000, 0.5, false), 1000);
+}
+
+TEST(LatencyShareController, ClampsToLimits) {
+    // a baseline outside of the limits is clamped
+    EXPECT_EQ(
+      controller::next_shares(
+        300, 300, std::nullopt, false, {.min_shares = 500, .max_shares = 600}),
+      301);
+    // inconsistent limits allow the minimum
+    EXPECT_EQ(
+      controller::next_shares(
+        1000,
+        baseline,
+        2.0,
+        false,
+        {.min_shares = 800, .max_shares = 100, .max_step = 1000}),
+      800);
+}
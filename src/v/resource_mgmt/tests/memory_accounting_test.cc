@@ -0,0 +1,70 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "resource_mgmt/memory_accounting.h"
+#include "utils/tracking_allocator.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <absl/container/btree_map.h>
+
+#include <cstdint>
+
+using resources::memory_subsystem;
+
+namespace {
+auto& local() { return resources::memory_accounting::local(); }
+int64_t fetch_bytes() {
+    return local().consumption(memory_subsystem::kafka_fetch);
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(check_tracked_containers) {
+    const auto before = local().consumption(memory_subsystem::compaction);
+    {
+        auto map = util::mem_tracked::map<absl::btree_map, uint64_t, uint64_t>(
+          local().create_tracker(memory_subsystem::compaction, "test"));
+        for (uint64_t i = 0; i < 1000; ++i) {
+            map.emplace(i, i);
+        }
+        BOOST_CHECK_GE(
+          local().consumption(memory_subsystem::compaction),
+          before + 1000 * 2 * sizeof(uint64_t));
+        BOOST_CHECK_EQUAL(local().consumption(memory_subsystem::stm), 0);
+    }
+    // the tracker is gone with the container
+    BOOST_CHECK_EQUAL(
+      local().consumption(memory_subsystem::compaction), before);
+}
+
+SEASTAR_THREAD_TEST_CASE(check_reporters) {
+    size_t bytes = 0;
+    {
+        auto holder = local().register_reporter(
+          memory_subsystem::kafka_fetch, [&] { return bytes; });
+        BOOST_CHECK_EQUAL(fetch_bytes(), 0);
+
+        bytes = 5;
+        BOOST_CHECK_EQUAL(fetch_bytes(), 5);
+
+        auto tracker = local().create_tracker(
+          memory_subsystem::kafka_fetch, "test");
+        tracker->allocate(3);
+        BOOST_CHECK_EQUAL(fetch_bytes(), 8);
+        tracker->deallocate(3);
+
+        BOOST_CHECK_EQUAL(
+          local().consumption(memory_subsystem::batch_cache), 0);
+    }
+    // deregistered
+    BOOST_CHECK_EQUAL(fetch_bytes(), 0);
+}
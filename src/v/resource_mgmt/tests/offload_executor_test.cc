@@ -0,0 +1,56 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/property.h"
+#include "resource_mgmt/offload_executor.h"
+
+#include <seastar/core/sleep.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+namespace {
+auto& local() { return resources::offload_executor::local(); }
+
+// keeps the shard busy without yielding to the reactor
+void spin(std::chrono::milliseconds d) {
+    const auto until = std::chrono::steady_clock::now() + d;
+    while (std::chrono::steady_clock::now() < until) {
+    }
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(runs_locally_when_not_started) {
+    BOOST_REQUIRE(!local().maybe_submit([] { return ss::this_shard_id(); }));
+}
+
+SEASTAR_THREAD_TEST_CASE(offloads_from_busy_shard) {
+    BOOST_REQUIRE_GT(ss::smp::count, 1);
+    ss::smp::invoke_on_all([] {
+        local().start(config::mock_binding(true));
+    }).get();
+
+    // the shard was idle since it started
+    BOOST_REQUIRE(!local().maybe_submit([] { return ss::this_shard_id(); }));
+
+    // the next sample sees the shard busy while the other shards idle
+    spin(3 * resources::offload_executor::sample_interval);
+    ss::sleep(20ms).get();
+    auto f = local().maybe_submit([] { return ss::this_shard_id(); });
+    BOOST_REQUIRE(f.has_value());
+    BOOST_REQUIRE_NE(std::move(*f).get(), ss::this_shard_id());
+
+    ss::smp::invoke_on_all([] { return local().stop(); }).get();
+    BOOST_REQUIRE(!local().maybe_submit([] { return ss::this_shard_id(); }));
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "resource_mgmt/pprof.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+// A protobuf field: either a varint or the bytes of a length delimited one
+struct field {
+    uint32_t number;
+    uint64_t varint;
+    std::string_view bytes;
+};
+
+uint64_t read_varint(std::string_view& in) {
+    uint64_t v = 0;
+    for (int shift = 0; !in.empty(); shift += 7) {
+        auto b = static_cast<uint8_t>(in.front());
+        in.remove_prefix(1);
+        v |= uint64_t{b & 0x7fU} << shift;
+        if ((b & 0x80U) == 0) {
+            return v;
+        }
+    }
+    ADD_FAILURE() << "truncated varint";
+    return v;
+}
+
+std::vector<field> read_message(std::string_view in) {
+    std::vector<field> fields;
+    while (!in.empty()) {
+        auto key = read_varint(in);
+        field f{.number = static_cast<uint32_t>(key >> 3U)};
+        if ((key & 7U) == 0) {
+            f.varint = read_varint(in);
+        } else {
+            EXPECT_EQ(key & 7U, 2);
+            auto size = read_varint(in);
+            f.bytes = in.substr(0, size);
+            in.remove_prefix(size);
+        }
+        fields.push_back(f);
+    }
+    return fields;
+}
+
+std::vector<uint64_t> read_packed(std::string_view in) {
+    std::vector<uint64_t> vs;
+    while (!in.empty()) {
+        vs.push_back(read_varint(in));
+    }
+    return vs;
+}
+
+struct decoded_profile {
+    std::vector<std::string> strings;
+    // location id to (mapping filename, address)
+    std::map<uint64_t, std::pair<std::string, uint64_t>> locations;
+    // (shard, location ids) to counts
+    std::map<std::pair<std::string, std::vector<uint64_t>>, uint64_t> samples;
+    uint64_t period{0};
+    std::vector<std::string> comments;
+};
+
+decoded_profile decode(std::string_view pb) {
+    decoded_profile p;
+    std::map<uint64_t, uint64_t> mapping_names;
+    std::map<uint64_t, std::pair<uint64_t, uint64_t>> locations;
+    std::vector<std::pair<uint64_t, std::vector<uint64_t>>> samples;
+    std::vector<uint64_t> counts;
+    std::vector<uint64_t> comments;
+    for (auto& f : read_message(pb)) {
+        switch (f.number) {
+        case 2: {
+            uint64_t shard = 0;
+            std::vector<uint64_t> ids;
+            for (auto& sf : read_message(f.bytes)) {
+                if (sf.number == 1) {
+                    ids = read_packed(sf.bytes);
+                } else if (sf.number == 2) {
+                    auto values = read_packed(sf.bytes);
+                    EXPECT_EQ(values.size(), 2);
+                    EXPECT_EQ(values[1], values[0] * p.period);
+                    counts.push_back(values[0]);
+                } else if (sf.number == 3) {
+                    for (auto& lf : read_message(sf.bytes)) {
+                        if (lf.number == 2) {
+                            shard = lf.varint;
+                        }
+                    }
+                }
+            }
+            samples.emplace_back(shard, std::move(ids));
+            break;
+        }
+        case 3: {
+            uint64_t id = 0;
+            for (auto& mf : read_message(f.bytes)) {
+                if (mf.number == 1) {
+                    id = mf.varint;
+                } else if (mf.number == 5) {
+                    mapping_names[id] = mf.varint;
+                }
+            }
+            break;
+        }
+        case 4: {
+            uint64_t id = 0, mapping = 0, address = 0;
+            for (auto& lf : read_message(f.bytes)) {
+                if (lf.number == 1) {
+                    id = lf.varint;
+                } else if (lf.number == 2) {
+                    mapping = lf.varint;
+                } else if (lf.number == 3) {
+                    address = lf.varint;
+                }
+            }
+            locations[id] = {mapping, address};
+            break;
+        }
+        case 6:
+            p.strings.emplace_back(f.bytes);
+            break;
+        case 12:
+            p.period = f.varint;
+            break;
+        case 13:
+            comments.push_back(f.varint);
+            break;
+        }
+    }
+
+    for (auto& [id, loc] : locations) {
+        p.locations[id] = {
+          p.strings.at(mapping_names.at(loc.first)), loc.second};
+    }
+    for (size_t i = 0; i < samples.size(); ++i) {
+        p.samples[{p.strings.at(samples[i].first), samples[i].second}]
+          += counts.at(i);
+    }
+    for (auto c : comments) {
+        p.comments.push_back(p.strings.at(c));
+    }
+    return p;
+}
+
+} // namespace
+
+TEST(Pprof, EncodesSamples) {
+    using resources::cpu_profiler;
+    std::vector<cpu_profiler::shard_samples> profiles{
+      {.shard = 0,
+       .dropped_samples = 3,
+       .samples = {{"0x1234 0x5678 libc.so.6+0xabc", 5}, {"0x1234", 2}}},
+      {.shard = 1, .dropped_samples = 0, .samples = {{" 0x1234 0x9", 1}}},
+    };
+
+    auto p = decode(
+      resources::to_pprof(profiles, std::chrono::milliseconds(10)));
+
+    ASSERT_FALSE(p.strings.empty());
+    EXPECT_EQ(p.strings[0], "");
+    EXPECT_EQ(p.period, 10'000'000);
+    EXPECT_THAT(p.comments, testing::ElementsAre("shard 0 dropped 3 samples"));
+
+    // The frames of the binary and the shared objects are interned once
+    EXPECT_THAT(
+      p.locations,
+      testing::ElementsAre(
+        testing::Pair(1, testing::Pair("redpanda", 0x1234)),
+        testing::Pair(2, testing::Pair("redpanda", 0x5678)),
+        testing::Pair(3, testing::Pair("libc.so.6", 0xabc)),
+        testing::Pair(4, testing::Pair("redpanda", 0x9))));
+
+    using key = std::pair<std::string, std::vector<uint64_t>>;
+    EXPECT_THAT(
+      p.samples,
+      testing::ElementsAre(
+        testing::Pair(key{"0", {1}}, 2),
+        testing::Pair(key{"0", {1, 2, 3}}, 5),
+        testing::Pair(key{"1", {1, 4}}, 1)));
+}
+
+TEST(Pprof, SkipsMalformedFrames) {
+    using resources::cpu_profiler;
+    std::vector<cpu_profiler::shard_samples> profiles{
+      {.shard = 0, .samples = {{"0x10 bogus 0x 0xzz 0x20", 1}}}};
+
+    auto p = decode(
+      resources::to_pprof(profiles, std::chrono::milliseconds(1)));
+
+    EXPECT_EQ(p.locations.size(), 2);
+    ASSERT_EQ(p.samples.size(), 1);
+    EXPECT_THAT(p.samples.begin()->first.second, testing::ElementsAre(1, 2));
+}
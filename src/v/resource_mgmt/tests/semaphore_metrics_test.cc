@@ -0,0 +1,83 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/configuration.h"
+#include "resource_mgmt/semaphore_metrics.h"
+#include "utils/adjustable_semaphore.h"
+#include "utils/mutex.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+namespace {
+auto& local() { return resources::semaphore_metrics::local(); }
+
+void enable() {
+    config::shard_local_cfg().semaphore_wait_metrics_enabled.set_value(true);
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(not_instrumented_when_disabled) {
+    BOOST_REQUIRE(!local().stats("test/disabled"));
+    BOOST_REQUIRE(!local().register_held_units("test/disabled", [] {
+        return size_t{0};
+    }));
+}
+
+SEASTAR_THREAD_TEST_CASE(records_semaphore_waits) {
+    enable();
+    auto stats = local().stats("test/semaphore");
+    BOOST_REQUIRE(stats);
+    BOOST_REQUIRE_EQUAL(stats, local().stats("test/semaphore"));
+
+    adjustable_semaphore sem(1, "test/semaphore", stats);
+    auto units = sem.get_units(1).get();
+    BOOST_REQUIRE_EQUAL(stats->acquisitions, 1);
+    BOOST_REQUIRE_EQUAL(stats->waits, 0);
+
+    auto waiting = sem.get_units(1);
+    BOOST_REQUIRE_EQUAL(stats->waits, 1);
+    BOOST_REQUIRE_EQUAL(stats->waiters, 1);
+    units.return_all();
+    waiting.get();
+    BOOST_REQUIRE_EQUAL(stats->acquisitions, 2);
+    BOOST_REQUIRE_EQUAL(stats->waiters, 0);
+    BOOST_REQUIRE_EQUAL(stats->wait_time.count(), 1);
+    BOOST_REQUIRE_EQUAL(stats->failed, 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(records_failed_waits) {
+    enable();
+    auto stats = local().stats("test/aborted");
+    adjustable_semaphore sem(0, "test/aborted", stats);
+    ss::abort_source as;
+    auto waiting = sem.get_units(1, as);
+    as.request_abort();
+    BOOST_REQUIRE_THROW(waiting.get(), ss::abort_requested_exception);
+    BOOST_REQUIRE_EQUAL(stats->waits, 1);
+    BOOST_REQUIRE_EQUAL(stats->waiters, 0);
+    BOOST_REQUIRE_EQUAL(stats->failed, 1);
+}
+
+SEASTAR_THREAD_TEST_CASE(records_mutex_waits) {
+    enable();
+    auto stats = local().stats("test/mutex");
+    mutex m("test/mutex", stats);
+    auto units = m.get_units().get();
+    auto waiting = m.with([] { return 42; });
+    BOOST_REQUIRE_EQUAL(stats->waiters, 1);
+    units.return_all();
+    BOOST_REQUIRE_EQUAL(waiting.get(), 42);
+    BOOST_REQUIRE_EQUAL(stats->acquisitions, 2);
+    BOOST_REQUIRE_EQUAL(stats->waits, 1);
+    BOOST_REQUIRE(m.try_get_units());
+    BOOST_REQUIRE_EQUAL(stats->acquisitions, 3);
+}
@@ -0,0 +1,43 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/property.h"
+#include "resource_mgmt/stall_profiler.h"
+
+#include <seastar/core/reactor.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+SEASTAR_THREAD_TEST_CASE(aggregates_stalls) {
+    auto& profiler = resources::stall_profiler::local();
+    const auto notify_ms = ss::engine().get_blocked_reactor_notify_ms();
+    ss::engine().update_blocked_reactor_notify_ms(10ms);
+    profiler.start(config::mock_binding(true));
+
+    const auto until = std::chrono::steady_clock::now() + 200ms;
+    while (std::chrono::steady_clock::now() < until) {
+    }
+
+    auto results = profiler.shard_results(10);
+    BOOST_REQUIRE_GE(results.stalls, 1);
+    BOOST_REQUIRE(!results.stacks.empty());
+    BOOST_REQUIRE_EQUAL(
+      results.stacks.front().scheduling_group,
+      ss::current_scheduling_group().name());
+    BOOST_REQUIRE(!results.stacks.front().backtrace.empty());
+    BOOST_REQUIRE(profiler.shard_results(0).stacks.empty());
+
+    profiler.stop().get();
+    ss::engine().update_blocked_reactor_notify_ms(notify_ms);
+}
@@ -76,3 +76,64 @@ SEASTAR_THREAD_TEST_CASE(test_partition_iteration) {
           == first_loop_ordering.end());
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(test_balanced_eviction_skips_exhausted_partitions) {
+    /*
+     * one shard with partitions holding 0, 3, 0, 1, 5 candidate segments of
+     * one byte each in the local retention level.
+     */
+    const std::vector<size_t> segments{0, 3, 0, 1, 5};
+    const auto make_schedule = [&] {
+        std::vector<ep::shard_partitions> shards;
+        shards.resize(1);
+        for (size_t i = 0; i < segments.size(); ++i) {
+            ep::partition p{.group = raft::group_id(i)};
+            for (size_t s = 0; s < segments[i]; ++s) {
+                p.offsets.effective_local_retention.push_back(
+                  storage::reclaimable_offsets::offset{
+                    .offset = model::offset(s), .size = 1});
+            }
+            shards[0].partitions.push_back(std::move(p));
+        }
+        auto sched = ep::schedule(std::move(shards), segments.size());
+        sched.seek(0);
+        return sched;
+    };
+
+    {
+        // a target larger than the level marks every candidate
+        ep policy(nullptr, nullptr);
+        auto sched = make_schedule();
+        BOOST_REQUIRE_EQUAL(
+          policy.evict_until_local_retention(sched, 100), size_t(9));
+        for (size_t i = 0; i < segments.size(); ++i) {
+            const auto& p = sched.shards[0].partitions[i];
+            BOOST_REQUIRE_EQUAL(p.total, segments[i]);
+            if (segments[i] == 0) {
+                BOOST_REQUIRE(!p.decision.has_value());
+            } else {
+                BOOST_REQUIRE_EQUAL(
+                  p.decision.value(), model::offset(segments[i] - 1));
+            }
+        }
+        // the round robin went full circle
+        BOOST_REQUIRE_EQUAL(sched.current()->group, raft::group_id(0));
+    }
+
+    {
+        /*
+         * marking stops once the target is exceeded: the first lap marks
+         * partitions 1, 3 and 4, the second lap partition 1.
+         */
+        ep policy(nullptr, nullptr);
+        auto sched = make_schedule();
+        BOOST_REQUIRE_EQUAL(
+          policy.evict_until_local_retention(sched, 3), size_t(4));
+        const auto& parts = sched.shards[0].partitions;
+        BOOST_REQUIRE_EQUAL(parts[1].total, size_t(2));
+        BOOST_REQUIRE_EQUAL(parts[3].total, size_t(1));
+        BOOST_REQUIRE_EQUAL(parts[4].total, size_t(1));
+        // the next level resumes past the partition marked last
+        BOOST_REQUIRE_EQUAL(sched.current()->group, raft::group_id(2));
+    }
+}
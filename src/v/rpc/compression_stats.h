@@ -0,0 +1,81 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace rpc {
+
+/**
+ * Compression statistics of the payloads of a single method, used to decide
+ * whether its next payload is worth compressing.
+ *
+ * Every compressed payload updates a moving average of the compression ratio
+ * (compressed over uncompressed size). While the average is above max_ratio
+ * the payloads of the method are sent uncompressed and only one out of
+ * probe_interval is compressed, to notice when they become compressible
+ * again.
+ */
+class compression_stats {
+public:
+    static constexpr double max_ratio = 0.9;
+    static constexpr uint32_t probe_interval = 32;
+    // weight of the latest payload in the moving average
+    static constexpr double ratio_alpha = 0.2;
+
+    bool should_compress() {
+        if (_compressed == 0 || _ratio <= max_ratio) {
+            return true;
+        }
+        return ++_skipped_since_probe >= probe_interval;
+    }
+
+    void record_compressed(
+      size_t uncompressed, size_t compressed, std::chrono::nanoseconds t) {
+        const auto ratio = uncompressed == 0
+                             ? 1.0
+                             : static_cast<double>(compressed)
+                                 / static_cast<double>(uncompressed);
+        _ratio = _compressed == 0 ? ratio
+                                  : ratio_alpha * ratio
+                                      + (1 - ratio_alpha) * _ratio;
+        ++_compressed;
+        _skipped_since_probe = 0;
+        _uncompressed_bytes += uncompressed;
+        _compressed_bytes += compressed;
+        _compression_time += t;
+    }
+
+    void record_skipped() { ++_skipped; }
+
+    /// moving average of the compression ratio, 0 before the first payload
+    double ratio() const { return _ratio; }
+    uint64_t compressed() const { return _compressed; }
+    uint64_t skipped() const { return _skipped; }
+    uint64_t uncompressed_bytes() const { return _uncompressed_bytes; }
+    uint64_t compressed_bytes() const { return _compressed_bytes; }
+    std::chrono::nanoseconds compression_time() const {
+        return _compression_time;
+    }
+
+private:
+    double _ratio{0};
+    uint32_t _skipped_since_probe{0};
+    uint64_t _compressed{0};
+    uint64_t _skipped{0};
+    uint64_t _uncompressed_bytes{0};
+    uint64_t _compressed_bytes{0};
+    std::chrono::nanoseconds _compression_time{0};
+};
+
+} // namespace rpc
@@ -28,9 +28,12 @@
 namespace rpc {
 
 connection_allocation_strategy::connection_allocation_strategy(
-  unsigned max_connections_per_node, unsigned total_shards)
+  unsigned max_connections_per_node,
+  unsigned total_shards,
+  unsigned connections_per_shard)
   : _total_shards(total_shards)
   , _max_connections_per_node(max_connections_per_node)
+  , _connections_per_shard_limit(std::max(connections_per_shard, 1U))
   , _g(std::random_device()()) {
     _connections_per_shard.reserve(_total_shards);
     for (auto shard : std::views::iota((unsigned)0, _total_shards)) {
@@ -130,30 +133,66 @@ void connection_allocation_strategy::get_shard_to_connection_assignments(
         auto connection_idx = j++ % conn_shards_r.size();
         c.add_mapping.emplace_back(node, shard, conn_shards_r[connection_idx]);
     }
+
+    // Every shard additionally uses the connections that follow its primary
+    // one in the shuffled order, so that the extra load is spread evenly.
+    const auto per_shard = std::min<size_t>(
+      _connections_per_shard_limit, conn_shards_r.size());
+    if (per_shard < 2) {
+        return;
+    }
+    const auto primaries = c.add_mapping.size() - _total_shards;
+    for (auto i = primaries; i < primaries + _total_shards; ++i) {
+        auto primary = c.add_mapping[i];
+        auto primary_idx = std::distance(
+          conn_shards_r.begin(),
+          std::find(
+            conn_shards_r.begin(), conn_shards_r.end(), primary.conn_shard));
+        for (size_t k = 1; k < per_shard; ++k) {
+            c.add_mapping.emplace_back(
+              node,
+              primary.src_shard,
+              conn_shards_r[(primary_idx + k) % conn_shards_r.size()]);
+        }
+    }
 }
 
 connection_cache::connection_cache(
   ss::sharded<ss::abort_source>& as,
   std::optional<connection_cache_label> label,
-  unsigned connections_per_node)
+  unsigned connections_per_node,
+  unsigned connections_per_shard)
   : _label(std::move(label)) {
     _as_subscription = as.local().subscribe(
       [this]() mutable noexcept { shutdown(); });
     if (ss::this_shard_id() == _coordinator_shard) {
         _coordinator_state = std::make_unique<coordinator_state>(
           mutex(),
-          connection_allocation_strategy(connections_per_node, ss::smp::count));
+          connection_allocation_strategy(
+            connections_per_node, ss::smp::count, connections_per_shard));
     }
 }
 
 std::optional<ss::shard_id> connection_cache::shard_for(
-  model::node_id, ss::shard_id, model::node_id n, ss::shard_id) const {
+  model::node_id self, ss::shard_id src, model::node_id n, ss::shard_id) const {
+    return shard_for(self, src, n, std::nullopt);
+}
+
+std::optional<ss::shard_id> connection_cache::shard_for(
+  model::node_id,
+  ss::shard_id,
+  model::node_id n,
+  std::optional<stream_key> stream) const {
     auto shard_it = _connection_map.find(n);
-    if (shard_it == _connection_map.end()) {
+    if (shard_it == _connection_map.end() || shard_it->second.empty()) {
         return {};
     }
+    const auto& shards = shard_it->second;
+    if (!stream || shards.size() == 1) {
+        return shards.front();
+    }
 
-    return shard_it->second;
+    return shards[jump_consistent_hash(stream->key, shards.size())];
 }
 
 ss::future<> connection_cache::emplace(
@@ -167,7 +206,7 @@ ss::future<> connection_cache::emplace(
       n,
       ss::make_lw_shared<rpc::reconnect_transport>(
         std::move(c), std::move(backoff_policy), _label, n));
-    _connection_map[n] = ss::this_shard_id();
+    _connection_map[n] = {ss::this_shard_id()};
 }
 
 /// \brief closes all client connections
@@ -216,10 +255,20 @@ ss::future<> connection_cache::apply_changes(
         }
     }
 
-    // Add shard mappings
-    co_await ss::parallel_for_each(changes.add_mapping, [this](auto map) {
+    // Add shard mappings, the connections of a shard are installed together
+    // to keep the primary one first
+    absl::flat_hash_map<
+      std::pair<ss::shard_id, model::node_id>,
+      std::vector<ss::shard_id>>
+      locations;
+    for (const auto& map : changes.add_mapping) {
+        locations[{map.src_shard, map.node}].push_back(map.conn_shard);
+    }
+    co_await ss::parallel_for_each(locations, [this](auto& location) {
         return add_or_update_connection_location(
-          map.src_shard, map.node, map.conn_shard);
+          location.first.first,
+          location.first.second,
+          std::move(location.second));
     });
 
     // Remove any shard mappings
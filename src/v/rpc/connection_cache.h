@@ -36,7 +36,9 @@ namespace rpc {
 class connection_allocation_strategy {
 public:
     connection_allocation_strategy(
-      unsigned max_connections_per_node, unsigned total_shards);
+      unsigned max_connections_per_node,
+      unsigned total_shards,
+      unsigned connections_per_shard = 1);
 
     // \brief Returns whether a node has already been assigned connections.
     bool has_connection_assignments_for(model::node_id) const;
@@ -47,6 +49,8 @@ public:
     };
     using remove_mapping_action = connection_assignment_action;
 
+    /// Every shard is assigned one or more connections to a node, the first
+    /// assignment of a shard is its primary connection.
     struct shard_assignment_action {
         model::node_id node;
         ss::shard_id src_shard;
@@ -71,6 +75,7 @@ public:
 private:
     unsigned _total_shards;
     unsigned _max_connections_per_node;
+    unsigned _connections_per_shard_limit;
 
     absl::flat_hash_map<model::node_id, absl::flat_hash_set<ss::shard_id>>
       _node_to_shards;
@@ -90,10 +95,17 @@ public:
     using underlying = std::unordered_map<model::node_id, transport_ptr>;
     using iterator = typename underlying::iterator;
 
+    /// Requests sent with the same stream key use the same connection, e.g.
+    /// all the requests of a raft group.
+    struct stream_key {
+        uint64_t key;
+    };
+
     explicit connection_cache(
       ss::sharded<ss::abort_source>&,
       std::optional<connection_cache_label> label = std::nullopt,
-      unsigned connections_per_node = 8);
+      unsigned connections_per_node = 8,
+      unsigned connections_per_shard = 1);
 
     bool contains(model::node_id n) const { return _cache.contains(n); }
     transport_ptr get(model::node_id n) const { return _cache.get(n); }
@@ -128,6 +140,26 @@ public:
       ss::shard_id src_shard,
       model::node_id node_id,
       timeout_spec connection_timeout,
+      Func&& f) {
+        return with_node_client<Protocol, Func>(
+          self,
+          src_shard,
+          node_id,
+          std::nullopt,
+          connection_timeout,
+          std::forward<Func>(f));
+    }
+
+    /// Same as with_node_client, when the shard has more than one connection
+    /// to the node the stream key picks the connection.
+    template<typename Protocol, typename Func>
+    requires requires(Func&& f, Protocol proto) { f(proto); }
+    auto with_node_client(
+      model::node_id self,
+      ss::shard_id src_shard,
+      model::node_id node_id,
+      std::optional<stream_key> stream,
+      timeout_spec connection_timeout,
       Func&& f) {
         using ret_t = result_wrap_t<std::invoke_result_t<Func, Protocol>>;
 
@@ -136,7 +168,8 @@ public:
               rpc::make_error_code(errc::shutting_down));
         }
 
-        auto shard = rpc::connection_cache::shard_for(self, src_shard, node_id);
+        auto shard = rpc::connection_cache::shard_for(
+          self, src_shard, node_id, stream);
         if (!shard) {
             return ss::futurize<ret_t>::convert(
               rpc::make_error_code(errc::missing_node_rpc_client));
@@ -180,6 +213,24 @@ public:
           std::forward<Func>(f));
     }
 
+    template<typename Protocol, typename Func, RpcDurationOrPoint Timeout>
+    requires requires(Func&& f, Protocol proto) { f(proto); }
+    auto with_node_client(
+      model::node_id self,
+      ss::shard_id src_shard,
+      model::node_id node_id,
+      std::optional<stream_key> stream,
+      Timeout connection_timeout,
+      Func&& f) {
+        return with_node_client<Protocol, Func>(
+          self,
+          src_shard,
+          node_id,
+          stream,
+          timeout_spec::from_either(connection_timeout),
+          std::forward<Func>(f));
+    }
+
     /// If a reconnect_transport is in a backed-off state, reset
     /// it so that the next RPC will be dispatched.  This is useful
     /// when a down node comes back to life: the first time we see
@@ -202,6 +253,12 @@ public:
       model::node_id node,
       ss::shard_id max_shards = ss::smp::count) const;
 
+    std::optional<ss::shard_id> shard_for(
+      model::node_id self,
+      ss::shard_id src,
+      model::node_id node,
+      std::optional<stream_key> stream) const;
+
 private:
     std::optional<connection_cache_label> _label;
     connection_set _cache;
@@ -237,17 +294,23 @@ private:
       connection_allocation_strategy::changes,
       std::optional<connection_config>);
 
-    // Shard-local map that where connections for a given shard are located
-    absl::flat_hash_map<model::node_id, ss::shard_id> _connection_map;
+    // Shard-local map that where connections for a given shard are located,
+    // the primary connection comes first
+    absl::flat_hash_map<model::node_id, std::vector<ss::shard_id>>
+      _connection_map;
 
     ss::future<> add_or_update_connection_location(
-      ss::shard_id dest_shard, model::node_id node, ss::shard_id conn_loc) {
-        return container().invoke_on(dest_shard, [node, conn_loc](auto& cache) {
-            if (cache.is_shutting_down()) {
-                return;
-            }
-            cache._connection_map[node] = conn_loc;
-        });
+      ss::shard_id dest_shard,
+      model::node_id node,
+      std::vector<ss::shard_id> conn_locs) {
+        return container().invoke_on(
+          dest_shard,
+          [node, conn_locs = std::move(conn_locs)](auto& cache) mutable {
+              if (cache.is_shutting_down()) {
+                  return;
+              }
+              cache._connection_map[node] = std::move(conn_locs);
+          });
     }
 
     ss::future<>
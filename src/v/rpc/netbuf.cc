@@ -15,6 +15,8 @@
 #include "rpc/types.h"
 #include "vassert.h"
 
+#include <chrono>
+
 namespace rpc {
 iobuf header_as_iobuf(const header& h) {
     iobuf b;
@@ -31,18 +33,31 @@ ss::future<ss::scattered_message<char>> netbuf::as_scattered() && {
     // Move object members into coroutine before first supension.
     iobuf out_buf = std::move(_out);
     auto hdr = _hdr;
+    auto* stats = _compression_stats;
 
     if (hdr.correlation_id == 0 || hdr.meta == 0) {
         throw std::runtime_error(
           "cannot compose scattered view with incomplete header. missing "
           "correlation_id or remote method id");
     }
-    if (
-      out_buf.size_bytes() >= _min_compression_bytes
-      && rpc::compression_type::zstd == hdr.compression) {
+    const bool eligible = out_buf.size_bytes() >= _min_compression_bytes
+                          && rpc::compression_type::zstd == hdr.compression;
+    if (eligible && (stats == nullptr || stats->should_compress())) {
         auto& zstd_inst = compression::async_stream_zstd_instance();
+        const auto uncompressed = out_buf.size_bytes();
+        const auto start = std::chrono::steady_clock::now();
         out_buf = co_await zstd_inst.compress(std::move(out_buf));
+        if (stats) {
+            stats->record_compressed(
+              uncompressed,
+              out_buf.size_bytes(),
+              std::chrono::steady_clock::now() - start);
+        }
     } else {
+        if (eligible) {
+            // the payloads of this method don't compress well
+            stats->record_skipped();
+        }
         // didn't meet min requirements
         hdr.compression = rpc::compression_type::none;
     }
@@ -96,6 +96,31 @@ public:
                 [this] { return _methods[{{loop.index-1}}].probes.latency_hist().internal_histogram_logform(); },
                 sm::description("Internal RPC service latency"),
                 labels),
+               sm::make_counter(
+                "reply_uncompressed_bytes",
+                [this] { return _methods[{{loop.index-1}}].probes.reply_compression().uncompressed_bytes(); },
+                sm::description("Size of the compressed replies before compression"),
+                labels),
+               sm::make_counter(
+                "reply_compressed_bytes",
+                [this] { return _methods[{{loop.index-1}}].probes.reply_compression().compressed_bytes(); },
+                sm::description("Size of the compressed replies after compression"),
+                labels),
+               sm::make_gauge(
+                "reply_compression_ratio",
+                [this] { return _methods[{{loop.index-1}}].probes.reply_compression().ratio(); },
+                sm::description("Moving average of the compressed over uncompressed size of the replies"),
+                labels),
+               sm::make_counter(
+                "reply_compression_time_us",
+                [this] { return std::chrono::duration_cast<std::chrono::microseconds>(_methods[{{loop.index-1}}].probes.reply_compression().compression_time()).count(); },
+                sm::description("Time spent compressing replies"),
+                labels),
+               sm::make_counter(
+                "reply_compression_skipped",
+                [this] { return _methods[{{loop.index-1}}].probes.reply_compression().skipped(); },
+                sm::description("Replies sent uncompressed as they don't compress well"),
+                labels),
                 }, {}, {sm::shard_label, method_label});
         }
       {%- endfor %}
@@ -266,6 +266,8 @@ ss::future<> rpc_server::dispatch_method_once(
                          */
                         reply_buf.set_version(ctx->get_header().version);
                     }
+                    reply_buf.set_compression_stats(
+                      &m->probes.reply_compression());
                     return send_reply(ctx, std::move(reply_buf))
                       .finally([m, l = std::move(l)]() mutable {
                           m->probes.latency_hist().record(
@@ -20,6 +20,7 @@
 #include <seastar/util/defer.hh>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 #include <boost/test/tools/old/interface.hpp>
 
 #include <chrono>
@@ -115,3 +116,47 @@ SEASTAR_THREAD_TEST_CASE(connection_allocation_strategy_remove_test) {
         BOOST_REQUIRE(map_rm != change_rm.remove_mapping.end());
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(connection_allocation_strategy_per_shard_test) {
+    constexpr int max_connections_per_node = 8;
+    constexpr int shards_per_node = 16;
+    constexpr int connections_per_shard = 3;
+
+    rpc::connection_allocation_strategy alloc_strat(
+      max_connections_per_node, shards_per_node, connections_per_shard);
+    auto change = alloc_strat.create_connection_assignments_for(
+      model::node_id(0));
+
+    BOOST_REQUIRE_EQUAL(
+      change.add_connections.size(), max_connections_per_node);
+    BOOST_REQUIRE_EQUAL(
+      change.add_mapping.size(), shards_per_node * connections_per_shard);
+
+    absl::flat_hash_set<ss::shard_id> conn_shards;
+    for (auto con : change.add_connections) {
+        conn_shards.insert(con.shard);
+    }
+
+    absl::flat_hash_map<ss::shard_id, std::vector<ss::shard_id>> per_shard;
+    absl::flat_hash_map<ss::shard_id, size_t> shards_depending_on_con;
+    for (auto map : change.add_mapping) {
+        BOOST_REQUIRE(conn_shards.contains(map.conn_shard));
+        per_shard[map.src_shard].push_back(map.conn_shard);
+        shards_depending_on_con[map.conn_shard]++;
+    }
+
+    BOOST_REQUIRE_EQUAL(per_shard.size(), shards_per_node);
+    for (auto& [shard, conns] : per_shard) {
+        // distinct connections, a shard that owns one uses it first
+        absl::flat_hash_set<ss::shard_id> distinct(conns.begin(), conns.end());
+        BOOST_REQUIRE_EQUAL(distinct.size(), connections_per_shard);
+        if (conn_shards.contains(shard)) {
+            BOOST_REQUIRE_EQUAL(conns.front(), shard);
+        }
+    }
+    for (auto& [shard, count] : shards_depending_on_con) {
+        BOOST_REQUIRE_EQUAL(
+          count,
+          shards_per_node * connections_per_shard / max_connections_per_node);
+    }
+}
@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "random/generators.h"
 #include "rpc/parse_utils.h"
 
 #include <seastar/core/thread.hh>
@@ -45,3 +46,38 @@ SEASTAR_THREAD_TEST_CASE(netbuf_pod) {
     BOOST_REQUIRE_EQUAL(src.y, dst.y);
     BOOST_REQUIRE_EQUAL(src.z, dst.z);
 }
+
+namespace {
+rpc::netbuf make_netbuf(const bytes& payload, rpc::compression_stats& stats) {
+    auto n = rpc::netbuf();
+    n.set_correlation_id(42);
+    n.set_service_method({"test::test", 66});
+    n.set_compression(rpc::compression_type::zstd);
+    n.set_min_compression_bytes(0);
+    n.set_compression_stats(&stats);
+    n.buffer().append(payload.data(), payload.size());
+    return n;
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(netbuf_adaptive_compression) {
+    rpc::compression_stats compressible;
+    const auto repeated = bytes(4096, 'x');
+    for (size_t i = 0; i < 10; ++i) {
+        std::move(make_netbuf(repeated, compressible)).as_scattered().get();
+    }
+    BOOST_REQUIRE_EQUAL(compressible.compressed(), 10);
+    BOOST_REQUIRE_EQUAL(compressible.skipped(), 0);
+    BOOST_REQUIRE_LT(compressible.ratio(), rpc::compression_stats::max_ratio);
+
+    // random payloads don't compress, after the first one only one out of
+    // probe_interval is compressed
+    rpc::compression_stats incompressible;
+    const auto payloads = rpc::compression_stats::probe_interval * 2 + 1;
+    for (size_t i = 0; i < payloads; ++i) {
+        auto payload = random_generators::get_bytes(4096);
+        std::move(make_netbuf(payload, incompressible)).as_scattered().get();
+    }
+    BOOST_REQUIRE_EQUAL(incompressible.compressed(), 3);
+    BOOST_REQUIRE_EQUAL(incompressible.skipped(), payloads - 3);
+}
@@ -8,6 +8,8 @@
 // by the Apache License, Version 2.0
 
 #include "reflection/adl.h"
+#include "rpc/test/rpc_gen_types.h"
+#include "serde/serde.h"
 
 #include <seastar/core/reactor.hh>
 #include <seastar/core/sharded.hh>
@@ -85,3 +87,35 @@ PERF_TEST(big_10mb, serialize) {
 PERF_TEST(big_10mb, deserialize) {
     return deserialize_big(10 << 20 /*10MB*/, 1 << 15 /*32KB*/);
 }
+
+inline bench::roundtrip_req gen_serde(size_t data_size, size_t chunk_size) {
+    bench::roundtrip_req ret;
+    for (size_t i = 0; i < data_size / chunk_size; ++i) {
+        ret.data.append(ss::temporary_buffer<char>(chunk_size));
+    }
+    return ret;
+}
+
+inline void serde_serialize(size_t data_size, size_t chunk_size) {
+    auto req = gen_serde(data_size, chunk_size);
+    perf_tests::start_measuring_time();
+    auto o = serde::to_iobuf(std::move(req));
+    perf_tests::do_not_optimize(o);
+    perf_tests::stop_measuring_time();
+}
+
+inline void serde_deserialize(size_t data_size, size_t chunk_size) {
+    auto o = serde::to_iobuf(gen_serde(data_size, chunk_size));
+    perf_tests::start_measuring_time();
+    auto result = serde::from_iobuf<bench::roundtrip_req>(std::move(o));
+    perf_tests::do_not_optimize(result);
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST(serde_1mb, serialize) {
+    serde_serialize(1 << 20 /*1MB*/, 1 << 15 /*32KB*/);
+}
+
+PERF_TEST(serde_1mb, deserialize) {
+    serde_deserialize(1 << 20 /*1MB*/, 1 << 15 /*32KB*/);
+}
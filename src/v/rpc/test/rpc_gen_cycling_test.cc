@@ -611,6 +611,30 @@ FIXTURE_TEST(ordering_test, rpc_integration_fixture) {
     client.stop().get();
 }
 
+FIXTURE_TEST(mixed_priority_test, rpc_integration_fixture) {
+    configure_server();
+    register_services();
+    start_server();
+    auto client = rpc::make_client<echo::echo_client_protocol>(client_config());
+    client.connect(model::no_timeout).get();
+    std::vector<ss::future<>> futures;
+    futures.reserve(30);
+    for (size_t i = 0; i < 30; ++i) {
+        auto opts = rpc::client_opts(rpc::no_timeout);
+        opts.priority = static_cast<rpc::send_priority>(
+          i % rpc::send_priority_count);
+        auto str = fmt::format("request {}", i);
+        futures.push_back(
+          client.echo(echo::echo_req{.str = str}, std::move(opts))
+            .then(&rpc::get_ctx_data<echo::echo_resp>)
+            .then([str](result<echo::echo_resp> r) {
+                BOOST_REQUIRE_EQUAL(r.value().str, str);
+            }));
+    }
+    ss::when_all_succeed(futures.begin(), futures.end()).get0();
+    client.stop().get();
+}
+
 FIXTURE_TEST(server_exception_test, rpc_integration_fixture) {
     configure_server();
     register_services();
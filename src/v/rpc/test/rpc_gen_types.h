@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
 #include "reflection/adl.h"
 #include "rpc/parse_utils.h"
 #include "seastarx.h"
@@ -207,3 +208,24 @@ static_assert(rpc::is_rpc_adl_exempt<echo_req>);
 static_assert(rpc::is_rpc_adl_exempt<echo_resp>);
 
 } // namespace echo_v2
+
+namespace bench {
+
+/// Request of the benchmark service, the server replies with reply_size
+/// bytes of data
+struct roundtrip_req
+  : serde::
+      envelope<roundtrip_req, serde::version<0>, serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+    iobuf data;
+    uint64_t reply_size{0};
+};
+
+struct roundtrip_resp
+  : serde::
+      envelope<roundtrip_resp, serde::version<0>, serde::compat_version<0>> {
+    using rpc_adl_exempt = std::true_type;
+    iobuf data;
+};
+
+} // namespace bench
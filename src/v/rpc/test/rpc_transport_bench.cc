@@ -0,0 +1,233 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/tls_config.h"
+#include "model/timeout_clock.h"
+#include "net/server.h"
+#include "random/generators.h"
+#include "rpc/rpc_server.h"
+#include "rpc/test/bench_service.h"
+#include "rpc/test/rpc_gen_types.h"
+#include "rpc/transport.h"
+#include "rpc/types.h"
+#include "seastarx.h"
+#include "units.h"
+#include "vassert.h"
+
+#include <seastar/core/future-util.hh>
+#include <seastar/core/reactor.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/net/tls.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+/*
+ * End to end throughput of the internal RPC: the client runs on shard 0 and
+ * the server on shard 1, every iteration sends `concurrency` requests and
+ * waits for their replies. The message sizes mimic the traffic between
+ * brokers, with and without TLS and request compression.
+ */
+
+namespace {
+
+constexpr uint16_t plaintext_port = 32151;
+constexpr uint16_t tls_port = 32152;
+constexpr size_t concurrency = 16;
+constexpr size_t max_message_size = 1_MiB;
+
+struct message_size {
+    size_t request;
+    size_t reply;
+};
+
+constexpr message_size heartbeat{.request = 256, .reply = 256};
+constexpr message_size health_report{.request = 64, .reply = 64_KiB};
+constexpr message_size append_entries{.request = 1_MiB, .reply = 64};
+
+ss::shard_id server_shard() { return ss::smp::count > 1 ? 1 : 0; }
+
+std::optional<ss::tls::credentials_builder> tls_builder() {
+    return config::tls_config(
+             true,
+             config::key_cert{"redpanda.key", "redpanda.crt"},
+             "root_certificate_authority.chain_cert",
+             false)
+      .get_credentials_builder()
+      .get0();
+}
+
+class bench_service_impl final : public bench::bench_service {
+public:
+    bench_service_impl(ss::scheduling_group sg, ss::smp_service_group ssg)
+      : bench::bench_service(sg, ssg)
+      , _reply(random_generators::make_iobuf(max_message_size)) {}
+
+    ss::future<bench::roundtrip_resp>
+    roundtrip(bench::roundtrip_req&& req, rpc::streaming_context&) final {
+        const auto size = std::min<size_t>(
+          req.reply_size, _reply.size_bytes());
+        return ss::make_ready_future<bench::roundtrip_resp>(
+          bench::roundtrip_resp{.data = _reply.share(0, size)});
+    }
+
+private:
+    iobuf _reply;
+};
+
+ss::future<std::unique_ptr<rpc::rpc_server>> start_server(
+  std::optional<ss::tls::credentials_builder> builder,
+  ss::smp_service_group ssg) {
+    net::server_configuration cfg("rpc_transport_bench");
+    cfg.disable_metrics = net::metrics_disabled::yes;
+    cfg.disable_public_metrics = net::public_metrics_disabled::yes;
+    cfg.max_service_memory_per_core = static_cast<int64_t>(
+      ss::memory::stats().total_memory() / 4);
+    cfg.addrs.emplace_back(
+      ss::socket_address(ss::ipv4_addr("127.0.0.1", plaintext_port)));
+    cfg.addrs.emplace_back(
+      ss::socket_address(ss::ipv4_addr("127.0.0.1", tls_port)),
+      co_await builder->build_reloadable_server_credentials());
+
+    auto server = std::make_unique<rpc::rpc_server>(std::move(cfg));
+    server->register_service<bench_service_impl>(
+      ss::default_scheduling_group(), ssg);
+    server->set_all_services_added();
+    server->start();
+    co_return server;
+}
+
+} // namespace
+
+class rpc_transport_bench {
+public:
+    using client_t = rpc::client<bench::bench_client_protocol>;
+
+    rpc_transport_bench()
+      : _ssg(ss::create_smp_service_group({5000}).get0()) {
+        auto builder = tls_builder();
+        _server = ss::smp::submit_to(
+                    server_shard(),
+                    [builder, ssg = _ssg]() mutable {
+                        return start_server(std::move(builder), ssg)
+                          .then([](std::unique_ptr<rpc::rpc_server> s) {
+                              return ss::make_foreign(std::move(s));
+                          });
+                    })
+                    .get0();
+        _plaintext.emplace(make_client(plaintext_port, nullptr));
+        _tls.emplace(make_client(
+          tls_port,
+          builder->build_reloadable_certificate_credentials().get0()));
+    }
+
+    rpc_transport_bench(const rpc_transport_bench&) = delete;
+    rpc_transport_bench& operator=(const rpc_transport_bench&) = delete;
+    rpc_transport_bench(rpc_transport_bench&&) = delete;
+    rpc_transport_bench& operator=(rpc_transport_bench&&) = delete;
+
+    ~rpc_transport_bench() {
+        _plaintext->stop().get();
+        _tls->stop().get();
+        ss::smp::submit_to(
+          server_shard(),
+          [s = std::move(_server)]() mutable {
+              auto& server = *s;
+              return server.stop().finally([s = std::move(s)] {});
+          })
+          .get();
+        ss::destroy_smp_service_group(_ssg).get();
+    }
+
+    ss::future<size_t> run_plaintext(message_size size) {
+        return run(*_plaintext, size, rpc::compression_type::none);
+    }
+    ss::future<size_t> run_plaintext_zstd(message_size size) {
+        return run(*_plaintext, size, rpc::compression_type::zstd);
+    }
+    ss::future<size_t> run_tls(message_size size) {
+        return run(*_tls, size, rpc::compression_type::none);
+    }
+    ss::future<size_t> run_tls_zstd(message_size size) {
+        return run(*_tls, size, rpc::compression_type::zstd);
+    }
+
+private:
+    static client_t make_client(
+      uint16_t port, ss::shared_ptr<ss::tls::certificate_credentials> creds) {
+        auto client = rpc::make_client<bench::bench_client_protocol>(
+          rpc::transport_configuration{
+            .server_addr = net::unresolved_address("127.0.0.1", port),
+            .credentials = std::move(creds),
+          });
+        client.connect(model::no_timeout).get();
+        return client;
+    }
+
+    ss::future<size_t>
+    run(client_t& client, message_size size, rpc::compression_type ct) {
+        std::vector<
+          ss::future<result<rpc::client_context<bench::roundtrip_resp>>>>
+          replies;
+        replies.reserve(concurrency);
+
+        perf_tests::start_measuring_time();
+        for (size_t i = 0; i < concurrency; ++i) {
+            replies.push_back(client.roundtrip(
+              bench::roundtrip_req{
+                .data = _request.share(0, size.request),
+                .reply_size = size.reply,
+              },
+              rpc::client_opts(rpc::no_timeout, ct)));
+        }
+        auto results = co_await ss::when_all_succeed(
+          replies.begin(), replies.end());
+        perf_tests::stop_measuring_time();
+
+        for (auto& r : results) {
+            vassert(r.has_value(), "roundtrip failed: {}", r.error());
+            perf_tests::do_not_optimize(r);
+        }
+        co_return concurrency;
+    }
+
+    ss::smp_service_group _ssg;
+    ss::foreign_ptr<std::unique_ptr<rpc::rpc_server>> _server;
+    std::optional<client_t> _plaintext;
+    std::optional<client_t> _tls;
+    iobuf _request{random_generators::make_iobuf(max_message_size)};
+};
+
+PERF_TEST_F(rpc_transport_bench, heartbeat) {
+    return run_plaintext(heartbeat);
+}
+PERF_TEST_F(rpc_transport_bench, heartbeat_tls) { return run_tls(heartbeat); }
+
+PERF_TEST_F(rpc_transport_bench, health_report) {
+    return run_plaintext(health_report);
+}
+PERF_TEST_F(rpc_transport_bench, health_report_tls) {
+    return run_tls(health_report);
+}
+
+PERF_TEST_F(rpc_transport_bench, append_entries) {
+    return run_plaintext(append_entries);
+}
+PERF_TEST_F(rpc_transport_bench, append_entries_zstd) {
+    return run_plaintext_zstd(append_entries);
+}
+PERF_TEST_F(rpc_transport_bench, append_entries_tls) {
+    return run_tls(append_entries);
+}
+PERF_TEST_F(rpc_transport_bench, append_entries_tls_zstd) {
+    return run_tls_zstd(append_entries);
+}
@@ -76,9 +76,11 @@ void transport::fail_outstanding_futures() noexcept {
     for (auto& [_, p] : _correlations) {
         p->handler.set_value(errc::disconnected_endpoint);
     }
-    _last_seq = sequence_t{0};
-    _seq = sequence_t{0};
-    _requests_queue.clear();
+    for (auto& l : _lanes) {
+        l.last_seq = sequence_t{0};
+        l.seq = sequence_t{0};
+        l.requests.clear();
+    }
     _correlations.clear();
 }
 
@@ -92,8 +94,10 @@ void transport::reset_state() {
      * dealing with an apparent race condition in which two requests with the
      * same correlation id are in flight shortly after a reset.
      */
-    _last_seq = sequence_t{0};
-    _seq = sequence_t{0};
+    for (auto& l : _lanes) {
+        l.last_seq = sequence_t{0};
+        l.seq = sequence_t{0};
+    }
     _version = _default_version;
 }
 
@@ -129,7 +133,8 @@ transport::connect(rpc::clock_type::time_point connection_timeout) {
 
 ss::future<result<std::unique_ptr<streaming_context>>>
 transport::send(netbuf b, rpc::client_opts opts) {
-    return do_send(_seq++, std::move(b), std::move(opts));
+    auto seq = next_sequence(opts.priority);
+    return do_send(seq, std::move(b), std::move(opts));
 }
 
 ss::future<result<std::unique_ptr<streaming_context>>>
@@ -230,7 +235,13 @@ transport::do_send(sequence_t seq, netbuf b, rpc::client_opts opts) {
           // send
           auto sz = b.buffer().size_bytes();
           auto corr = b.correlation_id();
-          return get_units(_memory, sz)
+          auto priority = opts.priority;
+          // control requests are small and must not queue behind the memory
+          // reserved by bulk requests, they are not accounted
+          auto units_f = priority == send_priority::control
+                           ? ss::make_ready_future<ssx::semaphore_units>()
+                           : get_units(_memory, sz);
+          return std::move(units_f)
             .then([b = std::move(b), corr, this](
                     ssx::semaphore_units units) mutable {
                 auto it = _correlations.find(corr);
@@ -246,77 +257,90 @@ transport::do_send(sequence_t seq, netbuf b, rpc::client_opts opts) {
                   });
             })
             .then_unpack(
-              [this, f = std::move(f), seq, corr](
+              [this, f = std::move(f), seq, corr, priority](
                 ssx::semaphore_units units,
                 ss::scattered_message<char> scattered_message) mutable {
                   auto e = std::make_unique<entry>(
                     std::move(scattered_message), corr);
-                  _requests_queue.emplace(seq, std::move(e));
+                  lane_for(priority).requests.emplace(seq, std::move(e));
 
                   // By this point the request may already have timed out but
                   // we still do dispatch_send where it is handled. This is
                   // needed for two reasons:
-                  // - Monotonic updates to _last_seq
+                  // - Monotonic updates to last_seq of the lane
                   // - Draining of the request_queue which could otherwise be
                   //   stalled by missing sequence number.
                   dispatch_send();
                   return std::move(f).finally([u = std::move(units)] {});
               })
-            .handle_exception([this, seq, corr](std::exception_ptr eptr) {
+            .handle_exception([this, seq, corr, priority](
+                                std::exception_ptr eptr) {
                 // This is unlikely but may potentially mean dispatch_send()
                 // is not called, stalling the sequence number.
                 vlog(
                   rpclog.error,
                   "Exception {} dispatching rpc with sequence: {}, "
-                  "correlation_idx: {}, last_seq: {}",
+                  "correlation_idx: {}, priority: {}, last_seq: {}",
                   eptr,
                   seq,
                   corr,
-                  _last_seq);
+                  priority,
+                  lane_for(priority).last_seq);
                 return ss::make_exception_future<ret_t>(eptr);
             });
       });
 }
 
+transport::lane* transport::next_dispatchable_lane() {
+    // lanes are ordered by priority, the first one that can make progress
+    // wins
+    for (auto& l : _lanes) {
+        if (l.requests.empty()) {
+            continue;
+        }
+        auto queue_begin_sequence = l.requests.begin()->first;
+        auto out_of_order = queue_begin_sequence
+                            > (l.last_seq + sequence_t(1));
+        if (unlikely(out_of_order)) {
+            vlog(
+              rpclog.debug,
+              "Dispatch request queue out of order. Last seq: "
+              "{}, "
+              "queue begin seq: {}",
+              l.last_seq,
+              queue_begin_sequence);
+            continue;
+        }
+        return &l;
+    }
+    return nullptr;
+}
+
 ss::future<> transport::do_dispatch_send() {
     return ss::do_until(
-      [this] {
-          if (_requests_queue.empty()) {
-              return true;
-          }
-          auto queue_begin_sequence = _requests_queue.begin()->first;
-          auto out_of_order = queue_begin_sequence
-                              > (_last_seq + sequence_t(1));
-          if (unlikely(out_of_order)) {
-              vlog(
-                rpclog.debug,
-                "Dispatch request queue out of order. Last seq: "
-                "{}, "
-                "queue begin seq: {}",
-                _last_seq,
-                queue_begin_sequence);
-          }
-          return out_of_order;
-      },
+      [this] { return next_dispatchable_lane() == nullptr; },
       // Be careful adding any scheduling points in the lambda
       // below.
       //
       // If a scheduling point is added before
-      // `_requests_queue.erase` then two concurrent instances of
+      // `requests.erase` then two concurrent instances of
       // dispatch_send could try sending the same message.
       // Resulting in one of them throwing a seg. fault.
       //
       // And if a scheduling point is added after
-      // `_requests_queue.erase` the conditional for executing the
+      // `requests.erase` the conditional for executing the
       // lambda could succeed for two different messages
       // concurrently resulting in incorrect ordering of the sent
       // messages.
       [this] {
-          auto it = _requests_queue.begin();
-          _last_seq = it->first;
+          // the stop condition has just found a lane that can make progress
+          auto& l = *next_dispatchable_lane();
+          auto it = l.requests.begin();
+          l.last_seq = it->first;
+          auto seq = it->first;
           auto v = std::move(it->second->scattered_message);
           auto corr = it->second->correlation_id;
-          _requests_queue.erase(it);
+          l.requests.erase(it);
 
           auto resp_it = _correlations.find(corr);
           if (resp_it == _correlations.end()) {
@@ -343,9 +367,9 @@ ss::future<> transport::do_dispatch_send() {
             "Dispatched request with sequence: {}, "
             "correlation_idx: {}, "
             "pending queue_size: {}, target_address: {}",
-            _last_seq,
+            seq,
             corr,
-            _requests_queue.size(),
+            l.requests.size(),
             server_address());
           return std::move(f)
             .then([this, corr](bool flushed) {
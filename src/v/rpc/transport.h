@@ -31,8 +31,10 @@
 
 #include <absl/container/btree_map.h>
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/node_hash_map.h>
 #include <bits/stdint-uintn.h>
 
+#include <array>
 #include <concepts>
 #include <cstdint>
 #include <memory>
@@ -65,8 +67,9 @@ struct timing_info {
      * The moment in time the request was enqueued in the _requests array, i.e.,
      * now waiting in line to be sent. This
      * is often immediately followed by being dispatched, though not always:
-     * since we dispatch in-order, any lower-sequence number requests which
-     * haven't been dispatched yet will prevent this from being dispatched.
+     * since we dispatch in-order, any lower-sequence number requests of the
+     * same priority and pending requests of higher priority which haven't
+     * been dispatched yet will prevent this from being dispatched.
      */
     time_point enqueued_at = unset;
 
@@ -151,6 +154,15 @@ private:
     };
     using requests_queue_t
       = absl::btree_map<sequence_t, std::unique_ptr<entry>>;
+    /**
+     * Requests of a single send_priority. Sequence numbers are assigned per
+     * lane so that the requests of a lane keep the order of the send calls.
+     */
+    struct lane {
+        requests_queue_t requests;
+        sequence_t seq;
+        sequence_t last_seq;
+    };
     friend client_context_impl;
     ss::future<> do_reads();
     ss::future<> dispatch(header);
@@ -164,6 +176,14 @@ private:
     void dispatch_send();
     ss::future<> do_dispatch_send();
 
+    lane& lane_for(send_priority p) {
+        return _lanes[static_cast<size_t>(p)];
+    }
+    sequence_t next_sequence(send_priority p) { return ++lane_for(p).seq; }
+    /// The lane of highest priority whose next request can be sent, nullptr
+    /// if every lane is empty or waits for a request that isn't queued yet.
+    lane* next_dispatchable_lane();
+
     ss::future<result<std::unique_ptr<streaming_context>>>
     make_response_handler(netbuf&, rpc::client_opts&);
 
@@ -204,13 +224,18 @@ private:
     uint32_t _correlation_idx{0};
     metrics::internal_metric_groups _metrics;
     /**
-     * Ordered map containing requests to be sent over the wire. The map
-     * preserves order of calling send_typed function. It is fine to use
-     * btree_map in here as it ususally contains only few elements.
+     * Ordered maps containing requests to be sent over the wire, one for each
+     * send_priority. Each map preserves order of calling send_typed function.
+     * It is fine to use btree_map in here as it ususally contains only few
+     * elements.
      */
-    requests_queue_t _requests_queue;
-    sequence_t _seq;
-    sequence_t _last_seq;
+    std::array<lane, send_priority_count> _lanes;
+
+    /*
+     * compression statistics of the requests sent by each method, the nodes
+     * of the map are stable for the netbufs pointing to them
+     */
+    absl::node_hash_map<uint32_t, compression_stats> _compression_stats;
 
     /*
      * version level used when dispatching requests. this value may change
@@ -350,11 +375,14 @@ transport::send_typed_versioned(
     auto b = std::make_unique<rpc::netbuf>();
     b->set_compression(opts.compression);
     b->set_min_compression_bytes(opts.min_compression_bytes);
+    if (opts.compression != compression_type::none) {
+        b->set_compression_stats(&_compression_stats[method.id]);
+    }
     auto raw_b = b.get();
     raw_b->set_service_method(method);
 
     auto& target_buffer = raw_b->buffer();
-    auto seq = ++_seq;
+    auto seq = next_sequence(opts.priority);
     return encode_for_version(target_buffer, std::move(r), version)
       .then([this, version, b = std::move(b), seq, opts = std::move(opts)](
               transport_version effective_version) mutable {
@@ -76,4 +76,16 @@ std::ostream& operator<<(std::ostream& o, transport_version v) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, send_priority p) {
+    switch (p) {
+    case send_priority::control:
+        return o << "control";
+    case send_priority::data:
+        return o << "data";
+    case send_priority::recovery:
+        return o << "recovery";
+    }
+    return o << "unknown";
+}
+
 } // namespace rpc
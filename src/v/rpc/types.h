@@ -16,6 +16,7 @@
 #include "net/types.h"
 #include "net/unresolved_address.h"
 #include "outcome.h"
+#include "rpc/compression_stats.h"
 #include "seastarx.h"
 #include "ssx/semaphore.h"
 #include "utils/log_hist.h"
@@ -259,6 +260,24 @@ static_assert(
 
 uint32_t checksum_header_only(const header& h);
 
+/**
+ * Class of a request sent by the transport. Requests of a class are sent in
+ * the order they were issued, pending requests of a class are sent before the
+ * pending requests of the classes that follow it.
+ */
+enum class send_priority : uint8_t {
+    // small latency sensitive requests, e.g. raft heartbeats and votes
+    control = 0,
+    // replication of new data
+    data,
+    // catching up replicas
+    recovery,
+};
+
+inline constexpr size_t send_priority_count = 3;
+
+std::ostream& operator<<(std::ostream&, send_priority);
+
 struct client_opts {
     using resource_units_t
       = ss::foreign_ptr<ss::lw_shared_ptr<std::vector<ssx::semaphore_units>>>;
@@ -310,6 +329,7 @@ struct client_opts {
      * to control caller resources.
      */
     resource_units_t resource_units;
+    send_priority priority = send_priority::data;
 };
 
 /// \brief used to pass environment context to the class
@@ -373,6 +393,12 @@ public:
     void set_compression(rpc::compression_type c);
     void set_service_method(method_info);
     void set_min_compression_bytes(size_t);
+    /// Statistics used to skip the compression of payloads that don't
+    /// compress well, and updated with the outcome. Must outlive the
+    /// future returned by as_scattered.
+    void set_compression_stats(compression_stats* s) {
+        _compression_stats = s;
+    }
     void set_version(transport_version v) { _hdr.version = v; }
     iobuf& buffer();
 
@@ -390,6 +416,7 @@ public:
 private:
     const char* _name = nullptr;
     size_t _min_compression_bytes{1024};
+    compression_stats* _compression_stats{nullptr};
     header _hdr;
     iobuf _out;
 };
@@ -421,9 +448,15 @@ public:
     hist_t& latency_hist() { return _latency_hist; }
     const hist_t& latency_hist() const { return _latency_hist; }
 
+    compression_stats& reply_compression() { return _reply_compression; }
+    const compression_stats& reply_compression() const {
+        return _reply_compression;
+    }
+
 private:
     // roughly 208 bytes
     hist_t _latency_hist;
+    compression_stats _reply_compression;
 };
 
 /// \brief most method implementations will be codegenerated
@@ -114,20 +114,20 @@ acl_store::find(resource_type resource, const ss::sstring& name) const {
     }
 
     /*
-     * the acls are sorted within (resource-type, pattern-type) bounds by name
-     * in reverse order so longer names (prefixes) appear first.
+     * look up the prefixes of the name with the lengths of the prefixed
+     * patterns of the resource type, longer prefixes first.
      */
     std::vector<acl_matches::entry_set_ref> prefixes;
     {
-        auto it = _acls.lower_bound(
-          resource_pattern(resource, name, pattern_type::prefixed));
-
-        auto end = _acls.upper_bound(resource_pattern(
-          resource, name.substr(0, 1), pattern_type::prefixed));
-
-        for (; it != end; ++it) {
-            if (std::string_view(name).starts_with(it->first.name())) {
-                prefixes.emplace_back(it->first, it->second);
+        auto it = _prefix_lengths.upper_bound({resource, name.size()});
+        auto begin = _prefix_lengths.lower_bound(
+          {resource, std::min<size_t>(name.size(), 1)});
+        while (it != begin) {
+            --it;
+            const auto found = _acls.find(resource_pattern(
+              resource, name.substr(0, it->second), pattern_type::prefixed));
+            if (found != _acls.end()) {
+                prefixes.emplace_back(found->first, found->second);
             }
         }
     }
@@ -172,6 +172,9 @@ std::vector<std::vector<acl_binding>> acl_store::remove_bindings(
 
     // deleted binding index of deleted filter that matched
     absl::flat_hash_map<acl_binding, size_t> deleted;
+    if (!dry_run) {
+        ++_version;
+    }
 
     for (const auto& resources_it : resources) {
         // structured binding in for-range prevents capturing reference to
@@ -239,13 +242,19 @@ ss::future<>
 acl_store::reset_bindings(const fragmented_vector<acl_binding>& bindings) {
     // NOTE: not coroutinized because otherwise clang-14 crashes.
     _acls.clear();
+    _prefix_lengths.clear();
+    ++_version;
     return ss::do_for_each(
              bindings,
              [this](const auto& binding) {
-                 _acls[binding.pattern()].insert(binding.entry());
+                 acl_entries(binding.pattern()).insert(binding.entry());
              })
       .then([this] {
           return ss::do_for_each(_acls, [](auto& kv) { kv.second.rehash(); });
+      })
+      .then([this] {
+          // the ACLs may have been authorized against while they were reset
+          ++_version;
       });
 }
 
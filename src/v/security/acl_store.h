@@ -12,6 +12,7 @@
 #include "security/acl.h"
 
 #include <absl/container/btree_map.h>
+#include <absl/container/btree_set.h>
 #include <absl/container/node_hash_set.h>
 
 namespace security {
@@ -135,10 +136,11 @@ public:
 
     void add_bindings(const std::vector<acl_binding>& bindings) {
         for (auto& binding : bindings) {
-            auto& entries = _acls[binding.pattern()];
+            auto& entries = acl_entries(binding.pattern());
             entries.insert(binding.entry());
             entries.rehash();
         }
+        ++_version;
     }
 
     // remove bindings according the input filters and return the bindings that
@@ -155,7 +157,19 @@ public:
     ss::future<fragmented_vector<acl_binding>> all_bindings() const;
     ss::future<> reset_bindings(const fragmented_vector<acl_binding>& bindings);
 
+    // incremented on every change of the ACLs, the matches found before a
+    // change are not to be used after it.
+    uint64_t version() const { return _version; }
+
 private:
+    acl_entry_set& acl_entries(const resource_pattern& pattern) {
+        auto [it, inserted] = _acls.try_emplace(pattern);
+        if (inserted && pattern.pattern() == pattern_type::prefixed) {
+            _prefix_lengths.emplace(pattern.resource(), pattern.name().size());
+        }
+        return it->second;
+    }
+
     /*
      * resource pattern ordering:
      *
@@ -178,6 +192,11 @@ private:
 
     absl::btree_map<resource_pattern, acl_entry_set, resource_pattern_compare>
       _acls;
+    // the lengths of the names of the prefixed patterns of each resource
+    // type, so that the prefixes of a name are looked up by length rather
+    // than by scanning all of the prefixed patterns.
+    absl::btree_set<std::pair<resource_type, size_t>> _prefix_lengths;
+    uint64_t _version{0};
 };
 
 } // namespace security
@@ -532,6 +532,7 @@ ss::future<> audit_client::do_produce(
             vlog(adtlog.error, "{} audit records dropped", n_records);
         }
         probe.audit_error();
+        probe.audit_events_dropped(n_records);
     } else {
         probe.audit_event();
     }
@@ -834,38 +835,45 @@ bool audit_log_manager::report_redpanda_app_event(is_started app_started) {
         : application_lifecycle::activity_id::stop);
 }
 
-bool audit_log_manager::do_enqueue_audit_event(
-  std::unique_ptr<security::audit::ocsf_base_impl> msg) {
+bool audit_log_manager::aggregate_audit_event(
+  const security::audit::ocsf_base_impl& msg) {
     auto& map = _queue.get<underlying_unordered_map>();
-    auto it = map.find(msg->key());
+    auto it = map.find(msg.key());
     if (it == map.end()) {
-        const auto msg_size = msg->estimated_size();
-        auto units = ss::try_get_units(_queue_bytes_sem, msg_size);
-        if (!units) {
-            vlog(
-              adtlog.warn,
-              "Unable to enqueue audit event {}, msg size: {}, avail units: {}",
-              *msg,
-              msg_size,
-              _queue_bytes_sem.available_units());
-            probe().audit_error();
-            return false;
-        }
-        auto& list = _queue.get<underlying_list>();
+        return false;
+    }
+    vlog(adtlog.trace, "Incrementing count of event {}", msg);
+    auto now = security::audit::timestamp_t{
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+        .count()};
+    it->increment(now);
+    probe().audit_event_aggregated();
+    return true;
+}
+
+bool audit_log_manager::push_audit_event(
+  std::unique_ptr<security::audit::ocsf_base_impl> msg) {
+    const auto msg_size = msg->estimated_size();
+    auto units = ss::try_get_units(_queue_bytes_sem, msg_size);
+    if (!units) {
         vlog(
-          adtlog.trace,
-          "Successfully enqueued audit event {}, semaphore contains {} units",
+          adtlog.warn,
+          "Unable to enqueue audit event {}, msg size: {}, avail units: {}",
           *msg,
+          msg_size,
           _queue_bytes_sem.available_units());
-        list.push_back(audit_msg(std::move(msg), std::move(*units)));
-    } else {
-        vlog(adtlog.trace, "Incrementing count of event {}", *msg);
-        auto now = security::audit::timestamp_t{
-          std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch())
-            .count()};
-        it->increment(now);
+        probe().audit_error();
+        probe().audit_events_dropped(1);
+        return false;
     }
+    auto& list = _queue.get<underlying_list>();
+    vlog(
+      adtlog.trace,
+      "Successfully enqueued audit event {}, semaphore contains {} units",
+      *msg,
+      _queue_bytes_sem.available_units());
+    list.push_back(audit_msg(std::move(msg), std::move(*units)));
     return true;
 }
 
@@ -87,7 +87,7 @@ public:
         if (auto val = should_enqueue_audit_event(type); val.has_value()) {
             return (bool)*val;
         }
-        return do_enqueue_audit_event(std::make_unique<T>(std::forward<T>(t)));
+        return do_enqueue_audit_event(std::forward<T>(t));
     }
 
     template<
@@ -114,12 +114,11 @@ public:
             }
         }
 
-        return do_enqueue_audit_event(
-          std::make_unique<api_activity>(make_api_activity_event(
-            operation_name,
-            std::move(result),
-            std::forward<Args>(args)...,
-            create_resource_details(restrict_topics(std::move(func))))));
+        return do_enqueue_audit_event(make_api_activity_event(
+          operation_name,
+          std::move(result),
+          std::forward<Args>(args)...,
+          create_resource_details(restrict_topics(std::move(func)))));
     }
 
     template<typename T, typename... Args>
@@ -141,12 +140,8 @@ public:
                 return (bool)*val;
             }
         }
-        return do_enqueue_audit_event(
-          std::make_unique<api_activity>(make_api_activity_event(
-            operation_name,
-            std::move(result),
-            std::forward<Args>(args)...,
-            {})));
+        return do_enqueue_audit_event(make_api_activity_event(
+          operation_name, std::move(result), std::forward<Args>(args)..., {}));
     }
 
     bool enqueue_authn_event(authentication_event_options options) {
@@ -155,8 +150,8 @@ public:
             val.has_value()) {
             return (bool)*val;
         }
-        return do_enqueue_audit_event(std::make_unique<authentication>(
-          make_authentication_event(std::move(options))));
+        return do_enqueue_audit_event(
+          make_authentication_event(std::move(options)));
     }
 
     template<typename... Args>
@@ -165,8 +160,8 @@ public:
             return (bool)*val;
         }
 
-        return do_enqueue_audit_event(std::make_unique<application_lifecycle>(
-          make_application_lifecycle(std::forward<Args>(args)...)));
+        return do_enqueue_audit_event(
+          make_application_lifecycle(std::forward<Args>(args)...));
     }
 
     bool enqueue_api_activity_event(
@@ -182,9 +177,8 @@ public:
             return (bool)*val;
         }
 
-        return do_enqueue_audit_event(
-          std::make_unique<api_activity>(make_api_activity_event(
-            req, auth_result, svc_name, authorized, reason)));
+        return do_enqueue_audit_event(make_api_activity_event(
+          req, auth_result, svc_name, authorized, reason));
     }
 
     bool enqueue_api_activity_event(
@@ -197,8 +191,8 @@ public:
             return (bool)*val;
         }
 
-        return do_enqueue_audit_event(std::make_unique<api_activity>(
-          make_api_activity_event(req, user, svc_name)));
+        return do_enqueue_audit_event(
+          make_api_activity_event(req, user, svc_name));
     }
 
     /// Returns the number of items pending to be written to auditing log
@@ -250,8 +244,19 @@ private:
     ss::future<> resume();
 
     bool is_audit_event_enabled(event_type) const;
-    bool do_enqueue_audit_event(
-      std::unique_ptr<security::audit::ocsf_base_impl> msg);
+
+    /// An event identical to one already queued is aggregated into it, only
+    /// the events not queued yet are moved to the heap
+    template<typename T>
+    bool do_enqueue_audit_event(T&& msg) {
+        if (aggregate_audit_event(msg)) {
+            return true;
+        }
+        return push_audit_event(
+          std::make_unique<std::remove_cvref_t<T>>(std::forward<T>(msg)));
+    }
+    bool aggregate_audit_event(const security::audit::ocsf_base_impl& msg);
+    bool push_audit_event(std::unique_ptr<security::audit::ocsf_base_impl> msg);
     void set_enabled_events();
 
     audit_probe& probe() { return *_probe; }
@@ -33,6 +33,8 @@ public:
 
     void audit_event() { _last_event = clock_type::now(); }
     void audit_error() { ++_audit_error_count; }
+    void audit_events_dropped(size_t n) { _audit_events_dropped += n; }
+    void audit_event_aggregated() { ++_audit_events_aggregated; }
 
 private:
     metrics::internal_metric_groups _metrics;
@@ -40,6 +42,8 @@ private:
 
     clock_type::time_point _last_event;
     uint32_t _audit_error_count{0};
+    uint64_t _audit_events_dropped{0};
+    uint64_t _audit_events_aggregated{0};
 };
 
 } // namespace security::audit
@@ -43,6 +43,13 @@ void audit_probe::setup_metrics(std::function<double()> get_usage_ratio) {
             sm::description("Running count of errors in creating/publishing "
                             "audit event log entries"))
             .aggregate(aggregate_labels));
+        defs.emplace_back(
+          sm::make_counter(
+            "dropped_events_total",
+            [this] { return _audit_events_dropped; },
+            sm::description("Running count of audit events dropped, either "
+                            "rejected by a full buffer or not published"))
+            .aggregate(aggregate_labels));
         return defs;
     };
 
@@ -55,6 +62,11 @@ void audit_probe::setup_metrics(std::function<double()> get_usage_ratio) {
           "buffer_usage_ratio",
           [fn = std::move(get_usage_ratio)] { return fn(); },
           sm::description("Audit event buffer usage ratio.")));
+        defs.emplace_back(sm::make_counter(
+          "aggregated_events_total",
+          [this] { return _audit_events_aggregated; },
+          sm::description("Running count of audit events aggregated into an "
+                          "identical buffered event")));
 
         _metrics.add_group(group_name, defs, {}, {sm::shard_label});
     }
@@ -21,6 +21,7 @@
 #include <seastar/core/sstring.hh>
 #include <seastar/util/bool_class.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 #include <fmt/core.h>
 
@@ -241,14 +242,54 @@ public:
       acl_operation operation,
       const acl_principal& principal,
       const acl_host& host) const {
-        auto type = get_resource_type<T>();
-        auto acls = _store.find(type, resource_name());
-
         if (_superusers.contains(principal)) {
             return auth_result::superuser_authorized(
               principal, host, operation, resource_name);
         }
 
+        if (_decisions_version != _store.version()) {
+            _decisions.clear();
+            _decisions_version = _store.version();
+        }
+        decision_key key{
+          .principal = principal,
+          .host = host,
+          .operation = operation,
+          .type = get_resource_type<T>(),
+          .name = resource_name()};
+        if (auto it = _decisions.find(key); it != _decisions.end()) {
+            return it->second;
+        }
+
+        auto result = authorized_by_acls(
+          resource_name, operation, principal, host);
+        if (_decisions.size() >= decision_cache_capacity) {
+            _decisions.clear();
+        }
+        _decisions.emplace(std::move(key), result);
+        return result;
+    }
+
+    ss::future<fragmented_vector<acl_binding>> all_bindings() const {
+        return _store.all_bindings();
+    }
+
+    ss::future<>
+    reset_bindings(const fragmented_vector<acl_binding>& bindings) {
+        return _store.reset_bindings(bindings);
+    }
+
+    acl_store& store() { return _store; }
+
+private:
+    template<typename T>
+    auth_result authorized_by_acls(
+      const T& resource_name,
+      acl_operation operation,
+      const acl_principal& principal,
+      const acl_host& host) const {
+        auto acls = _store.find(get_resource_type<T>(), resource_name());
+
         if (acls.empty()) {
             return auth_result::empty_match_result(
               principal,
@@ -275,18 +316,6 @@ public:
           acl_any_implied_ops_allowed(acls, principal, host, operation));
     }
 
-    ss::future<fragmented_vector<acl_binding>> all_bindings() const {
-        return _store.all_bindings();
-    }
-
-    ss::future<>
-    reset_bindings(const fragmented_vector<acl_binding>& bindings) {
-        return _store.reset_bindings(bindings);
-    }
-
-    acl_store& store() { return _store; }
-
-private:
     /*
      * Compute whether the specified operation is allowed based on the implied
      * operations.
@@ -334,6 +363,31 @@ private:
     }
     acl_store _store;
 
+    /*
+     * Cache of the decisions made against the ACLs, as the requests of a
+     * client authorize the same operations on the same resources over and
+     * over. The results refer to the ACLs of the store, so the cache is
+     * cleared whenever the store changes, and when it is full.
+     */
+    struct decision_key {
+        acl_principal principal;
+        acl_host host;
+        acl_operation operation;
+        resource_type type;
+        ss::sstring name;
+
+        bool operator==(const decision_key&) const = default;
+
+        template<typename H>
+        friend H AbslHashValue(H h, const decision_key& k) {
+            return H::combine(
+              std::move(h), k.principal, k.host, k.operation, k.type, k.name);
+        }
+    };
+    static constexpr size_t decision_cache_capacity = 10000;
+    mutable absl::flat_hash_map<decision_key, auth_result> _decisions;
+    mutable uint64_t _decisions_version{0};
+
     // The list of superusers is stored twice: once as a vector in the
     // configuration subsystem, then again has a set here for fast lookups.
     // The set is updated on changes via the config::binding.
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "security/credential_store.h"
+#include "security/scram_credential.h"
+#include "security/types.h"
+#include "seastarx.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <optional>
+#include <string_view>
+
+namespace security {
+
+/**
+ * MRU cache of the HTTP Basic authorizations validated against the SCRAM
+ * credentials, so that the password of a user is not salted again on every
+ * request of a client.
+ *
+ * An authorization is only valid while the credential it was validated
+ * against is the current credential of the user: the entries of the users
+ * whose credential was updated or removed are dropped on lookup.
+ */
+class basic_auth_cache {
+public:
+    static constexpr size_t default_capacity = 1000;
+
+    struct validated {
+        credential_user username;
+        credential_password password;
+        ss::sstring sasl_mechanism;
+    };
+
+    explicit basic_auth_cache(size_t capacity = default_capacity)
+      : _capacity{capacity} {}
+
+    /// The user of \p authorization, the base64 of "user:password", when it
+    /// was validated against the current credential of the user
+    std::optional<validated>
+    get(std::string_view authorization, const credential_store& store) {
+        auto& map = _cache.get<underlying_map>();
+        auto it = map.find(ss::sstring{authorization});
+        if (it == map.end()) {
+            return std::nullopt;
+        }
+        auto cred = store.get<scram_credential>(it->user.username);
+        if (!cred || *cred != it->cred) {
+            map.erase(it);
+            return std::nullopt;
+        }
+        auto& list = _cache.get<underlying_list>();
+        list.relocate(list.begin(), _cache.project<underlying_list>(it));
+        return it->user;
+    }
+
+    /// Cache \p authorization as validated against \p cred
+    void
+    put(std::string_view authorization, validated user, scram_credential cred) {
+        auto& map = _cache.get<underlying_map>();
+        if (auto it = map.find(ss::sstring{authorization}); it != map.end()) {
+            map.erase(it);
+        }
+        auto& list = _cache.get<underlying_list>();
+        list.emplace_front(
+          ss::sstring{authorization}, std::move(user), std::move(cred));
+        if (list.size() > _capacity) {
+            list.pop_back();
+        }
+    }
+
+    size_t size() const { return _cache.size(); }
+
+private:
+    struct underlying_list {};
+    struct underlying_map {};
+
+    struct entry {
+        entry(ss::sstring authorization, validated user, scram_credential cred)
+          : authorization{std::move(authorization)}
+          , user{std::move(user)}
+          , cred{std::move(cred)} {}
+
+        ss::sstring authorization;
+        validated user;
+        scram_credential cred;
+    };
+
+    using cache_t = boost::multi_index::multi_index_container<
+      entry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        boost::multi_index::hashed_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::
+            member<entry, ss::sstring, &entry::authorization>,
+          std::hash<ss::sstring>>>>;
+
+    size_t _capacity;
+    cache_t _cache;
+};
+
+} // namespace security
@@ -20,6 +20,7 @@ class ephemeral_credential_store;
 
 namespace oidc {
 
+struct authentication_data;
 class jws;
 class jwt;
 class service;
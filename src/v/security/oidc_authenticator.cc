@@ -107,6 +107,10 @@ public:
 
     result<authentication_data>
     authenticate(std::string_view bearer_token) const {
+        if (auto cached = _service.get_authenticated(bearer_token); cached) {
+            return std::move(*cached);
+        }
+
         auto jws = oidc::jws::make(ss::sstring{bearer_token});
         if (jws.has_error()) {
             vlog(
@@ -123,7 +127,7 @@ public:
             return issuer.assume_error();
         }
 
-        return oidc::authenticate(
+        auto res = oidc::authenticate(
           jws.assume_value(),
           _service.get_verifier(),
           _service.get_principal_mapping_rule(),
@@ -131,6 +135,13 @@ public:
           _service.audience(),
           _service.clock_skew_tolerance(),
           ss::lowres_system_clock::now());
+        if (res.has_value()) {
+            _service.put_authenticated(bearer_token, res.assume_value());
+        } else if (res.assume_error() == errc::kid_not_found) {
+            // The keys may have been rotated by the Identity Provider
+            _service.refresh_keys_soon();
+        }
+        return res;
     }
 
 private:
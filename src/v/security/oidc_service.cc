@@ -16,7 +16,9 @@
 #include "security/exceptions.h"
 #include "security/jwt.h"
 #include "security/logger.h"
+#include "security/oidc_authenticator.h"
 #include "security/oidc_principal_mapping.h"
+#include "security/oidc_token_cache.h"
 #include "security/oidc_url_parser.h"
 #include "ssx/future-util.h"
 
@@ -164,6 +166,7 @@ struct service::impl {
         _discovery_url.watch([this]() {
             ssx::spawn_with_gate(_gate, [this] { return update(); });
         });
+        _token_audience.watch([this]() { _tokens.clear(); });
         _mapping.watch([this]() { update_rule(); });
         update_rule();
         _jwks_refresh_interval.watch([this]() {
@@ -273,6 +276,11 @@ struct service::impl {
         }
         measure.success();
 
+        if (
+          !_issuer.has_value()
+          || std::string_view{*_issuer} != metadata.assume_value().issuer()) {
+            _tokens.clear();
+        }
         _issuer.emplace(metadata.assume_value().issuer());
     }
 
@@ -317,6 +325,7 @@ struct service::impl {
             co_await return_exception(
               res.assume_error(), "Error updating keys");
         }
+        _tokens.clear();
 
         arm_duration = _jwks_refresh_interval();
     }
@@ -326,9 +335,23 @@ struct service::impl {
             vlog(seclog.error, "Rule failed to parse: {}", _mapping());
         } else {
             _rule = std::move(r).assume_value();
+            _tokens.clear();
         }
     }
 
+    void refresh_keys_soon() {
+        // At most once per the retry interval of a failed refresh
+        constexpr auto min_interval = 5s;
+        auto now = ss::lowres_clock::now();
+        if (
+          _gate.is_closed() || !_jwks_refresh.armed()
+          || now < _last_refresh_soon + min_interval) {
+            return;
+        }
+        _last_refresh_soon = now;
+        _jwks_refresh.rearm(now);
+    }
+
     ss::future<ss::sstring> make_request(parsed_url url) {
         auto is_https = url.scheme == "https";
         std::optional<ss::sstring> tls_host;
@@ -399,6 +422,8 @@ struct service::impl {
     std::optional<parsed_url> _parsed_jwks_url;
     std::optional<ss::sstring> _issuer;
     ss::timer<ss::lowres_clock> _jwks_refresh;
+    ss::lowres_clock::time_point _last_refresh_soon;
+    token_cache _tokens;
     ss::shared_ptr<ss::tls::certificate_credentials> _creds;
     absl::flat_hash_map<ss::sstring, std::unique_ptr<probe>> _probes;
 };
@@ -445,4 +470,19 @@ principal_mapping_rule const& service::get_principal_mapping_rule() const {
 
 ss::future<> service::refresh_keys() { return _impl->update_jwks(); }
 
+void service::refresh_keys_soon() { _impl->refresh_keys_soon(); }
+
+std::optional<authentication_data>
+service::get_authenticated(std::string_view bearer_token) {
+    return _impl->_tokens.get(
+      bearer_token,
+      _impl->_clock_skew_tolerance(),
+      ss::lowres_system_clock::now());
+}
+
+void service::put_authenticated(
+  std::string_view bearer_token, authentication_data const& data) {
+    _impl->_tokens.put(bearer_token, data);
+}
+
 } // namespace security::oidc
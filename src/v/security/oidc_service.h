@@ -48,6 +48,17 @@ public:
 
     ss::future<> refresh_keys();
 
+    /// Refresh the keys in the background ahead of the refresh interval,
+    /// e.g. when a token is signed with a key that is not known yet
+    void refresh_keys_soon();
+
+    /// The authentication of a bearer token made earlier with the current
+    /// keys, issuer, audience and principal mapping, until the token expires
+    std::optional<authentication_data>
+    get_authenticated(std::string_view bearer_token);
+    void put_authenticated(
+      std::string_view bearer_token, authentication_data const& data);
+
 private:
     struct impl;
     std::unique_ptr<impl> _impl;
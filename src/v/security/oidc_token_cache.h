@@ -0,0 +1,117 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+#pragma once
+
+#include "hashing/secure.h"
+#include "security/oidc_authenticator.h"
+#include "seastarx.h"
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/sstring.hh>
+
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <chrono>
+#include <optional>
+#include <string_view>
+
+namespace security::oidc {
+
+/**
+ * MRU cache of the authentications of the bearer tokens, so that the
+ * signature of a token is not verified again on every connection of a client
+ * until it expires.
+ *
+ * The tokens are keyed by their SHA-256, the entries are dropped on lookup
+ * once expired. The authentications depend on the keys, the issuer, the
+ * audience and the principal mapping they were made with, the cache is to be
+ * cleared when any of them changes.
+ */
+class token_cache {
+public:
+    static constexpr size_t default_capacity = 1000;
+
+    explicit token_cache(size_t capacity = default_capacity)
+      : _capacity{capacity} {}
+
+    /// The authentication of \p token, while it is not expired at \p now
+    std::optional<authentication_data> get(
+      std::string_view token,
+      std::chrono::seconds clock_skew_tolerance,
+      ss::lowres_system_clock::time_point now) {
+        auto& map = _cache.get<underlying_map>();
+        auto it = map.find(digest(token));
+        if (it == map.end()) {
+            return std::nullopt;
+        }
+        if ((it->data.expiry + clock_skew_tolerance) < now) {
+            map.erase(it);
+            return std::nullopt;
+        }
+        auto& list = _cache.get<underlying_list>();
+        list.relocate(list.begin(), _cache.project<underlying_list>(it));
+        return it->data;
+    }
+
+    /// Cache \p data as the authentication of \p token
+    void put(std::string_view token, authentication_data data) {
+        auto key = digest(token);
+        auto& map = _cache.get<underlying_map>();
+        if (auto it = map.find(key); it != map.end()) {
+            map.erase(it);
+        }
+        auto& list = _cache.get<underlying_list>();
+        list.emplace_front(std::move(key), std::move(data));
+        if (list.size() > _capacity) {
+            list.pop_back();
+        }
+    }
+
+    void clear() { _cache.clear(); }
+
+    size_t size() const { return _cache.size(); }
+
+private:
+    struct underlying_list {};
+    struct underlying_map {};
+
+    static ss::sstring digest(std::string_view token) {
+        hash_sha256 h;
+        h.update(token);
+        auto d = h.reset();
+        return {d.data(), d.size()};
+    }
+
+    struct entry {
+        entry(ss::sstring digest, authentication_data data)
+          : digest{std::move(digest)}
+          , data{std::move(data)} {}
+
+        ss::sstring digest;
+        authentication_data data;
+    };
+
+    using cache_t = boost::multi_index::multi_index_container<
+      entry,
+      boost::multi_index::indexed_by<
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        boost::multi_index::hashed_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::member<entry, ss::sstring, &entry::digest>,
+          std::hash<ss::sstring>>>>;
+
+    size_t _capacity;
+    cache_t _cache;
+};
+
+} // namespace security::oidc
@@ -95,6 +95,25 @@ request_auth_result request_authenticator::do_authenticate(
               "Malformed Authorization header");
         }
 
+        const auto is_superuser = [this, require_auth](const auto& user) {
+            const auto& superusers = _superusers();
+            auto found = std::find(superusers.begin(), superusers.end(), user);
+            return (found != superusers.end()) || (!require_auth);
+        };
+
+        // The password need not be salted again while the credential it was
+        // validated against is unchanged
+        if (auto user = _basic_auth_cache.get(base64, cred_store); user) {
+            vlog(
+              logger.trace, "Authenticated user {} (cached)", user->username);
+            auto superuser = is_superuser(user->username);
+            return request_auth_result(
+              std::move(user->username),
+              std::move(user->password),
+              std::move(user->sasl_mechanism),
+              request_auth_result::superuser(superuser));
+        }
+
         ss::sstring decoded_bytes;
         try {
             decoded_bytes = base64_to_string(base64);
@@ -152,10 +171,13 @@ request_auth_result request_authenticator::do_authenticate(
                   std::move(username), "Unauthorized");
             } else {
                 vlog(logger.trace, "Authenticated user {}", username);
-                const auto& superusers = _superusers();
-                auto found = std::find(
-                  superusers.begin(), superusers.end(), username);
-                bool superuser = (found != superusers.end()) || (!require_auth);
+                _basic_auth_cache.put(
+                  base64,
+                  {.username = username,
+                   .password = password,
+                   .sasl_mechanism = sasl_mechanism},
+                  cred);
+                bool superuser = is_superuser(username);
                 return request_auth_result(
                   std::move(username),
                   std::move(password),
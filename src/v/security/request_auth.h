@@ -13,6 +13,7 @@
 
 #include "cluster/fwd.h"
 #include "config/property.h"
+#include "security/basic_auth_cache.h"
 #include "security/fwd.h"
 #include "security/types.h"
 
@@ -133,6 +134,7 @@ private:
     cluster::controller* _controller{nullptr};
     config::binding<bool> _require_auth;
     config::binding<std::vector<ss::sstring>> _superusers;
+    security::basic_auth_cache _basic_auth_cache;
 };
 
 inline constexpr std::string_view authz_basic_prefix = "Basic ";
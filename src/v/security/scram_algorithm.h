@@ -17,6 +17,10 @@
 #include "ssx/sformat.h"
 #include "utils/base64.h"
 
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/future.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
 #include <absl/container/node_hash_map.h>
 
 /**
@@ -291,6 +295,31 @@ public:
         return bytes(result.begin(), result.end());
     }
 
+    /**
+     * hi() yielding to the reactor between chunks of the iterations, for the
+     * passwords salted on the handshake path so that a storm of connections
+     * does not stall the shard.
+     */
+    static ss::future<bytes> hi_gently(bytes str, bytes salt, int iterations) {
+        static constexpr int iterations_per_yield = 256;
+        MacType mac(str);
+        mac.update(salt);
+        mac.update(std::array<char, 4>{0, 0, 0, 1});
+        auto u1 = mac.reset();
+        auto prev = u1;
+        auto result = u1;
+        for (int i = 2; i <= iterations; i++) {
+            mac.update(prev);
+            auto ui = mac.reset();
+            result = result ^ ui;
+            prev = ui;
+            if (i % iterations_per_yield == 0) {
+                co_await ss::coroutine::maybe_yield();
+            }
+        }
+        co_return bytes(result.begin(), result.end());
+    }
+
     static bytes server_key(bytes_view salted_password) {
         MacType mac(salted_password);
         mac.update("Server Key");
@@ -846,6 +846,77 @@ BOOST_AUTO_TEST_CASE(auth_prefix_resource) {
     BOOST_REQUIRE_EQUAL(result.resource_name, default_resource.name());
 }
 
+BOOST_AUTO_TEST_CASE(auth_prefix_lengths) {
+    acl_principal user(principal_type::user, "alice");
+    acl_host host("192.168.3.1");
+
+    auto auth = make_test_instance();
+
+    auto add_pre = [&auth](ss::sstring name, const acl_entry& acl) {
+        std::vector<acl_binding> bindings;
+        bindings.emplace_back(
+          resource_pattern(resource_type::topic, name, pattern_type::prefixed),
+          acl);
+        auth.add_bindings(bindings);
+    };
+
+    add_pre("f", allow_read_acl);
+    add_pre("foo-bar", deny_read_acl);
+    add_pre("fop", deny_read_acl);
+    add_pre("foo-3lkjfklwe-longer", deny_read_acl);
+
+    // only the prefixes of the name match, whatever their length
+    auto result = auth.authorized(
+      model::topic(default_resource.name()), acl_operation::read, user, host);
+    BOOST_REQUIRE(result.authorized);
+    BOOST_REQUIRE_EQUAL(
+      result.resource_pattern,
+      resource_pattern(resource_type::topic, "f", pattern_type::prefixed));
+
+    // a deny on a longer prefix applies
+    add_pre("foo-", deny_read_acl);
+    result = auth.authorized(
+      model::topic(default_resource.name()), acl_operation::read, user, host);
+    BOOST_REQUIRE(!result.authorized);
+    BOOST_REQUIRE_EQUAL(
+      result.resource_pattern,
+      resource_pattern(resource_type::topic, "foo-", pattern_type::prefixed));
+}
+
+// the decisions are cached until the ACLs change
+BOOST_AUTO_TEST_CASE(auth_cache_invalidation) {
+    acl_principal user(principal_type::user, "alice");
+    acl_host host("192.168.3.1");
+
+    auto auth = make_test_instance();
+    model::topic topic(default_resource.name());
+
+    std::vector<acl_binding> bindings;
+    bindings.emplace_back(prefixed_resource, allow_read_acl);
+    auth.add_bindings(bindings);
+    BOOST_REQUIRE(auth.authorized(topic, acl_operation::read, user, host));
+    BOOST_REQUIRE(auth.authorized(topic, acl_operation::read, user, host));
+
+    {
+        std::vector<acl_binding_filter> filters;
+        filters.emplace_back(prefixed_resource, allow_read_acl);
+        auth.remove_bindings(filters, true);
+    }
+    BOOST_REQUIRE(auth.authorized(topic, acl_operation::read, user, host));
+
+    {
+        std::vector<acl_binding_filter> filters;
+        filters.emplace_back(prefixed_resource, allow_read_acl);
+        auth.remove_bindings(filters);
+    }
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::read, user, host));
+
+    bindings.clear();
+    bindings.emplace_back(default_resource, allow_read_acl);
+    auth.add_bindings(bindings);
+    BOOST_REQUIRE(auth.authorized(topic, acl_operation::read, user, host));
+}
+
 BOOST_AUTO_TEST_CASE(single_char) {
     acl_principal user(principal_type::user, "alice");
     acl_host host("192.168.3.1");
@@ -0,0 +1,71 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "security/basic_auth_cache.h"
+#include "security/credential_store.h"
+#include "security/scram_algorithm.h"
+#include "security/scram_credential.h"
+#include "security/types.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace security {
+
+namespace {
+
+basic_auth_cache::validated make_validated(const credential_user& user) {
+    return {
+      .username = user,
+      .password = credential_password{"password"},
+      .sasl_mechanism = "SCRAM-SHA-256"};
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(basic_auth_cache_test) {
+    const credential_user alice{"alice"};
+    const credential_user bob{"bob"};
+    const auto cred = scram_sha256::make_credentials("password", 4096);
+
+    credential_store store;
+    store.put(alice, cred);
+    store.put(bob, cred);
+
+    basic_auth_cache cache{2};
+    BOOST_REQUIRE(!cache.get("alice-authz", store));
+
+    cache.put("alice-authz", make_validated(alice), cred);
+    auto user = cache.get("alice-authz", store);
+    BOOST_REQUIRE(user);
+    BOOST_REQUIRE_EQUAL(user->username, alice);
+    BOOST_REQUIRE_EQUAL(user->sasl_mechanism, "SCRAM-SHA-256");
+
+    // Only the same authorization is cached
+    BOOST_REQUIRE(!cache.get("alice-other", store));
+
+    // The least recently used is evicted
+    cache.put("bob-authz", make_validated(bob), cred);
+    BOOST_REQUIRE(cache.get("alice-authz", store));
+    cache.put("bob-other", make_validated(bob), cred);
+    BOOST_REQUIRE_EQUAL(cache.size(), 2);
+    BOOST_REQUIRE(cache.get("alice-authz", store));
+    BOOST_REQUIRE(!cache.get("bob-authz", store));
+
+    // Dropped once the credential of the user is updated
+    store.put(alice, scram_sha256::make_credentials("changed", 4096));
+    BOOST_REQUIRE(!cache.get("alice-authz", store));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+
+    // Dropped once the user is removed
+    store.remove(bob);
+    BOOST_REQUIRE(!cache.get("bob-other", store));
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+}
+
+} // namespace security
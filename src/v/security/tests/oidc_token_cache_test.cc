@@ -0,0 +1,63 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "security/acl.h"
+#include "security/oidc_authenticator.h"
+#include "security/oidc_token_cache.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+namespace security::oidc {
+
+namespace {
+
+authentication_data
+make_data(std::string_view name, ss::lowres_system_clock::time_point exp) {
+    return {
+      .principal = acl_principal{principal_type::user, ss::sstring{name}},
+      .sub = ss::sstring{name},
+      .expiry = exp};
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(oidc_token_cache_test) {
+    using namespace std::chrono_literals;
+    const auto now = ss::lowres_system_clock::now();
+    const auto skew = 10s;
+
+    token_cache cache{2};
+    BOOST_REQUIRE(!cache.get("token-a", skew, now));
+
+    cache.put("token-a", make_data("alice", now + 1min));
+    auto data = cache.get("token-a", skew, now);
+    BOOST_REQUIRE(data);
+    BOOST_REQUIRE_EQUAL(data->sub, "alice");
+    BOOST_REQUIRE(!cache.get("token-b", skew, now));
+
+    // The least recently used is evicted
+    cache.put("token-b", make_data("bob", now + 1min));
+    BOOST_REQUIRE(cache.get("token-a", skew, now));
+    cache.put("token-c", make_data("carol", now + 1min));
+    BOOST_REQUIRE_EQUAL(cache.size(), 2);
+    BOOST_REQUIRE(cache.get("token-a", skew, now));
+    BOOST_REQUIRE(!cache.get("token-b", skew, now));
+
+    // Valid until expired, with the clock skew tolerance
+    BOOST_REQUIRE(cache.get("token-a", skew, now + 1min + 5s));
+    BOOST_REQUIRE(!cache.get("token-a", skew, now + 1min + 11s));
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+
+    cache.clear();
+    BOOST_REQUIRE(!cache.get("token-c", skew, now));
+}
+
+} // namespace security::oidc
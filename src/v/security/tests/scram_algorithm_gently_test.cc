@@ -0,0 +1,32 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+#include "random/generators.h"
+#include "security/scram_algorithm.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+namespace security {
+
+template<typename ScramAlgo>
+void check_hi_gently(int iterations) {
+    auto password = random_generators::get_bytes(20);
+    auto salt = random_generators::get_bytes(130);
+    auto expected = ScramAlgo::hi(password, salt, iterations);
+    auto salted = ScramAlgo::hi_gently(password, salt, iterations).get();
+    BOOST_REQUIRE(salted == expected);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_scram_hi_gently) {
+    for (int iterations : {1, 255, 256, 257, 4096}) {
+        check_hi_gently<scram_sha256>(iterations);
+        check_hi_gently<scram_sha512>(iterations);
+    }
+}
+
+} // namespace security
@@ -12,13 +12,24 @@
 #include "bytes/iobuf_parser.h"
 #include "hashing/crc32c.h"
 #include "likely.h"
+#include "reflection/type_traits.h"
+#include "serde/envelope_for_each_field.h"
 #include "serde/logger.h"
 #include "serde/read_header.h"
+#include "serde/rw/envelope.h"
+#include "serde/rw/map.h"
+#include "serde/rw/reservable.h"
 #include "serde/rw/rw.h"
 #include "ssx/future-util.h"
 #include "ssx/sformat.h"
 #include "vlog.h"
 
+#include <seastar/core/loop.hh>
+
+#include <limits>
+#include <optional>
+#include <tuple>
+
 namespace serde {
 
 template<typename T>
@@ -36,6 +47,38 @@ concept has_serde_async_direct_read = requires(iobuf_parser& in, header h) {
     { T::serde_async_direct_read(in, h) } -> seastar::Future;
 };
 
+/**
+ * Envelopes without serde_async_read/serde_async_write opt into the
+ * asynchronous serialization of their fields with
+ *
+ *   static constexpr auto redpanda_serde_async = true;
+ *
+ * Their fields are then written by write_async() and read by read_async(),
+ * so that large containers nested in them do not stall the reactor. The
+ * encoding is the same as the one of serde::write(). RPC messages are
+ * serialized with write_async() and read_async(), opting in the request or
+ * reply type, and the envelopes nested in it, is enough.
+ */
+template<typename T>
+concept is_async_envelope = is_envelope<T> && T::redpanda_serde_async;
+
+/**
+ * Containers whose elements are serialized one at a time, yielding whenever
+ * the task quota is exhausted.
+ */
+template<typename T>
+concept is_async_container
+  = reflection::is_std_vector<T> || reflection::is_fragmented_vector<T>
+    || reflection::is_ss_chunked_fifo<T>
+    || reflection::is_ss_circular_buffer<T> || Map<T>;
+
+template<typename T>
+ss::future<std::decay_t<T>>
+read_async_nested(iobuf_parser& in, size_t const bytes_left_limit);
+
+template<typename T>
+ss::future<> write_async(iobuf& out, T t);
+
 // TODO: coroutinize async functions after we switch to clang 16 (see
 // https://github.com/llvm/llvm-project/issues/49689)
 
@@ -61,12 +104,122 @@ inline ss::future<crc::crc32c> calculate_crc_async(iobuf_const_parser in) {
       });
 }
 
+namespace detail {
+
+template<typename T>
+ss::future<> read_async_fields(iobuf_parser& in, header const h, T& t) {
+    return std::apply(
+      [&](auto&... fields) {
+          auto f = ss::now();
+          ((f = std::move(f).then([&in, h, field = &fields] {
+                using FieldType = std::decay_t<decltype(*field)>;
+                if (h._bytes_left_limit == in.bytes_left()) {
+                    // an older version of the envelope, without this field
+                    return ss::now();
+                }
+                if (unlikely(in.bytes_left() < h._bytes_left_limit)) {
+                    throw serde_exception(fmt_with_ctx(
+                      ssx::sformat,
+                      "field spill over in {}, field type {}: "
+                      "envelope_end={}, in.bytes_left()={}",
+                      type_str<T>(),
+                      type_str<FieldType>(),
+                      h._bytes_left_limit,
+                      in.bytes_left()));
+                }
+                return read_async_nested<FieldType>(in, h._bytes_left_limit)
+                  .then([field](FieldType v) { *field = std::move(v); });
+            })),
+           ...);
+          return f;
+      },
+      envelope_to_tuple(t));
+}
+
+template<typename T>
+ss::future<> write_async_fields(iobuf& out, T& t) {
+    return std::apply(
+      [&](auto&... fields) {
+          auto f = ss::now();
+          ((f = std::move(f).then([&out, field = &fields] {
+                return write_async(out, std::move(*field));
+            })),
+           ...);
+          return f;
+      },
+      envelope_to_tuple(t));
+}
+
+template<typename T>
+ss::future<T>
+read_async_container(iobuf_parser& in, size_t const bytes_left_limit) {
+    auto const size = read_nested<serde_size_t>(in, bytes_left_limit);
+    return ss::do_with(
+      T{}, serde_size_t{0}, [&in, size, bytes_left_limit](T& t, auto& i) {
+          if constexpr (Reservable<T>) {
+              t.reserve(size);
+          }
+          return ss::do_until(
+                   [&i, size] { return i == size; },
+                   [&in, &t, &i, bytes_left_limit] {
+                       ++i;
+                       if constexpr (Map<T>) {
+                           auto key = read_nested<typename T::key_type>(
+                             in, bytes_left_limit);
+                           return read_async_nested<typename T::mapped_type>(
+                                    in, bytes_left_limit)
+                             .then([&t, key = std::move(key)](
+                                     typename T::mapped_type v) mutable {
+                                 t.emplace(std::move(key), std::move(v));
+                             });
+                       } else {
+                           return read_async_nested<typename T::value_type>(
+                                    in, bytes_left_limit)
+                             .then([&t](typename T::value_type v) {
+                                 t.push_back(std::move(v));
+                             });
+                       }
+                   })
+            .then([&t] {
+                if constexpr (!Map<T>) {
+                    t.shrink_to_fit();
+                }
+                return std::move(t);
+            });
+      });
+}
+
+template<typename T>
+ss::future<> write_async_container(iobuf& out, T t) {
+    if (unlikely(t.size() > std::numeric_limits<serde_size_t>::max())) {
+        throw serde_exception(fmt_with_ctx(
+          ssx::sformat,
+          "serde: {} size {} exceeds serde_size_t",
+          type_str<T>(),
+          t.size()));
+    }
+    write(out, static_cast<serde_size_t>(t.size()));
+    return ss::do_with(std::move(t), [&out](T& t) {
+        return ss::do_for_each(t, [&out](auto& el) {
+            if constexpr (Map<T>) {
+                write(out, el.first);
+                return write_async(out, std::move(el.second));
+            } else {
+                return write_async(out, std::move(el));
+            }
+        });
+    });
+}
+
+} // namespace detail
+
 template<typename T>
 ss::future<std::decay_t<T>>
 read_async_nested(iobuf_parser& in, size_t const bytes_left_limit) {
     using Type = std::decay_t<T>;
     if constexpr (
-      has_serde_async_direct_read<Type> || has_serde_async_read<Type>) {
+      has_serde_async_direct_read<Type> || has_serde_async_read<Type>
+      || is_async_envelope<Type>) {
         auto const h = read_header<Type>(in, bytes_left_limit);
         auto f = ss::now();
         if constexpr (is_checksum_envelope<Type>) {
@@ -99,7 +252,31 @@ read_async_nested(iobuf_parser& in, size_t const bytes_left_limit) {
                       [&t]() { return std::move(t); });
                 });
             });
+        } else {
+            static_assert(
+              !has_serde_read<Type>,
+              "async envelopes are read field by field");
+            return f.then([&in, h] {
+                return ss::do_with(Type{}, [&in, h](Type& t) {
+                    return detail::read_async_fields(in, h, t).then(
+                      [&in, h, &t]() {
+                          if (in.bytes_left() > h._bytes_left_limit) {
+                              in.skip(in.bytes_left() - h._bytes_left_limit);
+                          }
+                          return std::move(t);
+                      });
+                });
+            });
+        }
+    } else if constexpr (is_async_container<Type>) {
+        return detail::read_async_container<Type>(in, bytes_left_limit);
+    } else if constexpr (reflection::is_std_optional<Type>) {
+        using value_type = typename Type::value_type;
+        if (!read_nested<bool>(in, bytes_left_limit)) {
+            return ss::make_ready_future<Type>(std::nullopt);
         }
+        return read_async_nested<value_type>(in, bytes_left_limit)
+          .then([](value_type v) { return Type{std::move(v)}; });
     } else {
         return ss::make_ready_future<std::decay_t<T>>(
           read_nested<T>(in, bytes_left_limit));
@@ -126,7 +303,12 @@ ss::future<std::decay_t<T>> read_async(iobuf_parser& in) {
 template<typename T>
 ss::future<> write_async(iobuf& out, T t) {
     using Type = std::decay_t<T>;
-    if constexpr (is_envelope<Type> && has_serde_async_write<Type>) {
+    if constexpr (
+      is_envelope<Type>
+      && (has_serde_async_write<Type> || is_async_envelope<Type>)) {
+        static_assert(
+          has_serde_async_write<Type> || !has_serde_write<Type>,
+          "async envelopes are written field by field");
         write(out, Type::redpanda_serde_version);
         write(out, Type::redpanda_serde_compat_version);
 
@@ -146,7 +328,13 @@ ss::future<> write_async(iobuf& out, T t) {
            size_placeholder = std::move(size_placeholder),
            checksum_placeholder = std::move(checksum_placeholder)](
             T& t) mutable {
-              return t.serde_async_write(out).then(
+              auto f = ss::now();
+              if constexpr (has_serde_async_write<Type>) {
+                  f = t.serde_async_write(out);
+              } else {
+                  f = detail::write_async_fields(out, t);
+              }
+              return std::move(f).then(
                 [&out,
                  size_before,
                  size_placeholder = std::move(size_placeholder),
@@ -184,6 +372,15 @@ ss::future<> write_async(iobuf& out, T t) {
                     }
                 });
           });
+    } else if constexpr (is_async_container<Type>) {
+        return detail::write_async_container(out, std::move(t));
+    } else if constexpr (reflection::is_std_optional<Type>) {
+        if (!t) {
+            write(out, false);
+            return ss::now();
+        }
+        write(out, true);
+        return write_async(out, std::move(t.value()));
     } else {
         write(out, std::move(t));
         return ss::make_ready_future<>();
@@ -16,7 +16,10 @@
 #include "serde/read_header.h"
 #include "serde/rw/rw.h"
 #include "serde/serde_size_t.h"
+#include "utils/named_type.h"
 
+#include <bit>
+#include <tuple>
 #include <type_traits>
 
 namespace serde {
@@ -29,6 +32,74 @@ concept has_serde_read = requires(T t, iobuf_parser& in, const header& h) {
     t.serde_read(in, h);
 };
 
+namespace detail {
+
+/// Fields whose serde encoding is their in-memory representation on little
+/// endian hosts.
+template<typename T>
+struct is_bitwise_field
+  : std::bool_constant<
+      (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+      || std::is_floating_point_v<T>> {};
+
+template<typename T, typename Tag, typename IsConstexpr>
+struct is_bitwise_field<::detail::base_named_type<T, Tag, IsConstexpr>>
+  : std::bool_constant<
+      is_bitwise_field<T>::value
+      && sizeof(::detail::base_named_type<T, Tag, IsConstexpr>)
+           == sizeof(T)> {};
+
+template<typename Tuple>
+struct bitwise_fields_size {
+    static constexpr bool bitwise = false;
+    static constexpr std::size_t value = 0;
+};
+
+template<typename... Fields>
+struct bitwise_fields_size<std::tuple<Fields&...>> {
+    static constexpr bool bitwise
+      = (is_bitwise_field<std::remove_cv_t<Fields>>::value && ...);
+    static constexpr std::size_t value = (sizeof(Fields) + ... + 0);
+};
+
+template<typename T>
+using envelope_fields_size
+  = bitwise_fields_size<decltype(envelope_to_tuple(std::declval<T&>()))>;
+
+/// The fields of the envelope t are laid out one after the other, in the
+/// order they are serialized, from the beginning of t. The offsets of the
+/// fields are constants, so this is evaluated at compile time.
+template<typename T>
+bool is_packed(T& t) {
+    auto const* base = reinterpret_cast<char const*>(&t);
+    std::size_t offset = 0;
+    bool packed = true;
+    std::apply(
+      [&](auto&... f) {
+          ((packed = packed
+                     && reinterpret_cast<char const*>(&f) == base + offset,
+            offset += sizeof(f)),
+           ...);
+      },
+      envelope_to_tuple(t));
+    return packed;
+}
+
+} // namespace detail
+
+/**
+ * Envelopes only made of integral, floating point and named types of them,
+ * without padding, are serialized with a single copy of their bytes on little
+ * endian hosts. They are still read field by field when the encoded envelope
+ * is of an older version that lacks some of the fields.
+ */
+template<typename T>
+concept is_bitwise_envelope
+  = std::endian::native == std::endian::little
+    && std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>
+    && detail::envelope_fields_size<T>::bitwise
+    && detail::envelope_fields_size<T>::value == sizeof(T);
+
 template<typename T>
 requires is_envelope<std::decay_t<T>>
 void tag_invoke(
@@ -63,6 +134,17 @@ void tag_invoke(
     if constexpr (has_serde_read<Type>) {
         t.serde_read(in, h);
     } else {
+        if constexpr (is_bitwise_envelope<Type>) {
+            if (
+              detail::is_packed(t)
+              && in.bytes_left() >= h._bytes_left_limit + sizeof(Type)) {
+                in.consume_to(sizeof(Type), reinterpret_cast<char*>(&t));
+                if (in.bytes_left() > h._bytes_left_limit) {
+                    in.skip(in.bytes_left() - h._bytes_left_limit);
+                }
+                return;
+            }
+        }
         envelope_for_each_field(t, [&](auto& f) {
             using FieldType = std::decay_t<decltype(f)>;
             if (h._bytes_left_limit == in.bytes_left()) {
@@ -105,6 +187,13 @@ void tag_invoke(tag_t<write_tag>, iobuf& out, T t) {
     auto const size_before = out.size_bytes();
     if constexpr (has_serde_write<Type>) {
         t.serde_write(out);
+    } else if constexpr (is_bitwise_envelope<Type>) {
+        if (detail::is_packed(t)) {
+            out.append(reinterpret_cast<char const*>(&t), sizeof(Type));
+        } else {
+            envelope_for_each_field(
+              t, [&out](auto& f) { write(out, std::move(f)); });
+        }
     } else {
         envelope_for_each_field(
           t, [&out](auto& f) { write(out, std::move(f)); });
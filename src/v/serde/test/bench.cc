@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "serde/serde.h"
+#include "utils/named_type.h"
 
 #include <seastar/core/reactor.hh>
 #include <seastar/core/sharded.hh>
@@ -38,6 +39,53 @@ PERF_TEST(small, deserialize) {
     perf_tests::stop_measuring_time();
 }
 
+// like raft::protocol_metadata, written with a single copy of its bytes,
+// unlike small_t which has padding
+using offset_t = named_type<int64_t, struct bench_offset_tag>;
+struct metadata_t
+  : public serde::
+      envelope<metadata_t, serde::version<1>, serde::compat_version<0>> {
+    offset_t group{1};
+    offset_t commit_index{2};
+    offset_t term{3};
+    offset_t prev_log_index{4};
+    offset_t prev_log_term{5};
+    offset_t last_visible_index{6};
+    offset_t dirty_offset{7};
+};
+static_assert(serde::is_bitwise_envelope<metadata_t>);
+static_assert(!serde::is_bitwise_envelope<small_t>);
+
+PERF_TEST(metadata, serialize) {
+    perf_tests::start_measuring_time();
+    auto o = serde::to_iobuf(metadata_t{});
+    perf_tests::do_not_optimize(o);
+    perf_tests::stop_measuring_time();
+}
+PERF_TEST(metadata, deserialize) {
+    auto b = serde::to_iobuf(metadata_t{});
+    perf_tests::start_measuring_time();
+    auto result = serde::from_iobuf<metadata_t>(std::move(b));
+    perf_tests::do_not_optimize(result);
+    perf_tests::stop_measuring_time();
+}
+
+// a heartbeat to a thousand raft groups
+PERF_TEST(metadata_1000, serialize) {
+    std::vector<metadata_t> v(1000);
+    perf_tests::start_measuring_time();
+    auto o = serde::to_iobuf(std::move(v));
+    perf_tests::do_not_optimize(o);
+    perf_tests::stop_measuring_time();
+}
+PERF_TEST(metadata_1000, deserialize) {
+    auto b = serde::to_iobuf(std::vector<metadata_t>(1000));
+    perf_tests::start_measuring_time();
+    auto result = serde::from_iobuf<std::vector<metadata_t>>(std::move(b));
+    perf_tests::do_not_optimize(result);
+    perf_tests::stop_measuring_time();
+}
+
 struct big_t
   : public serde::envelope<big_t, serde::version<3>, serde::compat_version<2>> {
     small_t s;
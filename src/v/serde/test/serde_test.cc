@@ -500,6 +500,196 @@ SEASTAR_THREAD_TEST_CASE(snapshot_test) {
     }
 }
 
+struct async_entry
+  : serde::checksum_envelope<
+      async_entry,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    static constexpr auto redpanda_serde_async = true;
+
+    bool operator==(const async_entry&) const = default;
+
+    ss::sstring name;
+    std::vector<int64_t> values;
+};
+
+struct async_envelope_v0
+  : serde::
+      envelope<async_envelope_v0, serde::version<0>, serde::compat_version<0>> {
+    static constexpr auto redpanda_serde_async = true;
+
+    fragmented_vector<async_entry> entries;
+};
+
+struct async_envelope
+  : serde::
+      envelope<async_envelope, serde::version<1>, serde::compat_version<0>> {
+    static constexpr auto redpanda_serde_async = true;
+
+    bool operator==(const async_envelope&) const = default;
+
+    fragmented_vector<async_entry> entries;
+    absl::flat_hash_map<int32_t, std::vector<async_entry>> by_id;
+    std::optional<async_entry> last;
+};
+
+static_assert(serde::is_async_envelope<async_envelope>);
+static_assert(!serde::is_async_envelope<small>);
+
+async_entry make_async_entry(int i) {
+    async_entry e;
+    e.name = fmt::format("entry-{}", i);
+    for (int j = 0; j < i % 7; ++j) {
+        e.values.push_back(i * j);
+    }
+    return e;
+}
+
+async_envelope make_async_envelope() {
+    async_envelope ret;
+    for (int i = 0; i < 10000; ++i) {
+        ret.entries.push_back(make_async_entry(i));
+        ret.by_id[i % 13].push_back(make_async_entry(i));
+    }
+    ret.last = make_async_entry(42);
+    return ret;
+}
+
+SEASTAR_THREAD_TEST_CASE(async_envelope_test) {
+    auto obj = make_async_envelope();
+
+    // the asynchronous encoding is the synchronous one
+    auto b = iobuf();
+    serde::write_async(b, make_async_envelope()).get();
+    BOOST_REQUIRE(b == serde::to_iobuf(make_async_envelope()));
+
+    auto parser = iobuf_parser{b.copy()};
+    BOOST_REQUIRE(obj == serde::read_async<async_envelope>(parser).get());
+    BOOST_REQUIRE(obj == serde::from_iobuf<async_envelope>(std::move(b)));
+
+    // fields missing in older versions are left default initialized
+    async_envelope_v0 v0;
+    v0.entries.push_back(make_async_entry(1));
+    auto parser_v0 = iobuf_parser{serde::to_iobuf(std::move(v0))};
+    auto from_v0 = serde::read_async<async_envelope>(parser_v0).get();
+    BOOST_REQUIRE_EQUAL(from_v0.entries.size(), 1);
+    BOOST_REQUIRE(from_v0.by_id.empty());
+    BOOST_REQUIRE(!from_v0.last.has_value());
+}
+
+SEASTAR_THREAD_TEST_CASE(async_container_test) {
+    fragmented_vector<ss::sstring> v;
+    for (int i = 0; i < 100000; ++i) {
+        v.push_back(fmt::format("value-{}", i));
+    }
+
+    auto b = iobuf();
+    serde::write_async(b, v.copy()).get();
+    BOOST_REQUIRE(b == serde::to_iobuf(v.copy()));
+
+    auto parser = iobuf_parser{std::move(b)};
+    auto out = serde::read_async<fragmented_vector<ss::sstring>>(parser).get();
+    BOOST_REQUIRE(out == v);
+}
+
+using bitwise_offset = named_type<int64_t, struct bitwise_offset_tag>;
+
+struct bitwise_envelope
+  : serde::
+      envelope<bitwise_envelope, serde::version<1>, serde::compat_version<0>> {
+    bool operator==(const bitwise_envelope&) const = default;
+
+    bitwise_offset offset;
+    int64_t a;
+    int32_t b;
+    uint16_t c;
+    int8_t d;
+    uint8_t e;
+};
+
+// serialized in another order than declared
+struct reordered_envelope
+  : serde::envelope<
+      reordered_envelope,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    bool operator==(const reordered_envelope&) const = default;
+
+    int64_t a;
+    int64_t b;
+
+    auto serde_fields() { return std::tie(b, a); }
+};
+
+struct bitwise_envelope_v0
+  : serde::envelope<
+      bitwise_envelope_v0,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    bitwise_offset offset;
+    int64_t a;
+};
+
+struct padded_envelope
+  : serde::
+      envelope<padded_envelope, serde::version<0>, serde::compat_version<0>> {
+    int8_t a;
+    int64_t b;
+};
+
+struct bool_envelope
+  : serde::
+      envelope<bool_envelope, serde::version<0>, serde::compat_version<0>> {
+    bool a;
+};
+
+static_assert(serde::is_bitwise_envelope<bitwise_envelope>);
+static_assert(serde::is_bitwise_envelope<reordered_envelope>);
+static_assert(!serde::is_bitwise_envelope<padded_envelope>);
+static_assert(!serde::is_bitwise_envelope<bool_envelope>);
+
+SEASTAR_THREAD_TEST_CASE(bitwise_envelope_test) {
+    auto obj = bitwise_envelope{
+      .offset = bitwise_offset{-1},
+      .a = 0x0102030405060708,
+      .b = -3,
+      .c = 0xabcd,
+      .d = -5,
+      .e = 6};
+
+    iobuf expected;
+    serde::write(expected, serde::version_t{1});
+    serde::write(expected, serde::version_t{0});
+    serde::write(expected, serde::serde_size_t{24});
+    serde::write(expected, obj.offset);
+    serde::write(expected, obj.a);
+    serde::write(expected, obj.b);
+    serde::write(expected, obj.c);
+    serde::write(expected, obj.d);
+    serde::write(expected, obj.e);
+
+    auto b = serde::to_iobuf(obj);
+    BOOST_REQUIRE(b == expected);
+    BOOST_REQUIRE(obj == serde::from_iobuf<bitwise_envelope>(std::move(b)));
+
+    auto reordered = reordered_envelope{.a = 1, .b = 2};
+    auto r = serde::to_iobuf(reordered);
+    auto parser = iobuf_parser{r.copy()};
+    serde::read_nested<serde::version_t>(parser, 0);
+    serde::read_nested<serde::version_t>(parser, 0);
+    serde::read_nested<serde::serde_size_t>(parser, 0);
+    BOOST_REQUIRE_EQUAL(serde::read_nested<int64_t>(parser, 0), 2);
+    BOOST_REQUIRE(
+      reordered == serde::from_iobuf<reordered_envelope>(std::move(r)));
+
+    // an older version is read field by field
+    auto from_v0 = serde::from_iobuf<bitwise_envelope>(serde::to_iobuf(
+      bitwise_envelope_v0{.offset = bitwise_offset{7}, .a = 8}));
+    BOOST_REQUIRE_EQUAL(from_v0.offset, bitwise_offset{7});
+    BOOST_REQUIRE_EQUAL(from_v0.a, 8);
+    BOOST_REQUIRE_EQUAL(from_v0.b, 0);
+}
+
 struct small
   : public serde::envelope<small, serde::version<0>, serde::compat_version<0>> {
     bool operator==(const small&) const = default;
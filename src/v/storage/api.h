@@ -94,6 +94,10 @@ public:
     log_manager& log_mgr() { return *_log_mgr; }
     storage_resources& resources() { return _resources; }
 
+    ss::sharded<features::feature_table>& feature_table() {
+        return _feature_table;
+    }
+
     /*
      * Return disk space usage for kvstore and all logs. The information
      * returned is accumulated from all cores.
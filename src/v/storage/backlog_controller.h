@@ -100,6 +100,9 @@ public:
 
     void setup_metrics(const ss::sstring&);
 
+    /// the last sampled backlog is larger than the setpoint
+    bool behind() const { return _current_backlog > _setpoint; }
+
 private:
     ss::future<> set();
     ss::future<> update();
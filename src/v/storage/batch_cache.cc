@@ -19,8 +19,11 @@
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/memory.hh>
 #include <seastar/util/defer.hh>
 
+#include <algorithm>
+
 #include <fmt/ostream.h>
 
 namespace storage {
@@ -60,13 +63,7 @@ model::record_batch_header batch_cache::range::header(size_t o) {
 size_t batch_cache::range::memory_size() const {
     // actual memory allocated by arena iobuf must be calculated
     // taking capacity into account.
-    return std::accumulate(
-      _arena.begin(),
-      _arena.end(),
-      (size_t)0,
-      [](size_t acc, const details::io_fragment& f) {
-          return acc + f.capacity();
-      });
+    return _arena.capacity_bytes();
 }
 
 double batch_cache::range::waste() const {
@@ -124,14 +121,42 @@ register_memory_reporter(const batch_cache& bc) {
       "batch_cache", [&bc] { return bc.size_bytes(); });
 }
 
+static resources::memory_accounting::deregister_holder
+register_memory_accounting(const batch_cache& bc) {
+    return resources::memory_accounting::local().register_reporter(
+      resources::memory_subsystem::batch_cache,
+      [&bc] { return bc.size_bytes(); });
+}
+
+namespace {
+/*
+ * size the admission sketch to track about as many batches as could fit in
+ * memory if every batch occupied a full range.
+ */
+size_t admission_sketch_capacity() {
+    static constexpr size_t min_capacity = 1_KiB;
+    static constexpr size_t max_capacity = 1_MiB;
+    return std::clamp(
+      ss::memory::stats().total_memory()
+        / batch_cache::range::range_size,
+      min_capacity,
+      max_capacity);
+}
+} // namespace
+
 batch_cache::batch_cache(const reclaim_options& opts)
   : _reclaimer(
     [this](reclaimer::request r) { return reclaim(r); }, reclaim_scope::sync)
+  , _admission(
+      opts.admission_filter
+        ? std::make_optional<frequency_sketch>(admission_sketch_capacity())
+        : std::nullopt)
   , _reclaim_opts(opts)
   , _reclaim_size(_reclaim_opts.min_size)
   , _background_reclaimer(
       *this, opts.min_free_memory, opts.background_reclaimer_sg)
-  , _available_mem_deregister(register_memory_reporter(*this)) {
+  , _available_mem_deregister(register_memory_reporter(*this))
+  , _memory_accounting(register_memory_accounting(*this)) {
     _background_reclaimer.start();
 }
 
@@ -158,6 +183,8 @@ batch_cache::put(batch_cache_index& index, const model::record_batch& input) {
         auto r = new range(index, input);
         _lru.push_back(*r);
         _size_bytes += r->memory_size();
+        _data_bytes += r->_size;
+        _probe.add_bytes_inserted(r->_size);
         return entry(0, r->weak_from_this());
     }
 
@@ -171,14 +198,34 @@ batch_cache::put(batch_cache_index& index, const model::record_batch& input) {
     }
 
     auto initial_sz = index._small_batches_range->memory_size();
+    auto initial_data_sz = index._small_batches_range->_size;
     auto offset = index._small_batches_range->add(input);
     // calculate size difference to update batch cache size
     int64_t diff = (int64_t)index._small_batches_range->memory_size()
                    - initial_sz;
     _size_bytes += diff;
+    const auto data_diff = index._small_batches_range->_size - initial_data_sz;
+    _data_bytes += data_diff;
+    _probe.add_bytes_inserted(data_diff);
     return entry(offset, index._small_batches_range->weak_from_this());
 }
 
+bool batch_cache::admit(
+  const batch_cache_index& index, model::offset offset) {
+    if (!_admission) {
+        return true;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto key = reinterpret_cast<uintptr_t>(&index)
+                     ^ (static_cast<uint64_t>(offset()) << 1U);
+    _admission->increment(key);
+    if (_admission->frequency(key) >= 2) {
+        return true;
+    }
+    _probe.admission_rejected();
+    return false;
+}
+
 batch_cache::~batch_cache() noexcept {
     clear();
     vassert(
@@ -194,6 +241,11 @@ void batch_cache::evict(range_ptr&& e) {
         // r-value reference `e` wouldn't do that.
         auto p = std::exchange(e, {});
         _size_bytes -= p->memory_size();
+        // the data of invalid ranges was already accounted for by reclaim
+        if (p->valid()) {
+            _data_bytes -= p->_size;
+            _probe.add_bytes_evicted(p->_size);
+        }
         _lru.erase_and_dispose(
           _lru.iterator_to(*p), [](range* e) { delete e; });
     }
@@ -238,6 +290,7 @@ size_t batch_cache::reclaim(size_t size) {
      * index still exists even though the batch data was removed.
      */
     size_t reclaimed = 0;
+    size_t reclaimed_data = 0;
     intrusive_list<range, &range::_hook> reclaimed_ranges;
 
     for (auto it = _lru.begin(); it != _lru.end();) {
@@ -256,6 +309,9 @@ size_t batch_cache::reclaim(size_t size) {
         }
         // reclaim the batch's record data
         reclaimed += it->memory_size();
+        if (it->valid()) {
+            reclaimed_data += it->_size;
+        }
         it->_arena.clear();
 
         /*
@@ -301,6 +357,10 @@ size_t batch_cache::reclaim(size_t size) {
 
     _last_reclaim = ss::lowres_clock::now();
     _size_bytes -= reclaimed;
+    _data_bytes -= reclaimed_data;
+    if (reclaimed > 0) {
+        _probe.reclaimed(reclaimed);
+    }
     return reclaimed;
 }
 
@@ -310,11 +370,21 @@ batch_cache_index::get(model::offset offset) {
     if (auto it = find_first_contains(offset); it != _index.end()) {
         batch_cache::range::lock_guard g(*it->second.range());
         _cache->touch(it->second.range());
+        record_read(true);
         return it->second.batch();
     }
+    record_read(false);
     return std::nullopt;
 }
 
+void batch_cache_index::record_read(bool hit) {
+    if (hit) {
+        _cache->_probe.cache_hit();
+    } else {
+        _cache->_probe.cache_miss();
+    }
+}
+
 batch_cache_index::read_result batch_cache_index::read(
   model::offset offset,
   model::offset max_offset,
@@ -328,6 +398,8 @@ batch_cache_index::read_result batch_cache_index::read(
     if (unlikely(offset > max_offset)) {
         return ret;
     }
+    auto record = ss::defer(
+      [this, &ret] { record_read(!ret.batches.empty()); });
     for (auto it = find_first_contains(offset); it != _index.end();) {
         auto batch = it->second.batch();
 
@@ -12,8 +12,11 @@
 #pragma once
 #include "model/record.h"
 #include "resource_mgmt/available_memory.h"
+#include "resource_mgmt/memory_accounting.h"
 #include "ssx/semaphore.h"
+#include "storage/probe.h"
 #include "units.h"
+#include "utils/frequency_sketch.h"
 #include "utils/intrusive_list_helpers.h"
 #include "vassert.h"
 
@@ -94,8 +97,25 @@ class batch_cache_index;
  * the future, consider other solutions like blocking the reclaimer or only
  * allowing asynchronous reclaims while executing within the batch catch.
  *
- * TODO:
- *  - add probes to track statistics
+ * Statistics
+ * ==========
+ *
+ * Hits, misses, insertions, evictions and reclaims are tracked per shard by a
+ * batch_cache_probe. The cache also tracks the number of bytes in ranges that
+ * hold batch data so that fragmentation (see range::max_waste_bytes) can be
+ * reported as the difference between allocated and used memory.
+ *
+ * Admission
+ * =========
+ *
+ * Batches written to the log are always cached since the tail of the log is
+ * what most consumers read. Batches read from disk can optionally be passed
+ * through an admission filter (see reclaim_options::admission_filter). The
+ * filter estimates how often a batch has recently been read from disk with a
+ * TinyLFU frequency sketch, and only admits batches seen at least twice. A
+ * single sequential scan of historical data therefore does not displace
+ * batches that are read repeatedly, while data read by several consumers is
+ * still cached from the second read onwards.
  */
 
 class batch_cache {
@@ -115,6 +135,9 @@ public:
         // background reclaimer settings
         ss::scheduling_group background_reclaimer_sg;
         size_t min_free_memory = 64_MiB;
+        // when enabled batches read from disk are only cached once they have
+        // been read repeatedly
+        bool admission_filter = false;
     };
 
     /*
@@ -312,6 +335,18 @@ public:
      */
     size_t size_bytes() const { return _size_bytes; }
 
+    /**
+     * @brief Memory allocated to cache ranges but not holding batch data.
+     */
+    size_t waste_bytes() const {
+        return _size_bytes > _data_bytes ? _size_bytes - _data_bytes : 0;
+    }
+
+    /// Register per-shard cache metrics.
+    void setup_metrics() { _probe.setup_metrics(*this); }
+
+    const batch_cache_probe& probe() const { return _probe; }
+
 private:
     friend batch_cache_test_fixture;
     struct batch_reclaiming_lock {
@@ -358,6 +393,13 @@ private:
 
     friend background_reclaimer;
     friend batch_reclaiming_lock;
+    friend class batch_cache_index;
+
+    /*
+     * Record a read from disk of the batch at \p offset in \p index, and
+     * return true if the batch should be cached.
+     */
+    bool admit(const batch_cache_index& index, model::offset offset);
     /*
      * The entry point for the Seastar upcall for relcaiming memory. The
      * reclaimer is configured to perform the upcall asynchronously in a new
@@ -378,12 +420,17 @@ private:
     reclaimer _reclaimer;
     bool _is_reclaiming{false};
     size_t _size_bytes{0};
+    // bytes of batch data (headers and records) held by valid ranges
+    size_t _data_bytes{0};
+    batch_cache_probe _probe;
+    std::optional<frequency_sketch> _admission;
 
     reclaim_options _reclaim_opts;
     ss::lowres_clock::time_point _last_reclaim;
     size_t _reclaim_size;
     background_reclaimer _background_reclaimer;
     resources::available_memory::deregister_holder _available_mem_deregister;
+    resources::memory_accounting::deregister_holder _memory_accounting;
 
     friend std::ostream& operator<<(std::ostream&, const reclaim_options&);
     friend std::ostream& operator<<(std::ostream&, const batch_cache&);
@@ -433,11 +480,24 @@ public:
         }
     }
 
+    /**
+     * Cache a batch that was read from disk, subject to the cache's admission
+     * policy. See batch_cache for details.
+     */
+    void put_if_admitted(const model::record_batch& batch) {
+        if (_cache->admit(*this, batch.base_offset())) {
+            put(batch);
+        }
+    }
+
     /**
      * Return the batch containing the specified offset, if one exists.
      */
     std::optional<model::record_batch> get(model::offset offset);
 
+    /// Record a cache hit or miss for a read from this index.
+    void record_read(bool hit);
+
     /**
      * \brief Return a contiguous range of cached batches.
      *
@@ -14,6 +14,8 @@
 
 #include <boost/iterator/counting_iterator.hpp>
 
+#include <algorithm>
+
 namespace storage::internal {
 
 class chunk_cache {
@@ -30,8 +32,17 @@ public:
      */
     static constexpr const alignment alignment{4_KiB};
 
+    /**
+     * Number of free chunks retained per open appender, enough for a head
+     * chunk and a write in flight, so that a burst of appends right after
+     * appenders are opened (e.g. leadership moving to this node) does not
+     * have to wait on allocating and zeroing aligned memory.
+     */
+    static constexpr size_t chunks_per_appender = 2;
+
     chunk_cache() noexcept
       : _size_target(memory_groups().chunk_cache_min_memory())
+      , _size_min_target(_size_target)
       , _size_limit(memory_groups().chunk_cache_max_memory())
       , _chunk_size(config::shard_local_cfg().append_chunk_size()) {}
 
@@ -59,6 +70,8 @@ public:
             _size_total -= _chunk_size;
             return;
         }
+        // zero on return rather than on the appender's allocation path
+        chunk->reset();
         _chunks.push_back(chunk);
         _size_available += _chunk_size;
         if (_sem.waiters()) {
@@ -71,21 +84,58 @@ public:
         if (!_sem.waiters()) {
             return do_get();
         }
+        ++_waits;
         return ss::get_units(_sem, 1).then(
           [this](ssx::semaphore_units) { return do_get(); });
     }
 
+    /**
+     * Appenders register for their lifetime. The number of free chunks kept
+     * by the cache follows the number of open appenders, bounded by the
+     * cache's memory limits.
+     */
+    void appender_opened() {
+        ++_active_appenders;
+        update_size_target();
+    }
+    void appender_closed() {
+        --_active_appenders;
+        update_size_target();
+        // release free chunks above the new target
+        while (_size_available > _size_target && !_chunks.empty()) {
+            _chunks.pop_front();
+            _size_available -= _chunk_size;
+            _size_total -= _chunk_size;
+        }
+    }
+
     size_t chunk_size() const { return _chunk_size; }
 
+    size_t size_available() const { return _size_available; }
+    size_t size_total() const { return _size_total; }
+    size_t size_target() const { return _size_target; }
+    size_t active_appenders() const { return _active_appenders; }
+    size_t waiters() const { return _sem.waiters(); }
+    // number of times a caller had to wait for a chunk to be returned
+    uint64_t waits() const { return _waits; }
+
 private:
     ss::future<chunk_ptr> do_get() {
         if (auto c = pop_or_allocate(); c) {
             return ss::make_ready_future<chunk_ptr>(c);
         }
+        ++_waits;
         return ss::get_units(_sem, 1).then(
           [this](ssx::semaphore_units) { return do_get(); });
     }
 
+    void update_size_target() {
+        _size_target = std::clamp(
+          _active_appenders * chunks_per_appender * _chunk_size,
+          _size_min_target,
+          _size_limit);
+    }
+
     chunk_ptr pop_or_allocate() {
         if (!_chunks.empty()) {
             auto c = _chunks.front();
@@ -106,8 +156,11 @@ private:
     ssx::semaphore _sem{0, "s/chunk-cache"};
     size_t _size_available{0};
     size_t _size_total{0};
-    const size_t _size_target;
+    size_t _size_target;
+    const size_t _size_min_target;
     const size_t _size_limit;
+    size_t _active_appenders{0};
+    uint64_t _waits{0};
 
     const size_t _chunk_size{0};
 };
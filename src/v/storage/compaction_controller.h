@@ -37,6 +37,8 @@ public:
     ss::future<> start() { return _ctrl.start(); }
     ss::future<> stop() { return _ctrl.stop(); }
 
+    bool behind() const { return _ctrl.behind(); }
+
 private:
     backlog_controller _ctrl;
 };
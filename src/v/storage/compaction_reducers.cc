@@ -308,7 +308,8 @@ ss::future<ss::stop_iteration> copy_data_segment_reducer::filter_and_append(
                 r.offset_delta());
           });
     }
-    auto batch = co_await compress_batch(original, std::move(to_copy.value()));
+    auto batch = co_await offload_compress_batch(
+      original, std::move(to_copy.value()));
     auto const start_pos = _appender->file_byte_offset();
     auto const header_size = batch.header().size_bytes;
     _acc += header_size;
@@ -344,7 +345,7 @@ copy_data_segment_reducer::operator()(model::record_batch b) {
     if (!b.compressed()) {
         co_return co_await filter_and_append(comp, std::move(b));
     }
-    auto batch = co_await decompress_batch(std::move(b));
+    auto batch = co_await offload_decompress_batch(std::move(b));
 
     co_return co_await filter_and_append(comp, std::move(batch));
 }
@@ -356,23 +357,28 @@ index_rebuilder_reducer::operator()(model::record_batch&& b) {
     if (!b.compressed()) {
         f = do_index(std::move(b));
     } else {
-        f = internal::decompress_batch(std::move(b))
-              .then([this](model::record_batch&& b) {
-                  return do_index(std::move(b));
-              });
+        const auto& h = b.header();
+        f = internal::for_each_decompressed_record(
+          std::move(b),
+          [this,
+           bt = h.type,
+           ctrl = h.attrs.is_control(),
+           o = h.base_offset](model::record& r) {
+              return _w->index(bt, ctrl, r.key(), o, r.offset_delta());
+          });
     }
     return f.then([] { return ss::make_ready_future<stop_t>(stop_t::no); });
 }
 
 ss::future<> index_rebuilder_reducer::do_index(model::record_batch&& b) {
     return ss::do_with(std::move(b), [this](model::record_batch& b) {
-        return model::for_each_record(
+        return model::for_each_record_key(
           b,
           [this,
            bt = b.header().type,
            ctrl = b.header().attrs.is_control(),
-           o = b.base_offset()](model::record& r) {
-              return _w->index(bt, ctrl, r.key(), o, r.offset_delta());
+           o = b.base_offset()](model::record_key& r) {
+              return _w->index(bt, ctrl, r.key, o, r.offset_delta);
           });
     });
 }
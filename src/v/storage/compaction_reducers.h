@@ -14,6 +14,7 @@
 #include "bytes/bytes.h"
 #include "hashing/xx.h"
 #include "model/record_batch_reader.h"
+#include "resource_mgmt/memory_accounting.h"
 #include "storage/compacted_index.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/compacted_offset_list.h"
@@ -54,8 +55,9 @@ public:
 
     explicit compaction_key_reducer(size_t max_mem = default_max_memory_usage)
       : _max_mem(max_mem)
-      , _memory_tracker(
-          ss::make_shared<util::mem_tracker>("compaction_key_reducer_index"))
+      , _memory_tracker(resources::memory_accounting::local().create_tracker(
+          resources::memory_subsystem::compaction,
+          "compaction_key_reducer_index"))
       , _indices{util::tracking_allocator<value_type>{_memory_tracker}} {}
 
     ss::future<ss::stop_iteration> operator()(compacted_index::entry&&);
@@ -751,6 +751,41 @@ ss::future<bool> disk_log_impl::sliding_window_compact(
     co_return true;
 }
 
+ss::future<bool> disk_log_impl::multi_window_compact(
+  const compaction_config& cfg,
+  size_t max_passes,
+  std::optional<model::offset> new_start_offset) {
+    // Each pass fills the key map from the newest segments of the window
+    // backwards and rewrites every segment in the window against it. When the
+    // map fills up before reaching the start of the log, the next pass picks up
+    // the segments below the start of the previous window, so the number of
+    // passes over the log is bounded by its size divided by the map capacity.
+    bool compacted = false;
+    for (size_t pass = 0; pass < max_passes; ++pass) {
+        const auto prev_window_start = _last_compaction_window_start_offset;
+        if (!co_await sliding_window_compact(cfg, new_start_offset)) {
+            break;
+        }
+        compacted = true;
+        if (
+          _last_compaction_window_start_offset == prev_window_start
+          || _segs.empty()
+          || _last_compaction_window_start_offset
+               <= _segs.front()->offsets().base_offset) {
+            // No progress was made, or the window reached the start of the
+            // log.
+            break;
+        }
+        vlog(
+          gclog.debug,
+          "[{}] continuing sliding window compaction below {} (pass {})",
+          config().ntp(),
+          _last_compaction_window_start_offset,
+          pass + 1);
+    }
+    co_return compacted;
+}
+
 std::optional<std::pair<segment_set::iterator, segment_set::iterator>>
 disk_log_impl::find_compaction_range(const compaction_config& cfg) {
     /*
@@ -1181,7 +1216,10 @@ ss::future<> disk_log_impl::do_compact(
     // TODO: unify error handling.
     compact_cfg.asrc = &_compaction_as;
     auto did_compact_fut = co_await ss::coroutine::as_future(
-      sliding_window_compact(compact_cfg, new_start_offset));
+      multi_window_compact(
+        compact_cfg,
+        config::shard_local_cfg().log_compaction_max_sliding_windows(),
+        new_start_offset));
     if (did_compact_fut.failed()) {
         auto eptr = did_compact_fut.get_exception();
         if (ssx::is_shutdown_exception(eptr)) {
@@ -1755,55 +1793,54 @@ disk_log_impl::make_reader(log_reader_config config) {
 ss::future<model::record_batch_reader>
 disk_log_impl::make_reader(timequery_config config) {
     vassert(!_closed, "make_reader on closed log - {}", *this);
-    return _lock_mngr.range_lock(config).then(
-      [this, cfg = config](std::unique_ptr<lock_manager::lease> lease) {
-          auto start_offset = _start_offset;
-          if (!lease->range.empty()) {
-              const ss::lw_shared_ptr<segment>& segment = *lease->range.begin();
-              std::optional<segment_index::entry> index_entry = std::nullopt;
-
-              // The index (and hence, binary search) is used only if the
-              // timestamps on the batches are monotonically increasing.
-              if (segment->index().batch_timestamps_are_monotonic()) {
-                  index_entry = segment->index().find_nearest(cfg.time);
-                  vlog(
-                    stlog.debug,
-                    "Batch timestamps have monotonically increasing "
-                    "timestamps; used segment index to find first batch before "
-                    "timestamp {}: offset={} with ts={}",
-                    cfg.time,
-                    index_entry->offset,
-                    index_entry->timestamp);
-              }
+    auto lease = co_await _lock_mngr.range_lock(config);
+    auto start_offset = _start_offset;
+    if (!lease->range.empty()) {
+        const ss::lw_shared_ptr<segment>& segment = *lease->range.begin();
+        std::optional<segment_index::entry> index_entry = std::nullopt;
+
+        // The index (and hence, binary search) is used only if the
+        // timestamps on the batches are monotonically increasing.
+        if (segment->index().batch_timestamps_are_monotonic()) {
+            // the lease keeps the segment, and so its index, alive
+            index_entry = co_await segment->index().fetch_nearest(config.time);
+            vlog(
+              stlog.debug,
+              "Batch timestamps have monotonically increasing "
+              "timestamps; used segment index to find first batch before "
+              "timestamp {}: offset={} with ts={}",
+              config.time,
+              index_entry->offset,
+              index_entry->timestamp);
+        }
 
-              auto offset_within_segment = index_entry
-                                             ? index_entry->offset
-                                             : segment->offsets().base_offset;
+        auto offset_within_segment = index_entry
+                                       ? index_entry->offset
+                                       : segment->offsets().base_offset;
 
-              // adjust for partial visibility of segment prefix
-              start_offset = std::max(start_offset, offset_within_segment);
-          }
+        // adjust for partial visibility of segment prefix
+        start_offset = std::max(_start_offset, offset_within_segment);
+    }
 
-          vlog(
-            stlog.debug,
-            "Starting timequery lookup from offset={} for ts={} in log "
-            "with start_offset={}",
-            start_offset,
-            cfg.time,
-            _start_offset);
-
-          log_reader_config config(
-            start_offset,
-            cfg.max_offset,
-            0,
-            2048, // We just need one record batch
-            cfg.prio,
-            cfg.type_filter,
-            cfg.time,
-            cfg.abort_source);
-          return model::make_record_batch_reader<log_reader>(
-            std::move(lease), config, *_probe);
-      });
+    vlog(
+      stlog.debug,
+      "Starting timequery lookup from offset={} for ts={} in log "
+      "with start_offset={}",
+      start_offset,
+      config.time,
+      _start_offset);
+
+    log_reader_config reader_config(
+      start_offset,
+      config.max_offset,
+      0,
+      2048, // We just need one record batch
+      config.prio,
+      config.type_filter,
+      config.time,
+      config.abort_source);
+    co_return model::make_record_batch_reader<log_reader>(
+      std::move(lease), reader_config, *_probe);
 }
 
 std::optional<model::term_id> disk_log_impl::get_term(model::offset o) const {
@@ -165,6 +165,15 @@ public:
       const compaction_config& cfg,
       std::optional<model::offset> new_start_offset = std::nullopt);
 
+    // Runs consecutive sliding window compactions, each one deduplicating the
+    // window of segments below the previous one, until the log has been fully
+    // deduplicated or `max_passes` windows have been compacted. Returns true
+    // if any pass compacted.
+    ss::future<bool> multi_window_compact(
+      const compaction_config& cfg,
+      size_t max_passes,
+      std::optional<model::offset> new_start_offset = std::nullopt);
+
     const auto& compaction_ratio() const { return _compaction_ratio; }
 
 private:
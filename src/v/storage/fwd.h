@@ -14,6 +14,7 @@
 namespace storage {
 
 class api;
+class batch_cache;
 class compacted_index_writer;
 class compaction_controller;
 class key_offset_map;
@@ -34,4 +35,8 @@ struct compaction_config;
 struct log_reader_config;
 struct timequery_config;
 
+namespace internal {
+class chunk_cache;
+} // namespace internal
+
 } // namespace storage
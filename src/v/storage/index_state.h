@@ -71,6 +71,7 @@ private:
     uint32_t _val;
 
     friend struct index_state;
+    friend class segment_index;
 };
 
 /* Fileformat:
@@ -189,11 +190,14 @@ struct index_state
           std::end(relative_time_index),
           idx.raw_value(),
           std::less<uint32_t>{});
-        if (it == relative_offset_index.end()) {
-            return std::nullopt;
+        if (it == relative_time_index.end()) {
+            // every indexed batch is older, the target can only be after
+            // the last indexed one.
+            return empty() ? std::nullopt
+                           : std::make_optional(get_entry(size() - 1));
         }
 
-        const auto dist = std::distance(relative_offset_index.begin(), it);
+        const auto dist = std::distance(relative_time_index.begin(), it);
 
         // lower_bound will place us on the first batch in the index that has
         // 'max_timestamp' greater than 'ts'. Since not every batch is indexed,
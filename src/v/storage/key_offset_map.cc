@@ -10,10 +10,29 @@
  */
 #include "storage/key_offset_map.h"
 
+#include "hashing/xx.h"
+#include "random/generators.h"
+#include "resource_mgmt/memory_accounting.h"
+
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace storage {
 
+namespace {
+// index of the lowest slot set in a group bitmask
+size_t first_slot(uint32_t mask) {
+    return static_cast<size_t>(std::countr_zero(mask));
+}
+} // namespace
+
 simple_key_offset_map::simple_key_offset_map(std::optional<size_t> max_keys)
-  : _memory_tracker(ss::make_shared<util::mem_tracker>("simple_key_offset_map"))
+  : _memory_tracker(resources::memory_accounting::local().create_tracker(
+      resources::memory_subsystem::compaction, "simple_key_offset_map"))
   , _map(util::mem_tracked::map<absl::btree_map, compaction_key, model::offset>(
       _memory_tracker))
   , _max_keys(max_keys ? *max_keys : default_key_limit) {}
@@ -51,124 +70,77 @@ size_t simple_key_offset_map::capacity() const { return _max_keys; }
 
 seastar::future<std::optional<model::offset>>
 hash_key_offset_map::get(const compaction_key& key) const {
+    ++search_count_;
+    if (groups_.empty()) {
+        return seastar::make_ready_future<std::optional<model::offset>>(
+          std::nullopt);
+    }
+
     const auto hash = hash_key(key);
+    const slot_hash slot(hash);
 
-    // handle a non-normalized probe position
-    // (true, value) -> stop and return value
-    // (false, _)    -> keep probing
-    auto handle_entry =
-      [&](size_t index) -> std::pair<bool, std::optional<model::offset>> {
+    for (size_t probe = 0; probe < groups_.size(); ++probe) {
         ++probe_count_;
-        index = index % entries_.size();
-        auto& entry = entries_[index];
-        if (entry.empty()) {
-            return std::make_pair(true, std::nullopt);
-        } else if (entry.digest == hash) {
-            return std::make_pair(true, entry.offset);
-        }
-        return std::make_pair(false, std::nullopt);
-    };
-
-    ++search_count_;
-
-    // probe using the hash
-    probe probe(hash);
-    auto index = probe.next();
-    while (index.has_value()) {
-        const auto [stop, value] = handle_entry(index.value());
-        if (stop) {
-            return seastar::make_ready_future<std::optional<model::offset>>(
-              value);
+        const auto index = (slot.first_group + probe) % groups_.size();
+        const auto& grp = groups_[index];
+        for (auto match = grp.match(slot.tag); match != 0; match &= match - 1) {
+            const auto& entry
+              = entries_[index * group_size + first_slot(match)];
+            if (entry.digest == hash) {
+                return seastar::make_ready_future<
+                  std::optional<model::offset>>(entry.offset);
+            }
         }
-        const auto next_index = probe.next();
-        if (next_index.has_value()) {
-            index = next_index;
-        } else {
+        if (grp.match_empty() != 0) {
             break;
         }
     }
 
-    // fall back to linear probe
-    const auto linear_base = index.value_or(0);
-    for (size_t probe = 0; probe < entries_.size(); ++probe) {
-        const auto [stop, value] = handle_entry(linear_base + probe);
-        if (stop) {
-            return seastar::make_ready_future<std::optional<model::offset>>(
-              value);
-        }
-    }
-
     return seastar::make_ready_future<std::optional<model::offset>>(
       std::nullopt);
 }
 
 seastar::future<bool>
 hash_key_offset_map::put(const compaction_key& key, model::offset offset) {
-    const auto hash = hash_key(key);
-
-    const auto full = size_ >= capacity_;
+    ++search_count_;
+    if (groups_.empty()) {
+        return seastar::make_ready_future<bool>(false);
+    }
 
-    enum class handle {
-        inserted,
-        not_inserted,
-        not_inserted_full,
-    };
+    const auto hash = hash_key(key);
+    const slot_hash slot(hash);
 
-    // handle a non-normalized probe position
-    auto handle_entry = [&](size_t index) {
+    for (size_t probe = 0; probe < groups_.size(); ++probe) {
         ++probe_count_;
-        index = index % entries_.size();
-        auto& entry = entries_[index];
-        if (entry.empty()) {
-            if (full) {
-                return handle::not_inserted_full;
+        const auto index = (slot.first_group + probe) % groups_.size();
+        auto& grp = groups_[index];
+        for (auto match = grp.match(slot.tag); match != 0; match &= match - 1) {
+            auto& entry = entries_[index * group_size + first_slot(match)];
+            if (entry.digest == hash) {
+                if (offset > entry.offset) {
+                    entry.offset = offset;
+                    max_offset_ = std::max(max_offset_, offset);
+                }
+                return seastar::make_ready_future<bool>(true);
             }
-            entry.digest = hash;
-            entry.offset = offset;
+        }
+        // entries are never removed, so the key is not present in any later
+        // group if this group has an empty slot.
+        const auto empty = grp.match_empty();
+        if (empty != 0) {
+            if (size_ >= capacity_) {
+                return seastar::make_ready_future<bool>(false);
+            }
+            const auto pos = first_slot(empty);
+            grp.ctrl[pos] = slot.tag;
+            entries_[index * group_size + pos] = entry{
+              .digest = hash,
+              .offset = offset,
+            };
             ++size_;
             max_offset_ = std::max(max_offset_, offset);
-            return handle::inserted;
-        } else if (entry.digest == hash) {
-            if (offset > entry.offset) {
-                entry.offset = offset;
-                max_offset_ = std::max(max_offset_, offset);
-            }
-            return handle::inserted;
-        }
-        return handle::not_inserted;
-    };
-
-    ++search_count_;
-
-    // probe using the hash
-    probe probe(hash);
-    auto index = probe.next();
-    while (index.has_value()) {
-        const auto res = handle_entry(index.value());
-        if (res == handle::inserted) {
             return seastar::make_ready_future<bool>(true);
         }
-        if (res == handle::not_inserted_full) {
-            return seastar::make_ready_future<bool>(false);
-        }
-        const auto next_index = probe.next();
-        if (next_index.has_value()) {
-            index = next_index;
-        } else {
-            break;
-        }
-    }
-
-    // fall back to linear probe
-    const auto linear_base = index.value_or(0);
-    for (size_t probe = 0; probe < entries_.size(); ++probe) {
-        const auto res = handle_entry(linear_base + probe);
-        if (res == handle::inserted) {
-            return seastar::make_ready_future<bool>(true);
-        }
-        if (res == handle::not_inserted_full) {
-            return seastar::make_ready_future<bool>(false);
-        }
     }
 
     return seastar::make_ready_future<bool>(false);
@@ -180,17 +152,23 @@ size_t hash_key_offset_map::size() const { return size_; }
 size_t hash_key_offset_map::capacity() const { return capacity_; }
 
 seastar::future<> hash_key_offset_map::initialize(size_t size_bytes) {
+    co_await fragmented_vector_clear_async(groups_);
     co_await fragmented_vector_clear_async(entries_);
-    while (entries_.memory_size() < size_bytes) {
-        for (size_t i = 0; i < entries_.elements_per_fragment(); ++i) {
-            entries_.push_back(entry{});
-        }
-        if (seastar::need_preempt()) {
-            co_await seastar::maybe_yield();
+    // groups and entries are grown together, one fragment of groups at a time
+    while (groups_.memory_size() + entries_.memory_size() < size_bytes) {
+        for (size_t i = 0; i < groups_.elements_per_fragment(); ++i) {
+            groups_.push_back(group{});
+            for (size_t j = 0; j < group_size; ++j) {
+                entries_.push_back(entry{});
+            }
+            if (seastar::need_preempt()) {
+                co_await seastar::maybe_yield();
+            }
         }
     }
     size_ = 0;
     max_offset_ = model::offset{};
+    reseed();
     if (entries_.size() > 0) {
         capacity_ = std::max(
           size_t(1),
@@ -204,9 +182,11 @@ seastar::future<> hash_key_offset_map::initialize(size_t size_bytes) {
 }
 
 seastar::future<> hash_key_offset_map::reset() {
+    co_await fragmented_vector_fill_async(groups_, group{});
     co_await fragmented_vector_fill_async(entries_, entry{});
     size_ = 0;
     max_offset_ = model::offset{};
+    reseed();
     search_count_ = 0;
     probe_count_ = 0;
 }
@@ -219,38 +199,59 @@ double hash_key_offset_map::hit_rate() const {
            / static_cast<double>(probe_count_);
 }
 
-bool hash_key_offset_map::entry::empty() const {
-    return digest == hash_type::digest_type{};
+#if defined(__SSE2__)
+uint32_t hash_key_offset_map::group::match(int8_t tag) const {
+    const auto v = _mm_loadu_si128(
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      reinterpret_cast<const __m128i*>(ctrl.data()));
+    return static_cast<uint32_t>(
+      _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(tag), v)));
 }
 
-hash_key_offset_map::probe::probe(const hash_type::digest_type& hash)
-  : iter(hash.data())
-  , end(iter + hash_type::digest_size) {}
-
-std::optional<hash_key_offset_map::probe::index_type>
-hash_key_offset_map::probe::next() {
-    if ((iter + sizeof(index_type)) > end) {
-        return std::nullopt;
+uint32_t hash_key_offset_map::group::match_empty() const {
+    // the empty marker is the only control byte with the sign bit set
+    const auto v = _mm_loadu_si128(
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      reinterpret_cast<const __m128i*>(ctrl.data()));
+    return static_cast<uint32_t>(_mm_movemask_epi8(v));
+}
+#else
+uint32_t hash_key_offset_map::group::match(int8_t tag) const {
+    uint32_t mask = 0;
+    for (size_t i = 0; i < size; ++i) {
+        mask |= static_cast<uint32_t>(ctrl[i] == tag) << i;
     }
+    return mask;
+}
 
-    // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
-    index_type index;
-    std::memcpy(&index, iter, sizeof(index_type));
-
-    iter += sizeof(index_type);
+uint32_t hash_key_offset_map::group::match_empty() const {
+    return match(empty);
+}
+#endif
 
-    return index;
+hash_key_offset_map::slot_hash::slot_hash(const digest_type& hash) {
+    std::memcpy(&first_group, hash.data(), sizeof(first_group));
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    tag = static_cast<int8_t>(hash[digest_size - 1] & 0x7fU);
 }
 
-hash_key_offset_map::hash_type::digest_type
+hash_key_offset_map::digest_type
 hash_key_offset_map::hash_key(const compaction_key& key) const {
-    try {
-        hasher_.update(key);
-        return hasher_.reset();
-    } catch (...) {
-        hasher_.reset();
-        throw;
-    }
+    const auto hash = xxhash_128(
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      reinterpret_cast<const char*>(key.data()),
+      key.size(),
+      seed_);
+    static_assert(sizeof(hash.low64) + sizeof(hash.high64) == digest_size);
+    digest_type digest{};
+    std::memcpy(digest.data(), &hash.low64, sizeof(hash.low64));
+    std::memcpy(
+      digest.data() + sizeof(hash.low64), &hash.high64, sizeof(hash.high64));
+    return digest;
+}
+
+void hash_key_offset_map::reseed() {
+    seed_ = random_generators::get_int<uint64_t>();
 }
 
 } // namespace storage
@@ -8,7 +8,6 @@
 // by the Apache License, Version 2.0
 #pragma once
 
-#include "hashing/secure.h"
 #include "storage/compacted_index.h"
 #include "utils/fragmented_vector.h"
 #include "utils/tracking_allocator.h"
@@ -17,6 +16,8 @@
 
 #include <absl/container/btree_map.h>
 
+#include <array>
+
 namespace storage {
 
 /**
@@ -95,7 +96,24 @@ private:
 };
 
 /**
- * A key_offset_map in which the key space is mapped to sha256(key).
+ * A key_offset_map in which the key space is mapped to a 128-bit xxhash3
+ * digest of the key.
+ *
+ * The hash is keyed with a random seed that is chosen each time the map is
+ * initialized or reset. Since only digests are stored, two keys with the same
+ * digest would be treated as the same key. At 128 bits the chance of this is
+ * negligible (roughly n^2 / 2^129 for n keys), and re-keying on every reset
+ * ensures that keys can't be crafted to collide and that a collision never
+ * repeats across compaction passes.
+ *
+ * The table is laid out in the style of a swiss table: entries are arranged in
+ * groups of `group_size` slots, and each group has an array of one byte
+ * control words holding either a marker for an empty slot or 7 bits of the
+ * digest of the entry in the slot. A lookup hashes to a group, compares all of
+ * its control bytes against the digest in one SIMD operation, and only
+ * inspects entries whose control byte matches. Groups are probed linearly
+ * until one with an empty slot is found. Since entries are never removed an
+ * empty slot terminates the search.
  *
  * This container does not auto-grow on insert, and a default initialized
  * instance has zero capacity. To add capacity call `reset(size_bytes)`. This is
@@ -106,7 +124,7 @@ private:
  * destructor is run.
  */
 class hash_key_offset_map : public key_offset_map {
-    static constexpr double max_load_factor = 0.95;
+    static constexpr double max_load_factor = 0.9;
 
 public:
     seastar::future<std::optional<model::offset>>
@@ -139,46 +157,64 @@ public:
 
     /**
      * The ratio of hash table searches (e.g. one get or put) to the number of
-     * underlying accesses made into the hash table.
+     * groups of entries examined.
      */
     double hit_rate() const;
 
 private:
-    using hash_type = hash_sha256;
+    static constexpr size_t digest_size = 16;
+    using digest_type = std::array<uint8_t, digest_size>;
 
     /**
      * hash table entry.
      */
     struct entry {
-        hash_type::digest_type digest{};
+        digest_type digest{};
         model::offset offset;
-        bool empty() const;
     };
 
     /**
-     * Uses successive chunks of sizeof(index_type) bytes taken from hash(key)
-     * as probes into the hash table. When `next()` returns null then the caller
-     * should switch to linear probing.
+     * Control bytes for `group_size` consecutive entries. A control byte is
+     * either `empty` or the 7-bit tag of the digest of the entry in the slot.
      */
-    struct probe {
-        using index_type = uint32_t;
-        static_assert(sizeof(index_type) <= hash_type::digest_size);
+    struct group {
+        static constexpr size_t size = 16;
+        static constexpr int8_t empty = -128;
 
-        explicit probe(const hash_type::digest_type&);
+        group() { ctrl.fill(empty); }
 
-        std::optional<index_type> next();
+        /// bitmask of the slots whose control byte equals \p tag
+        uint32_t match(int8_t tag) const;
 
-        hash_type::digest_type::const_pointer iter;
-        hash_type::digest_type::const_pointer end;
+        /// bitmask of the empty slots
+        uint32_t match_empty() const;
+
+        std::array<int8_t, size> ctrl;
     };
+    static constexpr size_t group_size = group::size;
+
+    /**
+     * The position of a digest in the table: the group at which probing
+     * starts, and the tag stored in the control byte.
+     */
+    struct slot_hash {
+        explicit slot_hash(const digest_type&);
+        uint64_t first_group;
+        int8_t tag;
+    };
+
+    /**
+     * hash the compaction key.
+     */
+    digest_type hash_key(const compaction_key&) const;
 
     /**
-     * hash the compaction key. this helper will catch exceptions and reset the
-     * hashing object which is reused to avoid reinitialization of gnutls state.
+     * choose a new seed for hash_key.
      */
-    hash_type::digest_type hash_key(const compaction_key&) const;
+    void reseed();
 
-    mutable hash_type hasher_;
+    uint64_t seed_{0};
+    large_fragment_vector<group> groups_;
     large_fragment_vector<entry> entries_;
     size_t size_{0};
     model::offset max_offset_;
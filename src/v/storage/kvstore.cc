@@ -31,6 +31,8 @@
 #include <seastar/util/defer.hh>
 #include <seastar/util/log.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 static ss::logger lg("kvstore");
 
 namespace storage {
@@ -83,10 +85,31 @@ ss::future<> kvstore::start() {
               "cached_bytes",
               [this] { return _probe.cached_bytes; },
               ss::metrics::description("Size of the database in memory")),
+            ss::metrics::make_current_bytes(
+              "cached_capacity_bytes",
+              [this] { return _probe.cached_capacity_bytes; },
+              ss::metrics::description(
+                "Memory allocated to the values of the database")),
             ss::metrics::make_counter(
               "key_count",
               [this] { return _db.size(); },
               ss::metrics::description("Number of keys in the database")),
+            ss::metrics::make_total_operations(
+              "flushes",
+              [this] { return _probe.flushes; },
+              ss::metrics::description(
+                "Number of batches of operations flushed to disk")),
+            ss::metrics::make_total_operations(
+              "ops_flushed",
+              [this] { return _probe.ops_flushed; },
+              ss::metrics::description(
+                "Number of operations completed by flushes")),
+            ss::metrics::make_total_operations(
+              "ops_combined",
+              [this] { return _probe.ops_combined; },
+              ss::metrics::description(
+                "Number of operations not logged because a later operation "
+                "in the same flush wrote the same key")),
           });
     }
 
@@ -132,7 +155,9 @@ ss::future<> kvstore::stop() {
     // it starts these ops begin cancelled would be ops that arrived between the
     // start of a flush and this service being stopped.
     for (auto& op : _ops) {
-        op.done.set_exception(ss::gate_closed_exception());
+        if (op.done) {
+            op.done->set_exception(ss::gate_closed_exception());
+        }
     }
     _ops.clear();
 
@@ -145,6 +170,26 @@ ss::future<> kvstore::stop() {
     });
 }
 
+namespace {
+constexpr std::array all_key_spaces{
+  kvstore::key_space::testing,
+  kvstore::key_space::consensus,
+  kvstore::key_space::storage,
+  kvstore::key_space::controller,
+  kvstore::key_space::offset_translator,
+  kvstore::key_space::usage,
+  kvstore::key_space::stms,
+};
+
+/*
+ * Return the key-space of a key produced by make_spaced_key
+ */
+kvstore::key_space key_space_of(const bytes& spaced_key) {
+    return static_cast<kvstore::key_space>(
+      static_cast<int8_t>(spaced_key[0]));
+}
+} // namespace
+
 /*
  * Return a key prefixed by a key-space
  */
@@ -185,22 +230,54 @@ ss::future<> kvstore::remove(key_space ks, bytes key) {
     return put(ks, std::move(key), std::nullopt);
 }
 
+ss::future<> kvstore::put_many(key_space ks, std::vector<key_value> kvs) {
+    for (const auto& kv : kvs) {
+        if (kv.value) {
+            _probe.entry_written();
+        } else {
+            _probe.entry_removed();
+        }
+    }
+    return enqueue(ks, std::move(kvs));
+}
+
+ss::future<> kvstore::remove_many(key_space ks, std::vector<bytes> keys) {
+    std::vector<key_value> kvs;
+    kvs.reserve(keys.size());
+    for (auto& key : keys) {
+        kvs.push_back(key_value{.key = std::move(key), .value = std::nullopt});
+    }
+    return put_many(ks, std::move(kvs));
+}
+
 ss::future<> kvstore::put(key_space ks, bytes key, std::optional<iobuf> value) {
+    std::vector<key_value> kvs;
+    kvs.push_back(key_value{.key = std::move(key), .value = std::move(value)});
+    return enqueue(ks, std::move(kvs));
+}
+
+ss::future<> kvstore::enqueue(key_space ks, std::vector<key_value> kvs) {
     vassert(_started, "kvstore has not been started");
+    if (kvs.empty()) {
+        return ss::now();
+    }
 
-    key = make_spaced_key(ks, key);
-    return ss::with_gate(
-      _gate, [this, key = std::move(key), value = std::move(value)]() mutable {
-          auto& w = _ops.emplace_back(std::move(key), std::move(value));
-          if (!_timer.armed()) {
-              _timer.arm(_conf.commit_interval());
-          }
-          return w.done.get_future();
-      });
+    return ss::with_gate(_gate, [this, ks, kvs = std::move(kvs)]() mutable {
+        for (auto& kv : kvs) {
+            _ops.emplace_back(make_spaced_key(ks, kv.key), std::move(kv.value));
+        }
+        // the ops are flushed together, so the last one completes them all
+        auto& done = _ops.back().done.emplace();
+        if (!_timer.armed()) {
+            _timer.arm(_conf.commit_interval());
+        }
+        return done.get_future();
+    });
 }
 
 void kvstore::apply_op(
   bytes key, std::optional<iobuf> value, ssx::semaphore_units const&) {
+    _dirty_key_spaces.insert(key_space_of(key));
     auto it = _db.find(key);
     bool found = it != _db.end();
     if (value) {
@@ -210,8 +287,10 @@ void kvstore::apply_op(
           (found ? "update" : "insert"),
           key,
           value);
+        _probe.add_cached_capacity_bytes(value->capacity_bytes());
         if (found) {
             _probe.dec_cached_bytes(it->second.size_bytes());
+            _probe.dec_cached_capacity_bytes(it->second.capacity_bytes());
             _probe.add_cached_bytes(value->size_bytes());
             it->second = std::move(*value);
         } else {
@@ -224,6 +303,7 @@ void kvstore::apply_op(
         } else {
             vlog(lg.trace, "Apply op: delete: key={}", key);
             _probe.dec_cached_bytes(it->first.size() + it->second.size_bytes());
+            _probe.dec_cached_capacity_bytes(it->second.capacity_bytes());
             _db.erase(it);
         }
     }
@@ -237,10 +317,40 @@ ss::future<> kvstore::flush_and_apply_ops() {
     // flush and apply whatever happens to be queued up
     auto ops = std::exchange(_ops, {});
 
+    // write-combining: of several writes to the same key only the last one
+    // is logged and applied, which leaves the database in the same state.
+    std::vector<bool> superseded(ops.size(), false);
+    {
+        absl::flat_hash_map<bytes_view, size_t> last_write;
+        last_write.reserve(ops.size());
+        for (size_t i = 0; i < ops.size(); ++i) {
+            auto [it, inserted] = last_write.emplace(bytes_view(ops[i].key), i);
+            if (!inserted) {
+                superseded[it->second] = true;
+                it->second = i;
+            }
+        }
+    }
+    const auto combined = static_cast<size_t>(
+      std::count(superseded.begin(), superseded.end(), true));
+    _probe.flushed(ops.size(), combined);
+
     // build the operation batch to be logged
     storage::record_batch_builder builder(
       model::record_batch_type::kvstore, _next_offset);
-    for (auto& op : ops) {
+    size_t ops_bytes = 0;
+    for (size_t i = 0; i < ops.size(); ++i) {
+        if (!superseded[i]) {
+            ops_bytes += ops[i].key.size()
+                         + (ops[i].value ? ops[i].value->size_bytes() : 0);
+        }
+    }
+    builder.reserve(ops.size() - combined, ops_bytes);
+    for (size_t i = 0; i < ops.size(); ++i) {
+        if (superseded[i]) {
+            continue;
+        }
+        auto& op = ops[i];
         std::optional<iobuf> value;
         if (op.value) {
             value = op.value->share(0, op.value->size_bytes());
@@ -260,10 +370,18 @@ ss::future<> kvstore::flush_and_apply_ops() {
     return _segment->append(std::move(batch))
       .then([this](append_result) { return _segment->flush(); })
       .then([this]() { return _db_mut.get_units(); })
-      .then([this, last_offset, ops = std::move(ops)](auto units) mutable {
-          for (auto& op : ops) {
-              apply_op(std::move(op.key), std::move(op.value), units);
-              op.done.set_value();
+      .then([this,
+             last_offset,
+             ops = std::move(ops),
+             superseded = std::move(superseded)](auto units) mutable {
+          for (size_t i = 0; i < ops.size(); ++i) {
+              auto& op = ops[i];
+              if (!superseded[i]) {
+                  apply_op(std::move(op.key), std::move(op.value), units);
+              }
+              if (op.done) {
+                  op.done->set_value();
+              }
           }
           _next_offset = last_offset + model::offset(1);
           units.return_all();
@@ -336,6 +454,22 @@ ss::future<> kvstore::roll() {
     return ss::now();
 }
 
+simple_snapshot_manager kvstore::key_space_snapshot(key_space ks) const {
+    return simple_snapshot_manager(
+      std::filesystem::path(_ntpc.work_directory()),
+      ssx::sformat(
+        "{}.{}",
+        simple_snapshot_manager::default_snapshot_filename,
+        static_cast<int>(ks)),
+      ss::default_priority_class());
+}
+
+bool kvstore::use_key_space_snapshots() const {
+    return _has_key_space_snapshots
+           || _feature_table.local().is_active(
+             features::feature::kvstore_incremental_snapshots);
+}
+
 ss::future<> kvstore::save_snapshot() {
     vassert(
       _next_offset >= model::offset(0),
@@ -347,6 +481,10 @@ ss::future<> kvstore::save_snapshot() {
         co_return;
     }
 
+    if (use_key_space_snapshots()) {
+        co_return co_await save_key_space_snapshots();
+    }
+
     // package up the db into a batch
     storage::record_batch_builder builder(
       model::record_batch_type::kvstore, model::offset(0));
@@ -357,9 +495,68 @@ ss::future<> kvstore::save_snapshot() {
           entry.second.share(0, entry.second.size_bytes()));
         co_await ss::coroutine::maybe_yield();
     }
+    _dirty_key_spaces.clear();
     units.return_all();
-    auto batch = std::move(builder).build();
 
+    // the last log offset represented in the snapshot
+    co_await write_snapshot(
+      _snap, std::move(builder).build(), _next_offset - model::offset(1));
+}
+
+ss::future<> kvstore::save_key_space_snapshots() {
+    // the legacy snapshot covers every key space, all of them must have
+    // their own snapshot before it can be removed.
+    const bool has_legacy_snapshot = (co_await _snap.size()).has_value();
+    if (has_legacy_snapshot) {
+        _dirty_key_spaces.insert(all_key_spaces.begin(), all_key_spaces.end());
+    }
+    if (_dirty_key_spaces.empty()) {
+        co_return;
+    }
+
+    // package up the dirty key spaces, one batch each
+    absl::flat_hash_map<key_space, storage::record_batch_builder> builders;
+    auto units = co_await _db_mut.get_units();
+    auto dirty = std::exchange(_dirty_key_spaces, {});
+    for (auto ks : dirty) {
+        builders.emplace(
+          ks,
+          storage::record_batch_builder(
+            model::record_batch_type::kvstore, model::offset(0)));
+    }
+    for (auto& entry : _db) {
+        if (auto it = builders.find(key_space_of(entry.first));
+            it != builders.end()) {
+            it->second.add_raw_kv(
+              bytes_to_iobuf(entry.first),
+              entry.second.share(0, entry.second.size_bytes()));
+        }
+        co_await ss::coroutine::maybe_yield();
+    }
+    const auto last_offset = _next_offset - model::offset(1);
+    units.return_all();
+
+    vlog(
+      lg.debug,
+      "Saving snapshots of {} key spaces at offset {}",
+      builders.size(),
+      last_offset);
+    for (auto& [ks, builder] : builders) {
+        auto snap = key_space_snapshot(ks);
+        co_await write_snapshot(snap, std::move(builder).build(), last_offset);
+    }
+    _has_key_space_snapshots = true;
+
+    if (has_legacy_snapshot) {
+        vlog(lg.info, "Removing legacy snapshot, replaced by key space ones");
+        co_await _snap.remove_snapshot();
+    }
+}
+
+ss::future<> kvstore::write_snapshot(
+  simple_snapshot_manager& snap,
+  model::record_batch batch,
+  model::offset last_offset) {
     // serialize batch: size_prefix + batch
     iobuf data;
     auto ph = data.reserve(sizeof(int32_t));
@@ -370,13 +567,12 @@ ss::future<> kvstore::save_snapshot() {
 
     vlog(
       lg.debug,
-      "Creating snapshot at offset {} ({} bytes)",
-      _next_offset - model::offset(1),
+      "Creating snapshot {} at offset {} ({} bytes)",
+      snap.name(),
+      last_offset,
       size);
 
-    auto wr = co_await _snap.start_snapshot();
-    // the last log offset represented in the snapshot
-    auto last_offset = _next_offset - model::offset(1);
+    auto wr = co_await snap.start_snapshot();
 
     iobuf meta;
     reflection::serialize(meta, last_offset);
@@ -387,15 +583,16 @@ ss::future<> kvstore::save_snapshot() {
     co_await wr.close();
 
     vlog(lg.debug, "Finishing snapshot creation");
-    co_await _snap.finish_snapshot(wr);
+    co_await snap.finish_snapshot(wr);
 }
 
 ss::future<> kvstore::recover() {
     /*
      * after loading _next_offset will be set to either zero if no snapshot
-     * is found, or the offset immediately following the snapshot offset.
+     * is found, or the offset immediately following the newest snapshot.
      */
     co_await load_snapshot();
+    co_await load_key_space_snapshots();
 
     auto segments = co_await recover_segments(
       partition_path(_ntpc),
@@ -410,6 +607,7 @@ ss::future<> kvstore::recover() {
       _ntp_sanitizer_config);
 
     co_await replay_segments(std::move(segments));
+    _snapshot_offsets.clear();
 }
 
 ss::future<> kvstore::load_snapshot() {
@@ -425,7 +623,7 @@ ss::future<> kvstore::load_snapshot() {
 
     std::exception_ptr ex;
     try {
-        co_await load_snapshot_from_reader(reader.value());
+        co_await load_snapshot_from_reader(reader.value(), std::nullopt);
     } catch (...) {
         ex = std::current_exception();
     }
@@ -436,7 +634,37 @@ ss::future<> kvstore::load_snapshot() {
     }
 }
 
-ss::future<> kvstore::load_snapshot_from_reader(snapshot_reader& reader) {
+ss::future<> kvstore::load_key_space_snapshots() {
+    for (auto ks : all_key_spaces) {
+        _gate.check(); // early out on shutdown
+
+        auto snap = key_space_snapshot(ks);
+        auto reader = co_await snap.open_snapshot();
+        if (!reader) {
+            continue;
+        }
+        _has_key_space_snapshots = true;
+
+        std::exception_ptr ex;
+        try {
+            co_await load_snapshot_from_reader(reader.value(), ks);
+        } catch (...) {
+            ex = std::current_exception();
+        }
+
+        co_await reader->close();
+        if (ex) {
+            throw ex;
+        }
+    }
+
+    for (const auto& [ks, offset] : _snapshot_offsets) {
+        _next_offset = std::max(_next_offset, offset + model::offset(1));
+    }
+}
+
+ss::future<> kvstore::load_snapshot_from_reader(
+  snapshot_reader& reader, std::optional<key_space> snapshot_key_space) {
     // the snapshot metadata contains the last offset represented
     auto snap_meta = co_await reader.read_metadata();
     iobuf_parser parser(std::move(snap_meta));
@@ -444,9 +672,30 @@ ss::future<> kvstore::load_snapshot_from_reader(snapshot_reader& reader) {
       reflection::adl<model::offset::type>{}.from(parser));
     vlog(
       lg.debug,
-      "Load snapshot: loading snapshot with last offset {}",
+      "Load snapshot: loading snapshot {} with last offset {}",
+      snapshot_key_space ? static_cast<int>(*snapshot_key_space) : -1,
       last_offset);
 
+    auto lock = co_await _db_mut.get_units();
+    if (snapshot_key_space) {
+        // the legacy snapshot may be newer if this key space wasn't written
+        // since it was taken, otherwise this snapshot replaces its content.
+        auto it = _snapshot_offsets.find(*snapshot_key_space);
+        if (it != _snapshot_offsets.end() && it->second >= last_offset) {
+            co_return;
+        }
+        for (auto entry = _db.begin(); entry != _db.end();) {
+            if (key_space_of(entry->first) != *snapshot_key_space) {
+                ++entry;
+                continue;
+            }
+            _probe.dec_cached_bytes(
+              entry->first.size() + entry->second.size_bytes());
+            _probe.dec_cached_capacity_bytes(entry->second.capacity_bytes());
+            _db.erase(entry++);
+        }
+    }
+
     // read and restore db from snapshot
     auto buf = co_await read_iobuf_exactly(reader.input(), sizeof(int32_t));
     if (buf.size_bytes() != sizeof(int32_t)) {
@@ -482,22 +731,40 @@ ss::future<> kvstore::load_snapshot_from_reader(snapshot_reader& reader) {
           batch.header().header_crc));
     }
 
-    auto lock = co_await _db_mut.get_units();
-    _db.reserve(batch.header().record_count);
-    co_await batch.for_each_record_async([this](model::record r) {
-        auto key = iobuf_to_bytes(r.release_key());
-        _probe.add_cached_bytes(key.size() + r.value().size_bytes());
-        auto res = _db.emplace(std::move(key), r.release_value());
-        vassert(
-          res.second, "Snapshot contained duplicate key {}", res.first->first);
-        vlog(
-          lg.trace,
-          "Load snapshot: restoring key={} value={}",
-          res.first->first,
-          res.first->second);
-    });
+    _db.reserve(_db.size() + batch.header().record_count);
+    co_await batch.for_each_record_async(
+      [this, snapshot_key_space](model::record r) {
+          auto key = iobuf_to_bytes(r.release_key());
+          vassert(
+            !snapshot_key_space || key_space_of(key) == *snapshot_key_space,
+            "Snapshot of key space {} contained key {}",
+            static_cast<int>(*snapshot_key_space),
+            key);
+          // the value shares the buffers the snapshot was read into, copy it
+          // so that they are freed once the snapshot is loaded
+          auto value = r.value().copy();
+          _probe.add_cached_bytes(key.size() + value.size_bytes());
+          _probe.add_cached_capacity_bytes(value.capacity_bytes());
+          auto res = _db.emplace(std::move(key), std::move(value));
+          vassert(
+            res.second,
+            "Snapshot contained duplicate key {}",
+            res.first->first);
+          vlog(
+            lg.trace,
+            "Load snapshot: restoring key={} value={}",
+            res.first->first,
+            res.first->second);
+      });
 
-    _next_offset = last_offset + model::offset(1);
+    if (snapshot_key_space) {
+        _snapshot_offsets[*snapshot_key_space] = last_offset;
+    } else {
+        for (auto ks : all_key_spaces) {
+            _snapshot_offsets[ks] = last_offset;
+        }
+        _next_offset = last_offset + model::offset(1);
+    }
 }
 
 ss::future<> kvstore::replay_segments(segment_set segs) {
@@ -511,25 +778,39 @@ ss::future<> kvstore::replay_segments(segment_set segs) {
         co_return;
     }
 
-    // find segment that starts at _next_offset
+    // records up to the oldest snapshot are contained in every snapshot.
+    // with a single snapshot this is _next_offset - 1. key space snapshots
+    // may be older when the key space hasn't been written since.
+    std::optional<model::offset> covered;
+    for (const auto& [ks, offset] : _snapshot_offsets) {
+        covered = std::min(covered.value_or(offset), offset);
+    }
+
+    // find the first segment with records not contained in every snapshot.
+    // records of a key space that its snapshot contains are skipped by the
+    // replay consumer.
     const auto match = std::find_if(
-      segs.begin(), segs.end(), [this](const ss::lw_shared_ptr<segment>& seg) {
-          return seg->offsets().base_offset == _next_offset;
+      segs.begin(),
+      segs.end(),
+      [covered](const ss::lw_shared_ptr<segment>& seg) {
+          return !covered || seg->offsets().dirty_offset > *covered;
       });
 
-    // we didn't find an exact match, and the last segment starts after
-    // _next_offset. this is unrecoverable. it's effectively a hole in the
-    // log.
+    // the segment starts after _next_offset. this is unrecoverable. it's
+    // effectively a hole in the log.
     if (
-      match == segs.end()
-      && segs.back()->offsets().base_offset > _next_offset) {
+      match != segs.end() && (*match)->offsets().base_offset > _next_offset) {
         throw std::runtime_error(
           fmt::format("Segment starting at offset {} not found", _next_offset));
     }
 
-    // if no exact match was found (match == segs.end()) then all the
-    // segments are old and can be deleted. the recovery loop below will be
-    // skipped, and we'll immediately gc the old segments.
+    // if no segment matched (match == segs.end()) then all the segments are
+    // old and can be deleted. the recovery loop below will be skipped, and
+    // we'll immediately gc the old segments.
+    const auto snapshot_next_offset = _next_offset;
+    if (match != segs.end()) {
+        _next_offset = (*match)->offsets().base_offset;
+    }
 
     for (auto it = match; it != segs.end(); it++) {
         auto seg = *it;
@@ -557,6 +838,7 @@ ss::future<> kvstore::replay_segments(segment_set segs) {
         // we ensure the entire recovery process is halted.
         _gate.check();
     }
+    _next_offset = std::max(_next_offset, snapshot_next_offset);
 
     // garbage collect range: [segs.begin(), match)
     for (auto it = segs.begin(); it != match; it++) {
@@ -632,9 +914,20 @@ kvstore::replay_consumer::consume_batch_end() {
     auto lock = co_await _store->_db_mut.get_units();
     co_await batch.for_each_record_async([this, &lock](model::record r) {
         auto key = iobuf_to_bytes(r.release_key());
-        auto value = reflection::from_iobuf<std::optional<iobuf>>(
-          r.release_value());
-        _store->apply_op(std::move(key), std::move(value), lock);
+        // skip records the key space's snapshot already contains
+        auto snap = _store->_snapshot_offsets.find(key_space_of(key));
+        if (
+          snap == _store->_snapshot_offsets.end()
+          || _store->_next_offset > snap->second) {
+            auto value = reflection::from_iobuf<std::optional<iobuf>>(
+              r.release_value());
+            if (value) {
+                // do not pin the segment read buffers for as long as the key
+                // is held
+                value = value->copy();
+            }
+            _store->apply_op(std::move(key), std::move(value), lock);
+        }
         _store->_next_offset += model::offset(1);
     });
 
@@ -658,6 +951,10 @@ ss::future<usage_report> kvstore::disk_usage() const {
         report.usage = co_await _segment->persistent_size();
     }
     report.usage.data += (co_await _snap.size()).value_or(0);
+    for (auto ks : all_key_spaces) {
+        auto snap = key_space_snapshot(ks);
+        report.usage.data += (co_await snap.size()).value_or(0);
+    }
 
     // kvstore doesn't have on-demand reclaimable data (yet) so the default
     // reclaim limits of 0 in the report are correct.
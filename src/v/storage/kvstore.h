@@ -26,6 +26,8 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/timer.hh>
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 #include <absl/container/node_hash_map.h>
 
 namespace storage {
@@ -50,6 +52,22 @@ namespace storage {
  * flushed to disk. Once the flush is complete the operations are applied to the
  * in-memory cache, and the associated promise is resolved.
  *
+ * Several mutations can be submitted together with put_many() and
+ * remove_many(); they are flushed as part of the same batch and complete with
+ * a single future. Within a commit interval writes are combined: when a key is
+ * written more than once only its last value is logged.
+ *
+ * Snapshots
+ * =========
+ *
+ * When the active segment fills up the database is snapshotted and the
+ * segment removed, which bounds the log replayed on startup. With the
+ * kvstore_incremental_snapshots feature each key space has its own snapshot
+ * file and only the key spaces written since their last snapshot are saved
+ * again. On recovery every key space is restored from the newest snapshot
+ * that covers it and the remaining log is replayed, skipping the records
+ * that key space's snapshot already contains.
+ *
  * Concurrency
  * ===========
  *
@@ -99,7 +117,7 @@ public:
         offset_translator = 4,
         usage = 5,
         stms = 6,
-        /* your sub-system here */
+        /* your sub-system here, and in all_key_spaces */
     };
 
     explicit kvstore(
@@ -111,10 +129,22 @@ public:
     ss::future<> start();
     ss::future<> stop();
 
+    /**
+     * A single mutation for put_many(). A std::nullopt value is a deletion.
+     */
+    struct key_value {
+        bytes key;
+        std::optional<iobuf> value;
+    };
+
     std::optional<iobuf> get(key_space ks, bytes_view key);
     ss::future<> put(key_space ks, bytes key, iobuf value);
     ss::future<> remove(key_space ks, bytes key);
 
+    /// Apply all mutations as part of the same flush, in order.
+    ss::future<> put_many(key_space ks, std::vector<key_value> kvs);
+    ss::future<> remove_many(key_space ks, std::vector<bytes> keys);
+
     bool empty() const {
         vassert(_started, "kvstore has not been started");
         return _db.empty();
@@ -139,12 +169,13 @@ private:
     bool _started{false};
 
     /**
-     * Database operation. A std::nullopt value is a deletion.
+     * Database operation. A std::nullopt value is a deletion. Only the last
+     * operation of a put_many() carries a promise.
      */
     struct op {
         bytes key;
         std::optional<iobuf> value;
-        ss::promise<> done;
+        std::optional<ss::promise<>> done;
 
         op(bytes&& key, std::optional<iobuf>&& value)
           : key(std::move(key))
@@ -167,12 +198,27 @@ private:
     absl::node_hash_map<bytes, iobuf, bytes_type_hash, bytes_type_eq> _db;
     std::optional<ntp_sanitizer_config> _ntp_sanitizer_config;
 
+    // key spaces written since their last snapshot
+    absl::flat_hash_set<key_space> _dirty_key_spaces;
+    // last offset contained in the snapshot of each key space, only used
+    // while recovering
+    absl::flat_hash_map<key_space, model::offset> _snapshot_offsets;
+    // set once a per key space snapshot exists, after that the legacy full
+    // snapshot is no longer written
+    bool _has_key_space_snapshots{false};
+
     ss::future<> put(key_space ks, bytes key, std::optional<iobuf> value);
+    ss::future<> enqueue(key_space ks, std::vector<key_value> kvs);
     void apply_op(
       bytes key, std::optional<iobuf> value, ssx::semaphore_units const&);
     ss::future<> flush_and_apply_ops();
     ss::future<> roll();
     ss::future<> save_snapshot();
+    ss::future<> save_key_space_snapshots();
+    ss::future<> write_snapshot(
+      simple_snapshot_manager&, model::record_batch, model::offset last_offset);
+    simple_snapshot_manager key_space_snapshot(key_space) const;
+    bool use_key_space_snapshots() const;
 
     /*
      * Recovery
@@ -182,7 +228,9 @@ private:
      */
     ss::future<> recover();
     ss::future<> load_snapshot();
-    ss::future<> load_snapshot_from_reader(snapshot_reader&);
+    ss::future<> load_key_space_snapshots();
+    ss::future<> load_snapshot_from_reader(
+      snapshot_reader&, std::optional<key_space> snapshot_key_space);
     ss::future<> replay_segments(segment_set);
 
     /**
@@ -222,12 +270,27 @@ private:
         void entry_removed() { ++entries_removed; }
         void add_cached_bytes(size_t count) { cached_bytes += count; }
         void dec_cached_bytes(size_t count) { cached_bytes -= count; }
+        void add_cached_capacity_bytes(size_t count) {
+            cached_capacity_bytes += count;
+        }
+        void dec_cached_capacity_bytes(size_t count) {
+            cached_capacity_bytes -= count;
+        }
+        void flushed(size_t ops, size_t combined) {
+            ++flushes;
+            ops_flushed += ops;
+            ops_combined += combined;
+        }
 
         uint64_t segments_rolled{0};
         uint64_t entries_fetched{0};
         uint64_t entries_written{0};
         uint64_t entries_removed{0};
         size_t cached_bytes{0};
+        size_t cached_capacity_bytes{0};
+        uint64_t flushes{0};
+        uint64_t ops_flushed{0};
+        uint64_t ops_combined{0};
 
         metrics::internal_metric_groups metrics;
     };
@@ -27,6 +27,9 @@ struct log_housekeeping_meta {
     ss::shared_ptr<log> handle;
     bitflags flags{bitflags::none};
     ss::lowres_clock::time_point last_compaction;
+    // compaction backlog relative to the log size, used to prioritize
+    // compaction. refreshed at the start of each housekeeping scan.
+    double dirty_ratio{0};
 
     intrusive_list_hook link;
 };
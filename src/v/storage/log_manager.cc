@@ -21,6 +21,7 @@
 #include "ssx/async-clear.h"
 #include "ssx/future-util.h"
 #include "storage/batch_cache.h"
+#include "storage/chunk_cache.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/disk_log_impl.h"
 #include "storage/file_sanitizer.h"
@@ -58,6 +59,7 @@
 #include <seastar/util/file.hh>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/range/irange.hpp>
 #include <fmt/format.h>
 
 #include <chrono>
@@ -170,6 +172,8 @@ ss::future<> log_manager::clean_close(ss::shared_ptr<storage::log> log) {
 }
 
 ss::future<> log_manager::start() {
+    _batch_cache.setup_metrics();
+    _chunk_cache_probe.setup_metrics(internal::chunks());
     if (unlikely(config::shard_local_cfg()
                    .log_disable_housekeeping_for_tests.value())) {
         co_return;
@@ -189,11 +193,11 @@ ss::future<> log_manager::stop() {
       });
     co_await _batch_cache.stop();
     co_await ssx::async_clear(_logs)();
-    if (_compaction_hash_key_map) {
-        // Clear memory used for the compaction hash map, if any.
-        co_await _compaction_hash_key_map->initialize(0);
-        _compaction_hash_key_map.reset();
+    // Clear memory used for the compaction hash maps, if any.
+    for (auto& map : _compaction_hash_key_maps) {
+        co_await map->initialize(0);
     }
+    _compaction_hash_key_maps.clear();
 }
 
 /**
@@ -242,16 +246,59 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
         co_await current_log.handle->apply_segment_ms();
     }
 
+    const size_t concurrency
+      = config::shard_local_cfg().log_compaction_max_concurrency();
     if (
       config::shard_local_cfg().log_compaction_use_sliding_window.value()
-      && !_compaction_hash_key_map && !_logs_list.empty()
+      && _compaction_hash_key_maps.empty() && !_logs_list.empty()
       && is_not_set(_logs_list.front().flags, bflags::compacted)) {
         auto compaction_mem_bytes
-          = memory_groups().compaction_reserved_memory();
-        auto compaction_map = std::make_unique<hash_key_offset_map>();
-        co_await compaction_map->initialize(compaction_mem_bytes);
-        _compaction_hash_key_map = std::move(compaction_map);
+          = memory_groups().compaction_reserved_memory() / concurrency;
+        for (size_t i = 0; i < concurrency; ++i) {
+            auto compaction_map = std::make_unique<hash_key_offset_map>();
+            co_await compaction_map->initialize(compaction_mem_bytes);
+            _compaction_hash_key_maps.push_back(std::move(compaction_map));
+        }
+    }
+
+    prioritize_compaction();
+
+    // The compaction priority class (whose shares are managed by the
+    // compaction backlog controller) is shared by all workers, bounding the
+    // disk bandwidth of concurrent compactions.
+    co_await ss::coroutine::parallel_for_each(
+      boost::irange<size_t>(0, concurrency),
+      [this, collection_threshold](size_t i) {
+          return compaction_worker(
+            collection_threshold,
+            i < _compaction_hash_key_maps.size()
+              ? _compaction_hash_key_maps[i].get()
+              : nullptr);
+      });
+}
+
+void log_manager::prioritize_compaction() {
+    for (auto& log_meta : _logs_list) {
+        const auto size = log_meta.handle->size_bytes();
+        const auto backlog = log_meta.handle->compaction_backlog();
+        log_meta.dirty_ratio = size == 0 ? 0.0
+                                         : static_cast<double>(backlog)
+                                             / static_cast<double>(size);
     }
+    _logs_list.sort(
+      [](const log_housekeeping_meta& a, const log_housekeeping_meta& b) {
+          return a.dirty_ratio > b.dirty_ratio;
+      });
+}
+
+ss::future<> log_manager::compaction_worker(
+  model::timestamp collection_threshold, hash_key_offset_map* key_map) {
+    using bflags = log_housekeeping_meta::bitflags;
+
+    static constexpr auto is_not_set = [](bflags var, auto flag) {
+        return (var & flag) != flag;
+    };
+
     while (!_logs_list.empty()
            && is_not_set(_logs_list.front().flags, bflags::compacted)) {
         if (_abort_source.abort_requested()) {
@@ -277,7 +324,7 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
           _config.compaction_priority,
           _abort_source,
           std::move(ntp_sanitizer_cfg),
-          _compaction_hash_key_map.get()));
+          key_map));
 
         // bail out of compaction early in order to get back to gc
         if (_gc_triggered) {
@@ -266,6 +266,18 @@ private:
 
     ss::future<> housekeeping_scan(model::timestamp);
 
+    /*
+     * Worker draining the logs not yet compacted in the current housekeeping
+     * scan. Several workers may run concurrently, each with its own key map.
+     */
+    ss::future<> compaction_worker(model::timestamp, hash_key_offset_map*);
+
+    /*
+     * Order _logs_list so that logs with the most compaction work relative to
+     * their size are visited first.
+     */
+    void prioritize_compaction();
+
     log_config _config;
     kvstore& _kvstore;
     storage_resources& _resources;
@@ -275,10 +287,12 @@ private:
     logs_type _logs;
     compaction_list_type _logs_list;
     batch_cache _batch_cache;
+    chunk_cache_probe _chunk_cache_probe;
 
-    // Hash key-map to use across multiple compactions to reuse reserved memory
-    // rather than reallocating repeatedly.
-    std::unique_ptr<hash_key_offset_map> _compaction_hash_key_map;
+    // Hash key-maps to use across multiple compactions to reuse reserved
+    // memory rather than reallocating repeatedly. One per concurrent
+    // compaction, splitting the reserved memory evenly.
+    std::vector<std::unique_ptr<hash_key_offset_map>> _compaction_hash_key_maps;
     ss::gate _open_gate;
     ss::abort_source _abort_source;
 
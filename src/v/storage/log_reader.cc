@@ -125,17 +125,35 @@ void skipping_consumer::print(std::ostream& os) const {
 }
 
 log_segment_batch_reader::log_segment_batch_reader(
-  segment& seg, log_reader_config& config, probe& p) noexcept
+  segment& seg,
+  log_reader_config& config,
+  probe& p,
+  unsigned sequential_reads) noexcept
   : _seg(seg)
   , _config(config)
-  , _probe(p) {}
+  , _probe(p)
+  , _sequential_reads(sequential_reads) {}
+
+unsigned log_segment_batch_reader::read_ahead_target() const {
+    /*
+     * a fresh reader is as likely to be a one-off random read as the start of
+     * a long scan, so it starts with a single read-ahead buffer. the amount of
+     * read-ahead doubles with each sequential read up to the configured limit.
+     */
+    static constexpr unsigned max_shift = 16;
+    const auto limit = _seg.reader().read_ahead();
+    const auto target = 1U << std::min(_sequential_reads, max_shift);
+    return std::min(limit, target);
+}
 
 ss::future<std::unique_ptr<continuous_batch_parser>>
 log_segment_batch_reader::initialize(
   model::timeout_clock::time_point timeout,
   std::optional<model::offset> next_cached_batch) {
+    _readahead = _seg.resources().take_readahead(
+      read_ahead_target(), _seg.reader().buffer_size());
     auto input = co_await _seg.offset_data_stream(
-      _config.start_offset, _config.prio);
+      _config.start_offset, _config.prio, _readahead.read_ahead);
     co_return std::make_unique<continuous_batch_parser>(
       std::make_unique<skipping_consumer>(*this, timeout, next_cached_batch),
       std::move(input));
@@ -143,7 +161,7 @@ log_segment_batch_reader::initialize(
 
 ss::future<> log_segment_batch_reader::close() {
     if (_iterator) {
-        return _iterator->close();
+        return _iterator->close().finally([this] { _readahead = {}; });
     }
 
     return ss::make_ready_future<>();
@@ -158,7 +176,7 @@ void log_segment_batch_reader::add_one(model::record_batch&& batch) {
     _state.buffer_size += size_bytes;
     _probe.add_bytes_read(size_bytes);
     if (!_config.skip_batch_cache) {
-        _seg.cache_put(b);
+        _seg.cache_put_if_admitted(b);
     }
 }
 ss::future<result<records_t>>
@@ -263,8 +281,10 @@ ss::future<> log_reader::find_next_valid_iterator() {
         }
     }
     if (_iterator.next_seg != _lease->range.end()) {
+        // continuing into the next segment is a sequential read
+        ++_sequential_reads;
         _iterator.reader = std::make_unique<log_segment_batch_reader>(
-          **_iterator.next_seg, _config, _probe);
+          **_iterator.next_seg, _config, _probe, _sequential_reads);
         _iterator.current_reader_seg = _iterator.next_seg;
     }
     if (tmp_reader) {
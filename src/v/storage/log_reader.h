@@ -19,6 +19,7 @@
 #include "storage/probe.h"
 #include "storage/segment.h"
 #include "storage/segment_set.h"
+#include "storage/storage_resources.h"
 #include "storage/types.h"
 
 #include <seastar/core/circular_buffer.hh>
@@ -90,8 +91,16 @@ class log_segment_batch_reader {
 public:
     static constexpr size_t max_buffer_size = 32 * 1024; // 32KB
 
+    /**
+     * \p sequential_reads is the number of reads the owning log_reader has
+     * served back-to-back before this one. It is used to scale the read-ahead
+     * of the segment data stream.
+     */
     log_segment_batch_reader(
-      segment&, log_reader_config& config, probe& p) noexcept;
+      segment&,
+      log_reader_config& config,
+      probe& p,
+      unsigned sequential_reads = 0) noexcept;
     log_segment_batch_reader(log_segment_batch_reader&&) noexcept = default;
     log_segment_batch_reader& operator=(log_segment_batch_reader&&) noexcept
       = delete;
@@ -112,6 +121,9 @@ private:
 
     void add_one(model::record_batch&&);
 
+    /// number of read-ahead buffers to request for the data stream
+    unsigned read_ahead_target() const;
+
 private:
     struct tmp_state {
         ss::circular_buffer<model::record_batch> buffer;
@@ -125,6 +137,8 @@ private:
 
     std::unique_ptr<continuous_batch_parser> _iterator;
     tmp_state _state;
+    unsigned _sequential_reads;
+    storage_resources::readahead_units _readahead;
     friend class skipping_consumer;
 };
 
@@ -167,6 +181,9 @@ public:
     void reset_config(log_reader_config cfg) {
         _config = cfg;
         _iterator.next_seg = _iterator.current_reader_seg;
+        // readers are only reused for reads that continue exactly where the
+        // previous read stopped, so reuse implies sequential access.
+        ++_sequential_reads;
     };
 
     /**
@@ -176,6 +193,13 @@ public:
      */
     model::offset next_read_lower_bound() const { return _config.start_offset; }
 
+    /**
+     * Session of the last read made with this reader, if any.
+     */
+    const opt_reader_session_t& reader_session() const {
+        return _config.reader_session;
+    }
+
     /**
      * Base offset of first locked segment in read lock lease
      */
@@ -232,6 +256,7 @@ private:
     iterator_pair _iterator;
     log_reader_config _config;
     model::offset _last_base;
+    unsigned _sequential_reads{0};
     probe& _probe;
     ss::abort_source::subscription _as_sub;
 };
@@ -103,7 +103,7 @@ ss::future<result<offset_to_file_pos_result>> convert_begin_offset_to_file_pos(
   model::timestamp base_timestamp,
   ss::io_priority_class io_priority,
   should_fail_on_missing_offset fail_on_missing_offset) {
-    auto ix_begin = segment->index().find_nearest(begin_inclusive);
+    auto ix_begin = co_await segment->index().fetch_nearest(begin_inclusive);
     size_t scan_from = ix_begin ? ix_begin->filepos : 0;
     model::offset sto = ix_begin ? ix_begin->offset
                                  : segment->offsets().base_offset;
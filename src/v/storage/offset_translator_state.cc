@@ -13,6 +13,7 @@
 
 #include "model/fundamental.h"
 #include "storage/logger.h"
+#include "utils/delta_for.h"
 #include "vassert.h"
 #include "vlog.h"
 
@@ -351,9 +352,90 @@ struct persisted_batches_map
     std::vector<persisted_batch> batches;
 };
 
+/// Columnar form of persisted_batches_map. Base offsets are increasing and
+/// lengths are mostly 1 for control batches, so both encode to a few bits per
+/// batch. The last row of each column is padded with copies of the last value.
+struct compact_persisted_batches_map
+  : serde::envelope<
+      compact_persisted_batches_map,
+      serde::version<1>,
+      serde::compat_version<1>> {
+    using base_offset_encoder_t
+      = deltafor_encoder<int64_t, details::delta_delta<int64_t>>;
+    using base_offset_decoder_t
+      = deltafor_decoder<int64_t, details::delta_delta<int64_t>>;
+    using length_encoder_t = deltafor_encoder<int64_t, details::delta_xor>;
+    using length_decoder_t = deltafor_decoder<int64_t, details::delta_xor>;
+    static constexpr size_t row_width = details::FOR_buffer_depth;
+
+    int64_t start_delta = 0;
+    uint32_t batch_count = 0;
+    int64_t first_base_offset = 0;
+    iobuf base_offsets;
+    iobuf lengths;
+
+    static compact_persisted_batches_map
+    encode(int64_t start_delta, const std::vector<persisted_batch>& batches) {
+        const int64_t first = batches.empty()
+                                ? 0
+                                : batches.front().base_offset();
+        base_offset_encoder_t base_offsets(first);
+        length_encoder_t lengths(0);
+        std::array<int64_t, row_width> offset_row{};
+        std::array<int64_t, row_width> length_row{};
+        for (size_t i = 0; i < batches.size(); i += row_width) {
+            for (size_t j = 0; j < row_width; ++j) {
+                const auto& b = batches[std::min(i + j, batches.size() - 1)];
+                offset_row[j] = b.base_offset();
+                length_row[j] = b.length;
+            }
+            base_offsets.add(offset_row);
+            lengths.add(length_row);
+        }
+        return compact_persisted_batches_map{
+          .start_delta = start_delta,
+          .batch_count = static_cast<uint32_t>(batches.size()),
+          .first_base_offset = first,
+          .base_offsets = base_offsets.copy(),
+          .lengths = lengths.copy(),
+        };
+    }
+
+    std::vector<persisted_batch> decode() && {
+        const uint32_t rows = (batch_count + row_width - 1) / row_width;
+        base_offset_decoder_t offsets_dec(
+          first_base_offset, rows, std::move(base_offsets));
+        length_decoder_t lengths_dec(0, rows, std::move(lengths));
+        std::vector<persisted_batch> batches;
+        batches.reserve(batch_count);
+        std::array<int64_t, row_width> offset_row{};
+        std::array<int64_t, row_width> length_row{};
+        while (offsets_dec.read(offset_row) && lengths_dec.read(length_row)) {
+            for (size_t j = 0; j < row_width && batches.size() < batch_count;
+                 ++j) {
+                batches.push_back(persisted_batch{
+                  .base_offset = model::offset(offset_row[j]),
+                  .length = static_cast<int32_t>(length_row[j])});
+            }
+        }
+        return batches;
+    }
+};
+
+/// Both formats start with the serde envelope header, the first byte of which
+/// is the version.
+bool is_compact_persisted_map(const iobuf& buf) {
+    if (buf.empty()) {
+        return false;
+    }
+    iobuf_const_parser parser(buf);
+    return parser.consume_type<uint8_t>()
+           >= compact_persisted_batches_map::redpanda_serde_version;
+}
+
 } // namespace
 
-iobuf offset_translator_state::serialize_map() const {
+iobuf offset_translator_state::serialize_map(bool compact) const {
     vassert(
       !_last_offset2batch.empty(),
       "ntp {}: offsets map shouldn't be empty",
@@ -367,8 +449,14 @@ iobuf offset_translator_state::serialize_map() const {
           persisted_batch{.base_offset = b.base_offset, .length = length});
     }
 
+    const auto start_delta = _last_offset2batch.begin()->second.next_delta;
+    if (compact) {
+        return serde::to_iobuf(
+          compact_persisted_batches_map::encode(start_delta, batches));
+    }
+
     persisted_batches_map persisted{
-      .start_delta = _last_offset2batch.begin()->second.next_delta,
+      .start_delta = start_delta,
       .batches = std::move(batches),
     };
 
@@ -377,7 +465,15 @@ iobuf offset_translator_state::serialize_map() const {
 
 offset_translator_state
 offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
-    auto persisted = serde::from_iobuf<persisted_batches_map>(std::move(buf));
+    persisted_batches_map persisted;
+    if (is_compact_persisted_map(buf)) {
+        auto compact = serde::from_iobuf<compact_persisted_batches_map>(
+          std::move(buf));
+        persisted.start_delta = compact.start_delta;
+        persisted.batches = std::move(compact).decode();
+    } else {
+        persisted = serde::from_iobuf<persisted_batches_map>(std::move(buf));
+    }
     if (persisted.batches.empty()) {
         throw std::runtime_error{fmt::format(
           "ntp {}: persisted offset translator map shouldn't be empty", ntp)};
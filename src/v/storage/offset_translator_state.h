@@ -92,7 +92,11 @@ public:
     /// changed.
     bool prefix_truncate(model::offset);
 
-    iobuf serialize_map() const;
+    /// Serialize the map for persisting. The compact encoding stores the
+    /// offsets and lengths of the batches as delta-FOR encoded columns, it
+    /// can only be read by versions with the compact_offset_translator_map
+    /// feature.
+    iobuf serialize_map(bool compact = false) const;
     static offset_translator_state
     from_serialized_map(model::ntp ntp, iobuf buf);
 
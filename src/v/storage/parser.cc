@@ -12,6 +12,7 @@
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
 #include "bytes/iostream.h"
+#include "hashing/crc32c.h"
 #include "likely.h"
 #include "model/record.h"
 #include "model/record_utils.h"
@@ -36,47 +37,79 @@
 namespace storage {
 using stop_parser = batch_consumer::stop_parser;
 
-static model::record_batch_header header_from_iobuf(iobuf b) {
-    iobuf_parser parser(std::move(b));
-    auto header_crc = reflection::adl<uint32_t>{}.from(parser);
-    auto sz = reflection::adl<int32_t>{}.from(parser);
+/*
+ * The on-disk header is the packed little-endian encoding of its fields, in
+ * declaration order. The header only crc covers every field after the crc
+ * itself, so it is computed in one pass over the raw bytes instead of being
+ * re-encoded field by field from the parsed header.
+ */
+namespace header_layout {
+static constexpr size_t header_crc = 0;
+static constexpr size_t size_bytes = header_crc + sizeof(uint32_t);
+static constexpr size_t base_offset = size_bytes + sizeof(int32_t);
+static constexpr size_t type = base_offset + sizeof(model::offset::type);
+static constexpr size_t crc = type + sizeof(model::record_batch_type);
+static constexpr size_t attrs = crc + sizeof(int32_t);
+static constexpr size_t last_offset_delta
+  = attrs + sizeof(model::record_batch_attributes::type);
+static constexpr size_t first_timestamp = last_offset_delta + sizeof(int32_t);
+static constexpr size_t max_timestamp
+  = first_timestamp + sizeof(model::timestamp::type);
+static constexpr size_t producer_id
+  = max_timestamp + sizeof(model::timestamp::type);
+static constexpr size_t producer_epoch = producer_id + sizeof(int64_t);
+static constexpr size_t base_sequence = producer_epoch + sizeof(int16_t);
+static constexpr size_t record_count = base_sequence + sizeof(int32_t);
+static constexpr size_t end = record_count + sizeof(int32_t);
+static_assert(
+  end == model::packed_record_batch_header_size,
+  "header layout must match the packed header size");
+} // namespace header_layout
+
+template<typename T>
+static T read_header_field(const char* data, size_t pos) {
+    return ss::read_le<T>(data + pos);
+}
+
+static model::record_batch_header header_from_buffer(const char* data) {
+    namespace hl = header_layout;
     using offset_t = model::offset::type;
-    auto off = model::offset(reflection::adl<offset_t>{}.from(parser));
-    auto type = reflection::adl<model::record_batch_type>{}.from(parser);
-    auto crc = reflection::adl<int32_t>{}.from(parser);
+    using type_t = std::underlying_type_t<model::record_batch_type>;
     using attr_t = model::record_batch_attributes::type;
-    auto attrs = model::record_batch_attributes(
-      reflection::adl<attr_t>{}.from(parser));
-    auto delta = reflection::adl<int32_t>{}.from(parser);
     using tmstmp_t = model::timestamp::type;
-    auto first = model::timestamp(reflection::adl<tmstmp_t>{}.from(parser));
-    auto max = model::timestamp(reflection::adl<tmstmp_t>{}.from(parser));
-    auto producer_id = reflection::adl<int64_t>{}.from(parser);
-    auto producer_epoch = reflection::adl<int16_t>{}.from(parser);
-    auto base_sequence = reflection::adl<int32_t>{}.from(parser);
-    auto record_count = reflection::adl<int32_t>{}.from(parser);
-    vassert(
-      parser.bytes_consumed() == model::packed_record_batch_header_size,
-      "Error in header parsing. Must consume:{} bytes, but consumed:{}",
-      model::packed_record_batch_header_size,
-      parser.bytes_consumed());
     auto hdr = model::record_batch_header{
-      .header_crc = header_crc,
-      .size_bytes = sz,
-      .base_offset = off,
-      .type = type,
-      .crc = crc,
-      .attrs = attrs,
-      .last_offset_delta = delta,
-      .first_timestamp = first,
-      .max_timestamp = max,
-      .producer_id = producer_id,
-      .producer_epoch = producer_epoch,
-      .base_sequence = base_sequence,
-      .record_count = record_count};
+      .header_crc = read_header_field<uint32_t>(data, hl::header_crc),
+      .size_bytes = read_header_field<int32_t>(data, hl::size_bytes),
+      .base_offset = model::offset(
+        read_header_field<offset_t>(data, hl::base_offset)),
+      .type = model::record_batch_type(
+        read_header_field<type_t>(data, hl::type)),
+      .crc = read_header_field<int32_t>(data, hl::crc),
+      .attrs = model::record_batch_attributes(
+        read_header_field<attr_t>(data, hl::attrs)),
+      .last_offset_delta = read_header_field<int32_t>(
+        data, hl::last_offset_delta),
+      .first_timestamp = model::timestamp(
+        read_header_field<tmstmp_t>(data, hl::first_timestamp)),
+      .max_timestamp = model::timestamp(
+        read_header_field<tmstmp_t>(data, hl::max_timestamp)),
+      .producer_id = read_header_field<int64_t>(data, hl::producer_id),
+      .producer_epoch = read_header_field<int16_t>(data, hl::producer_epoch),
+      .base_sequence = read_header_field<int32_t>(data, hl::base_sequence),
+      .record_count = read_header_field<int32_t>(data, hl::record_count)};
     hdr.ctx.owner_shard = ss::this_shard_id();
     return hdr;
 }
+
+/// equivalent to model::internal_header_only_crc() of the parsed header
+static uint32_t header_only_crc_from_buffer(const char* data) {
+    auto c = crc::crc32c();
+    c.extend(
+      data + header_layout::size_bytes,
+      header_layout::end - header_layout::size_bytes);
+    return c.value();
+}
+
 // make sure that `msg` parameter is a static string or it is not removed before
 // this function finishes
 static ss::future<result<iobuf>> verify_read_iobuf(
@@ -156,39 +189,41 @@ static ss::future<result<model::record_batch_header>> read_header_impl(
   ss::input_stream<char>& input,
   const Consumer& consumer,
   bool recovery = false) {
-    auto b = co_await read_iobuf_exactly(
-      input, model::packed_record_batch_header_size);
+    // the header is small and almost always contiguous in the stream's
+    // buffer, in which case read_exactly shares it without copying
+    auto b = co_await input.read_exactly(
+      model::packed_record_batch_header_size);
 
     if (b.empty()) {
         // benign outcome. happens at end of file
         co_return parser_errc::end_of_stream;
     }
-    if (b.size_bytes() != model::packed_record_batch_header_size) {
+    if (b.size() != model::packed_record_batch_header_size) {
         if (!recovery) {
             stlog.error(
               "Could not parse header. Expected:{}, but Got:{}. consumer:{}",
               model::packed_record_batch_header_size,
-              b.size_bytes(),
+              b.size(),
               consumer);
         } else {
             stlog.debug(
               "End of recovery with parse error. Expected:{}, but Got:{}. "
               "consumer:{})",
               model::packed_record_batch_header_size,
-              b.size_bytes(),
+              b.size(),
               consumer);
         }
         co_return parser_errc::input_stream_not_enough_bytes;
     }
     // check if iobuf is filled is zeros, this means that we are reading
     // fallocated range filled with zeros
-    if (unlikely(storage::internal::is_zero(b))) {
+    if (unlikely(storage::internal::is_zero(b.get(), b.size()))) {
         // happens when we fallocate the file
         co_return parser_errc::fallocated_file_read_zero_bytes_for_header;
     }
-    auto header = header_from_iobuf(std::move(b));
+    auto header = header_from_buffer(b.get());
 
-    if (auto computed_crc = model::internal_header_only_crc(header);
+    if (auto computed_crc = header_only_crc_from_buffer(b.get());
         unlikely(header.header_crc != computed_crc)) {
         if (!recovery) {
             vlog(
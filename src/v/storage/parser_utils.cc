@@ -10,15 +10,24 @@
 #include "storage/parser_utils.h"
 
 #include "compression/compression.h"
+#include "compression/stream_decompressor.h"
 #include "model/compression.h"
 #include "model/record.h"
 #include "model/record_utils.h"
 #include "reflection/adl.h"
+#include "resource_mgmt/offload_executor.h"
 #include "storage/logger.h"
+#include "utils/vint.h"
 #include "vlog.h"
 
 #include <seastar/core/byteorder.hh>
 #include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/maybe_yield.hh>
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <span>
 
 namespace storage::internal {
 
@@ -67,6 +76,72 @@ model::record_batch maybe_decompress_batch_sync(const model::record_batch& b) {
     return batch;
 }
 
+/// size of the first record of the buffer, length prefix included, or
+/// nullopt when the buffer ends before its length prefix
+static std::optional<size_t> next_record_size(const iobuf& buf) {
+    std::array<uint8_t, vint::max_length> prefix{};
+    const auto n = std::min(buf.size_bytes(), prefix.size());
+    iobuf::iterator_consumer in(buf.cbegin(), buf.cend());
+    in.consume_to(n, prefix.data());
+    const auto end = prefix.begin() + n;
+    if (std::none_of(prefix.begin(), end, [](uint8_t b) {
+            return (b & 0x80) == 0;
+        })) {
+        if (n == prefix.size()) {
+            throw std::runtime_error("Invalid record length prefix");
+        }
+        return std::nullopt;
+    }
+    auto [size, bytes] = vint::deserialize(std::span(prefix.begin(), end));
+    if (unlikely(size < 0)) {
+        throw std::runtime_error(
+          fmt::format("Invalid record length: {}", size));
+    }
+    return static_cast<size_t>(size) + bytes;
+}
+
+ss::future<> for_each_decompressed_record(
+  model::record_batch&& b,
+  ss::noncopyable_function<ss::future<>(model::record&)> f) {
+    if (unlikely(!b.compressed())) {
+        throw std::runtime_error(fmt_with_ctx(
+          fmt::format,
+          "Asked to decompressed a non-compressed batch:{}",
+          b.header()));
+    }
+    const auto header = b.header();
+    auto decompressor = compression::make_stream_decompressor(
+      std::move(b).release_data(), header.attrs.compression());
+    iobuf pending;
+    for (int32_t i = 0; i < header.record_count; ++i) {
+        auto size = next_record_size(pending);
+        while (!size || pending.size_bytes() < *size) {
+            auto chunk = decompressor->next();
+            if (chunk.empty()) {
+                throw std::runtime_error(fmt_with_ctx(
+                  fmt::format,
+                  "Batch ends after {} of its records:{}",
+                  i,
+                  header));
+            }
+            pending.append(std::move(chunk));
+            size = next_record_size(pending);
+            co_await ss::coroutine::maybe_yield();
+        }
+        iobuf_parser parser(pending.share(0, *size));
+        pending.trim_front(*size);
+        auto r = model::parse_one_record_from_buffer(parser);
+        co_await f(r);
+    }
+    if (unlikely(!pending.empty() || !decompressor->next().empty())) {
+        throw std::runtime_error(fmt_with_ctx(
+          fmt::format,
+          "Batch has data past its {} records:{}",
+          header.record_count,
+          header));
+    }
+}
+
 compress_batch_consumer::compress_batch_consumer(
   model::compression c, std::size_t threshold) noexcept
   : _compression_type(c)
@@ -108,6 +183,43 @@ compress_batch(model::compression c, model::record_batch b) {
     co_return batch;
 }
 
+ss::future<model::record_batch>
+offload_decompress_batch(model::record_batch b) {
+    if (
+      !b.compressed()
+      || static_cast<size_t>(b.size_bytes()) < offload_min_batch_size) {
+        co_return co_await decompress_batch(std::move(b));
+    }
+    // the batch is only read on the other shard, it stays alive until then
+    auto f = resources::offload_executor::local().maybe_submit(
+      [&b] { return maybe_decompress_batch_sync(b); });
+    if (!f) {
+        co_return co_await decompress_batch(std::move(b));
+    }
+    co_return co_await std::move(*f);
+}
+
+ss::future<model::record_batch>
+offload_compress_batch(model::compression c, model::record_batch b) {
+    if (
+      c == model::compression::none
+      || static_cast<size_t>(b.size_bytes()) < offload_min_batch_size) {
+        co_return co_await compress_batch(c, std::move(b));
+    }
+    auto f = resources::offload_executor::local().maybe_submit(
+      [c, &b] { return compression::compressor::compress(b.data(), c); });
+    if (!f) {
+        co_return co_await compress_batch(c, std::move(b));
+    }
+    auto payload = co_await std::move(*f);
+    auto h = b.header();
+    // compression bit must be set first!
+    h.attrs |= c;
+    reset_size_checksum_metadata(h, payload);
+    co_return model::record_batch(
+      h, std::move(payload), model::record_batch::tag_ctor_ng{});
+}
+
 /// \brief resets the size, header crc and payload crc
 void reset_size_checksum_metadata(
   model::record_batch_header& hdr, const iobuf& records) {
@@ -14,6 +14,9 @@
 #include "bytes/iobuf_parser.h"
 #include "model/record.h"
 #include "model/record_batch_reader.h"
+#include "units.h"
+
+#include <seastar/util/noncopyable_function.hh>
 
 namespace storage::internal {
 
@@ -50,10 +53,32 @@ model::record_batch decompress_batch_sync(model::record_batch&&);
 /// \throw std::runtime_error If provided batch is not compressed
 model::record_batch maybe_decompress_batch_sync(const model::record_batch&);
 
+/// \brief calls f on every record of a compressed batch, in order. Unlike
+/// decompress_batch() the payload is decompressed a chunk at a time, and
+/// only the records not yet visited of the current chunk are held: large
+/// batches do not allocate their whole decompressed size.
+/// \throw std::runtime_error If provided batch is not compressed or its
+/// records do not match its header
+ss::future<> for_each_decompressed_record(
+  model::record_batch&&,
+  ss::noncopyable_function<ss::future<>(model::record&)>);
+
 /// \brief batch compression
 ss::future<model::record_batch>
   compress_batch(model::compression, model::record_batch);
 
+/// batches from which offload_decompress_batch() and offload_compress_batch()
+/// may run on another shard
+inline constexpr size_t offload_min_batch_size = 32_KiB;
+
+/// \brief batch decompression, on a less busy shard when this shard is busy
+/// and the batch is large. See resources::offload_executor.
+ss::future<model::record_batch> offload_decompress_batch(model::record_batch);
+/// \brief batch compression, on a less busy shard when this shard is busy
+/// and the batch is large. See resources::offload_executor.
+ss::future<model::record_batch>
+  offload_compress_batch(model::compression, model::record_batch);
+
 /// \brief resets the size, header crc and payload crc
 void reset_size_checksum_metadata(model::record_batch_header&, const iobuf&);
 
@@ -11,6 +11,8 @@
 
 #include "config/configuration.h"
 #include "prometheus/prometheus_sanitize.h"
+#include "storage/batch_cache.h"
+#include "storage/chunk_cache.h"
 #include "storage/readers_cache_probe.h"
 #include "storage/segment.h"
 
@@ -168,6 +170,97 @@ void probe::setup_metrics(const model::ntp& ntp) {
       });
 }
 
+void chunk_cache_probe::setup_metrics(const internal::chunk_cache& cache) {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:chunk_cache"),
+      {
+        sm::make_gauge(
+          "available_bytes",
+          [&cache] { return cache.size_available(); },
+          sm::description("Bytes of free appender chunks held by the cache")),
+        sm::make_gauge(
+          "total_bytes",
+          [&cache] { return cache.size_total(); },
+          sm::description("Bytes of appender chunks allocated, free or in "
+                          "use")),
+        sm::make_gauge(
+          "target_bytes",
+          [&cache] { return cache.size_target(); },
+          sm::description("Bytes of free appender chunks the cache retains")),
+        sm::make_gauge(
+          "active_appenders",
+          [&cache] { return cache.active_appenders(); },
+          sm::description("Number of open segment appenders")),
+        sm::make_gauge(
+          "waiters",
+          [&cache] { return cache.waiters(); },
+          sm::description("Number of appenders waiting for a chunk")),
+        sm::make_counter(
+          "waits",
+          [&cache] { return cache.waits(); },
+          sm::description(
+            "Number of times an appender had to wait for a free chunk")),
+      });
+}
+
+void batch_cache_probe::setup_metrics(const batch_cache& cache) {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:batch_cache"),
+      {
+        sm::make_counter(
+          "hits",
+          [this] { return _cache_hits; },
+          sm::description("Number of reads served from the batch cache")),
+        sm::make_counter(
+          "misses",
+          [this] { return _cache_misses; },
+          sm::description("Number of reads not found in the batch cache")),
+        sm::make_total_bytes(
+          "inserted_bytes",
+          [this] { return _bytes_inserted; },
+          sm::description("Total number of bytes inserted into the cache")),
+        sm::make_total_bytes(
+          "evicted_bytes",
+          [this] { return _bytes_evicted; },
+          sm::description(
+            "Total number of bytes evicted from the cache by truncation, "
+            "segment close or roll")),
+        sm::make_counter(
+          "reclaims",
+          [this] { return _reclaims; },
+          sm::description("Number of memory reclaim events that released "
+                          "memory from the cache")),
+        sm::make_total_bytes(
+          "reclaimed_bytes",
+          [this] { return _bytes_reclaimed; },
+          sm::description("Total number of bytes released by memory reclaim")),
+        sm::make_counter(
+          "admission_rejects",
+          [this] { return _admission_rejects; },
+          sm::description("Number of batches read from disk that were not "
+                          "cached by the admission filter")),
+        sm::make_gauge(
+          "size_bytes",
+          [&cache] { return cache.size_bytes(); },
+          sm::description("Memory used by the batch cache")),
+        sm::make_gauge(
+          "waste_bytes",
+          [&cache] { return cache.waste_bytes(); },
+          sm::description("Memory allocated to cache ranges but not holding "
+                          "batch data")),
+      });
+}
+
 void probe::add_initial_segment(const segment& s) {
     _partition_bytes += s.file_size();
 }
@@ -213,6 +306,12 @@ void readers_cache_probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _cache_misses; },
           sm::description("Reader cache misses"),
           labels),
+        sm::make_counter(
+          "cache_session_hits",
+          [this] { return _cache_session_hits; },
+          sm::description(
+            "Reader cache hits on the reader last used by the same session"),
+          labels),
       },
       {},
       {sm::shard_label, partition_label});
@@ -49,6 +49,51 @@ private:
     metrics::public_metric_groups _public_metrics;
 };
 
+// Per-shard segment appender chunk cache probe (metrics).
+class chunk_cache_probe {
+public:
+    void setup_metrics(const internal::chunk_cache&);
+    void clear_metrics() { _metrics.clear(); }
+
+private:
+    metrics::internal_metric_groups _metrics;
+};
+
+// Per-shard batch cache probe (metrics).
+class batch_cache_probe {
+public:
+    void cache_hit() { ++_cache_hits; }
+    void cache_miss() { ++_cache_misses; }
+    void add_bytes_inserted(uint64_t bytes) { _bytes_inserted += bytes; }
+    void add_bytes_evicted(uint64_t bytes) { _bytes_evicted += bytes; }
+    void reclaimed(uint64_t bytes) {
+        ++_reclaims;
+        _bytes_reclaimed += bytes;
+    }
+    void admission_rejected() { ++_admission_rejects; }
+
+    uint64_t cache_hits() const { return _cache_hits; }
+    uint64_t cache_misses() const { return _cache_misses; }
+    uint64_t bytes_inserted() const { return _bytes_inserted; }
+    uint64_t bytes_evicted() const { return _bytes_evicted; }
+    uint64_t reclaims() const { return _reclaims; }
+    uint64_t bytes_reclaimed() const { return _bytes_reclaimed; }
+    uint64_t admission_rejects() const { return _admission_rejects; }
+
+    void setup_metrics(const batch_cache&);
+    void clear_metrics() { _metrics.clear(); }
+
+private:
+    uint64_t _cache_hits = 0;
+    uint64_t _cache_misses = 0;
+    uint64_t _bytes_inserted = 0;
+    uint64_t _bytes_evicted = 0;
+    uint64_t _reclaims = 0;
+    uint64_t _bytes_reclaimed = 0;
+    uint64_t _admission_rejects = 0;
+    metrics::internal_metric_groups _metrics;
+};
+
 // Per-NTP probe.
 class probe {
 public:
@@ -102,6 +102,7 @@ readers_cache::get_reader(const log_reader_config& cfg) {
     /**
      * We use linear search since _readers intrusive list is small.
      */
+    auto found = _readers.end();
     auto it = _readers.begin();
     while (it != _readers.end()) {
         const auto is_valid = it->reader->is_reusable() && it->valid;
@@ -114,9 +115,18 @@ readers_cache::get_reader(const log_reader_config& cfg) {
               it, [&to_evict](entry* e) { to_evict.push_back(*e); });
             continue;
         }
-        if (offset_matches && is_valid) {
-            // found matching reader
-            break;
+        if (offset_matches) {
+            const auto& session = it->reader->reader_session();
+            if (session == cfg.reader_session) {
+                // found the reader of this session
+                found = it;
+                break;
+            }
+            if (!session && found == _readers.end()) {
+                // reader not used by any session, keep looking for the
+                // session's own reader
+                found = it;
+            }
         }
         ++it;
     }
@@ -124,14 +134,19 @@ readers_cache::get_reader(const log_reader_config& cfg) {
      * dispose unused readers in background
      */
     dispose_in_background(std::move(to_evict));
-    if (it == _readers.end()) {
+    if (found == _readers.end()) {
         _probe.cache_miss();
         vlog(stlog.trace, "{} - reader cache miss for: {}", _ntp, cfg);
         return std::nullopt;
     }
-    auto& e = *it;
+    auto& e = *found;
     vlog(stlog.trace, "{} - reader cache hit for: {}", _ntp, cfg);
-    it->reader->reset_config(cfg);
+    if (
+      cfg.reader_session
+      && e.reader->reader_session() == cfg.reader_session) {
+        _probe.cache_session_hit();
+    }
+    e.reader->reset_config(cfg);
     _probe.cache_hit();
 
     // we use cached_reader wrapper to track reader usage, when cached_reader is
@@ -32,6 +32,11 @@ namespace storage {
  * interface to force readers eviction in face of truncation and segments
  * removal. Readers are evicted from the cache according to LRU policy and
  * automatically when they can not longer be reused (f.e. EOF).
+ *
+ * Readers used by a session (see log_reader_config::reader_session) are only
+ * reused by the same session, so that consumers reading the same offsets do
+ * not take each other's readers and every consumer finds its reader at the
+ * position where its previous read stopped.
  */
 class readers_cache {
 public:
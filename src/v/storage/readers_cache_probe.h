@@ -15,6 +15,7 @@ public:
     void reader_evicted() { _readers_evicted++; }
     void cache_hit() { _cache_hits++; }
     void cache_miss() { _cache_misses++; }
+    void cache_session_hit() { _cache_session_hits++; }
     void clear() { _metrics.clear(); }
 
     void setup_metrics(const model::ntp& ntp);
@@ -24,6 +25,7 @@ private:
     uint64_t _readers_evicted{0};
     uint64_t _cache_misses{0};
     uint64_t _cache_hits{0};
+    uint64_t _cache_session_hits{0};
 
     metrics::internal_metric_groups _metrics;
 };
@@ -17,6 +17,9 @@
 
 #include <seastar/core/smp.hh>
 
+#include <algorithm>
+#include <array>
+
 namespace storage {
 
 record_batch_builder::record_batch_builder(
@@ -37,25 +40,70 @@ record_batch_builder& record_batch_builder::add_raw_kw(
   std::vector<model::record_header> headers) {
     auto sr = serialized_record{
       std::move(key), std::move(value), std::move(headers)};
-    auto rec_sz = record_size(_offset_delta, sr);
-    auto kz = sr.encoded_key_size;
-    auto vz = sr.encoded_value_size;
-    auto r = model::record(
-      rec_sz,
-      model::record_attributes{},
-      0,
-      _offset_delta,
-      kz,
-      std::move(sr.key),
-      vz,
-      std::move(sr.value),
-      std::move(sr.headers));
+    append_record(record_size(_offset_delta, sr), sr);
     ++_offset_delta;
-    model::append_record_to_buffer(_records, r);
-
     return *this;
 }
 
+void record_batch_builder::reserve(size_t records, size_t bytes) {
+    _reserved_bytes = _records.size_bytes() + bytes
+                      + records * max_record_overhead;
+}
+
+/*
+ * Same encoding as model::append_record_to_buffer(), without building the
+ * model::record. The record is written in the tail fragment, or in a new
+ * fragment fitting what remains of the reservation when it is larger.
+ */
+void record_batch_builder::append_record(
+  uint32_t size, const serialized_record& r) {
+    const size_t total = vint::vint_size(size) + size;
+    if (_records.available_bytes() < total) {
+        const auto reserved = _reserved_bytes > _records.size_bytes()
+                                ? _reserved_bytes - _records.size_bytes()
+                                : 0;
+        if (reserved >= total) {
+            _records.reserve_memory(
+              std::min(reserved, details::io_allocation_size::max_chunk_size),
+              details::io_allocation_policy::exact);
+        } else {
+            _records.reserve_memory(
+              std::min(total, details::io_allocation_size::max_chunk_size));
+        }
+    }
+
+    // size, attributes and timestamp delta at once
+    std::array<uint8_t, vint::max_length + 2> prefix{};
+    auto n = vint::serialize(size, prefix.data());
+    prefix[n++] = model::record_attributes{}.value();
+    n += vint::serialize(0, prefix.data() + n);
+    _records.append(prefix.data(), n);
+
+    append_vint(_offset_delta);
+    append_vint(r.encoded_key_size);
+    append_bytes(r.key);
+    append_vint(r.encoded_value_size);
+    append_bytes(r.value);
+    append_vint(static_cast<int64_t>(r.headers.size()));
+    for (const auto& h : r.headers) {
+        append_vint(h.key_size());
+        append_bytes(h.key());
+        append_vint(h.value_size());
+        append_bytes(h.value());
+    }
+}
+
+void record_batch_builder::append_vint(int64_t v) {
+    std::array<uint8_t, vint::max_length> buf{};
+    _records.append(buf.data(), vint::serialize(v, buf.data()));
+}
+
+void record_batch_builder::append_bytes(const iobuf& b) {
+    for (const auto& f : b) {
+        _records.append(f.get(), f.size());
+    }
+}
+
 model::record_batch record_batch_builder::build() && {
     if (!_timestamp) {
         _timestamp = model::timestamp::now();
@@ -15,6 +15,8 @@
 #include "seastarx.h"
 #include "utils/vint.h"
 
+#include <limits>
+
 namespace storage {
 class record_batch_builder {
 public:
@@ -51,8 +53,20 @@ public:
      */
     bool empty() const { return _records.empty(); }
 
+    /*
+     * Reserves the memory of `records` more records holding `bytes` of keys,
+     * values and headers in total. When it is known ahead the records are
+     * serialized into fragments sized to fit them, rather than into buffers
+     * grown as the records are added.
+     */
+    void reserve(size_t records, size_t bytes);
+
 private:
     static constexpr int64_t zero_vint_size = vint::vint_size(0);
+    // bytes of a record besides its key, value and headers, at most
+    static constexpr size_t max_record_overhead
+      = sizeof(model::record_attributes::type) + 2 * zero_vint_size
+        + 4 * vint::vint_size(std::numeric_limits<int32_t>::max());
     struct serialized_record {
         serialized_record(
           std::optional<iobuf> k,
@@ -82,6 +96,9 @@ private:
     };
 
     uint32_t record_size(int32_t offset_delta, const serialized_record& r);
+    void append_record(uint32_t size, const serialized_record& r);
+    void append_vint(int64_t);
+    void append_bytes(const iobuf&);
 
     model::record_batch_type _batch_type;
     model::offset _base_offset;
@@ -90,6 +107,8 @@ private:
     bool _is_control_type{false};
     bool _transactional_type{false};
     iobuf _records;
+    // size _records is expected to reach, see reserve()
+    size_t _reserved_bytes{0};
     int32_t _offset_delta{0};
     model::compression _compression{model::compression::none};
     std::optional<model::timestamp> _timestamp;
@@ -452,14 +452,14 @@ void segment::cache_truncate(model::offset offset) {
 ss::future<> segment::do_compaction_index_batch(const model::record_batch& b) {
     vassert(!b.compressed(), "wrong method. Call compact_index_batch. {}", b);
     auto& w = compaction_index();
-    return model::for_each_record(
+    return model::for_each_record_key(
       b,
       [o = b.base_offset(),
        batch_type = b.header().type,
        is_control_batch = b.header().attrs.is_control(),
-       &w](const model::record& r) {
+       &w](const model::record_key& r) {
           return w.index(
-            batch_type, is_control_batch, r.key(), o, r.offset_delta());
+            batch_type, is_control_batch, r.key, o, r.offset_delta);
       });
 }
 ss::future<> segment::compaction_index_batch(const model::record_batch& b) {
@@ -611,9 +611,12 @@ ss::future<append_result> segment::append(model::record_batch&& b) {
 }
 
 ss::future<segment_reader_handle>
-segment::offset_data_stream(model::offset o, ss::io_priority_class iopc) {
+segment::offset_data_stream(
+  model::offset o,
+  ss::io_priority_class iopc,
+  std::optional<unsigned> read_ahead) {
     check_segment_not_closed("offset_data_stream()");
-    auto nearest = _idx.find_nearest(o);
+    auto nearest = co_await _idx.fetch_nearest(o);
     size_t position = 0;
     if (nearest) {
         position = nearest->filepos;
@@ -623,7 +626,7 @@ segment::offset_data_stream(model::offset o, ss::io_priority_class iopc) {
     // size) (https://github.com/redpanda-data/redpanda/issues/2101)
     vassert(position < size_bytes(), "Index points beyond file size");
 
-    return _reader->data_stream(position, iopc);
+    co_return co_await _reader->data_stream(position, iopc, read_ahead);
 }
 
 void segment::advance_stable_offset(size_t filepos) {
@@ -105,8 +105,13 @@ public:
     ss::future<bool> materialize_index();
 
     /// main read interface
-    ss::future<segment_reader_handle>
-      offset_data_stream(model::offset, ss::io_priority_class);
+    ///
+    /// \p read_ahead overrides the number of read-ahead buffers configured for
+    /// the segment reader.
+    ss::future<segment_reader_handle> offset_data_stream(
+      model::offset,
+      ss::io_priority_class,
+      std::optional<unsigned> read_ahead = std::nullopt);
 
     const offset_tracker& offsets() const { return _tracker; }
     bool empty() const;
@@ -136,6 +141,7 @@ public:
     // please use higher level API's when possible
     segment_reader& reader();
     segment_reader_ptr release_segment_reader();
+    storage_resources& resources() { return _resources; }
     void swap_reader(segment_reader_ptr);
     size_t file_size() const { return _reader->file_size(); }
     const ss::sstring filename() const { return _reader->filename(); }
@@ -166,6 +172,8 @@ public:
       size_t max_bytes,
       bool skip_lru_promote);
     void cache_put(const model::record_batch& batch);
+    /// cache a batch read from disk, subject to the cache admission policy
+    void cache_put_if_admitted(const model::record_batch& batch);
 
     ss::future<ss::rwlock::holder> read_lock(
       ss::semaphore::time_point timeout = ss::semaphore::time_point::max());
@@ -432,6 +440,11 @@ inline void segment::cache_put(const model::record_batch& batch) {
         _cache->put(batch);
     }
 }
+inline void segment::cache_put_if_admitted(const model::record_batch& batch) {
+    if (likely(bool(_cache))) {
+        _cache->put_if_admitted(batch);
+    }
+}
 inline ss::future<ss::rwlock::holder>
 segment::read_lock(ss::semaphore::time_point timeout) {
     return _destructive_ops.hold_read_lock(timeout);
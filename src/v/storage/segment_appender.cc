@@ -12,6 +12,7 @@
 #include "config/configuration.h"
 #include "likely.h"
 #include "reflection/adl.h"
+#include "ssx/future-util.h"
 #include "ssx/semaphore.h"
 #include "storage/chunk_cache.h"
 #include "storage/logger.h"
@@ -23,6 +24,7 @@
 #include <seastar/core/align.hh>
 #include <seastar/core/future-util.hh>
 #include <seastar/core/future.hh>
+#include <seastar/coroutine/as_future.hh>
 
 #include <fmt/format.h>
 
@@ -68,6 +70,7 @@ segment_appender::segment_appender(ss::file f, options opts)
       "unexpected alignment {} % {} != 0",
       internal::chunk_cache::alignment,
       alignment);
+    internal::chunks().appender_opened();
 }
 
 segment_appender::~segment_appender() noexcept {
@@ -84,6 +87,7 @@ segment_appender::~segment_appender() noexcept {
     if (_head) {
         internal::chunks().add(std::exchange(_head, nullptr));
     }
+    internal::chunks().appender_closed();
 }
 
 segment_appender::segment_appender(segment_appender&& o) noexcept
@@ -106,7 +110,10 @@ segment_appender::segment_appender(segment_appender&& o) noexcept
   , _callbacks(std::exchange(o._callbacks, nullptr))
   , _inactive_timer([this] { handle_inactive_timer(); })
   , _chunk_size(o._chunk_size) {
+    vassert(
+      !o._fsync_running, "Cannot move appender with a running fsync {}", o);
     o._closed = true;
+    internal::chunks().appender_opened();
 }
 
 ss::future<> segment_appender::append(const model::record_batch& batch) {
@@ -436,35 +443,37 @@ ss::future<> segment_appender::process_flush_ops(size_t committed) {
 
     _flush_ops.pop_back_n(std::distance(flushable, _flush_ops.end()));
 
-    return _out.flush().then([this, committed, ops = std::move(ops)]() mutable {
-        // Inflight_dispatched is incremented right before a write is dispatched
-        // and then must be decremented when the write is "finished", where we
-        // don't consider the write finished until any associated flush
-        // operations that were triggered as part of write completion (i.e.,
-        // stuff in this method) are complete.
-        //
-        // We also don't want to decrement this too late, i.e., in a
-        // continuation attached the write completion path (which would be
-        // easier), because then it might be non-zero unexpectedly as observed
-        // by a client do does an append + flush and waits for the futures to
-        // resolve: the flush future resolves immediately below in the set_value
-        // loop, but the future returned by *this* method may resolve later,
-        // after the client observes a non-zero value. So we decrement the
-        // counter here, *after* the flush has completed but before we set the
-        // futures which have been returned to the callers.
-        //
-        // Unfortunately this means we need to decrement this counter in
-        // multiple places.
-        --_inflight_dispatched;
-        _flushed_offset = committed;
-        /*
-         * TODO: as an optimization, add a little house keeping to determine if
-         * eligible flush operations showed up while flush() was completing.
-         */
-        for (auto& op : ops) {
-            op.p.set_value();
-        }
-    });
+    return coalesced_flush().then(
+      [this, committed, ops = std::move(ops)]() mutable {
+          // Inflight_dispatched is incremented right before a write is
+          // dispatched and then must be decremented when the write is
+          // "finished", where we don't consider the write finished until any
+          // associated flush operations that were triggered as part of write
+          // completion (i.e., stuff in this method) are complete.
+          //
+          // We also don't want to decrement this too late, i.e., in a
+          // continuation attached the write completion path (which would be
+          // easier), because then it might be non-zero unexpectedly as observed
+          // by a client do does an append + flush and waits for the futures to
+          // resolve: the flush future resolves immediately below in the
+          // set_value loop, but the future returned by *this* method may
+          // resolve later, after the client observes a non-zero value. So we
+          // decrement the counter here, *after* the flush has completed but
+          // before we set the futures which have been returned to the callers.
+          //
+          // Unfortunately this means we need to decrement this counter in
+          // multiple places.
+          --_inflight_dispatched;
+          _flushed_offset = committed;
+          /*
+           * TODO: as an optimization, add a little house keeping to determine
+           * if eligible flush operations showed up while flush() was
+           * completing.
+           */
+          for (auto& op : ops) {
+              op.p.set_value();
+          }
+      });
 }
 
 void segment_appender::dispatch_background_head_write() {
@@ -630,11 +639,53 @@ ss::future<> segment_appender::flush() {
       _stable_offset,
       *this);
 
-    return _out.flush().handle_exception([this](std::exception_ptr e) {
+    return coalesced_flush().handle_exception([this](std::exception_ptr e) {
         vassert(false, "Could not flush: {} - {}", e, *this);
     });
 }
 
+ss::future<> segment_appender::coalesced_flush() {
+    if (!_pending_fsync) {
+        _pending_fsync.emplace();
+    }
+    auto f = _pending_fsync->get_shared_future();
+    if (!_fsync_running) {
+        _fsync_running = true;
+        ssx::background = run_pending_fsyncs();
+    }
+    return f;
+}
+
+ss::future<> segment_appender::run_pending_fsyncs() {
+    while (_pending_fsync) {
+        std::exception_ptr eptr;
+        try {
+            // the batch is only detached once a slot is available, so that
+            // requests arriving while waiting share its fsync.
+            auto units = co_await _opts.resources.get_fsync_units();
+            auto batch = std::exchange(_pending_fsync, std::nullopt);
+            auto fut = co_await ss::coroutine::as_future(_out.flush());
+            units.return_all();
+            if (fut.failed()) {
+                batch->set_exception(fut.get_exception());
+            } else {
+                batch->set_value();
+            }
+            continue;
+        } catch (...) {
+            eptr = std::current_exception();
+        }
+        // failed to get a slot: fail the waiting batch rather than leave it
+        // hanging
+        if (_pending_fsync) {
+            std::exchange(_pending_fsync, std::nullopt)->set_exception(eptr);
+        }
+    }
+    // once the last batch has been completed the waiters may destroy the
+    // appender, so nothing may touch `this` after a suspension point here.
+    _fsync_running = false;
+}
+
 ss::future<> segment_appender::hard_flush() {
     _inactive_timer.cancel();
     if (_head && _head->bytes_pending()) {
@@ -26,6 +26,7 @@
 #include <seastar/core/file.hh>
 #include <seastar/core/fstream.hh>
 #include <seastar/core/iostream.hh>
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/sstring.hh>
 
 #include <iosfwd>
@@ -305,6 +306,15 @@ private:
     maybe_advance_stable_offset(const ss::lw_shared_ptr<inflight_write>&);
     ss::future<> process_flush_ops(size_t);
 
+    // fsync the file. this is group committed: while an fsync is in progress
+    // or waiting for one of the shard's fsync slots (see storage_resources),
+    // further requests are batched behind a single follow-up fsync, which
+    // covers every write that completed before it was submitted.
+    ss::future<> coalesced_flush();
+    ss::future<> run_pending_fsyncs();
+    std::optional<ss::shared_promise<>> _pending_fsync;
+    bool _fsync_running{false};
+
     ss::timer<ss::lowres_clock> _inactive_timer;
     void handle_inactive_timer();
 
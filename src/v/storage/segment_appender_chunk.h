@@ -94,17 +94,28 @@ public:
         const size_t sz = std::min(len, space_left());
         std::copy_n(src, sz, get_current());
         _pos += sz;
+        _dirty_end = std::max(_dirty_end, _pos);
         return sz;
     }
 
     void reset() {
         _flushed_pos = _pos = 0;
-        // allow chunk reuse
-        std::memset(_buf.get(), 0, _chunk_size);
+        // allow chunk reuse. bytes past the dirty end were never written
+        // since the last reset and are still zero.
+        std::memset(
+          _buf.get(),
+          0,
+          std::min(ss::align_up<size_t>(_dirty_end, _alignment), _chunk_size));
+        _dirty_end = 0;
     }
     void flush() { _flushed_pos = _pos; }
     char* get_current() { return _buf.get() + _pos; }
-    void set_position(size_t p) { _flushed_pos = _pos = p; }
+    void set_position(size_t p) {
+        _flushed_pos = _pos = p;
+        // the bytes before p were filled in by the caller, e.g. by reading
+        // back the partial last page of a file
+        _dirty_end = std::max(_dirty_end, ss::align_up<size_t>(p, _alignment));
+    }
 
     intrusive_list_hook hook;
 
@@ -113,6 +124,8 @@ private:
     storage::alignment _alignment{0};
     size_t _pos{0};
     size_t _flushed_pos{0};
+    // end of the region that may have been written since the last reset
+    size_t _dirty_end{_chunk_size};
     std::unique_ptr<char[], ss::free_deleter> _buf;
     friend std::ostream&
     operator<<(std::ostream& o, const segment_appender_chunk& c) {
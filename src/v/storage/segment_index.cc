@@ -9,6 +9,7 @@
 
 #include "storage/segment_index.h"
 
+#include "config/configuration.h"
 #include "model/timestamp.h"
 #include "serde/serde.h"
 #include "storage/index_state.h"
@@ -16,6 +17,7 @@
 #include "storage/segment_utils.h"
 #include "vassert.h"
 
+#include <seastar/core/byteorder.hh>
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/fstream.hh>
 #include <seastar/core/iostream.hh>
@@ -92,11 +94,13 @@ void segment_index::reset() {
     _state.base_offset = base;
 
     _acc = 0;
+    drop_paged_entries();
 }
 
 void segment_index::swap_index_state(index_state&& o) {
     _needs_persistence = true;
     _acc = 0;
+    drop_paged_entries();
     std::swap(_state, o);
 }
 
@@ -117,6 +121,7 @@ void segment_index::maybe_track(
   const model::record_batch_header& hdr,
   std::optional<broker_timestamp_t> new_broker_ts,
   size_t filepos) {
+    drop_paged_entries();
     _acc += hdr.size_bytes;
 
     _state.update_batch_timestamps_are_monotonic(
@@ -159,12 +164,7 @@ segment_index::find_nearest(model::timestamp t) {
     return translate_index_entry(_state, *entry);
 }
 
-std::optional<segment_index::entry>
-segment_index::find_nearest(model::offset o) {
-    if (o < _state.base_offset || _state.empty()) {
-        return std::nullopt;
-    }
-    const uint32_t needle = o() - _state.base_offset();
+std::optional<size_t> segment_index::find_nearest_slot(uint32_t needle) const {
     auto it = std::lower_bound(
       std::begin(_state.relative_offset_index),
       std::end(_state.relative_offset_index),
@@ -177,13 +177,177 @@ segment_index::find_nearest(model::offset o) {
     int i = std::distance(_state.relative_offset_index.begin(), it);
     do {
         if (_state.relative_offset_index[i] <= needle) {
-            return translate_index_entry(_state, _state.get_entry(i));
+            return i;
         }
     } while (i-- > 0);
 
     return std::nullopt;
 }
 
+std::optional<segment_index::entry>
+segment_index::find_nearest(model::offset o) {
+    if (o < _state.base_offset || _state.empty()) {
+        return std::nullopt;
+    }
+    const uint32_t needle = o() - _state.base_offset();
+    if (auto i = find_nearest_slot(needle); i) {
+        return translate_index_entry(_state, _state.get_entry(*i));
+    }
+    return std::nullopt;
+}
+
+ss::future<std::optional<segment_index::entry>>
+segment_index::fetch_nearest(model::offset o) {
+    if (!_paged || o < _state.base_offset || _state.empty()) {
+        co_return find_nearest(o);
+    }
+    const uint32_t needle = o() - _state.base_offset();
+    const auto slot = find_nearest_slot(needle);
+    if (!slot) {
+        co_return std::nullopt;
+    }
+    const auto paged = *_paged;
+    const size_t first = *slot * paged.stride;
+    const size_t count = std::min(paged.stride, paged.size - first);
+    if (count <= 1) {
+        co_return translate_index_entry(_state, _state.get_entry(*slot));
+    }
+
+    auto f = co_await open();
+    std::exception_ptr ex;
+    std::optional<std::tuple<uint32_t, offset_time_index, uint64_t>> result;
+    try {
+        auto offsets = co_await f.dma_read_bulk<char>(
+          paged.relative_offset_pos + first * sizeof(uint32_t),
+          count * sizeof(uint32_t));
+        if (offsets.size() < count * sizeof(uint32_t)) {
+            throw std::runtime_error(fmt::format(
+              "Short read of paged index entries: {}", offsets.size()));
+        }
+        auto relative_offset_at = [&offsets](size_t i) {
+            return ss::read_le<uint32_t>(offsets.get() + i * sizeof(uint32_t));
+        };
+        // the first entry is the resident one, so it is at most `needle`
+        size_t i = count - 1;
+        while (i > 0 && relative_offset_at(i) > needle) {
+            --i;
+        }
+        result = co_await read_paged_entry(f, paged, first + i);
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await f.close();
+
+    if (ex) {
+        vlog(
+          stlog.warn,
+          "Error reading paged entries of {}, using resident entry: {}",
+          _path,
+          ex);
+        co_return find_nearest(o);
+    }
+    if (!_paged) {
+        // the index changed while reading, the file may not match anymore
+        co_return find_nearest(o);
+    }
+    co_return translate_index_entry(_state, *result);
+}
+
+ss::future<std::optional<segment_index::entry>>
+segment_index::fetch_nearest(model::timestamp t) {
+    if (!_paged || t < _state.base_timestamp || _state.empty()) {
+        co_return find_nearest(t);
+    }
+    // same search as index_state::find_entry(), but over the entries on disk
+    // between the resident entries around the target.
+    const auto needle
+      = offset_time_index{t - _state.base_timestamp, _state.with_offset}
+          .raw_value();
+    const auto resident = static_cast<size_t>(std::distance(
+      _state.relative_time_index.begin(),
+      std::lower_bound(
+        _state.relative_time_index.begin(),
+        _state.relative_time_index.end(),
+        needle)));
+    if (resident == 0) {
+        co_return translate_index_entry(_state, _state.get_entry(0));
+    }
+    const auto paged = *_paged;
+    // resident entry `resident - 1` is below the needle, so the first entry
+    // on disk that isn't is in (first, last]. if every resident entry is
+    // below the needle it may also be past the end.
+    const size_t first = (resident - 1) * paged.stride;
+    const size_t last = std::min(resident * paged.stride, paged.size - 1);
+    if (last == first) {
+        co_return translate_index_entry(
+          _state, _state.get_entry(resident - 1));
+    }
+
+    auto f = co_await open();
+    std::exception_ptr ex;
+    std::optional<std::tuple<uint32_t, offset_time_index, uint64_t>> result;
+    try {
+        const size_t count = last - first;
+        auto times = co_await f.dma_read_bulk<char>(
+          paged.relative_time_pos + (first + 1) * sizeof(uint32_t),
+          count * sizeof(uint32_t));
+        if (times.size() < count * sizeof(uint32_t)) {
+            throw std::runtime_error(fmt::format(
+              "Short read of paged index entries: {}", times.size()));
+        }
+        size_t i = 0;
+        while (i < count
+               && ss::read_le<uint32_t>(times.get() + i * sizeof(uint32_t))
+                    < needle) {
+            ++i;
+        }
+        // entry first + 1 + i is the lower bound, go back one entry like
+        // find_entry() does since not every batch is indexed.
+        if (i == 0) {
+            result = _state.get_entry(resident - 1);
+        } else {
+            result = co_await read_paged_entry(f, paged, first + i);
+        }
+    } catch (...) {
+        ex = std::current_exception();
+    }
+    co_await f.close();
+
+    if (ex) {
+        vlog(
+          stlog.warn,
+          "Error reading paged entries of {}, using resident entry: {}",
+          _path,
+          ex);
+        co_return find_nearest(t);
+    }
+    if (!_paged) {
+        // the index changed while reading, the file may not match anymore
+        co_return find_nearest(t);
+    }
+    co_return translate_index_entry(_state, *result);
+}
+
+ss::future<std::tuple<uint32_t, offset_time_index, uint64_t>>
+segment_index::read_paged_entry(
+  ss::file& f, const paged_entries& paged, size_t i) {
+    auto offset = co_await f.dma_read_bulk<char>(
+      paged.relative_offset_pos + i * sizeof(uint32_t), sizeof(uint32_t));
+    auto time = co_await f.dma_read_bulk<char>(
+      paged.relative_time_pos + i * sizeof(uint32_t), sizeof(uint32_t));
+    auto position = co_await f.dma_read_bulk<char>(
+      paged.position_pos + i * sizeof(uint64_t), sizeof(uint64_t));
+    if (
+      offset.size() < sizeof(uint32_t) || time.size() < sizeof(uint32_t)
+      || position.size() < sizeof(uint64_t)) {
+        throw std::runtime_error("Short read of paged index entry");
+    }
+    co_return std::make_tuple(
+      ss::read_le<uint32_t>(offset.get()),
+      offset_time_index{ss::read_le<uint32_t>(time.get()), _state.with_offset},
+      ss::read_le<uint64_t>(position.get()));
+}
+
 ss::future<> segment_index::truncate(
   model::offset new_max_offset, model::timestamp new_max_timestamp) {
     if (new_max_offset < _state.base_offset) {
@@ -198,6 +362,7 @@ ss::future<> segment_index::truncate(
 
     if (it != _state.relative_offset_index.end()) {
         _needs_persistence = true;
+        drop_paged_entries();
         int remove_back_elems = std::distance(
           it, _state.relative_offset_index.end());
         while (remove_back_elems-- > 0) {
@@ -207,6 +372,7 @@ ss::future<> segment_index::truncate(
 
     if (new_max_offset < _state.max_offset) {
         _needs_persistence = true;
+        drop_paged_entries();
         if (_state.empty()) {
             _state.max_timestamp = _state.base_timestamp;
             _state.max_offset = _state.base_offset;
@@ -219,6 +385,58 @@ ss::future<> segment_index::truncate(
     co_return co_await flush();
 }
 
+/**
+ * serde writes index_state as an envelope header followed by the field blob
+ * from index_state::serde_write() and its crc. Within the blob the entry
+ * arrays follow the fixed-width header fields, each as a length prefix and
+ * then the little-endian elements:
+ *
+ *   version, compat_version, envelope size
+ *   blob size
+ *   bitflags, base_offset, max_offset, base_timestamp, max_timestamp
+ *   size, relative_offset_index[size]   (uint32_t)
+ *   size, relative_time_index[size]     (uint32_t)
+ *   size, position_index[size]          (uint64_t)
+ *   ...
+ *
+ * Returns the file position of each array, or std::nullopt if the buffer
+ * does not have this layout (e.g. the deprecated on-disk format).
+ */
+std::optional<segment_index::paged_entries>
+segment_index::locate_paged_entries(
+  const ss::temporary_buffer<char>& buf, size_t entries) {
+    using serde::serde_size_t;
+    constexpr size_t fixed_fields = sizeof(uint32_t) + 4 * sizeof(int64_t);
+    constexpr size_t first_array = 2 * sizeof(uint8_t) + sizeof(serde_size_t)
+                                   + sizeof(serde_size_t) + fixed_fields;
+
+    paged_entries paged{.size = entries};
+    paged.relative_offset_pos = first_array + sizeof(serde_size_t);
+    paged.relative_time_pos = paged.relative_offset_pos
+                              + entries * sizeof(uint32_t)
+                              + sizeof(serde_size_t);
+    paged.position_pos = paged.relative_time_pos + entries * sizeof(uint32_t)
+                         + sizeof(serde_size_t);
+
+    if (
+      buf.size() < paged.position_pos + entries * sizeof(uint64_t)
+      || static_cast<uint8_t>(buf[0]) != index_state::redpanda_serde_version) {
+        return std::nullopt;
+    }
+    // every array must be prefixed with the expected number of elements
+    for (auto pos :
+         {paged.relative_offset_pos,
+          paged.relative_time_pos,
+          paged.position_pos}) {
+        const auto size = ss::read_le<serde_size_t>(
+          buf.get() + pos - sizeof(serde_size_t));
+        if (size != entries) {
+            return std::nullopt;
+        }
+    }
+    return paged;
+}
+
 /**
  *
  * @return true if decoded without errors, false on a serialization error
@@ -237,9 +455,18 @@ ss::future<bool> segment_index::materialize_index_from_file(ss::file f) {
         co_return false;
     }
     iobuf b;
-    b.append(std::move(buf));
+    b.append(buf.share());
     try {
         _state = serde::from_iobuf<index_state>(std::move(b));
+        drop_paged_entries();
+        const size_t stride
+          = config::shard_local_cfg().segment_index_resident_stride();
+        if (stride > 1 && _state.size() > stride) {
+            if (auto paged = locate_paged_entries(buf, _state.size()); paged) {
+                paged->stride = stride;
+                page_out(*paged);
+            }
+        }
         co_return true;
     } catch (const serde::serde_exception& ex) {
         vlog(
@@ -250,6 +477,22 @@ ss::future<bool> segment_index::materialize_index_from_file(ss::file f) {
     }
 }
 
+void segment_index::page_out(paged_entries paged) {
+    fragmented_vector<uint32_t> relative_offsets;
+    fragmented_vector<uint32_t> relative_times;
+    fragmented_vector<uint64_t> positions;
+    for (size_t i = 0; i < _state.size(); i += paged.stride) {
+        relative_offsets.push_back(_state.relative_offset_index[i]);
+        relative_times.push_back(_state.relative_time_index[i]);
+        positions.push_back(_state.position_index[i]);
+    }
+    _state.relative_offset_index = std::move(relative_offsets);
+    _state.relative_time_index = std::move(relative_times);
+    _state.position_index = std::move(positions);
+    _state.shrink_to_fit();
+    _paged = paged;
+}
+
 ss::future<> segment_index::drop_all_data() {
     reset();
     clear_cached_disk_usage();
@@ -109,6 +109,15 @@ struct time_based_retention_cfg {
  *
  * The name of this index _must_ be then:
  *     default/test/0/1-1-v1.base_index
+ *
+ * Paging: when an index is materialized from disk and
+ * segment_index_resident_stride is greater than one, only every stride-th
+ * entry is kept in memory. The serialized entry arrays are fixed-width, so
+ * fetch_nearest() refines a lookup by reading the entries that lie between
+ * two resident ones straight from the index file. The synchronous lookups
+ * answer from the resident entries alone, which is coarser but still a
+ * valid place to start scanning from. Any change to the index drops the
+ * paged state, the next flush() then persists the resident entries.
  */
 class segment_index {
 public:
@@ -154,6 +163,17 @@ public:
     std::optional<entry> find_nearest(model::offset);
     std::optional<entry> find_nearest(model::timestamp);
 
+    /// Like find_nearest(model::offset), but reads the paged out entries
+    /// next to the resident one so the result is as precise as that of a
+    /// fully resident index.
+    ss::future<std::optional<entry>> fetch_nearest(model::offset);
+    /// Like find_nearest(model::timestamp), reading the paged out entries.
+    /// Expects monotonic batch timestamps, like the binary search it does.
+    ss::future<std::optional<entry>> fetch_nearest(model::timestamp);
+
+    /// True if only a summary of the entries is resident.
+    bool is_paged() const { return _paged.has_value(); }
+
     /// Fallback timestamp search for if the recorded max ts appears to be
     /// invalid, e.g. too far in the future
     std::optional<model::timestamp>
@@ -218,8 +238,28 @@ public:
     void clear_cached_disk_usage() { _disk_usage_size.reset(); }
 
 private:
+    /// Location of the entry arrays of a serialized index_state in the
+    /// index file, see locate_paged_entries().
+    struct paged_entries {
+        // entries in each array on disk
+        size_t size{0};
+        // resident entry i is entry i * stride on disk
+        size_t stride{1};
+        uint64_t relative_offset_pos{0};
+        uint64_t relative_time_pos{0};
+        uint64_t position_pos{0};
+    };
+
+    static std::optional<paged_entries>
+    locate_paged_entries(const ss::temporary_buffer<char>&, size_t entries);
     ss::future<bool> materialize_index_from_file(ss::file);
     ss::future<> flush_to_file(ss::file);
+    void page_out(paged_entries);
+    ss::future<std::tuple<uint32_t, offset_time_index, uint64_t>>
+    read_paged_entry(ss::file&, const paged_entries&, size_t i);
+    std::optional<size_t> find_nearest_slot(uint32_t needle) const;
+    // called on every change to the entries or bounds of the index
+    void drop_paged_entries() { _paged.reset(); }
 
     segment_full_path _path;
     size_t _step;
@@ -238,6 +278,8 @@ private:
 
     model::timestamp _last_batch_max_timestamp;
 
+    std::optional<paged_entries> _paged;
+
     /** Constructor with mock file content for unit testing */
     segment_index(
       segment_full_path path,
@@ -9,6 +9,8 @@
 
 #include "storage/segment_reader.h"
 
+#include "config/configuration.h"
+#include "io/persistence.h"
 #include "ssx/future-util.h"
 #include "storage/logger.h"
 #include "storage/segment_utils.h"
@@ -23,6 +25,61 @@
 
 namespace storage {
 
+namespace internal {
+
+experimental::io::page_cache* page_cache() {
+    static thread_local std::unique_ptr<experimental::io::page_cache> cache =
+      []() -> std::unique_ptr<experimental::io::page_cache> {
+        const auto size = config::shard_local_cfg()
+                            .storage_read_page_cache_size();
+        if (size < segment_page_size * 10) {
+            return nullptr;
+        }
+        // a small queue of 10% of the total capacity is recommended by the
+        // authors of s3-fifo.
+        return std::make_unique<experimental::io::page_cache>(
+          experimental::io::page_cache::config{
+            .cache_size = size, .small_size = size / 10});
+    }();
+    return cache.get();
+}
+
+} // namespace internal
+
+namespace {
+
+/*
+ * Data source serving reads from a segment file through the page cache.
+ */
+class paged_data_source_impl final : public ss::data_source_impl {
+public:
+    paged_data_source_impl(
+      ss::lw_shared_ptr<experimental::io::pager> pager,
+      ss::file file,
+      size_t pos,
+      size_t end)
+      : _pager(std::move(pager))
+      , _file(std::move(file))
+      , _pos(pos)
+      , _end(end) {}
+
+    ss::future<ss::temporary_buffer<char>> get() override {
+        auto buf = co_await _pager->read(_file, _pos, _end);
+        _pos += buf.size();
+        co_return buf;
+    }
+
+    ss::future<> close() override { return ss::now(); }
+
+private:
+    ss::lw_shared_ptr<experimental::io::pager> _pager;
+    experimental::io::disk_persistence::disk_file _file;
+    size_t _pos;
+    size_t _end;
+};
+
+} // namespace
+
 segment_reader::segment_reader(
   segment_full_path path,
   size_t buffer_size,
@@ -31,7 +88,12 @@ segment_reader::segment_reader(
   : _path(std::move(path))
   , _buffer_size(buffer_size)
   , _read_ahead(read_ahead)
-  , _sanitizer_config(std::move(ntp_sanitizer_config)) {}
+  , _sanitizer_config(std::move(ntp_sanitizer_config)) {
+    if (auto cache = internal::page_cache(); cache != nullptr) {
+        _pager = ss::make_lw_shared<experimental::io::pager>(
+          internal::segment_page_size, cache);
+    }
+}
 
 segment_reader::~segment_reader() noexcept {
     if (!_streams.empty() || _data_file_refcount > 0) {
@@ -55,8 +117,10 @@ ss::future<> segment_reader::load_size() {
     set_file_size(s.st_size);
 };
 
-ss::future<segment_reader_handle>
-segment_reader::data_stream(size_t pos, const ss::io_priority_class pc) {
+ss::future<segment_reader_handle> segment_reader::data_stream(
+  size_t pos,
+  const ss::io_priority_class pc,
+  std::optional<unsigned> read_ahead) {
     vassert(
       pos <= _file_size,
       "cannot read negative bytes. Asked to read at position: '{}' - {}",
@@ -74,19 +138,34 @@ segment_reader::data_stream(size_t pos, const ss::io_priority_class pc) {
     // sealed segments are supposed to be very rare events. The hotpath of
     // truncating the appender, is optimized.
 
-    ss::file_input_stream_options options;
-    options.buffer_size = _buffer_size;
-    options.io_priority_class = pc;
-    options.read_ahead = _read_ahead;
-
     ss::gate::holder guard{_gate};
 
     auto handle = co_await get();
-    handle.set_stream(make_file_input_stream(
-      _data_file, pos, _file_size - pos, std::move(options)));
+    handle.set_stream(
+      make_stream(pos, _file_size, pc, read_ahead.value_or(_read_ahead)));
     co_return std::move(handle);
 }
 
+ss::input_stream<char> segment_reader::make_stream(
+  size_t pos_begin,
+  size_t pos_end,
+  const ss::io_priority_class pc,
+  unsigned read_ahead) {
+    if (_pager) {
+        return ss::input_stream<char>(
+          ss::data_source(std::make_unique<paged_data_source_impl>(
+            _pager, _data_file, pos_begin, pos_end)));
+    }
+
+    ss::file_input_stream_options options;
+    options.buffer_size = _buffer_size;
+    options.io_priority_class = pc;
+    options.read_ahead = read_ahead;
+
+    return make_file_input_stream(
+      _data_file, pos_begin, pos_end - pos_begin, std::move(options));
+}
+
 ss::future<segment_reader_handle> segment_reader::get() {
     vlog(
       stlog.trace,
@@ -155,15 +234,9 @@ ss::future<segment_reader_handle> segment_reader::data_stream(
       pos_begin,
       pos_end,
       *this);
-    ss::file_input_stream_options options;
-    options.buffer_size = _buffer_size;
-    options.io_priority_class = pc;
-    options.read_ahead = _read_ahead;
-
     ss::gate::holder guard{_gate};
     auto handle = co_await get();
-    handle.set_stream(make_file_input_stream(
-      _data_file, pos_begin, pos_end - pos_begin, std::move(options)));
+    handle.set_stream(make_stream(pos_begin, pos_end, pc, _read_ahead));
     co_return handle;
 }
 
@@ -171,6 +244,9 @@ ss::future<> segment_reader::truncate(size_t n) {
     ss::gate::holder guard{_gate};
 
     _file_size = n;
+    if (_pager) {
+        _pager->truncate(n);
+    }
     return ss::open_file_dma(ss::sstring(_path), ss::open_flags::rw)
       .then([n](ss::file f) {
           return f.truncate(n)
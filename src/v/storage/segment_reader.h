@@ -11,11 +11,14 @@
 
 #pragma once
 
+#include "io/page_cache.h"
+#include "io/pager.h"
 #include "model/fundamental.h"
 #include "seastarx.h"
 #include "storage/file_sanitizer_types.h"
 #include "storage/fs_utils.h"
 #include "storage/types.h"
+#include "units.h"
 #include "utils/intrusive_list_helpers.h"
 #include "utils/mutex.h"
 
@@ -31,6 +34,19 @@
 
 namespace storage {
 
+namespace internal {
+
+/// Size of pages used by segment readers in page cache mode.
+inline constexpr size_t segment_page_size = 32_KiB;
+
+/**
+ * Shard-local page cache shared by all segment readers. Returns nullptr when
+ * the page cache is disabled (storage_read_page_cache_size is zero).
+ */
+experimental::io::page_cache* page_cache();
+
+} // namespace internal
+
 class segment_reader;
 
 struct stream_provider {
@@ -145,12 +161,29 @@ public:
 
     /// create an input stream _sharing_ the underlying file handle
     /// starting at position @pos
-    ss::future<segment_reader_handle>
-    data_stream(size_t pos, const ss::io_priority_class);
+    ss::future<segment_reader_handle> data_stream(
+      size_t pos,
+      const ss::io_priority_class,
+      std::optional<unsigned> read_ahead = std::nullopt);
     ss::future<segment_reader_handle>
     data_stream(size_t pos_begin, size_t pos_end, const ss::io_priority_class);
 
+    /// size of each read buffer used by data streams
+    size_t buffer_size() const { return _buffer_size; }
+
+    /// default number of read-ahead buffers used by data streams
+    unsigned read_ahead() const { return _read_ahead; }
+
+    /// true if reads are served through the shard-local page cache
+    bool page_cache_enabled() const { return _pager != nullptr; }
+
 private:
+    ss::input_stream<char> make_stream(
+      size_t pos_begin,
+      size_t pos_end,
+      const ss::io_priority_class,
+      unsigned read_ahead);
+
     segment_full_path _path;
 
     // Protects open/close of _data_file, to avoid double-opening on
@@ -170,6 +203,10 @@ private:
     unsigned _read_ahead{0};
     std::optional<ntp_sanitizer_config> _sanitizer_config;
 
+    // Set when reads go through the shard-local page cache. Streams hold a
+    // reference so that the pager outlives a reader dropped with open handles.
+    ss::lw_shared_ptr<experimental::io::pager> _pager;
+
     // Keeps track of operations that cannot be pre-empted by close()
     ss::gate _gate;
     // Acquire a handle to use the underlying file handle
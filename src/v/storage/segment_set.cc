@@ -13,6 +13,7 @@
 #include "storage/log_replayer.h"
 #include "storage/logger.h"
 #include "storage/segment.h"
+#include "storage/storage_resources.h"
 #include "utils/directory_walker.h"
 #include "utils/filtered_lower_bound.h"
 #include "vassert.h"
@@ -24,6 +25,7 @@
 #include <seastar/core/thread.hh>
 
 #include <absl/container/btree_set.h>
+#include <boost/range/irange.hpp>
 #include <fmt/format.h>
 
 #include <exception>
@@ -184,20 +186,80 @@ is_last_segment(segment* s, std::optional<ss::sstring> last_clean_segment) {
                 == std::string(last_clean_segment.value());
 }
 
+/// Outcome of loading the on-disk index of a single segment.
+struct index_load_result {
+    bool materialized{false};
+    std::exception_ptr error;
+};
+
+/**
+ * Load the indices of all segments, with up to storage_recovery_concurrency
+ * loads in flight. Failures are returned per segment rather than thrown so
+ * that the caller can schedule the affected segments for recovery.
+ */
+static ss::future<std::vector<index_load_result>> materialize_indices(
+  segment_set::underlying_t& segs, storage_resources& resources) {
+    std::vector<index_load_result> results(segs.size());
+    co_await ss::max_concurrent_for_each(
+      boost::irange<size_t>(0, segs.size()),
+      resources.segment_recovery_concurrency(),
+      [&](size_t i) -> ss::future<> {
+          auto units = co_await resources.get_segment_recovery_units();
+          try {
+              // use the segment materialize instead of going through
+              // the index directly to hydrate the max_offset state
+              results[i].materialized = co_await segs[i]->materialize_index();
+          } catch (...) {
+              results[i].error = std::current_exception();
+          }
+      });
+    co_return results;
+}
+
+/**
+ * Rebuild the index and offsets of a segment by replaying its data file.
+ * Returns false if nothing could be recovered, in which case the segment is
+ * closed and its data file set aside. Must be called from a ss::thread.
+ */
+static bool recover_segment_in_thread(segment& s) {
+    auto replayer = log_replayer(s);
+    auto recovered = replayer.recover_in_thread(ss::default_priority_class());
+    if (!recovered) {
+        vlog(stlog.info, "Unable to recover segment: {}", s);
+        s.close().get();
+        ss::rename_file(
+          s.reader().filename(), s.reader().filename() + ".cannotrecover")
+          .get();
+        return false;
+    }
+    s.truncate(
+       recovered.last_offset.value(),
+       recovered.truncate_file_pos.value(),
+       recovered.last_max_timestamp.value())
+      .get();
+    // persist index
+    s.index().flush().get();
+    vlog(stlog.info, "Recovered: {}", s);
+    return true;
+}
+
 // Recover the last segment. Whenever we close a segment, we will likely
 // open a new one to which we will direct new writes. That new segment
 // might be empty. To optimize log replay, implement #140.
 static ss::future<segment_set> unsafe_do_recover(
   segment_set&& segments,
   std::optional<ss::sstring> last_clean_segment,
+  storage_resources& resources,
   ss::abort_source& as) {
     return ss::async([segments = std::move(segments),
                       last_clean_segment = std::move(last_clean_segment),
+                      &resources,
                       &as]() mutable {
         if (segments.empty() || as.abort_requested()) {
             return std::move(segments);
         }
         segment_set::underlying_t good = std::move(segments).release();
+        const auto indices = materialize_indices(good, resources).get();
         absl::btree_set<segment*> to_recover_set;
         for (size_t i = 0; i < good.size(); ++i) {
             auto& s = *good[i];
@@ -217,43 +279,31 @@ static ss::future<segment_set> unsafe_do_recover(
                 }
             }
 
-            try {
-                // use the segment materialize instead of going through
-                // the index directly to hydrate the max_offset state
-                if (s.materialize_index().get()) {
-                    vassert(
-                      s.offsets().dirty_offset == s.index().max_offset(),
-                      "dirty_offset and index max_offset must be equal for "
-                      "segment {}",
-                      s);
-                } else {
-                    if (is_last_segment(&s, last_clean_segment)) {
-                        // skipping last_clean_segment is an optimization for
-                        // happy case; here we explicitly know that there is a
-                        // problem with index; skipping the optimization
-                        last_clean_segment = {};
-                    }
-
-                    to_recover_set.insert(&s);
-                }
-            } catch (...) {
+            if (indices[i].error) {
                 vlog(
                   stlog.info,
                   "Error materializing index:{}. Recovering parent "
                   "segment:{}. Details:{}",
                   s.index().path(),
                   s.filename(),
-                  std::current_exception());
-
-                if (is_last_segment(&s, last_clean_segment)) {
-                    // skipping last_clean_segment is an optimization for
-                    // happy case; here we explicitly know that there is a
-                    // problem with index; skipping the optimization
-                    last_clean_segment = {};
-                }
+                  indices[i].error);
+            } else if (indices[i].materialized) {
+                vassert(
+                  s.offsets().dirty_offset == s.index().max_offset(),
+                  "dirty_offset and index max_offset must be equal for "
+                  "segment {}",
+                  s);
+                continue;
+            }
 
-                to_recover_set.insert(&s);
+            if (is_last_segment(&s, last_clean_segment)) {
+                // skipping last_clean_segment is an optimization for
+                // happy case; here we explicitly know that there is a
+                // problem with index; skipping the optimization
+                last_clean_segment = {};
             }
+
+            to_recover_set.insert(&s);
         }
         segment_set::underlying_t to_recover;
         // keep segments sorted
@@ -304,44 +354,38 @@ static ss::future<segment_set> unsafe_do_recover(
             good.pop_back();
         }
 
-        for (auto& s : to_recover) {
-            // check for abort
-            if (unlikely(as.abort_requested())) {
-                return segment_set(std::move(good));
-            }
+        // segments are replayed concurrently; the segment_set constructor
+        // restores offset order of the recovered ones appended to `good`
+        ss::max_concurrent_for_each(
+          to_recover,
+          resources.segment_recovery_concurrency(),
+          [&](ss::lw_shared_ptr<segment>& s) {
+              // check for abort
+              if (unlikely(as.abort_requested())) {
+                  return ss::now();
+              }
 
-            if (is_last_segment(s.get(), last_clean_segment)) {
-                vlog(
-                  stlog.debug,
-                  "Skipping recovery of {}, it is marked clean",
-                  s);
-                good.emplace_back(std::move(s));
-                continue;
-            }
+              // Check if the segment was marked clean on shutdown
+              if (is_last_segment(s.get(), last_clean_segment)) {
+                  vlog(
+                    stlog.debug,
+                    "Skipping recovery of {}, it is marked clean",
+                    s);
+                  good.emplace_back(std::move(s));
+                  return ss::now();
+              }
 
-            // Check if the segment was marked clean on shutdown
-            auto replayer = log_replayer(*s);
-            auto recovered = replayer.recover_in_thread(
-              ss::default_priority_class());
-            if (!recovered) {
-                vlog(stlog.info, "Unable to recover segment: {}", s);
-                s->close().get();
-                ss::rename_file(
-                  s->reader().filename(),
-                  s->reader().filename() + ".cannotrecover")
-                  .get();
-                continue;
-            }
-            s->truncate(
-               recovered.last_offset.value(),
-               recovered.truncate_file_pos.value(),
-               recovered.last_max_timestamp.value())
-              .get();
-            // persist index
-            s->index().flush().get();
-            vlog(stlog.info, "Recovered: {}", s);
-            good.emplace_back(std::move(s));
-        }
+              return resources.get_segment_recovery_units().then(
+                [&s, &good](ssx::semaphore_units units) {
+                    return ss::async(
+                      [&s, &good, units = std::move(units)] {
+                          if (recover_segment_in_thread(*s)) {
+                              good.emplace_back(std::move(s));
+                          }
+                      });
+                });
+          })
+          .get();
         return segment_set(std::move(good));
     });
 }
@@ -349,6 +393,7 @@ static ss::future<segment_set> unsafe_do_recover(
 static ss::future<segment_set> do_recover(
   segment_set&& segments,
   std::optional<ss::sstring> last_clean_segment,
+  storage_resources& resources,
   ss::abort_source& as) {
     // light-weight copy used for clean-up if recovery fails
     segment_set::underlying_t copy;
@@ -361,7 +406,8 @@ static ss::future<segment_set> do_recover(
     // are any pending io operations on a file associated with the segment
     // at the time of destruction seastar will complain about the file handle
     // being destroyed with pending ops.
-    return unsafe_do_recover(std::move(segments), last_clean_segment, as)
+    return unsafe_do_recover(
+             std::move(segments), last_clean_segment, resources, as)
       .handle_exception(
         [copy = std::move(copy)](const std::exception_ptr& ex) mutable {
             return ss::do_with(
@@ -384,6 +430,10 @@ static ss::future<segment_set> do_recover(
 /**
  * \brief Open all segments in a directory.
  *
+ * The directory is listed first and the segments are then opened with up to
+ * storage_recovery_concurrency opens in flight. Opening a segment only stats
+ * the file: the data file handle is opened by the reader on first use.
+ *
  * Returns an exceptional future if any error occured opening a
  * segment. Otherwise all open segment readers are returned.
  */
@@ -396,67 +446,50 @@ static ss::future<segment_set::underlying_t> open_segments(
   storage_resources& resources,
   ss::sharded<features::feature_table>& feature_table,
   const std::optional<ntp_sanitizer_config>& ntp_sanitizer_config) {
-    using segs_type = segment_set::underlying_t;
-    return ss::do_with(
-      segs_type{},
-      [&as,
-       ppath,
-       cache_factory,
-       ntp_sanitizer_config,
-       buf_size,
-       read_ahead,
-       &resources,
-       &feature_table](segs_type& segs) {
-          auto f = directory_walker::walk(
-            ss::sstring(ppath),
-            [&as,
-             ppath,
-             cache_factory,
-             san_cfg = ntp_sanitizer_config,
-             &segs,
-             buf_size,
-             read_ahead,
-             &resources,
-             &feature_table](ss::directory_entry seg) {
-                // abort if requested
-                if (as.abort_requested()) {
-                    return ss::now();
-                }
-                /*
-                 * Skip non-regular files (including links)
-                 */
-                if (
-                  !seg.type || *seg.type != ss::directory_entry_type::regular) {
-                    return ss::make_ready_future<>();
-                }
-
-                auto path = segment_full_path::parse(ppath, seg.name);
-                if (!path) {
-                    // This is normal, we skip non-log files like indices
-                    return ss::make_ready_future<>();
-                }
-
-                return open_segment(
-                         *path,
-                         cache_factory(),
-                         buf_size,
-                         read_ahead,
-                         resources,
-                         feature_table,
-                         san_cfg)
-                  .then([&segs](ss::lw_shared_ptr<segment> p) {
-                      segs.push_back(std::move(p));
-                  });
-            });
+    std::vector<segment_full_path> paths;
+    co_await directory_walker::walk(
+      ss::sstring(ppath), [&ppath, &paths](ss::directory_entry seg) {
           /*
-           * if the directory walker returns an exceptional future then all
-           * the segment readers that were created are cleaned up by
-           * ss::do_with.
+           * Skip non-regular files (including links)
            */
-          return f.then([&segs]() mutable {
-              return ss::make_ready_future<segs_type>(std::move(segs));
-          });
+          if (!seg.type || *seg.type != ss::directory_entry_type::regular) {
+              return ss::now();
+          }
+
+          // This is normal, we skip non-log files like indices
+          auto path = segment_full_path::parse(ppath, seg.name);
+          if (path) {
+              paths.push_back(std::move(*path));
+          }
+          return ss::now();
       });
+
+    /*
+     * if opening any segment fails then all the segment readers that were
+     * created are cleaned up when `segs` goes out of scope.
+     */
+    segment_set::underlying_t segs;
+    segs.reserve(paths.size());
+    co_await ss::max_concurrent_for_each(
+      paths,
+      resources.segment_recovery_concurrency(),
+      [&](const segment_full_path& path) -> ss::future<> {
+          // abort if requested
+          if (as.abort_requested()) {
+              co_return;
+          }
+          auto units = co_await resources.get_segment_recovery_units();
+          auto seg = co_await open_segment(
+            path,
+            cache_factory(),
+            buf_size,
+            read_ahead,
+            resources,
+            feature_table,
+            ntp_sanitizer_config);
+          segs.push_back(std::move(seg));
+      });
+    co_return segs;
 }
 
 ss::future<segment_set> recover_segments(
@@ -490,6 +523,7 @@ ss::future<segment_set> recover_segments(
             ntp_sanitizer_config);
       })
       .then([&as,
+             &resources,
              is_compaction_enabled,
              last_clean_segment = std::move(last_clean_segment)](
               segment_set::underlying_t segs) {
@@ -501,7 +535,8 @@ ss::future<segment_set> recover_segments(
                   s->mark_as_compacted_segment();
               }
           }
-          return do_recover(std::move(segments), last_clean_segment, as);
+          return do_recover(
+            std::move(segments), last_clean_segment, resources, as);
       });
 }
 
@@ -12,6 +12,7 @@
 #include "storage_resources.h"
 
 #include "config/configuration.h"
+#include "resource_mgmt/semaphore_metrics.h"
 #include "storage/chunk_cache.h"
 #include "storage/logger.h"
 #include "vlog.h"
@@ -20,6 +21,10 @@ namespace {
 uint64_t per_shard_target_replay_bytes(uint64_t global_target_replay_bytes) {
     return global_target_replay_bytes / ss::smp::count;
 }
+
+ss::lw_shared_ptr<semaphore_wait_stats> wait_stats(const ss::sstring& name) {
+    return resources::semaphore_metrics::local().stats(name);
+}
 } // namespace
 
 namespace storage {
@@ -33,6 +38,14 @@ storage_resources::storage_resources(
   , _global_target_replay_bytes(target_replay_bytes)
   , _max_concurrent_replay(max_concurrent_replay)
   , _compaction_index_mem_limit(compaction_index_memory)
+  , _readahead_mem_limit(
+      config::shard_local_cfg().storage_read_readahead_memory.bind())
+  , _max_concurrent_fsyncs(
+      config::shard_local_cfg().storage_max_concurrent_fsyncs.bind())
+  , _segment_recovery_concurrency(
+      config::shard_local_cfg().storage_recovery_concurrency.bind())
+  , _max_concurrent_stm_snapshots(
+      config::shard_local_cfg().storage_max_concurrent_stm_snapshots.bind())
   , _append_chunk_size(internal::chunks().chunk_size())
   , _offset_translator_dirty_bytes(
       _global_target_replay_bytes() / ss::smp::count)
@@ -41,9 +54,29 @@ storage_resources::storage_resources(
   , _stm_dirty_bytes(_global_target_replay_bytes() / ss::smp::count)
   , _compaction_index_bytes(_compaction_index_mem_limit())
   , _inflight_recovery(
-      std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1}))
+      std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1}),
+      "s/recovery",
+      wait_stats("s/recovery"))
   , _inflight_close_flush(
-      std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1})) {
+      std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1}),
+      "s/close-flush",
+      wait_stats("s/close-flush"))
+  , _inflight_compaction_compression(
+      1, "s/compaction-compression", wait_stats("s/compaction-compression"))
+  , _readahead_bytes(
+      _readahead_mem_limit(), "s/readahead", wait_stats("s/readahead"))
+  , _inflight_fsyncs(
+      _max_concurrent_fsyncs(), "s/fsync", wait_stats("s/fsync"))
+  , _inflight_segment_recovery(
+      _segment_recovery_concurrency(),
+      "s/segment-recovery",
+      wait_stats("s/segment-recovery"))
+  , _inflight_stm_snapshots(
+      _max_concurrent_stm_snapshots(),
+      "s/stm-snapshot",
+      wait_stats("s/stm-snapshot")) {
+    register_held_units();
+
     // Register notifications on configuration changes
     _global_target_replay_bytes.watch([this]() {
         auto v = per_shard_target_replay_bytes(_global_target_replay_bytes());
@@ -68,6 +101,21 @@ storage_resources::storage_resources(
     _compaction_index_mem_limit.watch([this] {
         _compaction_index_bytes.set_capacity(_compaction_index_mem_limit());
     });
+
+    _readahead_mem_limit.watch(
+      [this] { _readahead_bytes.set_capacity(_readahead_mem_limit()); });
+
+    _max_concurrent_fsyncs.watch(
+      [this] { _inflight_fsyncs.set_capacity(_max_concurrent_fsyncs()); });
+
+    _segment_recovery_concurrency.watch([this] {
+        _inflight_segment_recovery.set_capacity(
+          _segment_recovery_concurrency());
+    });
+
+    _max_concurrent_stm_snapshots.watch([this] {
+        _inflight_stm_snapshots.set_capacity(_max_concurrent_stm_snapshots());
+    });
 }
 
 // Unit test convenience for tests that want to control the falloc step
@@ -86,6 +134,23 @@ storage_resources::storage_resources()
     config::shard_local_cfg().storage_max_concurrent_replay.bind(),
     config::shard_local_cfg().storage_compaction_index_memory.bind()) {}
 
+void storage_resources::register_held_units() {
+    auto reg = [this](const ss::sstring& name, const adjustable_semaphore& s) {
+        auto holder = resources::semaphore_metrics::local().register_held_units(
+          name, [&s] { return s.outstanding(); });
+        if (holder) {
+            _held_units_reporters.push_back(std::move(holder));
+        }
+    };
+    reg("s/recovery", _inflight_recovery);
+    reg("s/close-flush", _inflight_close_flush);
+    reg("s/compaction-compression", _inflight_compaction_compression);
+    reg("s/readahead", _readahead_bytes);
+    reg("s/fsync", _inflight_fsyncs);
+    reg("s/segment-recovery", _inflight_segment_recovery);
+    reg("s/stm-snapshot", _inflight_stm_snapshots);
+}
+
 void storage_resources::update_allowance(uint64_t total, uint64_t free) {
     // TODO: also take as an input the disk consumption of the SI cache:
     // it knows this because it calculates it when doing periodic trimming.
@@ -251,4 +316,24 @@ storage_resources::compaction_index_take_bytes(size_t bytes) {
     return _compaction_index_bytes.take(bytes);
 }
 
+storage_resources::readahead_units
+storage_resources::take_readahead(unsigned requested, size_t buffer_size) {
+    // Degrade gracefully under memory pressure: a few read-ahead buffers are
+    // much better than none for a sequential reader.
+    for (auto n = requested; n > 0; n /= 2) {
+        auto units = _readahead_bytes.try_get_units(n * buffer_size);
+        if (units) {
+            return {.read_ahead = n, .units = std::move(*units)};
+        }
+    }
+
+    vlog(
+      stlog.trace,
+      "read-ahead budget exhausted: requested {} x {} (current {})",
+      requested,
+      buffer_size,
+      _readahead_bytes.current());
+    return {};
+}
+
 } // namespace storage
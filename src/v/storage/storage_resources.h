@@ -12,11 +12,13 @@
 #pragma once
 
 #include "config/property.h"
+#include "resource_mgmt/semaphore_metrics.h"
 #include "ssx/semaphore.h"
 #include "units.h"
 #include "utils/adjustable_semaphore.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace storage {
 
@@ -83,6 +85,44 @@ public:
         return _inflight_compaction_compression.get_units(1);
     }
 
+    ss::future<ssx::semaphore_units> get_fsync_units() {
+        return _inflight_fsyncs.get_units(1);
+    }
+
+    /**
+     * Units for a single segment open, index load or segment replay during
+     * startup recovery. Shared by all partitions on the shard.
+     */
+    ss::future<ssx::semaphore_units> get_segment_recovery_units() {
+        return _inflight_segment_recovery.get_units(1);
+    }
+
+    /**
+     * Units for a state machine snapshot written in the background. Shared by
+     * all the state machines on the shard.
+     */
+    ss::future<ssx::semaphore_units> get_stm_snapshot_units() {
+        return _inflight_stm_snapshots.get_units(1);
+    }
+
+    size_t segment_recovery_concurrency() const {
+        return _segment_recovery_concurrency();
+    }
+
+    struct readahead_units {
+        // Number of read-ahead buffers the holder may use
+        unsigned read_ahead{0};
+        ssx::semaphore_units units;
+    };
+
+    /**
+     * Reserve memory for up to `requested` read-ahead buffers of
+     * `buffer_size` bytes each. Fewer buffers (possibly zero) are granted
+     * when the shard-wide read-ahead budget is exhausted. The returned units
+     * should be held for as long as the stream using them is open.
+     */
+    readahead_units take_readahead(unsigned requested, size_t buffer_size);
+
     /**
      * An adjustable_semaphore will set checkpoint_hint whenever its units
      * are exhausted, but this can happen with pathological frequency if
@@ -103,6 +143,8 @@ public:
     void update_min_checkpoint_bytes();
 
 private:
+    void register_held_units();
+
     uint64_t _space_allowance{9};
     uint64_t _space_allowance_free{0};
 
@@ -111,6 +153,10 @@ private:
     config::binding<uint64_t> _global_target_replay_bytes;
     config::binding<uint64_t> _max_concurrent_replay;
     config::binding<uint64_t> _compaction_index_mem_limit;
+    config::binding<size_t> _readahead_mem_limit;
+    config::binding<size_t> _max_concurrent_fsyncs;
+    config::binding<size_t> _segment_recovery_concurrency;
+    config::binding<size_t> _max_concurrent_stm_snapshots;
     size_t _append_chunk_size;
 
     // A lower bound on how many units a caller must have to be
@@ -156,6 +202,26 @@ private:
     // memory footprint compared with the batch's original size, we must
     // limit how many of these we do in parallel.
     adjustable_semaphore _inflight_compaction_compression{1};
+
+    // How much memory may segment readers on this shard use for read-ahead
+    // buffers beyond the buffer currently being consumed.
+    adjustable_semaphore _readahead_bytes{0};
+
+    // How many segment files may be fsync'd concurrently? Appenders waiting
+    // for a slot coalesce their flush requests, so under load this trades
+    // fsync count for batching rather than adding requests.
+    adjustable_semaphore _inflight_fsyncs{0};
+
+    // How many segments may be opened, have their index loaded or be
+    // replayed concurrently while partitions are recovered on startup?
+    adjustable_semaphore _inflight_segment_recovery{0};
+
+    // How many state machine snapshots may be written in the background
+    // concurrently, e.g. after the segments of many partitions rolled?
+    adjustable_semaphore _inflight_stm_snapshots{0};
+
+    std::vector<resources::semaphore_metrics::deregister_holder>
+      _held_units_reporters;
 };
 
 } // namespace storage
@@ -311,3 +311,88 @@ FIXTURE_TEST(test_random_batch_sizes, batch_cache_test_fixture) {
         BOOST_REQUIRE_LE(r.waste(), max_waste);
     }
 }
+
+FIXTURE_TEST(probe_statistics, batch_cache_test_fixture) {
+    storage::batch_cache_index index(cache);
+    const auto& probe = cache.probe();
+
+    index.put(make_batch(10, model::offset(0)));
+    index.put(make_batch(10, model::offset(10)));
+    BOOST_CHECK_GT(probe.bytes_inserted(), 0);
+    BOOST_CHECK_EQUAL(probe.cache_hits(), 0);
+    BOOST_CHECK_EQUAL(probe.cache_misses(), 0);
+
+    // small batches share one range whose unused space is counted as waste
+    BOOST_CHECK_GT(cache.waste_bytes(), 0);
+    BOOST_CHECK_LT(cache.waste_bytes(), cache.size_bytes());
+
+    BOOST_CHECK(index.get(model::offset(5)));
+    BOOST_CHECK(!index.get(model::offset(100)));
+    BOOST_CHECK_EQUAL(probe.cache_hits(), 1);
+    BOOST_CHECK_EQUAL(probe.cache_misses(), 1);
+
+    auto res = index.read(
+      model::offset(0),
+      model::offset(19),
+      std::nullopt,
+      std::nullopt,
+      1_MiB,
+      false);
+    BOOST_CHECK_EQUAL(res.batches.size(), 2);
+    BOOST_CHECK_EQUAL(probe.cache_hits(), 2);
+
+    res = index.read(
+      model::offset(50),
+      model::offset(60),
+      std::nullopt,
+      std::nullopt,
+      1_MiB,
+      false);
+    BOOST_CHECK(res.batches.empty());
+    BOOST_CHECK_EQUAL(probe.cache_misses(), 2);
+
+    const auto size = cache.reclaim(1);
+    BOOST_CHECK_EQUAL(probe.reclaims(), 1);
+    BOOST_CHECK_EQUAL(probe.bytes_reclaimed(), size);
+    BOOST_CHECK_EQUAL(cache.size_bytes(), 0);
+    BOOST_CHECK_EQUAL(cache.waste_bytes(), 0);
+}
+
+FIXTURE_TEST(probe_evicted_bytes, batch_cache_test_fixture) {
+    storage::batch_cache_index index(cache);
+
+    auto w = cache.put(index, make_batch(100));
+    const auto inserted = cache.probe().bytes_inserted();
+    cache.evict(std::move(w.range()));
+    BOOST_CHECK_EQUAL(cache.probe().bytes_evicted(), inserted);
+    BOOST_CHECK_EQUAL(cache.waste_bytes(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(admission_filter) {
+    auto filter_opts = opts;
+    filter_opts.admission_filter = true;
+    storage::batch_cache cache(filter_opts);
+    auto stop = ss::defer([&cache] { cache.stop().get(); });
+    storage::batch_cache_index index(cache);
+
+    // appended batches bypass the filter
+    index.put(make_batch(10, model::offset(0)));
+    BOOST_CHECK(index.get(model::offset(0)));
+
+    // a batch read from disk once is not cached
+    index.put_if_admitted(make_batch(10, model::offset(10)));
+    BOOST_CHECK(!index.get(model::offset(10)));
+    BOOST_CHECK_EQUAL(cache.probe().admission_rejects(), 1);
+
+    // but it is once it has been read again
+    index.put_if_admitted(make_batch(10, model::offset(10)));
+    BOOST_CHECK(index.get(model::offset(10)));
+    BOOST_CHECK_EQUAL(cache.probe().admission_rejects(), 1);
+}
+
+FIXTURE_TEST(admission_filter_disabled, batch_cache_test_fixture) {
+    storage::batch_cache_index index(cache);
+    index.put_if_admitted(make_batch(10, model::offset(0)));
+    BOOST_CHECK(index.get(model::offset(0)));
+    BOOST_CHECK_EQUAL(cache.probe().admission_rejects(), 0);
+}
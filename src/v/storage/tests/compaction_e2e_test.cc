@@ -254,6 +254,34 @@ TEST_F(CompactionFixtureTest, TestDedupeMultiPass) {
     ASSERT_NO_FATAL_FAILURE(check_records(cardinality, num_segments - 1).get());
 }
 
+// Same as above, but consecutive windows are compacted in a single call.
+TEST_F(CompactionFixtureTest, TestDedupeMultiWindow) {
+    constexpr auto duplicates_per_key = 10;
+    constexpr auto num_segments = 25;
+    constexpr auto total_records = 100;
+    constexpr auto cardinality = total_records / duplicates_per_key; // 10
+    size_t records_per_segment = total_records / num_segments;       // 4
+    generate_data(num_segments, cardinality, records_per_segment).get();
+
+    ss::abort_source never_abort;
+    auto& disk_log = dynamic_cast<storage::disk_log_impl&>(*log);
+    storage::compaction_config cfg(
+      disk_log.segments().back()->offsets().base_offset,
+      ss::default_priority_class(),
+      never_abort,
+      std::nullopt,
+      cardinality - 1);
+    ASSERT_TRUE(disk_log.multi_window_compact(cfg, num_segments).get());
+    auto segments_compacted = disk_log.get_probe().get_segments_compacted();
+
+    // Every window was deduplicated, so compacting again is a no-op.
+    ASSERT_FALSE(disk_log.multi_window_compact(cfg, num_segments).get());
+    ASSERT_EQ(
+      segments_compacted, disk_log.get_probe().get_segments_compacted());
+
+    ASSERT_NO_FATAL_FAILURE(check_records(cardinality, num_segments - 1).get());
+}
+
 class CompactionFixtureBatchSizeParamTest
   : public CompactionFixtureTest
   , public ::testing::WithParamInterface<size_t> {};
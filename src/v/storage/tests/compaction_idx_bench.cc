@@ -11,6 +11,8 @@
 #include "random/generators.h"
 #include "storage/compacted_index.h"
 #include "storage/compaction_reducers.h"
+#include "storage/key_offset_map.h"
+#include "units.h"
 
 #include <seastar/core/loop.hh>
 #include <seastar/core/reactor.hh>
@@ -40,3 +42,53 @@ PERF_TEST_F(reducer_bench, compaction_key_reducer_test) {
         perf_tests::stop_measuring_time();
     });
 }
+
+namespace {
+constexpr size_t map_bench_keys = 100'000;
+
+std::vector<storage::compaction_key> make_map_bench_keys() {
+    std::vector<storage::compaction_key> keys;
+    keys.reserve(map_bench_keys);
+    for (size_t i = 0; i < map_bench_keys; ++i) {
+        keys.emplace_back(random_generators::get_bytes(20));
+    }
+    return keys;
+}
+} // namespace
+
+struct hash_key_offset_map_bench {};
+
+PERF_TEST_C(hash_key_offset_map_bench, put) {
+    storage::hash_key_offset_map map;
+    co_await map.initialize(8_MiB);
+    const auto keys = make_map_bench_keys();
+
+    perf_tests::start_measuring_time();
+    model::offset o{0};
+    for (const auto& key : keys) {
+        co_await map.put(key, o++);
+    }
+    perf_tests::stop_measuring_time();
+
+    co_await map.initialize(0);
+    co_return keys.size();
+}
+
+PERF_TEST_C(hash_key_offset_map_bench, get) {
+    storage::hash_key_offset_map map;
+    co_await map.initialize(8_MiB);
+    const auto keys = make_map_bench_keys();
+    model::offset o{0};
+    for (const auto& key : keys) {
+        co_await map.put(key, o++);
+    }
+
+    perf_tests::start_measuring_time();
+    for (const auto& key : keys) {
+        perf_tests::do_not_optimize(co_await map.get(key));
+    }
+    perf_tests::stop_measuring_time();
+
+    co_await map.initialize(0);
+    co_return keys.size();
+}
@@ -205,7 +205,9 @@ TEST(HashKeyOffsetMapTest, HitRate) {
         ++i;
     }
 
-    EXPECT_LE(map.hit_rate(), 0.3) << fmt::format("Inserted {}", i);
+    // most searches are resolved by the first group even when filling the
+    // map all the way to its maximum load factor
+    EXPECT_GE(map.hit_rate(), 0.7) << fmt::format("Inserted {}", i);
 }
 
 TEST(HashKeyOffsetMapTest, Initialize) {
@@ -261,3 +263,39 @@ TEST(HashKeyOffsetMapTest, Initialize) {
         ASSERT_EQ(val.value(), model::offset(99));
     }
 }
+
+TEST(HashKeyOffsetMapTest, MissingKeys) {
+    storage::hash_key_offset_map map;
+    map.initialize(1_MiB).get();
+
+    int count = 0;
+    for (;; ++count) {
+        const auto key = fmt::format("key-{}", count);
+        storage::compaction_key ck(bytes(key.begin(), key.end()));
+        if (!map.put(ck, model::offset(count)).get()) {
+            break;
+        }
+    }
+    EXPECT_EQ(map.size(), map.capacity());
+
+    // a full map can still be updated, and never reports keys it doesn't have
+    for (int i = 0; i < count; ++i) {
+        const auto key = fmt::format("key-{}", i);
+        storage::compaction_key ck(bytes(key.begin(), key.end()));
+        ASSERT_TRUE(map.put(ck, model::offset(count + i)).get());
+        ASSERT_EQ(map.get(ck).get(), model::offset(count + i));
+    }
+    for (int i = count; i < 2 * count; ++i) {
+        const auto key = fmt::format("key-{}", i);
+        storage::compaction_key ck(bytes(key.begin(), key.end()));
+        ASSERT_EQ(map.get(ck).get(), std::nullopt);
+    }
+}
+
+TEST(HashKeyOffsetMapTest, EntryFootprint) {
+    // 128-bit digests keep entries small enough that the same memory budget
+    // holds more keys than the previous 32-byte digests allowed.
+    storage::hash_key_offset_map map;
+    map.initialize(1_MiB).get();
+    EXPECT_GE(map.capacity(), 1_MiB / 32 * 95 / 100);
+}
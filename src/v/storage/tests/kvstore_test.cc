@@ -187,3 +187,109 @@ FIXTURE_TEST(kvstore, kvstore_test_fixture) {
     }
     kvs->stop().get();
 }
+
+FIXTURE_TEST(kvstore_put_many, kvstore_test_fixture) {
+    set_configuration("disable_metrics", true);
+    using ks = storage::kvstore::key_space;
+
+    auto kvs = make_kvstore();
+    kvs->start().get();
+
+    std::unordered_map<bytes, iobuf> truth;
+    std::vector<storage::kvstore::key_value> batch;
+    for (int i = 0; i < 100; i++) {
+        auto key = random_generators::get_bytes(8);
+        auto value = bytes_to_iobuf(random_generators::get_bytes(100));
+        truth[key] = value.copy();
+        batch.push_back({.key = key, .value = std::move(value)});
+    }
+    // rewrites of a key within one flush are combined, the last one wins
+    auto rewritten = truth.begin()->first;
+    auto final_value = bytes_to_iobuf(random_generators::get_bytes(100));
+    batch.push_back(
+      {.key = rewritten,
+       .value = bytes_to_iobuf(random_generators::get_bytes(100))});
+    batch.push_back({.key = rewritten, .value = final_value.copy()});
+    truth[rewritten] = final_value.copy();
+    kvs->put_many(ks::testing, std::move(batch)).get();
+
+    // remove half of the keys in one go
+    std::vector<bytes> removed;
+    for (auto it = truth.begin(); it != truth.end();) {
+        if (removed.size() < truth.size() / 2 && it->first != rewritten) {
+            removed.push_back(it->first);
+            it = truth.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    kvs->remove_many(ks::testing, removed).get();
+
+    auto check = [&] {
+        for (auto& [key, value] : truth) {
+            BOOST_REQUIRE(kvs->get(ks::testing, key).value() == value);
+        }
+        for (auto& key : removed) {
+            BOOST_REQUIRE(!kvs->get(ks::testing, key));
+        }
+    };
+    check();
+    kvs->stop().get();
+
+    // recovery replays the combined batches to the same state
+    kvs = make_kvstore();
+    kvs->start().get();
+    check();
+    kvs->stop().get();
+}
+
+FIXTURE_TEST(kvstore_key_space_snapshots, kvstore_test_fixture) {
+    set_configuration("disable_metrics", true);
+    using ks = storage::kvstore::key_space;
+
+    std::unordered_map<bytes, iobuf> testing;
+    std::unordered_map<bytes, iobuf> consensus;
+    auto put = [](
+                 storage::kvstore& kvs,
+                 ks space,
+                 std::unordered_map<bytes, iobuf>& truth) {
+        auto key = random_generators::get_bytes(8);
+        auto value = bytes_to_iobuf(random_generators::get_bytes(100));
+        truth[key] = value.copy();
+        kvs.put(space, key, std::move(value)).get();
+    };
+    auto check = [&](storage::kvstore& kvs) {
+        for (auto& [key, value] : testing) {
+            BOOST_REQUIRE(kvs.get(ks::testing, key).value() == value);
+        }
+        for (auto& [key, value] : consensus) {
+            BOOST_REQUIRE(kvs.get(ks::consensus, key).value() == value);
+        }
+    };
+
+    auto kvs = make_kvstore();
+    kvs->start().get();
+    // both key spaces are written, enough to roll and snapshot a few times
+    for (int i = 0; i < 200; i++) {
+        put(*kvs, ks::testing, testing);
+        put(*kvs, ks::consensus, consensus);
+    }
+    // only one key space is written, the other's snapshot becomes older
+    for (int i = 0; i < 300; i++) {
+        put(*kvs, ks::testing, testing);
+    }
+    check(*kvs);
+    kvs->stop().get();
+
+    // recovery combines snapshots taken at different offsets with the log
+    kvs = make_kvstore();
+    kvs->start().get();
+    check(*kvs);
+    put(*kvs, ks::consensus, consensus);
+    kvs->stop().get();
+
+    kvs = make_kvstore();
+    kvs->start().get();
+    check(*kvs);
+    kvs->stop().get();
+}
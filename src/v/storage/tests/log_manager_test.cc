@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/record_utils.h"
 #include "model/tests/random_batch.h"
@@ -142,3 +143,67 @@ SEASTAR_THREAD_TEST_CASE(test_can_load_logs) {
     BOOST_CHECK(
       file_exists(seg4->reader().filename() + ".cannotrecover").get0());
 }
+
+SEASTAR_THREAD_TEST_CASE(test_concurrent_segment_recovery) {
+    auto conf = make_config();
+    config::shard_local_cfg().storage_recovery_concurrency.set_value(
+      size_t{3});
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg().storage_recovery_concurrency.reset();
+    });
+
+    ss::sharded<features::feature_table> feature_table;
+    feature_table.start().get();
+    feature_table
+      .invoke_on_all(
+        [](features::feature_table& f) { f.testing_activate_all(); })
+      .get();
+
+    storage::api store(
+      [conf]() {
+          return storage::kvstore_config(
+            1_MiB,
+            config::mock_binding(10ms),
+            conf.base_dir,
+            storage::make_sanitized_file_config());
+      },
+      [conf]() { return conf; },
+      feature_table);
+    store.start().get();
+    auto stop_kvstore = ss::defer([&store, &feature_table] {
+        store.stop().get();
+        feature_table.stop().get();
+    });
+    auto& m = store.log_mgr();
+    auto ntp = config_from_ntp(model::ntp("ns-recovery", "topic-1", 0));
+    directories::initialize(ntp.work_directory()).get();
+
+    constexpr size_t segment_count = 10;
+    std::vector<ss::sstring> names;
+    for (size_t i = 0; i < segment_count; ++i) {
+        auto seg = m.make_log_segment(
+                      ntp,
+                      model::offset(i * 10'000),
+                      model::term_id(1),
+                      ss::default_priority_class(),
+                      default_segment_readahead_size,
+                      default_segment_readahead_count)
+                     .get0();
+        write_batches(seg);
+        seg->close().get();
+        // drop every other index so that those segments are replayed
+        if (i % 2 == 0) {
+            ss::remove_file(seg->index().path().string()).get();
+        }
+        names.push_back(seg->reader().filename());
+    }
+
+    auto log = m.manage(config_from_ntp(ntp.ntp())).get0();
+    BOOST_REQUIRE_EQUAL(log->segment_count(), segment_count);
+    for (const auto& name : names) {
+        BOOST_CHECK(file_exists(name).get0());
+    }
+    BOOST_CHECK_GT(
+      log->offsets().dirty_offset,
+      model::offset((segment_count - 1) * 10'000));
+}
@@ -608,3 +608,53 @@ SEASTAR_THREAD_TEST_CASE(test_fallocate_size) {
         run_test_fallocate_size(fallocate_size);
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(test_coalesced_flushes_across_appenders) {
+    // a single fsync slot per shard forces flushes from concurrent appenders
+    // to queue and coalesce
+    config::shard_local_cfg().storage_max_concurrent_fsyncs.set_value(
+      size_t{1});
+    auto reset_cfg = ss::defer(
+      [] { config::shard_local_cfg().storage_max_concurrent_fsyncs.reset(); });
+
+    constexpr size_t appender_count = 4;
+    constexpr size_t rounds = 20;
+    storage::storage_resources resources(
+      config::mock_binding<size_t>(16_KiB));
+    std::vector<ss::file> files;
+    std::vector<std::unique_ptr<segment_appender>> appenders;
+    for (size_t i = 0; i < appender_count; ++i) {
+        files.push_back(
+          open_file(fmt::format("test_coalesced_flushes_{}.log", i)));
+        appenders.push_back(std::make_unique<segment_appender>(
+          make_segment_appender(files.back(), resources)));
+    }
+    auto close = ss::defer([&appenders] {
+        for (auto& a : appenders) {
+            a->close().get();
+        }
+    });
+
+    const auto data = random_generators::gen_alphanum_string(100);
+    for (size_t r = 0; r < rounds; ++r) {
+        std::vector<ss::future<>> flushes;
+        for (auto& a : appenders) {
+            a->append(data.data(), data.size()).get();
+            // several flushes of the same appender share fsyncs
+            flushes.push_back(a->flush());
+            flushes.push_back(a->flush());
+        }
+        ss::when_all_succeed(flushes.begin(), flushes.end()).get();
+        for (auto& a : appenders) {
+            BOOST_REQUIRE_EQUAL(a->file_byte_offset(), (r + 1) * data.size());
+            BOOST_CHECK_EQUAL(access(*a).inflight_dispatched(), 0);
+        }
+    }
+
+    for (size_t i = 0; i < appender_count; ++i) {
+        auto in = make_file_input_stream(files[i], 0);
+        auto contents = read_iobuf_exactly(in, rounds * data.size()).get0();
+        BOOST_REQUIRE_EQUAL(contents.size_bytes(), rounds * data.size());
+        in.close().get();
+    }
+}
@@ -318,3 +318,27 @@ SEASTAR_THREAD_TEST_CASE(iobuf_is_zero_test) {
     zero.append(zeros.data(), zeros.size());
     BOOST_REQUIRE_EQUAL(storage::internal::is_zero(zero), true);
 }
+
+SEASTAR_THREAD_TEST_CASE(for_each_decompressed_record_test) {
+    const auto batch = model::test::make_random_batch(
+      model::offset(0), 1000, false);
+    const auto expected = batch.copy_records();
+    for (auto c :
+         {model::compression::gzip,
+          model::compression::snappy,
+          model::compression::lz4,
+          model::compression::zstd}) {
+        auto compressed = storage::internal::compress_batch(c, batch.copy())
+                            .get0();
+        std::vector<model::record> records;
+        storage::internal::for_each_decompressed_record(
+          std::move(compressed),
+          [&records](model::record& r) {
+              records.push_back(r.copy());
+              return ss::now();
+          })
+          .get();
+        BOOST_REQUIRE_EQUAL(records.size(), expected.size());
+        BOOST_REQUIRE(records == expected);
+    }
+}
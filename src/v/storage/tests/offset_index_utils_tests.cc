@@ -6,6 +6,7 @@
 // As of the Change Date specified in that file, in accordance with
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
+#include "config/configuration.h"
 #include "random/generators.h"
 #include "serde/serde.h"
 #include "storage/segment_index.h"
@@ -15,6 +16,7 @@
 
 #include <seastar/core/seastar.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/util/defer.hh>
 
 #include <boost/test/tools/old/interface.hpp>
 
@@ -50,6 +52,16 @@ public:
         _base_hdr.size_bytes = batch_size;
         return _base_hdr;
     }
+    // a second index over the same backing file, i.e. as if reopened
+    storage::segment_index_ptr reopen() {
+        return std::unique_ptr<segment_index>(new segment_index(
+          segment_full_path::mock("In memory iobuf"),
+          ss::file(ss::make_shared(tmpbuf_file(_data))),
+          _base_offset,
+          storage::segment_index::default_data_buffer_step,
+          _feature_table));
+    }
+
     void index_entry_expect(uint32_t offset, size_t filepos) {
         auto o = model::offset(offset);
         auto p = _idx->find_nearest(o);
@@ -176,3 +188,86 @@ FIXTURE_TEST(bucket_truncate, offset_index_utils_fixture) {
         BOOST_REQUIRE(bool(!p));
     }
 }
+
+FIXTURE_TEST(paged_index_lookups, offset_index_utils_fixture) {
+    start().get();
+    config::shard_local_cfg().segment_index_resident_stride.set_value(
+      size_t{8});
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg().segment_index_resident_stride.reset();
+    });
+
+    for (uint32_t i = 0; i < 1024; ++i) {
+        model::offset o = _base_offset + model::offset(i);
+        _idx->maybe_track(
+          modify_get(o, storage::segment_index::default_data_buffer_step),
+          std::nullopt,
+          i);
+    }
+    _idx->flush().get();
+
+    auto idx = reopen();
+    BOOST_REQUIRE(idx->materialize_index().get());
+    BOOST_REQUIRE(idx->is_paged());
+    BOOST_REQUIRE_EQUAL(idx->size(), 1024 / 8);
+    BOOST_REQUIRE_EQUAL(idx->max_offset(), model::offset(1023));
+
+    for (uint32_t i : {0, 1, 7, 8, 9, 500, 1016, 1023}) {
+        auto o = model::offset(i);
+        // resident entries only
+        auto coarse = idx->find_nearest(o);
+        BOOST_REQUIRE(coarse);
+        BOOST_REQUIRE_EQUAL(coarse->offset, model::offset(i / 8 * 8));
+        // refined from the index file
+        auto exact = idx->fetch_nearest(o).get();
+        BOOST_REQUIRE(exact);
+        BOOST_REQUIRE_EQUAL(exact->offset, o);
+        BOOST_REQUIRE_EQUAL(exact->filepos, i);
+    }
+
+    // changing the index drops the paged entries
+    idx->truncate(model::offset(100), model::timestamp{0}).get();
+    BOOST_REQUIRE(!idx->is_paged());
+    auto after = idx->fetch_nearest(model::offset(99)).get();
+    BOOST_REQUIRE(after);
+    BOOST_REQUIRE_EQUAL(after->offset, model::offset(96));
+}
+
+FIXTURE_TEST(paged_index_timestamp_lookups, offset_index_utils_fixture) {
+    start().get();
+    config::shard_local_cfg().segment_index_resident_stride.set_value(
+      size_t{8});
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg().segment_index_resident_stride.reset();
+    });
+
+    for (uint32_t i = 0; i < 1024; ++i) {
+        model::offset o = _base_offset + model::offset(i);
+        auto hdr = modify_get(
+          o, storage::segment_index::default_data_buffer_step);
+        hdr.first_timestamp = model::timestamp(i * 10);
+        hdr.max_timestamp = model::timestamp(i * 10 + 5);
+        _idx->maybe_track(hdr, std::nullopt, i);
+    }
+    _idx->flush().get();
+
+    auto idx = reopen();
+    BOOST_REQUIRE(idx->materialize_index().get());
+    BOOST_REQUIRE(idx->is_paged());
+
+    // the paged index finds the same entry as the fully resident one
+    for (model::timestamp::type t :
+         {0, 3, 5, 6, 79, 80, 83, 85, 86, 5003, 10155, 10235, 10236, 20000}) {
+        auto ts = model::timestamp(t);
+        auto expected = _idx->find_nearest(ts);
+        BOOST_REQUIRE(expected);
+        auto exact = idx->fetch_nearest(ts).get();
+        BOOST_REQUIRE(exact);
+        BOOST_REQUIRE_EQUAL(exact->offset, expected->offset);
+        BOOST_REQUIRE_EQUAL(exact->timestamp, expected->timestamp);
+        BOOST_REQUIRE_EQUAL(exact->filepos, expected->filepos);
+    }
+    // the batch before the one containing the timestamp
+    auto e = idx->fetch_nearest(model::timestamp(5003)).get();
+    BOOST_REQUIRE_EQUAL(e->offset, model::offset(499));
+}
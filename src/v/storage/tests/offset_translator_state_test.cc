@@ -151,3 +151,32 @@ SEASTAR_THREAD_TEST_CASE(offset_translator_state_case_2) {
     BOOST_REQUIRE_EQUAL(state.last_delta(), 10_do);
     BOOST_REQUIRE_EQUAL(state.last_gap_offset(), 100_rp);
 }
+
+SEASTAR_THREAD_TEST_CASE(offset_translator_state_compact_serialization) {
+    storage::offset_translator_state state(ntp);
+    BOOST_REQUIRE(state.add_absolute_delta(10_rp, 5));
+    // enough gaps to fill a few encoded rows and a partial one, mostly of
+    // single control batches like a transactional partition has
+    model::offset next = 20_rp;
+    for (int i = 0; i < 100; ++i) {
+        auto length = i % 7 == 0 ? 3 : 1;
+        state.add_gap(next, next + model::offset(length - 1));
+        next += model::offset(length + 1 + i % 5);
+    }
+
+    auto legacy = state.serialize_map();
+    auto compact = state.serialize_map(true);
+    BOOST_REQUIRE_LT(compact.size_bytes(), legacy.size_bytes());
+
+    auto from_legacy = storage::offset_translator_state::from_serialized_map(
+      ntp, std::move(legacy));
+    auto from_compact = storage::offset_translator_state::from_serialized_map(
+      ntp, std::move(compact));
+    BOOST_REQUIRE_EQUAL(from_compact.last_delta(), state.last_delta());
+    BOOST_REQUIRE_EQUAL(
+      from_compact.last_gap_offset(), state.last_gap_offset());
+    for (auto o = 11_rp; o < next; ++o) {
+        BOOST_REQUIRE_EQUAL(from_compact.delta(o), state.delta(o));
+        BOOST_REQUIRE_EQUAL(from_legacy.delta(o), state.delta(o));
+    }
+}
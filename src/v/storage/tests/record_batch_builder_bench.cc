@@ -0,0 +1,72 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "random/generators.h"
+#include "storage/record_batch_builder.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <vector>
+
+namespace {
+
+struct kv {
+    iobuf key;
+    iobuf value;
+};
+
+std::vector<kv> make_records(size_t count, size_t key_size, size_t value_size) {
+    std::vector<kv> ret;
+    ret.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        ret.push_back(
+          {.key = random_generators::make_iobuf(key_size),
+           .value = random_generators::make_iobuf(value_size)});
+    }
+    return ret;
+}
+
+/*
+ * Builds a batch of the given records, e.g. the offset commits of a group
+ * or the operations of a kvstore flush, with or without reserving its
+ * memory ahead.
+ */
+size_t
+build(size_t count, size_t key_size, size_t value_size, bool reserve) {
+    const auto records = make_records(count, key_size, value_size);
+    perf_tests::start_measuring_time();
+    storage::record_batch_builder builder(
+      model::record_batch_type::raft_data, model::offset(0));
+    if (reserve) {
+        builder.reserve(count, count * (key_size + value_size));
+    }
+    for (const auto& r : records) {
+        builder.add_raw_kv(r.key.copy(), r.value.copy());
+    }
+    auto batch = std::move(builder).build();
+    perf_tests::do_not_optimize(batch);
+    perf_tests::stop_measuring_time();
+    return count;
+}
+
+} // namespace
+
+PERF_TEST(record_batch_builder, small_records) {
+    return build(1000, 16, 64, false);
+}
+PERF_TEST(record_batch_builder, small_records_reserved) {
+    return build(1000, 16, 64, true);
+}
+PERF_TEST(record_batch_builder, medium_records) {
+    return build(100, 32, 4096, false);
+}
+PERF_TEST(record_batch_builder, medium_records_reserved) {
+    return build(100, 32, 4096, true);
+}
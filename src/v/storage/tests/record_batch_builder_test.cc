@@ -9,12 +9,15 @@
  * by the Apache License, Version 2.0
  */
 
+#include "bytes/bytes.h"
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
 #include "model/record.h"
+#include "model/record_utils.h"
 #include "random/generators.h"
 #include "reflection/adl.h"
 #include "storage/record_batch_builder.h"
+#include "units.h"
 
 #include <seastar/testing/thread_test_case.hh>
 
@@ -144,3 +147,57 @@ SEASTAR_THREAD_TEST_CASE(serialize_deserialize_then_cmp) {
     });
     BOOST_CHECK_EQUAL(sample_data, sample_output);
 }
+
+SEASTAR_THREAD_TEST_CASE(reserved_builder_matches_record_encoding) {
+    // records built with and without a reservation, including records past
+    // it, are encoded as model::append_record_to_buffer() does
+    for (size_t reserved : {0, 10, 100}) {
+        storage::record_batch_builder rbb(
+          model::record_batch_type::raft_data, model::offset(0));
+        rbb.reserve(reserved, reserved * 1_KiB);
+        std::vector<model::record> expected;
+        for (int i = 0; i < 50; ++i) {
+            auto key = random_generators::make_iobuf(
+              random_generators::get_int(0, 64));
+            auto value = random_generators::make_iobuf(
+              random_generators::get_int(0, 4096));
+            std::vector<model::record_header> headers;
+            if (i % 3 == 0) {
+                headers.emplace_back(
+                  3, bytes_to_iobuf(bytes("abc")), -1, iobuf{});
+            }
+            std::vector<model::record_header> headers_copy;
+            for (const auto& h : headers) {
+                headers_copy.push_back(h.copy());
+            }
+            rbb.add_raw_kw(key.copy(), value.copy(), std::move(headers_copy));
+            const auto key_size = static_cast<int32_t>(key.size_bytes());
+            const auto value_size = static_cast<int32_t>(value.size_bytes());
+            int32_t size = 1 + 1 + vint::vint_size(i)
+                           + vint::vint_size(key_size) + key_size
+                           + vint::vint_size(value_size) + value_size
+                           + vint::vint_size(headers.size());
+            for (const auto& h : headers) {
+                size += vint::vint_size(h.key_size()) + h.key_size()
+                        + vint::vint_size(h.value_size());
+            }
+            expected.emplace_back(
+              size,
+              model::record_attributes{},
+              0,
+              i,
+              key_size,
+              std::move(key),
+              value_size,
+              std::move(value),
+              std::move(headers));
+        }
+        auto batch = std::move(rbb).build();
+        iobuf encoded;
+        for (const auto& r : expected) {
+            model::append_record_to_buffer(encoded, r);
+        }
+        BOOST_REQUIRE_EQUAL(batch.data(), encoded);
+        BOOST_REQUIRE(batch.copy_records() == expected);
+    }
+}
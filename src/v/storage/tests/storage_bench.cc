@@ -0,0 +1,237 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/mock_property.h"
+#include "features/feature_table.h"
+#include "model/record_batch_reader.h"
+#include "model/tests/random_batch.h"
+#include "random/generators.h"
+#include "storage/batch_cache.h"
+#include "storage/segment_appender.h"
+#include "storage/segment_index.h"
+#include "storage/storage_resources.h"
+#include "storage/tests/utils/disk_log_builder.h"
+#include "units.h"
+#include "utils/tmpbuf_file.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/testing/perf_tests.hh>
+
+/*
+ * Microbenchmarks of the storage data path: raw appends, log reads, index
+ * lookups and the batch cache. Each one isolates a single layer so that a
+ * regression can be attributed without running a full broker.
+ */
+
+namespace {
+
+ss::future<size_t> run_appender(size_t write_size, size_t fallocate_size) {
+    constexpr size_t total_bytes = 16_MiB;
+    storage::storage_resources resources(
+      config::mock_binding<size_t>(std::move(fallocate_size)));
+    auto f = co_await ss::open_file_dma(
+      "test.storage_bench.appender",
+      ss::open_flags::create | ss::open_flags::rw | ss::open_flags::truncate);
+    storage::segment_appender appender(
+      std::move(f),
+      storage::segment_appender::options(
+        ss::default_priority_class(), 1, std::nullopt, resources));
+    auto data = random_generators::get_bytes(write_size);
+
+    perf_tests::start_measuring_time();
+    for (size_t written = 0; written < total_bytes; written += write_size) {
+        co_await appender.append(bytes_view(data));
+    }
+    co_await appender.flush();
+    perf_tests::stop_measuring_time();
+
+    co_await appender.close();
+    co_return total_bytes / write_size;
+}
+
+} // namespace
+
+struct appender_bench {};
+
+PERF_TEST_C(appender_bench, write_512b) { return run_appender(512, 32_MiB); }
+PERF_TEST_C(appender_bench, write_4KiB) { return run_appender(4_KiB, 32_MiB); }
+PERF_TEST_C(appender_bench, write_64KiB) {
+    return run_appender(64_KiB, 32_MiB);
+}
+PERF_TEST_C(appender_bench, write_4KiB_small_fallocation) {
+    return run_appender(4_KiB, 1_MiB);
+}
+
+struct log_reader_bench {
+    static constexpr int batches = 2000;
+
+    log_reader_bench() {
+        builder.start().get();
+        builder.add_segment(model::offset(0)).get();
+        builder
+          .add_random_batches(
+            model::offset(0), batches, storage::maybe_compress_batches::no)
+          .get();
+        log = builder.get_log();
+        last = log->offsets().dirty_offset;
+    }
+
+    ~log_reader_bench() { builder.stop().get(); }
+
+    ss::future<size_t> read(model::offset start, size_t max_bytes) {
+        storage::log_reader_config cfg(
+          start, last, ss::default_priority_class());
+        cfg.max_bytes = max_bytes;
+        auto reader = co_await log->make_reader(cfg);
+        auto read = co_await model::consume_reader_to_memory(
+          std::move(reader), model::no_timeout);
+        co_return read.size();
+    }
+
+    storage::disk_log_builder builder;
+    ss::shared_ptr<storage::log> log;
+    model::offset last;
+};
+
+PERF_TEST_C(log_reader_bench, sequential_read) {
+    perf_tests::start_measuring_time();
+    auto n = co_await read(
+      model::offset(0), std::numeric_limits<size_t>::max());
+    perf_tests::stop_measuring_time();
+    co_return n;
+}
+
+PERF_TEST_C(log_reader_bench, random_read) {
+    constexpr size_t reads = 100;
+    size_t n = 0;
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < reads; ++i) {
+        auto start = model::offset(random_generators::get_int<int64_t>(last()));
+        n += co_await read(start, 64_KiB);
+    }
+    perf_tests::stop_measuring_time();
+    co_return n;
+}
+
+struct segment_index_bench {
+    static constexpr size_t entries = 100'000;
+    static constexpr int32_t batch_size = 16_KiB;
+
+    segment_index_bench()
+      : idx(
+        storage::segment_full_path::mock("In memory iobuf"),
+        ss::file(ss::make_shared(tmpbuf_file(data))),
+        model::offset(0),
+        storage::segment_index::default_data_buffer_step,
+        feature_table) {
+        feature_table.start().get();
+        feature_table
+          .invoke_on_all(
+            [](features::feature_table& f) { f.testing_activate_all(); })
+          .get();
+        model::record_batch_header hdr;
+        hdr.type = model::record_batch_type::raft_data;
+        hdr.size_bytes = batch_size;
+        for (size_t i = 0; i < entries; ++i) {
+            hdr.base_offset = model::offset(i * 10);
+            hdr.last_offset_delta = 9;
+            hdr.first_timestamp = model::timestamp(i * 10);
+            hdr.max_timestamp = model::timestamp(i * 10 + 9);
+            idx.maybe_track(hdr, std::nullopt, i * batch_size);
+        }
+        idx.flush().get();
+    }
+
+    ~segment_index_bench() { feature_table.stop().get(); }
+
+    model::offset random_offset() const {
+        return model::offset(
+          random_generators::get_int<int64_t>(entries * 10 - 1));
+    }
+
+    tmpbuf_file::store_t data;
+    ss::sharded<features::feature_table> feature_table;
+    storage::segment_index idx;
+};
+
+PERF_TEST_F(segment_index_bench, find_nearest_offset) {
+    auto o = random_offset();
+    perf_tests::start_measuring_time();
+    perf_tests::do_not_optimize(idx.find_nearest(o));
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST_F(segment_index_bench, find_nearest_timestamp) {
+    auto ts = model::timestamp(random_offset()());
+    perf_tests::start_measuring_time();
+    perf_tests::do_not_optimize(idx.find_nearest(ts));
+    perf_tests::stop_measuring_time();
+}
+
+PERF_TEST_C(segment_index_bench, fetch_nearest_offset) {
+    auto o = random_offset();
+    perf_tests::start_measuring_time();
+    perf_tests::do_not_optimize(co_await idx.fetch_nearest(o));
+    perf_tests::stop_measuring_time();
+}
+
+struct batch_cache_bench {
+    static constexpr size_t indices = 32;
+    static constexpr size_t batches_per_index = 256;
+
+    batch_cache_bench()
+      : cache(storage::batch_cache::reclaim_options{
+        .growth_window = std::chrono::milliseconds(3000),
+        .stable_window = std::chrono::milliseconds(10000),
+        .min_size = 128_KiB,
+        .max_size = 4_MiB,
+      }) {
+        index.reserve(indices);
+        for (size_t i = 0; i < indices; ++i) {
+            index.emplace_back(cache);
+        }
+        batches = model::test::make_random_batches(
+          model::offset(0), batches_per_index, false);
+    }
+
+    ~batch_cache_bench() {
+        index.clear();
+        cache.stop().get();
+    }
+
+    storage::batch_cache cache;
+    std::vector<storage::batch_cache_index> index;
+    ss::circular_buffer<model::record_batch> batches;
+};
+
+// many partitions sharing one cache, all of them putting and reading back,
+// which keeps the shared lru list and the reclaimer busy.
+PERF_TEST_F(batch_cache_bench, shared_put_get) {
+    size_t ops = 0;
+    perf_tests::start_measuring_time();
+    for (const auto& b : batches) {
+        for (auto& i : index) {
+            i.put(b);
+            ++ops;
+        }
+    }
+    for (const auto& b : batches) {
+        for (auto& i : index) {
+            perf_tests::do_not_optimize(i.get(b.base_offset()));
+            ++ops;
+        }
+    }
+    perf_tests::stop_measuring_time();
+    for (auto& i : index) {
+        i.truncate(model::offset(0));
+    }
+    return ops;
+}
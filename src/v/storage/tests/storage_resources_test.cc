@@ -0,0 +1,64 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/configuration.h"
+#include "storage/storage_resources.h"
+#include "units.h"
+
+#include <gtest/gtest.h>
+
+using namespace storage;
+
+class StorageResourcesTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        config::shard_local_cfg()
+          .get("storage_read_readahead_memory")
+          .set_value(size_t(1_MiB));
+    }
+
+    void TearDown() override {
+        config::shard_local_cfg().get("storage_read_readahead_memory").reset();
+    }
+};
+
+TEST_F(StorageResourcesTest, ReadaheadGrantedWithinBudget) {
+    storage_resources resources;
+    auto r = resources.take_readahead(4, 128_KiB);
+    EXPECT_EQ(r.read_ahead, 4);
+    EXPECT_EQ(r.units.count(), 512_KiB);
+}
+
+TEST_F(StorageResourcesTest, ReadaheadDegradesUnderPressure) {
+    storage_resources resources;
+    auto r0 = resources.take_readahead(6, 128_KiB);
+    EXPECT_EQ(r0.read_ahead, 6);
+
+    // only 2 buffers worth of budget remain, so 5 is halved to 2
+    auto r1 = resources.take_readahead(5, 128_KiB);
+    EXPECT_EQ(r1.read_ahead, 2);
+
+    auto r2 = resources.take_readahead(1, 128_KiB);
+    EXPECT_EQ(r2.read_ahead, 0);
+    EXPECT_EQ(r2.units.count(), 0);
+
+    // returning units makes budget available again
+    r0 = {};
+    auto r3 = resources.take_readahead(4, 128_KiB);
+    EXPECT_EQ(r3.read_ahead, 4);
+}
+
+TEST_F(StorageResourcesTest, ReadaheadBudgetAdjustable) {
+    storage_resources resources;
+    config::shard_local_cfg()
+      .get("storage_read_readahead_memory")
+      .set_value(size_t(256_KiB));
+    auto r = resources.take_readahead(4, 128_KiB);
+    EXPECT_EQ(r.read_ahead, 2);
+}
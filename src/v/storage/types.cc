@@ -71,6 +71,9 @@ std::ostream& operator<<(std::ostream& o, const log_reader_config& cfg) {
     if (cfg.client_address.has_value()) {
         o << ", client_address:" << cfg.client_address.value();
     }
+    if (cfg.reader_session.has_value()) {
+        o << ", reader_session:" << cfg.reader_session.value();
+    }
     return o << "}";
 }
 
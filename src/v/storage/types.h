@@ -226,6 +226,10 @@ using opt_abort_source_t
 
 using opt_client_address_t = std::optional<model::client_address_t>;
 
+/// identifies a client issuing consecutive reads of a log, f.e. a kafka fetch
+/// session. the readers cache keeps a reader's position for its session.
+using opt_reader_session_t = std::optional<int32_t>;
+
 struct timequery_config {
     timequery_config(
       model::timestamp t,
@@ -336,6 +340,10 @@ struct log_reader_config {
 
     opt_client_address_t client_address;
 
+    // when set, readers cache prefers the reader last used by this session and
+    // doesn't hand it to other sessions.
+    opt_reader_session_t reader_session;
+
     log_reader_config(
       model::offset start_offset,
       model::offset max_offset,
@@ -32,11 +32,13 @@ namespace transform {
 template<typename ClockType>
 commit_batcher<ClockType>::commit_batcher(
   config::binding<std::chrono::milliseconds> commit_interval,
-  std::unique_ptr<offset_committer> oc)
+  std::unique_ptr<offset_committer> oc,
+  size_t max_batched_commits)
   : _offset_committer(std::move(oc))
   , _commit_interval(std::move(commit_interval))
   , _timer(
-      [this] { ssx::spawn_with_gate(_gate, [this] { return flush(); }); }) {}
+      [this] { ssx::spawn_with_gate(_gate, [this] { return flush(); }); })
+  , _max_batched_commits(max_batched_commits) {}
 
 template<typename ClockType>
 ss::future<> commit_batcher<ClockType>::start() {
@@ -106,11 +108,10 @@ ss::future<bool> commit_batcher<ClockType>::assign_coordinators() {
             it = _unbatched.upper_bound(key);
             continue;
         }
-        _batched[coordinator].insert_or_assign(entry.key(), entry.mapped());
+        auto& batch = _batched[coordinator];
+        batch.insert_or_assign(entry.key(), entry.mapped());
         _coordinator_cache[key] = coordinator;
-        if (!_timer.armed()) {
-            _timer.arm(_commit_interval());
-        }
+        schedule_flush(batch.size());
         it = _unbatched.upper_bound(key);
     }
     co_return was_all_failures;
@@ -160,16 +161,33 @@ ss::future<> commit_batcher<ClockType>::commit_offset(
         _unbatched.insert_or_assign(k, v);
         _unbatched_cond_var.signal();
     } else {
-        _batched[it->second].insert_or_assign(k, v);
+        auto& batch = _batched[it->second];
+        batch.insert_or_assign(k, v);
+        schedule_flush(batch.size());
+    }
+    return ss::now();
+}
+
+template<typename ClockType>
+void commit_batcher<ClockType>::schedule_flush(size_t batch_size) {
+    if (batch_size < _max_batched_commits) {
         if (!_timer.armed()) {
             _timer.arm(_commit_interval());
         }
+        return;
     }
-    return ss::now();
+    if (_early_flush_scheduled) {
+        return;
+    }
+    _early_flush_scheduled = true;
+    _timer.cancel();
+    ssx::spawn_with_gate(_gate, [this] { return flush(); });
 }
 
 template<typename ClockType>
 ss::future<> commit_batcher<ClockType>::flush() {
+    auto units = co_await _flush_mu.get_units();
+    _early_flush_scheduled = false;
     absl::btree_map<model::partition_id, kv_map> batched;
     _batched.swap(batched);
     constexpr static size_t max_concurrent_flushes = 10;
@@ -16,6 +16,7 @@
 #include "model/fundamental.h"
 #include "model/transform.h"
 #include "outcome.h"
+#include "utils/mutex.h"
 
 #include <seastar/core/abort_source.hh>
 
@@ -65,12 +66,15 @@ public:
  * without needing a more advanced mechanism for sharding the transform offset
  * store or a dynamic backpressure/throttling mechanism.
  *
- * We periodically commit all offsets as a single batch at a fixed interval.
- * There is a seperate loop that maps key to the corresponding shard so that the
- * RPC traffic for looking up the coordinator is also a scaling function based
- * on cores. There is no GC mechanism for removing a coordinator -> key mapping
- * and instead it's expected that processors explicitly unregister their mapping
- * when shutdown.
+ * We periodically commit all offsets as a single batch at a fixed interval,
+ * a request per coordinator for all the processors on this core. The batches
+ * are flushed early once a coordinator has enough pending commits, so that
+ * the size of the requests and the commit latency stay bounded when many
+ * processors are deployed. There is a seperate loop that maps key to the
+ * corresponding shard so that the RPC traffic for looking up the coordinator is
+ * also a scaling function based on cores. There is no GC mechanism for removing
+ * a coordinator -> key mapping and instead it's expected that processors
+ * explicitly unregister their mapping when shutdown.
  */
 template<typename ClockType = ss::lowres_clock>
 class commit_batcher {
@@ -80,9 +84,14 @@ class commit_batcher {
       "Only lowres or manual clocks are supported");
 
 public:
+    // The pending commits of a coordinator that trigger a flush before the
+    // commit interval elapses.
+    static constexpr size_t default_max_batched_commits = 1024;
+
     explicit commit_batcher(
       config::binding<std::chrono::milliseconds> commit_interval,
-      std::unique_ptr<offset_committer>);
+      std::unique_ptr<offset_committer>,
+      size_t max_batched_commits = default_max_batched_commits);
 
     ss::future<> start();
     ss::future<> stop();
@@ -150,6 +159,12 @@ private:
      */
     ss::future<> do_flush(model::partition_id, kv_map);
 
+    /**
+     * Arm the commit interval timer, or flush right away when \p batch_size
+     * commits are pending for a coordinator.
+     */
+    void schedule_flush(size_t batch_size);
+
     kv_map _unbatched;
     absl::btree_map<model::partition_id, kv_map> _batched;
     absl::btree_map<model::transform_offsets_key, model::partition_id>
@@ -159,6 +174,11 @@ private:
     std::unique_ptr<offset_committer> _offset_committer;
     config::binding<std::chrono::milliseconds> _commit_interval;
     ss::timer<ClockType> _timer;
+    size_t _max_batched_commits;
+    bool _early_flush_scheduled = false;
+    // Flushes are serialized so that the commits of a key are never
+    // reordered.
+    mutex _flush_mu;
     ss::abort_source _as;
     ss::gate _gate;
 };
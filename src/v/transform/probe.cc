@@ -49,6 +49,24 @@ void probe::setup_metrics(ss::sstring transform_name) {
           "not yet been processed by the transform"),
         labels)
         .aggregate({sm::shard_label}));
+    auto stage_label = sm::label("stage");
+    for (const auto& [s, name] :
+         {std::make_pair(stage::read, "read"),
+          std::make_pair(stage::transform, "transform"),
+          std::make_pair(stage::write, "write")}) {
+        std::vector<sm::label_instance> stage_labels = labels;
+        stage_labels.push_back(stage_label(name));
+        const auto i = static_cast<size_t>(s);
+        metric_defs.emplace_back(
+          sm::make_gauge(
+            "stage_lag",
+            [this, i] { return _stage_lag[i]; },
+            sm::description(
+              "The number of records on the input topic that are pending in "
+              "a stage of the transform: to be read, transformed or written"),
+            stage_labels)
+            .aggregate({sm::shard_label}));
+    }
     metric_defs.emplace_back(
       sm::make_counter(
         "failures",
@@ -86,5 +104,8 @@ void probe::state_change(processor_state_change change) {
     }
 }
 void probe::report_lag(int64_t delta) { _lag += delta; }
+void probe::report_stage_lag(stage s, int64_t delta) {
+    _stage_lag[static_cast<size_t>(s)] += delta;
+}
 
 } // namespace transform
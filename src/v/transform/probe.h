@@ -15,6 +15,8 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <array>
+
 namespace transform {
 
 struct processor_state_change {
@@ -27,6 +29,12 @@ struct processor_state_change {
 /** A per transform probe. */
 class probe : public wasm::transform_probe {
 public:
+    /**
+     * The stages of the processors, the records of the input topic are
+     * pending in one of them until they are written.
+     */
+    enum class stage : uint8_t { read, transform, write };
+
     void setup_metrics(ss::sstring);
 
     void increment_read_bytes(uint64_t bytes);
@@ -34,12 +42,14 @@ public:
     void increment_failure();
     void state_change(processor_state_change);
     void report_lag(int64_t delta);
+    void report_stage_lag(stage, int64_t delta);
 
 private:
     uint64_t _read_bytes = 0;
     uint64_t _write_bytes = 0;
     uint64_t _failures = 0;
     uint64_t _lag = 0;
+    std::array<uint64_t, 3> _stage_lag{};
     absl::flat_hash_map<model::transform_report::processor::state, uint64_t>
       _processor_state;
 };
@@ -223,9 +223,16 @@ ss::future<cluster::errc> client::do_produce_once(produce_request req) {
         co_return cluster::errc::not_leader;
     }
     vlog(log.trace, "do_produce_once_request(node={}): {}", *leader, req);
-    auto reply = co_await (
-      *leader == _self ? do_local_produce(std::move(req))
-                       : do_remote_produce(*leader, std::move(req)));
+    if (*leader == _self) {
+        // The output partition is led by this broker, the batches are appended
+        // to it directly rather than going through the multi-partition
+        // produce of the rpc service.
+        auto result = co_await _local_service->local().produce(
+          std::move(req.topic_data.front()), req.timeout);
+        vlog(log.trace, "do_produce_once_reply(node={}): {}", *leader, result);
+        co_return result.err;
+    }
+    auto reply = co_await do_remote_produce(*leader, std::move(req));
     vlog(log.trace, "do_produce_once_reply(node={}): {}", *leader, req);
     vassert(
       reply.results.size() == 1,
@@ -240,12 +247,6 @@ ss::future<> client::stop() {
     return ss::now();
 }
 
-ss::future<produce_reply> client::do_local_produce(produce_request req) {
-    auto r = co_await _local_service->local().produce(
-      std::move(req.topic_data), req.timeout);
-    co_return produce_reply(std::move(r));
-}
-
 ss::future<produce_reply>
 client::do_remote_produce(model::node_id node, produce_request req) {
     auto resp = co_await _connections->local()
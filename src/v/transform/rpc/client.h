@@ -91,7 +91,6 @@ private:
       generate_remote_report(model::node_id);
 
     ss::future<cluster::errc> do_produce_once(produce_request);
-    ss::future<produce_reply> do_local_produce(produce_request);
     ss::future<produce_reply>
       do_remote_produce(model::node_id, produce_request);
 
@@ -155,8 +155,13 @@ ss::future<result<model::offset, cluster::errc>> local_service::produce(
             co_return cluster::errc::invalid_request;
         }
     }
-    auto rdr = model::make_foreign_fragmented_memory_record_batch_reader(
-      std::move(batches));
+    // The batches only need to be foreign when they're replicated on another
+    // shard.
+    auto rdr = *shard == ss::this_shard_id()
+                 ? model::make_fragmented_memory_record_batch_reader(
+                   std::move(batches))
+                 : model::make_foreign_fragmented_memory_record_batch_reader(
+                   std::move(batches));
     // TODO: schema validation
     model::offset produced_offset;
     auto ec = co_await _partition_manager->invoke_on_shard(
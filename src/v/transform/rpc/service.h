@@ -38,6 +38,13 @@ public:
       ss::chunked_fifo<transformed_topic_data> topic_data,
       model::timeout_clock::duration timeout);
 
+    /**
+     * Produce the batches of a single partition, without the bookkeeping of
+     * the produce of many partitions above.
+     */
+    ss::future<transformed_topic_data_result>
+      produce(transformed_topic_data, model::timeout_clock::duration);
+
     ss::future<result<stored_wasm_binary_metadata, cluster::errc>>
     store_wasm_binary(iobuf, model::timeout_clock::duration timeout);
 
@@ -55,9 +62,6 @@ public:
     ss::future<model::cluster_transform_report> compute_node_local_report();
 
 private:
-    ss::future<transformed_topic_data_result>
-      produce(transformed_topic_data, model::timeout_clock::duration);
-
     ss::future<result<model::offset, cluster::errc>> produce(
       model::any_ntp auto,
       ss::chunked_fifo<model::record_batch>,
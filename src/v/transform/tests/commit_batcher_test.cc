@@ -172,6 +172,7 @@ private:
 
 constexpr static auto commit_interval = 5s;
 constexpr static auto default_key_limit = 10;
+constexpr static size_t max_batched_commits = 4;
 
 class OffsetBatcherTest : public testing::Test {
 public:
@@ -190,7 +191,8 @@ public:
           config::mock_binding(
             std::chrono::duration_cast<std::chrono::milliseconds>(
               commit_interval)),
-          std::move(foc));
+          std::move(foc),
+          max_batched_commits);
         _batcher->start().get();
         _batcher_running = true;
     }
@@ -335,5 +337,19 @@ TEST_F(OffsetBatcherTest, CoordinatorLookupsAreRetried) {
     EXPECT_THAT(after_next_commit(), committed_are("1/1@2"));
 }
 
+TEST_F(OffsetBatcherTest, FlushesFullBatchesEarly) {
+    // With 10 keys across 3 coordinators, at least one coordinator has the
+    // max number of pending commits.
+    for (int i = 1; i <= default_key_limit; ++i) {
+        enqueue(absl::StrCat("1/", i, "@1"));
+    }
+    // No time passes, a full batch flushes the pending commits right away.
+    drain_task_queue();
+    EXPECT_GE(committed().size(), max_batched_commits);
+    // The others are flushed at the commit interval.
+    advance(commit_interval);
+    EXPECT_EQ(committed().size(), default_key_limit);
+}
+
 } // namespace
 } // namespace transform
@@ -83,6 +83,39 @@ public:
         _src->push_batch(std::move(batch)).get();
     }
     model::record_batch read_batch() { return _sinks[0]->read().get(); }
+
+    // The queued batches may be merged before they're transformed, so the
+    // records are compared rather than the batches.
+    struct offset_record {
+        model::offset offset;
+        iobuf key;
+        iobuf value;
+
+        friend bool operator==(const offset_record&, const offset_record&)
+          = default;
+    };
+    static std::vector<offset_record>
+    records_of(const std::vector<model::record_batch>& batches) {
+        std::vector<offset_record> records;
+        for (const auto& b : batches) {
+            b.for_each_record([&records, &b](model::record r) {
+                records.push_back(
+                  {.offset = b.base_offset() + model::offset(r.offset_delta()),
+                   .key = r.release_key(),
+                   .value = r.release_value()});
+            });
+        }
+        return records;
+    }
+    std::vector<offset_record> read_records(size_t count) {
+        std::vector<model::record_batch> batches;
+        size_t read = 0;
+        while (read < count) {
+            batches.push_back(read_batch());
+            read += batches.back().record_count();
+        }
+        return records_of(batches);
+    }
     uint64_t error_count() const { return _error_count; }
     int64_t lag() const { return _p->current_lag(); }
 
@@ -129,11 +162,25 @@ TEST_F(ProcessorTestFixture, ProcessMany) {
     for (auto& b : batches) {
         push_batch(b.share());
     }
+    EXPECT_EQ(read_records(num_batches), records_of(batches));
+    EXPECT_EQ(error_count(), 0);
+}
+
+TEST_F(ProcessorTestFixture, MergesQueuedBatches) {
+    stop();
+    std::vector<model::record_batch> batches;
+    constexpr int num_batches = 32;
+    std::generate_n(std::back_inserter(batches), num_batches, [this] {
+        return make_tiny_batch();
+    });
     for (auto& b : batches) {
-        auto returned = read_batch();
-        EXPECT_EQ(b, returned);
+        push_batch(b.share());
     }
+    start();
+    wait_for_committed_offset(batches.back().last_offset());
+    EXPECT_EQ(read_records(num_batches), records_of(batches));
     EXPECT_EQ(error_count(), 0);
+    EXPECT_EQ(lag(), 0);
 }
 
 TEST_F(ProcessorTestFixture, TracksOffsets) {
@@ -150,18 +197,12 @@ TEST_F(ProcessorTestFixture, TracksOffsets) {
         push_batch(b.share());
     }
     restart();
-    for (auto& b : first_batches) {
-        auto returned = read_batch();
-        EXPECT_EQ(b, returned);
-    }
+    EXPECT_EQ(read_records(num_batches), records_of(first_batches));
     restart();
     for (auto& b : second_batches) {
         push_batch(b.share());
     }
-    for (auto& b : second_batches) {
-        auto returned = read_batch();
-        EXPECT_EQ(b, returned);
-    }
+    EXPECT_EQ(read_records(num_batches), records_of(second_batches));
     EXPECT_EQ(error_count(), 0);
 }
 
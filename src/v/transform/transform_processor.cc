@@ -10,14 +10,18 @@
  */
 #include "transform/transform_processor.h"
 
+#include "bytes/iobuf_parser.h"
+#include "model/compression.h"
 #include "model/fundamental.h"
 #include "model/record.h"
 #include "model/record_batch_reader.h"
+#include "model/record_utils.h"
 #include "model/timeout_clock.h"
 #include "prometheus/prometheus_sanitize.h"
 #include "random/simple_time_jitter.h"
 #include "transform/logger.h"
 #include "units.h"
+#include "utils/vint.h"
 #include "wasm/api.h"
 
 #include <seastar/core/loop.hh>
@@ -25,17 +29,26 @@
 #include <seastar/core/queue.hh>
 #include <seastar/core/sleep.hh>
 
+#include <limits>
 #include <optional>
 
 namespace transform {
 
 namespace {
 
+// The batches queued between the stages of the processor
+constexpr size_t max_queued_input_batches = 8;
+constexpr size_t max_queued_output_batches = 4;
+
 class queue_output_consumer {
 public:
-    queue_output_consumer(ss::queue<model::record_batch>* output, probe* probe)
+    using read_callback = ss::noncopyable_function<void(kafka::offset)>;
+
+    queue_output_consumer(
+      ss::queue<model::record_batch>* output, probe* probe, read_callback cb)
       : _output(output)
-      , _probe(probe) {}
+      , _probe(probe)
+      , _cb(std::move(cb)) {}
 
     ss::future<ss::stop_iteration> operator()(model::record_batch b) {
         // This is a "safe" cast as all our offsets come from the translating
@@ -44,6 +57,7 @@ public:
         _last_offset = model::offset_cast(b.last_offset());
         _probe->increment_read_bytes(b.size_bytes());
         co_await _output->push_eventually(std::move(b));
+        _cb(*_last_offset);
         co_return ss::stop_iteration::no;
     }
     std::optional<kafka::offset> end_of_stream() const { return _last_offset; }
@@ -52,8 +66,111 @@ private:
     std::optional<kafka::offset> _last_offset;
     ss::queue<model::record_batch>* _output;
     probe* _probe;
+    read_callback _cb;
 };
 
+bool can_merge(
+  const model::record_batch& merged,
+  size_t merged_size,
+  const model::record_batch& next) {
+    static constexpr size_t max_merged_batch_bytes = 128_KiB;
+    const auto& h = merged.header();
+    // The records of batches with the broker's timestamp would be given the
+    // timestamp of the last batch
+    return h.attrs == next.header().attrs && h.type == next.header().type
+           && h.attrs.compression() == model::compression::none
+           && h.attrs.timestamp_type() == model::timestamp_type::create_time
+           && !h.attrs.is_control()
+           && merged_size + next.size_bytes() <= max_merged_batch_bytes
+           && next.last_offset() - h.base_offset
+                < std::numeric_limits<int32_t>::max();
+}
+
+void append_record(
+  iobuf& out,
+  model::record_attributes::type attrs,
+  int64_t timestamp_delta,
+  int64_t offset_delta,
+  iobuf payload) {
+    const auto size = sizeof(attrs) + vint::vint_size(timestamp_delta)
+                      + vint::vint_size(offset_delta) + payload.size_bytes();
+    auto encoded = vint::to_bytes(static_cast<int64_t>(size));
+    out.append(encoded.data(), encoded.size());
+    out.append(reinterpret_cast<const char*>(&attrs), sizeof(attrs));
+    encoded = vint::to_bytes(timestamp_delta);
+    out.append(encoded.data(), encoded.size());
+    encoded = vint::to_bytes(offset_delta);
+    out.append(encoded.data(), encoded.size());
+    out.append_fragments(std::move(payload));
+}
+
+/**
+ * Merge batches accepted by can_merge into a single batch. The records keep
+ * their offset and timestamp, their payloads are shared rather than copied.
+ */
+model::record_batch merge_batches(std::vector<model::record_batch> batches) {
+    auto header = batches.front().header();
+    header.record_count = 0;
+    header.max_timestamp = model::timestamp::missing();
+    iobuf records;
+    for (auto& batch : batches) {
+        const auto last_offset = batch.last_offset();
+        const int64_t offset_base = batch.base_offset() - header.base_offset;
+        const int64_t timestamp_base = batch.header().first_timestamp()
+                                       - header.first_timestamp();
+        header.max_timestamp = std::max(
+          header.max_timestamp, batch.header().max_timestamp);
+        header.record_count += batch.record_count();
+        header.last_offset_delta = static_cast<int32_t>(
+          last_offset - header.base_offset);
+
+        iobuf_parser parser(std::move(batch).release_data());
+        while (parser.bytes_left() > 0) {
+            auto [record_size, rs_amt] = parser.read_varlong();
+            auto attrs = parser.consume_type<model::record_attributes::type>();
+            auto [timestamp_delta, td_amt] = parser.read_varlong();
+            auto [offset_delta, od_amt] = parser.read_varlong();
+            auto payload = parser.share(
+              record_size - sizeof(attrs) - td_amt - od_amt);
+            append_record(
+              records,
+              attrs,
+              timestamp_base + timestamp_delta,
+              offset_base + offset_delta,
+              std::move(payload));
+        }
+    }
+    header.size_bytes = static_cast<int32_t>(
+      model::packed_record_batch_header_size + records.size_bytes());
+    model::record_batch merged(
+      header, std::move(records), model::record_batch::tag_ctor_ng{});
+    merged.header().crc = model::crc_record_batch(merged);
+    merged.header().header_crc = model::internal_header_only_crc(
+      merged.header());
+    return merged;
+}
+
+/**
+ * Merge the small batches already queued after \p batch into it, so that the
+ * guest is called once for them. Nothing is waited for, a batch is only merged
+ * when the transforms lag behind the reads.
+ */
+model::record_batch merge_queued_batches(
+  model::record_batch batch, ss::queue<model::record_batch>* queue) {
+    size_t size = batch.size_bytes();
+    if (queue->empty() || !can_merge(batch, size, queue->front())) {
+        return batch;
+    }
+    std::vector<model::record_batch> batches;
+    batches.push_back(std::move(batch));
+    while (!queue->empty()
+           && can_merge(batches.front(), size, queue->front())) {
+        size += queue->front().size_bytes();
+        batches.push_back(queue->pop());
+    }
+    return merge_batches(std::move(batches));
+}
+
 struct drain_result {
     ss::chunked_fifo<model::record_batch> batches;
     kafka::offset latest_offset;
@@ -116,8 +233,8 @@ processor::processor(
   , _offset_tracker(std::move(offset_tracker))
   , _state_callback(std::move(cb))
   , _probe(p)
-  , _consumer_transform_pipe(1)
-  , _transform_producer_pipe(1)
+  , _consumer_transform_pipe(max_queued_input_batches)
+  , _transform_producer_pipe(max_queued_output_batches)
   , _task(ss::now())
   , _logger(tlog, ss::format("{}/{}", _meta.name(), _ntp.tp.partition())) {
     vassert(
@@ -134,8 +251,10 @@ ss::future<> processor::start() {
     _as = {};
     co_await _source->start();
     co_await _offset_tracker->start();
-    _consumer_transform_pipe = ss::queue<model::record_batch>(1);
-    _transform_producer_pipe = ss::queue<transformed_batch>(1);
+    _consumer_transform_pipe = ss::queue<model::record_batch>(
+      max_queued_input_batches);
+    _transform_producer_pipe = ss::queue<transformed_batch>(
+      max_queued_output_batches);
     _task = handle_processor_task(_engine->start().then([this] {
         return load_start_offset().then([this](kafka::offset start_offset) {
             // Mark that we're running now that the start offset is loaded.
@@ -164,6 +283,7 @@ ss::future<> processor::stop() {
     co_await _engine->stop();
     // reset lag now that we've stopped
     report_lag(0);
+    reset_stage_lag();
 }
 
 ss::future<> processor::poll_sleep() {
@@ -185,6 +305,8 @@ ss::future<kafka::offset> processor::load_start_offset() {
         // If we have never committed, mark the end of the log as our starting
         // place, and start processing from the next record that is produced.
         co_await _offset_tracker->commit_offset(latest);
+        _read_offset = _transformed_offset = _committed_offset = latest;
+        report_stage_lag();
         co_return kafka::next_offset(latest);
     }
     // The latest record is inclusive of the last record, so we want to start
@@ -201,6 +323,9 @@ ss::future<kafka::offset> processor::load_start_offset() {
         last_processed_offset = kafka::offset(-1);
     }
     report_lag(latest - last_processed_offset);
+    _read_offset = _transformed_offset = _committed_offset
+      = last_processed_offset;
+    report_stage_lag();
     co_return kafka::next_offset(last_processed_offset);
 }
 
@@ -209,7 +334,13 @@ ss::future<> processor::run_consumer_loop(kafka::offset offset) {
     while (!_as.abort_requested()) {
         auto reader = co_await _source->read_batch(offset, &_as);
         auto last_offset = co_await std::move(reader).consume(
-          queue_output_consumer(&_consumer_transform_pipe, _probe),
+          queue_output_consumer(
+            &_consumer_transform_pipe,
+            _probe,
+            [this](kafka::offset o) {
+                _read_offset = o;
+                report_stage_lag();
+            }),
           model::no_timeout);
         if (!last_offset) {
             vlog(
@@ -226,11 +357,15 @@ ss::future<> processor::run_consumer_loop(kafka::offset offset) {
 
 ss::future<> processor::run_transform_loop() {
     while (!_as.abort_requested()) {
-        auto batch = co_await _consumer_transform_pipe.pop_eventually();
+        auto batch = merge_queued_batches(
+          co_await _consumer_transform_pipe.pop_eventually(),
+          &_consumer_transform_pipe);
         auto offset = model::offset_cast(batch.last_offset());
         batch = co_await _engine->transform(std::move(batch), _probe);
         co_await _transform_producer_pipe.push_eventually(
           {.batch = std::move(batch), .input_offset = offset});
+        _transformed_offset = offset;
+        report_stage_lag();
     }
 }
 
@@ -240,6 +375,8 @@ ss::future<> processor::run_producer_loop() {
         co_await _sinks[0]->write(std::move(drained.batches));
         co_await _offset_tracker->commit_offset(drained.latest_offset);
         report_lag(_source->latest_offset() - drained.latest_offset);
+        _committed_offset = drained.latest_offset;
+        report_stage_lag();
     }
 }
 
@@ -266,6 +403,26 @@ void processor::report_lag(int64_t lag) {
     _last_reported_lag = lag;
 }
 
+void processor::report_stage_lag() {
+    const std::array<int64_t, 3> lag = {
+      std::max<int64_t>(_source->latest_offset() - _read_offset, 0),
+      _read_offset - _transformed_offset,
+      _transformed_offset - _committed_offset,
+    };
+    for (size_t i = 0; i < lag.size(); ++i) {
+        _probe->report_stage_lag(
+          probe::stage(i), lag[i] - _last_reported_stage_lag[i]);
+    }
+    _last_reported_stage_lag = lag;
+}
+
+void processor::reset_stage_lag() {
+    for (size_t i = 0; i < _last_reported_stage_lag.size(); ++i) {
+        _probe->report_stage_lag(
+          probe::stage(i), -std::exchange(_last_reported_stage_lag[i], 0));
+    }
+}
+
 model::transform_id processor::id() const { return _id; }
 const model::ntp& processor::ntp() const { return _ntp; }
 const model::transform_metadata& processor::meta() const { return _meta; }
@@ -26,6 +26,8 @@
 #include <seastar/core/queue.hh>
 #include <seastar/util/noncopyable_function.hh>
 
+#include <array>
+
 namespace transform {
 
 /**
@@ -42,6 +44,10 @@ struct transformed_batch {
  *
  * At it's heart it's a fiber that reads->transforms->writes batches
  * from an input ntp to an output ntp.
+ *
+ * The stages are pipelined: a few batches are queued between them so that the
+ * reads, the transforms and the writes overlap, and the small batches queued
+ * for the transform are merged so that they're transformed in a single call.
  */
 class processor {
 public:
@@ -80,6 +86,8 @@ private:
     ss::future<> poll_sleep();
     ss::future<kafka::offset> load_start_offset();
     void report_lag(int64_t);
+    void report_stage_lag();
+    void reset_stage_lag();
 
     template<typename... Future>
     ss::future<> when_all_shutdown(Future&&...);
@@ -103,5 +111,12 @@ private:
     prefix_logger _logger;
 
     int64_t _last_reported_lag = 0;
+
+    // The last offsets read from the input, transformed and committed, from
+    // which the lag of each stage is reported.
+    kafka::offset _read_offset;
+    kafka::offset _transformed_offset;
+    kafka::offset _committed_offset;
+    std::array<int64_t, 3> _last_reported_stage_lag{};
 };
 } // namespace transform
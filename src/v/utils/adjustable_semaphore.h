@@ -11,6 +11,7 @@
 #pragma once
 
 #include "ssx/semaphore.h"
+#include "utils/semaphore_wait_stats.h"
 
 /**
  * This class is extension of ss::semaphore to fit the needs
@@ -30,6 +31,8 @@
  *   record of the capacity.
  * - This enables runtime configuration changes to parameters that
  *   control the capacity of a semaphore.
+ *
+ * The waits for units are recorded in the optional semaphore_wait_stats.
  */
 class adjustable_semaphore {
 public:
@@ -38,6 +41,13 @@ public:
     adjustable_semaphore(uint64_t capacity, const ss::sstring& sem_name)
       : _sem(capacity, sem_name)
       , _capacity(capacity) {}
+    adjustable_semaphore(
+      uint64_t capacity,
+      const ss::sstring& sem_name,
+      ss::lw_shared_ptr<semaphore_wait_stats> stats)
+      : _sem(capacity, sem_name)
+      , _capacity(capacity)
+      , _stats(std::move(stats)) {}
 
     void set_capacity(uint64_t capacity) noexcept {
         if (capacity > _capacity) {
@@ -70,6 +80,9 @@ public:
         take_result result = {
           .units = ss::consume_units(_sem, units),
           .checkpoint_hint = _sem.current() <= 0};
+        if (_stats) {
+            ++_stats->acquisitions;
+        }
 
         return result;
     }
@@ -78,7 +91,7 @@ public:
      * Blocking get units: will block until units are available.
      */
     ss::future<ssx::semaphore_units> get_units(size_t units) {
-        return ss::get_units(_sem, units);
+        return record_semaphore_wait(_stats, ss::get_units(_sem, units));
     }
 
     /**
@@ -87,7 +100,19 @@ public:
      */
     ss::future<ssx::semaphore_units>
     get_units(size_t units, ss::abort_source& as) {
-        return ss::get_units(_sem, units, as);
+        return record_semaphore_wait(_stats, ss::get_units(_sem, units, as));
+    }
+
+    /**
+     * Non-blocking get units: returns std::nullopt if the units are not
+     * immediately available.
+     */
+    std::optional<ssx::semaphore_units> try_get_units(size_t units) {
+        auto res = ss::try_get_units(_sem, units);
+        if (res && _stats) {
+            ++_stats->acquisitions;
+        }
+        return res;
     }
 
     size_t current() const noexcept { return _sem.current(); }
@@ -112,4 +137,5 @@ private:
     ssx::semaphore _sem;
 
     uint64_t _capacity{0};
+    ss::lw_shared_ptr<semaphore_wait_stats> _stats;
 };
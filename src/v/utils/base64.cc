@@ -71,9 +71,12 @@ ss::sstring bytes_to_base64(bytes_view input) {
     return output;
 }
 
-ss::sstring iobuf_to_base64(const iobuf& input) {
+size_t base64_encode_capacity(size_t input_size) {
+    return encode_capacity(input_size);
+}
+
+size_t iobuf_to_base64(const iobuf& input, char* output) {
     const size_t output_capacity = encode_capacity(input.size_bytes());
-    ss::sstring output(ss::sstring::initialized_later{}, output_capacity);
     size_t written = 0;
 
     base64_state state; // NOLINT
@@ -83,9 +86,9 @@ ss::sstring iobuf_to_base64(const iobuf& input) {
     iobuf::iterator_consumer input_it(input.cbegin(), input.cend());
     input_it.consume(
       input.size_bytes(),
-      [&state, &written, &output, output_capacity](const char* src, size_t sz) {
-          size_t output_len;                          // NOLINT
-          char* output_ptr = output.data() + written; // NOLINT
+      [&state, &written, output, output_capacity](const char* src, size_t sz) {
+          size_t output_len;                   // NOLINT
+          char* output_ptr = output + written; // NOLINT
           base64_stream_encode(&state, src, sz, output_ptr, &output_len);
           written += output_len;
           vassert(
@@ -98,15 +101,19 @@ ss::sstring iobuf_to_base64(const iobuf& input) {
 
     // finalize output
     size_t output_len; // NOLINT
-    base64_stream_encode_final(
-      &state, output.data() + written, &output_len); // NOLINT
+    base64_stream_encode_final(&state, output + written, &output_len); // NOLINT
     written += output_len;
     vassert(
       written <= output_capacity,
       "base64 encode overflow: {} > {}",
       written,
       output_capacity);
+    return written;
+}
 
-    output.resize(written);
+ss::sstring iobuf_to_base64(const iobuf& input) {
+    ss::sstring output(
+      ss::sstring::initialized_later{}, encode_capacity(input.size_bytes()));
+    output.resize(iobuf_to_base64(input, output.data()));
     return output;
 }
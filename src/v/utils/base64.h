@@ -31,3 +31,10 @@ ss::sstring base64_to_string(std::string_view);
 
 // base64 <-> iobuf
 ss::sstring iobuf_to_base64(const iobuf&);
+
+// the length of the output iobuf_to_base64() requires for \p input_size bytes
+size_t base64_encode_capacity(size_t input_size);
+
+// encodes to \p output, of at least base64_encode_capacity() bytes, returns
+// the number of bytes written
+size_t iobuf_to_base64(const iobuf&, char* output);
@@ -21,6 +21,7 @@
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <span>
 #include <type_traits>
 #include <variant>
@@ -241,6 +242,33 @@ auto deserialize_little_endian(
     }
     return input;
 }
+
+template<size_t bytes>
+using word_t = std::conditional_t<
+  bytes == 8,
+  uint64_t,
+  std::conditional_t<
+    bytes == 4,
+    uint32_t,
+    std::conditional_t<bytes == 2, uint16_t, uint8_t>>>;
+
+// Read a column of little endian words, one per lane, and paste them in place.
+// The column is loaded with a single copy and the lanes are independent of
+// each other, so the compiler vectorizes the widening shift for the target
+// (SSE2/NEON on the baseline targets, AVX2 when it is enabled).
+template<size_t bytes_to_restore, size_t shift, std::unsigned_integral T>
+uint8_t const* unpack_column(
+  uint8_t const* input, std::span<T, FOR_buffer_depth> lanes) {
+    static_assert(
+      std::endian::native == std::endian::little,
+      "to work on a big-endian machine, byteswap the words");
+    std::array<word_t<bytes_to_restore>, FOR_buffer_depth> words;
+    std::memcpy(words.data(), input, sizeof(words));
+    for (size_t i = 0; i < FOR_buffer_depth; ++i) {
+        lanes[i] |= T{words[i]} << shift;
+    }
+    return input + sizeof(words);
+}
 } // namespace decomp
 } // namespace details
 
@@ -609,28 +637,30 @@ public:
 private:
     template<size_t N_BITS>
     void unpack(std::span<TVal, row_width> output) {
-        std::ranges::fill(output, TVal{0});
-        if constexpr (N_BITS > 0) {
+        if constexpr (N_BITS == 0) {
+            std::ranges::fill(output, TVal{0});
+        } else {
             using namespace details::decomp;
+            using lane_t = std::make_unsigned_t<TVal>;
 
             std::array<uint8_t, serialized_size<N_BITS, row_width>> tmp_buffer;
             _data.consume_to(tmp_buffer.size(), tmp_buffer.begin());
 
-            auto end_it = tmp_buffer.cbegin();
+            // the row is decoded in unsigned lanes, the shifts below are
+            // well defined for any N_BITS
+            std::array<lane_t, row_width> lanes{};
+            uint8_t const* end_it = tmp_buffer.data();
             // step 1: deserialize whole bytes and paste them in place,
-            // following decomposition in words
+            // following decomposition in words, one column at a time
             constexpr static auto decom = unsigned_decomposition<N_BITS>;
             [&]<size_t... Is>(std::index_sequence<Is...>) {
                 (
                   [&] {
                       constexpr auto bytes_to_restore = decom[Is].first;
                       constexpr auto shift_of_restored = decom[Is].second;
-                      for (auto& e : output) {
-                          auto tmp = std::make_unsigned_t<TVal>{};
-                          end_it = deserialize_little_endian<bytes_to_restore>(
-                            end_it, tmp);
-                          e |= tmp << shift_of_restored;
-                      }
+                      end_it = unpack_column<
+                        bytes_to_restore,
+                        shift_of_restored>(end_it, std::span{lanes});
                   }(),
                   ...);
             }(std::make_index_sequence<decom.size()>{});
@@ -652,11 +682,14 @@ private:
                     // select residual bits, shift them down to zero and then
                     // shift them to the appropriate position
                     return (
-                      (output[Is]
+                      (lanes[Is]
                        |= ((bits >> (residual * Is)) << prev_saved_bits) & mask)
                       | ...);
                 }(std::make_index_sequence<output.size()>());
             }
+            std::ranges::transform(lanes, output.begin(), [](lane_t v) {
+                return static_cast<TVal>(v);
+            });
         }
     }
     void unpack(std::span<TVal, row_width> output, uint8_t n) {
@@ -16,8 +16,11 @@
 #include <seastar/core/future.hh>
 #include <seastar/util/later.hh>
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iterator>
+#include <ranges>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -31,13 +34,19 @@ struct fragmented_vector_accessor;
  * A very very simple fragmented vector that provides random access like a
  * vector, but does not store its data in contiguous memory.
  *
- * There is no reserve method because we allocate a full fragment at a time.
- * However, after you populate a vector you might want to call shrink to fit if
- * your fragment is large. A more advanced strategy could allocate capacity up
- * front which just requires a bit more accounting.
+ * We allocate a full fragment at a time, so reserve only sizes the index of
+ * the fragments. However, after you populate a vector you might want to call
+ * shrink to fit if your fragment is large.
+ *
+ * The number of elements per fragment is a power of two: an element is found
+ * with a shift and a mask. Erasing a prefix drops the fragments holding only
+ * erased elements, the erased elements of the first fragment are moved from
+ * and only destroyed with it, hence all the fragments but the last stay full.
  *
  * The iterator implementation works for a few things like std::lower_bound,
- * upper_bound, distance, etc... see fragmented_vector_test.
+ * upper_bound, distance, etc... see fragmented_vector_test. The lower_bound and
+ * upper_bound members are faster: they search the fragments first and then a
+ * contiguous fragment.
  *
  * Note that the decision to allocate a full fragment at a time isn't
  * necessarily an optimization, but rather a restriction that simplifies the
@@ -93,10 +102,11 @@ public:
         if (this != &other) {
             this->_size = other._size;
             this->_capacity = other._capacity;
+            this->_head = other._head;
             this->_frags = std::move(other._frags);
             // Move compatibility with std::vector that post move
             // the vector is empty().
-            other._size = other._capacity = 0;
+            other._size = other._capacity = other._head = 0;
         }
         return *this;
     }
@@ -106,11 +116,7 @@ public:
     requires std::input_iterator<Iter>
     fragmented_vector(Iter begin, Iter end)
       : fragmented_vector() {
-        // Improvement: Write a more efficient implementation for
-        // random_access_iterators
-        for (auto it = begin; it != end; ++it) {
-            push_back(*it);
-        }
+        append(begin, end);
     }
 
     fragmented_vector copy() const noexcept { return *this; }
@@ -118,9 +124,27 @@ public:
     void swap(fragmented_vector& other) noexcept {
         std::swap(_size, other._size);
         std::swap(_capacity, other._capacity);
+        std::swap(_head, other._head);
         std::swap(_frags, other._frags);
     }
 
+    /**
+     * Sizes the index of the fragments for \p n elements. The fragments
+     * themselves are still allocated as elements are added.
+     */
+    void reserve(size_t n) {
+        _frags.reserve((_head + n + elems_per_frag - 1) / elems_per_frag);
+    }
+
+    /**
+     * Appends the elements of \p range, copying or moving a fragment worth of
+     * them at a time when the size of the range is known.
+     */
+    template<std::ranges::input_range R>
+    void append_range(R&& range) {
+        append(std::ranges::begin(range), std::ranges::end(range));
+    }
+
     template<class E = T>
     void push_back(E&& elem) {
         maybe_add_capacity();
@@ -138,6 +162,10 @@ public:
 
     void pop_back() {
         vassert(_size > 0, "Cannot pop from empty container");
+        if (_size == 1) {
+            clear();
+            return;
+        }
         _frags.back().pop_back();
         --_size;
         if (_frags.back().empty()) {
@@ -172,19 +200,46 @@ public:
         }
     }
 
+    /*
+     * Replacement for `erase(begin(), begin() + n)`, it drops the fragments
+     * of the erased elements instead of moving the remaining ones.
+     */
+    void erase_prefix(size_t n) {
+        vassert(
+          _size >= n, "Cannot erase more than size() elements in container");
+
+        if (_size == n) {
+            clear();
+            return;
+        }
+
+        const auto head = _head + n;
+        const auto dropped = head / elems_per_frag;
+        _frags.erase(_frags.begin(), _frags.begin() + dropped);
+        // release what the erased elements of the first fragment hold
+        auto& front = _frags.front();
+        const auto first = dropped > 0 ? size_t{0} : _head;
+        for (auto i = first; i < head % elems_per_frag; ++i) {
+            [[maybe_unused]] T erased = std::move(front[i]);
+        }
+        _head = head % elems_per_frag;
+        _size -= n;
+        _capacity -= n;
+    }
+
     const T& operator[](size_t index) const {
         vassert(index < _size, "Index out of range {}/{}", index, _size);
-        auto& frag = _frags.at(index / elems_per_frag);
-        return frag.at(index % elems_per_frag);
+        const auto i = _head + index;
+        return _frags[i / elems_per_frag][i % elems_per_frag];
     }
 
     T& operator[](size_t index) {
         return const_cast<T&>(std::as_const(*this)[index]);
     }
 
-    const T& front() const { return _frags.front().front(); }
+    const T& front() const { return _frags.front()[_head]; }
     const T& back() const { return _frags.back().back(); }
-    T& front() { return _frags.front().front(); }
+    T& front() { return _frags.front()[_head]; }
     T& back() { return _frags.back().back(); }
     bool empty() const noexcept { return _size == 0; }
     size_t size() const noexcept { return _size; }
@@ -196,7 +251,10 @@ public:
     }
 
     bool operator==(const fragmented_vector& o) const noexcept {
-        return o._frags == _frags;
+        if (_head == 0 && o._head == 0) {
+            return o._frags == _frags;
+        }
+        return std::equal(begin(), end(), o.begin(), o.end());
     }
 
     /**
@@ -224,6 +282,7 @@ public:
         std::vector<std::vector<T>>{}.swap(_frags);
         _size = 0;
         _capacity = 0;
+        _head = 0;
     }
 
     template<bool C>
@@ -306,6 +365,27 @@ public:
     const_iterator cbegin() const { return const_iterator(this, 0); }
     const_iterator cend() const { return const_iterator(this, _size); }
 
+    /**
+     * Same as std::lower_bound and std::upper_bound on a vector sorted as per
+     * \p comp, without going through the iterators.
+     */
+    template<typename K, typename Compare = std::less<>>
+    const_iterator lower_bound(const K& key, Compare comp = {}) const {
+        return const_iterator(this, search(key, comp, std::false_type{}));
+    }
+    template<typename K, typename Compare = std::less<>>
+    iterator lower_bound(const K& key, Compare comp = {}) {
+        return iterator(this, search(key, comp, std::false_type{}));
+    }
+    template<typename K, typename Compare = std::less<>>
+    const_iterator upper_bound(const K& key, Compare comp = {}) const {
+        return const_iterator(this, search(key, comp, std::true_type{}));
+    }
+    template<typename K, typename Compare = std::less<>>
+    iterator upper_bound(const K& key, Compare comp = {}) {
+        return iterator(this, search(key, comp, std::true_type{}));
+    }
+
     friend test_details::fragmented_vector_accessor;
 
     friend std::ostream&
@@ -319,6 +399,55 @@ public:
     }
 
 private:
+    template<typename Iter, typename Sentinel>
+    void append(Iter first, Sentinel last) {
+        if constexpr (std::sized_sentinel_for<Sentinel, Iter>) {
+            auto remaining = static_cast<size_t>(last - first);
+            while (remaining > 0) {
+                maybe_add_capacity();
+                auto& frag = _frags.back();
+                const auto n = std::min(
+                  remaining, elems_per_frag - frag.size());
+                auto next = std::next(first, n);
+                frag.insert(frag.end(), first, next);
+                first = std::move(next);
+                _size += n;
+                remaining -= n;
+            }
+        } else {
+            for (; first != last; ++first) {
+                push_back(*first);
+            }
+        }
+    }
+
+    // index of the first element for which comp(key, e) (upper bound) or
+    // !comp(e, key) (lower bound) holds
+    template<typename K, typename Compare, bool upper>
+    size_t search(
+      const K& key, Compare& comp, std::bool_constant<upper>) const {
+        auto in_range = [&key, &comp](const T& e) {
+            if constexpr (upper) {
+                return !comp(key, e);
+            } else {
+                return comp(e, key);
+            }
+        };
+        // fragments are never empty, their last element is a valid bound
+        auto frag = std::partition_point(
+          _frags.begin(), _frags.end(), [&in_range](const std::vector<T>& f) {
+              return in_range(f.back());
+          });
+        if (frag == _frags.end()) {
+            return _size;
+        }
+        const auto first = frag == _frags.begin() ? _head : 0;
+        auto it = std::partition_point(
+          frag->begin() + first, frag->end(), in_range);
+        return (frag - _frags.begin()) * elems_per_frag
+               + (it - frag->begin()) - _head;
+    }
+
     void maybe_add_capacity() {
         if (_size == _capacity) {
             std::vector<T> frag;
@@ -340,7 +469,10 @@ private:
     fragmented_vector_clear_async(fragmented_vector<TT, SS>&);
 
     size_t _size{0};
+    // counts the elements which can be added before allocating a fragment
     size_t _capacity{0};
+    // erased elements at the start of the first fragment
+    size_t _head{0};
     std::vector<std::vector<T>> _frags;
 };
 
@@ -367,13 +499,15 @@ template<typename T, size_t S>
 inline seastar::future<>
 fragmented_vector_fill_async(fragmented_vector<T, S>& vec, const T& value) {
     auto remaining = vec._size;
+    auto head = vec._head;
     for (auto& frag : vec._frags) {
-        const auto n = std::min(frag.size(), remaining);
+        const auto n = std::min(frag.size() - head, remaining);
         if (n == 0) {
             break;
         }
-        std::fill_n(frag.begin(), n, value);
+        std::fill_n(frag.begin() + head, n, value);
         remaining -= n;
+        head = 0;
         if (seastar::need_preempt()) {
             co_await seastar::yield();
         }
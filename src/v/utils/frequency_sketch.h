@@ -0,0 +1,114 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+/**
+ * A probabilistic estimate of how often items have been seen recently.
+ *
+ * This is the count-min sketch with 4-bit saturating counters and periodic
+ * aging used by TinyLFU (Einziger, et al., "TinyLFU: A Highly Efficient Cache
+ * Admission Policy", ACM ToS 2017). Each item updates one counter in each of
+ * four rows, and the estimated frequency is the minimum of those counters.
+ * After a number of increments proportional to the capacity all counters are
+ * halved, so that the sketch reflects recent history rather than all time.
+ *
+ * Items are identified by a 64-bit hash provided by the caller.
+ */
+class frequency_sketch {
+    static constexpr size_t rows = 4;
+    static constexpr size_t counters_per_word = 16;
+    static constexpr uint64_t max_count = 15;
+    static constexpr uint64_t reset_mask = 0x7777777777777777ULL;
+    static constexpr std::array<uint64_t, rows> seeds = {
+      0xc3a5c85c97cb3127ULL,
+      0xb492b66fbe98f273ULL,
+      0x9ae16a3b2f90404fULL,
+      0xcbf29ce484222325ULL,
+    };
+
+public:
+    /**
+     * Create a sketch sized to track roughly \p capacity distinct items.
+     */
+    explicit frequency_sketch(size_t capacity)
+      : _width(std::bit_ceil(std::max<size_t>(capacity, counters_per_word)))
+      , _table((_width * rows) / counters_per_word, 0)
+      , _sample_size(_width * 10) {}
+
+    /**
+     * Record an occurrence of the item identified by \p hash.
+     */
+    void increment(uint64_t hash) noexcept {
+        bool added = false;
+        for (size_t row = 0; row < rows; ++row) {
+            added |= increment_at(counter_index(hash, row));
+        }
+        if (added && ++_size >= _sample_size) {
+            reset();
+        }
+    }
+
+    /**
+     * Estimated number of recent occurrences of the item identified by \p
+     * hash, saturating at 15.
+     */
+    uint8_t frequency(uint64_t hash) const noexcept {
+        auto freq = max_count;
+        for (size_t row = 0; row < rows; ++row) {
+            freq = std::min(freq, count_at(counter_index(hash, row)));
+        }
+        return static_cast<uint8_t>(freq);
+    }
+
+    /// Number of increments after which counters are aged.
+    size_t sample_size() const noexcept { return _sample_size; }
+
+private:
+    size_t counter_index(uint64_t hash, size_t row) const noexcept {
+        auto h = (hash + seeds[row]) * seeds[(row + 1) % rows];
+        h ^= h >> 32U;
+        return (row * _width) + (h & (_width - 1));
+    }
+
+    uint64_t count_at(size_t index) const noexcept {
+        const auto shift = (index % counters_per_word) * 4;
+        return (_table[index / counters_per_word] >> shift) & max_count;
+    }
+
+    bool increment_at(size_t index) noexcept {
+        const auto shift = (index % counters_per_word) * 4;
+        auto& word = _table[index / counters_per_word];
+        if (((word >> shift) & max_count) == max_count) {
+            return false;
+        }
+        word += uint64_t{1} << shift;
+        return true;
+    }
+
+    void reset() noexcept {
+        for (auto& word : _table) {
+            word = (word >> 1U) & reset_mask;
+        }
+        _size /= 2;
+    }
+
+    size_t _width;
+    std::vector<uint64_t> _table;
+    size_t _sample_size;
+    size_t _size{0};
+};
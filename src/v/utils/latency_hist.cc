@@ -0,0 +1,89 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "utils/latency_hist.h"
+
+#include <cmath>
+#include <numeric>
+
+uint64_t latency_hist::count() const noexcept {
+    return std::accumulate(_counts.begin(), _counts.end(), uint64_t{0});
+}
+
+/*
+ * The seastar histogram starting at our \p first_bucket with \p bucket_count
+ * cumulative buckets, in units of \p scale microseconds. Its last bucket
+ * counts all the latencies, as the last bucket of log_hist does.
+ */
+seastar::metrics::histogram latency_hist::logform(
+  size_t first_bucket, size_t bucket_count, double scale) const {
+    constexpr int first_bucket_exp = 64 - first_bucket_clz;
+
+    seastar::metrics::histogram hist;
+    hist.buckets.resize(bucket_count);
+    hist.sample_sum = static_cast<double>(_sum_ns) / (1000 * scale);
+
+    uint64_t cumulative_count = std::accumulate(
+      _counts.begin(), _counts.begin() + first_bucket, uint64_t{0});
+    for (size_t j = 0; j < bucket_count; ++j) {
+        const auto i = first_bucket + j;
+        if (j + 1 == bucket_count) {
+            cumulative_count = std::accumulate(
+              _counts.begin() + i, _counts.end(), cumulative_count);
+        } else {
+            cumulative_count += _counts[i];
+        }
+        auto& bucket = hist.buckets[j];
+        bucket.count = cumulative_count;
+        bucket.upper_bound = static_cast<double>(
+                               (uint64_t{1} << (first_bucket_exp + i)) - 1)
+                             / scale;
+    }
+
+    hist.sample_count = cumulative_count;
+    return hist;
+}
+
+seastar::metrics::histogram latency_hist::internal_histogram_logform() const {
+    return logform(0, number_of_buckets, 1);
+}
+
+seastar::metrics::histogram latency_hist::public_histogram_logform() const {
+    // 18 buckets from 256us, in seconds
+    constexpr size_t first_public_bucket = 5;
+    static_assert(
+      (first_bucket_upper_bound_us << first_public_bucket) == 256,
+      "public histograms start at 256us");
+    return logform(first_public_bucket, 18, 1'000'000);
+}
+
+std::chrono::microseconds
+latency_hist::quantile(const counts_type& counts, double q) {
+    constexpr int first_bucket_exp = 64 - first_bucket_clz;
+
+    const auto total = std::accumulate(
+      counts.begin(), counts.end(), uint64_t{0});
+    if (total == 0) {
+        return std::chrono::microseconds(0);
+    }
+    const auto rank = std::max<uint64_t>(
+      1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(total))));
+    uint64_t cumulative_count = 0;
+    size_t i = 0;
+    for (; i + 1 < counts.size(); ++i) {
+        cumulative_count += counts[i];
+        if (cumulative_count >= rank) {
+            break;
+        }
+    }
+    return std::chrono::microseconds(
+      (uint64_t{1} << (first_bucket_exp + i)) - 1);
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include <seastar/core/metrics_types.hh>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+
+/*
+ * A histogram of latencies for the hot paths, e.g. recorded on every
+ * request. Recording a duration is a division by a constant, a bit scan and
+ * two increments: there is no allocation, no measurement object and no
+ * atomic, every shard records into its own histograms.
+ *
+ * The buckets are those of `log_hist_internal`: the first one holds
+ * latencies below 8us and the upper bound of the following ones doubles,
+ * the last bucket is unbounded. The seastar histograms are only built when
+ * the metrics are read, and are identical to the ones of `log_hist_internal`
+ * and `log_hist_public` given the same latencies.
+ */
+class latency_hist {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    static constexpr size_t number_of_buckets = 26;
+    static constexpr uint64_t first_bucket_upper_bound_us = 8;
+
+    constexpr latency_hist() noexcept = default;
+    latency_hist(const latency_hist&) = delete;
+    latency_hist& operator=(const latency_hist&) = delete;
+    latency_hist(latency_hist&&) = delete;
+    latency_hist& operator=(latency_hist&&) = delete;
+    ~latency_hist() = default;
+
+    void record(std::chrono::nanoseconds d) noexcept {
+        const auto ns = static_cast<uint64_t>(std::max<int64_t>(d.count(), 0));
+        _sum_ns += ns;
+        const auto us = ns / 1000;
+        const auto i = std::clamp(
+          first_bucket_clz - std::countl_zero(us),
+          0,
+          static_cast<int>(number_of_buckets - 1));
+        ++_counts[i];
+    }
+
+    void record_since(clock_type::time_point start) noexcept {
+        record(clock_type::now() - start);
+    }
+
+    using counts_type = std::array<uint64_t, number_of_buckets>;
+
+    uint64_t count() const noexcept;
+    const counts_type& counts() const noexcept { return _counts; }
+    std::chrono::nanoseconds sum() const noexcept {
+        return std::chrono::nanoseconds(_sum_ns);
+    }
+
+    /// Same buckets and unit (microseconds) as log_hist_internal, this is the
+    /// histogram type used in the `/metrics` endpoint
+    seastar::metrics::histogram internal_histogram_logform() const;
+
+    /// Same buckets and unit (seconds) as log_hist_public, this is the
+    /// histogram type used in the `/public_metrics` endpoint
+    seastar::metrics::histogram public_histogram_logform() const;
+
+    /// Upper bound of the bucket holding the \p q quantile of \p counts,
+    /// e.g. the difference of the counts at the start and at the end of an
+    /// interval. Zero when the counts are empty.
+    static std::chrono::microseconds quantile(const counts_type&, double q);
+
+private:
+    static constexpr int first_bucket_clz = std::countl_zero(
+      first_bucket_upper_bound_us - 1);
+
+    seastar::metrics::histogram
+    logform(size_t first_bucket, size_t bucket_count, double scale) const;
+
+    counts_type _counts{};
+    uint64_t _sum_ns{0};
+};
@@ -12,6 +12,7 @@
 #pragma once
 #include "seastarx.h"
 #include "ssx/semaphore.h"
+#include "utils/semaphore_wait_stats.h"
 
 /*
  * A traditional mutex. If you are trying to count things or need timeouts, you
@@ -27,6 +28,7 @@
  *    return m.with([] { ... });
  *    ```
  *
+ * The waits for the mutex are recorded in the optional semaphore_wait_stats.
  */
 class mutex {
 public:
@@ -41,33 +43,49 @@ public:
     explicit mutex(ss::sstring name)
       : _sem(1, std::move(name)) {}
 
+    mutex(ss::sstring name, ss::lw_shared_ptr<semaphore_wait_stats> stats)
+      : _sem(1, std::move(name))
+      , _stats(std::move(stats)) {}
+
     template<typename Func>
     auto with(Func&& func) noexcept {
+        if (_stats) {
+            return with_units(get_units(), std::forward<Func>(func));
+        }
         return ss::with_semaphore(_sem, 1, std::forward<Func>(func));
     }
 
     template<typename Func>
     auto with(duration timeout, Func&& func) noexcept {
+        if (_stats) {
+            return with_units(
+              record_semaphore_wait(_stats, ss::get_units(_sem, 1, timeout)),
+              std::forward<Func>(func));
+        }
         return ss::with_semaphore(_sem, 1, timeout, std::forward<Func>(func));
     }
 
     template<typename Func>
     auto with(time_point timeout, Func&& func) noexcept {
-        return ss::get_units(_sem, 1, timeout)
-          .then([func = std::forward<Func>(func)](auto units) mutable {
-              return ss::futurize_invoke(std::forward<Func>(func))
-                .finally([units = std::move(units)] {});
-          });
+        return with_units(
+          record_semaphore_wait(_stats, ss::get_units(_sem, 1, timeout)),
+          std::forward<Func>(func));
     }
 
-    ss::future<units> get_units() noexcept { return ss::get_units(_sem, 1); }
+    ss::future<units> get_units() noexcept {
+        return record_semaphore_wait(_stats, ss::get_units(_sem, 1));
+    }
 
     ss::future<units> get_units(ss::abort_source& as) noexcept {
-        return ss::get_units(_sem, 1, as);
+        return record_semaphore_wait(_stats, ss::get_units(_sem, 1, as));
     }
 
     std::optional<units> try_get_units() noexcept {
-        return ss::try_get_units(_sem, 1);
+        auto res = ss::try_get_units(_sem, 1);
+        if (res && _stats) {
+            ++_stats->acquisitions;
+        }
+        return res;
     }
 
     void broken() noexcept { _sem.broken(); }
@@ -79,5 +97,14 @@ public:
     size_t waiters() const noexcept { return _sem.waiters(); }
 
 private:
+    template<typename Func>
+    static auto with_units(ss::future<units> f, Func&& func) {
+        return f.then([func = std::forward<Func>(func)](units u) mutable {
+            return ss::futurize_invoke(std::forward<Func>(func))
+              .finally([u = std::move(u)] {});
+        });
+    }
+
     ssx::semaphore _sem;
+    ss::lw_shared_ptr<semaphore_wait_stats> _stats;
 };
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "utils/request_trace.h"
+
+#include <algorithm>
+
+void request_trace::add_span(
+  std::string_view name,
+  clock_type::time_point start,
+  clock_type::time_point end) noexcept {
+    const auto i = _next.fetch_add(1, std::memory_order_relaxed);
+    if (i < max_spans) {
+        _spans[i] = span{
+          .name = name,
+          .shard = ss::this_shard_id(),
+          .start = start,
+          .end = end,
+        };
+    }
+}
+
+void request_trace::finish() noexcept {
+    _finished_at = clock_type::now();
+    const auto claimed = _next.exchange(finished, std::memory_order_relaxed);
+    _recorded = std::min(claimed, max_spans);
+    _dropped = claimed - _recorded;
+}
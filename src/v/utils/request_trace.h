@@ -0,0 +1,158 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/sstring.hh>
+#include <seastar/core/smp.hh>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <span>
+#include <string_view>
+
+/*
+ * The timeline of one sampled request: the stages it went through (handler
+ * dispatch, cross shard hops, raft batching, append, replication...) on
+ * whichever shards ran them.
+ *
+ * The trace is owned by the shard that received the request and is passed
+ * down the request path as a plain pointer, null when the request is not
+ * sampled, so that an unsampled request only pays for the null checks.
+ * Stages of the same request may run in parallel on several shards: spans are
+ * written in preallocated slots claimed atomically, nothing is allocated
+ * while recording. A span must be recorded only while the request is still
+ * in flight, spans() is read once it has completed.
+ */
+class request_trace {
+public:
+    using clock_type = std::chrono::steady_clock;
+    static constexpr size_t max_spans = 32;
+
+    struct span {
+        // a string literal
+        std::string_view name;
+        ss::shard_id shard;
+        clock_type::time_point start;
+        clock_type::time_point end;
+    };
+
+    explicit request_trace(ss::sstring name)
+      : _name(std::move(name))
+      , _started_at(clock_type::now())
+      , _stage_start(_started_at) {}
+
+    request_trace(const request_trace&) = delete;
+    request_trace& operator=(const request_trace&) = delete;
+    request_trace(request_trace&&) = delete;
+    request_trace& operator=(request_trace&&) = delete;
+    ~request_trace() = default;
+
+    /// Records a span of this shard, dropped once max_spans are recorded.
+    void add_span(
+      std::string_view name,
+      clock_type::time_point start,
+      clock_type::time_point end = clock_type::now()) noexcept;
+
+    /// Same as add_span(), for a trace that may be null. The clock is only
+    /// read for a sampled request.
+    static void add_span(
+      request_trace* trace,
+      std::string_view name,
+      clock_type::time_point start) noexcept {
+        if (trace) [[unlikely]] {
+            trace->add_span(name, start);
+        }
+    }
+    static void add_span(
+      request_trace* trace,
+      std::string_view name,
+      clock_type::time_point start,
+      clock_type::time_point end) noexcept {
+        if (trace) [[unlikely]] {
+            trace->add_span(name, start, end);
+        }
+    }
+
+    /// Records a span of the shard owning the trace, from the end of its
+    /// previous stage (or the start of the request) until now: the stages of
+    /// the request on its own shard follow each other.
+    void end_stage(std::string_view name) noexcept {
+        const auto now = clock_type::now();
+        add_span(name, _stage_start, now);
+        _stage_start = now;
+    }
+
+    static void
+    end_stage(request_trace* trace, std::string_view name) noexcept {
+        if (trace) [[unlikely]] {
+            trace->end_stage(name);
+        }
+    }
+
+    /// The start of a span, without reading the clock for an unsampled
+    /// request.
+    static clock_type::time_point now(const request_trace* trace) noexcept {
+        return trace ? clock_type::now() : clock_type::time_point{};
+    }
+
+    /// Marks the request as completed, spans recorded later are dropped.
+    void finish() noexcept;
+
+    const ss::sstring& name() const { return _name; }
+    ss::shard_id shard() const { return _shard; }
+    clock_type::time_point started_at() const { return _started_at; }
+
+    // valid once finished
+    clock_type::duration duration() const { return _finished_at - _started_at; }
+    std::span<const span> spans() const { return {_spans.data(), _recorded}; }
+    size_t dropped_spans() const { return _dropped; }
+
+    /// Records a span over the lifetime of the scope, if trace is not null.
+    class scope {
+    public:
+        scope(request_trace* trace, std::string_view name) noexcept
+          : _trace(trace)
+          , _name(name) {
+            if (_trace) [[unlikely]] {
+                _start = clock_type::now();
+            }
+        }
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+        scope(scope&&) = delete;
+        scope& operator=(scope&&) = delete;
+        ~scope() { add_span(_trace, _name, _start); }
+
+    private:
+        request_trace* _trace;
+        std::string_view _name;
+        clock_type::time_point _start;
+    };
+
+private:
+    // past any slot, once finished
+    static constexpr size_t finished = std::numeric_limits<size_t>::max() / 2;
+
+    ss::sstring _name;
+    ss::shard_id _shard{ss::this_shard_id()};
+    clock_type::time_point _started_at;
+    clock_type::time_point _stage_start;
+    clock_type::time_point _finished_at;
+    std::atomic<size_t> _next{0};
+    size_t _recorded{0};
+    size_t _dropped{0};
+    std::array<span, max_spans> _spans;
+};
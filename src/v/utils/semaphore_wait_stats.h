@@ -0,0 +1,66 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+#include "utils/latency_hist.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/shared_ptr.hh>
+
+#include <cstdint>
+
+/*
+ * How long the acquisitions of a semaphore, or of all the semaphores of a
+ * shard gating the same resource, waited for their units. Semaphores are
+ * instrumented when they are given the stats of their name, see
+ * resources::semaphore_metrics which exports them.
+ */
+struct semaphore_wait_stats {
+    // time waited by the acquisitions which did not get their units at once
+    latency_hist wait_time;
+    uint64_t acquisitions{0};
+    // acquisitions which had to wait
+    uint64_t waits{0};
+    // acquisitions which timed out, were aborted or found the semaphore broken
+    uint64_t failed{0};
+    // acquisitions currently waiting
+    uint64_t waiters{0};
+};
+
+/// Records the acquisition of units from a semaphore, \p f being the future
+/// of the units, e.g. ss::get_units(sem, n). A no-op when \p stats is null.
+template<typename Units>
+ss::future<Units> record_semaphore_wait(
+  const ss::lw_shared_ptr<semaphore_wait_stats>& stats, ss::future<Units> f) {
+    if (!stats) {
+        return f;
+    }
+    ++stats->acquisitions;
+    if (f.available()) {
+        if (f.failed()) {
+            ++stats->failed;
+        }
+        return f;
+    }
+    ++stats->waits;
+    ++stats->waiters;
+    return f.then_wrapped(
+      [stats, start = latency_hist::clock_type::now()](ss::future<Units> f) {
+          --stats->waiters;
+          stats->wait_time.record_since(start);
+          if (f.failed()) {
+              ++stats->failed;
+          }
+          return f;
+      });
+}
@@ -12,6 +12,9 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <string_view>
+#include <vector>
+
 BOOST_AUTO_TEST_CASE(bytes_type) {
     auto encdec = [](const bytes& input, const auto expected) {
         auto encoded = bytes_to_base64(input);
@@ -48,3 +51,17 @@ BOOST_AUTO_TEST_CASE(iobuf_type) {
     auto decoded = base64_to_bytes(encoded);
     BOOST_REQUIRE_EQUAL(decoded, iobuf_to_bytes(buf));
 }
+
+BOOST_AUTO_TEST_CASE(iobuf_to_buffer) {
+    iobuf buf;
+    while (std::distance(buf.begin(), buf.end()) < 3) {
+        auto data = random_generators::get_bytes(100);
+        buf.append(data.data(), data.size());
+    }
+
+    std::vector<char> output(base64_encode_capacity(buf.size_bytes()));
+    auto written = iobuf_to_base64(buf, output.data());
+    BOOST_REQUIRE_LE(written, output.size());
+    BOOST_REQUIRE_EQUAL(
+      std::string_view(output.data(), written), iobuf_to_base64(buf));
+}
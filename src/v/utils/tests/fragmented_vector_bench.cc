@@ -0,0 +1,137 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/fragmented_vector.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+constexpr size_t elements = 1'000'000;
+
+// about the size of a segment meta of a partition manifest
+struct entry {
+    int64_t key;
+    std::array<int64_t, 7> payload;
+};
+
+template<typename Vec>
+Vec make_vec() {
+    Vec v;
+    for (size_t i = 0; i < elements; ++i) {
+        v.push_back(entry{.key = static_cast<int64_t>(i * 2)});
+    }
+    return v;
+}
+
+std::vector<entry> make_entries() {
+    std::vector<entry> ret(elements);
+    for (size_t i = 0; i < elements; ++i) {
+        ret[i].key = static_cast<int64_t>(i * 2);
+    }
+    return ret;
+}
+
+struct key_less {
+    bool operator()(const entry& e, int64_t k) const { return e.key < k; }
+    bool operator()(int64_t k, const entry& e) const { return k < e.key; }
+};
+
+template<typename Vec>
+size_t push_back() {
+    perf_tests::start_measuring_time();
+    auto v = make_vec<Vec>();
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(v);
+    return elements;
+}
+
+template<typename Vec>
+size_t random_access() {
+    auto v = make_vec<Vec>();
+    int64_t sum = 0;
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < elements; ++i) {
+        sum += v[(i * 7919) % elements].key;
+    }
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(sum);
+    return elements;
+}
+
+} // namespace
+
+PERF_TEST(fragmented_vector, push_back) {
+    return push_back<fragmented_vector<entry>>();
+}
+PERF_TEST(fragmented_vector, push_back_large_fragment) {
+    return push_back<large_fragment_vector<entry>>();
+}
+PERF_TEST(fragmented_vector, push_back_std_vector) {
+    return push_back<std::vector<entry>>();
+}
+
+PERF_TEST(fragmented_vector, append_range) {
+    const auto entries = make_entries();
+    fragmented_vector<entry> v;
+    perf_tests::start_measuring_time();
+    v.append_range(entries);
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(v);
+    return elements;
+}
+
+PERF_TEST(fragmented_vector, random_access) {
+    return random_access<fragmented_vector<entry>>();
+}
+PERF_TEST(fragmented_vector, random_access_std_vector) {
+    return random_access<std::vector<entry>>();
+}
+
+PERF_TEST(fragmented_vector, std_lower_bound) {
+    auto v = make_vec<fragmented_vector<entry>>();
+    size_t found = 0;
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < elements; ++i) {
+        auto key = static_cast<int64_t>((i * 7919) % (elements * 2));
+        found += std::lower_bound(v.begin(), v.end(), key, key_less{})
+                 - v.begin();
+    }
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(found);
+    return elements;
+}
+
+PERF_TEST(fragmented_vector, lower_bound) {
+    auto v = make_vec<fragmented_vector<entry>>();
+    size_t found = 0;
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < elements; ++i) {
+        auto key = static_cast<int64_t>((i * 7919) % (elements * 2));
+        found += v.lower_bound(key, key_less{}) - v.begin();
+    }
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(found);
+    return elements;
+}
+
+PERF_TEST(fragmented_vector, erase_prefix) {
+    auto v = make_vec<fragmented_vector<entry>>();
+    perf_tests::start_measuring_time();
+    while (!v.empty()) {
+        v.erase_prefix(std::min<size_t>(v.size(), 1000));
+    }
+    perf_tests::stop_measuring_time();
+    return elements / 1000;
+}
@@ -17,7 +17,9 @@
 
 #include <initializer_list>
 #include <limits>
+#include <memory>
 #include <numeric>
+#include <ranges>
 #include <type_traits>
 #include <vector>
 
@@ -36,6 +38,9 @@ struct fragmented_vector_accessor {
         BOOST_REQUIRE(v.size() < std::numeric_limits<size_t>::max() / 2);
         BOOST_REQUIRE(v._capacity < std::numeric_limits<size_t>::max() / 2);
 
+        BOOST_REQUIRE(v._head < v.elems_per_frag);
+        BOOST_REQUIRE(v._head == 0 || !v._frags.empty());
+
         size_t calc_size = 0, calc_cap = 0;
 
         for (size_t i = 0; i < v._frags.size(); ++i) {
@@ -55,6 +60,10 @@ struct fragmented_vector_accessor {
             }
         }
 
+        // the erased elements at the head are only counted by the fragments
+        calc_size -= v._head;
+        calc_cap -= v._head;
+
         if (calc_size != v.size()) {
             throw std::runtime_error(fmt::format(
               "calculated size is wrong ({} != {})", calc_size, v.size()));
@@ -368,3 +377,118 @@ BOOST_AUTO_TEST_CASE(fragmented_vector_constructor_from_iter_range) {
 
     test_details::fragmented_vector_accessor::check_consistency(fv);
 }
+
+BOOST_AUTO_TEST_CASE(fragmented_vector_erase_prefix) {
+    const int elements = 30;
+    for (int i = 0; i <= elements; ++i) {
+        std::vector<int> start_values(elements);
+        std::iota(start_values.begin(), start_values.end(), 0);
+        auto vec = make(start_values);
+
+        vec->erase_prefix(i);
+
+        std::vector<int> expected_values(
+          start_values.begin() + i, start_values.end());
+        BOOST_REQUIRE_EQUAL(vec->size(), expected_values.size());
+        BOOST_REQUIRE_EQUAL_COLLECTIONS(
+          vec->begin(),
+          vec->end(),
+          expected_values.begin(),
+          expected_values.end());
+
+        // the vector keeps working after the prefix was erased
+        for (int j = 0; j < elements; ++j) {
+            vec->push_back(j);
+            expected_values.push_back(j);
+        }
+        vec->erase_prefix(3);
+        expected_values.erase(
+          expected_values.begin(), expected_values.begin() + 3);
+        vec->pop_back_n(5);
+        expected_values.resize(expected_values.size() - 5);
+        BOOST_REQUIRE_EQUAL_COLLECTIONS(
+          vec->begin(),
+          vec->end(),
+          expected_values.begin(),
+          expected_values.end());
+        BOOST_REQUIRE_EQUAL(vec->front(), expected_values.front());
+        BOOST_REQUIRE_EQUAL(vec->back(), expected_values.back());
+        for (size_t j = 0; j < expected_values.size(); ++j) {
+            BOOST_REQUIRE_EQUAL(vec.get()[j], expected_values[j]);
+        }
+        BOOST_REQUIRE(vec.get() == make(expected_values).get());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fragmented_vector_erase_prefix_releases_elements) {
+    fragmented_vector<std::shared_ptr<int>, 64> v;
+    auto p = std::make_shared<int>(1);
+    for (int i = 0; i < 6; ++i) {
+        v.push_back(p);
+    }
+    v.erase_prefix(2);
+    BOOST_CHECK_EQUAL(p.use_count(), 5);
+    v.erase_prefix(4);
+    BOOST_CHECK_EQUAL(p.use_count(), 1);
+    BOOST_CHECK(v.empty());
+}
+
+BOOST_AUTO_TEST_CASE(fragmented_vector_append_range) {
+    for (int size : {0, 1, 7, 8, 9, 100}) {
+        std::vector<int> values(size);
+        std::iota(values.begin(), values.end(), 0);
+
+        for (int prefix : {0, 3, 8}) {
+            auto vec = make(std::vector<int>(prefix, -1));
+            std::vector<int> expected(prefix, -1);
+
+            vec->append_range(values);
+            expected.insert(expected.end(), values.begin(), values.end());
+            BOOST_REQUIRE_EQUAL_COLLECTIONS(
+              vec->begin(), vec->end(), expected.begin(), expected.end());
+
+            // not sized, appended an element at a time
+            vec->append_range(
+              values | std::views::filter([](int v) { return v % 2 == 0; }));
+            std::copy_if(
+              values.begin(),
+              values.end(),
+              std::back_inserter(expected),
+              [](int v) { return v % 2 == 0; });
+            BOOST_REQUIRE_EQUAL_COLLECTIONS(
+              vec->begin(), vec->end(), expected.begin(), expected.end());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fragmented_vector_bounds) {
+    std::vector<int> truth;
+    for (int i = 0; i < 40; ++i) {
+        truth.insert(truth.end(), i % 3 + 1, i * 2);
+    }
+    for (int erased : {0, 1, 5, 8, 13}) {
+        auto vec = make(truth);
+        vec->erase_prefix(erased);
+        const std::vector<int> expected(truth.begin() + erased, truth.end());
+
+        for (int key = -1; key <= 81; ++key) {
+            auto it = std::lower_bound(expected.begin(), expected.end(), key);
+            BOOST_REQUIRE_EQUAL(
+              vec->lower_bound(key) - vec->begin(), it - expected.begin());
+            it = std::upper_bound(expected.begin(), expected.end(), key);
+            BOOST_REQUIRE_EQUAL(
+              std::as_const(vec.get()).upper_bound(key) - vec->cbegin(),
+              it - expected.begin());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fragmented_vector_reserve) {
+    fragmented_vector<int, 32> v;
+    v.reserve(100);
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(i);
+    }
+    BOOST_REQUIRE_EQUAL(v.size(), 100);
+    test_details::fragmented_vector_accessor::check_consistency(v);
+}
@@ -0,0 +1,55 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/frequency_sketch.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(test_frequency_sketch_unseen) {
+    frequency_sketch sketch(1024);
+    for (uint64_t i = 0; i < 100; ++i) {
+        BOOST_REQUIRE_EQUAL(sketch.frequency(i), 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_frequency_sketch_counts) {
+    frequency_sketch sketch(1024);
+    for (int i = 0; i < 5; ++i) {
+        sketch.increment(42);
+    }
+    sketch.increment(7);
+
+    // count-min never underestimates
+    BOOST_REQUIRE_GE(sketch.frequency(42), 5);
+    BOOST_REQUIRE_GE(sketch.frequency(7), 1);
+    BOOST_REQUIRE_LT(sketch.frequency(7), sketch.frequency(42));
+}
+
+BOOST_AUTO_TEST_CASE(test_frequency_sketch_saturates) {
+    frequency_sketch sketch(1024);
+    for (int i = 0; i < 100; ++i) {
+        sketch.increment(1);
+    }
+    BOOST_REQUIRE_EQUAL(sketch.frequency(1), 15);
+}
+
+BOOST_AUTO_TEST_CASE(test_frequency_sketch_ages) {
+    frequency_sketch sketch(1024);
+    for (int i = 0; i < 20; ++i) {
+        sketch.increment(1);
+    }
+    const auto before = sketch.frequency(1);
+    BOOST_REQUIRE_EQUAL(before, 15);
+
+    // enough distinct increments to trigger aging
+    for (uint64_t i = 100; i < 100 + sketch.sample_size(); ++i) {
+        sketch.increment(i);
+    }
+    BOOST_REQUIRE_LT(sketch.frequency(1), before);
+}
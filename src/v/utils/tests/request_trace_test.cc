@@ -0,0 +1,69 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/request_trace.h"
+
+#include <seastar/core/smp.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <algorithm>
+
+SEASTAR_THREAD_TEST_CASE(test_request_trace_spans) {
+    request_trace trace("produce");
+    const auto start = request_trace::clock_type::now();
+    trace.add_span("first", start, start + std::chrono::milliseconds(1));
+    { request_trace::scope s(&trace, "second"); }
+    // an unsampled request records nothing
+    request_trace::add_span(nullptr, "none", start);
+    { request_trace::scope s(nullptr, "none"); }
+    trace.finish();
+    trace.add_span("late", start);
+
+    BOOST_REQUIRE_EQUAL(trace.spans().size(), 2);
+    BOOST_CHECK_EQUAL(trace.spans()[0].name, "first");
+    BOOST_CHECK(trace.spans()[0].start == start);
+    BOOST_CHECK_EQUAL(trace.spans()[1].name, "second");
+    BOOST_CHECK(trace.spans()[1].start <= trace.spans()[1].end);
+    BOOST_CHECK_EQUAL(trace.dropped_spans(), 0);
+    BOOST_CHECK_EQUAL(trace.shard(), ss::this_shard_id());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_request_trace_drops_extra_spans) {
+    request_trace trace("fetch");
+    const auto start = request_trace::clock_type::now();
+    for (size_t i = 0; i < request_trace::max_spans + 5; ++i) {
+        trace.add_span("span", start);
+    }
+    trace.finish();
+    BOOST_CHECK_EQUAL(trace.spans().size(), request_trace::max_spans);
+    BOOST_CHECK_EQUAL(trace.dropped_spans(), 5);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_request_trace_spans_from_all_shards) {
+    request_trace trace("produce");
+    const auto start = request_trace::clock_type::now();
+    ss::smp::invoke_on_all([&trace, start] {
+        for (int i = 0; i < 4; ++i) {
+            trace.add_span("remote", start);
+        }
+    }).get();
+    trace.finish();
+
+    BOOST_REQUIRE_EQUAL(trace.spans().size(), 4 * ss::smp::count);
+    for (ss::shard_id shard = 0; shard < ss::smp::count; ++shard) {
+        BOOST_CHECK_EQUAL(
+          std::count_if(
+            trace.spans().begin(),
+            trace.spans().end(),
+            [shard](const request_trace::span& s) {
+                return s.shard == shard;
+            }),
+          4);
+    }
+}
@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "utils/hdr_hist.h"
+#include "utils/latency_hist.h"
 #include "utils/log_hist.h"
 
 #include <seastar/core/reactor.hh>
@@ -37,3 +38,14 @@ PERF_TEST(log_hist, record) {
     perf_tests::stop_measuring_time();
     perf_tests::do_not_optimize(h.internal_histogram_logform());
 }
+
+PERF_TEST(latency_hist, record) {
+    latency_hist h;
+    perf_tests::start_measuring_time();
+#pragma nounroll
+    for (int i = 0; i < number_of_values_to_record; i++) {
+        [[clang::noinline]] h.record(std::chrono::microseconds(i));
+    }
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(h.internal_histogram_logform());
+}
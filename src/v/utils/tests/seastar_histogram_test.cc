@@ -1,5 +1,6 @@
 #include "metrics/metrics.h"
 #include "utils/hdr_hist.h"
+#include "utils/latency_hist.h"
 #include "utils/log_hist.h"
 
 #include <seastar/core/sleep.hh>
@@ -194,3 +195,86 @@ SEASTAR_THREAD_TEST_CASE(test_log_hist_measure_pause) {
     auto hist = a.internal_histogram_logform();
     BOOST_CHECK_EQUAL(hist.buckets.back().count, 2);
 }
+
+namespace {
+void validate_histograms_equal(
+  const ss::metrics::histogram& a, const ss::metrics::histogram& b) {
+    BOOST_REQUIRE_EQUAL(a.buckets.size(), b.buckets.size());
+    BOOST_CHECK_EQUAL(a.sample_count, b.sample_count);
+    for (size_t idx = 0; idx < a.buckets.size(); ++idx) {
+        BOOST_CHECK(approximately_equal(
+          a.buckets[idx].upper_bound, b.buckets[idx].upper_bound));
+        BOOST_CHECK_EQUAL(a.buckets[idx].count, b.buckets[idx].count);
+    }
+}
+} // namespace
+
+// Ensures that latency_hist exports the same histograms as log_hist given the
+// same latencies, including at the bucket bounds and outside of their range.
+SEASTAR_THREAD_TEST_CASE(test_latency_hist_and_log_hist_equal) {
+    latency_hist a;
+    log_hist_internal b;
+    log_hist_public c;
+
+    auto record = [&](uint64_t us) {
+        a.record(std::chrono::microseconds(us));
+        b.record(us);
+        c.record(us);
+    };
+
+    record(0);
+    record(1);
+    for (unsigned i = 0; i < 30; i++) {
+        auto upper_bound
+          = (((uint64_t)1 << (log_hist_internal::first_bucket_exp + i)) - 1);
+        record(upper_bound);
+        record(upper_bound + 1);
+    }
+
+    std::mt19937 gen(std::random_device{}());
+    std::uniform_int_distribution<uint64_t> dist(0, 3'000'000);
+    for (int i = 0; i < 1000; i++) {
+        record(dist(gen));
+    }
+
+    validate_histograms_equal(
+      a.internal_histogram_logform(), b.internal_histogram_logform());
+    validate_histograms_equal(
+      a.public_histogram_logform(), c.public_histogram_logform());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_latency_hist_sub_microsecond) {
+    using namespace std::chrono_literals;
+
+    latency_hist a;
+    a.record(999ns);
+    a.record(-1ns);
+    a.record(8us);
+
+    BOOST_CHECK_EQUAL(a.count(), 3);
+    BOOST_CHECK_EQUAL(a.sum().count(), 8999);
+
+    auto hist = a.internal_histogram_logform();
+    BOOST_CHECK_EQUAL(hist.buckets[0].count, 2);
+    BOOST_CHECK_EQUAL(hist.buckets[1].count, 3);
+    BOOST_CHECK_EQUAL(hist.buckets.back().count, 3);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_latency_hist_quantile) {
+    using namespace std::chrono_literals;
+
+    latency_hist a;
+    BOOST_CHECK_EQUAL(latency_hist::quantile(a.counts(), 0.99).count(), 0);
+
+    for (int i = 0; i < 98; ++i) {
+        a.record(10us);
+    }
+    a.record(5ms);
+    a.record(5ms);
+
+    // the upper bounds of the buckets of the exposition
+    BOOST_CHECK_EQUAL(latency_hist::quantile(a.counts(), 0.5).count(), 15);
+    BOOST_CHECK_EQUAL(latency_hist::quantile(a.counts(), 0.98).count(), 15);
+    BOOST_CHECK_EQUAL(latency_hist::quantile(a.counts(), 0.99).count(), 8191);
+    BOOST_CHECK_EQUAL(latency_hist::quantile(a.counts(), 1.0).count(), 8191);
+}
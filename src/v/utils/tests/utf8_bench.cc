@@ -0,0 +1,69 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/utf8.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <boost/locale/encoding_utf.hpp>
+
+#include <string>
+
+namespace {
+
+constexpr size_t iterations = 100;
+
+// a large JSON message as posted to the REST proxy, mostly ascii
+std::string json_message(size_t size, bool non_ascii) {
+    std::string ret;
+    ret.reserve(size);
+    ret.append(R"({"records":[)");
+    while (ret.size() < size) {
+        ret.append(R"({"key":"user-12345","value":{"name":")");
+        ret.append(non_ascii ? "J\xc3\xbcrgen \xe2\x82\xac" : "Juergen EUR");
+        ret.append(R"(","tags":["a","b","c"],"count":42}},)");
+    }
+    ret.append("]}");
+    return ret;
+}
+
+size_t run(const std::string& s) {
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < iterations; ++i) {
+        perf_tests::do_not_optimize(is_valid_utf8(s));
+    }
+    perf_tests::stop_measuring_time();
+    return iterations * s.size();
+}
+
+size_t run_boost(const std::string& s) {
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < iterations; ++i) {
+        perf_tests::do_not_optimize(boost::locale::conv::utf_to_utf<char>(
+          s.data(), s.data() + s.size(), boost::locale::conv::stop));
+    }
+    perf_tests::stop_measuring_time();
+    return iterations * s.size();
+}
+
+} // namespace
+
+struct utf8_bench {
+    std::string ascii = json_message(1 << 20, false);
+    std::string mixed = json_message(1 << 20, true);
+    std::string name = "orders.eu-west-1.v2";
+};
+
+PERF_TEST_F(utf8_bench, topic_name) { return run(name); }
+PERF_TEST_F(utf8_bench, json_ascii) { return run(ascii); }
+PERF_TEST_F(utf8_bench, json_mixed) { return run(mixed); }
+
+// the boost::locale conversion previously used for validation
+PERF_TEST_F(utf8_bench, json_ascii_boost) { return run_boost(ascii); }
+PERF_TEST_F(utf8_bench, json_mixed_boost) { return run_boost(mixed); }
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "utils/utf8.h"
+
+#include <boost/locale/encoding_utf.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <random>
+#include <string>
+
+namespace {
+
+bool boost_is_valid_utf8(std::string_view s) {
+    try {
+        boost::locale::conv::utf_to_utf<char>(
+          s.begin(), s.end(), boost::locale::conv::stop);
+    } catch (const boost::locale::conv::conversion_error&) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(utf8_well_formed) {
+    for (std::string_view s : {
+           "",
+           "hello",
+           "caf\xc3\xa9",
+           "\xe2\x82\xac",
+           "\xef\xbf\xbf",
+           "\xf0\x9f\x90\xbc",
+           "\xf4\x8f\xbf\xbf",
+         }) {
+        BOOST_CHECK_MESSAGE(is_valid_utf8(s), s);
+        BOOST_CHECK_NO_THROW(validate_utf8(s));
+    }
+    BOOST_CHECK(is_valid_utf8(std::string_view("\0", 1)));
+}
+
+BOOST_AUTO_TEST_CASE(utf8_ill_formed) {
+    for (std::string_view s : {
+           // lone continuation
+           "\x80",
+           // truncated
+           "\xc3",
+           "\xe2\x82",
+           // overlong
+           "\xc0\xaf",
+           "\xe0\x80\xaf",
+           "\xf0\x80\x80\xaf",
+           // surrogate
+           "\xed\xa0\x80",
+           // past U+10FFFF
+           "\xf4\x90\x80\x80",
+           "\xf5\x80\x80\x80",
+           // bad continuation
+           "\xe2\x28\xa1",
+           "\xff",
+         }) {
+        BOOST_CHECK(!is_valid_utf8(s));
+        BOOST_CHECK_THROW(validate_utf8(s), std::runtime_error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(utf8_invalid_byte_in_ascii_run) {
+    // the invalid byte at every position of runs longer than the blocks
+    // checked at once
+    for (size_t len : {1, 15, 16, 17, 63, 64, 65, 200}) {
+        for (size_t i = 0; i < len; ++i) {
+            std::string s(len, 'a');
+            BOOST_CHECK(is_valid_utf8(s));
+            s[i] = '\xff';
+            BOOST_CHECK(!is_valid_utf8(s));
+            s[i] = '\xc3';
+            BOOST_CHECK(!is_valid_utf8(s));
+            if (i + 1 < len) {
+                s[i + 1] = '\xa9';
+                BOOST_CHECK(is_valid_utf8(s));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(utf8_matches_boost_locale) {
+    std::mt19937 gen(42); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::uniform_int_distribution<size_t> length(0, 256);
+    std::uniform_int_distribution<uint32_t> cp(0, 0x10ffff);
+    for (int i = 0; i < 10000; ++i) {
+        std::string s;
+        const auto len = length(gen);
+        while (s.size() < len) {
+            auto c = cp(gen);
+            if (c >= 0xd800 && c <= 0xdfff) {
+                continue;
+            }
+            if (i % 2 == 0) {
+                c %= 0x80;
+            }
+            boost::locale::utf::utf_traits<char>::encode(
+              c, std::back_inserter(s));
+        }
+        if (!s.empty() && i % 3 != 0) {
+            s[length(gen) % s.size()] = static_cast<char>(byte(gen));
+        }
+        BOOST_CHECK_EQUAL(is_valid_utf8(s), boost_is_valid_utf8(s));
+    }
+}
@@ -53,6 +53,30 @@ SEASTAR_THREAD_TEST_CASE(sanity_unsigned_sweep_32) {
     check_roundtrip_sweep_unsigned(100000000);
 }
 
+SEASTAR_THREAD_TEST_CASE(word_deserializer) {
+    std::array<char, vint::max_length + sizeof(uint64_t)> buf{};
+    for (int i = 0; i < 100000; ++i) {
+        const auto shift = random_generators::get_int(0, 63);
+        const auto value = random_generators::get_int<int64_t>() >> shift;
+        const auto size = vint::serialize(
+          value, reinterpret_cast<uint8_t*>(buf.data()));
+        auto [v, bytes_read] = vint::deserialize_word(buf.data());
+        if (size <= sizeof(uint64_t)) {
+            BOOST_REQUIRE_EQUAL(v, value);
+            BOOST_REQUIRE_EQUAL(bytes_read, size);
+        } else {
+            BOOST_REQUIRE_EQUAL(bytes_read, 0);
+        }
+
+        const auto u = static_cast<uint32_t>(value);
+        const auto usize = unsigned_vint::serialize(
+          u, reinterpret_cast<uint8_t*>(buf.data()));
+        auto [uv, ubytes_read] = unsigned_vint::deserialize_word(buf.data());
+        BOOST_REQUIRE_EQUAL(uv, u);
+        BOOST_REQUIRE_EQUAL(ubytes_read, usize);
+    }
+}
+
 SEASTAR_THREAD_TEST_CASE(test_unsigned_stream_deserializer) {
     /// Final byte must have 0b0xxx, the 0 denotes to stop reading
     static constexpr uint64_t max_unsigned_vint
@@ -11,20 +11,126 @@
 
 #include "utils/utf8.h"
 
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 thread_local bool permit_unsafe_log_operation::_flag = false;
 
+namespace {
+
+constexpr uint64_t high_bits = 0x8080808080808080;
+
+#if defined(__SSE2__)
+__m128i load(const uint8_t* p) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+#endif
+
+/*
+ * Length of the leading run of ascii bytes. Text is mostly ascii (JSON
+ * syntax, names, keys) so the run is skipped a block at a time and only the
+ * multi-byte sequences are decoded.
+ */
+size_t ascii_prefix(const uint8_t* p, size_t n) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 64 <= n; i += 64) {
+        const auto v = _mm_or_si128(
+          _mm_or_si128(load(p + i), load(p + i + 16)),
+          _mm_or_si128(load(p + i + 32), load(p + i + 48)));
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+    }
+    for (; i + 16 <= n; i += 16) {
+        const auto mask = static_cast<uint32_t>(
+          _mm_movemask_epi8(load(p + i)));
+        if (mask != 0) {
+            return i + std::countr_zero(mask);
+        }
+    }
+#endif
+    for (; i + sizeof(uint64_t) <= n; i += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::memcpy(&word, p + i, sizeof(word));
+        if ((word & high_bits) != 0) {
+            break;
+        }
+    }
+    while (i < n && p[i] < 0x80) {
+        ++i;
+    }
+    return i;
+}
+
+bool is_continuation(uint8_t c) { return (c & 0xc0) == 0x80; }
+
+/*
+ * Length of the well-formed multi-byte sequence at p, or 0. Follows table
+ * 3-7 of the Unicode standard: overlong encodings, surrogates and code
+ * points past U+10FFFF are invalid.
+ */
+size_t multibyte_sequence(const uint8_t* p, size_t n) {
+    const auto lead = p[0];
+    size_t len = 0;
+    // range of the second byte, which depends on the lead byte
+    uint8_t lo = 0x80;
+    uint8_t hi = 0xbf;
+    if (lead >= 0xc2 && lead <= 0xdf) {
+        len = 2;
+    } else if (lead >= 0xe0 && lead <= 0xef) {
+        len = 3;
+        if (lead == 0xe0) {
+            lo = 0xa0;
+        } else if (lead == 0xed) {
+            hi = 0x9f;
+        }
+    } else if (lead >= 0xf0 && lead <= 0xf4) {
+        len = 4;
+        if (lead == 0xf0) {
+            lo = 0x90;
+        } else if (lead == 0xf4) {
+            hi = 0x8f;
+        }
+    } else {
+        return 0;
+    }
+    if (n < len || p[1] < lo || p[1] > hi) {
+        return 0;
+    }
+    for (size_t i = 2; i < len; ++i) {
+        if (!is_continuation(p[i])) {
+            return 0;
+        }
+    }
+    return len;
+}
+
+} // namespace
+
 bool is_valid_utf8(std::string_view s) {
-    bool is_valid = true;
-    class default_utf8_checker {
-    public:
-        explicit default_utf8_checker(bool* is_valid)
-          : _is_valid(is_valid) {}
-
-        void conversion_error() { *_is_valid = false; }
-
-    private:
-        bool* _is_valid;
-    };
-    validate_utf8(s, default_utf8_checker{&is_valid});
-    return is_valid;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* p = reinterpret_cast<const uint8_t*>(s.data());
+    auto n = s.size();
+    while (n > 0) {
+        const auto ascii = ascii_prefix(p, n);
+        p += ascii;
+        n -= ascii;
+        if (n == 0) {
+            break;
+        }
+        const auto len = multibyte_sequence(p, n);
+        if (len == 0) {
+            return false;
+        }
+        p += len;
+        n -= len;
+    }
+    return true;
 }
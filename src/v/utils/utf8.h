@@ -13,9 +13,8 @@
 
 #include "likely.h"
 
-#include <boost/locale.hpp>
-#include <boost/locale/encoding_utf.hpp>
-
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -105,13 +104,16 @@ inline void validate_no_control(std::string_view s) {
     validate_no_control(s, default_control_character_thrower{s});
 }
 
+/*
+ * True if s is well-formed UTF-8. Runs of ascii are checked a block at a
+ * time (with SSE2 where available), only multi-byte sequences are decoded.
+ */
+bool is_valid_utf8(std::string_view s);
+
 template<typename Thrower>
 requires ExceptionThrower<Thrower>
 inline void validate_utf8(std::string_view s, Thrower&& thrower) {
-    try {
-        boost::locale::conv::utf_to_utf<char>(
-          s.begin(), s.end(), boost::locale::conv::stop);
-    } catch (const boost::locale::conv::conversion_error& ex) {
+    if (unlikely(!is_valid_utf8(s))) {
         thrower.conversion_error();
     }
 }
@@ -119,5 +121,3 @@ inline void validate_utf8(std::string_view s, Thrower&& thrower) {
 inline void validate_utf8(std::string_view s) {
     validate_utf8(s, default_utf8_thrower{});
 }
-
-bool is_valid_utf8(std::string_view s);
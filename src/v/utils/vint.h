@@ -12,7 +12,11 @@
 #pragma once
 #include "bytes/bytes.h"
 
+#include <seastar/core/byteorder.hh>
+
+#include <bit>
 #include <cstdint>
+#include <cstring>
 
 namespace unsigned_vint {
 /// At most 5 bytes are needed to encode a 32 bit value
@@ -63,6 +67,41 @@ deserialize(Range&& r, uint8_t limit) noexcept {
     return std::make_pair(decoder.result, decoder.bytes_read);
 }
 
+/**
+ * Decodes a varint of at most max_bytes bytes from the 8 bytes starting at
+ * src, all of which must be readable. The 7 bit groups of the bytes are
+ * gathered with a few word wide operations rather than byte by byte.
+ * Returns zero bytes read when the varint is longer than max_bytes or than
+ * 8 bytes, the byte by byte decoder handles those.
+ */
+inline std::pair<uint64_t, size_t>
+deserialize_word(const char* src, size_t max_bytes) noexcept {
+    uint64_t word;
+    std::memcpy(&word, src, sizeof(word));
+    word = ss::le_to_cpu(word);
+    // the last byte of the varint is the first one without continuation bit
+    const uint64_t last = ~word & 0x8080808080808080ULL;
+    if (last == 0) {
+        return {0, 0};
+    }
+    const size_t length = (std::countr_zero(last) + 1) / 8;
+    if (length > max_bytes) {
+        return {0, 0};
+    }
+    if (length < sizeof(word)) {
+        word &= (uint64_t(1) << (length * 8)) - 1;
+    }
+    word &= 0x7f7f7f7f7f7f7f7fULL;
+    // merge neighbouring groups into 14, 28 and then 56 contiguous bits
+    word = (word & 0x007f007f007f007fULL)
+           | ((word & 0x7f007f007f007f00ULL) >> 1);
+    word = (word & 0x00003fff00003fffULL)
+           | ((word & 0x3fff00003fff0000ULL) >> 2);
+    word = (word & 0x000000000fffffffULL)
+           | ((word & 0x0fffffff00000000ULL) >> 4);
+    return {word, length};
+}
+
 } // namespace detail
 
 inline size_t serialize(uint64_t value, uint8_t* out) noexcept {
@@ -94,6 +133,12 @@ inline std::pair<uint32_t, size_t> deserialize(Range&& r) noexcept {
     return {static_cast<uint32_t>(result), bytes_read};
 }
 
+/// Decodes from the 8 readable bytes at src, see detail::deserialize_word.
+inline std::pair<uint32_t, size_t> deserialize_word(const char* src) noexcept {
+    auto [result, bytes_read] = detail::deserialize_word(src, max_length);
+    return {static_cast<uint32_t>(result), bytes_read};
+}
+
 inline constexpr size_t size(uint64_t v) noexcept {
     size_t len = 1;
     while (v >= 128) {
@@ -160,6 +205,14 @@ inline std::pair<int64_t, size_t> deserialize(Range&& r) noexcept {
     return {decode_zigzag(result), bytes_read};
 }
 
+/// Decodes from the 8 readable bytes at src. Returns zero bytes read for
+/// values encoded in more than 8 bytes, see deserialize() for those.
+inline std::pair<int64_t, size_t> deserialize_word(const char* src) noexcept {
+    auto [result, bytes_read] = unsigned_vint::detail::deserialize_word(
+      src, max_length);
+    return {decode_zigzag(result), bytes_read};
+}
+
 inline bytes to_bytes(int64_t value) noexcept {
     // our bytes uses a short-string optimization of 31 bytes, at most
     // vint::max_length bytes will be used to allocate the encoded size at the
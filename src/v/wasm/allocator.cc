@@ -10,6 +10,7 @@
  */
 #include "wasm/allocator.h"
 
+#include "prometheus/prometheus_sanitize.h"
 #include "ssx/future-util.h"
 #include "vassert.h"
 #include "vlog.h"
@@ -34,7 +35,8 @@
 namespace wasm {
 
 heap_allocator::heap_allocator(config c)
-  : _memset_chunk_size(c.memset_chunk_size) {
+  : _memset_chunk_size(c.memset_chunk_size)
+  , _num_heaps(c.num_heaps) {
     size_t page_size = ::getpagesize();
     _size = ss::align_up(c.heap_memory_size, page_size);
     for (size_t i = 0; i < c.num_heaps; ++i) {
@@ -45,6 +47,8 @@ heap_allocator::heap_allocator(config c)
 }
 
 ss::future<> heap_allocator::stop() {
+    _metrics.clear();
+    _heap_returned.broken();
     auto pool = std::exchange(_memory_pool, {});
     co_await ss::when_all_succeed(pool.begin(), pool.end());
 }
@@ -61,8 +65,30 @@ ss::future<std::optional<heap_memory>> heap_allocator::allocate(request req) {
     co_return co_await std::move(front);
 }
 
+ss::future<std::optional<heap_memory>>
+heap_allocator::allocate(request req, std::chrono::milliseconds timeout) {
+    if (_size < req.minimum || _size > req.maximum) {
+        co_return std::nullopt;
+    }
+    if (_memory_pool.empty()) {
+        ++_waiters;
+        try {
+            co_await _heap_returned.wait(
+              timeout, [this] { return !_memory_pool.empty(); });
+        } catch (const ss::condition_variable_timed_out&) {
+        } catch (const ss::broken_condition_variable&) {
+        }
+        --_waiters;
+        if (_memory_pool.empty()) {
+            co_return std::nullopt;
+        }
+    }
+    co_return co_await allocate(req);
+}
+
 void heap_allocator::deallocate(heap_memory m, size_t used_amount) {
     _memory_pool.push_back(async_zero_memory(std::move(m), used_amount));
+    _heap_returned.signal();
 }
 
 ss::future<heap_memory>
@@ -84,6 +110,34 @@ heap_allocator::async_zero_memory(heap_memory m, size_t used_amount) {
 
 size_t heap_allocator::max_size() const { return _size; }
 
+size_t heap_allocator::reserved_bytes() const { return _num_heaps * _size; }
+
+size_t heap_allocator::allocated_bytes() const {
+    return (_num_heaps - _memory_pool.size()) * _size;
+}
+
+void heap_allocator::setup_metrics() {
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("wasm_heap"),
+      {
+        sm::make_gauge(
+          "reserved_bytes",
+          [this] { return reserved_bytes(); },
+          sm::description("Memory reserved for WebAssembly heaps")),
+        sm::make_gauge(
+          "allocated_bytes",
+          [this] { return allocated_bytes(); },
+          sm::description(
+            "Memory of the WebAssembly heaps allocated to running engines")),
+        sm::make_gauge(
+          "waiters",
+          [this] { return _waiters; },
+          sm::description(
+            "Number of engines waiting for a WebAssembly heap to be freed")),
+      });
+}
+
 stack_memory::stack_memory(stack_bounds bounds, allocated_memory data)
   : _bounds(bounds)
   , _data(std::move(data)) {}
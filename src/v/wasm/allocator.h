@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include "metrics/metrics.h"
 #include "seastarx.h"
 
 #include <seastar/core/aligned_buffer.hh>
@@ -20,6 +21,7 @@
 
 #include <absl/container/btree_set.h>
 
+#include <chrono>
 #include <type_traits>
 
 namespace wasm {
@@ -90,6 +92,17 @@ public:
      */
     ss::future<std::optional<heap_memory>> allocate(request);
 
+    /**
+     * Allocate heap memory like above, but when all the memory is currently
+     * allocated wait up to timeout for some to be returned to the pool,
+     * instead of failing right away.
+     *
+     * The waiters are woken in the order they started waiting, returns
+     * std::nullopt on timeout or if the allocator is stopped.
+     */
+    ss::future<std::optional<heap_memory>>
+      allocate(request, std::chrono::milliseconds timeout);
+
     /**
      * Deallocate heap memory by returing a memory instance to the pool.
      *
@@ -105,11 +118,28 @@ public:
      */
     size_t max_size() const;
 
+    /**
+     * The memory reserved for heaps on this core, and the part of it that is
+     * currently allocated.
+     */
+    size_t reserved_bytes() const;
+    size_t allocated_bytes() const;
+
+    /**
+     * Register the metrics of this allocator, they are not registered by
+     * default as there can be many allocators on a core in tests.
+     */
+    void setup_metrics();
+
 private:
     ss::future<heap_memory> async_zero_memory(heap_memory, size_t used_amount);
 
     size_t _memset_chunk_size;
     size_t _size;
+    size_t _num_heaps;
+    size_t _waiters = 0;
+    ss::condition_variable _heap_returned;
+    metrics::internal_metric_groups _metrics;
     // We expect this list to be small, so override the chunk to be smaller too.
     static constexpr size_t items_per_chunk = 16;
     ss::chunked_fifo<ss::future<heap_memory>, items_per_chunk> _memory_pool;
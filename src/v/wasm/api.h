@@ -17,7 +17,9 @@
 #include "seastarx.h"
 #include "wasm/fwd.h"
 
+#include <filesystem>
 #include <memory>
+#include <optional>
 
 namespace wasm {
 
@@ -101,6 +103,12 @@ public:
             bool debug_host_stack_usage;
         };
         stack_memory stack_memory;
+        struct compilation_cache {
+            // The directory the compiled modules are cached in, so that they
+            // are not compiled again on restart. Not cached when unset.
+            std::optional<std::filesystem::path> directory;
+        };
+        compilation_cache compilation_cache;
     };
 
     virtual ss::future<> start(config) = 0;
@@ -62,6 +62,13 @@ gc_btree_map(absl::btree_map<Key, ss::weak_ptr<Value>>* cache) {
  * Allows sharing an engine between multiple uses.
  *
  * Must live on a single core.
+ *
+ * Once the engine failed, a standby engine is started in the background, so
+ * that on the next failure the standby is swapped in rather than the users
+ * waiting for the failed engine to restart. The failed engine is then restarted
+ * in the background to become the next standby. The standby holds a heap of its
+ * own, it's only started for the engines that have failed, and the restart is
+ * inline when it could not be started.
  */
 class shared_engine
   : public engine
@@ -70,8 +77,10 @@ class shared_engine
 public:
     explicit shared_engine(
       ss::shared_ptr<engine> underlying,
+      factory* underlying_factory,
       ss::foreign_ptr<ss::shared_ptr<factory>> f)
       : _underlying(std::move(underlying))
+      , _underlying_factory(underlying_factory)
       , _factory(std::move(f)) {}
 
     ss::future<model::record_batch>
@@ -82,6 +91,14 @@ public:
         if (!fut.failed()) {
             co_return fut.get();
         }
+        if (_standby) {
+            // Swap in the standby and restart the failed engine as the next
+            // standby.
+            auto failed = std::exchange(
+              _underlying, std::exchange(_standby, nullptr));
+            _standby_task = start_standby(std::move(failed));
+            std::rethrow_exception(fut.get_exception());
+        }
         // Restart the engine
         try {
             co_await _underlying->stop();
@@ -92,6 +109,9 @@ public:
               "failed to restart wasm engine: {}",
               std::current_exception());
         }
+        if (_standby_task.available()) {
+            _standby_task = make_standby();
+        }
         std::rethrow_exception(fut.get_exception());
     }
 
@@ -106,6 +126,10 @@ public:
           _ref_count > 0, "expected a call to start before a call to stop");
         auto u = co_await _mu.get_units();
         if (--_ref_count == 0) {
+            co_await std::exchange(_standby_task, ss::now());
+            if (auto standby = std::exchange(_standby, nullptr)) {
+                co_await standby->stop();
+            }
             co_await _underlying->stop();
         }
     }
@@ -116,9 +140,46 @@ public:
     }
 
 private:
+    ss::future<> make_standby() {
+        ss::shared_ptr<engine> standby;
+        try {
+            standby = co_await _underlying_factory->make_engine();
+        } catch (...) {
+            vlog(
+              wasm_log.debug,
+              "failed to create standby wasm engine: {}",
+              std::current_exception());
+            co_return;
+        }
+        co_await start_standby(std::move(standby), /*restart=*/false);
+    }
+
+    // Never fails, the engine is dropped if it could not be started.
+    ss::future<>
+    start_standby(ss::shared_ptr<engine> standby, bool restart = true) {
+        try {
+            if (restart) {
+                co_await standby->stop();
+            }
+            co_await standby->start();
+        } catch (...) {
+            vlog(
+              wasm_log.debug,
+              "failed to start standby wasm engine: {}",
+              std::current_exception());
+            co_return;
+        }
+        _standby = std::move(standby);
+    }
+
     mutex _mu;
     size_t _ref_count = 0;
     ss::shared_ptr<engine> _underlying;
+    ss::shared_ptr<engine> _standby;
+    // The creation or restart of the standby, awaited on stop
+    ss::future<> _standby_task = ss::now();
+    // Owned by _factory, creates the standby engines.
+    factory* _underlying_factory;
     // This factory reference is here to keep the cache entry alive.
     ss::foreign_ptr<ss::shared_ptr<factory>> _factory;
 };
@@ -247,7 +308,9 @@ public:
         // created.
         auto foreign_this = co_await foreign_from_this();
         auto created = ss::make_shared<shared_engine>(
-          co_await _underlying->make_engine(), std::move(foreign_this));
+          co_await _underlying->make_engine(),
+          _underlying.get(),
+          std::move(foreign_this));
         _engine_cache->local().put(_offset, created);
         co_return created;
     }
@@ -157,6 +157,8 @@ public:
     ss::sstring read_sized_string();
     int64_t read_varint();
 
+    size_t remaining() const noexcept { return _input.size() - _offset; }
+
 private:
     array<uint8_t> slice_remainder();
 
@@ -118,6 +118,35 @@ TEST(HeapAllocatorTest, CanReturnMemoryToThePool) {
     EXPECT_FALSE(mem.has_value());
 }
 
+TEST(HeapAllocatorTest, WaitsForMemoryToBeReturned) {
+    using namespace std::chrono_literals;
+    size_t page_size = ::getpagesize();
+    heap_allocator allocator(heap_allocator::config{
+      .heap_memory_size = page_size,
+      .num_heaps = 1,
+      .memset_chunk_size = default_memset_chunk_size,
+    });
+    heap_allocator::request req{.minimum = page_size, .maximum = page_size};
+    auto mem = allocator.allocate(req).get();
+    ASSERT_TRUE(mem.has_value());
+    EXPECT_EQ(allocator.reserved_bytes(), page_size);
+    EXPECT_EQ(allocator.allocated_bytes(), page_size);
+    // No memory is returned in time
+    EXPECT_EQ(allocator.allocate(req, 1ms).get(), std::nullopt);
+    // The waiter gets the memory once it's returned
+    auto waiter = allocator.allocate(req, 1h);
+    EXPECT_FALSE(waiter.available());
+    allocator.deallocate(*std::move(mem), /*used_amount=*/0);
+    mem = waiter.get();
+    EXPECT_TRUE(mem.has_value());
+    EXPECT_EQ(allocator.allocated_bytes(), page_size);
+    // Stopping the allocator wakes up the waiters
+    waiter = allocator.allocate(req, 1h);
+    auto stopped = allocator.stop();
+    EXPECT_EQ(waiter.get(), std::nullopt);
+    stopped.get();
+}
+
 // We want to test a specific scenario where the deallocation happens
 // asynchronously, however, release mode continuations can be "inlined" into the
 // current executing task, so we can't enforce the scenario we want to test, so
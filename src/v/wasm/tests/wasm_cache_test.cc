@@ -15,6 +15,7 @@
 #include "model/tests/randoms.h"
 #include "model/transform.h"
 #include "random/generators.h"
+#include "test_utils/async.h"
 #include "wasm/api.h"
 #include "wasm/cache.h"
 
@@ -267,6 +268,39 @@ TEST_F(WasmCacheTest, CanMultiplexTransforms) {
     EXPECT_EQ(state()->running_engines, 0);
 }
 
+TEST_F(WasmCacheTest, SwapsInStandbyEngines) {
+    auto meta = random_metadata();
+    auto factory = ss::make_foreign(make_factory(meta));
+    auto engine = factory->make_engine().get();
+    engine->start().get();
+    state()->engine_transform_should_throw = true;
+    EXPECT_THROW(
+      engine->transform(random_batch(), nullptr).get(), std::runtime_error);
+    // The first failure restarts the engine inline and starts a standby.
+    EXPECT_EQ(state()->engine_restarts, 1);
+    tests::cooperative_spin_wait_with_timeout(
+      std::chrono::seconds(10), [this] {
+          return state()->running_engines == 2;
+      })
+      .get();
+    EXPECT_EQ(state()->engines, 2);
+    // The next failure swaps in the standby, the failed engine is restarted
+    // in the background as the next standby.
+    EXPECT_THROW(
+      engine->transform(random_batch(), nullptr).get(), std::runtime_error);
+    tests::cooperative_spin_wait_with_timeout(
+      std::chrono::seconds(10), [this] {
+          return state()->engine_restarts == 2
+                 && state()->running_engines == 2;
+      })
+      .get();
+    EXPECT_EQ(state()->engines, 2);
+    state()->engine_transform_should_throw = false;
+    EXPECT_NO_THROW(engine->transform(random_batch(), nullptr).get());
+    engine->stop().get();
+    EXPECT_EQ(state()->running_engines, 0);
+}
+
 TEST_F(WasmCacheTest, GC) {
     auto meta = random_metadata();
     auto factory = ss::make_foreign(make_factory(meta));
@@ -45,7 +45,7 @@ public:
         _engine = nullptr;
         if (!_runtime) {
             _runtime = wasm::wasmtime::create_runtime(nullptr);
-            constexpr wasm::runtime::config wasm_runtime_config {
+            const wasm::runtime::config wasm_runtime_config {
                 .heap_memory = {
                   .per_core_pool_size_bytes = 20_MiB,
                   .per_engine_memory_limit = 20_MiB,
@@ -84,7 +84,9 @@ public:
         _runtime = nullptr;
     }
 
-    ss::future<> run_test() {
+    // Returns the records transformed, so that the runs are reported per
+    // record.
+    ss::future<size_t> run_test() {
         model::record_batch batch = model::test::make_random_batch(
           model::test::record_batch_spec{
             .allow_compression = false,
@@ -94,6 +96,7 @@ public:
         perf_tests::start_measuring_time();
         return _engine->transform(std::move(batch), &_probe).then([](auto) {
             perf_tests::stop_measuring_time();
+            return BatchSize;
         });
     }
 
@@ -116,6 +119,8 @@ private:
 WASM_IDENTITY_PERF_TEST(1, 1_KiB);
 WASM_IDENTITY_PERF_TEST(10, 1_KiB);
 WASM_IDENTITY_PERF_TEST(10, 512);
+WASM_IDENTITY_PERF_TEST(100, 1_KiB);
+WASM_IDENTITY_PERF_TEST(1000, 128);
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define MEMSET_PERF_TEST(buf_size)                                             \
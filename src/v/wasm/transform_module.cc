@@ -195,6 +195,82 @@ int32_t transform_module::write_record(ffi::array<uint8_t> buf) {
     return int32_t(buf.size());
 }
 
+void transform_module::check_abi_version_2() {
+    // The guests built for this version read and write the records of a
+    // batch in bulk, see read_records and write_records.
+}
+
+ss::future<int32_t> transform_module::read_records(ffi::array<uint8_t> buf) {
+    if (!_call_ctx) {
+        co_return NO_ACTIVE_TRANSFORM;
+    }
+    co_await ss::coroutine::maybe_yield();
+
+    auto& records = _call_ctx->records;
+    size_t size = 0;
+    std::optional<model::timestamp> timestamp;
+    while (!records.empty()) {
+        const auto& record = records.front();
+        const auto record_size = record.metadata_size + record.payload_size;
+        if (size + record_size > buf.size()) {
+            break;
+        }
+        size += record_size;
+        timestamp = record.timestamp;
+        records.pop_front();
+    }
+    if (!timestamp) {
+        if (records.empty()) {
+            co_return 0;
+        }
+        vlog(
+          wasm_log.debug,
+          "read_records invalid buffer size: {} < {}",
+          buf.size(),
+          records.front().metadata_size + records.front().payload_size);
+        co_return INVALID_BUFFER;
+    }
+
+    _wasi_module->set_walltime(*timestamp);
+
+    // The records are copied out as they are within the batch
+    {
+        iobuf_const_parser parser(_call_ctx->batch_data);
+        parser.consume_to(size, buf.data());
+    }
+    _call_ctx->batch_data.trim_front(size);
+
+    // Call back so we can refuel.
+    _call_ctx->record_callback();
+
+    co_return int32_t(size);
+}
+
+int32_t transform_module::write_records(ffi::array<uint8_t> buf) {
+    if (!_call_ctx) {
+        return NO_ACTIVE_TRANSFORM;
+    }
+    ss::chunked_fifo<model::transformed_data> output;
+    try {
+        ffi::reader r(buf);
+        while (r.remaining() > 0) {
+            auto d = model::transformed_data::create_validated(
+              r.read_sized_iobuf());
+            if (!d) {
+                return INVALID_BUFFER;
+            }
+            output.push_back(*std::move(d));
+        }
+    } catch (const std::out_of_range& ex) {
+        vlog(wasm_log.debug, "write_records invalid buffer: {}", ex.what());
+        return INVALID_BUFFER;
+    }
+    for (auto& d : output) {
+        _call_ctx->output_data.push_back(std::move(d));
+    }
+    return int32_t(buf.size());
+}
+
 void transform_module::start() {
     _guest_cond_var.emplace();
     _host_cond_var.emplace();
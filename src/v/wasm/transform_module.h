@@ -121,6 +121,23 @@ public:
 
     int32_t write_record(ffi::array<uint8_t>);
 
+    void check_abi_version_2();
+
+    /**
+     * Copies as many of the remaining records of the batch as fit into the
+     * buffer, encoded as they are within a batch (length, attributes,
+     * timestamp delta, offset delta and payload).
+     *
+     * Returns the amount written, 0 once all the records are read.
+     */
+    ss::future<int32_t> read_records(ffi::array<uint8_t>);
+
+    /**
+     * Writes the records in the buffer, each a payload as for write_record,
+     * prefixed by its length as a varint.
+     */
+    int32_t write_records(ffi::array<uint8_t>);
+
     // End ABI exports
 
 private:
@@ -10,6 +10,8 @@
  */
 #include "wasm/wasmtime.h"
 
+#include "bytes/bytes.h"
+#include "hashing/secure.h"
 #include "metrics/metrics.h"
 #include "model/record.h"
 #include "model/record_batch_reader.h"
@@ -34,6 +36,7 @@
 #include <seastar/core/align.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/posix.hh>
+#include <seastar/core/seastar.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/coroutine/as_future.hh>
@@ -49,6 +52,8 @@
 #include <alloca.h>
 #include <cmath>
 #include <csignal>
+#include <filesystem>
+#include <fstream>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -86,6 +91,12 @@ constexpr uint64_t fuel_amount = 5'000'000'000;
 // more than 1 millisecond max at once.
 constexpr uint64_t fuel_yield_interval = 2'000'000;
 
+// How long an engine waits at startup for a heap to be returned to the pool
+// when all of the heaps of the core are allocated to running engines. The
+// engines beyond the budget of the core fail to start past this.
+constexpr std::chrono::milliseconds heap_allocation_timeout
+  = std::chrono::seconds(10);
+
 // The reserved memory for an instance of a WebAssembly VM.
 //
 // The wasmtime memory APIs don't allow us to pass information into an
@@ -150,6 +161,7 @@ private:
 
     handle<wasm_engine_t, &wasm_engine_delete> _engine;
     std::unique_ptr<schema_registry> _sr;
+    std::optional<std::filesystem::path> _compilation_cache_dir;
     ssx::singleton_thread_worker _alien_thread;
     ss::sharded<wasm::heap_allocator> _heap_allocator;
     ss::sharded<stack_allocator> _stack_allocator;
@@ -169,6 +181,83 @@ void check_error(const wasmtime_error_t* error) {
     throw wasm_exception(std::move(str), errc::load_failure);
 }
 
+/**
+ * The file a compiled module is cached in, keyed by the hash of the module.
+ *
+ * Wasmtime checks that the cached module was compiled by the same version of
+ * wasmtime with the same settings as the engine, a module that wasn't is
+ * compiled again.
+ */
+std::filesystem::path
+compiled_module_path(const std::filesystem::path& dir, bytes_view module) {
+    hash_sha256 h;
+    h.update(module);
+    return dir / ss::format("{}.cwasm", to_hex(h.reset()));
+}
+
+/**
+ * Load a cached compiled module, the file is mapped in memory rather than
+ * read. Returns nullptr when there is no usable cached module.
+ *
+ * Must be called on the alien thread.
+ */
+wasmtime_module_t*
+load_compiled_module(wasm_engine_t* engine, const std::filesystem::path& path) {
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec)) {
+        return nullptr;
+    }
+    wasmtime_module_t* module = nullptr;
+    handle<wasmtime_error_t, wasmtime_error_delete> error{
+      wasmtime_module_deserialize_file(engine, path.c_str(), &module)};
+    try {
+        check_error(error.get());
+    } catch (const std::exception& ex) {
+        vlog(
+          wasm_log.info,
+          "unable to load the cached compiled wasm module {}: {}",
+          path.string(),
+          ex.what());
+        return nullptr;
+    }
+    return module;
+}
+
+/**
+ * Cache a compiled module, a failure to do so is only logged.
+ *
+ * Must be called on the alien thread.
+ */
+void store_compiled_module(
+  wasmtime_module_t* module, const std::filesystem::path& path) {
+    wasm_byte_vec_t serialized{.size = 0, .data = nullptr};
+    auto cleanup = ss::defer(
+      [&serialized]() noexcept { wasm_byte_vec_delete(&serialized); });
+    try {
+        handle<wasmtime_error_t, wasmtime_error_delete> error{
+          wasmtime_module_serialize(module, &serialized)};
+        check_error(error.get());
+        // Written to a temporary file first so that a partially written module
+        // is never loaded.
+        auto tmp = path;
+        tmp += ".tmp";
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        out.write(
+          serialized.data, static_cast<std::streamsize>(serialized.size));
+        out.close();
+        if (!out) {
+            throw std::runtime_error("failed to write the compiled module");
+        }
+        std::filesystem::rename(tmp, path);
+    } catch (...) {
+        vlog(
+          wasm_log.warn,
+          "unable to cache the compiled wasm module {}: {}",
+          path.string(),
+          std::current_exception());
+    }
+}
+
 wasm_trap_t* make_trap(std::exception_ptr ex) {
     auto msg = ss::format("failure executing host function: {}", ex);
     return wasmtime_trap_new(msg.data(), msg.size());
@@ -601,11 +690,13 @@ private:
         auto requested = _preinitialized->mem_limits();
 
         // Wait for memory to be available if the allocator is currently freeing
-        // memory.
-        auto memory = co_await _runtime->heap_allocator()->allocate({
-          .minimum = requested.minimum,
-          .maximum = std::min(requested.maximum, max_memory_size),
-        });
+        // memory, or if all of the memory is allocated to other engines.
+        auto memory = co_await _runtime->heap_allocator()->allocate(
+          {
+            .minimum = requested.minimum,
+            .maximum = std::min(requested.maximum, max_memory_size),
+          },
+          heap_allocation_timeout);
 
         if (!memory) {
             throw wasm_exception(
@@ -1175,6 +1266,9 @@ void register_transform_module(
     REG_HOST_FN(read_batch_header);
     REG_HOST_FN(read_next_record);
     REG_HOST_FN(write_record);
+    REG_HOST_FN(check_abi_version_2);
+    REG_HOST_FN(read_records);
+    REG_HOST_FN(write_records);
 #undef REG_HOST_FN
 }
 
@@ -1315,9 +1409,15 @@ ss::future<> wasmtime_runtime::start(runtime::config c) {
       .num_heaps = num_heaps,
       .memset_chunk_size = memset_chunk_size,
     });
+    co_await _heap_allocator.invoke_on_all(&heap_allocator::setup_metrics);
     co_await _stack_allocator.start(stack_allocator::config{
       .tracking_enabled = c.stack_memory.debug_host_stack_usage,
     });
+    _compilation_cache_dir = c.compilation_cache.directory;
+    if (_compilation_cache_dir) {
+        co_await ss::recursive_touch_directory(
+          _compilation_cache_dir->string());
+    }
     co_await _alien_thread.start({.name = "wasm"});
     co_await ss::smp::invoke_on_all([] {
         // wasmtime needs some signals for it's handling, make sure we
@@ -1369,18 +1469,34 @@ ss::future<ss::shared_ptr<factory>> wasmtime_runtime::make_factory(
     };
     size_t memory_usage_size = co_await _alien_thread.submit(
       [this, &meta, &buf, &preinitialized, &ssc] {
-          vlog(wasm_log.debug, "compiling wasm module {}", meta.name);
           // This can be a large contiguous allocation, however it happens
           // on an alien thread so it bypasses the seastar allocator.
           bytes b = iobuf_to_bytes(buf);
           wasmtime_module_t* user_module_ptr = nullptr;
-          handle<wasmtime_error_t, wasmtime_error_delete> error{
-            wasmtime_module_new(
-              _engine.get(), b.data(), b.size(), &user_module_ptr)};
-          check_error(error.get());
+          std::optional<std::filesystem::path> cached_path;
+          if (_compilation_cache_dir) {
+              cached_path = compiled_module_path(*_compilation_cache_dir, b);
+              user_module_ptr = load_compiled_module(
+                _engine.get(), *cached_path);
+          }
+          handle<wasmtime_error_t, wasmtime_error_delete> error;
+          if (user_module_ptr) {
+              vlog(
+                wasm_log.info,
+                "Loaded cached compiled wasm module {}",
+                meta.name);
+          } else {
+              vlog(wasm_log.debug, "compiling wasm module {}", meta.name);
+              error.reset(wasmtime_module_new(
+                _engine.get(), b.data(), b.size(), &user_module_ptr));
+              check_error(error.get());
+              wasm_log.info("Finished compiling wasm module {}", meta.name);
+              if (cached_path) {
+                  store_compiled_module(user_module_ptr, *cached_path);
+              }
+          }
           handle<wasmtime_module_t, wasmtime_module_delete> user_module{
             user_module_ptr};
-          wasm_log.info("Finished compiling wasm module {}", meta.name);
 
           handle<wasmtime_linker_t, wasmtime_linker_delete> linker{
             wasmtime_linker_new(_engine.get())};